@@ -15,9 +15,11 @@ CN(check_public)(const CN(public_key) *pk)
 	 * non-zero field element w such that (w^2 - a)^2 - 4*b is
 	 * a quadratic residue. CURVE_decode() will do all that,
 	 * except that it returns 1 for an all-zero input, but we
-	 * defined that public keys cannot be the group neutral.
+	 * defined that public keys cannot be the group neutral. The
+	 * public key is public data, so we can use the faster
+	 * variable-time decoding.
 	 */
-	r = (unsigned)CN(decode)(NULL, pk->b);
+	r = (unsigned)CN(decode_vartime)(NULL, pk->b);
 	t = 0;
 	for (i = 0; i < 32; i ++) {
 		t |= pk->b[i];
@@ -309,7 +311,7 @@ CN(verify_vartime)(const CN(signature) *sig, const CN(public_key) *pk,
 	 * Decode the signer public key. If it is invalid, then verification
 	 * should fail.
 	 */
-	if (!CN(decode)(&Q, pk->b) || CN(is_neutral)(&Q)) {
+	if (!CN(decode_vartime)(&Q, pk->b) || CN(is_neutral)(&Q)) {
 		return 0;
 	}
 
@@ -325,3 +327,515 @@ CN(verify_vartime)(const CN(signature) *sig, const CN(public_key) *pk,
 	 */
 	return CN(verify_helper_vartime)(s, &Q, e, sig->b);
 }
+
+/* see do255_alg.h */
+int
+CN(expand_public_key)(CN(expanded_public_key) *epk,
+	const CN(public_key) *pk)
+{
+	CN(point) Q;
+	int r;
+
+	/*
+	 * An invalid public key is replaced with the neutral (for which
+	 * the table is cheap to build), and marked as such.
+	 */
+	epk->pk = *pk;
+	r = CN(decode_vartime)(&Q, pk->b) && !CN(is_neutral)(&Q);
+	if (!r) {
+		Q = CN(neutral);
+	}
+	CN(verify_table_init)(&epk->tab, &Q);
+	epk->valid = r;
+	return r;
+}
+
+/* see do255_alg.h */
+int
+CN(verify_vartime_expanded)(const CN(signature) *sig,
+	const CN(expanded_public_key) *epk,
+	const char *hash_oid, const void *hv, size_t hv_len)
+{
+	shake_context sc;
+	unsigned char e[32];
+	const unsigned char *s;
+
+	static const unsigned char zero[32] = { 0 };
+
+	if (hash_oid == NULL) {
+		hash_oid = "";
+	}
+
+	/*
+	 * Same process as CURVE_verify_vartime(); the public key was
+	 * decoded (and validated) when it was expanded.
+	 */
+	s = sig->b + 32;
+	if (!CN(scalar_is_reduced)(s)) {
+		return 0;
+	}
+	if (!epk->valid) {
+		return 0;
+	}
+	make_e(&sc, e, sig->b, &epk->pk, hash_oid, hv, hv_len);
+	CN(scalar_sub)(e, zero, e);
+	return CN(verify_helper_table_vartime)(s, &epk->tab, e, sig->b);
+}
+
+/*
+ * Get the KT128 hash of the message (32 bytes) for the streaming API.
+ */
+static void
+ctx_hash(kt128_context *kc, unsigned char *hv)
+{
+	kt128_flip(kc, NULL, 0);
+	kt128_extract(kc, hv, 32);
+}
+
+/* see do255_alg.h */
+void
+CN(sign_ctx_init)(CN(sign_context) *sc)
+{
+	kt128_init(&sc->kc);
+}
+
+/* see do255_alg.h */
+void
+CN(sign_ctx_update)(CN(sign_context) *sc, const void *data, size_t len)
+{
+	kt128_inject(&sc->kc, data, len);
+}
+
+/* see do255_alg.h */
+void
+CN(sign_ctx_final)(CN(signature) *sig, CN(sign_context) *sc,
+	const CN(private_key) *sk, const CN(public_key) *pk,
+	const void *seed, size_t seed_len)
+{
+	unsigned char hv[32];
+
+	ctx_hash(&sc->kc, hv);
+	CN(sign)(sig, sk, pk, DO255_OID_KT128, hv, sizeof hv,
+		seed, seed_len);
+}
+
+/* see do255_alg.h */
+void
+CN(verify_ctx_init)(CN(verify_context) *vc)
+{
+	kt128_init(&vc->kc);
+}
+
+/* see do255_alg.h */
+void
+CN(verify_ctx_update)(CN(verify_context) *vc, const void *data, size_t len)
+{
+	kt128_inject(&vc->kc, data, len);
+}
+
+/* see do255_alg.h */
+int
+CN(verify_ctx_final_vartime)(CN(verify_context) *vc,
+	const CN(signature) *sig, const CN(public_key) *pk)
+{
+	unsigned char hv[32];
+
+	ctx_hash(&vc->kc, hv);
+	return CN(verify_vartime)(sig, pk, DO255_OID_KT128, hv, sizeof hv);
+}
+
+/*
+ * Number of nonces computed together by CN(nonce_pool_refill)(); the
+ * points are computed four at a time, and encoded with a single shared
+ * inversion.
+ */
+#define NONCE_BATCH   16
+
+/*
+ * (Re)seed the random generator of a nonce pool.
+ */
+static void
+nonce_pool_seed(shake_context *rng, const void *seed, size_t seed_len)
+{
+	shake_init(rng, 256);
+	shake_inject(rng, DOM_NONCE_POOL, strlen(DOM_NONCE_POOL));
+	shake_inject(rng, seed, seed_len);
+	shake_flip(rng);
+}
+
+/* see do255_alg.h */
+void
+CN(nonce_pool_init)(CN(nonce_pool) *pool,
+	CN(nonce) *entries, size_t capacity,
+	const void *seed, size_t seed_len)
+{
+	pool->entries = entries;
+	pool->capacity = capacity;
+	pool->count = 0;
+	nonce_pool_seed(&pool->rng, seed, seed_len);
+}
+
+/* see do255_alg.h */
+size_t
+CN(nonce_pool_refill)(CN(nonce_pool) *pool, size_t max)
+{
+	unsigned char k[NONCE_BATCH * 32], R_enc[NONCE_BATCH * 32];
+	CN(point) R[NONCE_BATCH];
+	size_t num, added;
+
+	num = pool->capacity - pool->count;
+	if (max != 0 && num > max) {
+		num = max;
+	}
+	for (added = 0; added < num;) {
+		size_t n, u;
+
+		n = num - added;
+		if (n > NONCE_BATCH) {
+			n = NONCE_BATCH;
+		}
+
+		/*
+		 * As in CN(keygen)(), 32 bytes of output are enough since
+		 * r is close to 2^254. A zero k would not be a problem
+		 * (see CN(sign)()).
+		 */
+		shake_extract(&pool->rng, k, n * 32);
+		for (u = 0; u < n; u ++) {
+			CN(scalar_reduce)(k + 32 * u, k + 32 * u, 32);
+		}
+		for (u = 0; u + 4 <= n; u += 4) {
+			CN(mulgen_x4)(R + u, k + 32 * u);
+		}
+		for (; u < n; u ++) {
+			CN(mulgen)(&R[u], k + 32 * u);
+		}
+		CN(encode_batch)(R_enc, R, n);
+
+		for (u = 0; u < n; u ++) {
+			CN(nonce) *ne;
+
+			ne = &pool->entries[pool->count ++];
+			memcpy(ne->k, k + 32 * u, 32);
+			memcpy(ne->R_enc, R_enc + 32 * u, 32);
+		}
+		added += n;
+	}
+	memset(k, 0, sizeof k);
+
+	/*
+	 * Replace the generator state with a value derived from it, so
+	 * that the nonces produced so far cannot be recomputed from the
+	 * pool state if it leaks later on.
+	 */
+	if (added > 0) {
+		shake_extract(&pool->rng, k, 32);
+		nonce_pool_seed(&pool->rng, k, 32);
+		memset(k, 0, 32);
+	}
+	return added;
+}
+
+/* see do255_alg.h */
+void
+CN(nonce_pool_clear)(CN(nonce_pool) *pool)
+{
+	memset(pool->entries, 0, pool->capacity * sizeof *pool->entries);
+	pool->count = 0;
+	memset(&pool->rng, 0, sizeof pool->rng);
+}
+
+/* see do255_alg.h */
+int
+CN(sign_with_pool)(CN(signature) *sig, CN(nonce_pool) *pool,
+	const CN(private_key) *sk, const CN(public_key) *pk,
+	const char *hash_oid, const void *hv, size_t hv_len)
+{
+	shake_context sc;
+	unsigned char k[32], e[32];
+	CN(nonce) *ne;
+
+	if (pool->count == 0) {
+		return 0;
+	}
+	if (hash_oid == NULL) {
+		hash_oid = "";
+	}
+
+	/*
+	 * Take the last entry and wipe it from the pool, so that it can
+	 * never be used twice.
+	 */
+	ne = &pool->entries[-- pool->count];
+	memcpy(k, ne->k, 32);
+	memcpy(sig->b, ne->R_enc, 32);
+	memset(ne, 0, sizeof *ne);
+
+	/*
+	 * Same computation as in CN(sign)(), with R already encoded.
+	 */
+	make_e(&sc, e, sig->b, pk, hash_oid, hv, hv_len);
+	CN(scalar_mul)(e, e, sk->b);
+	CN(scalar_add)(sig->b + 32, k, e);
+	memset(k, 0, sizeof k);
+	return 1;
+}
+
+/*
+ * Context for an entry in batch verification: scalars s (from the
+ * signature), -e (negated challenge) and z (random coefficient), the
+ * decoded public key Q, and the encoded commitment R. The public key
+ * and hash value pointers are kept for computing the challenge.
+ */
+typedef struct {
+	unsigned char s[32];
+	unsigned char ne[32];
+	unsigned char z[32];
+	unsigned char R[32];
+	CN(point) Q;
+	const CN(public_key) *pk;
+	const void *hv;
+	size_t index;
+} CN(batch_entry);
+
+/*
+ * Compute the challenges (as make_e()) for the four batch entries
+ * be[0] to be[3], with a four-way SHAKE256. The challenges are written
+ * in the ne[] fields (not negated yet).
+ */
+static void
+make_e_x4(CN(batch_entry) *be, const char *hash_oid, size_t hv_len)
+{
+	shake_x4_context sc;
+	const void *in[4];
+	void *out[4];
+	int j;
+
+	shake_x4_init(&sc, 256);
+	for (j = 0; j < 4; j ++) {
+		in[j] = DOM_SIGN_E;
+	}
+	shake_x4_inject(&sc, in, strlen(DOM_SIGN_E));
+	for (j = 0; j < 4; j ++) {
+		in[j] = be[j].R;
+	}
+	shake_x4_inject(&sc, in, 32);
+	for (j = 0; j < 4; j ++) {
+		in[j] = be[j].pk->b;
+	}
+	shake_x4_inject(&sc, in, 32);
+	for (j = 0; j < 4; j ++) {
+		in[j] = hash_oid;
+	}
+	shake_x4_inject(&sc, in, strlen(hash_oid));
+	for (j = 0; j < 4; j ++) {
+		in[j] = ":";
+	}
+	shake_x4_inject(&sc, in, 1);
+	for (j = 0; j < 4; j ++) {
+		in[j] = be[j].hv;
+	}
+	shake_x4_inject(&sc, in, hv_len);
+	shake_x4_flip(&sc);
+	for (j = 0; j < 4; j ++) {
+		out[j] = be[j].ne;
+	}
+	shake_x4_extract(&sc, out, 32);
+}
+
+/*
+ * Verify the combined equation for entries be[0] to be[num-1]. The
+ * sum of z_i*(s_i*G - e_i*Q_i - R_i) is computed and compared with
+ * the neutral.
+ */
+static int
+batch_combined(const CN(batch_entry) *be, size_t num)
+{
+	unsigned char k0[32], k1[DO255_VERIFY_BATCH_MAX][32];
+	unsigned char k2[DO255_VERIFY_BATCH_MAX][16];
+	unsigned char R_enc[DO255_VERIFY_BATCH_MAX][32];
+	CN(point) P[DO255_VERIFY_BATCH_MAX];
+	size_t u;
+
+	memset(k0, 0, sizeof k0);
+	for (u = 0; u < num; u ++) {
+		unsigned char t[32];
+
+		CN(scalar_mul)(t, be[u].z, be[u].s);
+		CN(scalar_add)(k0, k0, t);
+		CN(scalar_mul)(k1[u], be[u].z, be[u].ne);
+		memcpy(k2[u], be[u].z, 16);
+		memcpy(R_enc[u], be[u].R, 32);
+		P[u] = be[u].Q;
+	}
+	return CN(verify_batch_helper_vartime)(k0, P, k1, R_enc, k2, num);
+}
+
+/*
+ * Verify entries be[0] to be[num-1], and set the results[] for them.
+ * If known_bad is non-zero, then the caller already knows that at
+ * least one entry is invalid, and the combined test is skipped.
+ * Returned value is 1 if all entries are valid, 0 otherwise.
+ */
+static int
+batch_check(const CN(batch_entry) *be, size_t num, int known_bad,
+	unsigned char *results)
+{
+	size_t u, h;
+	int r;
+
+	if (num == 1) {
+		r = CN(verify_helper_vartime)(be[0].s, &be[0].Q,
+			be[0].ne, be[0].R);
+		if (results != NULL) {
+			results[be[0].index] = (unsigned char)r;
+		}
+		return r;
+	}
+	if (!known_bad && batch_combined(be, num)) {
+		if (results != NULL) {
+			for (u = 0; u < num; u ++) {
+				results[be[u].index] = 1;
+			}
+		}
+		return 1;
+	}
+
+	/*
+	 * Bisection: if the first half is valid, then the second half
+	 * must contain an invalid entry.
+	 */
+	h = num >> 1;
+	r = batch_check(be, h, 0, results);
+	if (batch_check(be + h, num - h, r, results) == 0) {
+		r = 0;
+	}
+	return r;
+}
+
+/* see do255_alg.h */
+int
+CN(verify_batch_vartime)(unsigned char *results,
+	const CN(signature) *sig, size_t sig_stride,
+	const CN(public_key) *pk, size_t pk_stride,
+	const char *hash_oid, const void *hv, size_t hv_len, size_t hv_stride,
+	size_t num, shake_context *rng)
+{
+	CN(batch_entry) be[DO255_VERIFY_BATCH_MAX];
+	unsigned char seed[32];
+	const unsigned char *last_pk;
+	CN(point) last_Q;
+	int last_ok, r;
+	size_t u;
+
+	static const unsigned char zero[32] = { 0 };
+
+	if (hash_oid == NULL) {
+		hash_oid = "";
+	}
+	if (rng != NULL) {
+		shake_extract(rng, seed, sizeof seed);
+	}
+
+	r = 1;
+	last_pk = NULL;
+	last_ok = 0;
+	u = 0;
+	while (u < num) {
+		shake_context sc;
+		size_t n, v;
+
+		/*
+		 * Gather the next group of entries. Entries with an
+		 * out-of-range s or an invalid public key are rejected
+		 * immediately.
+		 */
+		n = 0;
+		while (u < num && n < DO255_VERIFY_BATCH_MAX) {
+			const CN(signature) *sg;
+			const CN(public_key) *pp;
+			const void *hh;
+			CN(batch_entry) *e;
+
+			sg = (const void *)((const unsigned char *)sig
+				+ u * sig_stride);
+			pp = (const void *)((const unsigned char *)pk
+				+ u * pk_stride);
+			hh = (const unsigned char *)hv + u * hv_stride;
+			e = &be[n];
+
+			/*
+			 * Consecutive signatures often use the same public
+			 * key; we then decode it only once.
+			 */
+			if (last_pk == NULL
+				|| memcmp(last_pk, pp->b, 32) != 0)
+			{
+				last_ok = CN(decode_vartime)(&last_Q, pp->b)
+					&& !CN(is_neutral)(&last_Q);
+				last_pk = pp->b;
+			}
+			if (!last_ok || !CN(scalar_is_reduced)(sg->b + 32)) {
+				if (results != NULL) {
+					results[u] = 0;
+				}
+				r = 0;
+				u ++;
+				continue;
+			}
+			e->Q = last_Q;
+			memcpy(e->s, sg->b + 32, 32);
+			memcpy(e->R, sg->b, 32);
+			e->pk = pp;
+			e->hv = hh;
+			e->index = u;
+			n ++;
+			u ++;
+		}
+		if (n == 0) {
+			continue;
+		}
+
+		/*
+		 * Compute the challenges, four at a time (all entries
+		 * share the hash function identifier and the hash value
+		 * length, so the four SHAKE states stay in sync).
+		 */
+		for (v = 0; v + 4 <= n; v += 4) {
+			make_e_x4(be + v, hash_oid, hv_len);
+		}
+		for (; v < n; v ++) {
+			make_e(&sc, be[v].ne, be[v].R, be[v].pk,
+				hash_oid, be[v].hv, hv_len);
+		}
+		for (v = 0; v < n; v ++) {
+			CN(scalar_sub)(be[v].ne, zero, be[v].ne);
+		}
+
+		/*
+		 * Derive the random coefficients z_i. They are 128-bit
+		 * values; we force the top bit so that they are non-zero.
+		 */
+		shake_init(&sc, 256);
+		shake_inject(&sc, DOM_VERIFY_BATCH, strlen(DOM_VERIFY_BATCH));
+		if (rng != NULL) {
+			shake_inject(&sc, seed, sizeof seed);
+		}
+		for (v = 0; v < n; v ++) {
+			shake_inject(&sc, be[v].R, 32);
+			shake_inject(&sc, be[v].s, 32);
+			shake_inject(&sc, be[v].ne, 32);
+		}
+		shake_flip(&sc);
+		for (v = 0; v < n; v ++) {
+			shake_extract(&sc, be[v].z, 16);
+			be[v].z[15] |= 0x80;
+			memset(be[v].z + 16, 0, 16);
+		}
+
+		if (!batch_check(be, n, 0, results)) {
+			r = 0;
+		}
+	}
+	return r;
+}
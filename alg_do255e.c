@@ -8,5 +8,7 @@
 #define DOM_ECDH     "do255e-ecdh:"
 #define DOM_SIGN_K   "do255e-sign-k:"
 #define DOM_SIGN_E   "do255e-sign-e:"
+#define DOM_NONCE_POOL   "do255e-nonce-pool:"
+#define DOM_VERIFY_BATCH   "do255e-verify-batch:"
 
 #include "alg.c"
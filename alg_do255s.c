@@ -8,5 +8,7 @@
 #define DOM_ECDH     "do255s-ecdh:"
 #define DOM_SIGN_K   "do255s-sign-k:"
 #define DOM_SIGN_E   "do255s-sign-e:"
+#define DOM_NONCE_POOL   "do255s-nonce-pool:"
+#define DOM_VERIFY_BATCH   "do255s-verify-batch:"
 
 #include "alg.c"
@@ -0,0 +1,208 @@
+/*
+ * Comparison of the field inversion algorithms of the 64-bit
+ * implementations: the optimized binary GCD (gf_inv_bingcd(), the
+ * default), the Bernstein-Yang "safegcd" (gf_inv_safegcd(), used
+ * when the library is compiled with DO255_INV_SAFEGCD=1), and the
+ * variable-time inversion (gf_inv_vartime(), used on public data). The
+ * variable-time Legendre symbol (gf_legendre_vartime()) is compared
+ * with the constant-time gf_legendre() as well.
+ *
+ * This program is compiled with the implementation of one curve and
+ * one backend (-DBENCH_DO255S=0 for do255e, -DBENCH_DO255S=1 for
+ * do255s; -DBENCH_BMI2=0 for w64, -DBENCH_BMI2=1 for bmi2). It first
+ * checks that all variants return the same results on random and
+ * special inputs, then prints the median cost of each function, in
+ * clock cycles (as measured with rdtsc).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <immintrin.h>
+
+#if BENCH_DO255S
+#if BENCH_BMI2
+#include "do255s_bmi2.c"
+#define IMPL_NAME   "do255s_bmi2"
+#else
+#include "do255s_w64.c"
+#define IMPL_NAME   "do255s_w64"
+#endif
+#else
+#if BENCH_BMI2
+#include "do255e_bmi2.c"
+#define IMPL_NAME   "do255e_bmi2"
+#else
+#include "do255e_w64.c"
+#define IMPL_NAME   "do255e_w64"
+#endif
+#endif
+
+#include "sha3.h"
+
+static inline uint64_t
+core_cycles(void)
+{
+#if defined __GNUC__ && !defined __clang__
+	uint32_t hi, lo;
+
+	_mm_lfence();
+	__asm__ __volatile__ ("rdtsc" : "=d" (hi), "=a" (lo) : : );
+	return ((uint64_t)hi << 32) | (uint64_t)lo;
+#else
+	_mm_lfence();
+	return __rdtsc();
+#endif
+}
+
+static int
+cmp_u64(const void *p1, const void *p2)
+{
+	uint64_t v1, v2;
+
+	v1 = *(const uint64_t *)p1;
+	v2 = *(const uint64_t *)p2;
+	if (v1 < v2) {
+		return -1;
+	} else if (v1 == v2) {
+		return 0;
+	} else {
+		return 1;
+	}
+}
+
+/*
+ * Compare the inversion and Legendre symbol functions on input a; exit
+ * on mismatch.
+ */
+static void
+check_inv(const gf *a)
+{
+	gf d1, d2, d3;
+	uint64_t r1, r2, r3;
+
+	r1 = gf_inv_bingcd(&d1, a);
+	r2 = gf_inv_safegcd(&d2, a);
+	r3 = gf_inv_vartime(&d3, a);
+	if (r1 != r2 || r1 != r3 || !gf_eq(&d1, &d2) || !gf_eq(&d1, &d3)) {
+		fprintf(stderr, "ERR: inversion mismatch on:"
+			" %016llX%016llX%016llX%016llX\n",
+			(unsigned long long)a->v3, (unsigned long long)a->v2,
+			(unsigned long long)a->v1, (unsigned long long)a->v0);
+		exit(EXIT_FAILURE);
+	}
+	if (gf_legendre(a) != gf_legendre_vartime(a)) {
+		fprintf(stderr, "ERR: Legendre symbol mismatch on:"
+			" %016llX%016llX%016llX%016llX\n",
+			(unsigned long long)a->v3, (unsigned long long)a->v2,
+			(unsigned long long)a->v1, (unsigned long long)a->v0);
+		exit(EXIT_FAILURE);
+	}
+}
+
+/*
+ * Get the median cost of one call to the provided Legendre symbol
+ * function (on successive values).
+ */
+static uint64_t
+speed_legendre(int64_t (*leg)(const gf *y), const gf *a)
+{
+	uint64_t tt[1000];
+	gf x;
+	size_t u;
+
+	x = *a;
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		begin = core_cycles();
+		x.v0 += (uint64_t)leg(&x);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	return tt[500];
+}
+
+/*
+ * Get the median cost of one call to the provided inversion function.
+ * Each call uses the output of the previous one as input.
+ */
+static uint64_t
+speed_inv(uint64_t (*inv)(gf *d, const gf *y), const gf *a)
+{
+	uint64_t tt[1000];
+	gf x;
+	size_t u;
+
+	x = *a;
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		begin = core_cycles();
+		inv(&x, &x);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	return tt[500];
+}
+
+int
+main(void)
+{
+	shake_context sc;
+	gf a;
+	uint64_t t1, t2, t3, t4, t5;
+	int i;
+
+	/*
+	 * Special values: 0, 1, -1, p, 2^256-1 (the last two are not
+	 * normalized).
+	 */
+	a = GF_ZERO;
+	check_inv(&a);
+	a = GF_ONE;
+	check_inv(&a);
+	gf_neg(&a, &GF_ONE);
+	check_inv(&a);
+	a = GF_P;
+	check_inv(&a);
+	a.v0 = a.v1 = a.v2 = a.v3 = (uint64_t)-1;
+	check_inv(&a);
+
+	/*
+	 * Random values.
+	 */
+	shake_init(&sc, 256);
+	shake_inject(&sc, "bench_inv", 9);
+	shake_flip(&sc);
+	for (i = 0; i < 100000; i ++) {
+		uint8_t buf[32];
+
+		shake_extract(&sc, buf, sizeof buf);
+		a.v0 = dec64le(buf);
+		a.v1 = dec64le(buf + 8);
+		a.v2 = dec64le(buf + 16);
+		a.v3 = dec64le(buf + 24);
+		check_inv(&a);
+	}
+
+	/*
+	 * Speed.
+	 */
+	t1 = speed_inv(&gf_inv_bingcd, &a);
+	t2 = speed_inv(&gf_inv_safegcd, &a);
+	t3 = speed_inv(&gf_inv_vartime, &a);
+	t4 = speed_legendre(&gf_legendre, &a);
+	t5 = speed_legendre(&gf_legendre_vartime, &a);
+	printf("%-12s  inv:       bingcd %6lu  safegcd %6lu  vartime %6lu\n",
+		IMPL_NAME, (unsigned long)t1, (unsigned long)t2,
+		(unsigned long)t3);
+	printf("%-12s  legendre:  ct     %6lu                  vartime %6lu\n",
+		IMPL_NAME, (unsigned long)t4, (unsigned long)t5);
+	return 0;
+}
@@ -0,0 +1,298 @@
+/*
+ * Microbenchmark of the internal primitives of one implementation:
+ * field operations (gf_mul(), gf_sqr(), gf_sqr_x(), gf_inv(), gf_sqrt(),
+ * gf_legendre()), point operations (add, add_mixed, double, double_x,
+ * and for do255e with 64-bit limbs, the (x,u) add_mixed_xu and
+ * double_x_xu), constant-time window lookups, and scalar helpers
+ * (split_scalar() for do255e, reduce_basis_vartime() for do255s,
+ * modr_mul256x256()). These functions are static in the library, hence
+ * this program includes the same source file as the library (e.g.
+ * do255e_w64.c) and calls them directly; this allows tuning a backend
+ * on primitive-level costs rather than only on complete operations.
+ *
+ * This program is compiled with the implementation of one curve and
+ * one backend: -DBENCH_DO255S=0 for do255e, -DBENCH_DO255S=1 for
+ * do255s; the backend is w64 by default, or bmi2, avx2 or w32 with
+ * -DBENCH_BMI2=1, -DBENCH_AVX2=1 or -DBENCH_W32=1, respectively. It
+ * first makes a few consistency checks on the field operations, then
+ * prints the median cost of each primitive, in clock cycles (as
+ * measured with rdtsc). Each measure covers a sequence of calls, each
+ * call using the output of the previous one as input, so that costs
+ * are latencies, not throughputs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <immintrin.h>
+
+#ifndef BENCH_DO255S
+#define BENCH_DO255S   0
+#endif
+#ifndef BENCH_BMI2
+#define BENCH_BMI2     0
+#endif
+#ifndef BENCH_AVX2
+#define BENCH_AVX2     0
+#endif
+#ifndef BENCH_W32
+#define BENCH_W32      0
+#endif
+
+#if BENCH_DO255S
+#if BENCH_AVX2
+#include "do255s_avx2.c"
+#define IMPL_NAME   "do255s_avx2"
+#elif BENCH_BMI2
+#include "do255s_bmi2.c"
+#define IMPL_NAME   "do255s_bmi2"
+#elif BENCH_W32
+#include "do255s_w32.c"
+#define IMPL_NAME   "do255s_w32"
+#else
+#include "do255s_w64.c"
+#define IMPL_NAME   "do255s_w64"
+#endif
+#else
+#if BENCH_AVX2
+#include "do255e_avx2.c"
+#define IMPL_NAME   "do255e_avx2"
+#elif BENCH_BMI2
+#include "do255e_bmi2.c"
+#define IMPL_NAME   "do255e_bmi2"
+#elif BENCH_W32
+#include "do255e_w32.c"
+#define IMPL_NAME   "do255e_w32"
+#else
+#include "do255e_w64.c"
+#define IMPL_NAME   "do255e_w64"
+#endif
+#endif
+
+#include "sha3.h"
+
+/*
+ * Access to the low limb of a field element, and size of the windows
+ * used by the constant-time point multiplications.
+ */
+#if BENCH_W32
+#define GF_LOW(a)      ((a).v[0])
+#define WIN_SIZE       8
+#define window_lookup  window_lookup_8_affine
+#define window_fill    window_fill_8_affine
+#else
+#define GF_LOW(a)      ((a).v0)
+#define WIN_SIZE       16
+#define window_lookup  window_lookup_16_affine
+#define window_fill    window_fill_16_affine
+#endif
+
+static inline uint64_t
+core_cycles(void)
+{
+#if defined __GNUC__ && !defined __clang__
+	uint32_t hi, lo;
+
+	_mm_lfence();
+	__asm__ __volatile__ ("rdtsc" : "=d" (hi), "=a" (lo) : : );
+	return ((uint64_t)hi << 32) | (uint64_t)lo;
+#else
+	_mm_lfence();
+	return __rdtsc();
+#endif
+}
+
+static int
+cmp_u64(const void *p1, const void *p2)
+{
+	uint64_t v1, v2;
+
+	v1 = *(const uint64_t *)p1;
+	v2 = *(const uint64_t *)p2;
+	if (v1 < v2) {
+		return -1;
+	} else if (v1 == v2) {
+		return 0;
+	} else {
+		return 1;
+	}
+}
+
+/*
+ * Operands. They are global so that the compiler cannot optimize away
+ * the calls or move them out of the measured loops.
+ */
+static gf ga, gb;
+static CN(point) P, Q;
+static CN(point_affine) A, win[WIN_SIZE];
+#if !BENCH_DO255S && !BENCH_W32
+static CN(point_xu) Pxu;
+#endif
+#if BENCH_AVX2
+static gf4 g4a, g4b;
+#endif
+static i256 ia, ib;
+static uint8_t sc[32];
+static size_t win_index;
+static uint64_t sink;
+
+/*
+ * Print the median cost of one call to a primitive. The statement
+ * 'call' is executed 'reps' times per measure; there are 1000 measures
+ * (after 1000 warm-up measures).
+ */
+#define SPEED(name, reps, call)   do { \
+		uint64_t tt[1000]; \
+		size_t u, v; \
+		for (u = 0; u < 2000; u ++) { \
+			uint64_t begin, end; \
+			begin = core_cycles(); \
+			for (v = 0; v < (reps); v ++) { \
+				call; \
+			} \
+			end = core_cycles(); \
+			if (u >= 1000) { \
+				tt[u - 1000] = end - begin; \
+			} \
+		} \
+		qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64); \
+		printf("%-12s  %-24s %10.1f\n", IMPL_NAME, name, \
+			(double)tt[500] / (double)(reps)); \
+		fflush(stdout); \
+	} while (0)
+
+static void
+fail(const char *msg)
+{
+	fprintf(stderr, "ERR: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * Quick consistency checks on the field operations (the complete tests
+ * are in test_do255.c).
+ */
+static void
+check_gf(const gf *a)
+{
+	gf t1, t2, t3;
+
+	gf_mul(&t1, a, a);
+	gf_sqr(&t2, a);
+	if (!gf_eq(&t1, &t2)) {
+		fail("gf_mul / gf_sqr");
+	}
+	gf_sqr(&t1, &t2);
+	gf_sqr(&t1, &t1);
+	gf_sqr_x(&t3, a, 3);
+	if (!gf_eq(&t1, &t3)) {
+		fail("gf_sqr_x");
+	}
+	if (gf_legendre(&t2) != (gf_iszero(a) ? 0 : 1)) {
+		fail("gf_legendre");
+	}
+	if (!gf_sqrt(&t1, &t2)) {
+		fail("gf_sqrt (success)");
+	}
+	gf_sqr(&t1, &t1);
+	if (!gf_eq(&t1, &t2)) {
+		fail("gf_sqrt (value)");
+	}
+	gf_inv(&t1, a);
+	gf_mul(&t1, &t1, a);
+	if (!gf_iszero(a) && !gf_eq(&t1, &GF_ONE)) {
+		fail("gf_inv");
+	}
+}
+
+int
+main(void)
+{
+	shake_context rng;
+	uint8_t buf[64];
+	int i;
+
+	shake_init(&rng, 256);
+	shake_inject(&rng, "bench_prim", 10);
+	shake_flip(&rng);
+	check_gf(&GF_ZERO);
+	check_gf(&GF_ONE);
+	for (i = 0; i < 1000; i ++) {
+		shake_extract(&rng, buf, sizeof buf);
+		gf_decode_reduce(&ga, buf, sizeof buf);
+		check_gf(&ga);
+	}
+
+	shake_extract(&rng, buf, sizeof buf);
+	gf_decode_reduce(&ga, buf, sizeof buf);
+	shake_extract(&rng, buf, sizeof buf);
+	gf_decode_reduce(&gb, buf, sizeof buf);
+	shake_extract(&rng, sc, sizeof sc);
+	CN(mulgen)(&P, sc);
+	shake_extract(&rng, sc, sizeof sc);
+	CN(mulgen)(&Q, sc);
+	window_fill(win, &Q);
+	A = win[2];
+	shake_extract(&rng, buf, sizeof buf);
+	i256_decode(&ia, buf);
+	i256_decode(&ib, buf + 32);
+	shake_extract(&rng, sc, sizeof sc);
+
+	SPEED("gf_mul", 100, gf_mul(&ga, &ga, &gb));
+	SPEED("gf_sqr", 100, gf_sqr(&ga, &ga));
+	SPEED("gf_sqr_x(10)", 100, gf_sqr_x(&ga, &ga, 10));
+	SPEED("gf_inv", 10, gf_inv(&ga, &ga));
+	SPEED("gf_sqrt", 10, sink += gf_sqrt(&ga, &ga));
+	SPEED("gf_legendre", 10, GF_LOW(ga) += (uint64_t)gf_legendre(&ga));
+#if BENCH_AVX2
+	gf4_set1(&g4a, &ga);
+	gf4_set1(&g4b, &gb);
+	SPEED("gf4_mul (4 values)", 100, gf4_mul(&g4a, &g4a, &g4b));
+	SPEED("gf4_sqr (4 values)", 100, gf4_sqr(&g4a, &g4a));
+#endif
+
+	SPEED("add", 100, CN(add)(&P, &P, &Q));
+	SPEED("add_mixed", 100, CN(add_mixed)(&P, &P, &A));
+	SPEED("double", 100, CN(double)(&P, &P));
+	SPEED("double_x(5)", 100, CN(double_x)(&P, &P, 5));
+#if !BENCH_DO255S && !BENCH_W32
+	Pxu.X.w64 = GF_ZERO;
+	Pxu.Z.w64 = GF_ONE;
+	Pxu.U.w64 = GF_ZERO;
+	Pxu.T.w64 = GF_ONE;
+	CN(add_mixed_xu)(&Pxu, &Pxu, &window_G_xu[4]);
+	SPEED("add_mixed_xu", 100,
+		CN(add_mixed_xu)(&Pxu, &Pxu, &window_G_xu[4]));
+	SPEED("double_x_xu(5)", 100, CN(double_x_xu)(&Pxu, &Pxu, 5));
+#endif
+#if BENCH_W32
+	SPEED("window_lookup_8_affine", 100,
+		window_lookup(&A, win, win_index = (win_index + 5) % 9));
+#else
+	SPEED("window_lookup_16_affine", 100,
+		window_lookup(&A, win, win_index = (win_index + 7) % 17));
+#endif
+
+#if BENCH_DO255S
+	{
+		uint8_t c0[17], c1[17];
+
+		SPEED("reduce_basis_vartime", 10,
+			(reduce_basis_vartime(c0, c1, sc),
+			sc[0] += c0[0] ^ c1[0]));
+	}
+#else
+	{
+		i128 k0, k1;
+
+		SPEED("split_scalar", 100,
+			(split_scalar(&k0, &k1, sc),
+			sc[0] += *(uint8_t *)&k0 ^ *(uint8_t *)&k1));
+	}
+#endif
+	SPEED("modr_mul256x256", 100, modr_mul256x256(&ia, &ia, &ib));
+
+	if (sink == (uint64_t)-1) {
+		printf("(%lu)\n", (unsigned long)sink);
+	}
+	return 0;
+}
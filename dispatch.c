@@ -0,0 +1,138 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined macros CURVE and CN()
+ *  - defined the backend identifiers DO255_BACKEND_* and the function
+ *    do255_backend_id()
+ *
+ * This file defines all public functions of CURVE (except the neutral
+ * and generator constants) as wrappers that forward the call to the
+ * currently selected backend. Backends are compiled with the DO255_NS
+ * macro (see dispatch_ns.c), so that their functions are named
+ * CURVE_w64_*(), CURVE_bmi2_*() and CURVE_avx2_*().
+ */
+
+/*
+ * List of the public functions. Each entry is either
+ * R(ns, rettype, name, params, args) for a function which returns a
+ * value, or V(ns, name, params, args) for a function which returns
+ * nothing.
+ */
+#define DISPATCH_API(R, V, ns) \
+	R(ns, int, decode, (CN(point) *P, const void *src), (P, src)) \
+	R(ns, int, decode_batch, (CN(point) *P, uint8_t *ok, \
+		const void *src, size_t num), (P, ok, src, num)) \
+	R(ns, int, decode_vartime, (CN(point) *P, const void *src), (P, src)) \
+	V(ns, encode, (void *dst, const CN(point) *P), (dst, P)) \
+	V(ns, encode_squared_w, (void *dst, const CN(point) *P), (dst, P)) \
+	V(ns, encode_batch, (void *dst, const CN(point) *P, size_t num), \
+		(dst, P, num)) \
+	V(ns, encode_squared_w_batch, (void *dst, \
+		const CN(point) *P, size_t num), (dst, P, num)) \
+	R(ns, int, is_neutral, (const CN(point) *P), (P)) \
+	R(ns, int, eq, (const CN(point) *P1, const CN(point) *P2), (P1, P2)) \
+	V(ns, add, (CN(point) *P3, \
+		const CN(point) *P1, const CN(point) *P2), (P3, P1, P2)) \
+	V(ns, double, (CN(point) *P3, const CN(point) *P1), (P3, P1)) \
+	V(ns, double_x, (CN(point) *P3, const CN(point) *P1, unsigned n), \
+		(P3, P1, n)) \
+	V(ns, neg, (CN(point) *P3, const CN(point) *P1), (P3, P1)) \
+	V(ns, mul, (CN(point) *P3, \
+		const CN(point) *P1, const void *scalar), (P3, P1, scalar)) \
+	V(ns, mulgen, (CN(point) *P3, const void *scalar), (P3, scalar)) \
+	V(ns, precomp_init, (CN(precomp) *table, const CN(point) *P), \
+		(table, P)) \
+	V(ns, mul_precomp, (CN(point) *P3, const CN(precomp) *table, \
+		const void *scalar), (P3, table, scalar)) \
+	V(ns, mul_x4, (CN(point) *P3, \
+		const CN(point) *P1, const void *scalars), (P3, P1, scalars)) \
+	V(ns, mulgen_x4, (CN(point) *P3, const void *scalars), \
+		(P3, scalars)) \
+	R(ns, int, verify_helper_vartime, (const void *k0, \
+		const CN(point) *P, const void *k1, const void *R_enc), \
+		(k0, P, k1, R_enc)) \
+	V(ns, verify_table_init, (CN(verify_table) *tab, const CN(point) *P), \
+		(tab, P)) \
+	R(ns, int, verify_helper_table_vartime, (const void *k0, \
+		const CN(verify_table) *tab, const void *k1, const void *R_enc), \
+		(k0, tab, k1, R_enc)) \
+	R(ns, int, verify_batch_helper_vartime, (const void *k0, \
+		const CN(point) *P, const void *k1, const void *R_enc, \
+		const void *k2, size_t num), (k0, P, k1, R_enc, k2, num)) \
+	R(ns, size_t, msm_scratch_size, (size_t num), (num)) \
+	V(ns, msm_vartime, (CN(point) *Q, const CN(point) *P, \
+		const void *scalars, size_t num, void *scratch), \
+		(Q, P, scalars, num, scratch)) \
+	V(ns, mul_multi, (CN(point) *Q, const CN(point) *P, \
+		const void *scalars, size_t num), (Q, P, scalars, num)) \
+	V(ns, map_to_curve, (CN(point) *P, const void *src, size_t len), \
+		(P, src, len)) \
+	R(ns, int, scalar_is_reduced, (const void *a), (a)) \
+	V(ns, scalar_reduce, (void *d, const void *a, size_t a_len), \
+		(d, a, a_len)) \
+	V(ns, scalar_add, (void *d, const void *a, const void *b), (d, a, b)) \
+	V(ns, scalar_sub, (void *d, const void *a, const void *b), (d, a, b)) \
+	V(ns, scalar_neg, (void *d, const void *a), (d, a)) \
+	V(ns, scalar_half, (void *d, const void *a), (d, a)) \
+	V(ns, scalar_mul, (void *d, const void *a, const void *b), (d, a, b))
+
+/* Name of a backend function: CURVE_ns_name */
+#define DN(ns, x)            DNN(CURVE, ns, x)
+#define DNN(cname, ns, x)    DNN_(cname, ns, x)
+#define DNN_(cname, ns, x)   cname ## _ ## ns ## _ ## x
+
+/*
+ * Declarations of the backend functions.
+ */
+#define DISPATCH_DECL_R(ns, rt, name, params, args) \
+	rt DN(ns, name) params;
+#define DISPATCH_DECL_V(ns, name, params, args) \
+	void DN(ns, name) params;
+DISPATCH_API(DISPATCH_DECL_R, DISPATCH_DECL_V, w64)
+DISPATCH_API(DISPATCH_DECL_R, DISPATCH_DECL_V, bmi2)
+DISPATCH_API(DISPATCH_DECL_R, DISPATCH_DECL_V, avx2)
+
+/*
+ * A backend is a table of function pointers. Entries are in the order
+ * of the DO255_BACKEND_* identifiers.
+ */
+#define DISPATCH_FIELD_R(ns, rt, name, params, args) \
+	rt (*f_ ## name) params;
+#define DISPATCH_FIELD_V(ns, name, params, args) \
+	void (*f_ ## name) params;
+typedef struct {
+	DISPATCH_API(DISPATCH_FIELD_R, DISPATCH_FIELD_V, -)
+} CN(backend);
+
+#define DISPATCH_ENTRY_R(ns, rt, name, params, args)   &DN(ns, name),
+#define DISPATCH_ENTRY_V(ns, name, params, args)       &DN(ns, name),
+static const CN(backend) CN(backends)[] = {
+	{ DISPATCH_API(DISPATCH_ENTRY_R, DISPATCH_ENTRY_V, w64) },
+	{ DISPATCH_API(DISPATCH_ENTRY_R, DISPATCH_ENTRY_V, bmi2) },
+	{ DISPATCH_API(DISPATCH_ENTRY_R, DISPATCH_ENTRY_V, avx2) }
+};
+
+/*
+ * Public functions: each one calls the same function in the current
+ * backend.
+ */
+#define DISPATCH_WRAP_R(ns, rt, name, params, args) \
+	rt CN(name) params \
+	{ \
+		return CN(backends)[do255_backend_id()].f_ ## name args; \
+	}
+#define DISPATCH_WRAP_V(ns, name, params, args) \
+	void CN(name) params \
+	{ \
+		CN(backends)[do255_backend_id()].f_ ## name args; \
+	}
+DISPATCH_API(DISPATCH_WRAP_R, DISPATCH_WRAP_V, -)
+
+/* see do255.h */
+const CN(point) CN(neutral) = {
+	{ { 0, 0, 0, 0 } },
+	{ { 1, 0, 0, 0 } },
+	{ { 0, 0, 0, 0 } }
+};
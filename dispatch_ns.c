@@ -0,0 +1,90 @@
+/*
+ * This file is meant to be included, not compiled by itself. It is
+ * included by support.c, before do255.h, when the DO255_NS macro is
+ * defined (e.g. -DDO255_NS=bmi2); this is how each backend of libdo255
+ * is compiled. All public names are then renamed by inserting the
+ * backend name after the curve name (e.g. do255e_mul() becomes
+ * do255e_bmi2_mul()), so that several backends can be linked together.
+ * The public names are provided by the dispatcher (do255_dispatch.c).
+ *
+ * When a new public function is added to do255.h, it must be added
+ * here, and in the function list in dispatch.c.
+ */
+
+#define DO255_NSN(cname, x)          DO255_NSN_(cname, DO255_NS, x)
+#define DO255_NSN_(cname, ns, x)     DO255_NSN__(cname, ns, x)
+#define DO255_NSN__(cname, ns, x)    cname ## _ ## ns ## _ ## x
+
+#define do255s_neutral                  DO255_NSN(do255s, neutral)
+#define do255s_generator                DO255_NSN(do255s, generator)
+#define do255s_decode                   DO255_NSN(do255s, decode)
+#define do255s_decode_batch             DO255_NSN(do255s, decode_batch)
+#define do255s_decode_vartime           DO255_NSN(do255s, decode_vartime)
+#define do255s_encode                   DO255_NSN(do255s, encode)
+#define do255s_encode_squared_w         DO255_NSN(do255s, encode_squared_w)
+#define do255s_encode_batch             DO255_NSN(do255s, encode_batch)
+#define do255s_encode_squared_w_batch   DO255_NSN(do255s, encode_squared_w_batch)
+#define do255s_is_neutral               DO255_NSN(do255s, is_neutral)
+#define do255s_eq                       DO255_NSN(do255s, eq)
+#define do255s_add                      DO255_NSN(do255s, add)
+#define do255s_double                   DO255_NSN(do255s, double)
+#define do255s_double_x                 DO255_NSN(do255s, double_x)
+#define do255s_neg                      DO255_NSN(do255s, neg)
+#define do255s_mul                      DO255_NSN(do255s, mul)
+#define do255s_mulgen                   DO255_NSN(do255s, mulgen)
+#define do255s_precomp_init             DO255_NSN(do255s, precomp_init)
+#define do255s_mul_precomp              DO255_NSN(do255s, mul_precomp)
+#define do255s_mul_x4                   DO255_NSN(do255s, mul_x4)
+#define do255s_mulgen_x4                DO255_NSN(do255s, mulgen_x4)
+#define do255s_verify_helper_vartime    DO255_NSN(do255s, verify_helper_vartime)
+#define do255s_verify_table_init        DO255_NSN(do255s, verify_table_init)
+#define do255s_verify_helper_table_vartime DO255_NSN(do255s, verify_helper_table_vartime)
+#define do255s_verify_batch_helper_vartime DO255_NSN(do255s, verify_batch_helper_vartime)
+#define do255s_msm_scratch_size         DO255_NSN(do255s, msm_scratch_size)
+#define do255s_msm_vartime              DO255_NSN(do255s, msm_vartime)
+#define do255s_mul_multi                DO255_NSN(do255s, mul_multi)
+#define do255s_map_to_curve             DO255_NSN(do255s, map_to_curve)
+#define do255s_scalar_is_reduced        DO255_NSN(do255s, scalar_is_reduced)
+#define do255s_scalar_reduce            DO255_NSN(do255s, scalar_reduce)
+#define do255s_scalar_add               DO255_NSN(do255s, scalar_add)
+#define do255s_scalar_sub               DO255_NSN(do255s, scalar_sub)
+#define do255s_scalar_neg               DO255_NSN(do255s, scalar_neg)
+#define do255s_scalar_half              DO255_NSN(do255s, scalar_half)
+#define do255s_scalar_mul               DO255_NSN(do255s, scalar_mul)
+
+#define do255e_neutral                  DO255_NSN(do255e, neutral)
+#define do255e_generator                DO255_NSN(do255e, generator)
+#define do255e_decode                   DO255_NSN(do255e, decode)
+#define do255e_decode_batch             DO255_NSN(do255e, decode_batch)
+#define do255e_decode_vartime           DO255_NSN(do255e, decode_vartime)
+#define do255e_encode                   DO255_NSN(do255e, encode)
+#define do255e_encode_squared_w         DO255_NSN(do255e, encode_squared_w)
+#define do255e_encode_batch             DO255_NSN(do255e, encode_batch)
+#define do255e_encode_squared_w_batch   DO255_NSN(do255e, encode_squared_w_batch)
+#define do255e_is_neutral               DO255_NSN(do255e, is_neutral)
+#define do255e_eq                       DO255_NSN(do255e, eq)
+#define do255e_add                      DO255_NSN(do255e, add)
+#define do255e_double                   DO255_NSN(do255e, double)
+#define do255e_double_x                 DO255_NSN(do255e, double_x)
+#define do255e_neg                      DO255_NSN(do255e, neg)
+#define do255e_mul                      DO255_NSN(do255e, mul)
+#define do255e_mulgen                   DO255_NSN(do255e, mulgen)
+#define do255e_precomp_init             DO255_NSN(do255e, precomp_init)
+#define do255e_mul_precomp              DO255_NSN(do255e, mul_precomp)
+#define do255e_mul_x4                   DO255_NSN(do255e, mul_x4)
+#define do255e_mulgen_x4                DO255_NSN(do255e, mulgen_x4)
+#define do255e_verify_helper_vartime    DO255_NSN(do255e, verify_helper_vartime)
+#define do255e_verify_table_init        DO255_NSN(do255e, verify_table_init)
+#define do255e_verify_helper_table_vartime DO255_NSN(do255e, verify_helper_table_vartime)
+#define do255e_verify_batch_helper_vartime DO255_NSN(do255e, verify_batch_helper_vartime)
+#define do255e_msm_scratch_size         DO255_NSN(do255e, msm_scratch_size)
+#define do255e_msm_vartime              DO255_NSN(do255e, msm_vartime)
+#define do255e_mul_multi                DO255_NSN(do255e, mul_multi)
+#define do255e_map_to_curve             DO255_NSN(do255e, map_to_curve)
+#define do255e_scalar_is_reduced        DO255_NSN(do255e, scalar_is_reduced)
+#define do255e_scalar_reduce            DO255_NSN(do255e, scalar_reduce)
+#define do255e_scalar_add               DO255_NSN(do255e, scalar_add)
+#define do255e_scalar_sub               DO255_NSN(do255e, scalar_sub)
+#define do255e_scalar_neg               DO255_NSN(do255e, scalar_neg)
+#define do255e_scalar_half              DO255_NSN(do255e, scalar_half)
+#define do255e_scalar_mul               DO255_NSN(do255e, scalar_mul)
@@ -61,8 +61,8 @@ typedef union {
  *    can be equal to each other.
  *  - All functions are constant-time: execution time and memory access
  *    pattern are independent of the input or output values (exception:
- *    the *_verify_helper_vartime() functions are not constant-time, as
- *    they are meant to be used on public values only).
+ *    the functions whose name ends with "_vartime" are not constant-time,
+ *    as they are meant to be used on public values only).
  *  - Overlaps are allowed between inputs and outputs; e.g. the point
  *    addition functions can use the same structure as destination and
  *    as one or both sources (however, _partial_ overlaps, in which
@@ -116,6 +116,37 @@ extern const do255e_point do255e_generator;
 int do255s_decode(do255s_point *P, const void *src);
 int do255e_decode(do255e_point *P, const void *src);
 
+/*
+ * Variable-time decoding: same as do255*_decode() (same results, and
+ * P may be NULL), but the computation is not constant-time: it uses a
+ * faster variable-time Legendre symbol. This function MUST NOT be used
+ * on secret encodings; it is meant for public data such as public keys
+ * in signature verification. Only the w64, bmi2 and avx2
+ * implementations have a faster variable-time code path; the others
+ * use the constant-time decoding.
+ */
+int do255s_decode_vartime(do255s_point *P, const void *src);
+int do255e_decode_vartime(do255e_point *P, const void *src);
+
+/*
+ * Batch decoding: decode num points from src (32*num bytes; the
+ * encoding of P[i] is at offset 32*i). Each point is decoded exactly as
+ * with do255*_decode(), including the clamping of invalid entries to
+ * the neutral. If ok is not NULL, then ok[i] is set to 1 if the
+ * decoding of P[i] succeeded, 0 otherwise. Returned value is 1 if all
+ * points were decoded successfully, 0 otherwise (returned value is 1
+ * for num == 0). This function is constant-time (for a given num).
+ *
+ * Decoding does not use any inversion, hence there is nothing to share
+ * between points; the AVX2 implementation (and libdo255 on CPUs with
+ * AVX2) still decodes points about 20% faster than individual calls,
+ * by computing the square roots of four points in parallel.
+ */
+int do255s_decode_batch(do255s_point *P, uint8_t *ok,
+	const void *src, size_t num);
+int do255e_decode_batch(do255e_point *P, uint8_t *ok,
+	const void *src, size_t num);
+
 /*
  * Encode a point into 32 bytes. This function can only produce a
  * canonical encoding.
@@ -131,6 +162,22 @@ void do255e_encode(void *dst, const do255e_point *P);
 void do255s_encode_squared_w(void *dst, const do255s_point *P);
 void do255e_encode_squared_w(void *dst, const do255e_point *P);
 
+/*
+ * Batch encoding: encode num points P[0..num-1] into dst (32*num bytes;
+ * the encoding of P[i] is at offset 32*i). The output is identical to
+ * that of do255*_encode() (or do255*_encode_squared_w()) on each point,
+ * but the costly field inversion is shared between all points (one
+ * inversion for every 32 points, or every 16 points on 32-bit
+ * platforms). Points may be the neutral. These functions are
+ * constant-time (for a given num).
+ */
+void do255s_encode_batch(void *dst, const do255s_point *P, size_t num);
+void do255e_encode_batch(void *dst, const do255e_point *P, size_t num);
+void do255s_encode_squared_w_batch(void *dst,
+	const do255s_point *P, size_t num);
+void do255e_encode_squared_w_batch(void *dst,
+	const do255e_point *P, size_t num);
+
 /*
  * Compare a point with the neutral element. Returned value is 1 if the
  * point is the neutral, 0 otherwise.
@@ -206,6 +253,59 @@ void do255e_mul(do255e_point *P3, const do255e_point *P1, const void *scalar);
 void do255s_mulgen(do255s_point *P3, const void *scalar);
 void do255e_mulgen(do255e_point *P3, const void *scalar);
 
+/*
+ * Precomputed table for fast multiplications of a fixed point. The
+ * contents are opaque and specific to the implementation (word size);
+ * a table is 4096 bytes and contains only public data derived from the
+ * point. It can be copied with memcpy() and shared between threads.
+ */
+typedef struct {
+	do255_int256 t[128];
+} do255s_precomp;
+typedef struct {
+	do255_int256 t[128];
+} do255e_precomp;
+
+/*
+ * Fill a precomputed table for point P. The table uses the same
+ * structure as the static tables of do255*_mulgen(), so that
+ * do255*_mul_precomp() has about the cost of do255*_mulgen().
+ * Building the table costs about as much as one to two calls to
+ * do255*_mul(); a table is worth using for a point that is
+ * multiplied more than a few times.
+ */
+void do255s_precomp_init(do255s_precomp *table, const do255s_point *P);
+void do255e_precomp_init(do255e_precomp *table, const do255e_point *P);
+
+/*
+ * Multiply the point for which the table was built by a scalar
+ * (P3 <- scalar*P). The scalar is encoded as for do255*_mul(). This
+ * function is constant-time.
+ */
+void do255s_mul_precomp(do255s_point *P3,
+	const do255s_precomp *table, const void *scalar);
+void do255e_mul_precomp(do255e_point *P3,
+	const do255e_precomp *table, const void *scalar);
+
+/*
+ * Four independent point multiplications: for i = 0 to 3, set P3[i]
+ * to k[i]*P1[i] (*_mul_x4()) or to k[i]*G (*_mulgen_x4()). The four
+ * scalars are encoded as for do255*_mul() and are consecutive in the
+ * scalars array (128 bytes in total). P3 and P1 may be the same array.
+ *
+ * These functions are constant-time. In the AVX2 implementations
+ * (do255e_avx2.c and do255s_avx2.c), the four operations are computed
+ * in parallel, one per SIMD lane; this is faster than four calls to
+ * do255*_mul() or do255*_mulgen(). Other implementations simply make
+ * four sequential calls.
+ */
+void do255s_mul_x4(do255s_point *P3,
+	const do255s_point *P1, const void *scalars);
+void do255e_mul_x4(do255e_point *P3,
+	const do255e_point *P1, const void *scalars);
+void do255s_mulgen_x4(do255s_point *P3, const void *scalars);
+void do255e_mulgen_x4(do255e_point *P3, const void *scalars);
+
 /*
  * Signature verification helper: given scalars k0 and k1 and points P
  * and R, verify that k0*G + k1*P = R (with G being the conventional
@@ -225,6 +325,125 @@ int do255e_verify_helper_vartime(const void *k0,
 int do255s_verify_helper_vartime(const void *k0,
 	const do255s_point *P, const void *k1, const void *R_enc);
 
+/*
+ * Precomputed table for repeated calls to the verification helper with
+ * the same point P (e.g. a signer's public key). The table contains
+ * the point and, on 64-bit implementations, its precomputed windows
+ * (normalized to affine coordinates), so that each verification skips
+ * their computation. Contents are opaque and specific to the
+ * implementation (word size).
+ */
+typedef struct {
+	do255_int256 t[67];
+} do255e_verify_table;
+typedef struct {
+	do255_int256 t[19];
+} do255s_verify_table;
+
+/*
+ * Initialize a verification table for point P (which may be the
+ * neutral). This function is not constant-time.
+ */
+void do255e_verify_table_init(do255e_verify_table *tab,
+	const do255e_point *P);
+void do255s_verify_table_init(do255s_verify_table *tab,
+	const do255s_point *P);
+
+/*
+ * Same as do255*_verify_helper_vartime(), with the point P provided
+ * as a precomputed table.
+ */
+int do255e_verify_helper_table_vartime(const void *k0,
+	const do255e_verify_table *tab, const void *k1, const void *R_enc);
+int do255s_verify_helper_table_vartime(const void *k0,
+	const do255s_verify_table *tab, const void *k1, const void *R_enc);
+
+/*
+ * Maximum number of elements for a batch verification helper call.
+ */
+#define DO255_VERIFY_BATCH_MAX   16
+
+/*
+ * Batch signature verification helper: given scalar k0, and, for
+ * i = 0 to num-1, points P[i] and R[i] and scalars k1[i] and k2[i],
+ * verify that:
+ *    k0*G + \sum_i k1[i]*P[i] = \sum_i k2[i]*R[i]
+ * (with G being the conventional generator element). Scalars k0 and
+ * k1[i] are encoded over 256 bits (32 bytes, unsigned little-endian
+ * convention) and may be up to 2^256-1. Scalars k2[i] are encoded
+ * over 128 bits (16 bytes, unsigned little-endian convention). Points
+ * R[i] are provided encoded (32 bytes each). The k1, k2 and R_enc
+ * arrays contain the num values consecutively.
+ *
+ * The number of elements (num) MUST NOT exceed DO255_VERIFY_BATCH_MAX.
+ *
+ * Return value is 1 if the equation is fulfilled, 0 otherwise. If any
+ * of the R_enc[i] values is not a valid point encoding, then 0 is
+ * returned.
+ *
+ * This function is meant to support batch verification of signatures:
+ * each individual equation (s_i*G - e_i*P_i = R_i) is multiplied by a
+ * random 128-bit coefficient z_i, and all equations are added together,
+ * so that all the point doublings are shared. With num = 1 and k2[0] = 1,
+ * this is the same check as the *_verify_helper_vartime() functions,
+ * but slower (since R is fully decoded).
+ *
+ * Like *_verify_helper_vartime(), this function is not constant-time.
+ */
+int do255e_verify_batch_helper_vartime(const void *k0,
+	const do255e_point *P, const void *k1,
+	const void *R_enc, const void *k2, size_t num);
+int do255s_verify_batch_helper_vartime(const void *k0,
+	const do255s_point *P, const void *k1,
+	const void *R_enc, const void *k2, size_t num);
+
+/*
+ * Multi-scalar multiplication: given points P[i] and scalars k[i], for
+ * i = 0 to num-1, compute Q = \sum_i k[i]*P[i]. Scalars are encoded over
+ * 256 bits each (32 bytes, unsigned little-endian convention) and may
+ * be up to 2^256-1; the scalars array contains the num values
+ * consecutively. Any number of points is supported (including zero, in
+ * which case Q is set to the neutral).
+ *
+ * This function uses the Pippenger (bucket) method, with a window size
+ * that depends on num; it is efficient for large numbers of points.
+ * It needs a scratch buffer, provided by the caller, whose size (in
+ * bytes) is returned by *_msm_scratch_size() for the same value of num.
+ * The scratch buffer has no alignment requirement, and may be reused
+ * for subsequent calls.
+ *
+ * This function is not constant-time: it assumes that points and
+ * scalars are public.
+ */
+size_t do255e_msm_scratch_size(size_t num);
+void do255e_msm_vartime(do255e_point *Q, const do255e_point *P,
+	const void *scalars, size_t num, void *scratch);
+size_t do255s_msm_scratch_size(size_t num);
+void do255s_msm_vartime(do255s_point *Q, const do255s_point *P,
+	const void *scalars, size_t num, void *scratch);
+
+/*
+ * Constant-time multi-scalar multiplication: given points P[i] and
+ * scalars k[i], for i = 0 to num-1, compute Q = \sum_i k[i]*P[i]. The
+ * encoding of the scalars is the same as for *_msm_vartime(). Any number
+ * of points is supported (including zero, in which case Q is set to the
+ * neutral); any of the points may be the neutral.
+ *
+ * Points are processed by small groups (up to 8 points on 64-bit
+ * systems, 4 on 32-bit systems); within a group, the windows are
+ * normalized with a single inversion, and the point doublings are
+ * shared. For two points, this is substantially faster than two calls
+ * to *_mul() followed by an addition.
+ *
+ * This function is constant-time: the execution time and memory access
+ * pattern depend only on num, not on the values of the points and
+ * scalars.
+ */
+void do255e_mul_multi(do255e_point *Q, const do255e_point *P,
+	const void *scalars, size_t num);
+void do255s_mul_multi(do255s_point *Q, const do255s_point *P,
+	const void *scalars, size_t num);
+
 /*
  * Map a source value (arbitrary sequence of 'len' bytes) onto a point.
  * The mapping is not one-way and not uniform, but can be used to
@@ -309,6 +528,70 @@ void do255s_scalar_half(void *d, const void *a);
 void do255e_scalar_mul(void *d, const void *a, const void *b);
 void do255s_scalar_mul(void *d, const void *a, const void *b);
 
+/* ==================================================================== */
+/*
+ * Backend selection. These functions exist only in libdo255, which
+ * includes several implementations (w64, bmi2, avx2) and chooses one
+ * at runtime; the other builds contain a single implementation.
+ *
+ * By default, the fastest backend supported by the CPU is used, unless
+ * the environment variable DO255_BACKEND names another supported
+ * backend. All functions above use the currently selected backend;
+ * the backend should not be changed while other threads are calling
+ * them, or between calls whose values are used together (e.g.
+ * do255*_msm_scratch_size() and do255*_msm_vartime()).
+ */
+
+/*
+ * Get the name of the currently selected backend ("w64", "bmi2" or
+ * "avx2").
+ */
+const char *do255_backend_name(void);
+
+/*
+ * Select a backend by name. If name is NULL, then the automatic
+ * selection is used (the DO255_BACKEND environment variable is then
+ * ignored). Returned value is 1 on success, 0 if the name is unknown or
+ * the backend is not supported by the current CPU (the selection is
+ * then unchanged).
+ */
+int do255_set_backend(const char *name);
+
+/* ==================================================================== */
+/*
+ * Operation counters. When the library is compiled with the
+ * DO255_STATS macro set to a non-zero value (see support.c), the w64,
+ * bmi2, avx2 and w32 implementations count the main internal operations
+ * in per-thread counters; otherwise, the counters stay at zero. The
+ * four-way AVX2 operations count for four operations each. gf_mul and
+ * gf_sqr include the multiplications and squarings performed within
+ * inversions, square roots and Legendre symbols. keccak counts calls to
+ * the Keccak-f[1600] permutation (both the 24-round and 12-round
+ * variants).
+ */
+typedef struct {
+	uint64_t gf_mul;
+	uint64_t gf_sqr;
+	uint64_t gf_inv;
+	uint64_t gf_sqrt;
+	uint64_t gf_legendre;
+	uint64_t point_add;
+	uint64_t point_add_mixed;
+	uint64_t point_double;
+	uint64_t window_lookup;
+	uint64_t keccak;
+} do255_stats;
+
+/*
+ * Get a copy of the counters of the calling thread.
+ */
+void do255_stats_get(do255_stats *st);
+
+/*
+ * Reset the counters of the calling thread to zero.
+ */
+void do255_stats_reset(void);
+
 /* ==================================================================== */
 
 #endif
@@ -135,6 +135,8 @@ void do255s_make_public(do255s_public_key *pk, const do255s_private_key *sk);
  * inherently verify public key validity; it is thus not necessary to
  * call this function prior to using an incoming public key in other
  * functions such as do255e_key_exchange() or do255e_verify_vartime().
+ * The public key is considered public data: this function is not
+ * constant-time.
  */
 int do255e_check_public(const do255e_public_key *pk);
 int do255s_check_public(const do255s_public_key *pk);
@@ -187,7 +189,8 @@ int do255s_key_exchange(void *secret, size_t secret_len,
  * used hash value is provided as a character string (hash_oid); it
  * should be the decimal-dotted representation of the object identifier
  * (OID) allocated to the hash function. Some standard OID strings are
- * defined below for the SHA-2 and SHA-3 functions. The hash value itself
+ * defined below for the SHA-2 and SHA-3 functions, and an identifier
+ * for KangarooTwelve (KT128). The hash value itself
  * is given as hv[], of size hv_len (in bytes). The used hash function
  * must provide collision resistance with sufficient security.
  *
@@ -241,6 +244,218 @@ int do255s_verify_vartime(
 	const do255s_signature *sig, const do255s_public_key *pk,
 	const char *hash_oid, const void *hv, size_t hv_len);
 
+/*
+ * Expanded public key, for verifying many signatures from the same
+ * signer: it contains the public key and a precomputed verification
+ * table for the decoded point, so that verification skips the point
+ * decoding (a square root computation) and, on 64-bit implementations,
+ * the construction of the point windows.
+ */
+typedef struct {
+	do255e_public_key pk;
+	do255e_verify_table tab;
+	int valid;
+} do255e_expanded_public_key;
+typedef struct {
+	do255s_public_key pk;
+	do255s_verify_table tab;
+	int valid;
+} do255s_expanded_public_key;
+
+/*
+ * Expand a public key. Returned value is 1 if the public key is valid
+ * (see do255e_check_public()), 0 otherwise; an expanded key obtained
+ * from an invalid public key rejects all signatures.
+ */
+int do255e_expand_public_key(do255e_expanded_public_key *epk,
+	const do255e_public_key *pk);
+int do255s_expand_public_key(do255s_expanded_public_key *epk,
+	const do255s_public_key *pk);
+
+/*
+ * Same as do255*_verify_vartime(), with an expanded public key.
+ */
+int do255e_verify_vartime_expanded(
+	const do255e_signature *sig, const do255e_expanded_public_key *epk,
+	const char *hash_oid, const void *hv, size_t hv_len);
+int do255s_verify_vartime_expanded(
+	const do255s_signature *sig, const do255s_expanded_public_key *epk,
+	const char *hash_oid, const void *hv, size_t hv_len);
+
+/*
+ * Verify several signatures at once (batch verification). There are
+ * num signatures to verify; the i-th signature is at address
+ * ((const unsigned char *)sig + i * sig_stride), and is verified against
+ * the public key at address ((const unsigned char *)pk + i * pk_stride)
+ * and the hash value at address ((const unsigned char *)hv + i * hv_stride)
+ * (all hash values have length hv_len bytes, and use the same hash
+ * function identifier hash_oid). For plain arrays, use the size of the
+ * element type as stride; a stride of zero means that the same value is
+ * used for all signatures (e.g. many signatures from the same signer).
+ *
+ * Returned value is 1 if ALL signatures are valid, 0 otherwise. If
+ * results is not NULL, then results[i] is set to 1 if the i-th signature
+ * is valid, 0 otherwise.
+ *
+ * Signatures are verified by groups of up to 16, with a random linear
+ * combination of the verification equations, which shares the point
+ * doublings among all signatures of a group. When a group fails, it is
+ * split in two halves which are verified separately, so that invalid
+ * signatures are located precisely; batch verification is thus most
+ * efficient when all signatures, or nearly all, are valid.
+ *
+ * The random coefficients are derived by hashing the signatures, public
+ * keys and data, along with 32 bytes extracted from rng if rng is not
+ * NULL. An attacker who can predict these coefficients may craft a set
+ * of invalid signatures that would be accepted as a whole; with rng set
+ * to NULL, this requires the attacker to break SHAKE256, but providing
+ * a source of randomness is still recommended.
+ *
+ * This function is not constant-time: it assumes that the public keys,
+ * signatures and signed data are public.
+ */
+int do255e_verify_batch_vartime(unsigned char *results,
+	const do255e_signature *sig, size_t sig_stride,
+	const do255e_public_key *pk, size_t pk_stride,
+	const char *hash_oid, const void *hv, size_t hv_len, size_t hv_stride,
+	size_t num, shake_context *rng);
+int do255s_verify_batch_vartime(unsigned char *results,
+	const do255s_signature *sig, size_t sig_stride,
+	const do255s_public_key *pk, size_t pk_stride,
+	const char *hash_oid, const void *hv, size_t hv_len, size_t hv_stride,
+	size_t num, shake_context *rng);
+
+/*
+ * Streaming signature generation and verification, for raw messages
+ * that are too large to be processed in one call, or that are read
+ * from a stream.
+ *
+ * The message is hashed once, when it is provided (with the *_update()
+ * functions), with KangarooTwelve (KT128, empty customization string,
+ * 32-byte output). The *_final() functions then sign or verify that
+ * hash value with the DO255_OID_KT128 identifier; thus, a signature
+ * computed with do255e_sign_ctx_final() can also be verified with
+ * do255e_verify_vartime() (using DO255_OID_KT128 and the KT128 hash of
+ * the message), and vice versa. Signatures are not the same as with a
+ * raw-message signature (hash_oid set to NULL), which needs to process
+ * the message twice.
+ *
+ * Contexts contain no pointer and need not be released. The seed
+ * parameter of the signature has the same role as in do255e_sign().
+ * After *_final(), the context must be initialized again before
+ * further use.
+ */
+typedef struct {
+	kt128_context kc;
+} do255e_sign_context;
+typedef struct {
+	kt128_context kc;
+} do255s_sign_context;
+typedef struct {
+	kt128_context kc;
+} do255e_verify_context;
+typedef struct {
+	kt128_context kc;
+} do255s_verify_context;
+
+void do255e_sign_ctx_init(do255e_sign_context *sc);
+void do255s_sign_ctx_init(do255s_sign_context *sc);
+void do255e_sign_ctx_update(do255e_sign_context *sc,
+	const void *data, size_t len);
+void do255s_sign_ctx_update(do255s_sign_context *sc,
+	const void *data, size_t len);
+void do255e_sign_ctx_final(do255e_signature *sig, do255e_sign_context *sc,
+	const do255e_private_key *sk, const do255e_public_key *pk,
+	const void *seed, size_t seed_len);
+void do255s_sign_ctx_final(do255s_signature *sig, do255s_sign_context *sc,
+	const do255s_private_key *sk, const do255s_public_key *pk,
+	const void *seed, size_t seed_len);
+
+/*
+ * Verification returns 1 if the signature is valid, 0 otherwise. As
+ * with do255e_verify_vartime(), it is not constant-time.
+ */
+void do255e_verify_ctx_init(do255e_verify_context *vc);
+void do255s_verify_ctx_init(do255s_verify_context *vc);
+void do255e_verify_ctx_update(do255e_verify_context *vc,
+	const void *data, size_t len);
+void do255s_verify_ctx_update(do255s_verify_context *vc,
+	const void *data, size_t len);
+int do255e_verify_ctx_final_vartime(do255e_verify_context *vc,
+	const do255e_signature *sig, const do255e_public_key *pk);
+int do255s_verify_ctx_final_vartime(do255s_verify_context *vc,
+	const do255s_signature *sig, const do255s_public_key *pk);
+
+/*
+ * Signatures with precomputed nonces, for applications that need a low
+ * signing latency. Most of the cost of signature generation is the
+ * computation of the "commitment" R = k*G (and its encoding), for the
+ * per-signature secret scalar k. That computation does not depend on
+ * the signed data, hence it can be performed in advance, e.g. when the
+ * application is idle or on another thread; do255e_sign_with_pool()
+ * then only hashes the data and computes one scalar multiply-add.
+ *
+ * A pool uses caller-provided storage for its entries (capacity
+ * entries of 64 bytes each). Its k values are derived from a SHAKE256
+ * instance seeded with the seed[] provided to do255e_nonce_pool_init();
+ * contrary to the seed of do255e_sign(), that seed MUST be random and
+ * secret, of at least 32 bytes, since security relies entirely on the
+ * k values being unpredictable and never reused. do255e_nonce_pool_refill()
+ * adds up to max entries (or until the pool is full; max = 0 means no
+ * limit), and returns the number of added entries; points are computed
+ * by batches, and their encodings share a single field inversion per
+ * batch. Each entry is wiped from the pool when it is used by
+ * do255e_sign_with_pool(), which returns 1 on success, or 0 if the pool
+ * is empty (in which case no signature is produced; the caller may
+ * use do255e_sign() instead). Signatures are regular do255e
+ * signatures: they are verified with do255e_verify_vartime().
+ *
+ * A pool contains secret values and MUST NOT be copied, or shared
+ * between processes (e.g. after a fork()): two copies of a pool would
+ * produce signatures with the same k, which reveals the private key.
+ * A pool is not protected against concurrent use; to refill nonces on
+ * a background thread, use two pools, one being refilled by the
+ * background thread while the other is used for signing, and swap them
+ * (under the application's lock) when the latter is empty. The same
+ * pool can be used with several private keys. do255e_nonce_pool_clear()
+ * wipes all entries and the internal state of a pool.
+ */
+typedef struct {
+	unsigned char k[32];
+	unsigned char R_enc[32];
+} do255e_nonce;
+typedef struct {
+	unsigned char k[32];
+	unsigned char R_enc[32];
+} do255s_nonce;
+typedef struct {
+	do255e_nonce *entries;
+	size_t capacity, count;
+	shake_context rng;
+} do255e_nonce_pool;
+typedef struct {
+	do255s_nonce *entries;
+	size_t capacity, count;
+	shake_context rng;
+} do255s_nonce_pool;
+
+void do255e_nonce_pool_init(do255e_nonce_pool *pool,
+	do255e_nonce *entries, size_t capacity,
+	const void *seed, size_t seed_len);
+void do255s_nonce_pool_init(do255s_nonce_pool *pool,
+	do255s_nonce *entries, size_t capacity,
+	const void *seed, size_t seed_len);
+size_t do255e_nonce_pool_refill(do255e_nonce_pool *pool, size_t max);
+size_t do255s_nonce_pool_refill(do255s_nonce_pool *pool, size_t max);
+void do255e_nonce_pool_clear(do255e_nonce_pool *pool);
+void do255s_nonce_pool_clear(do255s_nonce_pool *pool);
+int do255e_sign_with_pool(do255e_signature *sig, do255e_nonce_pool *pool,
+	const do255e_private_key *sk, const do255e_public_key *pk,
+	const char *hash_oid, const void *hv, size_t hv_len);
+int do255s_sign_with_pool(do255s_signature *sig, do255s_nonce_pool *pool,
+	const do255s_private_key *sk, const do255s_public_key *pk,
+	const char *hash_oid, const void *hv, size_t hv_len);
+
 /* Hash function identifier: SHA-224 */
 #define DO255_OID_SHA224        "2.16.840.1.101.3.4.2.4"
 
@@ -271,4 +486,15 @@ int do255s_verify_vartime(
 /* Hash function identifier: SHA3-512 */
 #define DO255_OID_SHA3_512      "2.16.840.1.101.3.4.2.10"
 
+/*
+ * Hash function identifier: KangarooTwelve (KT128, RFC 9861), with an
+ * empty customization string and a 32-byte output (see kt128_init()
+ * and related functions in sha3.h). KT128 hashes large inputs much
+ * faster than SHA3 or SHAKE, and is meant for prehashing large
+ * messages. There is no OID for KT128 in the NIST hash function arc;
+ * this identifier is a plain name, which cannot be confused with a
+ * decimal-dotted OID.
+ */
+#define DO255_OID_KT128         "KT128"
+
 #endif
@@ -0,0 +1,212 @@
+/*
+ * Runtime backend selection for libdo255.
+ *
+ * The library contains the w64, bmi2 and avx2 implementations of both
+ * curves, compiled with the DO255_NS macro so that their public names
+ * are prefixed (e.g. do255e_bmi2_mul()). This file provides the actual
+ * public API: each function forwards to the selected backend.
+ *
+ * On first use, the fastest backend supported by the current CPU is
+ * selected (with cpuid): avx2 requires AVX2, BMI2 and ADX (and OS
+ * support for the AVX registers); bmi2 requires BMI2 and ADX; w64 is
+ * used otherwise. The bmi2 and avx2 backends also use the LZCNT opcode,
+ * which is present on all x86 CPUs with BMI2; the w64 backend does not
+ * use it (it is compiled without -mlzcnt, and lzcnt64() then uses BSR),
+ * so that it also runs on older CPUs (e.g. Intel before Haswell).
+ *
+ * If the environment variable DO255_BACKEND is set to the name of a
+ * backend which the CPU supports, then that backend is used instead.
+ * The selection can also be changed with do255_set_backend().
+ */
+
+#include <stdlib.h>
+#include "support.c"
+
+#if defined _MSC_VER
+#include <intrin.h>
+#elif (defined __GNUC__ || defined __clang__) \
+	&& (defined __x86_64__ || defined __i386__)
+#include <cpuid.h>
+#endif
+
+#define DO255_BACKEND_W64    0
+#define DO255_BACKEND_BMI2   1
+#define DO255_BACKEND_AVX2   2
+
+static const char *const backend_names[] = { "w64", "bmi2", "avx2" };
+
+/*
+ * Get the best backend supported by the current CPU.
+ */
+static int
+backend_detect(void)
+{
+#if defined _MSC_VER || ((defined __GNUC__ || defined __clang__) \
+	&& (defined __x86_64__ || defined __i386__))
+	uint32_t ecx1, ebx7;
+	int bmi2, avx2;
+
+#if defined _MSC_VER
+	int r[4];
+
+	__cpuid(r, 0);
+	if (r[0] < 7) {
+		return DO255_BACKEND_W64;
+	}
+	__cpuid(r, 1);
+	ecx1 = (uint32_t)r[2];
+	__cpuidex(r, 7, 0);
+	ebx7 = (uint32_t)r[1];
+#else
+	unsigned eax, ebx, ecx, edx;
+
+	if (__get_cpuid_max(0, NULL) < 7) {
+		return DO255_BACKEND_W64;
+	}
+	__cpuid(1, eax, ebx, ecx, edx);
+	ecx1 = ecx;
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	ebx7 = ebx;
+#endif
+
+	/*
+	 * BMI2 is bit 8 of EBX (leaf 7), ADX is bit 19.
+	 */
+	bmi2 = ((ebx7 >> 8) & 1) && ((ebx7 >> 19) & 1);
+	if (!bmi2) {
+		return DO255_BACKEND_W64;
+	}
+
+	/*
+	 * AVX2 is bit 5 of EBX (leaf 7); we also need OSXSAVE (bit 27
+	 * of ECX, leaf 1), and the OS must save the XMM and YMM states
+	 * (bits 1 and 2 of XCR0).
+	 */
+	avx2 = ((ebx7 >> 5) & 1) && ((ecx1 >> 27) & 1);
+	if (avx2) {
+		uint32_t xcr0;
+
+#if defined _MSC_VER
+		xcr0 = (uint32_t)_xgetbv(0);
+#else
+		uint32_t xcr0_hi;
+
+		__asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0_hi) : "c" (0));
+		(void)xcr0_hi;
+#endif
+		avx2 = (xcr0 & 6) == 6;
+	}
+	return avx2 ? DO255_BACKEND_AVX2 : DO255_BACKEND_BMI2;
+#else
+	return DO255_BACKEND_W64;
+#endif
+}
+
+/*
+ * Get a backend identifier from its name; -1 is returned if the name
+ * is unknown.
+ */
+static int
+backend_from_name(const char *name)
+{
+	size_t u;
+
+	for (u = 0; u < (sizeof backend_names) / sizeof backend_names[0];
+		u ++)
+	{
+		if (strcmp(name, backend_names[u]) == 0) {
+			return (int)u;
+		}
+	}
+	return -1;
+}
+
+/*
+ * Current backend (-1 until the first call). If several threads make
+ * their first call concurrently, they all compute and write the same
+ * value.
+ */
+static volatile int backend_current = -1;
+
+static int
+do255_backend_id(void)
+{
+	int id;
+
+	id = backend_current;
+	if (id < 0) {
+		const char *name;
+		int max;
+
+		max = backend_detect();
+		id = max;
+		name = getenv("DO255_BACKEND");
+		if (name != NULL) {
+			int f;
+
+			f = backend_from_name(name);
+			if (f >= 0 && f <= max) {
+				id = f;
+			}
+		}
+		backend_current = id;
+	}
+	return id;
+}
+
+/* see do255.h */
+const char *
+do255_backend_name(void)
+{
+	return backend_names[do255_backend_id()];
+}
+
+/* see do255.h */
+int
+do255_set_backend(const char *name)
+{
+	int id, max;
+
+	max = backend_detect();
+	if (name == NULL) {
+		id = max;
+	} else {
+		id = backend_from_name(name);
+		if (id < 0 || id > max) {
+			return 0;
+		}
+	}
+	backend_current = id;
+	return 1;
+}
+
+#define CURVE   do255e
+#include "dispatch.c"
+
+/* see do255.h */
+const do255e_point do255e_generator = {
+	{ { 2, 0, 0, 0 } },
+	{ { 1, 0, 0, 0 } },
+	{ { 1, 0, 0, 0 } }
+};
+
+#undef CURVE
+#define CURVE   do255s
+#include "dispatch.c"
+
+/* see do255.h */
+const do255s_point do255s_generator = {
+	{ {
+		0x4803AC7D33B156B1,
+		0x3EF832265840B591,
+		0x213759ECCB010B9D,
+		0x39BD72651783FB6D
+	} },
+	{ {
+		0xAAAAAAAAAAAAA584,
+		0xAAAAAAAAAAAAAAAA,
+		0xAAAAAAAAAAAAAAAA,
+		0x2AAAAAAAAAAAAAAA
+	} },
+	{ { 1, 0, 0, 0 } }
+};
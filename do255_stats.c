@@ -0,0 +1,32 @@
+/*
+ * Per-thread operation counters (see do255_stats_get() in do255.h).
+ *
+ * The counters are incremented by the curve implementations and by the
+ * SHA3/SHAKE code only when these are compiled with DO255_STATS set to
+ * a non-zero value (see support.c); this file is the same in all builds,
+ * so that the functions below always exist.
+ */
+
+#include <string.h>
+#include "do255_stats_internal.h"
+
+/* see do255_stats_internal.h */
+#if defined _MSC_VER
+__declspec(thread) do255_stats do255_stats_current;
+#else
+__thread do255_stats do255_stats_current;
+#endif
+
+/* see do255.h */
+void
+do255_stats_get(do255_stats *st)
+{
+	*st = do255_stats_current;
+}
+
+/* see do255.h */
+void
+do255_stats_reset(void)
+{
+	memset(&do255_stats_current, 0, sizeof do255_stats_current);
+}
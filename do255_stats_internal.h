@@ -0,0 +1,19 @@
+#ifndef DO255_STATS_INTERNAL_H__
+#define DO255_STATS_INTERNAL_H__
+
+/*
+ * Internal header: declaration of the per-thread operation counters,
+ * for the code that increments them (support.c, sha3.c, sha3_x.c) and
+ * for do255_stats.c, which defines them. Applications use
+ * do255_stats_get() and do255_stats_reset() (see do255.h).
+ */
+
+#include "do255.h"
+
+#if defined _MSC_VER
+extern __declspec(thread) do255_stats do255_stats_current;
+#else
+extern __thread do255_stats do255_stats_current;
+#endif
+
+#endif
@@ -15,4 +15,12 @@
 #include "pmul_base_arm.c"
 #include "pmul_do255e_arm.c"
 #include "pvrfy_do255e_arm.c"
+#include "pbatch_w32.c"
+#include "pmsm_w32.c"
+#include "pmulti_w32.c"
+#include "pmul4.c"
+#include "pencode_w32.c"
+#include "pprecomp_w32.c"
+#include "pvrfy_table.c"
+#include "pdecode.c"
 #include "pmap_do255e_w32.c"
@@ -14,5 +14,17 @@
 #include "scalar_do255e_w32.c"
 #include "pmul_base_w32.c"
 #include "pmul_do255e_w32.c"
+#if DO255_MULGEN_LARGE
+#include "gtab_do255e_w32.c"
+#include "pmulgen_w32.c"
+#endif
 #include "pvrfy_do255e_w32.c"
+#include "pbatch_w32.c"
+#include "pmsm_w32.c"
+#include "pmulti_w32.c"
+#include "pmul4.c"
+#include "pencode_w32.c"
+#include "pprecomp_w32.c"
+#include "pvrfy_table.c"
+#include "pdecode.c"
 #include "pmap_do255e_w32.c"
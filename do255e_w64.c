@@ -14,5 +14,17 @@
 #include "scalar_do255e_w64.c"
 #include "pmul_base_w64.c"
 #include "pmul_do255e_w64.c"
+#if DO255_MULGEN_LARGE
+#include "gtab_do255e_w64.c"
+#include "pmulgen_w64.c"
+#endif
+#include "gvrfy_do255e_w64.c"
 #include "pvrfy_do255e_w64.c"
+#include "pbatch_do255e_w64.c"
+#include "pmsm_do255e_w64.c"
+#include "pmulti_do255e_w64.c"
+#include "pmul4.c"
+#include "pencode_w64.c"
+#include "pprecomp_w64.c"
+#include "pdecode.c"
 #include "pmap_do255e_w64.c"
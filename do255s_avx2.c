@@ -0,0 +1,35 @@
+/*
+ * Curve: do255s
+ * Point format: 64-bit limbs
+ * Uses ADX/BMI2 opcodes with inline assembly, and AVX2 intrinsics for the
+ * 4-way parallel point multiplications (mul_x4 and mulgen_x4) and point
+ * decoding (decode_batch).
+ * Jacobian (x,w) formulas are used for all operations.
+ */
+
+#define CURVE   do255s
+#include "support.c"
+#include "gf_do255s_bmi2.c"
+#include "sqrt_do255s_w64.c"
+#include "padd_do255s_w64.c"
+#include "icore_w64.c"
+#include "scalar_do255s_w64.c"
+#include "pmul_base_w64.c"
+#include "pmul_do255s_w64.c"
+#if DO255_MULGEN_LARGE
+#include "gtab_do255s_w64.c"
+#include "pmulgen_w64.c"
+#endif
+#include "lagrange_do255s_w64.c"
+#include "gvrfy_do255s_w64.c"
+#include "pvrfy_do255s_w64.c"
+#include "pbatch_do255s_w64.c"
+#include "pmsm_do255s_w64.c"
+#include "pmulti_do255s_w64.c"
+#include "gf_avx2.c"
+#include "pmul4_do255s_avx2.c"
+#include "sqrt4_do255s_avx2.c"
+#include "pdecode4_avx2.c"
+#include "pencode_w64.c"
+#include "pprecomp_w64.c"
+#include "pmap_do255s_w64.c"
@@ -14,6 +14,18 @@
 #include "scalar_do255s_w64.c"
 #include "pmul_base_w64.c"
 #include "pmul_do255s_w64.c"
+#if DO255_MULGEN_LARGE
+#include "gtab_do255s_w64.c"
+#include "pmulgen_w64.c"
+#endif
 #include "lagrange_do255s_w64.c"
+#include "gvrfy_do255s_w64.c"
 #include "pvrfy_do255s_w64.c"
+#include "pbatch_do255s_w64.c"
+#include "pmsm_do255s_w64.c"
+#include "pmulti_do255s_w64.c"
+#include "pmul4.c"
+#include "pencode_w64.c"
+#include "pprecomp_w64.c"
+#include "pdecode.c"
 #include "pmap_do255s_w64.c"
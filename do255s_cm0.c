@@ -16,4 +16,12 @@
 #include "pmul_do255s_arm.c"
 #include "lagrange_do255s_arm.c"
 #include "pvrfy_do255s_arm.c"
+#include "pbatch_w32.c"
+#include "pmsm_w32.c"
+#include "pmulti_w32.c"
+#include "pmul4.c"
+#include "pencode_w32.c"
+#include "pprecomp_w32.c"
+#include "pvrfy_table.c"
+#include "pdecode.c"
 #include "pmap_do255s_w32.c"
@@ -14,6 +14,18 @@
 #include "scalar_do255s_w32.c"
 #include "pmul_base_w32.c"
 #include "pmul_do255s_w32.c"
+#if DO255_MULGEN_LARGE
+#include "gtab_do255s_w32.c"
+#include "pmulgen_w32.c"
+#endif
 #include "lagrange_do255s_w32.c"
 #include "pvrfy_do255s_w32.c"
+#include "pbatch_w32.c"
+#include "pmsm_w32.c"
+#include "pmulti_w32.c"
+#include "pmul4.c"
+#include "pencode_w32.c"
+#include "pprecomp_w32.c"
+#include "pvrfy_table.c"
+#include "pdecode.c"
 #include "pmap_do255s_w32.c"
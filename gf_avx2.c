@@ -0,0 +1,639 @@
+/*
+ * This file implements 4-way parallel operations in finite field
+ * GF(2^255-MQ), using AVX2 opcodes on 64-bit x86 CPUs.
+ *
+ * It is not meant to be compiled by itself, but included in an outer
+ * file, after the 64-bit implementation (gf_bmi2.c or gf_w64.c); the
+ * MQ macro must still be defined, and the gf type and operations are
+ * used for conversions and inversions.
+ */
+
+#include <immintrin.h>
+
+/*
+ * A gf4 structure contains four independent field elements, one per
+ * 64-bit lane. Each element is represented in base 2^26, over 10 limbs
+ * (v[i] contains limb i of all four elements). The represented integer
+ * is \sum_i v[i]*2^(26*i) and is only congruent to the field element
+ * modulo p; it may be larger than p.
+ *
+ * All functions accept operands whose limbs are all lower than 2^27,
+ * and return values that also follow that rule. This leaves enough
+ * room for products (lower than 2^54) to be accumulated into 64-bit
+ * lanes, and for all multiplier operands to fit on 32 bits (the
+ * vpmuludq opcode uses only the low 32 bits of each lane). Reductions
+ * use the following:
+ *   2^255 = MQ mod p
+ *   2^260 = 32*MQ mod p
+ *
+ * Lane masks (for conditional operations) are 64-bit values equal to
+ * either 0 or -1 (all bits set).
+ */
+typedef struct {
+	__m256i v[10];
+} gf4;
+
+#define GF4_M26   0x3FFFFFF
+#define GF4_M21   0x1FFFFF
+
+/*
+ * Set d to four field elements (one per lane). Source values may use
+ * the whole 0..2^256-1 range.
+ */
+UNUSED
+static void
+gf4_set(gf4 *d, const gf *a0, const gf *a1, const gf *a2, const gf *a3)
+{
+	__m256i x0, x1, x2, x3, m;
+
+	x0 = _mm256_setr_epi64x(a0->v0, a1->v0, a2->v0, a3->v0);
+	x1 = _mm256_setr_epi64x(a0->v1, a1->v1, a2->v1, a3->v1);
+	x2 = _mm256_setr_epi64x(a0->v2, a1->v2, a2->v2, a3->v2);
+	x3 = _mm256_setr_epi64x(a0->v3, a1->v3, a2->v3, a3->v3);
+	m = _mm256_set1_epi64x(GF4_M26);
+	d->v[0] = _mm256_and_si256(x0, m);
+	d->v[1] = _mm256_and_si256(_mm256_srli_epi64(x0, 26), m);
+	d->v[2] = _mm256_and_si256(_mm256_or_si256(
+		_mm256_srli_epi64(x0, 52), _mm256_slli_epi64(x1, 12)), m);
+	d->v[3] = _mm256_and_si256(_mm256_srli_epi64(x1, 14), m);
+	d->v[4] = _mm256_and_si256(_mm256_or_si256(
+		_mm256_srli_epi64(x1, 40), _mm256_slli_epi64(x2, 24)), m);
+	d->v[5] = _mm256_and_si256(_mm256_srli_epi64(x2, 2), m);
+	d->v[6] = _mm256_and_si256(_mm256_srli_epi64(x2, 28), m);
+	d->v[7] = _mm256_and_si256(_mm256_or_si256(
+		_mm256_srli_epi64(x2, 54), _mm256_slli_epi64(x3, 10)), m);
+	d->v[8] = _mm256_and_si256(_mm256_srli_epi64(x3, 16), m);
+	d->v[9] = _mm256_srli_epi64(x3, 42);
+}
+
+/*
+ * Set all four lanes of d to the same field element.
+ */
+UNUSED
+static void
+gf4_set1(gf4 *d, const gf *a)
+{
+	gf4_set(d, a, a, a, a);
+}
+
+/*
+ * Get the four field elements from a gf4 structure. Output values are
+ * lower than 2^256, but not necessarily normalized.
+ */
+UNUSED
+static void
+gf4_get(gf *a0, gf *a1, gf *a2, gf *a3, const gf4 *s)
+{
+	uint64_t t[10][4];
+	gf *dd[4];
+	int i, j;
+
+	for (i = 0; i < 10; i ++) {
+		_mm256_storeu_si256((__m256i *)(void *)t[i], s->v[i]);
+	}
+	dd[0] = a0;
+	dd[1] = a1;
+	dd[2] = a2;
+	dd[3] = a3;
+	for (j = 0; j < 4; j ++) {
+		uint64_t l[10], c;
+		int k;
+
+		for (i = 0; i < 10; i ++) {
+			l[i] = t[i][j];
+		}
+
+		/*
+		 * Two carry propagation passes; after the first pass,
+		 * the value is lower than 2^255 + 2^21, hence the
+		 * second pass yields a value lower than 2^256.
+		 */
+		for (k = 0; k < 2; k ++) {
+			for (i = 0; i < 9; i ++) {
+				l[i + 1] += l[i] >> 26;
+				l[i] &= GF4_M26;
+			}
+			c = l[9] >> 21;
+			l[9] &= GF4_M21;
+			l[0] += c * MQ;
+		}
+		dd[j]->v0 = l[0] | (l[1] << 26) | (l[2] << 52);
+		dd[j]->v1 = (l[2] >> 12) | (l[3] << 14) | (l[4] << 40);
+		dd[j]->v2 = (l[4] >> 24) | (l[5] << 2) | (l[6] << 28)
+			| (l[7] << 54);
+		dd[j]->v3 = (l[7] >> 10) | (l[8] << 16) | (l[9] << 42);
+	}
+}
+
+/*
+ * Carry propagation, in parallel over all limbs. Input limbs must be
+ * lower than 2^35 (2^30 for the top limb); output limbs are lower than
+ * 2^27. The source and destination may be the same structure.
+ */
+static inline void
+gf4_carry(gf4 *d, const gf4 *t)
+{
+	__m256i m26, c0, c1, c2, c3, c4, c5, c6, c7, c8, c9;
+
+	m26 = _mm256_set1_epi64x(GF4_M26);
+	c0 = _mm256_srli_epi64(t->v[0], 26);
+	c1 = _mm256_srli_epi64(t->v[1], 26);
+	c2 = _mm256_srli_epi64(t->v[2], 26);
+	c3 = _mm256_srli_epi64(t->v[3], 26);
+	c4 = _mm256_srli_epi64(t->v[4], 26);
+	c5 = _mm256_srli_epi64(t->v[5], 26);
+	c6 = _mm256_srli_epi64(t->v[6], 26);
+	c7 = _mm256_srli_epi64(t->v[7], 26);
+	c8 = _mm256_srli_epi64(t->v[8], 26);
+	c9 = _mm256_srli_epi64(t->v[9], 21);
+	d->v[0] = _mm256_add_epi64(_mm256_and_si256(t->v[0], m26),
+		_mm256_mul_epu32(c9, _mm256_set1_epi64x(MQ)));
+	d->v[1] = _mm256_add_epi64(_mm256_and_si256(t->v[1], m26), c0);
+	d->v[2] = _mm256_add_epi64(_mm256_and_si256(t->v[2], m26), c1);
+	d->v[3] = _mm256_add_epi64(_mm256_and_si256(t->v[3], m26), c2);
+	d->v[4] = _mm256_add_epi64(_mm256_and_si256(t->v[4], m26), c3);
+	d->v[5] = _mm256_add_epi64(_mm256_and_si256(t->v[5], m26), c4);
+	d->v[6] = _mm256_add_epi64(_mm256_and_si256(t->v[6], m26), c5);
+	d->v[7] = _mm256_add_epi64(_mm256_and_si256(t->v[7], m26), c6);
+	d->v[8] = _mm256_add_epi64(_mm256_and_si256(t->v[8], m26), c7);
+	d->v[9] = _mm256_add_epi64(_mm256_and_si256(t->v[9],
+		_mm256_set1_epi64x(GF4_M21)), c8);
+}
+
+/* d <- a + b */
+UNUSED
+static inline void
+gf4_add(gf4 *d, const gf4 *a, const gf4 *b)
+{
+	d->v[0] = _mm256_add_epi64(a->v[0], b->v[0]);
+	d->v[1] = _mm256_add_epi64(a->v[1], b->v[1]);
+	d->v[2] = _mm256_add_epi64(a->v[2], b->v[2]);
+	d->v[3] = _mm256_add_epi64(a->v[3], b->v[3]);
+	d->v[4] = _mm256_add_epi64(a->v[4], b->v[4]);
+	d->v[5] = _mm256_add_epi64(a->v[5], b->v[5]);
+	d->v[6] = _mm256_add_epi64(a->v[6], b->v[6]);
+	d->v[7] = _mm256_add_epi64(a->v[7], b->v[7]);
+	d->v[8] = _mm256_add_epi64(a->v[8], b->v[8]);
+	d->v[9] = _mm256_add_epi64(a->v[9], b->v[9]);
+	gf4_carry(d, d);
+}
+
+/*
+ * Limbs of 128*p, used for subtractions; each limb is at least 2^27,
+ * hence larger than any limb of a subtracted operand.
+ */
+#define GF4_P128_0   (((uint64_t)1 << 33) - ((uint64_t)MQ << 7))
+#define GF4_P128_1   (((uint64_t)1 << 33) - ((uint64_t)1 << 7))
+#define GF4_P128_9   (((uint64_t)1 << 28) - ((uint64_t)1 << 7))
+
+/* d <- a - b */
+UNUSED
+static inline void
+gf4_sub(gf4 *d, const gf4 *a, const gf4 *b)
+{
+	__m256i p0, p1, p9;
+
+	p0 = _mm256_set1_epi64x(GF4_P128_0);
+	p1 = _mm256_set1_epi64x(GF4_P128_1);
+	p9 = _mm256_set1_epi64x(GF4_P128_9);
+	d->v[0] = _mm256_sub_epi64(_mm256_add_epi64(a->v[0], p0), b->v[0]);
+	d->v[1] = _mm256_sub_epi64(_mm256_add_epi64(a->v[1], p1), b->v[1]);
+	d->v[2] = _mm256_sub_epi64(_mm256_add_epi64(a->v[2], p1), b->v[2]);
+	d->v[3] = _mm256_sub_epi64(_mm256_add_epi64(a->v[3], p1), b->v[3]);
+	d->v[4] = _mm256_sub_epi64(_mm256_add_epi64(a->v[4], p1), b->v[4]);
+	d->v[5] = _mm256_sub_epi64(_mm256_add_epi64(a->v[5], p1), b->v[5]);
+	d->v[6] = _mm256_sub_epi64(_mm256_add_epi64(a->v[6], p1), b->v[6]);
+	d->v[7] = _mm256_sub_epi64(_mm256_add_epi64(a->v[7], p1), b->v[7]);
+	d->v[8] = _mm256_sub_epi64(_mm256_add_epi64(a->v[8], p1), b->v[8]);
+	d->v[9] = _mm256_sub_epi64(_mm256_add_epi64(a->v[9], p9), b->v[9]);
+	gf4_carry(d, d);
+}
+
+/* d <- a - b - c */
+UNUSED
+static inline void
+gf4_sub2(gf4 *d, const gf4 *a, const gf4 *b, const gf4 *c)
+{
+	__m256i p0, p1, p9;
+
+	p0 = _mm256_set1_epi64x(2 * GF4_P128_0);
+	p1 = _mm256_set1_epi64x(2 * GF4_P128_1);
+	p9 = _mm256_set1_epi64x(2 * GF4_P128_9);
+	d->v[0] = _mm256_sub_epi64(_mm256_add_epi64(a->v[0], p0),
+		_mm256_add_epi64(b->v[0], c->v[0]));
+	d->v[1] = _mm256_sub_epi64(_mm256_add_epi64(a->v[1], p1),
+		_mm256_add_epi64(b->v[1], c->v[1]));
+	d->v[2] = _mm256_sub_epi64(_mm256_add_epi64(a->v[2], p1),
+		_mm256_add_epi64(b->v[2], c->v[2]));
+	d->v[3] = _mm256_sub_epi64(_mm256_add_epi64(a->v[3], p1),
+		_mm256_add_epi64(b->v[3], c->v[3]));
+	d->v[4] = _mm256_sub_epi64(_mm256_add_epi64(a->v[4], p1),
+		_mm256_add_epi64(b->v[4], c->v[4]));
+	d->v[5] = _mm256_sub_epi64(_mm256_add_epi64(a->v[5], p1),
+		_mm256_add_epi64(b->v[5], c->v[5]));
+	d->v[6] = _mm256_sub_epi64(_mm256_add_epi64(a->v[6], p1),
+		_mm256_add_epi64(b->v[6], c->v[6]));
+	d->v[7] = _mm256_sub_epi64(_mm256_add_epi64(a->v[7], p1),
+		_mm256_add_epi64(b->v[7], c->v[7]));
+	d->v[8] = _mm256_sub_epi64(_mm256_add_epi64(a->v[8], p1),
+		_mm256_add_epi64(b->v[8], c->v[8]));
+	d->v[9] = _mm256_sub_epi64(_mm256_add_epi64(a->v[9], p9),
+		_mm256_add_epi64(b->v[9], c->v[9]));
+	gf4_carry(d, d);
+}
+
+/* d <- -a */
+UNUSED
+static inline void
+gf4_neg(gf4 *d, const gf4 *a)
+{
+	__m256i p0, p1, p9;
+
+	p0 = _mm256_set1_epi64x(GF4_P128_0);
+	p1 = _mm256_set1_epi64x(GF4_P128_1);
+	p9 = _mm256_set1_epi64x(GF4_P128_9);
+	d->v[0] = _mm256_sub_epi64(p0, a->v[0]);
+	d->v[1] = _mm256_sub_epi64(p1, a->v[1]);
+	d->v[2] = _mm256_sub_epi64(p1, a->v[2]);
+	d->v[3] = _mm256_sub_epi64(p1, a->v[3]);
+	d->v[4] = _mm256_sub_epi64(p1, a->v[4]);
+	d->v[5] = _mm256_sub_epi64(p1, a->v[5]);
+	d->v[6] = _mm256_sub_epi64(p1, a->v[6]);
+	d->v[7] = _mm256_sub_epi64(p1, a->v[7]);
+	d->v[8] = _mm256_sub_epi64(p1, a->v[8]);
+	d->v[9] = _mm256_sub_epi64(p9, a->v[9]);
+	gf4_carry(d, d);
+}
+
+/*
+ * d <- a (lanes where ctl is -1)
+ * d <- b (lanes where ctl is 0)
+ */
+UNUSED
+static inline void
+gf4_sel(gf4 *d, const gf4 *a, const gf4 *b, __m256i ctl)
+{
+	d->v[0] = _mm256_blendv_epi8(b->v[0], a->v[0], ctl);
+	d->v[1] = _mm256_blendv_epi8(b->v[1], a->v[1], ctl);
+	d->v[2] = _mm256_blendv_epi8(b->v[2], a->v[2], ctl);
+	d->v[3] = _mm256_blendv_epi8(b->v[3], a->v[3], ctl);
+	d->v[4] = _mm256_blendv_epi8(b->v[4], a->v[4], ctl);
+	d->v[5] = _mm256_blendv_epi8(b->v[5], a->v[5], ctl);
+	d->v[6] = _mm256_blendv_epi8(b->v[6], a->v[6], ctl);
+	d->v[7] = _mm256_blendv_epi8(b->v[7], a->v[7], ctl);
+	d->v[8] = _mm256_blendv_epi8(b->v[8], a->v[8], ctl);
+	d->v[9] = _mm256_blendv_epi8(b->v[9], a->v[9], ctl);
+}
+
+/*
+ * d <- -a (lanes where ctl is -1)
+ * d <- a (lanes where ctl is 0)
+ */
+UNUSED
+static inline void
+gf4_condneg(gf4 *d, const gf4 *a, __m256i ctl)
+{
+	gf4 t;
+
+	gf4_neg(&t, a);
+	gf4_sel(d, &t, a, ctl);
+}
+
+/* d <- (2^n)*a, for n = 1 to 3 */
+UNUSED
+static inline void
+gf4_mul2k(gf4 *d, const gf4 *a, int n)
+{
+	d->v[0] = _mm256_slli_epi64(a->v[0], n);
+	d->v[1] = _mm256_slli_epi64(a->v[1], n);
+	d->v[2] = _mm256_slli_epi64(a->v[2], n);
+	d->v[3] = _mm256_slli_epi64(a->v[3], n);
+	d->v[4] = _mm256_slli_epi64(a->v[4], n);
+	d->v[5] = _mm256_slli_epi64(a->v[5], n);
+	d->v[6] = _mm256_slli_epi64(a->v[6], n);
+	d->v[7] = _mm256_slli_epi64(a->v[7], n);
+	d->v[8] = _mm256_slli_epi64(a->v[8], n);
+	d->v[9] = _mm256_slli_epi64(a->v[9], n);
+	gf4_carry(d, d);
+}
+
+#define gf4_mul2(d, a)   gf4_mul2k(d, a, 1)
+#define gf4_mul4(d, a)   gf4_mul2k(d, a, 2)
+#define gf4_mul8(d, a)   gf4_mul2k(d, a, 3)
+
+/*
+ * Reduce a 19-limb product (local variables t0 to t18, each lower than
+ * 2^58) into d. Upper limbs (10 to 18) are split into 26-bit and 32-bit
+ * chunks, which are folded (with 2^260 = 32*MQ mod p) into the lower
+ * limbs; this requires no carry propagation. Carries are then
+ * propagated with two interleaved chains (0 to 5, and 5 to 9 then
+ * wrapping to 0 and 1).
+ */
+#define GF4_REDUCE(d)   do { \
+		__m256i m26, f, c, e; \
+		m26 = _mm256_set1_epi64x(GF4_M26); \
+		f = _mm256_set1_epi64x(32 * MQ); \
+		GF4_FOLD(t10, t0, t1); \
+		GF4_FOLD(t11, t1, t2); \
+		GF4_FOLD(t12, t2, t3); \
+		GF4_FOLD(t13, t3, t4); \
+		GF4_FOLD(t14, t4, t5); \
+		GF4_FOLD(t15, t5, t6); \
+		GF4_FOLD(t16, t6, t7); \
+		GF4_FOLD(t17, t7, t8); \
+		GF4_FOLD(t18, t8, t9); \
+		GF4_CARRY1(t0, t1); \
+		GF4_CARRY1(t5, t6); \
+		GF4_CARRY1(t1, t2); \
+		GF4_CARRY1(t6, t7); \
+		GF4_CARRY1(t2, t3); \
+		GF4_CARRY1(t7, t8); \
+		GF4_CARRY1(t3, t4); \
+		GF4_CARRY1(t8, t9); \
+		GF4_CARRY1(t4, t5); \
+		c = _mm256_srli_epi64(t9, 26); \
+		t9 = _mm256_and_si256(t9, m26); \
+		t0 = _mm256_add_epi64(t0, _mm256_mul_epu32(c, f)); \
+		GF4_CARRY1(t0, t1); \
+		GF4_CARRY1(t5, t6); \
+		(d)->v[0] = t0; \
+		(d)->v[1] = t1; \
+		(d)->v[2] = t2; \
+		(d)->v[3] = t3; \
+		(d)->v[4] = t4; \
+		(d)->v[5] = t5; \
+		(d)->v[6] = t6; \
+		(d)->v[7] = t7; \
+		(d)->v[8] = t8; \
+		(d)->v[9] = t9; \
+	} while (0)
+#define GF4_FOLD(x, lo, hi)   do { \
+		e = _mm256_mul_epu32(_mm256_and_si256(x, m26), f); \
+		(lo) = _mm256_add_epi64(lo, e); \
+		e = _mm256_mul_epu32(_mm256_srli_epi64(x, 26), f); \
+		(hi) = _mm256_add_epi64(hi, e); \
+	} while (0)
+#define GF4_CARRY1(x, y)   do { \
+		c = _mm256_srli_epi64(x, 26); \
+		(x) = _mm256_and_si256(x, m26); \
+		(y) = _mm256_add_epi64(y, c); \
+	} while (0)
+
+/* d <- a*b */
+static inline void
+gf4_mul_inline(gf4 *d, const gf4 *a, const gf4 *b)
+{
+	__m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+	__m256i t10, t11, t12, t13, t14, t15, t16, t17, t18;
+
+	STATS_ADD(gf_mul, 4);
+
+#define M(i, j)   _mm256_mul_epu32(a->v[i], b->v[j])
+	t0 = M(0, 0);
+	t1 = M(0, 1);
+	t1 = _mm256_add_epi64(t1, M(1, 0));
+	t2 = M(0, 2);
+	t2 = _mm256_add_epi64(t2, M(1, 1));
+	t2 = _mm256_add_epi64(t2, M(2, 0));
+	t3 = M(0, 3);
+	t3 = _mm256_add_epi64(t3, M(1, 2));
+	t3 = _mm256_add_epi64(t3, M(2, 1));
+	t3 = _mm256_add_epi64(t3, M(3, 0));
+	t4 = M(0, 4);
+	t4 = _mm256_add_epi64(t4, M(1, 3));
+	t4 = _mm256_add_epi64(t4, M(2, 2));
+	t4 = _mm256_add_epi64(t4, M(3, 1));
+	t4 = _mm256_add_epi64(t4, M(4, 0));
+	t5 = M(0, 5);
+	t5 = _mm256_add_epi64(t5, M(1, 4));
+	t5 = _mm256_add_epi64(t5, M(2, 3));
+	t5 = _mm256_add_epi64(t5, M(3, 2));
+	t5 = _mm256_add_epi64(t5, M(4, 1));
+	t5 = _mm256_add_epi64(t5, M(5, 0));
+	t6 = M(0, 6);
+	t6 = _mm256_add_epi64(t6, M(1, 5));
+	t6 = _mm256_add_epi64(t6, M(2, 4));
+	t6 = _mm256_add_epi64(t6, M(3, 3));
+	t6 = _mm256_add_epi64(t6, M(4, 2));
+	t6 = _mm256_add_epi64(t6, M(5, 1));
+	t6 = _mm256_add_epi64(t6, M(6, 0));
+	t7 = M(0, 7);
+	t7 = _mm256_add_epi64(t7, M(1, 6));
+	t7 = _mm256_add_epi64(t7, M(2, 5));
+	t7 = _mm256_add_epi64(t7, M(3, 4));
+	t7 = _mm256_add_epi64(t7, M(4, 3));
+	t7 = _mm256_add_epi64(t7, M(5, 2));
+	t7 = _mm256_add_epi64(t7, M(6, 1));
+	t7 = _mm256_add_epi64(t7, M(7, 0));
+	t8 = M(0, 8);
+	t8 = _mm256_add_epi64(t8, M(1, 7));
+	t8 = _mm256_add_epi64(t8, M(2, 6));
+	t8 = _mm256_add_epi64(t8, M(3, 5));
+	t8 = _mm256_add_epi64(t8, M(4, 4));
+	t8 = _mm256_add_epi64(t8, M(5, 3));
+	t8 = _mm256_add_epi64(t8, M(6, 2));
+	t8 = _mm256_add_epi64(t8, M(7, 1));
+	t8 = _mm256_add_epi64(t8, M(8, 0));
+	t9 = M(0, 9);
+	t9 = _mm256_add_epi64(t9, M(1, 8));
+	t9 = _mm256_add_epi64(t9, M(2, 7));
+	t9 = _mm256_add_epi64(t9, M(3, 6));
+	t9 = _mm256_add_epi64(t9, M(4, 5));
+	t9 = _mm256_add_epi64(t9, M(5, 4));
+	t9 = _mm256_add_epi64(t9, M(6, 3));
+	t9 = _mm256_add_epi64(t9, M(7, 2));
+	t9 = _mm256_add_epi64(t9, M(8, 1));
+	t9 = _mm256_add_epi64(t9, M(9, 0));
+	t10 = M(1, 9);
+	t10 = _mm256_add_epi64(t10, M(2, 8));
+	t10 = _mm256_add_epi64(t10, M(3, 7));
+	t10 = _mm256_add_epi64(t10, M(4, 6));
+	t10 = _mm256_add_epi64(t10, M(5, 5));
+	t10 = _mm256_add_epi64(t10, M(6, 4));
+	t10 = _mm256_add_epi64(t10, M(7, 3));
+	t10 = _mm256_add_epi64(t10, M(8, 2));
+	t10 = _mm256_add_epi64(t10, M(9, 1));
+	t11 = M(2, 9);
+	t11 = _mm256_add_epi64(t11, M(3, 8));
+	t11 = _mm256_add_epi64(t11, M(4, 7));
+	t11 = _mm256_add_epi64(t11, M(5, 6));
+	t11 = _mm256_add_epi64(t11, M(6, 5));
+	t11 = _mm256_add_epi64(t11, M(7, 4));
+	t11 = _mm256_add_epi64(t11, M(8, 3));
+	t11 = _mm256_add_epi64(t11, M(9, 2));
+	t12 = M(3, 9);
+	t12 = _mm256_add_epi64(t12, M(4, 8));
+	t12 = _mm256_add_epi64(t12, M(5, 7));
+	t12 = _mm256_add_epi64(t12, M(6, 6));
+	t12 = _mm256_add_epi64(t12, M(7, 5));
+	t12 = _mm256_add_epi64(t12, M(8, 4));
+	t12 = _mm256_add_epi64(t12, M(9, 3));
+	t13 = M(4, 9);
+	t13 = _mm256_add_epi64(t13, M(5, 8));
+	t13 = _mm256_add_epi64(t13, M(6, 7));
+	t13 = _mm256_add_epi64(t13, M(7, 6));
+	t13 = _mm256_add_epi64(t13, M(8, 5));
+	t13 = _mm256_add_epi64(t13, M(9, 4));
+	t14 = M(5, 9);
+	t14 = _mm256_add_epi64(t14, M(6, 8));
+	t14 = _mm256_add_epi64(t14, M(7, 7));
+	t14 = _mm256_add_epi64(t14, M(8, 6));
+	t14 = _mm256_add_epi64(t14, M(9, 5));
+	t15 = M(6, 9);
+	t15 = _mm256_add_epi64(t15, M(7, 8));
+	t15 = _mm256_add_epi64(t15, M(8, 7));
+	t15 = _mm256_add_epi64(t15, M(9, 6));
+	t16 = M(7, 9);
+	t16 = _mm256_add_epi64(t16, M(8, 8));
+	t16 = _mm256_add_epi64(t16, M(9, 7));
+	t17 = M(8, 9);
+	t17 = _mm256_add_epi64(t17, M(9, 8));
+	t18 = M(9, 9);
+#undef M
+	GF4_REDUCE(d);
+}
+
+/* d <- a*b */
+UNUSED
+static void
+gf4_mul(gf4 *d, const gf4 *a, const gf4 *b)
+{
+	gf4_mul_inline(d, a, b);
+}
+
+/* d <- a^2 */
+static inline void
+gf4_sqr_inline(gf4 *d, const gf4 *a)
+{
+	__m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+	__m256i t10, t11, t12, t13, t14, t15, t16, t17, t18;
+	gf4 a2;
+
+	STATS_ADD(gf_sqr, 4);
+
+	a2.v[1] = _mm256_add_epi64(a->v[1], a->v[1]);
+	a2.v[2] = _mm256_add_epi64(a->v[2], a->v[2]);
+	a2.v[3] = _mm256_add_epi64(a->v[3], a->v[3]);
+	a2.v[4] = _mm256_add_epi64(a->v[4], a->v[4]);
+	a2.v[5] = _mm256_add_epi64(a->v[5], a->v[5]);
+	a2.v[6] = _mm256_add_epi64(a->v[6], a->v[6]);
+	a2.v[7] = _mm256_add_epi64(a->v[7], a->v[7]);
+	a2.v[8] = _mm256_add_epi64(a->v[8], a->v[8]);
+	a2.v[9] = _mm256_add_epi64(a->v[9], a->v[9]);
+
+#define M(i, j)   _mm256_mul_epu32(a->v[i], a->v[j])
+#define D(i, j)   _mm256_mul_epu32(a->v[i], a2.v[j])
+	t0 = M(0, 0);
+	t1 = D(0, 1);
+	t2 = M(1, 1);
+	t2 = _mm256_add_epi64(t2, D(0, 2));
+	t3 = D(0, 3);
+	t3 = _mm256_add_epi64(t3, D(1, 2));
+	t4 = M(2, 2);
+	t4 = _mm256_add_epi64(t4, D(0, 4));
+	t4 = _mm256_add_epi64(t4, D(1, 3));
+	t5 = D(0, 5);
+	t5 = _mm256_add_epi64(t5, D(1, 4));
+	t5 = _mm256_add_epi64(t5, D(2, 3));
+	t6 = M(3, 3);
+	t6 = _mm256_add_epi64(t6, D(0, 6));
+	t6 = _mm256_add_epi64(t6, D(1, 5));
+	t6 = _mm256_add_epi64(t6, D(2, 4));
+	t7 = D(0, 7);
+	t7 = _mm256_add_epi64(t7, D(1, 6));
+	t7 = _mm256_add_epi64(t7, D(2, 5));
+	t7 = _mm256_add_epi64(t7, D(3, 4));
+	t8 = M(4, 4);
+	t8 = _mm256_add_epi64(t8, D(0, 8));
+	t8 = _mm256_add_epi64(t8, D(1, 7));
+	t8 = _mm256_add_epi64(t8, D(2, 6));
+	t8 = _mm256_add_epi64(t8, D(3, 5));
+	t9 = D(0, 9);
+	t9 = _mm256_add_epi64(t9, D(1, 8));
+	t9 = _mm256_add_epi64(t9, D(2, 7));
+	t9 = _mm256_add_epi64(t9, D(3, 6));
+	t9 = _mm256_add_epi64(t9, D(4, 5));
+	t10 = M(5, 5);
+	t10 = _mm256_add_epi64(t10, D(1, 9));
+	t10 = _mm256_add_epi64(t10, D(2, 8));
+	t10 = _mm256_add_epi64(t10, D(3, 7));
+	t10 = _mm256_add_epi64(t10, D(4, 6));
+	t11 = D(2, 9);
+	t11 = _mm256_add_epi64(t11, D(3, 8));
+	t11 = _mm256_add_epi64(t11, D(4, 7));
+	t11 = _mm256_add_epi64(t11, D(5, 6));
+	t12 = M(6, 6);
+	t12 = _mm256_add_epi64(t12, D(3, 9));
+	t12 = _mm256_add_epi64(t12, D(4, 8));
+	t12 = _mm256_add_epi64(t12, D(5, 7));
+	t13 = D(4, 9);
+	t13 = _mm256_add_epi64(t13, D(5, 8));
+	t13 = _mm256_add_epi64(t13, D(6, 7));
+	t14 = M(7, 7);
+	t14 = _mm256_add_epi64(t14, D(5, 9));
+	t14 = _mm256_add_epi64(t14, D(6, 8));
+	t15 = D(6, 9);
+	t15 = _mm256_add_epi64(t15, D(7, 8));
+	t16 = M(8, 8);
+	t16 = _mm256_add_epi64(t16, D(7, 9));
+	t17 = D(8, 9);
+	t18 = M(9, 9);
+#undef M
+#undef D
+	GF4_REDUCE(d);
+}
+
+/* d <- a^2 */
+UNUSED
+static void
+gf4_sqr(gf4 *d, const gf4 *a)
+{
+	gf4_sqr_inline(d, a);
+}
+
+/* d <- a^(2^n), for n >= 1 */
+UNUSED
+static void
+gf4_sqr_x(gf4 *d, const gf4 *a, unsigned n)
+{
+	gf4_sqr(d, a);
+	while (n -- > 1) {
+		gf4_sqr(d, d);
+	}
+}
+
+/*
+ * Compare each lane with zero; returned mask is -1 in lanes whose value
+ * is zero (as a field element), 0 in other lanes.
+ */
+UNUSED
+static __m256i
+gf4_iszero(const gf4 *a)
+{
+	gf x0, x1, x2, x3;
+
+	gf4_get(&x0, &x1, &x2, &x3, a);
+	return _mm256_setr_epi64x(
+		-(int64_t)gf_iszero(&x0), -(int64_t)gf_iszero(&x1),
+		-(int64_t)gf_iszero(&x2), -(int64_t)gf_iszero(&x3));
+}
+
+/*
+ * Invert the four field elements (a zero lane yields zero). Each lane
+ * is inverted separately with the 64-bit implementation; callers
+ * should use Montgomery's trick to share that cost between several
+ * values.
+ */
+UNUSED
+static void
+gf4_inv(gf4 *d, const gf4 *a)
+{
+	gf x0, x1, x2, x3;
+
+	gf4_get(&x0, &x1, &x2, &x3, a);
+	gf_inv(&x0, &x0);
+	gf_inv(&x1, &x1);
+	gf_inv(&x2, &x2);
+	gf_inv(&x3, &x3);
+	gf4_set(d, &x0, &x1, &x2, &x3);
+}
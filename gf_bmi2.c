@@ -49,6 +49,28 @@ static const gf GF_P = {
 	} while (0)
 #endif
 
+/*
+ * UMUL64x2() and UMUL64x2_ADD() are used by the divsteps code shared
+ * with the w64 implementation (gf_divsteps_w64.c).
+ */
+#define UMUL64x2(lo, hi, x1, y1, x2, y2)   do { \
+		unsigned __int128 umul64_tmp; \
+		umul64_tmp = (unsigned __int128)(x1) * (unsigned __int128)(y1) \
+			+ (unsigned __int128)(x2) * (unsigned __int128)(y2); \
+		(lo) = (uint64_t)umul64_tmp; \
+		(hi) = (uint64_t)(umul64_tmp >> 64); \
+	} while (0)
+#define UMUL64x2_ADD(lo, hi, x1, y1, x2, y2, z3)   do { \
+		unsigned __int128 umul64_tmp; \
+		umul64_tmp = (unsigned __int128)(x1) * (unsigned __int128)(y1) \
+			+ (unsigned __int128)(x2) * (unsigned __int128)(y2) \
+			+ (unsigned __int128)(z3); \
+		(lo) = (uint64_t)umul64_tmp; \
+		(hi) = (uint64_t)(umul64_tmp >> 64); \
+	} while (0)
+
+#define CTZ64(x)   ((unsigned)_tzcnt_u64(x))
+
 /*
  * A field element is represented as four limbs, in base 2^64. Operands
  * and result may be up to 2^256-1.
@@ -371,6 +393,8 @@ __attribute__((always_inline))
 static inline void
 gf_mul_inline(gf *d, const gf *a, const gf *b)
 {
+	STATS_INC(gf_mul);
+
 	__asm__ __volatile__ (
 		/*
 		 * We compute the 512-bit result into r8..r15. Carry
@@ -504,6 +528,8 @@ __attribute__((always_inline))
 static inline void
 gf_sqr_inline(gf *d, const gf *a)
 {
+	STATS_INC(gf_sqr);
+
 	__asm__ __volatile__ (
 		/*
 		 * We compute the 512-bit result into r8..r15. Carry
@@ -638,6 +664,8 @@ __attribute__((always_inline))
 static void
 gf_sqr_x_inline(gf *d, const gf *a, long num)
 {
+	STATS_ADD(gf_sqr, num);
+
 	__asm__ __volatile__ (
 		/*
 		 * Load a0..a3 into rax:rbx:rcx:rbp
@@ -1303,13 +1331,12 @@ gf_lin(gf *d, const gf *u, const gf *v,
 /* ================================================================== */
 
 /*
- * Inversion in the field: d <- 1/y
- * If y = 0, then d is set to zero.
- * Returned value is 1 if the value was invertible, 0 otherwise.
+ * Inversion in the field with an optimized binary GCD. Same API as
+ * gf_inv().
  */
 __attribute__((unused))
 static uint64_t
-gf_inv(gf *d, const gf *y)
+gf_inv_bingcd(gf *d, const gf *y)
 {
 	gf a, b, u, v;
 	unsigned long long f0, f1, g0, g1, xa, xb;
@@ -1625,6 +1652,8 @@ gf_legendre(const gf *y)
 	unsigned long long nega;
 	int i;
 
+	STATS_INC(gf_legendre);
+
 	gf_normalize(&a, y);
 	b = GF_P;
 	ls = 0;
@@ -1828,6 +1857,26 @@ gf_legendre(const gf *y)
 		& (gf_iszero(y) - 1));
 }
 
+#include "gf_divsteps_w64.c"
+
+/*
+ * Inversion in the field: d <- 1/y
+ * If y = 0, then d is set to zero.
+ * Returned value is 1 if the value was invertible, 0 otherwise.
+ */
+__attribute__((unused))
+static uint64_t
+gf_inv(gf *d, const gf *y)
+{
+	STATS_INC(gf_inv);
+
+#if DO255_INV_SAFEGCD
+	return gf_inv_safegcd(d, y);
+#else
+	return gf_inv_bingcd(d, y);
+#endif
+}
+
 static unsigned long long
 dec64le(const uint8_t *buf)
 {
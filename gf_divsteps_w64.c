@@ -0,0 +1,405 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf (four 64-bit limbs) and the field operations, including
+ *    gf_lin(), gf_mul_inline() and gf_legendre()
+ *  - defined GF_INVT620 and GF_INVT744 (1/2^620 and 1/2^744 in the field)
+ *  - defined the UMUL64x2(), UMUL64x2_ADD() and CTZ64() macros
+ *  - defined the UNUSED and STATS_INC() macros (see support.c)
+ *
+ * This file implements the field inversion and Legendre symbol based on
+ * batches of 62 Bernstein-Yang divsteps: gf_inv_safegcd() (constant-time),
+ * and gf_inv_vartime() and gf_legendre_vartime() (variable-time, for
+ * public data only). It is shared by the w64 and bmi2 implementations.
+ */
+
+/*
+ * Compute (a*f+b*g)/2^62. Parameters f and g are provided with an
+ * unsigned type, but they are signed integers in the -2^62..+2^62 range.
+ * Values a, b and d are signed 256-bit integers (two's complement). The
+ * division by 2^62 is assumed to be exact (low 62 bits of a*f+b*g are
+ * dropped), and the result is assumed to fit in 256 bits (truncation is
+ * applied on higher bits).
+ */
+static void
+s256_lin_div62(gf *d, const gf *a, const gf *b,
+	unsigned long long f, unsigned long long g)
+{
+	gf ta, tb;
+	unsigned long long sf, sg, d0, d1, d2, d3, t;
+	unsigned char cc;
+
+	/*
+	 * If f < 0, replace f with -f but keep the sign in sf.
+	 * Similarly for g.
+	 */
+	sf = f >> 63;
+	f = (f ^ -sf) + sf;
+	sg = g >> 63;
+	g = (g ^ -sg) + sg;
+
+	/*
+	 * Apply signs sf and sg to a and b, respectively.
+	 */
+	cc = _addcarry_u64(0, a->v0 ^ -sf, sf, (unsigned long long *)&ta.v0);
+	cc = _addcarry_u64(cc, a->v1 ^ -sf, 0, (unsigned long long *)&ta.v1);
+	cc = _addcarry_u64(cc, a->v2 ^ -sf, 0, (unsigned long long *)&ta.v2);
+	(void)_addcarry_u64(cc, a->v3 ^ -sf, 0, (unsigned long long *)&ta.v3);
+
+	cc = _addcarry_u64(0, b->v0 ^ -sg, sg, (unsigned long long *)&tb.v0);
+	cc = _addcarry_u64(cc, b->v1 ^ -sg, 0, (unsigned long long *)&tb.v1);
+	cc = _addcarry_u64(cc, b->v2 ^ -sg, 0, (unsigned long long *)&tb.v2);
+	(void)_addcarry_u64(cc, b->v3 ^ -sg, 0, (unsigned long long *)&tb.v3);
+
+	/*
+	 * Compute a*f+b*g into d0:d1:d2:d3:t, with the same sign
+	 * correction as in s256_lin_div31_abs(). Products are 126 bits
+	 * at most, so the sums cannot overflow.
+	 */
+	UMUL64x2(d0, t, ta.v0, f, tb.v0, g);
+	UMUL64x2_ADD(d1, t, ta.v1, f, tb.v1, g, t);
+	UMUL64x2_ADD(d2, t, ta.v2, f, tb.v2, g, t);
+	UMUL64x2_ADD(d3, t, ta.v3, f, tb.v3, g, t);
+	t -= -(unsigned long long)(ta.v3 >> 63) & f;
+	t -= -(unsigned long long)(tb.v3 >> 63) & g;
+
+	/*
+	 * Apply the shift.
+	 */
+	d->v0 = (d0 >> 62) | (d1 << 2);
+	d->v1 = (d1 >> 62) | (d2 << 2);
+	d->v2 = (d2 >> 62) | (d3 << 2);
+	d->v3 = (d3 >> 62) | (t << 2);
+}
+
+/*
+ * Run 62 divsteps (Bernstein-Yang, with the "zeta = -(delta+1/2)"
+ * convention) on the low words f and g of the current values. The
+ * transition matrix is written in *tu, *tv, *tq and *tr (signed values
+ * in the -2^62..+2^62 range, stored with an unsigned type), such that
+ * the new values are (tu*f+tv*g)/2^62 and (tq*f+tr*g)/2^62. The new
+ * zeta is returned. This function is constant-time.
+ */
+static int64_t
+divsteps_62(int64_t zeta, uint64_t f, uint64_t g,
+	uint64_t *tu, uint64_t *tv, uint64_t *tq, uint64_t *tr)
+{
+	uint64_t u, v, q, r, c1, c2, x, y, z;
+	int i;
+
+	u = 1;
+	v = 0;
+	q = 0;
+	r = 1;
+	for (i = 0; i < 62; i ++) {
+		/*
+		 * c1 = -1 if zeta < 0 (i.e. delta > 0), 0 otherwise.
+		 * c2 = -1 if g is odd, 0 otherwise.
+		 * If g is odd, we add f (or -f, if delta > 0) to g;
+		 * if both conditions hold, then we also swap f and g
+		 * (f receives the old g, by adding the new g to f).
+		 */
+		c1 = (uint64_t)(zeta >> 63);
+		c2 = -(g & 1);
+		x = (f ^ c1) - c1;
+		y = (u ^ c1) - c1;
+		z = (v ^ c1) - c1;
+		g += x & c2;
+		q += y & c2;
+		r += z & c2;
+		c1 &= c2;
+		zeta = (zeta ^ (int64_t)c1) - 1;
+		f += g & c1;
+		u += q & c1;
+		v += r & c1;
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+	}
+	*tu = u;
+	*tv = v;
+	*tq = q;
+	*tr = r;
+	return zeta;
+}
+
+/*
+ * Inversion in the field, with the Bernstein-Yang "safegcd" algorithm
+ * (constant-time variant). Same API as gf_inv().
+ */
+UNUSED
+static uint64_t
+gf_inv_safegcd(gf *d, const gf *y)
+{
+	gf f, g, u, v;
+	int64_t zeta;
+	int i;
+
+	/*
+	 * We start with f = p and g = y, and maintain u and v such that
+	 * f*2^(62*i) = u*y and g*2^(62*i) = v*y (mod p) after i batches.
+	 * Values f and g are signed; the divsteps keep them in the
+	 * -p..+p range. After 590 divsteps (the bound for 256-bit
+	 * inputs), g = 0 and f = +/-1 if y was invertible; we use 10
+	 * batches of 62 divsteps, for a total of 620.
+	 *
+	 * If y = 0, then g remains 0 and v remains 0 throughout, and
+	 * the returned value is zero.
+	 */
+	f = GF_P;
+	gf_normalize(&g, y);
+	u = GF_ZERO;
+	v = GF_ONE;
+	zeta = -1;
+	for (i = 0; i < 10; i ++) {
+		uint64_t t00, t01, t10, t11;
+		gf nf, ng, nu, nv;
+
+		zeta = divsteps_62(zeta, f.v0, g.v0, &t00, &t01, &t10, &t11);
+		s256_lin_div62(&nf, &f, &g, t00, t01);
+		s256_lin_div62(&ng, &f, &g, t10, t11);
+		gf_lin(&nu, &u, &v, t00, t01);
+		gf_lin(&nv, &u, &v, t10, t11);
+		f = nf;
+		g = ng;
+		u = nu;
+		v = nv;
+	}
+
+	/*
+	 * 1/y = sign(f)*u/2^620.
+	 */
+	gf_condneg(&u, &u, f.v3 >> 63);
+	gf_mul_inline(d, &u, &GF_INVT620);
+	return gf_iszero(d) ^ 1;
+}
+
+/*
+ * Run 62 divsteps (original Bernstein-Yang convention, with
+ * eta = -delta) on the low words f and g of the current values, in
+ * variable time: runs of zeros in g are skipped at once, and up to six
+ * bits of g are cleared with a single multiple of f. The transition
+ * matrix is written in *tu, *tv, *tq and *tr, with the same conventions
+ * as in divsteps_62(). The new eta is returned.
+ */
+static int64_t
+divsteps_62_vartime(int64_t eta, uint64_t f, uint64_t g,
+	uint64_t *tu, uint64_t *tv, uint64_t *tq, uint64_t *tr)
+{
+	uint64_t u, v, q, r, x, y, z, m, w;
+	int i, limit;
+	unsigned zeros;
+
+	u = 1;
+	v = 0;
+	q = 0;
+	r = 1;
+	i = 62;
+	for (;;) {
+		/*
+		 * Skip the zeros at the bottom of g (but no more than
+		 * the remaining number of divsteps).
+		 */
+		zeros = CTZ64(g | ((uint64_t)-1 << i));
+		g >>= zeros;
+		u <<= zeros;
+		v <<= zeros;
+		eta -= (int64_t)zeros;
+		i -= (int)zeros;
+		if (i == 0) {
+			break;
+		}
+
+		/*
+		 * f and g are odd. If eta < 0, then we negate eta and
+		 * replace (f, g) with (g, -f); then we add to g the
+		 * multiple of f which clears as many low bits of g as
+		 * possible (up to min(eta+1, i) bits, and at most 6 or 4
+		 * bits, depending on the branch).
+		 */
+		if (eta < 0) {
+			eta = -eta;
+			x = f;
+			f = g;
+			g = -x;
+			y = u;
+			u = q;
+			q = -y;
+			z = v;
+			v = r;
+			r = -z;
+			limit = ((int)eta + 1) > i ? i : ((int)eta + 1);
+			m = ((uint64_t)-1 >> (64 - limit)) & 63;
+			w = (f * g * (f * f - 2)) & m;
+		} else {
+			limit = ((int)eta + 1) > i ? i : ((int)eta + 1);
+			m = ((uint64_t)-1 >> (64 - limit)) & 15;
+			w = f + (((f + 1) & 4) << 1);
+			w = (-w * g) & m;
+		}
+		g += f * w;
+		q += u * w;
+		r += v * w;
+	}
+	*tu = u;
+	*tv = v;
+	*tq = q;
+	*tr = r;
+	return eta;
+}
+
+/*
+ * Inversion in the field, in variable time: d <- 1/y
+ * If y = 0, then d is set to zero.
+ * Returned value is 1 if the value was invertible, 0 otherwise.
+ *
+ * This function MUST NOT be used on secret values; it is meant for
+ * public data (e.g. in signature verification).
+ */
+UNUSED
+static uint64_t
+gf_inv_vartime(gf *d, const gf *y)
+{
+	gf f, g, u, v;
+	int64_t eta;
+	int i;
+
+	STATS_INC(gf_inv);
+
+	/*
+	 * Same algorithm as gf_inv_safegcd(), but with the original
+	 * divsteps, for which 741 divsteps are enough for 256-bit inputs
+	 * (i.e. 12 batches of 62), and stopping as soon as g = 0.
+	 * Skipped batches would each multiply u by 2^62, which we apply
+	 * explicitly, so that the final correction factor is always
+	 * 1/2^744.
+	 */
+	f = GF_P;
+	gf_normalize(&g, y);
+	u = GF_ZERO;
+	v = GF_ONE;
+	eta = -1;
+	for (i = 0; i < 12; i ++) {
+		uint64_t t00, t01, t10, t11;
+		gf nf, ng, nu, nv;
+
+		if ((g.v0 | g.v1 | g.v2 | g.v3) == 0) {
+			break;
+		}
+		eta = divsteps_62_vartime(eta, f.v0, g.v0,
+			&t00, &t01, &t10, &t11);
+		s256_lin_div62(&nf, &f, &g, t00, t01);
+		s256_lin_div62(&ng, &f, &g, t10, t11);
+		gf_lin(&nu, &u, &v, t00, t01);
+		gf_lin(&nv, &u, &v, t10, t11);
+		f = nf;
+		g = ng;
+		u = nu;
+		v = nv;
+	}
+	for (; i < 12; i ++) {
+		gf_lin(&u, &u, &GF_ZERO, (uint64_t)1 << 62, 0);
+	}
+
+	/*
+	 * 1/y = sign(f)*u/2^744.
+	 */
+	gf_condneg(&u, &u, f.v3 >> 63);
+	gf_mul_inline(d, &u, &GF_INVT744);
+	return gf_iszero(d) ^ 1;
+}
+
+/*
+ * Legendre symbol computation, in variable time (same return values
+ * as gf_legendre()). This function MUST NOT be used on secret values.
+ */
+UNUSED
+static int64_t
+gf_legendre_vartime(const gf *y)
+{
+	gf f, g;
+	int64_t eta;
+	uint64_t jac;
+	int i;
+
+	STATS_INC(gf_legendre);
+
+	/*
+	 * We compute the Jacobi symbol (y|p) with "positive" divsteps
+	 * (f and g remain nonnegative), keeping track of the sign
+	 * changes in the low bit of jac:
+	 *  - Dividing g by 2 flips the sign if f = 3 or 5 mod 8.
+	 *  - Swapping f and g flips the sign if both are 3 mod 4
+	 *    (quadratic reciprocity).
+	 *  - Adding a multiple of f to g does not change the symbol.
+	 * The process ends when f = 1 (the symbol is then given by jac)
+	 * or g = 0 (with f != 1, which happens only if y = 0; the symbol
+	 * is then 0). Convergence is not guaranteed within a fixed number
+	 * of batches; in the very unlikely case where it has not been
+	 * reached after 25 batches, we fall back to gf_legendre().
+	 */
+	f = GF_P;
+	gf_normalize(&g, y);
+	eta = -1;
+	jac = 0;
+	for (i = 0; i < 25; i ++) {
+		uint64_t u, v, q, r, xf, xg, x, m, w;
+		unsigned zeros;
+		int j, limit;
+		gf nf, ng;
+
+		if (((f.v0 ^ 1) | f.v1 | f.v2 | f.v3) == 0) {
+			return 1 - (int64_t)((jac & 1) << 1);
+		}
+		if ((g.v0 | g.v1 | g.v2 | g.v3) == 0) {
+			return 0;
+		}
+
+		u = 1;
+		v = 0;
+		q = 0;
+		r = 1;
+		xf = f.v0;
+		xg = g.v0;
+		j = 62;
+		for (;;) {
+			zeros = CTZ64(xg | ((uint64_t)-1 << j));
+			xg >>= zeros;
+			u <<= zeros;
+			v <<= zeros;
+			eta -= (int64_t)zeros;
+			j -= (int)zeros;
+			jac ^= zeros & ((xf >> 1) ^ (xf >> 2));
+			if (j == 0) {
+				break;
+			}
+			if (eta < 0) {
+				eta = -eta;
+				jac ^= (xf & xg) >> 1;
+				x = xf;
+				xf = xg;
+				xg = x;
+				x = u;
+				u = q;
+				q = x;
+				x = v;
+				v = r;
+				r = x;
+			}
+			limit = ((int)eta + 1) > j ? j : ((int)eta + 1);
+			m = ((uint64_t)-1 >> (64 - limit)) & 15;
+			w = xf + (((xf + 1) & 4) << 1);
+			w = (-w * xg) & m;
+			xg += xf * w;
+			q += u * w;
+			r += v * w;
+		}
+		s256_lin_div62(&nf, &f, &g, u, v);
+		s256_lin_div62(&ng, &f, &g, q, r);
+		f = nf;
+		g = ng;
+	}
+	return gf_legendre(y);
+}
@@ -13,4 +13,16 @@ static const struct do255_int256_w64 GF_INVT508 = {
 	0x3ECCB22800EED6AE,
 	0x44F35C558E8FAC0B
 };
+static const struct do255_int256_w64 GF_INVT620 = {
+	0xB22800EED6AE3213,
+	0x5C558E8FAC0B3ECC,
+	0x2FDB832F8113C4F3,
+	0x100C6ECC3AD22DB8
+};
+static const struct do255_int256_w64 GF_INVT744 = {
+	0xFDB832F8113C3B2F,
+	0x00C6ECC3AD22DB82,
+	0xE67A5067FAB62949,
+	0x232F3D5FD39A28CA
+};
 #include "gf_w64.c"
@@ -13,4 +13,16 @@ static const struct do255_int256_w64 GF_INVT508 = {
 	0x940F23A06B74BE6E,
 	0x1C45852F33548365
 };
+static const struct do255_int256_w64 GF_INVT620 = {
+	0x23A06B74BE6ECB6E,
+	0x852F33548365940F,
+	0x8677210F3B0F1C45,
+	0x0A47F4D8108D544A
+};
+static const struct do255_int256_w64 GF_INVT744 = {
+	0x677210F3B0F1C29E,
+	0xA47F4D8108D544A8,
+	0xB0D1F00B1AD86FB0,
+	0x0E4EE4FF122FB11C
+};
 #include "gf_w64.c"
@@ -342,10 +342,10 @@ gf_mul_small(gf *d, const gf *a, uint32_t b)
 	}
 }
 
-/* d <- a*b  (always inlined) */
+/* d <- a*b  (always inlined, not counted in the statistics) */
 FORCE_INLINE
 static inline void
-gf_mul_inline(gf *d, const gf *a, const gf *b)
+gf_mul_core(gf *d, const gf *a, const gf *b)
 {
 	int i, j;
 	uint32_t e[16], f, g;
@@ -393,6 +393,15 @@ gf_mul_inline(gf *d, const gf *a, const gf *b)
 	(void)_addcarry_u32(cc, e[1], 0, &d->v[1]);
 }
 
+/* d <- a*b  (always inlined) */
+FORCE_INLINE
+static inline void
+gf_mul_inline(gf *d, const gf *a, const gf *b)
+{
+	STATS_INC(gf_mul);
+	gf_mul_core(d, a, b);
+}
+
 /* d <- a*b  (never inlined) */
 NO_INLINE UNUSED
 static void
@@ -407,7 +416,8 @@ static inline void
 gf_sqr_inline(gf *d, const gf *a)
 {
 	// TODO: optimize this
-	gf_mul_inline(d, a, a);
+	STATS_INC(gf_sqr);
+	gf_mul_core(d, a, a);
 }
 
 /* d <- a^2  (never inlined) */
@@ -714,6 +724,8 @@ gf_inv(gf *d, const gf *y)
 	uint32_t nega, negb;
 	int i, j;
 
+	STATS_INC(gf_inv);
+
 	/*
 	 * Extended binary GCD:
 	 *
@@ -996,6 +1008,8 @@ gf_legendre(const gf *y)
 	uint32_t nega;
 	int i, j;
 
+	STATS_INC(gf_legendre);
+
 	gf_normalize(&a, y);
 	b = GF_P;
 	ls = 0;
@@ -60,6 +60,7 @@ static const gf GF_P = {
 		(lo) = (uint64_t)umul64_tmp; \
 		(hi) = (uint64_t)(umul64_tmp >> 64); \
 	} while (0)
+#define CTZ64(x)   ((unsigned)__builtin_ctzll(x))
 #else
 #define UMUL64(lo, hi, x, y)   do { \
 		uint64_t umul64_hi; \
@@ -92,6 +93,11 @@ static const gf GF_P = {
 		(lo) = umul64_lo1; \
 		(hi) = umul64_hi1; \
 	} while (0)
+/*
+ * On CPUs without BMI1, TZCNT is decoded as BSF, which returns the
+ * same result for non-zero operands (CTZ64() is never called on zero).
+ */
+#define CTZ64(x)   ((unsigned)_tzcnt_u64(x))
 #endif
 
 /*
@@ -404,6 +410,8 @@ gf_mul_inline(gf *d, const gf *a, const gf *b)
 	unsigned long long lo, hi, lo2, hi2;
 	unsigned char cc;
 
+	STATS_INC(gf_mul);
+
 	UMUL64(e0, e1, a->v0, b->v0);
 	UMUL64(e2, e3, a->v1, b->v1);
 	UMUL64(e4, e5, a->v2, b->v2);
@@ -501,6 +509,8 @@ gf_sqr_inline(gf *d, const gf *a)
 	unsigned long long lo, hi;
 	unsigned char cc;
 
+	STATS_INC(gf_sqr);
+
 	UMUL64(e1, e2, a->v0, a->v1);
 	UMUL64(e3, e4, a->v0, a->v3);
 	UMUL64(e5, e6, a->v2, a->v3);
@@ -810,13 +820,12 @@ gf_lin(gf *d, const gf *u, const gf *v,
 }
 
 /*
- * Inversion in the field: d <- 1/y
- * If y = 0, then d is set to zero.
- * Returned value is 1 if the value was invertible, 0 otherwise.
+ * Inversion in the field with an optimized binary GCD. Same API as
+ * gf_inv().
  */
 UNUSED
 static uint64_t
-gf_inv(gf *d, const gf *y)
+gf_inv_bingcd(gf *d, const gf *y)
 {
 	gf a, b, u, v;
 	unsigned long long f0, f1, g0, g1, xa, xb, fg0, fg1;
@@ -950,9 +959,10 @@ gf_inv(gf *d, const gf *y)
 		 * We rely on the fact shifts don't reveal the shift count
 		 * through side channels. This would not have been true on
 		 * the Pentium IV, but it is true on all known x86 CPU that
-		 * have 64-bit support and implement the LZCNT opcode.
+		 * have 64-bit support. lzcnt64() uses LZCNT or BSR, which
+		 * are both constant-time.
 		 */
-		s = _lzcnt_u64(tnzm);
+		s = lzcnt64(tnzm);
 		sm = -(unsigned long long)(s >> 5);
 		tnza ^= sm & (tnza ^ ((tnza << 32) | (snza >> 32)));
 		tnzb ^= sm & (tnzb ^ ((tnzb << 32) | (snzb >> 32)));
@@ -1143,6 +1153,8 @@ gf_legendre(const gf *y)
 	unsigned long long nega;
 	int i, j;
 
+	STATS_INC(gf_legendre);
+
 	gf_normalize(&a, y);
 	b = GF_P;
 	ls = 0;
@@ -1196,9 +1208,10 @@ gf_legendre(const gf *y)
 		 * We rely on the fact shifts don't reveal the shift count
 		 * through side channels. This would not have been true on
 		 * the Pentium IV, but it is true on all known x86 CPU that
-		 * have 64-bit support and implement the LZCNT opcode.
+		 * have 64-bit support. lzcnt64() uses LZCNT or BSR, which
+		 * are both constant-time.
 		 */
-		s = _lzcnt_u64(tnzm);
+		s = lzcnt64(tnzm);
 		sm = -((unsigned long long)(31 - s) >> 63);
 		tnza ^= sm & (tnza ^ ((tnza << 32) | (snza >> 32)));
 		tnzb ^= sm & (tnzb ^ ((tnzb << 32) | (snzb >> 32)));
@@ -1339,6 +1352,26 @@ gf_legendre(const gf *y)
 		& (gf_iszero(y) - 1));
 }
 
+#include "gf_divsteps_w64.c"
+
+/*
+ * Inversion in the field: d <- 1/y
+ * If y = 0, then d is set to zero.
+ * Returned value is 1 if the value was invertible, 0 otherwise.
+ */
+UNUSED
+static uint64_t
+gf_inv(gf *d, const gf *y)
+{
+	STATS_INC(gf_inv);
+
+#if DO255_INV_SAFEGCD
+	return gf_inv_safegcd(d, y);
+#else
+	return gf_inv_bingcd(d, y);
+#endif
+}
+
 static unsigned long long
 dec64le(const uint8_t *buf)
 {
@@ -0,0 +1,2476 @@
+/*
+ * Precomputed windows of the generator for do255e_mulgen(),
+ * 32-bit limbs. Generated with: mkgtab 6 11 w32
+ * Do not edit.
+ */
+
+#define MULGEN_WIN      6
+#define MULGEN_CHUNKS   11
+#define MULGEN_XU       0
+
+static const do255e_point_affine window_G_comb[] = {
+	/* 1 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x00000002, 0x00000000, 0x00000000, 0x00000000,
+		            0x00000000, 0x00000000, 0x00000000, 0x00000000 }} },
+		{ .w32 = {{ 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+		            0x00000000, 0x00000000, 0x00000000, 0x00000000 }} }
+	},
+	/* 2 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x8E38AAE3, 0xE38E38E3, 0x38E38E38, 0x8E38E38E,
+		            0xE38E38E3, 0x38E38E38, 0x8E38E38E, 0x638E38E3 }} },
+		{ .w32 = {{ 0x55554932, 0x55555555, 0x55555555, 0x55555555,
+		            0x55555555, 0x55555555, 0x55555555, 0x15555555 }} }
+	},
+	/* 3 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x00000152, 0x00000000, 0x00000000, 0x00000000,
+		            0x00000000, 0x00000000, 0x00000000, 0x00000000 }} },
+		{ .w32 = {{ 0x3B139548, 0xB13B13B1, 0x13B13B13, 0x3B13B13B,
+		            0xB13B13B1, 0x13B13B13, 0x3B13B13B, 0x313B13B1 }} }
+	},
+	/* 4 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x7D1A36D1, 0xEA5E1BA0, 0x3CCEA916, 0xD0AF7707,
+		            0xF2D92037, 0xC68A748F, 0xA8DE7571, 0x43554439 }} },
+		{ .w32 = {{ 0xBC930B68, 0xA736E93C, 0x614EDC4A, 0x93CBC932,
+		            0xC4AA736E, 0x932614ED, 0x36E93CBC, 0x2EDC4AA7 }} }
+	},
+	/* 5 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x74D7D3CA, 0x9B7D88CD, 0x193896AC, 0x0E31B461,
+		            0xE97D44DB, 0x93464506, 0x1DCD9949, 0x0ABC8AC6 }} },
+		{ .w32 = {{ 0x6A3F5D77, 0xFB43801A, 0x9087618B, 0xEDA4968D,
+		            0x0D73F849, 0x10D79E3C, 0xFBBDE55B, 0x609CA158 }} }
+	},
+	/* 6 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x24DF12CF, 0x19348B57, 0x6232945A, 0xAB7572F6,
+		            0x2A63BF4B, 0xFFAA8904, 0x633EF2E2, 0x3024ED85 }} },
+		{ .w32 = {{ 0x28B85FAB, 0x262D3C74, 0x998A5A0A, 0x9DF21226,
+		            0xE92A27C8, 0xDFD986E1, 0x2417F9F7, 0x18BF7AAC }} }
+	},
+	/* 7 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x1F43C3D5, 0x33E38125, 0x71C6FE8F, 0x49BF0E2E,
+		            0x16BAEF18, 0x6AF69CC1, 0xD0C9585E, 0x36199FBA }} },
+		{ .w32 = {{ 0x63844C67, 0xC5EB6106, 0xD13F51E5, 0x6C2EEAF2,
+		            0xAAE3769B, 0xCB5992FC, 0x39CF7FD9, 0x7FE818CE }} }
+	},
+	/* 8 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xCDCBDFAE, 0xDDBCA65E, 0x47F38FBD, 0xD19C744A,
+		            0x5653455E, 0x15099FB5, 0x961EC01F, 0x1FD0DC2A }} },
+		{ .w32 = {{ 0x4678FCF8, 0x2636BC87, 0xB0F9793B, 0xDE73D7EE,
+		            0xA7C16795, 0xC255284A, 0x83360C10, 0x288B55D8 }} }
+	},
+	/* 9 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xCE799A9C, 0x8DF7F2C9, 0xAFDD04F9, 0x7AC7F7C3,
+		            0x7D833740, 0x915FE4A2, 0x986F29BA, 0x1ED67871 }} },
+		{ .w32 = {{ 0x05629316, 0xD6E6E093, 0xFB5B8D48, 0x1D5E089B,
+		            0x85BF6EDE, 0xB8383799, 0x1A7715FA, 0x121C666B }} }
+	},
+	/* 10 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x59A9387C, 0xE9449460, 0xA75287B8, 0x32BB0464,
+		            0x46C8845D, 0x122E571F, 0x26E0A481, 0x0D05AC01 }} },
+		{ .w32 = {{ 0x991D4D6D, 0xDE36F272, 0x1DFAA110, 0x92C23E53,
+		            0x3EE90EC0, 0x899F214F, 0x394C951B, 0x180EA77B }} }
+	},
+	/* 11 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x442E3709, 0x6562064C, 0x114A7267, 0xD013EB4D,
+		            0x16D5320A, 0x166892C7, 0x3B493396, 0x2824BCCA }} },
+		{ .w32 = {{ 0x305FD97F, 0x2A6BA408, 0x0CBF6105, 0x415DE48E,
+		            0x5997E569, 0x15DFB77A, 0xF248E03B, 0x5FB1441B }} }
+	},
+	/* 12 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x76FFE733, 0x4AE1AE28, 0xF9D28845, 0x55A43A11,
+		            0xE4990483, 0xBAACD8A3, 0x440F5C21, 0x37B39256 }} },
+		{ .w32 = {{ 0x67044399, 0x7C52E7E1, 0x4448BB7F, 0xA22EC245,
+		            0xB75DB379, 0x8E969231, 0x13905721, 0x69E0BCCB }} }
+	},
+	/* 13 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x68789634, 0x90DF6428, 0xCB72C6CA, 0x267A28B9,
+		            0x937625B5, 0x27BE4B2B, 0xA89B844F, 0x62003971 }} },
+		{ .w32 = {{ 0x96B6C914, 0x1A415F64, 0xAB6D9DDE, 0x4C075E6C,
+		            0xD2F02765, 0x14580231, 0xF602D282, 0x7B30E710 }} }
+	},
+	/* 14 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x05A821DA, 0xC76258B8, 0x24B5765F, 0xDC3C29F0,
+		            0x30897EED, 0xB646CAAD, 0xF8D35CB9, 0x46F594DE }} },
+		{ .w32 = {{ 0xAE85B546, 0x887A049B, 0x89BA55F1, 0xCA0DA94D,
+		            0xDB75F1EC, 0x9F29E217, 0xF61BBDC8, 0x4F657656 }} }
+	},
+	/* 15 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xC3DFB745, 0x496055CD, 0xF547B770, 0x0673F992,
+		            0x9B3E5BB3, 0x8EFAE8F9, 0xE12C07DD, 0x33C76A13 }} },
+		{ .w32 = {{ 0xD5795FBF, 0xFFFF5AE7, 0x295FF1B4, 0xF110C325,
+		            0x5B0E3BA9, 0x02A6E246, 0xF86CF306, 0x15D1E567 }} }
+	},
+	/* 16 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x44F243F9, 0xE1DAC536, 0xDFFD59A1, 0xE1154ECD,
+		            0x8B8C6649, 0x1731585F, 0x365D2CAF, 0x1BFB93F1 }} },
+		{ .w32 = {{ 0x4BCFB974, 0x1FED4DE5, 0x439A1A6F, 0x180F9066,
+		            0x928E3D92, 0xCD2B9882, 0x186CA10A, 0x7A367296 }} }
+	},
+	/* 17 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xC8DD950C, 0x36AC4B82, 0x581EBCA9, 0x3BC71A07,
+		            0x10E2FCD1, 0x94A66E36, 0x3E9BE9AF, 0x61DF242C }} },
+		{ .w32 = {{ 0x7952A73E, 0x311E26B2, 0xB34B45C9, 0xBC1A57F2,
+		            0x6E77843A, 0x501C19FA, 0x0A6F5A03, 0x362EA339 }} }
+	},
+	/* 18 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x33E65680, 0x58FE0FCC, 0xB6A75206, 0xE5DF31D5,
+		            0x0BB3A605, 0xFAA8CD75, 0xD11FC115, 0x7A9FCB91 }} },
+		{ .w32 = {{ 0x7CEA7DEC, 0x11723C0E, 0x64E7A605, 0xDB0AA9B9,
+		            0xA8862CFA, 0xDD85D26B, 0xB4BE264C, 0x545A0662 }} }
+	},
+	/* 19 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xD218B28D, 0xD1A17C18, 0x267A218D, 0x1F278C04,
+		            0x77FB76EF, 0xEE2FB422, 0x52EC12E8, 0x2724E395 }} },
+		{ .w32 = {{ 0x4AB1B937, 0x4790C283, 0x58330C02, 0x1473F27B,
+		            0xD1A9D810, 0x4299E0AD, 0x943C4548, 0x12315D13 }} }
+	},
+	/* 20 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x3325A165, 0xFE914C28, 0xBF570155, 0xADBEDB7D,
+		            0x68B7D502, 0xF08D8EA2, 0xF4FB5C67, 0x379524CC }} },
+		{ .w32 = {{ 0x71508134, 0xA2FAC642, 0x00709A31, 0x8410FB6A,
+		            0xE4EBDF04, 0x047EF953, 0x3566C177, 0x06148D0E }} }
+	},
+	/* 21 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x1638A7B6, 0x6DE07207, 0x026D3EBA, 0xB1732E9C,
+		            0xD870C351, 0xECA1B8D8, 0x8487A6DC, 0x04F7F112 }} },
+		{ .w32 = {{ 0xF6BAB833, 0xBE04EB1D, 0x23A5023B, 0x28FFAE80,
+		            0x102019C8, 0xC5A8B74F, 0x1A336214, 0x0A488019 }} }
+	},
+	/* 22 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x0BC169A7, 0x2E6CDAB0, 0x731EAF6B, 0xFE4D0A3B,
+		            0x99952E65, 0x232A6130, 0xAD43F67C, 0x787AE08E }} },
+		{ .w32 = {{ 0xA7ADB10E, 0xEFE9DD63, 0x6136B1AF, 0x605149B2,
+		            0x7583DBD9, 0x35230E74, 0x00A5611B, 0x1D933C29 }} }
+	},
+	/* 23 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x037CDF63, 0x44790D64, 0xBD49B1DB, 0x77425D46,
+		            0x5F3F72F6, 0x023EBF96, 0x25F97016, 0x317DF35C }} },
+		{ .w32 = {{ 0xE2B32D36, 0xA863A9F3, 0xDA7F1D1D, 0xE463BD30,
+		            0x439DC112, 0xB4EBE788, 0x0AAD6CD1, 0x21F07D18 }} }
+	},
+	/* 24 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x3E3D631A, 0x5DBD98E5, 0xC186014D, 0x19F7DA66,
+		            0x12573A91, 0xA9E14C44, 0xB80CF04D, 0x0D6ED875 }} },
+		{ .w32 = {{ 0xDCF702FB, 0xD1B532B3, 0x0D16EBAF, 0x74F98B2B,
+		            0x8E0BC1DA, 0xFC894D94, 0x499E069B, 0x3FC761C7 }} }
+	},
+	/* 25 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xC67DCB77, 0xD9ED2C90, 0x97BC9B74, 0x6DC21B67,
+		            0xFB3ECF5D, 0xEC586D5A, 0x2915A7D8, 0x17D20893 }} },
+		{ .w32 = {{ 0x1399E964, 0x8F6EF42E, 0x6BC33291, 0x984A3082,
+		            0xAFAB4A4A, 0x74FC9A76, 0x0ADF8257, 0x4BCEEA2F }} }
+	},
+	/* 26 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x83D7207E, 0x4432E073, 0x2E654E39, 0x60991BC4,
+		            0x6B5560ED, 0x2D843339, 0x95BCE47E, 0x2ABE2EAE }} },
+		{ .w32 = {{ 0xBCF336BB, 0xB52371E3, 0x7E2854E6, 0x93E18012,
+		            0xB7EB4DD2, 0xFE79C20F, 0x16A4DE27, 0x69686267 }} }
+	},
+	/* 27 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x8F49FE50, 0x49AFAF5A, 0x35321D90, 0x71543970,
+		            0x027A7D9C, 0xADAF6DED, 0xC0BC7A2C, 0x2B43669A }} },
+		{ .w32 = {{ 0xC2E9A701, 0x935EC8EA, 0x052ECE54, 0x63516865,
+		            0x8AAEFCFC, 0xC225E51F, 0x0D437C06, 0x5955BA15 }} }
+	},
+	/* 28 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x4BF56BC6, 0x66B9BE59, 0x28761516, 0x14C56942,
+		            0x9159FD2A, 0xD954A037, 0x96AA10B9, 0x28688C31 }} },
+		{ .w32 = {{ 0xE542E44A, 0xA470BE2F, 0x6A01E877, 0x6179FD41,
+		            0xED48FA91, 0x0ABAD4EE, 0x28C32C66, 0x3BB34EAE }} }
+	},
+	/* 29 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x77744B91, 0x1A37CFB7, 0xDE46B327, 0x574A3F8D,
+		            0xD5627E00, 0xB30DAB47, 0x638590EF, 0x319322FA }} },
+		{ .w32 = {{ 0xBCB5E486, 0x056CBF30, 0x9F5FA06A, 0x8F211E8F,
+		            0x12953978, 0x7014E596, 0x1DEC03CF, 0x5987B63E }} }
+	},
+	/* 30 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x7D28A15F, 0xDE3CD33B, 0x4EA24704, 0x44A2546F,
+		            0x66D41528, 0x99665C0D, 0x97D3A0C6, 0x5B27CDEE }} },
+		{ .w32 = {{ 0x5A16C686, 0x75D68BB7, 0xB5BC23B5, 0x7B2ED6ED,
+		            0x0A508CF0, 0x84D334AC, 0xD30CC79A, 0x58651F76 }} }
+	},
+	/* 31 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x2944BD3C, 0x673EEAA3, 0xD6F7D7E9, 0xE1045D7E,
+		            0x07E09114, 0x5C624159, 0x28291944, 0x7A2E7FC4 }} },
+		{ .w32 = {{ 0x8692350D, 0xFDD5AF5E, 0xC8A36AD7, 0xBB9A792B,
+		            0x6146D918, 0x74364C46, 0xEBA5F4D1, 0x19E57876 }} }
+	},
+	/* 32 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x6C0CFE02, 0x1A9F6E5B, 0x2E617851, 0x8CCA4CBE,
+		            0x7C2CE436, 0xBEB6E2A3, 0xAE4DFA94, 0x2DF834ED }} },
+		{ .w32 = {{ 0x2BB558E1, 0x92C00DD1, 0x14CAEBAD, 0xD7566ECC,
+		            0x3B9A6BEF, 0xDB137532, 0x1C795ACD, 0x3CB04191 }} }
+	},
+	/* 1 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x6FDFC6D6, 0xAD2E7574, 0xD510922E, 0x91B302C2,
+		            0xD72A0B1C, 0x20882911, 0x7AEF78E7, 0x7CC777F7 }} },
+		{ .w32 = {{ 0x4CAEE744, 0x9CA57239, 0x89B3BF3C, 0xCB3E50DC,
+		            0x051AD602, 0xDDC1EC26, 0xCD974CAB, 0x5773F884 }} }
+	},
+	/* 2 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xCB8A1BF5, 0x3A6FAA59, 0x8380E5F8, 0x2849D975,
+		            0x14647C7E, 0x72407142, 0xBBAC30B7, 0x73B88D1B }} },
+		{ .w32 = {{ 0xFC615C16, 0xA266248D, 0xFB455DB4, 0x33C01B53,
+		            0x7157C03D, 0x71B6BB80, 0xB2243F95, 0x195669B0 }} }
+	},
+	/* 3 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x80027889, 0xF73FBB37, 0xA60B0901, 0x3279FAA4,
+		            0x50332EA3, 0x7B3F8C40, 0x931A84EF, 0x2B5ED42D }} },
+		{ .w32 = {{ 0x7E81ADF0, 0xF35CC166, 0x91729A83, 0xB9E179AF,
+		            0x3033DC5A, 0xEF60B1A5, 0x4FF2EEBD, 0x458E008F }} }
+	},
+	/* 4 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x2F22D741, 0x35C78629, 0x793AAD7E, 0x3A7FD1C8,
+		            0xD1758212, 0x4FA78248, 0x0CD4E293, 0x6BD68302 }} },
+		{ .w32 = {{ 0xE78D923E, 0x2AAB7B09, 0xFF1BCC7D, 0x40DF88C0,
+		            0x9D57C0F4, 0x472C5155, 0xA51063A7, 0x6EB550F1 }} }
+	},
+	/* 5 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x1C01FA66, 0xD10D87A8, 0x4E0D7C85, 0xFE16CA31,
+		            0x0A9821AF, 0x6F4963EA, 0xD5B426C3, 0x092AAAAB }} },
+		{ .w32 = {{ 0xE36709E2, 0xC10C1CEE, 0x0270AEDF, 0x1E0A8720,
+		            0xC4438E47, 0xAE4CB558, 0x24E68ED9, 0x1917B0EC }} }
+	},
+	/* 6 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xDF08215B, 0x49706B14, 0x4B014D67, 0x9FF8559B,
+		            0xB0BC3F36, 0x9AAB9CFD, 0x1EADED6A, 0x0B1D4250 }} },
+		{ .w32 = {{ 0x4B6B03AE, 0x3AE95729, 0x78B0C534, 0xD6B3E60B,
+		            0x233523C1, 0xB2EA8BBC, 0x88941A7A, 0x13029E8C }} }
+	},
+	/* 7 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xDDA39B18, 0xFDB9185A, 0x6E449C79, 0xEE3C25F5,
+		            0xE82D06AB, 0x3A7BDCE2, 0xA0250721, 0x19D5E5B2 }} },
+		{ .w32 = {{ 0xA83F76D3, 0x9F73240C, 0x1178CEF9, 0x6B55970E,
+		            0xC35CA3DF, 0xB268E5FD, 0xF0A30EFB, 0x7E67EA44 }} }
+	},
+	/* 8 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x66D7A591, 0x17D9AE4A, 0xB24E489B, 0x5BBB3D31,
+		            0xC6FA63D9, 0x6365D652, 0x723588DC, 0x544DECEB }} },
+		{ .w32 = {{ 0xCC3A91F2, 0x5E9BA348, 0xC2A4587E, 0x47D451F1,
+		            0xD11A2034, 0x07DE3F5D, 0x4588C902, 0x47997AA7 }} }
+	},
+	/* 9 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x4869D126, 0x4E58666C, 0xC96281A7, 0xAEA5DE55,
+		            0xB5396AF8, 0x3F28A10D, 0xBB930E24, 0x764465DE }} },
+		{ .w32 = {{ 0x1990592E, 0x9E815D04, 0x599D90D7, 0x4D0D4E86,
+		            0xA6F56E6F, 0x8446F526, 0x67FBFFAB, 0x328BD1FE }} }
+	},
+	/* 10 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x006FA5B6, 0xBE587E72, 0xBD113B9D, 0xF3E3B8BF,
+		            0x7B7C688D, 0x859CCA20, 0xE5E7B062, 0x46A43E59 }} },
+		{ .w32 = {{ 0x01A91395, 0xC409C21E, 0x8A1175E0, 0xAB3C8C64,
+		            0xD85B026E, 0x98061549, 0x08FFE062, 0x2E3A9FCA }} }
+	},
+	/* 11 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xFCE4BB04, 0x75E0BDAF, 0x1F2C7F31, 0x5600C139,
+		            0x3C60580F, 0xC317C336, 0x356DDD31, 0x31FC668F }} },
+		{ .w32 = {{ 0x29EDB77D, 0x30B27283, 0xC7986854, 0x75690811,
+		            0xE7AB9E44, 0xC93C941E, 0xD26439CE, 0x7371B7C3 }} }
+	},
+	/* 12 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xBC7EF84F, 0x9B80903B, 0x07E51B22, 0xF329254F,
+		            0x52880B47, 0x7E8B8737, 0x66E30600, 0x31F186C9 }} },
+		{ .w32 = {{ 0xDF1BAB36, 0x30E6B2EC, 0x0138A83C, 0x3C967026,
+		            0xBC21C507, 0x69A7C63B, 0x410CB7EC, 0x2B9CC387 }} }
+	},
+	/* 13 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x05EB7351, 0xCD56E627, 0x0789A751, 0x3664E29C,
+		            0xF5D572C4, 0xAC3B8AE0, 0x9338BD87, 0x71372E4B }} },
+		{ .w32 = {{ 0x2B2B7856, 0x8989BC93, 0xE19D1031, 0x9420C652,
+		            0x04F49795, 0xAD3D7422, 0x25951A0E, 0x5484E3F0 }} }
+	},
+	/* 14 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xBE7E084D, 0x832C4043, 0x41B1C8D7, 0x303839C5,
+		            0xB28133DE, 0x59D50EAF, 0xAB36B26D, 0x4769A4C0 }} },
+		{ .w32 = {{ 0x4F605F98, 0x7FFF5AF5, 0x672CE22A, 0xCAFDA994,
+		            0xC6B499E0, 0x62BF9AD4, 0x5F6F787E, 0x0F68699C }} }
+	},
+	/* 15 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xDF381433, 0x47CF229A, 0x34FED9B0, 0x6E456FA4,
+		            0x43D8AE1E, 0x136B2FA5, 0x1BD9E5BD, 0x525E3191 }} },
+		{ .w32 = {{ 0xE4A92393, 0x7E77F996, 0x188E80E4, 0x7AE76D34,
+		            0xBFCB7720, 0x67B0D393, 0x148D7BAC, 0x47DFCFBC }} }
+	},
+	/* 16 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xD9E779FF, 0xF1DA1269, 0xC65BDBEB, 0x6CD70DE3,
+		            0xD6E9161B, 0xDF298F95, 0x50C9CE25, 0x56593DD1 }} },
+		{ .w32 = {{ 0xB2C4DDD7, 0x64D9880C, 0x8390D3A7, 0x572A3434,
+		            0xEC1D80E0, 0x9C80C8F1, 0xF5209440, 0x327CC88F }} }
+	},
+	/* 17 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x88C4F756, 0x6963F4E3, 0xD09CFCB7, 0x190BF02D,
+		            0xD45EA64F, 0xAEC8B5D5, 0x19D15E61, 0x73898C2E }} },
+		{ .w32 = {{ 0xA5A762DE, 0xF34F8D64, 0x72A6709F, 0xC56E76F7,
+		            0x61B67582, 0x992750DE, 0xAF1B7AC5, 0x200C70C9 }} }
+	},
+	/* 18 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x3ABB2AB6, 0xB472E07E, 0xDAF3737B, 0x2028BE23,
+		            0xCE4D9E9F, 0x4C364059, 0xA8718E37, 0x31D5D585 }} },
+		{ .w32 = {{ 0xCED63BB7, 0xEC46C4B6, 0x9DBFB281, 0xFBF55319,
+		            0x4224227B, 0x303F9D20, 0x80CAFDD7, 0x4FD4420D }} }
+	},
+	/* 19 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x1CC68A16, 0x3ECAC023, 0x98935A56, 0x21BF49E0,
+		            0x3696DEE7, 0xF4BDD5D5, 0x4C8390E8, 0x612AD7FA }} },
+		{ .w32 = {{ 0x05FE2B14, 0x124DDDEE, 0xDD35A450, 0xB01840F2,
+		            0x2413089F, 0x598AEED1, 0xCE7D360A, 0x024F95E9 }} }
+	},
+	/* 20 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x3834E668, 0xAAC31F9A, 0x7919D30E, 0x2EDFE6A5,
+		            0xEEA5A02C, 0x00D0CD6A, 0xFEB844C8, 0x0521EB72 }} },
+		{ .w32 = {{ 0xAEF6981C, 0xE3E18966, 0xD05F4258, 0xAF1AC574,
+		            0x7FD68165, 0xE37B1118, 0xE1679BC4, 0x32936021 }} }
+	},
+	/* 21 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x7366952D, 0x166F1DF1, 0x4F67A549, 0x952FF319,
+		            0x3D24E34B, 0x55D0846B, 0x51615B41, 0x3CE20DC9 }} },
+		{ .w32 = {{ 0x4EBCC3BB, 0x3631FD56, 0xD08FEE84, 0x143F7A73,
+		            0xCB390D3D, 0xF3D25A62, 0x9D1D4BC0, 0x0CCEE49B }} }
+	},
+	/* 22 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x75370C6D, 0x1DC5A1AC, 0x914D6845, 0xDD819043,
+		            0x6AAACB75, 0x69AFE063, 0x8C9F1957, 0x04342179 }} },
+		{ .w32 = {{ 0xB2F24E6E, 0x54A8CDDB, 0x293E6A5D, 0xEEA6C976,
+		            0x13C24D25, 0x1C5FA993, 0x343EE581, 0x49D4F694 }} }
+	},
+	/* 23 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x8FD0CC2F, 0x671B7A89, 0xC58B2980, 0x9F40CBF8,
+		            0x7D75BFF1, 0x3509BDDF, 0x51056B20, 0x7F6D95BE }} },
+		{ .w32 = {{ 0xD7490B6F, 0xBFBB33F0, 0xEA3E869C, 0xDD20CBD4,
+		            0x32A29B7F, 0x2FD0CCA0, 0x2375FEA9, 0x32053F35 }} }
+	},
+	/* 24 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x5BE3A6E9, 0xE2409123, 0x3C16DECC, 0x0D626FB7,
+		            0x8F9E0411, 0xB92C14A2, 0x08F32550, 0x5F7F4E46 }} },
+		{ .w32 = {{ 0xC092955D, 0xA2E0FC18, 0xCD3CFEF8, 0xB8B93696,
+		            0xC65D77AC, 0xF36EEFC9, 0xEC2D614B, 0x04525BDD }} }
+	},
+	/* 25 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x3DC20610, 0x76CF30CC, 0x491C666E, 0xC260A7FA,
+		            0x056F4727, 0xE3BB5B3B, 0xB793EABD, 0x3C47468D }} },
+		{ .w32 = {{ 0x08DF2D9D, 0xE9866DDA, 0xDEBE2D01, 0x36231EE9,
+		            0x0C7C4B43, 0xB8793B1B, 0xA522DAD4, 0x6B0D041E }} }
+	},
+	/* 26 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xC772603A, 0xA9EC6862, 0x8DD7DC8B, 0x0720D283,
+		            0xF041957E, 0xE1971DE3, 0x07AC7A18, 0x3A499766 }} },
+		{ .w32 = {{ 0x9E2D03E5, 0x60CF81D9, 0x8771C24D, 0x14F83454,
+		            0x15A264AA, 0x6D3D0812, 0x835F17E7, 0x3C54C05F }} }
+	},
+	/* 27 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xB44E767C, 0xB01FA1A2, 0x85793D56, 0x230EF87C,
+		            0x9E24EC75, 0xDFEE8E57, 0x0A31C9DE, 0x19FA9D71 }} },
+		{ .w32 = {{ 0x10C64ABE, 0x1D913FD9, 0x54165AA0, 0x0D441FA3,
+		            0xE122B217, 0xD19515B2, 0x8EBF14FF, 0x70563D3D }} }
+	},
+	/* 28 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xB2ADB93C, 0xBD979663, 0xF00AC710, 0x005659AA,
+		            0x643EF0BF, 0x996225CB, 0x31701330, 0x6FB209CA }} },
+		{ .w32 = {{ 0x00F148AF, 0xD4188478, 0x0FD32268, 0xCD602177,
+		            0xE004B6C9, 0xC4666F05, 0x8E43464B, 0x77F7DA08 }} }
+	},
+	/* 29 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x3FF7466A, 0x7265124F, 0xBBF20858, 0x2634C72C,
+		            0x8DDB16B0, 0x891A12A1, 0x0D58AA6D, 0x47B051DD }} },
+		{ .w32 = {{ 0x4F00D24B, 0xFF87F15A, 0x1A928D34, 0x66D308B3,
+		            0x1D0608A1, 0x835F0F27, 0x78762E02, 0x31909C84 }} }
+	},
+	/* 30 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xE1187D8E, 0x7F1243D9, 0x7D9F4A00, 0xA28A3218,
+		            0x660EFA93, 0xFAB99F46, 0x147A0ECC, 0x32A03C12 }} },
+		{ .w32 = {{ 0xB539D25A, 0x4CA421B8, 0x0193983E, 0x6E815A4C,
+		            0xD9EEA9B0, 0xBDB336CF, 0x11267957, 0x3E18087F }} }
+	},
+	/* 31 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xF032DC62, 0x7BC8CDEF, 0xEC59BEDD, 0xAFA8F3A5,
+		            0xB12E95B0, 0xDB9445CF, 0x50CA62CA, 0x1EC7F4E5 }} },
+		{ .w32 = {{ 0x5C445C40, 0x5709E27A, 0x1C544471, 0x53A36227,
+		            0x20FE4614, 0x730C1F66, 0xBAFCEE7D, 0x3ABC43EC }} }
+	},
+	/* 32 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xA8C23828, 0xE4808230, 0xA8FB3C77, 0xEDDE2FB9,
+		            0xE66AEF8B, 0x1AB8E3EA, 0x87849F96, 0x6D405A8F }} },
+		{ .w32 = {{ 0xFEAF80EC, 0xEE4D8A22, 0x40DC20A8, 0x6B5A757B,
+		            0x3AD0524A, 0x55310AF7, 0xA89184B3, 0x6960ED27 }} }
+	},
+	/* 1 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x10A8C8A9, 0x2EC20FF7, 0x82F261E7, 0x46DB106F,
+		            0x8A00FC57, 0x0C424CEA, 0x6633FDF4, 0x0578234B }} },
+		{ .w32 = {{ 0x93F73D3A, 0x2B3D150B, 0x462A5BC3, 0x3E76910A,
+		            0x51174334, 0x90EFC04F, 0x2D1F2052, 0x013C1EAE }} }
+	},
+	/* 2 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xB81D3C2B, 0xABCA14D6, 0xF44D3FD8, 0x13B7E036,
+		            0xEF3BE100, 0xF813F3F9, 0x4BAFB0B8, 0x0AACE382 }} },
+		{ .w32 = {{ 0xC100E6E0, 0xB083C2A9, 0x69926D58, 0xD8FFB88E,
+		            0x8B621E7B, 0xB041ACD4, 0x880452D5, 0x1925562D }} }
+	},
+	/* 3 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xF187D090, 0x805A53CF, 0x4EC02E02, 0xA3CA7309,
+		            0x42594D78, 0xBE59F722, 0x8F574384, 0x5B85105E }} },
+		{ .w32 = {{ 0x3EDC5EA2, 0xEB903EA2, 0x7CB316EF, 0xCEA69CE5,
+		            0x5C4EFFF2, 0xA0958AE7, 0xF566CE2D, 0x52BEEC10 }} }
+	},
+	/* 4 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x50CF1966, 0x41E25D40, 0xF699D420, 0x74883C07,
+		            0x30E1275B, 0x9A932B36, 0xA63C438D, 0x06E8850D }} },
+		{ .w32 = {{ 0x68ADBEB8, 0x9B7D6F6B, 0xF3A0BC7C, 0xD20EF1CA,
+		            0x511795C8, 0x47CF226C, 0xA832E116, 0x72EBC7D9 }} }
+	},
+	/* 5 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x31348D33, 0xB760FD9C, 0xD65E9022, 0x7FDEA3A5,
+		            0xEC60B05A, 0x1CB85B85, 0xC24AB5B6, 0x6CA7AE18 }} },
+		{ .w32 = {{ 0x45A392A1, 0x89C593B1, 0x8D57FAAA, 0xAC45980A,
+		            0x013A2484, 0x03473091, 0x1B51532C, 0x69D2C88E }} }
+	},
+	/* 6 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x80A5BFE2, 0x1D902190, 0xF4487833, 0xF2B4AD46,
+		            0xEC632986, 0xE75ECC7E, 0x79E3E909, 0x0075F0B5 }} },
+		{ .w32 = {{ 0x6D436E1F, 0x803CB65F, 0x8705EE63, 0x7446DA56,
+		            0x86AA7FE8, 0xF6D7D322, 0x2CD1A203, 0x35F35573 }} }
+	},
+	/* 7 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x50F91CD5, 0x1A017FA1, 0x9DAB2383, 0x4646863D,
+		            0x0B699A04, 0x79CEE6F5, 0xB7AF3208, 0x156CB2E4 }} },
+		{ .w32 = {{ 0x54CF2472, 0xBF3A4AA3, 0xEBB42873, 0x171281F9,
+		            0xECEE7835, 0x5C0BCF29, 0xD50D3508, 0x0006EF1F }} }
+	},
+	/* 8 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x80D2036F, 0x84D2285F, 0x9D897D88, 0x6AE4025E,
+		            0x2B2AE0D1, 0x9B01FF6A, 0x8619372C, 0x2CF67A73 }} },
+		{ .w32 = {{ 0x9E6DDB2A, 0x498CB525, 0x1B5B34BC, 0x16688EDF,
+		            0xFA3BF79A, 0x6EA2C823, 0x7FFF5C0E, 0x16D0E5F3 }} }
+	},
+	/* 9 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x2DC03BB0, 0xE8685439, 0x7629CCB2, 0x94668036,
+		            0x1E32FCA1, 0xEF492DD6, 0x5C66B0A3, 0x3EDC214F }} },
+		{ .w32 = {{ 0x36836FDD, 0x24BCAFAF, 0xE3C7A8FF, 0xEA95B41C,
+		            0x17468462, 0x7136F21C, 0xBFA7675C, 0x4F882189 }} }
+	},
+	/* 10 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xCA8A3822, 0xEEC87375, 0xE3A3BC48, 0x60C55961,
+		            0xCB738C9A, 0x5C5470CD, 0x1AF005AB, 0x37437A63 }} },
+		{ .w32 = {{ 0xE3B8CAB5, 0x0288091B, 0xF9AE440C, 0x6AA2F9C8,
+		            0x47040F8A, 0x8E482E97, 0x3F78E12C, 0x75C80120 }} }
+	},
+	/* 11 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xEC03C046, 0xB039CA78, 0x51372585, 0x97112503,
+		            0xEA279415, 0xB9D3212F, 0x62A381B7, 0x2374147A }} },
+		{ .w32 = {{ 0xA118B215, 0x89498DB7, 0x8181ACF3, 0x3D177D43,
+		            0xAFD5CA34, 0x7EB7A1A3, 0x3DAE8D9E, 0x20A91FD9 }} }
+	},
+	/* 12 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x5FDE1E8A, 0xFE913EEE, 0x38B248FD, 0xD108C03E,
+		            0x1846BD35, 0x82A4046E, 0x6A619B2A, 0x47DAB44F }} },
+		{ .w32 = {{ 0x1D094199, 0x783CB1D6, 0x6429732F, 0xE8A6FCAF,
+		            0xDE8F7DE9, 0x7B87D94C, 0x9174ADBF, 0x2E10689B }} }
+	},
+	/* 13 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x0DC055DF, 0x2A2EBA6C, 0x0C4A4EDD, 0x3954AE90,
+		            0x214439F3, 0x4FE3A7E4, 0xFBBAF8C4, 0x53EE8624 }} },
+		{ .w32 = {{ 0x791C1791, 0x44F2591C, 0x7FB3C809, 0x2F873640,
+		            0xA052C02E, 0x0D8353A8, 0x04D99084, 0x1355E1A2 }} }
+	},
+	/* 14 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x7885699B, 0x087FB429, 0xE0DBF5B2, 0xF91EEC55,
+		            0x92C94D75, 0x115B40C4, 0x7FF49C2C, 0x71A4F2F0 }} },
+		{ .w32 = {{ 0x17016775, 0x6F7BAA60, 0x35B1410F, 0x0A5D4B65,
+		            0xEF2EC32D, 0x03C88398, 0x6244F54C, 0x1D88D5BE }} }
+	},
+	/* 15 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x327A8871, 0x06FE8D1C, 0x03567A24, 0x87F6A514,
+		            0xE2E90624, 0x4AB75BC9, 0xF23629AD, 0x1C1C2469 }} },
+		{ .w32 = {{ 0x67C00E3D, 0x94755F1F, 0x04FBFD08, 0x2FAF0356,
+		            0xB7615993, 0x71597C6D, 0xE9EDFF0D, 0x1DA948DD }} }
+	},
+	/* 16 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xAB837080, 0x409080C5, 0xB6245419, 0x04D8F9BE,
+		            0x6B4C644F, 0xE5506A44, 0x8976566A, 0x623B4C70 }} },
+		{ .w32 = {{ 0x62D6EC9E, 0xDB393986, 0x17BD3F07, 0xAAD653EB,
+		            0x25D20D65, 0xB026A509, 0x1084AFB8, 0x6242101A }} }
+	},
+	/* 17 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x2C6E4296, 0xD6FC0BEC, 0x46606630, 0x46B46218,
+		            0x78A3A116, 0x281CFEE2, 0xFFFF677B, 0x4A56A10F }} },
+		{ .w32 = {{ 0xAD9740CE, 0xA6FDA96A, 0xC3A19EFB, 0xEA7BA39A,
+		            0x7934877C, 0x3651F8CF, 0x1D668F50, 0x73F73E2B }} }
+	},
+	/* 18 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xE4F4BA98, 0x498985EE, 0xF921FF17, 0xC6D58DBA,
+		            0xBBDF6E4B, 0xF1FB25A1, 0xB1B13925, 0x75DC9DD6 }} },
+		{ .w32 = {{ 0x8B923C9C, 0xEA0F01F1, 0x2C03A3B7, 0xEF52A7CC,
+		            0x78982EF8, 0xA02361E1, 0x5792DE7F, 0x4441BB17 }} }
+	},
+	/* 19 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xEB8A0565, 0xA83FF4AF, 0x891CF533, 0xC5C66A2D,
+		            0xD6A47981, 0x371EBFBE, 0x8C7AD948, 0x4A0D4E62 }} },
+		{ .w32 = {{ 0xE7DDCB22, 0x4826D605, 0xF847FE7A, 0x4401A797,
+		            0x0446BD5E, 0xC6E3B452, 0x473EEBDB, 0x2A539E09 }} }
+	},
+	/* 20 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x1C80736F, 0x810A3D50, 0x9A8C4009, 0x5D87F907,
+		            0xF8B6243B, 0x0AB6FDE5, 0xC6F5B24C, 0x166CBA68 }} },
+		{ .w32 = {{ 0xCF21CAEE, 0xE171D68B, 0x0992EAD8, 0x3FD45649,
+		            0x5C81FB9C, 0xB424163F, 0x17B036CB, 0x73A08B04 }} }
+	},
+	/* 21 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xBD85F9B9, 0x18C0D138, 0xD7FF3742, 0x1A3054DE,
+		            0xBB6DCFF3, 0x8C759793, 0x6467D47E, 0x6558C5EC }} },
+		{ .w32 = {{ 0xBAE3CC0F, 0xDEC410B7, 0xEA9299FB, 0xAB1B4605,
+		            0xE12322DC, 0x2C239CB2, 0xC91248DC, 0x5DEBC426 }} }
+	},
+	/* 22 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x52256D8F, 0x79D1CD3D, 0xFD00AE7E, 0x26F1682A,
+		            0x9DDB8EFA, 0xF5014838, 0x05B88A32, 0x27BB277F }} },
+		{ .w32 = {{ 0x24DD0DEA, 0xFC896E9A, 0xA8688814, 0x4423AAA3,
+		            0x42830F0D, 0x6F7A965A, 0xD51DE7F9, 0x1596BA28 }} }
+	},
+	/* 23 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x78A3A696, 0xB3E63EA0, 0x52E77177, 0x0A2915CB,
+		            0x5C8C5CD7, 0x327FBB06, 0x35D9FA65, 0x72F8809D }} },
+		{ .w32 = {{ 0x65960BB7, 0xF907AE33, 0x523A651C, 0x71FDB90F,
+		            0x2E9D7E4D, 0xC33FB480, 0x2A84779E, 0x54A25A47 }} }
+	},
+	/* 24 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xDB5B798F, 0x0B07198C, 0x94543EE5, 0x777D3F60,
+		            0xA4ADFA37, 0xA73EBDB9, 0x5D4E25DD, 0x3147EA51 }} },
+		{ .w32 = {{ 0x9923047D, 0x573DB324, 0x5678DE15, 0x3AFD2B47,
+		            0x319EF0FE, 0x681DC822, 0xE43CEB4B, 0x156F4568 }} }
+	},
+	/* 25 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xE24F4FAD, 0x6E528DD9, 0xBE4A9D14, 0xAF40024A,
+		            0x19C65687, 0xB7431BA7, 0x1B5F8664, 0x081407B7 }} },
+		{ .w32 = {{ 0x6E75AE9C, 0x4A511C5A, 0xD7E1CFD1, 0xE75EE6BF,
+		            0xF849A1DE, 0x723C145F, 0x654C2A83, 0x25E1AC04 }} }
+	},
+	/* 26 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xACD2B678, 0xA3335C85, 0x3EB7E118, 0x56BDEFAA,
+		            0x421E455A, 0x3BCCA605, 0xDE7D9F16, 0x05ABC15E }} },
+		{ .w32 = {{ 0xC051E7AA, 0x92D1AF15, 0x3DBDA00A, 0x7C2790AE,
+		            0x8363E0FE, 0xE8D52456, 0x9D1168E8, 0x4BD5767A }} }
+	},
+	/* 27 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x45F7290E, 0x567D9900, 0xC27DF12A, 0xF4479356,
+		            0x437F345F, 0xE896D3D1, 0x782EC652, 0x25E71D44 }} },
+		{ .w32 = {{ 0xDC98DA18, 0xB3BE3E28, 0x85A5F6EE, 0xBDE139DE,
+		            0xA112AA38, 0x51DD92E0, 0xB3294161, 0x40611B8B }} }
+	},
+	/* 28 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xA2020136, 0x481853F6, 0xD071EC89, 0x30C1974F,
+		            0xF675482C, 0x3D1CF034, 0xE9DC65A9, 0x75CB0EA9 }} },
+		{ .w32 = {{ 0x00E39C36, 0x796DE712, 0x12CDE2D1, 0xB3A7B356,
+		            0x1AAE6D86, 0xE717C8BF, 0x5FD34817, 0x02CB9E63 }} }
+	},
+	/* 29 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x0E76622F, 0xC2CB8C6C, 0xAA0406FF, 0xBB18EFC7,
+		            0x2998505A, 0x9088A5F4, 0xE7C6B877, 0x55AE871E }} },
+		{ .w32 = {{ 0x2AB33E27, 0xD8E7EB1B, 0x1EDE429B, 0xB17C3EAA,
+		            0x0A0C7311, 0xB4248B71, 0x8DC52D8F, 0x560F8872 }} }
+	},
+	/* 30 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xA16836B8, 0xCDFBE6A8, 0xD1B2EAEB, 0xFD0AFF45,
+		            0x8A928467, 0x7ABCFD20, 0x8B83EFB9, 0x3D19BD71 }} },
+		{ .w32 = {{ 0x37A7EFD3, 0x10D705EA, 0xCD29B417, 0x6E9463AF,
+		            0xCA756EC3, 0x4DC62D72, 0xBAEFCE0C, 0x75E964D5 }} }
+	},
+	/* 31 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x15801357, 0xFE3F8948, 0xEC51F89F, 0x6D699F37,
+		            0x945A23B9, 0xE24031C7, 0x535A7A4C, 0x5F8841DB }} },
+		{ .w32 = {{ 0xC0E5A9A9, 0x2738428A, 0x4D3565BC, 0x2E9E655C,
+		            0x4E210711, 0xC84DE6F4, 0x29D7D468, 0x4816A694 }} }
+	},
+	/* 32 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xDB48704B, 0x7BF56791, 0xB57BB680, 0x9AD892B8,
+		            0x312F7297, 0xA02D40A2, 0xF19552AD, 0x6A651D1E }} },
+		{ .w32 = {{ 0xA0BF5351, 0x9606E358, 0x4C2D2225, 0xA8EB85AF,
+		            0x22FC7E15, 0xC462B5A2, 0x47A66A6B, 0x46222D8E }} }
+	},
+	/* 1 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xAEADD7D6, 0xC4897D95, 0xC50B1F78, 0x6F8C7795,
+		            0xADCE1A1B, 0x0D11F6A3, 0x0CE18C47, 0x3299316A }} },
+		{ .w32 = {{ 0xE4FC4CDB, 0x3A1F72F3, 0x10934633, 0xBF7AE6FE,
+		            0x5DADE1C4, 0x41042830, 0xDEC2FB5A, 0x6A837191 }} }
+	},
+	/* 2 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xFCE708E7, 0xFC13EC10, 0xB15F4DC1, 0xC69A5DBA,
+		            0x85032111, 0xD042B063, 0x420AA88E, 0x68B7DCDE }} },
+		{ .w32 = {{ 0x2AE15985, 0x7040F896, 0xE37A5022, 0x13F402E4,
+		            0x71A7DC30, 0x51817F85, 0xF976C781, 0x7875D00B }} }
+	},
+	/* 3 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x4A1D8A84, 0xC7B4836D, 0x498E8C71, 0x7CED6C84,
+		            0x3BEC27B1, 0x6717034E, 0xB8234111, 0x31FDD05D }} },
+		{ .w32 = {{ 0xC72F5173, 0x47B18ECC, 0xCE56D88F, 0xECCB17C7,
+		            0xD1DCEE88, 0xA28675E8, 0xEFA50EE8, 0x278B7C47 }} }
+	},
+	/* 4 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x877C7B89, 0x9C333CBB, 0x7493D54C, 0xE7CDEB85,
+		            0xD43864A0, 0x24FC315D, 0xE37C2A33, 0x7EB0F1B1 }} },
+		{ .w32 = {{ 0x598FE161, 0x513517CE, 0x8A69E8A3, 0x9337CDF5,
+		            0x3CECBCE7, 0x621E1A3A, 0xA17317EA, 0x19067810 }} }
+	},
+	/* 5 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xD260160A, 0xEDF9C29E, 0x8816CEF0, 0x87519673,
+		            0x832E7196, 0x9CD6F958, 0x78610EB2, 0x2E7112A9 }} },
+		{ .w32 = {{ 0xFE7CF14C, 0x76C82B5F, 0x444F2141, 0xE157EF01,
+		            0x82DD90FC, 0x4B13FD30, 0x2DED5790, 0x34AC54BD }} }
+	},
+	/* 6 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x35184B16, 0x61D58FF6, 0x3C8BCBA6, 0xD233D91B,
+		            0x86EFB59F, 0x5CFC3040, 0x524DA9ED, 0x058407D6 }} },
+		{ .w32 = {{ 0xE1E5D94A, 0x496C836F, 0xB7C5BE11, 0x77AF5217,
+		            0x2E6AE66E, 0x5FAB4005, 0x937980D2, 0x54238838 }} }
+	},
+	/* 7 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xE3F023A4, 0x802F63A6, 0x43B3060A, 0x130D5B20,
+		            0xDDC6BF2E, 0x3005C8F1, 0x896DAF1E, 0x1CC35AA4 }} },
+		{ .w32 = {{ 0x79F5C8EC, 0x75A61051, 0x0B6FCCFF, 0x25EB13B8,
+		            0xAA79C831, 0xAD124870, 0x738F40F4, 0x69F282E4 }} }
+	},
+	/* 8 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x7334761D, 0x9C74297A, 0x7500194C, 0xC6F73399,
+		            0x0CA3D16A, 0x7979DD4E, 0xAF215C05, 0x0EFDCF42 }} },
+		{ .w32 = {{ 0xD4B799B5, 0xFA6356E9, 0x01D66363, 0x0D88AD48,
+		            0x11708BDB, 0x30BCB86D, 0x2542890D, 0x759601B5 }} }
+	},
+	/* 9 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x16B107FB, 0x17A43CB5, 0xBBE2A3AC, 0x8BA954F2,
+		            0x03F71E2D, 0xC9013ACA, 0xBBEFE25C, 0x0A2F0CCC }} },
+		{ .w32 = {{ 0xBC10888C, 0x14CA4801, 0x7CF97E84, 0xDFF833C6,
+		            0xA2624C8B, 0x43CC487A, 0x805266CE, 0x1A923153 }} }
+	},
+	/* 10 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x2C259661, 0xAC5341D5, 0xD73D2F44, 0x51593BEB,
+		            0xCC86D107, 0x74635605, 0xB43B0ADD, 0x0952054B }} },
+		{ .w32 = {{ 0x29E2E058, 0x88920312, 0xE97D6CA3, 0xFDF9AE88,
+		            0xFDE5733B, 0x5F017420, 0xC167498E, 0x695AAA5F }} }
+	},
+	/* 11 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xBB18DB7C, 0x54A97AA8, 0xEBF91C2D, 0x4A4A9B55,
+		            0x9B4796F6, 0xE9FFA94A, 0xA0226BBE, 0x4812B48C }} },
+		{ .w32 = {{ 0xF17D887A, 0x9DA033D7, 0xE739F457, 0x0F500FD9,
+		            0xC64C6A61, 0xB2763869, 0xA1CF112C, 0x73F4F7BB }} }
+	},
+	/* 12 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x73BC197B, 0x47DDA3DE, 0x855CB0F2, 0x0BF37E8F,
+		            0x6DB508CD, 0xF3E9D579, 0x6C9007B7, 0x7CF92299 }} },
+		{ .w32 = {{ 0xB53043E5, 0xE5910204, 0x82B22B6F, 0x07B6B9B0,
+		            0x68502503, 0xD4CE4C05, 0x79091AD6, 0x6A035A2B }} }
+	},
+	/* 13 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xC36466B0, 0xA401326A, 0x261A5E62, 0xD1033824,
+		            0xC706631E, 0x9B57DBB9, 0xD965C64E, 0x729D45B8 }} },
+		{ .w32 = {{ 0xD81B970F, 0x5686F19D, 0x6CE20706, 0x542B5043,
+		            0x932B760C, 0x2743D746, 0x74F66F2C, 0x60F56A60 }} }
+	},
+	/* 14 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x2DB7998F, 0xFF354857, 0x38535149, 0x24D94676,
+		            0x8FE35BF1, 0xDC1E47D8, 0x05E2F6CA, 0x1A579B4C }} },
+		{ .w32 = {{ 0xEE31C6DD, 0xEA1EA677, 0x084A9752, 0x05F116A0,
+		            0x4400E885, 0xEB0A43F5, 0xF9802A68, 0x1C1CA324 }} }
+	},
+	/* 15 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x12E30069, 0x10AF001C, 0x045D63E6, 0x01752EC2,
+		            0x6784DF91, 0x08F67B81, 0x763D6AA2, 0x04FC1CBA }} },
+		{ .w32 = {{ 0xEA4BC28D, 0x02B959CC, 0x8EFA25E0, 0xB375673A,
+		            0x6833CF72, 0xD1CFB977, 0x33889DD5, 0x64B24EB1 }} }
+	},
+	/* 16 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x7A0FAC96, 0x865CDB90, 0x16F2DEED, 0xD9E78DF7,
+		            0xA56A953B, 0xC64C2839, 0x24E51486, 0x117C9F29 }} },
+		{ .w32 = {{ 0x6C0F4F31, 0xBE583057, 0x3B757CD1, 0xC1D079F1,
+		            0x99DA8AE7, 0xA274287A, 0xDC28E398, 0x5FE257C8 }} }
+	},
+	/* 17 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xF58E4AF1, 0x8E12905B, 0xC4C4D355, 0x9A162B86,
+		            0x7DF25FCC, 0x258CCC38, 0xD22272BB, 0x19B7F43F }} },
+		{ .w32 = {{ 0x0B293F66, 0x9CFCDD08, 0x1B4CAF19, 0xDA724693,
+		            0xFB2F014B, 0xA422E804, 0xC79775D6, 0x245DEE6B }} }
+	},
+	/* 18 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xA026AC27, 0x83DB50F8, 0x77FC121B, 0xC52A0CF3,
+		            0x4A2FBD26, 0xCF76B0B3, 0x3455B545, 0x41C65878 }} },
+		{ .w32 = {{ 0x1B19518F, 0x344424B0, 0x96AE24A6, 0x71258689,
+		            0xC7E72517, 0x83231C83, 0xE7BFACB4, 0x7E38DE50 }} }
+	},
+	/* 19 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x5B3AA027, 0x779FDE31, 0xF36E175D, 0x726DC5DA,
+		            0xB1FABF93, 0x1EEE3D63, 0xEDC812C7, 0x2296EC84 }} },
+		{ .w32 = {{ 0x0001C31E, 0x59D4B003, 0xD5751BBB, 0xF444118F,
+		            0x13041EF8, 0xD7830E6C, 0x76B6B6FD, 0x3714C1DF }} }
+	},
+	/* 20 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x1F5A3AFE, 0x9411BDBE, 0x55A80175, 0xBE7F2D24,
+		            0xD3D5E509, 0x41938CFA, 0x066F3B13, 0x3152CAE2 }} },
+		{ .w32 = {{ 0xCFC55B6B, 0x4127C3A9, 0x5BC5B357, 0xD4D6AD16,
+		            0xD3520270, 0xEEB08F8D, 0x44A0178B, 0x67EA40BE }} }
+	},
+	/* 21 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xC1B205C8, 0x9766F8FC, 0xAD7992E0, 0x46366BC0,
+		            0xD201E450, 0xA6440A72, 0x08D8D920, 0x1CBDB4F5 }} },
+		{ .w32 = {{ 0xB07778C8, 0x967B41BC, 0xB3B312A5, 0x8F1317CB,
+		            0xD21FCACB, 0xCB96EDBE, 0xC1599377, 0x40C32189 }} }
+	},
+	/* 22 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xD1A399A6, 0x4D4A16A2, 0xCD8A9070, 0xDB029D61,
+		            0xF1560418, 0x5D9E51F7, 0xFBB266A5, 0x04C5D81D }} },
+		{ .w32 = {{ 0x48E48E19, 0xEF9B5C23, 0x723D4A14, 0x0955EF66,
+		            0xE2C6F0D5, 0x9F517374, 0x04944C85, 0x172FDD05 }} }
+	},
+	/* 23 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xB78B1827, 0x1BF2E4B2, 0xD9B97830, 0xF651C26D,
+		            0xE1BA2B7B, 0x4FED5EAC, 0xE9033C74, 0x4071FA57 }} },
+		{ .w32 = {{ 0x2AA2626C, 0x07D7E604, 0x5CA88E5C, 0xA2D1A70D,
+		            0x93EB4D5D, 0x4E39C3C4, 0xCEE00BAD, 0x3789ADD1 }} }
+	},
+	/* 24 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xD14FE2DB, 0x63DCFBAB, 0xAF4A0DA7, 0xDDD73639,
+		            0x607471BF, 0x31584BA1, 0xE39EF186, 0x7A4665C8 }} },
+		{ .w32 = {{ 0xAEC82907, 0x9C547011, 0x11BFE20A, 0xCBD7E58F,
+		            0x353E7189, 0x38894914, 0xFBF8591B, 0x5480BAD9 }} }
+	},
+	/* 25 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x249852E1, 0x4DEA6678, 0x867C888B, 0x2A208DF5,
+		            0x0CE5E076, 0x06BEC56B, 0x9289B17E, 0x2947EEFF }} },
+		{ .w32 = {{ 0xA5B71988, 0xB0125773, 0x36555B20, 0xA27E8AAE,
+		            0x8A89549D, 0x8E655AE3, 0x639CC3CB, 0x69BB6092 }} }
+	},
+	/* 26 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x6516AF55, 0x2512E301, 0x52859990, 0xFE708206,
+		            0xFDD31006, 0xAA146B48, 0xBA1E0E06, 0x5108CC15 }} },
+		{ .w32 = {{ 0x6B80EE4B, 0x3F904A9E, 0x4FCDD737, 0x77BEE02B,
+		            0x461A6073, 0x63E8415C, 0xB30E9B89, 0x1640B086 }} }
+	},
+	/* 27 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xDCC5B721, 0xEA15FEC1, 0x5BD777D8, 0x1F3BF68F,
+		            0x4FB24724, 0x28404087, 0xB02B6867, 0x539F92CE }} },
+		{ .w32 = {{ 0xE59B722B, 0x9FF5ADF2, 0xF937AC0E, 0x62464336,
+		            0xDE74D04C, 0x6851F316, 0xF918F0B1, 0x15306432 }} }
+	},
+	/* 28 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x046163E1, 0x52C405EC, 0x0084CB78, 0x55E8AE05,
+		            0x1086C7E4, 0x5FD14649, 0x6CBDE94C, 0x392145BE }} },
+		{ .w32 = {{ 0xB2116E50, 0x88421BE2, 0xA54E350B, 0x07A3BEFE,
+		            0xF2C6815C, 0xC775CF00, 0x288AFBF8, 0x7742F42F }} }
+	},
+	/* 29 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x3201CE3D, 0x05E84ED9, 0xF1E3647C, 0xFADCAE1C,
+		            0x7621FB9C, 0xE8C97723, 0x1B4FE05A, 0x2FBDEEF8 }} },
+		{ .w32 = {{ 0x5E1C7700, 0x16DBBB78, 0x2DD6035D, 0xCFDCF51B,
+		            0x944AB6B6, 0xEA70A00B, 0x3BA536F4, 0x43CDE474 }} }
+	},
+	/* 30 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x58DEF9FB, 0x53EEC7E9, 0x128F4384, 0xCA4E3FB7,
+		            0xB384E2D7, 0x39498177, 0x2A8F7AAB, 0x44212BBE }} },
+		{ .w32 = {{ 0x63897047, 0xF1538D2A, 0x26BDD16A, 0x373A087C,
+		            0xBFBABDF7, 0x9E234673, 0x64CAAA7C, 0x1F988914 }} }
+	},
+	/* 31 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x5BA05BCB, 0x1DD42E5C, 0xAE0744E7, 0x933FCC6E,
+		            0x4DC9055C, 0x4EF30D85, 0x29BD02B2, 0x642D8E86 }} },
+		{ .w32 = {{ 0x7C6161FA, 0x7F641957, 0x3E3CF1AB, 0x4F8F8BE2,
+		            0xC104CE5B, 0x9C8ABCDE, 0x6F5DD8D2, 0x787BCBE5 }} }
+	},
+	/* 32 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xE96DA24D, 0x2E1AA3F6, 0x0685DAAC, 0x53278CFC,
+		            0xFC9E5FBD, 0xC8E6C91F, 0x91BCB076, 0x356FE201 }} },
+		{ .w32 = {{ 0xF4C8C5E0, 0x63892582, 0x9E3AFC19, 0x5B021EAF,
+		            0x1E082D15, 0xC77BCF87, 0x79F03A2C, 0x7C80DC65 }} }
+	},
+	/* 1 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x39AB91F6, 0x6AE96E69, 0xCB37D0FD, 0xA30D355D,
+		            0x4F05BB75, 0x17C6E7C8, 0xA4554239, 0x5EBBC4DB }} },
+		{ .w32 = {{ 0x1EA8AE84, 0x41286EF6, 0x981E5732, 0xA67B6B16,
+		            0xE133A614, 0x3C0C89CC, 0xFA972C20, 0x5A98B9A4 }} }
+	},
+	/* 2 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xA8BB9CE3, 0x1535010A, 0x0C672E1A, 0x780C5996,
+		            0xADA6AA28, 0x3D456E59, 0x2645A8C7, 0x3F4C8656 }} },
+		{ .w32 = {{ 0x3EA03182, 0x368EEA4C, 0x48E3D8EB, 0x60917F7B,
+		            0xB5155324, 0x37EE59A7, 0x2B608A88, 0x42BA8E0C }} }
+	},
+	/* 3 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xAF7A8BD6, 0x39652960, 0xA61EE0A0, 0xE96C27C8,
+		            0x875B1339, 0xCF8890A9, 0xAB4169DC, 0x6DFF595C }} },
+		{ .w32 = {{ 0x680ADDD7, 0x1F29BA82, 0x5897859E, 0x1ABFDD3F,
+		            0x9EF1E1B3, 0x0F2B6C1F, 0x1F8A3D46, 0x5E17DFA4 }} }
+	},
+	/* 4 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x5A683B5A, 0xB63F58E7, 0x84F0B656, 0x915E68E8,
+		            0xE78762B6, 0x1D6A2EC6, 0xEEFB3EF4, 0x115A233A }} },
+		{ .w32 = {{ 0xA3D185A1, 0x9F438960, 0x4EA51896, 0x056B5C7B,
+		            0x64E8DF31, 0x6ABEF35B, 0x013C3596, 0x0478AEA7 }} }
+	},
+	/* 5 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x91C711EF, 0x8F5FBD26, 0xA125A6F8, 0x3625D797,
+		            0x19B2ACE9, 0xDC848F2D, 0xE69C7983, 0x2869414F }} },
+		{ .w32 = {{ 0xD9D4DCF7, 0x7A753C2E, 0x77FA9696, 0xBB0EF385,
+		            0x02FB46A5, 0x3A239170, 0x7BF4F6F6, 0x4E96A76B }} }
+	},
+	/* 6 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x8B24D210, 0x5B9522DD, 0x364B31D8, 0x0CA3CBAA,
+		            0x40B51801, 0x3F0D1E5E, 0x51BC8751, 0x65EC7415 }} },
+		{ .w32 = {{ 0xABBB6C67, 0xAC79E88E, 0xF42BF8FE, 0x85BEEB01,
+		            0x3CCD15CB, 0x172AEF9E, 0xFA76773B, 0x06D34EBE }} }
+	},
+	/* 7 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x0F67B8C6, 0xD65502F9, 0x47304FD7, 0xA318126D,
+		            0xB6880809, 0x52B0DE0E, 0xABAA780E, 0x4E17F8E6 }} },
+		{ .w32 = {{ 0x9C75B56A, 0x33700906, 0x3D5C0F0B, 0x43655326,
+		            0xB2184628, 0x449BE5CB, 0x269DE583, 0x4661FA0C }} }
+	},
+	/* 8 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x1FB2A6B2, 0x47C285F7, 0x46D6FB17, 0x59847CA2,
+		            0xB0F62026, 0xD7262787, 0xDE6EF7F8, 0x14812850 }} },
+		{ .w32 = {{ 0x5CEF88E3, 0xFE11B9EC, 0xBD238791, 0x2B39D783,
+		            0xCAB8059C, 0x35E0D2C8, 0xA2F1E84E, 0x6E07A03E }} }
+	},
+	/* 9 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x5A819D8C, 0x8ADB4437, 0xA6F217C3, 0x1243C67B,
+		            0xDEF34D1C, 0xA5E03CBB, 0xDB351168, 0x5403ECFB }} },
+		{ .w32 = {{ 0x10ED27D3, 0x5E851051, 0x7E8C1418, 0xE5156039,
+		            0x25796952, 0xF3C579B5, 0x6A81179D, 0x710EFBF9 }} }
+	},
+	/* 10 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x0B66C315, 0xB8626CEF, 0x4162E362, 0x5AEA7839,
+		            0xCD916860, 0x422486F3, 0x10C28651, 0x27581E0F }} },
+		{ .w32 = {{ 0x2EC1A9DF, 0xE6EA23C8, 0x321D8846, 0xFD167540,
+		            0x3D51B0E1, 0x796A03A0, 0x1529B9EC, 0x7397FAC2 }} }
+	},
+	/* 11 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x5CF81671, 0xA0D84683, 0x9E5E678D, 0x5D67C905,
+		            0xB005D5C6, 0x6943085E, 0x09F32949, 0x3B24448E }} },
+		{ .w32 = {{ 0xC8E30EDB, 0x1C0D58EB, 0xAB608E97, 0x0705AB6A,
+		            0xE3C5DBD5, 0xD0870C11, 0x59D2445B, 0x0C9F845F }} }
+	},
+	/* 12 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xFA45F7F3, 0xFE68ABB9, 0xE791A917, 0xFAB4C169,
+		            0x2DF98099, 0xF2937C94, 0x36A5CEFB, 0x450EDA23 }} },
+		{ .w32 = {{ 0x6A01D3C7, 0x1A3B2AFD, 0x7AA8CA7C, 0x4E85E5E1,
+		            0x396C8014, 0x32287C38, 0x3F12E613, 0x026D6722 }} }
+	},
+	/* 13 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xF5ADB585, 0x2B0DD3D1, 0x1290E516, 0x4839FF34,
+		            0x5A953B85, 0x2C060131, 0xC1C807CC, 0x33472AF0 }} },
+		{ .w32 = {{ 0xEC618994, 0x917D8E31, 0x415F54D2, 0xAACEC29A,
+		            0x2ACF8DBA, 0x11141369, 0xF89DB85C, 0x76549AF8 }} }
+	},
+	/* 14 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xA2632117, 0xAB50276D, 0xF6E82B00, 0x2405AA1E,
+		            0x20AEC105, 0x6C594B85, 0xB971A273, 0x7265F48E }} },
+		{ .w32 = {{ 0x567CDB40, 0x7BCEFB17, 0x936BC632, 0xF057CFED,
+		            0x58FCE9D3, 0xE1A6B064, 0x474B809F, 0x14B8BA18 }} }
+	},
+	/* 15 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xC714E2B7, 0x10508891, 0xDEA2F65B, 0x24392BC4,
+		            0x03967798, 0x911C383A, 0x596593B9, 0x15BB152C }} },
+		{ .w32 = {{ 0xC52D2AEF, 0xF520034E, 0x31D95B82, 0xB7754766,
+		            0xFD56E67F, 0xFACED2C0, 0x215CA90C, 0x54A31B8A }} }
+	},
+	/* 16 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xD43732D6, 0x55FB7DCE, 0x3C3B24B5, 0x2BCBAD93,
+		            0x7A15050F, 0x496440C0, 0x8D0C3389, 0x43636866 }} },
+		{ .w32 = {{ 0x53037A6F, 0xC215DA39, 0xB3DCE3B9, 0x99B0BBC8,
+		            0x1E8DF65E, 0xDD1238BE, 0x95D981A6, 0x3CEEB9BB }} }
+	},
+	/* 17 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x7F7CB566, 0x18F5D061, 0x571605D1, 0xE8EFD208,
+		            0x7EA06447, 0x1FA27850, 0x5FAFA719, 0x033D4FDB }} },
+		{ .w32 = {{ 0x50D11EF7, 0x548E6241, 0xEB78D016, 0x56CD6E2E,
+		            0x502800B1, 0x3BF25090, 0xDFEDEF89, 0x348F1C79 }} }
+	},
+	/* 18 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x0F86BCAA, 0x7BF4447A, 0x2679FFC5, 0x355533E0,
+		            0xF882DF49, 0x6F37CA4A, 0x524A2E5F, 0x2E855C00 }} },
+		{ .w32 = {{ 0xC357436E, 0xCDBDE4F4, 0x79DDB0AE, 0x983FAA7A,
+		            0xD93AF6B8, 0x122C9EA0, 0x9AC203F8, 0x19CA0DCB }} }
+	},
+	/* 19 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xC72E4884, 0xAE4EF13C, 0x6CD9F999, 0xFC32918A,
+		            0x353CF7FB, 0x84E0BD44, 0x9938148B, 0x0F02841A }} },
+		{ .w32 = {{ 0x88734BD5, 0xB82F238E, 0xC7CD6985, 0x38ABEB4A,
+		            0xA5CDF7FA, 0xD59CF5CC, 0x955147F6, 0x01CA9B95 }} }
+	},
+	/* 20 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xC23769F0, 0x96491475, 0x3749712D, 0xDD7553B6,
+		            0xA2EEA411, 0x321FE6BD, 0x5B806D89, 0x39E822A8 }} },
+		{ .w32 = {{ 0x4F4990B0, 0x866274F0, 0xEA763218, 0x188253F1,
+		            0x38642B18, 0x524790D4, 0x4A50C8F0, 0x74F6DED1 }} }
+	},
+	/* 21 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x0FEF4E39, 0xB1C9979B, 0xB7C355F4, 0xA73C4194,
+		            0x01B19992, 0x3FECAE4B, 0x2B0903A7, 0x1465E39F }} },
+		{ .w32 = {{ 0xBD85AA3A, 0x2AEB2564, 0xACC5E504, 0x8F2218A1,
+		            0xA0CBBB8A, 0x30DBDFE8, 0x0119B3E9, 0x62109BD1 }} }
+	},
+	/* 22 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x1FFBCF0E, 0xDD4085F3, 0x81385722, 0xF3AAFFC9,
+		            0x3E35A70A, 0xE42CFA94, 0xD386F24D, 0x535921CA }} },
+		{ .w32 = {{ 0xD8784DB7, 0xCFFDD6AD, 0x8869CA5F, 0x51611924,
+		            0x63A6928A, 0x58D7468A, 0x16F4B57A, 0x7D1A3D39 }} }
+	},
+	/* 23 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xF4EB2FBC, 0x91E7C53C, 0x7FF8F584, 0x4D5DD9F3,
+		            0x9C133FD0, 0xD32EA02D, 0x6B50B4B0, 0x4F02B6E6 }} },
+		{ .w32 = {{ 0x480A465B, 0x966823EF, 0x654B7434, 0xE55BEF3E,
+		            0x0B27D59D, 0x5D609B51, 0xA2FF59A5, 0x24005C98 }} }
+	},
+	/* 24 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x692C8800, 0x61413AD6, 0x238B9858, 0xF3B2A441,
+		            0xEDF8AD98, 0xE724656A, 0x3D1065E4, 0x3FEACA30 }} },
+		{ .w32 = {{ 0x6DEA3C9D, 0x524494B3, 0x94F106A0, 0xAA067B10,
+		            0x3D06BC9E, 0x7DB1C9A1, 0x3F3B7A25, 0x617DAE66 }} }
+	},
+	/* 25 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x7F186854, 0x43A6053E, 0x7BB41E10, 0xB440A452,
+		            0xFF296083, 0x728AD6D5, 0xCD03D8ED, 0x10A84361 }} },
+		{ .w32 = {{ 0xC97381FA, 0x00FE7156, 0xC673AC88, 0xCB86A80B,
+		            0x19393118, 0xFB5C77CD, 0xAF92BD57, 0x6E7BC7C6 }} }
+	},
+	/* 26 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x4EB76A3E, 0xDC1CBE8F, 0xB9436FBF, 0x3F3EA7B8,
+		            0xA0E9578E, 0x8102F3ED, 0x87BE1F74, 0x24DFBFC7 }} },
+		{ .w32 = {{ 0x424410AF, 0xCC86A5EF, 0xE5546952, 0x4B814193,
+		            0x79AA2E06, 0xD0888C31, 0xA098A056, 0x53189B8E }} }
+	},
+	/* 27 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x55A836E3, 0xE6AF220A, 0x1213628D, 0x0B096D64,
+		            0x11F55989, 0xF4ED93D4, 0x4F94FCE0, 0x4CA54C6D }} },
+		{ .w32 = {{ 0x20AA62AC, 0x0406A338, 0xB5A5D63B, 0xE2F32EF2,
+		            0xC13661D1, 0x2316503F, 0xB227C7EB, 0x457C0114 }} }
+	},
+	/* 28 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x4D58CD16, 0x841A95BA, 0x56BD0D00, 0x5775AED3,
+		            0xDA6980DB, 0x83C234CF, 0x1DBB725D, 0x3D956B0F }} },
+		{ .w32 = {{ 0x0FA0B6BE, 0x2A83CD6F, 0x91EF7502, 0x115C489C,
+		            0x89B124BF, 0x57E3C4F8, 0xBC16E207, 0x32CCDBB2 }} }
+	},
+	/* 29 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x2C0BB6DB, 0x834D8EFA, 0xAD03A6FA, 0xDDD5747F,
+		            0xA2988E7D, 0xEB4FE36E, 0xE95A06AB, 0x6483085D }} },
+		{ .w32 = {{ 0xFF416EC4, 0x3BA8B731, 0x63BAC2E9, 0x5A8DF0EE,
+		            0x371E13F2, 0xE14E5131, 0xA8FF523E, 0x26BC7BB7 }} }
+	},
+	/* 30 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x75B156A9, 0xA262A2E2, 0x3D75A04F, 0x16C2299E,
+		            0x37DAC87D, 0x8702D27D, 0xA56AA522, 0x586852BF }} },
+		{ .w32 = {{ 0xA8521445, 0x855F65AB, 0xC175C4BD, 0x28F96F23,
+		            0x59FE6069, 0x65BF7304, 0xDCCE5D50, 0x3E845926 }} }
+	},
+	/* 31 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x6D06F270, 0xFCB290EB, 0x8567490D, 0xA48917DC,
+		            0x42ECA8A3, 0xB0D0BC80, 0x25402E4F, 0x4B420B9C }} },
+		{ .w32 = {{ 0x6CDE7AD5, 0xA69CEF8E, 0xC1AECC85, 0x58809D32,
+		            0x236F9681, 0xFA0B959B, 0x2270A5BA, 0x714673A8 }} }
+	},
+	/* 32 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xAC7736B4, 0x9A282A62, 0x14D7EE13, 0x949CAEE5,
+		            0x72A926CC, 0x1936709E, 0xC55E75B1, 0x0D0EEF1E }} },
+		{ .w32 = {{ 0xC39ACFF2, 0xC6155D03, 0xC9E4F29A, 0xA201D76D,
+		            0xFB84906A, 0xF0195019, 0xFE826660, 0x3E789368 }} }
+	},
+	/* 1 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x9E6845BE, 0x64E34CF0, 0x48BA1E46, 0x69C15507,
+		            0xD862DE67, 0xE9D4512A, 0x3AD02A4E, 0x6C188C96 }} },
+		{ .w32 = {{ 0x07F2E3FA, 0x8EDC5C04, 0x43B7731A, 0xB981FDFB,
+		            0x13EC3BD2, 0x523A6092, 0x67534E4E, 0x6D64C87A }} }
+	},
+	/* 2 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xE3EC1F71, 0x8DCC8B34, 0x4FEB9100, 0x8EF3992C,
+		            0xA464A931, 0x36F2BEC3, 0x25E8BD03, 0x695B8F12 }} },
+		{ .w32 = {{ 0x8224585A, 0x993FD2F1, 0x8884E625, 0xC79DBDAB,
+		            0xE8F055E2, 0xF1102EA9, 0x34D9C606, 0x15ABD1C4 }} }
+	},
+	/* 3 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xEDB695CB, 0x82974D73, 0x21D1931A, 0xAF56D2A4,
+		            0xBC35211B, 0x1AB2EAE4, 0x97B4A698, 0x3704EA89 }} },
+		{ .w32 = {{ 0x20A0E7B3, 0x95287CEA, 0x2183D6EE, 0xC14759C6,
+		            0xEE564FB9, 0xE53D572A, 0x03A24E6D, 0x605041E8 }} }
+	},
+	/* 4 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xA562B029, 0xC1F37C08, 0x425781C6, 0x374990F3,
+		            0x20AF754B, 0x18124655, 0x8AAE1254, 0x49D628B1 }} },
+		{ .w32 = {{ 0xF538741B, 0x4A834DF1, 0x73ECC8FF, 0x6CEFCAEA,
+		            0xC2D0E75C, 0xBC80D1B7, 0x31C96316, 0x527D2D13 }} }
+	},
+	/* 5 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xC5DF7446, 0xF35CE166, 0xBACD269C, 0xA29E4A7C,
+		            0x1F9B9A6D, 0x8897C6C3, 0xDEE0385D, 0x7AFA4EF7 }} },
+		{ .w32 = {{ 0x0E0B38E8, 0x24123A0A, 0xAF85BD4F, 0xC6089007,
+		            0x5CA59035, 0x039C535E, 0x23F6C972, 0x77DEE48D }} }
+	},
+	/* 6 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x1C92CBF8, 0x73DAC6C2, 0x7149C062, 0x23D3522D,
+		            0x96864CD8, 0x4BFBF3A6, 0xC76D624A, 0x40BAC9BC }} },
+		{ .w32 = {{ 0x38AAC315, 0x74E66437, 0xF83D7CC0, 0x68956B32,
+		            0x6D94E482, 0x6407843C, 0xD39B1BA1, 0x240632FF }} }
+	},
+	/* 7 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x7153BDF8, 0x6EE8C673, 0x0013B232, 0x458C4F83,
+		            0xA623C207, 0xAA0003FF, 0xF0718212, 0x1DAD0B80 }} },
+		{ .w32 = {{ 0xA37CCD37, 0x2B6E947C, 0x53DB7368, 0xEC64540D,
+		            0xCB9DECFE, 0x1C686999, 0x2E0A6571, 0x2649280E }} }
+	},
+	/* 8 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x618FEF23, 0x4D54AA20, 0x58AA924B, 0xF244A0BA,
+		            0x829CE3EB, 0x8C567E62, 0x027F36D6, 0x4341D236 }} },
+		{ .w32 = {{ 0x9E08E1BC, 0xE724460C, 0xA04E298B, 0x303DB41F,
+		            0x9B8A89B9, 0x3D92666A, 0x121D4F9D, 0x1AF71599 }} }
+	},
+	/* 9 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x33844C9A, 0x6465BB6B, 0x04EE3508, 0xAF03CB1A,
+		            0xB4B3B806, 0xF3E50834, 0xC93B78D7, 0x43EBAF96 }} },
+		{ .w32 = {{ 0x2F1AA379, 0x9F82C8D8, 0x014BE99E, 0x309018C0,
+		            0xD257A481, 0xF2BDC955, 0x1BE11AA5, 0x40F2F67E }} }
+	},
+	/* 10 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xF26C47F6, 0x0CEF38DB, 0xC044FEEB, 0x5232878F,
+		            0x837F904C, 0x125DA655, 0x620A5F43, 0x49299A94 }} },
+		{ .w32 = {{ 0x579FB29D, 0x7322F1F7, 0x51EE03CD, 0xFA27275C,
+		            0xF6EA4C6C, 0x4A364268, 0xC7022221, 0x12226363 }} }
+	},
+	/* 11 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x8BC889C6, 0x2A392303, 0xF2171737, 0x5CA8418A,
+		            0x4DE1911D, 0x62A49930, 0x6B1096F5, 0x647F2DBB }} },
+		{ .w32 = {{ 0xCE49CF93, 0x7372C144, 0x2A0853C0, 0x7479CA37,
+		            0x13EB7AD8, 0x3F225ACA, 0x1DA4E9C8, 0x50D254B9 }} }
+	},
+	/* 12 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x4A2705EF, 0xB5D2CBA2, 0x8C4E90B2, 0x156A281B,
+		            0xF526D53B, 0xC16CDA37, 0xFECC7627, 0x76800924 }} },
+		{ .w32 = {{ 0xCB30A7B5, 0x5E027A0C, 0x3103FD77, 0xF35282C0,
+		            0x18919A72, 0x043742E3, 0xECB4F5BF, 0x09DA9A5A }} }
+	},
+	/* 13 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x3EA3A375, 0xA1C3C5A0, 0x9A2D8482, 0x2373EF27,
+		            0x11A8B739, 0x5209D9A5, 0x8D7F3B68, 0x2427A9BB }} },
+		{ .w32 = {{ 0x34F1E3E1, 0x511AEBF2, 0x71160DEA, 0x3CBF1B38,
+		            0x5AE08773, 0xD56CADAC, 0xD986F4D9, 0x1763A680 }} }
+	},
+	/* 14 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x8B37FDF3, 0x28850B18, 0x5EA44CEF, 0xED03DA4F,
+		            0x54C64EF8, 0xFB5DDFDE, 0xD7F97FC5, 0x39DBB492 }} },
+		{ .w32 = {{ 0x668EF455, 0x40A09023, 0xF9AB0CAA, 0x9ADF531D,
+		            0x8B6AF3DE, 0x6BA60A5C, 0x4E91AF33, 0x4E3751CD }} }
+	},
+	/* 15 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x81CD02C6, 0xF5B17CB8, 0xD2196134, 0x2905B550,
+		            0xF4775C30, 0x428F811A, 0x8C389C93, 0x4035EFC6 }} },
+		{ .w32 = {{ 0xA6DB732C, 0x59E2E6FF, 0x916E4884, 0x438C1A11,
+		            0x419554E0, 0x697CA873, 0xBDDEA023, 0x6D9764BC }} }
+	},
+	/* 16 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x88A716F1, 0x072D33F2, 0x30880A69, 0x8FEA5D6B,
+		            0x96032207, 0x2C18E026, 0x75B3EEED, 0x7704AA59 }} },
+		{ .w32 = {{ 0xA32001E5, 0xE1F43433, 0x089AE740, 0x21D19CB6,
+		            0x1475BED5, 0x14571014, 0xAE5035F2, 0x7C906284 }} }
+	},
+	/* 17 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x73F0254B, 0x5B3427EA, 0x3621DE7B, 0x95F61BE5,
+		            0xA49FE6F5, 0x3F3BF255, 0xE3676490, 0x7A9A6F7B }} },
+		{ .w32 = {{ 0x567AEE7B, 0x5EB72C51, 0x012D2DF0, 0x2AF3B44E,
+		            0x1C3E7978, 0x02F29E20, 0x77B08347, 0x69AD3F96 }} }
+	},
+	/* 18 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x2EA4FFAD, 0x0993F7AF, 0x452CDCC4, 0x491CC7A7,
+		            0x811D9ADF, 0x246BF987, 0xC18D9E68, 0x1BC5F82A }} },
+		{ .w32 = {{ 0x82E9EC3E, 0x61545896, 0x5D66F26D, 0x1CD87938,
+		            0x8B85F00C, 0x475E5BA3, 0x8A341476, 0x2502F6E5 }} }
+	},
+	/* 19 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xFC5AC82F, 0x206F7D7D, 0x5F9AE1C0, 0x16BF8A71,
+		            0xC4CF0B71, 0xC3314AF0, 0x0B8BAEAC, 0x5F9589E8 }} },
+		{ .w32 = {{ 0x3D72528C, 0x11866C83, 0x16CCC2F8, 0x7FEC8E20,
+		            0xB462AAAA, 0x76D45117, 0xCE5E2C9B, 0x1E66DE7F }} }
+	},
+	/* 20 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x35417C59, 0x0BECDBD0, 0x85B5ABBB, 0xF4184797,
+		            0xD76447F9, 0x44FD1EA3, 0x960FC9A3, 0x19DC3BB5 }} },
+		{ .w32 = {{ 0xD092E280, 0x4883E8CE, 0x142997F3, 0xCCFC96FF,
+		            0x4A3044EC, 0x1177FE1B, 0xB1F67D1C, 0x4DBB6B75 }} }
+	},
+	/* 21 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x6E406089, 0x833E6FAC, 0xD071ED9A, 0x78020CFC,
+		            0xB422AF8D, 0xFE487904, 0xE1F3ABA3, 0x46891C53 }} },
+		{ .w32 = {{ 0x533ADBA0, 0x59A6B836, 0x7FFD0E64, 0x42600A79,
+		            0xFA12952C, 0x79614E10, 0x72F75288, 0x676E74FD }} }
+	},
+	/* 22 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xA3B953B2, 0x8AB13BBC, 0xB707D80F, 0xDF2E3D99,
+		            0xBBB61CCF, 0xB64C5736, 0x7AF35C3F, 0x2F33DFE4 }} },
+		{ .w32 = {{ 0x231D840B, 0x995DA17D, 0x6071F5E9, 0x2DFEF2D2,
+		            0xB98D7A3E, 0x70F9304D, 0xE5873513, 0x2422DBF6 }} }
+	},
+	/* 23 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xF6BDAD61, 0x6A4F846A, 0x1FE11D67, 0x867139CC,
+		            0x94151D06, 0x560B6309, 0xFBEA18BC, 0x7D3820D9 }} },
+		{ .w32 = {{ 0x54453238, 0x648FB9D8, 0xBB0698CB, 0x39C8C195,
+		            0x33A58AC6, 0xB3AFE3FB, 0xA43B811F, 0x4361E7ED }} }
+	},
+	/* 24 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xAE941C67, 0xB106A2D9, 0xD5A06C0E, 0x50A3E1E1,
+		            0x63C03E32, 0xF28FE373, 0xD2110CB6, 0x30F013B6 }} },
+		{ .w32 = {{ 0xDA73E538, 0x91F99C28, 0xD98A0392, 0x1FFC47A8,
+		            0xECD89419, 0x0D2BA2BE, 0x98403F03, 0x75CE8FBF }} }
+	},
+	/* 25 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x1907794F, 0x5D8249FF, 0x08E0FC21, 0x3DF6DD7F,
+		            0x89AE2B31, 0xBB83B33A, 0x42B548B1, 0x70FEDD1E }} },
+		{ .w32 = {{ 0xA2E3BA67, 0xF621A2B6, 0xFBC222D6, 0x833BDF59,
+		            0xCB4D22E9, 0xFA9F92D7, 0xC393096D, 0x6E8429AD }} }
+	},
+	/* 26 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xF2339CBF, 0xE84FE94D, 0x6AE9C07E, 0x0927DC00,
+		            0xB5596672, 0xB584E099, 0x9C5E4521, 0x6F13DA33 }} },
+		{ .w32 = {{ 0x7ECB581F, 0xE77B77ED, 0x99C96A18, 0xE45067BB,
+		            0x8CE23FA9, 0x0CD86925, 0x04AC6B25, 0x5444E30A }} }
+	},
+	/* 27 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x07A8B37D, 0x1DF1C64D, 0x94D53E29, 0xAD962FFB,
+		            0xED20B4E0, 0x88D93766, 0x908AF90C, 0x7B9E584D }} },
+		{ .w32 = {{ 0x63F711EC, 0x2BDE4D4B, 0x1C81A401, 0xBF2C67AD,
+		            0x9F25E1EE, 0x6920D358, 0x190BD69A, 0x25AA5258 }} }
+	},
+	/* 28 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x8CC3E03F, 0xE8D8C0A0, 0xD71B26CF, 0xDF32C357,
+		            0x4F8D8025, 0x931EEABC, 0xC5BC1E2A, 0x1DEC9AC5 }} },
+		{ .w32 = {{ 0x9C89A206, 0x55F55B24, 0x881514CD, 0x145FF8A5,
+		            0x1E1477D1, 0x197576AD, 0x1979B77F, 0x4BABC25A }} }
+	},
+	/* 29 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x4A705AEA, 0xE58680A2, 0xBFC802F7, 0x2ED14014,
+		            0x40E28A3E, 0x61D3CB53, 0xE5F28C1B, 0x3A3D8E4B }} },
+		{ .w32 = {{ 0x5847AE4D, 0x585C6F0A, 0x528CB3E5, 0xE21612A1,
+		            0x4F07DC99, 0xE802FC0F, 0x64B56800, 0x4E4ADE9F }} }
+	},
+	/* 30 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x97F31970, 0x31A461D7, 0x116B6A00, 0x3E61350E,
+		            0x199D117D, 0x3273F13F, 0x8C30B5AB, 0x0ACF24D5 }} },
+		{ .w32 = {{ 0x598542EF, 0x59F30637, 0x831CA6BC, 0xBEC8CFE6,
+		            0x687908BF, 0x696D97B0, 0x6846D3B9, 0x58A3BE60 }} }
+	},
+	/* 31 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xF10F4EB5, 0x8984A684, 0x85EEE7A4, 0x6432B356,
+		            0x1AABEE27, 0xD26F747D, 0x69598E47, 0x330B48D0 }} },
+		{ .w32 = {{ 0x8F8509B5, 0x88D4E728, 0xC9E53E24, 0x7CC0C1DB,
+		            0x0C1E51C1, 0x4934C490, 0xEF125C74, 0x27956335 }} }
+	},
+	/* 32 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xCBBBFF00, 0x7E8F1C84, 0x218986CE, 0x0BDAE3C3,
+		            0x7FAD56B9, 0xC1AF55BC, 0xE8319A1E, 0x0292F462 }} },
+		{ .w32 = {{ 0xA393D695, 0xB546C5CA, 0x8923F3A6, 0xD935A471,
+		            0x9E94A71F, 0x097FEABF, 0x608F5CE6, 0x29CE3933 }} }
+	},
+	/* 1 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xF95858EF, 0xF1EB054C, 0x9CAD0624, 0xEF51C4E6,
+		            0xC93127AA, 0x3DA5B358, 0xACE31336, 0x50101ACE }} },
+		{ .w32 = {{ 0xB46CA9C3, 0x31926BC4, 0xA7964B47, 0x878FC14B,
+		            0x7C945916, 0x5BFCB406, 0xB88C965E, 0x42C419FF }} }
+	},
+	/* 2 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x394B2D5B, 0x7F972196, 0x34848E41, 0x182A32EE,
+		            0xBD4B6326, 0x4AC512DA, 0x1833870A, 0x46826618 }} },
+		{ .w32 = {{ 0xE7E7DE9B, 0xDF897EFF, 0x7943D8AA, 0x56DA4E7C,
+		            0x26E215E5, 0xF8D0EB00, 0x78A1D090, 0x584B7786 }} }
+	},
+	/* 3 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x8C330CB4, 0xA877B121, 0xC68610F2, 0x447E11B8,
+		            0xE14FAA19, 0x41310C94, 0xE6110A95, 0x529E20B7 }} },
+		{ .w32 = {{ 0x9AA693E4, 0xEABDDC06, 0x54832CFC, 0xBC40BFB9,
+		            0xBD8CFBB3, 0x303CC48D, 0xF30592D8, 0x12E38796 }} }
+	},
+	/* 4 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x9B5B5D23, 0xD35722B3, 0x6559F95F, 0x4B916E7B,
+		            0x041409BD, 0xD533D612, 0xBFCC80EC, 0x13062F0E }} },
+		{ .w32 = {{ 0x210D3265, 0xB041C733, 0x60BD55D1, 0x30CD08B6,
+		            0xA701F82C, 0x2B262BDF, 0xBD9C14E8, 0x6B0374F1 }} }
+	},
+	/* 5 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x064B0A9B, 0x009D5CA6, 0xA4EFD506, 0x90E83ED8,
+		            0xE0FE80D7, 0xD9B46DEF, 0xF3C536B7, 0x43BA577D }} },
+		{ .w32 = {{ 0x2F523235, 0xE38E5F4A, 0xDB1DC089, 0xDA7B726C,
+		            0x759C2B7E, 0x0E645983, 0x5070682D, 0x4547155F }} }
+	},
+	/* 6 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xC900A637, 0x083BD9FA, 0xD0FB28BC, 0x511C5CC0,
+		            0xC2FDBCCB, 0x64353E63, 0x001F3115, 0x77A8C688 }} },
+		{ .w32 = {{ 0x5795C3BF, 0xCA15DF22, 0xF8622172, 0x24CF425D,
+		            0x77309F24, 0x22A71C08, 0xA4674966, 0x3EC90461 }} }
+	},
+	/* 7 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xC154F55F, 0x03AC141A, 0xF33928F3, 0x5572B1DC,
+		            0xD761FE9D, 0x53D2D1B0, 0x39F4C51B, 0x433E867A }} },
+		{ .w32 = {{ 0x605523BD, 0x1BF2D5B6, 0xF766A4AD, 0xEDD7D608,
+		            0x54613CDC, 0x6C308F36, 0xFB69E686, 0x3BA71352 }} }
+	},
+	/* 8 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xD7BD1B53, 0xCCDEF224, 0xBD0298E2, 0x598B5684,
+		            0x6BAAC6C5, 0xB8A343CD, 0xB7F9CE9C, 0x3C448E76 }} },
+		{ .w32 = {{ 0x108FDE8D, 0xAE6D83B9, 0xD31548F9, 0x59D24821,
+		            0x4B3AFD20, 0x97BE44F0, 0x912FD754, 0x0747588C }} }
+	},
+	/* 9 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x6E711126, 0x883C589B, 0xD05D1978, 0x9607319C,
+		            0x8CABB99F, 0xFBC7D23B, 0x4F38A979, 0x104DC154 }} },
+		{ .w32 = {{ 0x8E6B5959, 0xFE144519, 0xE26B28F9, 0x38380BE4,
+		            0xF6285199, 0xE9DA080B, 0x0BD9BD1A, 0x6800D993 }} }
+	},
+	/* 10 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x8C5A2D42, 0x9E13C655, 0x8DFE5FCE, 0x16480376,
+		            0xF48DD33E, 0xC2999130, 0xE43807C1, 0x170F6F58 }} },
+		{ .w32 = {{ 0x1D784B6D, 0x40545809, 0xB2C498D2, 0x7B5D4F1B,
+		            0xA46DC039, 0x1343804A, 0xF673A2D0, 0x0498D617 }} }
+	},
+	/* 11 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xA87737EC, 0x39383DE1, 0xF810772C, 0x18B19663,
+		            0x95300CD0, 0x75D3EA67, 0x59F6B125, 0x7DE90213 }} },
+		{ .w32 = {{ 0xD6E5C876, 0xBB0B9C8C, 0x37C066CA, 0x4EB4F181,
+		            0x7F4BC46F, 0x3100D9A0, 0xC25CF890, 0x5740F6A3 }} }
+	},
+	/* 12 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x37402349, 0xB18FD42B, 0x800D54AD, 0xF12BD28E,
+		            0x0F3EC630, 0x278AB86E, 0x42BDF94B, 0x7F8888E8 }} },
+		{ .w32 = {{ 0x3D5987F3, 0x1FD5033F, 0x8409B2F6, 0x09C72936,
+		            0x328ED5AE, 0x17260E4D, 0xFE51DFEE, 0x7F3BABF8 }} }
+	},
+	/* 13 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x263779ED, 0x62F8E4AD, 0x361C0D8A, 0x4FAA9249,
+		            0x6E25F568, 0xC7DA8CAA, 0xC5E2FFDD, 0x4E51D383 }} },
+		{ .w32 = {{ 0x5B843377, 0x92764320, 0xE8DAF54A, 0x31075431,
+		            0x07639D0C, 0xC0259286, 0x6E07E3C7, 0x2AB5415B }} }
+	},
+	/* 14 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xE4964CA0, 0xCF008DA0, 0x3E117C9A, 0x235519B4,
+		            0x8709A65D, 0x9A4744C1, 0x45A7EE90, 0x64BA5A59 }} },
+		{ .w32 = {{ 0x0BBFD0DC, 0x3700DBFE, 0x358BCAE2, 0xDCB3AD42,
+		            0x68E690BC, 0x9D6127DE, 0x0C307558, 0x6A6487D6 }} }
+	},
+	/* 15 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xCF1F43CC, 0xCD7F5307, 0x10C71924, 0xDB6E296A,
+		            0x75BC8DC6, 0xADE1A63C, 0x53998915, 0x3465FD95 }} },
+		{ .w32 = {{ 0x535C3312, 0x21F55F50, 0x8F16C8B7, 0x5D14CCC1,
+		            0x6E57F0E7, 0xA9CDF870, 0x17084FD4, 0x6B8994A9 }} }
+	},
+	/* 16 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xCE6FAE6B, 0xA5E7E4CF, 0xBBCF1DA7, 0xA0697B8C,
+		            0xC4B12A90, 0x07014DF0, 0x68157B07, 0x0DC979B0 }} },
+		{ .w32 = {{ 0xAC11A0B5, 0xB91745F8, 0x67F4E829, 0x525223B3,
+		            0xE27AB52E, 0xAA90D04D, 0x7A94C0F6, 0x2453F02F }} }
+	},
+	/* 17 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x13A904E9, 0xA5DB426C, 0x77A6B508, 0xF3F0E946,
+		            0x14FD230B, 0xD251A4FF, 0x481F27B8, 0x0410F779 }} },
+		{ .w32 = {{ 0xB937DC00, 0x39180359, 0xE7B2D62B, 0x5796F3A7,
+		            0xC9A5366E, 0x7B9700DF, 0x57F387C3, 0x5315AFB9 }} }
+	},
+	/* 18 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x0F634F33, 0x796F4D83, 0x2F4083FD, 0x6CA802DC,
+		            0x511A2727, 0x507FF68A, 0x36A6FBF4, 0x47867ABC }} },
+		{ .w32 = {{ 0xFAC781A8, 0x2BA430B0, 0x174AA807, 0xE175C748,
+		            0xA6A89083, 0x393A9A0C, 0x98C75CA3, 0x5F49C9D1 }} }
+	},
+	/* 19 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x2795933F, 0x38308633, 0x887F59F9, 0xB366EE85,
+		            0x7715C5ED, 0x236D3092, 0x9D0F617D, 0x69F70BE3 }} },
+		{ .w32 = {{ 0x79C95F5E, 0x4FCC0CF6, 0xD7C4923E, 0x6E62F004,
+		            0x00C03570, 0xDB8BFAEF, 0xE2C1358A, 0x2A7037B7 }} }
+	},
+	/* 20 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x17347D45, 0xB8596C5E, 0xCE0D85E8, 0xE38D5EEC,
+		            0x1A02944B, 0x8E5A3A9E, 0xEFF6173E, 0x58FED47F }} },
+		{ .w32 = {{ 0x9DEA2684, 0x1D22E805, 0xC5727D0A, 0x298BC4B8,
+		            0x0FAEAF69, 0x1F617016, 0xE3186159, 0x266BD7D6 }} }
+	},
+	/* 21 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x3706947D, 0xFFA8CEA9, 0xABC25AF7, 0x9114BA54,
+		            0xED9F6487, 0x569D43AA, 0xCE62B507, 0x34EFCC7A }} },
+		{ .w32 = {{ 0x439C52BC, 0x35354A39, 0x4B197CB1, 0x55056EBC,
+		            0xF2C1A706, 0x8DB9725B, 0x3904F8DA, 0x31D89C45 }} }
+	},
+	/* 22 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xAC441BF8, 0x545250A2, 0x761F265E, 0x1C04409E,
+		            0x5DA1325A, 0xD640DE79, 0xAB788CC7, 0x6D3ADC6E }} },
+		{ .w32 = {{ 0xF0A7A21F, 0xB1B1AF4B, 0x759A62CC, 0xF018CD4E,
+		            0xE61FB777, 0x4733AA6C, 0xD44AAAC6, 0x3E844006 }} }
+	},
+	/* 23 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xC0ED1FAC, 0x37541A9E, 0x82030C0C, 0x8087ADBA,
+		            0x6843531F, 0x08E14430, 0x59423367, 0x1649AE69 }} },
+		{ .w32 = {{ 0xFB47CF3F, 0xDFE51B8D, 0x1F596712, 0x8BF88A94,
+		            0x8A9C1CC8, 0x0DE0A393, 0x183DEFB9, 0x6F69EEDF }} }
+	},
+	/* 24 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x63493D54, 0xC2D2E747, 0xACFB513F, 0x0535C5D4,
+		            0x91334C4D, 0xF5122331, 0x0AB429CD, 0x5499A5F2 }} },
+		{ .w32 = {{ 0x9507FF97, 0xF5083DD0, 0x33CAFE9B, 0xFC195EE4,
+		            0x79F8D26A, 0x2E81F867, 0xA3F0AFCA, 0x415E8CC9 }} }
+	},
+	/* 25 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x8CE7D409, 0xF8855936, 0xF2FDA742, 0x3ECDC11F,
+		            0xC1A50B3A, 0xB149ED53, 0x880DCEFD, 0x6AD38CC9 }} },
+		{ .w32 = {{ 0x35510DB5, 0x2183E5FF, 0x298A948D, 0xB65BB02A,
+		            0x184E03D0, 0xB85F14F0, 0x1E7C70D4, 0x28E48AE0 }} }
+	},
+	/* 26 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xE0AD36DF, 0x182EF81A, 0xD44B99C0, 0x66E98349,
+		            0x0D4C900F, 0x60CE1B07, 0x7542E9AE, 0x477259A8 }} },
+		{ .w32 = {{ 0xB1149C1B, 0xC5918840, 0x927C844C, 0x90304AE1,
+		            0x40905F18, 0x80D11284, 0xF0E2EA5B, 0x696D9F2E }} }
+	},
+	/* 27 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xC9679737, 0x45451EB7, 0x742C88D1, 0xBBA8B79C,
+		            0x3BB5B046, 0x6CA8C946, 0x90AED877, 0x35B610A7 }} },
+		{ .w32 = {{ 0x61AB297C, 0x23394824, 0x18F82DEF, 0xAA0300D7,
+		            0x9FCC97FF, 0xBC74D970, 0xEDF48AB2, 0x4992B329 }} }
+	},
+	/* 28 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x55BF5D92, 0xAE0DAA55, 0x6456DA4A, 0x087ADB42,
+		            0xE0BB1711, 0x2E431CF3, 0x69E301C6, 0x335C5547 }} },
+		{ .w32 = {{ 0x2D2DF976, 0xADE04D1F, 0xEAA54B43, 0x108C5878,
+		            0x9AA819DE, 0x50D92C9A, 0xC4CCD9F4, 0x1DCEA22E }} }
+	},
+	/* 29 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x54EB78F1, 0x8F7E859F, 0xA798332D, 0xC5A7B77C,
+		            0x69DF2DAC, 0x77C45898, 0xD0677344, 0x41238909 }} },
+		{ .w32 = {{ 0x49263640, 0x39AFF7AE, 0x95A2D5B3, 0xD63FA7EE,
+		            0x0BC125AE, 0x657A46C5, 0xCEC6B356, 0x207FAFB9 }} }
+	},
+	/* 30 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xEED45C20, 0xB19F4AE3, 0x6F91EB1C, 0x650BB108,
+		            0x90488788, 0xBC95ACEF, 0x538C5D14, 0x0485932A }} },
+		{ .w32 = {{ 0x1318DAB2, 0x59031115, 0x4A3699EE, 0x810A87DA,
+		            0xC311E59A, 0xA24B6E71, 0xAE6C4A59, 0x640E3DA7 }} }
+	},
+	/* 31 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x569AC0CE, 0xED0F5933, 0xE0DF31FA, 0x18A54D98,
+		            0xA2199423, 0xC825FE0D, 0xE19A84D6, 0x6B0C12C2 }} },
+		{ .w32 = {{ 0xC52DE13C, 0x038C2394, 0xD6CF3C66, 0xB25BCF2A,
+		            0x5D136A20, 0xDC1E02A9, 0xE97B6863, 0x0412CE86 }} }
+	},
+	/* 32 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x0EB42C3B, 0xDD67DA38, 0x7C0F69D6, 0x7178D184,
+		            0xB2F61D79, 0xFC8324CC, 0xA801CDA6, 0x410F51D5 }} },
+		{ .w32 = {{ 0x45A43B71, 0xF937BF29, 0xE4E85224, 0x4873ACC6,
+		            0x77AF3FC7, 0x62274B8F, 0x341D108F, 0x4D94C772 }} }
+	},
+	/* 1 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xF80783BB, 0xCEBD72B0, 0x5859F620, 0x6D8FF093,
+		            0x233B4195, 0xFBCC45E3, 0xA3273B48, 0x677D517A }} },
+		{ .w32 = {{ 0x9D4AB966, 0x4067C953, 0xBC9D5F7E, 0xD0A83BFE,
+		            0xD5D8B8AA, 0x48A0A3B4, 0xA8DAAEBB, 0x000E537E }} }
+	},
+	/* 2 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xC1CE5325, 0x148E9894, 0x97098A0B, 0xE8157660,
+		            0xF3806677, 0xDEEC6742, 0x3A8BB5B5, 0x2A70787A }} },
+		{ .w32 = {{ 0xA2198ADF, 0x1DC5D56A, 0x19909628, 0x2B44E216,
+		            0x74F85553, 0xED4ECC52, 0xACC1D8E1, 0x5B5AB880 }} }
+	},
+	/* 3 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x9D16B07D, 0xF060E98E, 0x6ED253D6, 0xAAA77526,
+		            0x93E272BC, 0x4DD26E62, 0x200F507B, 0x413012B1 }} },
+		{ .w32 = {{ 0xB3CAE241, 0x734FEE22, 0x1DE954EB, 0x1B12A950,
+		            0x684DA69D, 0x8642F6C2, 0x730B5EC4, 0x2D557BC7 }} }
+	},
+	/* 4 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xB591FF30, 0xA40508AC, 0x3E5A07D6, 0x5F66345B,
+		            0x1FF8B521, 0xEB4EA9EC, 0x3514D417, 0x773AE067 }} },
+		{ .w32 = {{ 0x80648707, 0x79400A8A, 0x15C08404, 0xBF577389,
+		            0x3EC80302, 0xD85E484B, 0x61751C2F, 0x65D166F9 }} }
+	},
+	/* 5 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x6404CC55, 0xE91E2899, 0x665A8A38, 0x18B9E52F,
+		            0x3E9E6B21, 0x7329C1CC, 0x2A341CCA, 0x708E4E1A }} },
+		{ .w32 = {{ 0xEF97232D, 0x76ADB56A, 0x5BD2162D, 0x8867DF93,
+		            0x28CEC577, 0x1B9CF0C9, 0x6B34A7E7, 0x27CE1C15 }} }
+	},
+	/* 6 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x33EF4768, 0x70034711, 0x800B08DC, 0x09A5335E,
+		            0xBCF37349, 0x6515C905, 0x73E13F14, 0x0708369B }} },
+		{ .w32 = {{ 0xC7A3850D, 0x1360BFE5, 0x660442D5, 0x0E6EB34C,
+		            0x43690689, 0xB5FA00B9, 0x9A15F8BE, 0x71B6A3F1 }} }
+	},
+	/* 7 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x0134E27C, 0xC4B1A3BA, 0x37832747, 0xB459E9C1,
+		            0x2D6235E4, 0xE0E24395, 0xBF8E1613, 0x6C038834 }} },
+		{ .w32 = {{ 0x54B04792, 0x360EF43C, 0xCDC31E6F, 0x7F25443B,
+		            0x00217AA5, 0xA1CE5A5F, 0x1A535D81, 0x65B44CEE }} }
+	},
+	/* 8 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x8783BF41, 0x57ACDDB9, 0x3E0FFE01, 0x91F3C463,
+		            0x298E5217, 0xC990B124, 0x60DCCA54, 0x091B2C10 }} },
+		{ .w32 = {{ 0x8B14312C, 0xE3DB7E73, 0x2285DF51, 0x8A7A667A,
+		            0xF32A48C3, 0x5BA85F5C, 0xC946BB59, 0x5B54C233 }} }
+	},
+	/* 9 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x2A05693F, 0xF914CE5F, 0xBA06F030, 0x0AED8E2D,
+		            0x55DFB00A, 0xAD96E4FD, 0xD4B73BCD, 0x0507D506 }} },
+		{ .w32 = {{ 0x804E0172, 0xEC86AF50, 0x70A75A98, 0x4883B3C7,
+		            0xBC456856, 0xB239A7BE, 0x6ADA3221, 0x59C323B7 }} }
+	},
+	/* 10 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xD9CF3624, 0x9F63397F, 0x9D9422EF, 0xF1C6258C,
+		            0x139EA1AA, 0x78C5014B, 0xFE788C75, 0x262403B1 }} },
+		{ .w32 = {{ 0x3C36553F, 0xA16AC4B2, 0xD773A326, 0x2B2499AB,
+		            0x3A44589E, 0xA7AE1936, 0x861371FF, 0x6B14F080 }} }
+	},
+	/* 11 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xC4B71A93, 0x841E7981, 0x4D83F888, 0x2BE7F347,
+		            0x5C428723, 0xD0B42CE2, 0xC28C9445, 0x5D1FDE1B }} },
+		{ .w32 = {{ 0x58EDE5E8, 0x8B4805AD, 0x12042CCC, 0x2554CB84,
+		            0x00DA1AF2, 0x3C33E9A6, 0x2B46E8A1, 0x13047057 }} }
+	},
+	/* 12 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xD422F639, 0x1FAF70A3, 0x5B45530F, 0x8CFE5A82,
+		            0xBB10BBF9, 0x9216028D, 0x0A84B882, 0x2BC1CEA6 }} },
+		{ .w32 = {{ 0xFDA5E742, 0xB1A0C965, 0x48D2F673, 0x7E0E3D9F,
+		            0x9C1E5E57, 0x83086FD8, 0xC6A54185, 0x53B4DD15 }} }
+	},
+	/* 13 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xA39EC0CE, 0x93DDC4BF, 0xBE185516, 0x9CA6B8D8,
+		            0x8D195E5F, 0x48C8581E, 0x3CD8EF73, 0x10F3203A }} },
+		{ .w32 = {{ 0x4B2B4D73, 0xFF0F45E4, 0x952A76F4, 0xBADC2061,
+		            0x1E0AAB9B, 0xAC8C4C7F, 0xF00D99BE, 0x322185CC }} }
+	},
+	/* 14 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x64F0BE8E, 0xBDEB8510, 0xA8D15D76, 0x14470D06,
+		            0x2768B68F, 0x9AD62032, 0xB1ABC16A, 0x14060693 }} },
+		{ .w32 = {{ 0x8FCFC5A3, 0x771CFEE1, 0x0C0B527B, 0x55B7C6E5,
+		            0x51F9C71C, 0xDCA5C3B4, 0x6118B293, 0x439AF3C3 }} }
+	},
+	/* 15 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x1EC640FF, 0x3679C330, 0x117FE06E, 0xFF547B66,
+		            0xC550B055, 0xBC35AC67, 0xCE4C9F43, 0x66E54790 }} },
+		{ .w32 = {{ 0x9616D2BF, 0x6A266E06, 0xB6B5A8AD, 0x8A210731,
+		            0xFBB42E07, 0x6E01C0D3, 0x7C9E73FB, 0x2F4F3618 }} }
+	},
+	/* 16 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xD4DDD67B, 0x39B86011, 0x662AC1C8, 0x9600E6CC,
+		            0x99A502A2, 0xEAC823BF, 0x52750D56, 0x20DF4B64 }} },
+		{ .w32 = {{ 0x52ADEFB5, 0x38BD3918, 0x38FEBAC5, 0x8A61AD04,
+		            0xC4A0D357, 0xF2E098A3, 0x70F5F608, 0x5FD50938 }} }
+	},
+	/* 17 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x4B2682AD, 0x2EEB6199, 0x2D687DC2, 0x47481494,
+		            0x8C3FF576, 0x26FA6894, 0xF2DE9EDA, 0x06FE1E44 }} },
+		{ .w32 = {{ 0xD9DD137F, 0x10F1F679, 0x754B2C8F, 0xF20B5798,
+		            0x12D03275, 0xE79B487F, 0xCF2214E4, 0x522EAEBA }} }
+	},
+	/* 18 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xEEF5DC2F, 0x09B9AB7A, 0x11EAF763, 0x0326C32E,
+		            0x01B579DE, 0xA035F74D, 0xA0B55EB0, 0x33824C89 }} },
+		{ .w32 = {{ 0xACAFD6B7, 0x30E5E369, 0x466C066F, 0x28F87EB8,
+		            0xB69E0E97, 0xCC82769C, 0x331A92B1, 0x226BA03C }} }
+	},
+	/* 19 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xE64D6908, 0x3D5FD165, 0xE393C38C, 0x4F3511DE,
+		            0x05C93157, 0xB3569611, 0x65CE70DD, 0x5DFFCF47 }} },
+		{ .w32 = {{ 0x20B96978, 0xB75FEBC4, 0x153D3200, 0xA45000CA,
+		            0xBEAF5CF6, 0x511F63FE, 0x19D979E2, 0x66BCAF4A }} }
+	},
+	/* 20 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x48C996ED, 0xA8FDDD23, 0xB8097605, 0x7DA0AB54,
+		            0x6732616B, 0xBDDC3659, 0x3C02E7C1, 0x3106D37F }} },
+		{ .w32 = {{ 0x7F6129F5, 0xA6BD9B64, 0x6CE6F234, 0x479BDF39,
+		            0xEFB521DC, 0xF8038064, 0xA56747B9, 0x5EF98017 }} }
+	},
+	/* 21 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x4FDADBE8, 0xDABBCEA8, 0xE837F7F6, 0x632A8DC2,
+		            0xC04D5E83, 0xA2C39E2A, 0xB00A491E, 0x6278BB97 }} },
+		{ .w32 = {{ 0x88F36408, 0x798BCF3F, 0x446AB09D, 0x231B5D2E,
+		            0x5F470C69, 0x5FE740BF, 0x5763B87C, 0x57FFCB3F }} }
+	},
+	/* 22 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x207BA8C7, 0x78932B38, 0x3AED1FAC, 0x8A00C0AF,
+		            0xF5858E44, 0xC3108407, 0x96C9EA0B, 0x66C4F22B }} },
+		{ .w32 = {{ 0x35BB10CE, 0xEFD7F280, 0x60B4B5C5, 0xA6473730,
+		            0x244FAF20, 0x6862A406, 0x1FE7D0D0, 0x49B93FCF }} }
+	},
+	/* 23 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x69CE701B, 0x7018BCF4, 0xF6AEE6EE, 0x1F24C660,
+		            0x1591A6E5, 0xAA770C3C, 0x702A17BB, 0x16CEA7D0 }} },
+		{ .w32 = {{ 0xDC20730B, 0xD5A4F935, 0x609339D1, 0xE023906C,
+		            0x3733DAF4, 0xECF1CB61, 0x4390F79B, 0x697EB378 }} }
+	},
+	/* 24 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x9D1780D9, 0x4F449192, 0x3CF72789, 0x520CAE64,
+		            0x8DB31C44, 0xF710056A, 0xFA065961, 0x2EF4ECA6 }} },
+		{ .w32 = {{ 0x43275F2C, 0x8CB5BFA1, 0x86238CD1, 0xFE9C1A59,
+		            0x875F441A, 0xC8A37F53, 0x3751D40A, 0x38782D63 }} }
+	},
+	/* 25 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xD0818159, 0xC7956742, 0x9690A4C8, 0xF905FF4F,
+		            0x36075042, 0xF5782F98, 0x34B57A43, 0x3319C49E }} },
+		{ .w32 = {{ 0x29605D59, 0xB7DD95CB, 0x23E8D650, 0x3B122357,
+		            0x37309069, 0x49D18738, 0x3C4E7BD2, 0x27E66FE4 }} }
+	},
+	/* 26 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x65B88B3C, 0xDA278EB8, 0x5C3DE05E, 0x02EC5528,
+		            0x8B72E052, 0xFEB3F7B7, 0x399DF665, 0x7D84411F }} },
+		{ .w32 = {{ 0x4CA350E9, 0x28158B24, 0x0932A7C1, 0xDEF78390,
+		            0x4D1F224D, 0x92DAEA7C, 0xE50451E1, 0x31E4DFBC }} }
+	},
+	/* 27 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xC7A7E0E5, 0x770A70FE, 0x57E3F265, 0x19DE05FF,
+		            0xF7140694, 0x58FAA801, 0x923AEEA2, 0x4437BFBD }} },
+		{ .w32 = {{ 0xD1D5EA3B, 0x6E50A7D7, 0x4775059D, 0x8BFA359E,
+		            0x5EA1D396, 0x20CC62C4, 0x2F4D535E, 0x6E5038E7 }} }
+	},
+	/* 28 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xB1DBB668, 0xA79CE9FC, 0x8C01F78D, 0xEA41B057,
+		            0xC59FC51E, 0xD9B9AD00, 0x294C1B04, 0x76A5B90D }} },
+		{ .w32 = {{ 0xC2D9AD4B, 0x698FF8A7, 0x29C913DB, 0x9311CBDF,
+		            0xD6766984, 0xF5DD1ECE, 0x4ED526B1, 0x2D8D7030 }} }
+	},
+	/* 29 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x5C6ACE08, 0xDDDF189F, 0xA040AE67, 0x9A52C751,
+		            0x731A0A17, 0xA826AD50, 0xEF7D0305, 0x62A3E310 }} },
+		{ .w32 = {{ 0x10638596, 0xA6381473, 0x0083ADE8, 0x73D7F7ED,
+		            0x720F5479, 0x5CF557A7, 0x0693EFA8, 0x36A8E67E }} }
+	},
+	/* 30 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xBB77E58D, 0x5159ECBA, 0xCFDE207C, 0xA355DA8C,
+		            0xB3884AA4, 0xD8DF173B, 0x50A0A147, 0x23BFB847 }} },
+		{ .w32 = {{ 0x656E8052, 0xA4CF3B36, 0xE2241D2E, 0xE2AEC7BF,
+		            0xAFE5B9FD, 0x0370E248, 0x24640E22, 0x0432F2A3 }} }
+	},
+	/* 31 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x00704FC5, 0x6D08C3E0, 0x9069D53E, 0xC509856D,
+		            0xF06E68D3, 0x7C08F323, 0xB03B4A26, 0x2AF518CC }} },
+		{ .w32 = {{ 0x5E4C75BD, 0x06FBCF31, 0xF1D85D99, 0xBE6635DE,
+		            0x3D3E62DD, 0x993C316C, 0x12995040, 0x2EF69EFE }} }
+	},
+	/* 32 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x8CD22802, 0x649FCBF4, 0x0D91A4D1, 0x0DCBF26C,
+		            0x1692B219, 0xAF37A445, 0x198074DD, 0x7F73B168 }} },
+		{ .w32 = {{ 0x3BFCB329, 0x43098D62, 0x10BE3D0F, 0x3EFAD816,
+		            0xEEE7AD08, 0xAA9DBCA2, 0xB1D235A4, 0x697E2FD2 }} }
+	},
+	/* 1 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x49A387B1, 0x299651B1, 0x0EA619DD, 0xDBBBF3CA,
+		            0x0447FC6D, 0x32B9793D, 0x48FD74BD, 0x5B0539CA }} },
+		{ .w32 = {{ 0x464B007F, 0x7A9A2C16, 0x62B189C8, 0xE508F756,
+		            0x67ADAB60, 0x03392299, 0xBF5D806A, 0x21E5BFE4 }} }
+	},
+	/* 2 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x3C884959, 0xF64B79D9, 0xAC0E0B1E, 0xB251DCFE,
+		            0xC8983EDD, 0x58A9A996, 0x4BE960EE, 0x6336494A }} },
+		{ .w32 = {{ 0xFF86D6E3, 0x0C96BE28, 0xCA1E25A2, 0x0A09592D,
+		            0x464938F7, 0x695E57BE, 0x63961EB4, 0x4F61E6B8 }} }
+	},
+	/* 3 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x47BDD5E2, 0x778CBF55, 0x9E30D01E, 0x3A27EC8F,
+		            0xEFF3D017, 0x8C5EBE33, 0x462227E7, 0x0E09365D }} },
+		{ .w32 = {{ 0x3177B04C, 0x48564E6A, 0x7B3A521E, 0x6F6E360D,
+		            0x82DF23BB, 0x65633314, 0x112B0B14, 0x09D6D0BC }} }
+	},
+	/* 4 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x62013ABB, 0xEB1402F8, 0xCB9A3CAF, 0x726CE071,
+		            0x7E5C377D, 0x05A0C0E3, 0xDE4F58DE, 0x2F430D8B }} },
+		{ .w32 = {{ 0xC861FA49, 0xA579EB87, 0x98CEB220, 0xD493015D,
+		            0x3717BF69, 0xB3BA5F65, 0x55B15EF8, 0x144BDE48 }} }
+	},
+	/* 5 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x22FFC155, 0xE8ACF6B3, 0x395D1744, 0x96FCF4C8,
+		            0x5FA28430, 0xA8172E14, 0xAF670D78, 0x51120313 }} },
+		{ .w32 = {{ 0x02639F0C, 0x74D74596, 0xCC7BEE01, 0x038FB618,
+		            0x15084D21, 0xC9738E8F, 0xF3AA3A38, 0x6C0461C3 }} }
+	},
+	/* 6 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x89911FA5, 0x0FF4B381, 0xE4696279, 0x323F3CAC,
+		            0xB754FE64, 0x8B16307F, 0x8E2F729F, 0x12C68BEF }} },
+		{ .w32 = {{ 0x0367C664, 0x8591E1D7, 0xD984C4C0, 0x7784D4A1,
+		            0x4FB3AF7F, 0xFC0B24DD, 0x61CE91B8, 0x1B8C613A }} }
+	},
+	/* 7 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xB3D218FF, 0xAD3D5EA0, 0xD9E27F66, 0x6FC9D7A8,
+		            0x360755AA, 0xCDA645EA, 0xA66796A7, 0x629AD6AF }} },
+		{ .w32 = {{ 0xCFC1C383, 0x21A115AE, 0xF1928F9C, 0xA88FF348,
+		            0xC7454E17, 0x7F075335, 0xA4900326, 0x4914ADF6 }} }
+	},
+	/* 8 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xCBE23870, 0xC9D74325, 0x92EB5981, 0x3C8F7997,
+		            0x0E4ACC9D, 0xB4D3EBF2, 0xF9CD4639, 0x5D505019 }} },
+		{ .w32 = {{ 0x5E47E695, 0x8FA137B8, 0xC53F8D60, 0x15A6AA40,
+		            0x4D13094E, 0xCE4451C4, 0x48AE6218, 0x18744EBC }} }
+	},
+	/* 9 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x3BD01072, 0xA89D6B99, 0x8AB7FC32, 0x73FEBFAE,
+		            0xF46F44DB, 0x9771E034, 0xB8224292, 0x795D0FAF }} },
+		{ .w32 = {{ 0x9533D26A, 0xCD30D54E, 0x665D729E, 0xCB5634D3,
+		            0xF2A93AC6, 0xB476A72D, 0x5D338D57, 0x69AC9DD2 }} }
+	},
+	/* 10 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xDCBDB3FC, 0xEAE4FA5A, 0x8EE2AC55, 0xB0078390,
+		            0xFABF3067, 0xADBC3403, 0x954AC433, 0x1319EA17 }} },
+		{ .w32 = {{ 0x2306A9AC, 0xD9305641, 0x72C38A36, 0xBB02A1C8,
+		            0x01FC3CEF, 0x85407BBF, 0x3497AF02, 0x4C84746E }} }
+	},
+	/* 11 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x92E21937, 0x69F0C1EF, 0x26B5ED00, 0xDE3EE028,
+		            0xCAC80176, 0x34D960BB, 0xB42CA279, 0x55D87571 }} },
+		{ .w32 = {{ 0x990A7869, 0x418DDE6E, 0x6E16D67C, 0x732644B0,
+		            0x2EEEEA7A, 0x867EF40F, 0x352CF5CB, 0x1FA30D69 }} }
+	},
+	/* 12 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x9878F9DB, 0xAE73BAA0, 0x19F2619A, 0x81DD49A9,
+		            0x3FFFED9F, 0x531E0775, 0xE9D4FF45, 0x327D1155 }} },
+		{ .w32 = {{ 0x88262FB2, 0x770D9B75, 0xFB7617E9, 0x0CC26E65,
+		            0x3666210E, 0x2774434E, 0xA5D87688, 0x048982B6 }} }
+	},
+	/* 13 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x2E4AA720, 0x2439D2EE, 0x5E8C58E2, 0xF0135B84,
+		            0xCC37182B, 0x0CC32D1C, 0xC4D826F6, 0x49D919D0 }} },
+		{ .w32 = {{ 0xCCFA0A32, 0x1EEA4060, 0x59555424, 0x2E203E14,
+		            0x6B2D9B88, 0x556BE1F3, 0x5DE1A48F, 0x543897E2 }} }
+	},
+	/* 14 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x35CAE574, 0x6DC812C7, 0xD6CA1CCB, 0xB002EDB8,
+		            0xAC708000, 0x1605D774, 0x6832E078, 0x19315675 }} },
+		{ .w32 = {{ 0xF76FE2D8, 0x9AA68C20, 0xDD83B1AA, 0x06A8BC49,
+		            0xA57BA919, 0x139E5D9F, 0x09F12373, 0x332E6463 }} }
+	},
+	/* 15 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x1327E232, 0x25515060, 0x38E4DDA1, 0x42E46590,
+		            0x5454A7A4, 0x7E10ABAC, 0x55008358, 0x46AF66CA }} },
+		{ .w32 = {{ 0x81DE97E5, 0xB75E6AA7, 0x77B2B286, 0xC7C6FE1B,
+		            0x508044C5, 0x3101744D, 0x5432A8BD, 0x331C3BBA }} }
+	},
+	/* 16 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x57F8DCE6, 0xB5FFEA97, 0x0950F49E, 0x992EAADD,
+		            0x764DB296, 0xC30EE566, 0x736A26DC, 0x77BEE9FA }} },
+		{ .w32 = {{ 0x80F79129, 0xFB851AF6, 0x257C7B20, 0x778C527D,
+		            0x5D029FDE, 0xCE22C912, 0xA0BB0631, 0x78B27925 }} }
+	},
+	/* 17 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x6287EB14, 0x5721F375, 0xF96F6F28, 0xE29D01CE,
+		            0xA2252AB8, 0x803EAA47, 0x5CC59EE0, 0x501A0F9B }} },
+		{ .w32 = {{ 0xC241929E, 0xDE868901, 0xE22D8602, 0x06A25DD1,
+		            0x8E4ABA75, 0x721D408D, 0xF7921A01, 0x0A658D27 }} }
+	},
+	/* 18 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x87455A33, 0x1908F9F6, 0xC7E0FAD1, 0xD1533E25,
+		            0x1445AAB7, 0xF01AA535, 0xD93A70EB, 0x17AD16B5 }} },
+		{ .w32 = {{ 0xE4A3121D, 0xB4866623, 0xBD545F12, 0x32370F35,
+		            0xB1D020A6, 0x0D43D293, 0xCF5759A4, 0x385FB60A }} }
+	},
+	/* 19 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x130F93C6, 0xEB57EE7B, 0xCE0E01B8, 0x87517192,
+		            0x6DFD0E43, 0xFA16FA8C, 0x4C69A049, 0x5757E06A }} },
+		{ .w32 = {{ 0xD4455518, 0x1475374A, 0x91548EED, 0x65C1CAB5,
+		            0xF9D66D6F, 0x1EA242A0, 0x68466D11, 0x2446D833 }} }
+	},
+	/* 20 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x134843C0, 0x03E1FB66, 0xBA328A4B, 0x3EFC375A,
+		            0xE6695FB0, 0x6D2E6E18, 0xC13F0984, 0x316E0D11 }} },
+		{ .w32 = {{ 0x1176EF85, 0x856C97E2, 0xF9CA487A, 0x37ABFB32,
+		            0x9787B3A0, 0x6333F072, 0xC6C6A058, 0x70F9B9B8 }} }
+	},
+	/* 21 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xA4793504, 0x153A09F2, 0x0B9C98F7, 0xAD8BB3B9,
+		            0xEC81D021, 0x314F39FB, 0xD0735890, 0x58F87341 }} },
+		{ .w32 = {{ 0x3FA4588E, 0x1A7A4199, 0x120593B8, 0x6AEFECD8,
+		            0xBDF7E10B, 0xF901CEE4, 0x01C97211, 0x5D181AD5 }} }
+	},
+	/* 22 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x69BAB96B, 0x93972CB8, 0xEDA5201C, 0x163B298A,
+		            0x62696953, 0x4FD9BA74, 0x5E6D9CB0, 0x4F4E047F }} },
+		{ .w32 = {{ 0xD721627C, 0xBE3DB9A3, 0x7D2C6AA6, 0xB486719A,
+		            0x16D24BE9, 0xCED1B21F, 0x344EE18C, 0x70A163C8 }} }
+	},
+	/* 23 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xA435C8B3, 0xEDC7F154, 0xEF406FD5, 0xC3BE237D,
+		            0xEECDC316, 0xE070C8DF, 0x6F1DB985, 0x440AF1CE }} },
+		{ .w32 = {{ 0x321F9ADF, 0x5ECA86FE, 0x7388E389, 0x53EF86A3,
+		            0x75FA7088, 0x06BFD8FA, 0x5D83E7FF, 0x59A99878 }} }
+	},
+	/* 24 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xF4FB8115, 0xF4762F3F, 0xC8F29371, 0x60D22515,
+		            0xA6B9C81A, 0xE64A746F, 0xEED2E10E, 0x107BB7D6 }} },
+		{ .w32 = {{ 0x69034AF7, 0xB89D6D31, 0x00C26192, 0xA7ADDD10,
+		            0x751BE109, 0x7E47A9A2, 0x4EE50A29, 0x208EFEFA }} }
+	},
+	/* 25 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x4D94FC19, 0x0B3893A1, 0x6AB78F90, 0x0BAAA883,
+		            0x024AFE1E, 0x22153D05, 0x2CA977AD, 0x51125B28 }} },
+		{ .w32 = {{ 0xE1936E9C, 0xF2099D99, 0xA4722DCB, 0xD9E96C59,
+		            0x44ED223D, 0xD2E82EEA, 0x8D513DBB, 0x1B791238 }} }
+	},
+	/* 26 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xBDBF6C1C, 0x0AC6C874, 0x820B546F, 0x952B8CF3,
+		            0x1D127EA8, 0xF15D28E5, 0x0AEEB9BB, 0x58090E66 }} },
+		{ .w32 = {{ 0xA5397B8A, 0xCE560026, 0x7D35A54D, 0xB52142E6,
+		            0x02F47203, 0x4168BC8E, 0xBC9BC367, 0x1F3B283F }} }
+	},
+	/* 27 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x5DF0324D, 0x6E400CEC, 0x84CE90C5, 0x5D18E9F8,
+		            0x2B443C1F, 0xEE2049C2, 0x97213B6B, 0x186274F0 }} },
+		{ .w32 = {{ 0xBEFE1D81, 0x4D46E954, 0xFDEA92C8, 0x08234B95,
+		            0x7F06464F, 0xA0A6F025, 0xC377C34E, 0x7F47B7EA }} }
+	},
+	/* 28 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x524CF89C, 0x90FBD6B0, 0xA0F9B48D, 0xA087DD3D,
+		            0xA49DE22C, 0xB6D04C1A, 0x97857C48, 0x6AD8892D }} },
+		{ .w32 = {{ 0x97D9FFF0, 0x95000CAB, 0x796AD877, 0xDB8CF4AC,
+		            0xC265701C, 0xD4295BF2, 0x4CCD8CF5, 0x4C7711C5 }} }
+	},
+	/* 29 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x25B88711, 0xD1602CA4, 0xD203FBF6, 0x0857765F,
+		            0x1E1CCE40, 0x6B10ADC0, 0x982F8F98, 0x6CC7777F }} },
+		{ .w32 = {{ 0xF564D28C, 0x24D363CE, 0x337E1E8D, 0x70CD46CA,
+		            0x626C6688, 0x569ED77A, 0x718EDFF1, 0x40C18EFE }} }
+	},
+	/* 30 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x86BB5BFE, 0xDBC46D4F, 0x68F4006D, 0x8142F5CA,
+		            0xDE23D46C, 0x9CA5C5A3, 0x8BE72D20, 0x3D837D8F }} },
+		{ .w32 = {{ 0xD5102C33, 0x742E97E4, 0x0DD1960E, 0xF0F1F600,
+		            0xBA387D06, 0x0464CA01, 0xEA3B9299, 0x06DB1471 }} }
+	},
+	/* 31 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xCA526497, 0x45D55336, 0x84F54711, 0x9541F6C1,
+		            0x1327F44D, 0xCB511C9A, 0xDD90242B, 0x0EE92BB1 }} },
+		{ .w32 = {{ 0x90268FB7, 0x380FC5FF, 0x05119773, 0xEED54EC5,
+		            0x0D75B1C9, 0x014A143C, 0xF892A9F0, 0x5D0F5F5D }} }
+	},
+	/* 32 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xFC389D68, 0xA0C19926, 0xF4C2CCCD, 0xD93A4C18,
+		            0x0DF8E02C, 0x09EB7E08, 0x71F691C5, 0x5CD950BF }} },
+		{ .w32 = {{ 0x88C1360E, 0x8D938B29, 0x5AF8E2FD, 0x9056455F,
+		            0x6CBF3650, 0xD0385C15, 0x67D362F3, 0x1D4E5726 }} }
+	},
+	/* 1 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x91669C8F, 0x4986F2F5, 0xEF78C17F, 0xBB45DFB0,
+		            0x7F3B6444, 0x05402E98, 0x86B16FD5, 0x54BCCE86 }} },
+		{ .w32 = {{ 0xF9D11BF8, 0x4DF4C324, 0xC4F60694, 0x8E0F8B3A,
+		            0xBE4A5E17, 0x854DF491, 0x2E88B382, 0x2B278FB8 }} }
+	},
+	/* 2 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x7AEE07C8, 0x80F8EEAA, 0xE20DC5BB, 0x972CBFAA,
+		            0x70292E9D, 0x36AFFDA1, 0x5A563D72, 0x5AEC2263 }} },
+		{ .w32 = {{ 0xA9E5AFC6, 0xF857C44C, 0x87ACC6FF, 0xB211BB41,
+		            0x4B231456, 0xB39B816A, 0x1C79FDD7, 0x7293EAE7 }} }
+	},
+	/* 3 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x23A6166E, 0x732E701A, 0xC20F4745, 0x31C6DDD5,
+		            0x0966895F, 0x17CD68AC, 0x8B71240E, 0x5777ADB9 }} },
+		{ .w32 = {{ 0x4DAC8A71, 0x99236F05, 0xBBD773D5, 0x4525C116,
+		            0x329766B2, 0xD81A69C4, 0x1F09AAE6, 0x324B0CA5 }} }
+	},
+	/* 4 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x0AAEE0FE, 0x8A4E4912, 0x8B333E29, 0xC8E9F1EA,
+		            0xF71EECE2, 0xC8AABBF8, 0xA9616504, 0x010E1FCB }} },
+		{ .w32 = {{ 0x7E8CB6AC, 0xF746AD8F, 0x6FAF3B6E, 0x6A0AFC47,
+		            0x3077F8D4, 0x5BB67757, 0xF15F5461, 0x6AA55FC7 }} }
+	},
+	/* 5 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x819A857E, 0x7E68F527, 0xCBD89966, 0xA7D303ED,
+		            0x5E7E9F1F, 0x7A50601A, 0x6754F9F4, 0x3D5D8A7E }} },
+		{ .w32 = {{ 0xAC8035B6, 0x94E9BBBD, 0x529BC0C2, 0x4C3F9844,
+		            0x71209252, 0xACDB2132, 0x28DD5B2E, 0x4BEEE345 }} }
+	},
+	/* 6 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x04AA3195, 0x0207B1F0, 0x3B658212, 0x64F38CB6,
+		            0xA211195E, 0xFC3E1FC6, 0xC849AB1C, 0x60A24FC4 }} },
+		{ .w32 = {{ 0xF90B5897, 0x9E23BFA1, 0xF3B666CF, 0x06EA14AF,
+		            0xFAC187F9, 0x2835DB3B, 0xAEBD1AD0, 0x1B34B670 }} }
+	},
+	/* 7 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xBF49B717, 0x121A34F8, 0x22FF4580, 0x64B6DF62,
+		            0x658DFAD8, 0x28EDE0CE, 0x1B70162A, 0x23D53535 }} },
+		{ .w32 = {{ 0x814A36DB, 0x6E7A163F, 0x31BCEAC3, 0xBAB4E0FA,
+		            0x8A3EAB41, 0x1AAB903A, 0x1BC2663F, 0x44F0EA52 }} }
+	},
+	/* 8 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x007C2B4C, 0xB4EBF5BB, 0x4BD3253A, 0x6B12A5B0,
+		            0x15A81B81, 0x4D6D177C, 0x67C71EC4, 0x4A2F1D74 }} },
+		{ .w32 = {{ 0xA934CD7F, 0x46EBB087, 0xD2D68C5B, 0x2C10DD2C,
+		            0x12B15BD7, 0xAEE58FB3, 0xBA954433, 0x18238200 }} }
+	},
+	/* 9 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x0A6576F7, 0x329562FA, 0x334FC824, 0x84BDB5AC,
+		            0x524297B5, 0x3A7EFA14, 0x6599D60B, 0x1F9F0FBF }} },
+		{ .w32 = {{ 0xD190BD0B, 0xAA321639, 0xFA49487C, 0x878BDD79,
+		            0x2288FAE8, 0xAEBB6489, 0x20CFE2AA, 0x101C1574 }} }
+	},
+	/* 10 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xD20C43A0, 0x4DF62E08, 0x870CFC86, 0x692A7369,
+		            0x2A564504, 0x263A2D62, 0xD532E9ED, 0x1C8A2548 }} },
+		{ .w32 = {{ 0xEAFC72B5, 0x8CB20755, 0x3C9E483F, 0x22EECB23,
+		            0x10400557, 0x63AB8B58, 0x3241AB76, 0x6ECA0199 }} }
+	},
+	/* 11 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xD17B3248, 0xD0B55823, 0x451D1269, 0xA97D05A7,
+		            0xAA5F886E, 0xDF17BBF7, 0xFE012B03, 0x6F805B7A }} },
+		{ .w32 = {{ 0xAAD95545, 0x3CB48DD9, 0x31E3CE68, 0xC63B54B2,
+		            0xDB8B494C, 0x05A0F974, 0xBFF1CD99, 0x66BB7B26 }} }
+	},
+	/* 12 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x313297BF, 0xC86B9BA2, 0x9DAEB1D6, 0x848B9AA8,
+		            0xA2079FD1, 0xA53463D4, 0x788F9FA8, 0x1BF75BBB }} },
+		{ .w32 = {{ 0xB6B98E50, 0x796FF757, 0x6997FEC0, 0xD6ABAF87,
+		            0x3360F687, 0x20E7B161, 0xCEB95AA6, 0x77109159 }} }
+	},
+	/* 13 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x76933652, 0x48348FAD, 0xBF811BC4, 0x27412121,
+		            0x2300CCA2, 0x072365FE, 0xFAA77EDF, 0x1C191CCA }} },
+		{ .w32 = {{ 0x99B00F53, 0x6E2B069A, 0x8AA28D68, 0x947679DD,
+		            0x0733EAE7, 0x1D76BC1D, 0x8C67BC2F, 0x27005243 }} }
+	},
+	/* 14 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x8FE1E321, 0x69935199, 0x141DCA5C, 0x730AA7A9,
+		            0x3024FE11, 0xB17978E4, 0x2F000571, 0x4B6CF907 }} },
+		{ .w32 = {{ 0xF811689A, 0x02F64CD6, 0x49DB00C0, 0x7AB9ED35,
+		            0xF3698657, 0xDE6E3476, 0x21876AFA, 0x3DB9EFD8 }} }
+	},
+	/* 15 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xC2CCD57F, 0xE5D85F2C, 0xCB92195D, 0xAC048055,
+		            0xFDFE780F, 0x062E4E04, 0xE58B9D13, 0x258C7A67 }} },
+		{ .w32 = {{ 0x268B5E77, 0x37DD2B87, 0xA771439D, 0x65E95A2F,
+		            0x95F16201, 0xFC6B86A4, 0x8598CB27, 0x2FBECE87 }} }
+	},
+	/* 16 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xFACB599A, 0x99C1A7BA, 0xCFFF1DAC, 0x8971FCDC,
+		            0xACF342B2, 0x7BE7AC43, 0x1BBD499A, 0x028FB679 }} },
+		{ .w32 = {{ 0x95A3D268, 0xB587DEA7, 0xF99E7516, 0x167CCA79,
+		            0xF926C35F, 0xE6277102, 0x47031BB2, 0x70B19B99 }} }
+	},
+	/* 17 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x46B0BDC9, 0xD23C9F24, 0xDC1C021A, 0x4ABA5620,
+		            0x56C732F2, 0x2402AD14, 0xDB325215, 0x3D810ED8 }} },
+		{ .w32 = {{ 0x8EAFE18F, 0xC3BC27FC, 0x92AE7EFA, 0x755EC936,
+		            0xB065818F, 0x4B1EB0BF, 0x0121B4CF, 0x6D527D45 }} }
+	},
+	/* 18 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x9439038A, 0x96BB6DD3, 0xC92F97F7, 0x73BDDE2C,
+		            0x84339C30, 0x8850273F, 0x802F348D, 0x23808D49 }} },
+		{ .w32 = {{ 0xCA04CD8B, 0x80BBB49D, 0x568E53E4, 0x6E60EE7F,
+		            0x0A2C5A91, 0x5C435D07, 0x59447C26, 0x05612F6E }} }
+	},
+	/* 19 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x055D2917, 0x5B6C1295, 0x3F94C08F, 0xF4790696,
+		            0xDEBDF1E1, 0x9A472A50, 0xBC79E797, 0x3FC3D075 }} },
+		{ .w32 = {{ 0x1DF96D48, 0xF892A00E, 0x672E12FD, 0x7AB89C55,
+		            0xD2C0ECF3, 0x967A176D, 0x4814CE3B, 0x00E9EB5D }} }
+	},
+	/* 20 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x039358AD, 0x29FE2F02, 0xC97ECCBB, 0x74A9151F,
+		            0x885FEC11, 0xB985BE98, 0xD66C621B, 0x4A8A98A1 }} },
+		{ .w32 = {{ 0x6CF80087, 0xC668D74C, 0xE3F5CC3B, 0x0EE5C1A6,
+		            0x3858EB98, 0x4B5D9860, 0x97176BBE, 0x63BDBD9B }} }
+	},
+	/* 21 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xB534548D, 0xE8822900, 0x3386E676, 0x999DCFC2,
+		            0x75925574, 0x521358EC, 0x820B39AC, 0x18417755 }} },
+		{ .w32 = {{ 0x899AC19A, 0x6CCBC782, 0xF284C735, 0x8CB6852B,
+		            0xCA366D75, 0xCF360391, 0x14A125F2, 0x71440B87 }} }
+	},
+	/* 22 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x05C8E31D, 0x37D2967E, 0x56B56435, 0x7884ECC4,
+		            0xB7809303, 0x7EE43F76, 0xBCE5661C, 0x765943A8 }} },
+		{ .w32 = {{ 0x98200BE0, 0xA457EFC6, 0x5ADE9603, 0xBE97E024,
+		            0xDC9E9A2B, 0x99A43BFF, 0xDA31C8A3, 0x6E19934D }} }
+	},
+	/* 23 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x651C0DF8, 0x6849DBF6, 0x9E8E0504, 0x1814E0CF,
+		            0xF2212524, 0xBA2E3ACA, 0x367EB1C0, 0x54E4103A }} },
+		{ .w32 = {{ 0x76B823BF, 0x6761ED6F, 0x4383BBE2, 0x793102D3,
+		            0x86CD45A5, 0x2A70180B, 0xD5DF1E8D, 0x1B2B5449 }} }
+	},
+	/* 24 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x0099E69E, 0x186FB058, 0x9ADAAAAE, 0xDC595D41,
+		            0xFE7912A5, 0xCAA091F5, 0x38361008, 0x0B56E2AC }} },
+		{ .w32 = {{ 0x14A1FB88, 0xAB4A23DA, 0xFD4DAE27, 0xDD35D807,
+		            0xAA6A68EB, 0xDAC21976, 0x3EE47587, 0x20DFA852 }} }
+	},
+	/* 25 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x25D1DFFF, 0x763D8027, 0xB0F5AE8E, 0xF2F8CA3C,
+		            0x63815254, 0x5CD8AF83, 0x777419F6, 0x09E72E3E }} },
+		{ .w32 = {{ 0x35ED5CEC, 0xAEB6259E, 0x69D4D588, 0xEF8E63FF,
+		            0x05840A8D, 0xB4F11658, 0x2B36D448, 0x43AFE538 }} }
+	},
+	/* 26 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x0D6155AE, 0xDB8698E2, 0x81323F69, 0x3CF5DB4A,
+		            0xB36D2C51, 0x061CDB83, 0x3A46076C, 0x302A7F13 }} },
+		{ .w32 = {{ 0x3D9B384C, 0x848B1000, 0xBF9C57DF, 0x633AC6B3,
+		            0xEB93EF07, 0x16138482, 0x5E12A43C, 0x68042AFB }} }
+	},
+	/* 27 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x4CFEB22A, 0xE18BA82D, 0xA868478E, 0x5446BE4B,
+		            0x519A391B, 0x8097FC2E, 0xA2718162, 0x6F0336AD }} },
+		{ .w32 = {{ 0x59C72E3E, 0xA7344EB9, 0x01193C65, 0x79CBB94C,
+		            0x96C9236D, 0x025E42B7, 0xCF166582, 0x5597AB69 }} }
+	},
+	/* 28 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x655D07FA, 0x9E14FF27, 0x13AC4112, 0x92A16F45,
+		            0x43A27F8F, 0x92942DA3, 0x1F916458, 0x0CD021C0 }} },
+		{ .w32 = {{ 0x927F46B3, 0x3AC6CB2C, 0x7222D121, 0x6CA7954F,
+		            0xF5073AFB, 0xB230BC2C, 0x3FDCAFC4, 0x0D9C9F37 }} }
+	},
+	/* 29 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x09C2B8F8, 0x5443489D, 0xFE824EA9, 0xD25551B1,
+		            0xD6C35E6F, 0xD0689CAC, 0x64FA35C2, 0x2484AB84 }} },
+		{ .w32 = {{ 0x936037A6, 0x96B29D95, 0x071ECA97, 0x094551AC,
+		            0x00B11080, 0xA0511C73, 0xEE88EA41, 0x70AE1ED0 }} }
+	},
+	/* 30 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x03C6162A, 0xD4BC3A00, 0xCD230E4D, 0x48329283,
+		            0x9EDDFA5D, 0x8BEB8A75, 0x02374E91, 0x250F40C8 }} },
+		{ .w32 = {{ 0x6463A2DF, 0x541A3528, 0x35CA0DDB, 0x7D68AD24,
+		            0x3D1B3024, 0xD467B2F7, 0x8219B22E, 0x71379CA1 }} }
+	},
+	/* 31 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x8F735B14, 0xE833B649, 0xDB0313AE, 0xC8DA9095,
+		            0xA491614C, 0x5001BF16, 0xC45F6846, 0x06D470E3 }} },
+		{ .w32 = {{ 0xC717763A, 0x6FD4A871, 0xCE1B7438, 0x8E8CDD77,
+		            0x559C17C8, 0x119FF59A, 0x1CE0C7DF, 0x4F5B26AB }} }
+	},
+	/* 32 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x7A0F0FF2, 0x8E7E5DEC, 0xA718B9E4, 0x60AFD387,
+		            0xB903F1B7, 0xC9333BC4, 0x08C5409B, 0x1C3E4E0E }} },
+		{ .w32 = {{ 0xBC9C84FD, 0xDB24B204, 0x31C84D5F, 0x8E122445,
+		            0x696E4ABD, 0xABE5E0D7, 0xD6FB10D3, 0x0734A3C2 }} }
+	},
+	/* 1 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xA26398FE, 0xED1D1093, 0xE34BD8CA, 0x302128DE,
+		            0xCF81475E, 0x26741D17, 0xB7783221, 0x3ED1F5C8 }} },
+		{ .w32 = {{ 0x0E9E0DE4, 0xA2CDFBFD, 0x11465FD7, 0x6C6D0EC1,
+		            0xFF020527, 0x2CCC6B86, 0x35CF2D41, 0x66C98225 }} }
+	},
+	/* 2 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x45F0A109, 0xED65F8DE, 0x23B0075E, 0xAAE3337E,
+		            0x9BD0E4C3, 0x04407C08, 0xAD6B73BC, 0x3F2FF2BB }} },
+		{ .w32 = {{ 0x3ED6C401, 0x217210C2, 0xA10FA471, 0xC3E4D5F3,
+		            0x78573382, 0x710767D7, 0x4684638C, 0x30FA9283 }} }
+	},
+	/* 3 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x8158C5A1, 0xF3253042, 0xA08F0667, 0xF0355385,
+		            0x950878DF, 0x8D1D7C05, 0x45EDB343, 0x6148755B }} },
+		{ .w32 = {{ 0x1097619E, 0x536EB706, 0xA0424182, 0x57ABC964,
+		            0xF6727B9F, 0x171EDD41, 0xEF32690F, 0x6C70D9D4 }} }
+	},
+	/* 4 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x190F7068, 0x18D25860, 0x143968B5, 0x963A05FE,
+		            0x0CD7CE57, 0xF794FAFC, 0x3AA6450C, 0x44FC3D65 }} },
+		{ .w32 = {{ 0x3FDA2B30, 0x5D6745A3, 0x304488A4, 0x6F6ABEC6,
+		            0x0653DD55, 0x898C2F0C, 0x534C45D1, 0x6019E4A4 }} }
+	},
+	/* 5 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xB08F16D9, 0xC54C80DE, 0xAEA55051, 0x5036783F,
+		            0xF52ECD60, 0xF21D54BD, 0x841B925E, 0x5516C50A }} },
+		{ .w32 = {{ 0xD8CC647C, 0x68091B95, 0xDEFB56FC, 0x8C48AA0F,
+		            0x63630FBF, 0x94D7AE92, 0x4BB83329, 0x0D2E8773 }} }
+	},
+	/* 6 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x298913F9, 0x23EE80AF, 0x46F94978, 0x742E9B28,
+		            0x123DF0EC, 0x5DEC06D2, 0x4677B600, 0x2F3CA75E }} },
+		{ .w32 = {{ 0x3F70DF04, 0x89E434BE, 0x4921FC64, 0x254A262A,
+		            0x29CF2543, 0xA9E32644, 0x32DC1B05, 0x33EE4CC6 }} }
+	},
+	/* 7 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x0CC5DB30, 0x4D9CACEC, 0x10EBEE71, 0x90337B06,
+		            0x47530114, 0xAF177361, 0x00045471, 0x77FE899F }} },
+		{ .w32 = {{ 0xC27B140F, 0x69FCB15F, 0xF958502A, 0xE31F537D,
+		            0x671A2A34, 0xD1B8D8AC, 0xDDC05E7F, 0x3E652472 }} }
+	},
+	/* 8 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x3DB218EC, 0xE3B253A0, 0xA389F1F0, 0x9BE58692,
+		            0x47432176, 0x45F1879C, 0x01087855, 0x086C0AA1 }} },
+		{ .w32 = {{ 0x4B55F2BF, 0x05297B49, 0xEF11018C, 0x548D542E,
+		            0x29D2AEE3, 0xD6979AC0, 0xB227715A, 0x63401D6A }} }
+	},
+	/* 9 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xDF610ADE, 0x150665A6, 0x38AC7838, 0x4C4FF582,
+		            0x75BD12D3, 0xA556F34D, 0x53E022E1, 0x74FB9E32 }} },
+		{ .w32 = {{ 0x46B34709, 0xC28D5B85, 0xAEEB3937, 0x1F816489,
+		            0xE6ECEED9, 0x2D96BC03, 0xFB76AE38, 0x463D1B38 }} }
+	},
+	/* 10 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x0887F7D0, 0x528EAA12, 0x3D5C3FF9, 0xD6314626,
+		            0xF245D6B3, 0x6CB40FB1, 0xFA222E9C, 0x1A94006E }} },
+		{ .w32 = {{ 0x1271922E, 0x72CEA33F, 0x7436DE4D, 0xF715E19C,
+		            0x25AC0358, 0x30891519, 0x14C0B2CB, 0x3DF3D68E }} }
+	},
+	/* 11 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x17021CA3, 0x0EE90A83, 0xAE497A80, 0x7F484708,
+		            0xD0525BE0, 0x98E86899, 0x02D3F4F3, 0x6990E3A3 }} },
+		{ .w32 = {{ 0xB9D6F52B, 0x6A7C70CB, 0x1CF08C95, 0x9A6813B0,
+		            0xF3CAFEC9, 0xFD9D8A84, 0x8112A71A, 0x703ECF95 }} }
+	},
+	/* 12 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x7A58913F, 0x0B331879, 0x8AA3E05C, 0x4F3B559C,
+		            0x6E6BD6F9, 0xA0897DC1, 0x9247BD03, 0x5A8B6D96 }} },
+		{ .w32 = {{ 0x9E2341BB, 0xBC78C47B, 0xB9EAD927, 0xDD496368,
+		            0xCC9E7EC0, 0x90307D6C, 0xDECDDD28, 0x1F4CED1A }} }
+	},
+	/* 13 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x18AE52EC, 0x6FA95409, 0x833C8FDA, 0xD675301E,
+		            0x3A6DBEE4, 0x8C177AA9, 0x6CDB927D, 0x5934F55D }} },
+		{ .w32 = {{ 0x4FC536B3, 0xF0E1A0A3, 0x5FD46A29, 0x06292A3C,
+		            0xF06E0150, 0x30E6B5BC, 0xEDDB0FF3, 0x227459D6 }} }
+	},
+	/* 14 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xE765D622, 0x5AAE6EDA, 0x09C2ACA5, 0x3EBF5896,
+		            0x66F8499D, 0xB7980ED0, 0x3851D175, 0x69ECE462 }} },
+		{ .w32 = {{ 0x89213919, 0xB9F52C8A, 0x40093929, 0xAB99714B,
+		            0xB2A67FF1, 0xA296EF9A, 0x55DB54B5, 0x3A4735CE }} }
+	},
+	/* 15 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xBD8AED6F, 0x60889D84, 0x967FA122, 0x723B4ECC,
+		            0x528F2097, 0x1EF14924, 0xAE95C210, 0x0A96F011 }} },
+		{ .w32 = {{ 0xE8A5D398, 0xA8519A5B, 0xB526E974, 0x3F414667,
+		            0x95509589, 0xF671B1F5, 0x74FAE589, 0x516A3C0A }} }
+	},
+	/* 16 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x446618A6, 0x0BDA40D5, 0xBEB000FA, 0xCD45F105,
+		            0xA545D3D4, 0xF9EBA4C7, 0x5CAABB32, 0x3B42253E }} },
+		{ .w32 = {{ 0xF2D87544, 0x661174F8, 0x8B21C77F, 0xEE278020,
+		            0xAD237AB0, 0x77C25228, 0xEFAA44A8, 0x472D5695 }} }
+	},
+	/* 17 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xD9B5379D, 0x549DF08B, 0xECFF012F, 0xCF2AC1E4,
+		            0xDD28E1EE, 0x5C30EC0F, 0x4E84787B, 0x611A8422 }} },
+		{ .w32 = {{ 0x9A530DAD, 0xDC9DAA4B, 0xB86BEA53, 0x3D802C37,
+		            0xA51A2FB8, 0xD973FD0E, 0x671EB070, 0x3DBDD084 }} }
+	},
+	/* 18 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xED578BC3, 0x979C612D, 0x86AEED48, 0x4AED755B,
+		            0xDFA453C2, 0x6DB2C60E, 0x8AC50D89, 0x79BB0D0C }} },
+		{ .w32 = {{ 0x72A47D91, 0x3763C08A, 0x6A7C200D, 0x78B0E247,
+		            0x922A6BE3, 0xD0FA4F1A, 0x796D1749, 0x3FDE4471 }} }
+	},
+	/* 19 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xD426CAC4, 0xB77C2EAD, 0x7F52D381, 0x870D6146,
+		            0x294E5A08, 0xE3667475, 0x39FCB826, 0x62F2CB95 }} },
+		{ .w32 = {{ 0xD7772490, 0xA229950A, 0x52E9C511, 0x0B0EAE93,
+		            0x7EDA19DF, 0xC820AB89, 0x2A528A61, 0x123242FF }} }
+	},
+	/* 20 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xFCAA03F5, 0x6F569815, 0x6CBED374, 0x26BD537D,
+		            0x08A935E9, 0x524C6875, 0xB8A61EA3, 0x0053092B }} },
+		{ .w32 = {{ 0xB4693EB7, 0xEFA7415E, 0x9711D0F2, 0xD00B727A,
+		            0xB216ABDD, 0x648555A4, 0x39840E76, 0x7DF491C5 }} }
+	},
+	/* 21 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xDA34B2E6, 0x72577FEE, 0x803EDAF0, 0x7F98A81F,
+		            0xA3B03D1A, 0x3964E1E0, 0xB163C56B, 0x71AFF4B8 }} },
+		{ .w32 = {{ 0x0548001E, 0x6BF72DC8, 0x89BDA250, 0x39A8A9AC,
+		            0x7A538CF3, 0x9C1EC3CE, 0x8B3A89FD, 0x3087411C }} }
+	},
+	/* 22 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x8F77DF7D, 0x704C448F, 0x62443EF6, 0x98B35C91,
+		            0xAA881ABA, 0x3A171701, 0xC2A88A2D, 0x00C0D321 }} },
+		{ .w32 = {{ 0xFCC4ED88, 0x34F11365, 0xEF0502C3, 0xB6DF1AEC,
+		            0x9150BEF0, 0xA94BC652, 0x3EEFD4C1, 0x7326F187 }} }
+	},
+	/* 23 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xAADE4742, 0x35A101C5, 0xB571BE46, 0xC1A928E0,
+		            0x80D45D07, 0x9B30ED27, 0x941BCF9A, 0x6049ABDE }} },
+		{ .w32 = {{ 0x5A9044D7, 0xF2E4B68A, 0x2C812485, 0xA4E817E1,
+		            0x116541D7, 0x7E8FD67E, 0x2FDD341A, 0x35223755 }} }
+	},
+	/* 24 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x1A451A45, 0x642BCCE5, 0x77E8AE14, 0xA3A28178,
+		            0x2219D8CF, 0xE7901C90, 0x3535EFED, 0x3E7E8BD9 }} },
+		{ .w32 = {{ 0xCAD22BC5, 0x4DF74D36, 0x4F40D965, 0xD8F1AF07,
+		            0x283441A2, 0xBDAAA5C4, 0x1698AAF7, 0x7986BEAB }} }
+	},
+	/* 25 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xC91D1870, 0x8631EC8D, 0x7C941C27, 0xCAA235B4,
+		            0x4467BFDB, 0x25002818, 0x750AED20, 0x1B1E10E1 }} },
+		{ .w32 = {{ 0x74B283AE, 0x831E232B, 0xC1244807, 0x51083500,
+		            0xA6B48472, 0x7A9B20E3, 0xD14E71C8, 0x40BF9374 }} }
+	},
+	/* 26 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xDC3AE854, 0x5EB73D32, 0x679FC9E6, 0x1EBBE1DB,
+		            0xB6C220C7, 0x5A922AC3, 0xB2069B2C, 0x3365F5F2 }} },
+		{ .w32 = {{ 0xD037ACDF, 0xC3778C32, 0xF3BE5A07, 0xCB9DDBCB,
+		            0xB88E9FA8, 0xA47A1CA4, 0x4F0C5796, 0x437D0AB9 }} }
+	},
+	/* 27 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x6B7DAFB8, 0x0A9BDFE8, 0x0CF19EC3, 0xE6F00152,
+		            0x340E0EEA, 0x9716489D, 0x51FB7E61, 0x533C1134 }} },
+		{ .w32 = {{ 0x57D7A795, 0x7B92EBA5, 0x8185E4C8, 0x93E4DD32,
+		            0x2D8E6CED, 0xEC27CC82, 0x088CD23A, 0x59ABE204 }} }
+	},
+	/* 28 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x935ED4AE, 0x77A26C0C, 0x68C44CDC, 0x6F97321D,
+		            0x99F1778A, 0x967069CD, 0x9562D851, 0x61278AC4 }} },
+		{ .w32 = {{ 0x2C8BDBE6, 0x26F2A9D4, 0x217F108D, 0x8E75858D,
+		            0x8350BA7E, 0xAF476550, 0x2E858544, 0x182EC63D }} }
+	},
+	/* 29 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xBE14EC04, 0x150D28F7, 0x4D8A9F7A, 0xC5EDAA6D,
+		            0x341D0BD7, 0x72AA9449, 0x8C45A84D, 0x5C8378E2 }} },
+		{ .w32 = {{ 0xC9D90CCC, 0xD5924FD4, 0x20B30A0B, 0x143DD29B,
+		            0xD476BD09, 0x75445CC2, 0xA6FD9F1B, 0x1766AB57 }} }
+	},
+	/* 30 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xC0109B5C, 0x83EEDB91, 0x9BB9686F, 0x29E0D60B,
+		            0x0A2FF714, 0xBA86D416, 0xEF5B5EE3, 0x651C5154 }} },
+		{ .w32 = {{ 0x3CB946E5, 0x7CC761F1, 0x884DED3B, 0xDE61DDD9,
+		            0xF4197A52, 0x2B774ED7, 0x68E90765, 0x577CB366 }} }
+	},
+	/* 31 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xB2BF7933, 0x0563021D, 0x7A3A1D58, 0x46BC55F8,
+		            0x3BFAF8BD, 0x45932BE3, 0xAFADD4ED, 0x2A7E354A }} },
+		{ .w32 = {{ 0x4529D916, 0x07FD11F2, 0xFDB439FC, 0xDEADE56B,
+		            0xD14DE379, 0xCA8EAFD6, 0x74A88DC5, 0x640C4FC4 }} }
+	},
+	/* 32 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x753A97E0, 0x530BC670, 0x862B9CB0, 0x2E70F554,
+		            0x7ADA2D8B, 0xA1FC2A0B, 0x6D7BBC8D, 0x4D86791B }} },
+		{ .w32 = {{ 0x6779A7FC, 0x6EA3BD50, 0x342F16D2, 0x93F2F363,
+		            0xEC53E615, 0x6EF629B7, 0x3B4943BE, 0x62A0BF8A }} }
+	}
+};
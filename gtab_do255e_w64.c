@@ -0,0 +1,2476 @@
+/*
+ * Precomputed windows of the generator for do255e_mulgen(),
+ * 64-bit limbs. Generated with: mkgtab 6 11 w64
+ * Do not edit.
+ */
+
+#define MULGEN_WIN      6
+#define MULGEN_CHUNKS   11
+#define MULGEN_XU       1
+
+static const do255e_point_affine_xu window_G_comb[] = {
+	/* 1 * 2^0 * G */
+	{
+		{ { 0x0000000000000002, 0x0000000000000000,
+		    0x0000000000000000, 0x0000000000000000 } },
+		{ { 0x0000000000000001, 0x0000000000000000,
+		    0x0000000000000000, 0x0000000000000000 } }
+	},
+	/* 2 * 2^0 * G */
+	{
+		{ { 0xE38E38E38E38AAE3, 0x8E38E38E38E38E38,
+		    0x38E38E38E38E38E3, 0x638E38E38E38E38E } },
+		{ { 0xB6DB6DB6DB6D97A3, 0xDB6DB6DB6DB6DB6D,
+		    0x6DB6DB6DB6DB6DB6, 0x36DB6DB6DB6DB6DB } }
+	},
+	/* 3 * 2^0 * G */
+	{
+		{ { 0x0000000000000152, 0x0000000000000000,
+		    0x0000000000000000, 0x0000000000000000 } },
+		{ { 0xC2F21347C4043E79, 0x6B1CEBA6066D4156,
+		    0xAB617909A3E20224, 0x12358E75D30336A0 } }
+	},
+	/* 4 * 2^0 * G */
+	{
+		{ { 0xEA5E1BA07D1A36D1, 0xD0AF77073CCEA916,
+		    0xC68A748FF2D92037, 0x43554439A8DE7571 } },
+		{ { 0x65A29F71130DB4AD, 0x9F71130DFA47C8BB,
+		    0x130DFA47C8BB65A2, 0x7A47C8BB65A29F71 } }
+	},
+	/* 5 * 2^0 * G */
+	{
+		{ { 0x9B7D88CD74D7D3CA, 0x0E31B461193896AC,
+		    0x93464506E97D44DB, 0x0ABC8AC61DCD9949 } },
+		{ { 0x1F2B6B08DA5B43EE, 0xE40F8B8BC44A0C63,
+		    0x5866F1F8B35FB70C, 0x185034D250F768D7 } }
+	},
+	/* 6 * 2^0 * G */
+	{
+		{ { 0x19348B5724DF12CF, 0xAB7572F66232945A,
+		    0xFFAA89042A63BF4B, 0x3024ED85633EF2E2 } },
+		{ { 0x0BD0C5F1F91D6B18, 0xBB4A410D263610A7,
+		    0xA1AB0B9D98F35F00, 0x4FA6D8B6AFDDC92B } }
+	},
+	/* 7 * 2^0 * G */
+	{
+		{ { 0x33E381251F43C3D5, 0x49BF0E2E71C6FE8F,
+		    0x6AF69CC116BAEF18, 0x36199FBAD0C9585E } },
+		{ { 0x7EB52414159EF4EA, 0xB885C9D1EB4CC9E1,
+		    0x350914B3EE64BF7F, 0x6DD8CDFA520AED5A } }
+	},
+	/* 8 * 2^0 * G */
+	{
+		{ { 0xDDBCA65ECDCBDFAE, 0xD19C744A47F38FBD,
+		    0x15099FB55653455E, 0x1FD0DC2A961EC01F } },
+		{ { 0x99DA8C93EB513A8B, 0x0706B8B95DEDFC87,
+		    0xC54D8F471F778CE9, 0x4766315BFA2E63E5 } }
+	},
+	/* 9 * 2^0 * G */
+	{
+		{ { 0x8DF7F2C9CE799A9C, 0x7AC7F7C3AFDD04F9,
+		    0x915FE4A27D833740, 0x1ED67871986F29BA } },
+		{ { 0xA84A27A9D0A08E61, 0x27E9084D132CCAC1,
+		    0x498C7D8B01F68C40, 0x6957FDFF940E4159 } }
+	},
+	/* 10 * 2^0 * G */
+	{
+		{ { 0xE944946059A9387C, 0x32BB0464A75287B8,
+		    0x122E571F46C8845D, 0x0D05AC0126E0A481 } },
+		{ { 0x3AA366BBB889903E, 0x55838146CC140A37,
+		    0x4AA37581A9B6AD5E, 0x7B37113C916F803C } }
+	},
+	/* 11 * 2^0 * G */
+	{
+		{ { 0x6562064C442E3709, 0xD013EB4D114A7267,
+		    0x166892C716D5320A, 0x2824BCCA3B493396 } },
+		{ { 0xA9A8911D864E7F82, 0x65CF6B9CAB741725,
+		    0x8C133221E772B327, 0x158521078CD1F209 } }
+	},
+	/* 12 * 2^0 * G */
+	{
+		{ { 0x4AE1AE2876FFE733, 0x55A43A11F9D28845,
+		    0xBAACD8A3E4990483, 0x37B39256440F5C21 } },
+		{ { 0xE4C1C725087640AA, 0xFB902D6A3EF5D5E0,
+		    0x53EF35932E1297EB, 0x67E65CF7E1787343 } }
+	},
+	/* 13 * 2^0 * G */
+	{
+		{ { 0x90DF642868789634, 0x267A28B9CB72C6CA,
+		    0x27BE4B2B937625B5, 0x62003971A89B844F } },
+		{ { 0x90F8839881061965, 0x67D0394FF2BFCB98,
+		    0x913200FCCD1396D8, 0x17F96D76306A3580 } }
+	},
+	/* 14 * 2^0 * G */
+	{
+		{ { 0xC76258B805A821DA, 0xDC3C29F024B5765F,
+		    0xB646CAAD30897EED, 0x46F594DEF8D35CB9 } },
+		{ { 0x05B49673D2AC4172, 0xA016A6890D77E4E6,
+		    0x7C6DAA970635E1C0, 0x42C8034547A6A04A } }
+	},
+	/* 15 * 2^0 * G */
+	{
+		{ { 0x496055CDC3DFB745, 0x0673F992F547B770,
+		    0x8EFAE8F99B3E5BB3, 0x33C76A13E12C07DD } },
+		{ { 0x7FFA4AF719120727, 0x705D12571BF74984,
+		    0x4AD1FA649FAE1F07, 0x2F4CA2B6265D7456 } }
+	},
+	/* 16 * 2^0 * G */
+	{
+		{ { 0xE1DAC53644F243F9, 0xE1154ECDDFFD59A1,
+		    0x1731585F8B8C6649, 0x1BFB93F1365D2CAF } },
+		{ { 0x2D808316E1227049, 0x15064C9132683177,
+		    0x706D8A1F41E90ED8, 0x251A19311A6DB76E } }
+	},
+	/* 17 * 2^0 * G */
+	{
+		{ { 0x36AC4B82C8DD950C, 0x3BC71A07581EBCA9,
+		    0x94A66E3610E2FCD1, 0x61DF242C3E9BE9AF } },
+		{ { 0xE3276CF6BDEB0077, 0x5D5663FC26C268C8,
+		    0x23FA50B9ACDC0F67, 0x21DC28E7D2D8965B } }
+	},
+	/* 18 * 2^0 * G */
+	{
+		{ { 0x58FE0FCC33E65680, 0xE5DF31D5B6A75206,
+		    0xFAA8CD750BB3A605, 0x7A9FCB91D11FC115 } },
+		{ { 0x187FF295CBD05439, 0xE9BCF6239118D0F1,
+		    0x6D2DA0C9431916CB, 0x14C35A2F273B1E78 } }
+	},
+	/* 19 * 2^0 * G */
+	{
+		{ { 0xD1A17C18D218B28D, 0x1F278C04267A218D,
+		    0xEE2FB42277FB76EF, 0x2724E39552EC12E8 } },
+		{ { 0x2E9605460CD12CCD, 0xB16C3B02FC75CB1C,
+		    0x351029554A163102, 0x3709C2591F7E11F3 } }
+	},
+	/* 20 * 2^0 * G */
+	{
+		{ { 0xFE914C283325A165, 0xADBEDB7DBF570155,
+		    0xF08D8EA268B7D502, 0x379524CCF4FB5C67 } },
+		{ { 0x6194F88C9A030C46, 0xE454A2D9890AA0D0,
+		    0x3E097EC73F5258BC, 0x700C9AE6D6B8FAD0 } }
+	},
+	/* 21 * 2^0 * G */
+	{
+		{ { 0x6DE072071638A7B6, 0xB1732E9C026D3EBA,
+		    0xECA1B8D8D870C351, 0x04F7F1128487A6DC } },
+		{ { 0x233D107E7F5C0492, 0x2A022951CC3C3AAF,
+		    0x0A64893A7EF1CDEB, 0x5345E7B89765645D } }
+	},
+	/* 22 * 2^0 * G */
+	{
+		{ { 0x2E6CDAB00BC169A7, 0xFE4D0A3B731EAF6B,
+		    0x232A613099952E65, 0x787AE08EAD43F67C } },
+		{ { 0x055B7D007A823E68, 0xECD9F9762C230DC2,
+		    0x2EC58EB5375AEDA1, 0x78FB9A56F8C42ED5 } }
+	},
+	/* 23 * 2^0 * G */
+	{
+		{ { 0x44790D64037CDF63, 0x77425D46BD49B1DB,
+		    0x023EBF965F3F72F6, 0x317DF35C25F97016 } },
+		{ { 0xE75DF66DD4BAE67A, 0x2547699963FA4FC1,
+		    0x294BE5CB14211F34, 0x5CF37A023D4811EB } }
+	},
+	/* 24 * 2^0 * G */
+	{
+		{ { 0x5DBD98E53E3D631A, 0x19F7DA66C186014D,
+		    0xA9E14C4412573A91, 0x0D6ED875B80CF04D } },
+		{ { 0x5600C9D83BE314F3, 0xA56CA77DC4700361,
+		    0x3A445D116B0B4CA8, 0x0C5CF9588A73820B } }
+	},
+	/* 25 * 2^0 * G */
+	{
+		{ { 0xD9ED2C90C67DCB77, 0x6DC21B6797BC9B74,
+		    0xEC586D5AFB3ECF5D, 0x17D208932915A7D8 } },
+		{ { 0xD7F0756D81426416, 0xF1EF2F5840E42644,
+		    0x2DF6F8D645DC9A1E, 0x482E3C441BB5AB9A } }
+	},
+	/* 26 * 2^0 * G */
+	{
+		{ { 0x4432E07383D7207E, 0x60991BC42E654E39,
+		    0x2D8433396B5560ED, 0x2ABE2EAE95BCE47E } },
+		{ { 0x1D74A2B949E984EC, 0x9FF9F799058EC524,
+		    0x17F8D8F724EC0C45, 0x380A398F77751536 } }
+	},
+	/* 27 * 2^0 * G */
+	{
+		{ { 0x49AFAF5A8F49FE50, 0x7154397035321D90,
+		    0xADAF6DED027A7D9C, 0x2B43669AC0BC7A2C } },
+		{ { 0x383007F21604373A, 0x9312067A5D6602D1,
+		    0xB4B4AEEB0EE6F063, 0x3EF161DFC7CA3E3D } }
+	},
+	/* 28 * 2^0 * G */
+	{
+		{ { 0x66B9BE594BF56BC6, 0x14C5694228761516,
+		    0xD954A0379159FD2A, 0x28688C3196AA10B9 } },
+		{ { 0xE6C3310339D596E4, 0x6B318BED4E092EB8,
+		    0xB66B77F9E87B093B, 0x007059E8F4835C81 } }
+	},
+	/* 29 * 2^0 * G */
+	{
+		{ { 0x1A37CFB777744B91, 0x574A3F8DDE46B327,
+		    0xB30DAB47D5627E00, 0x319322FA638590EF } },
+		{ { 0x1B84442949729EF5, 0xB426A97B06873730,
+		    0xA5446EA5C6FC7F85, 0x05563EC126C27BF9 } }
+	},
+	/* 30 * 2^0 * G */
+	{
+		{ { 0xDE3CD33B7D28A15F, 0x44A2546F4EA24704,
+		    0x99665C0D66D41528, 0x5B27CDEE97D3A0C6 } },
+		{ { 0x047D8308351E5820, 0xAED330986B29DE0B,
+		    0xFE489362D175A28F, 0x2854D046C74C1842 } }
+	},
+	/* 31 * 2^0 * G */
+	{
+		{ { 0x673EEAA32944BD3C, 0xE1045D7ED6F7D7E9,
+		    0x5C62415907E09114, 0x7A2E7FC428291944 } },
+		{ { 0x92351782F5433145, 0x9BAFAE934F6D8619,
+		    0x5811ABA77C22BCE8, 0x141BE6C46E67CFD7 } }
+	},
+	/* 32 * 2^0 * G */
+	{
+		{ { 0x1A9F6E5B6C0CFE02, 0x8CCA4CBE2E617851,
+		    0xBEB6E2A37C2CE436, 0x2DF834EDAE4DFA94 } },
+		{ { 0x6BE722A8A2EEC5CC, 0x52EC110F8F0C2280,
+		    0x2F6921A18D52C508, 0x753DD5774E696D15 } }
+	},
+	/* 1 * 2^24 * G */
+	{
+		{ { 0xAD2E75746FDFC6D6, 0x91B302C2D510922E,
+		    0x20882911D72A0B1C, 0x7CC777F77AEF78E7 } },
+		{ { 0x510BBB094A5E286C, 0x2B489CB60B55238F,
+		    0x37D2F0F6A0D8B31C, 0x65EBCECFADFF0B1F } }
+	},
+	/* 2 * 2^24 * G */
+	{
+		{ { 0x3A6FAA59CB8A1BF5, 0x2849D9758380E5F8,
+		    0x7240714214647C7E, 0x73B88D1BBBAC30B7 } },
+		{ { 0x04A1323F739CA37C, 0xD56A5D9D526A5770,
+		    0xF3DDAAB7F32FA772, 0x5D1D87ACEAD58B5E } }
+	},
+	/* 3 * 2^24 * G */
+	{
+		{ { 0xF73FBB3780027889, 0x3279FAA4A60B0901,
+		    0x7B3F8C4050332EA3, 0x2B5ED42D931A84EF } },
+		{ { 0x47AF10DAC5F1482D, 0x79500A72DA2816A8,
+		    0xB8EF9C3BBEA128D0, 0x64116E2E70D849B8 } }
+	},
+	/* 4 * 2^24 * G */
+	{
+		{ { 0x35C786292F22D741, 0x3A7FD1C8793AAD7E,
+		    0x4FA78248D1758212, 0x6BD683020CD4E293 } },
+		{ { 0xD76D00719CBE81E9, 0x4AE197ED1FACA54F,
+		    0xE765104BE662273E, 0x5244DFD7AA670D6D } }
+	},
+	/* 5 * 2^24 * G */
+	{
+		{ { 0xD10D87A81C01FA66, 0xFE16CA314E0D7C85,
+		    0x6F4963EA0A9821AF, 0x092AAAABD5B426C3 } },
+		{ { 0x70506227DC8D144B, 0x5601F79446CB4460,
+		    0xDE34104C61B32C66, 0x3252D073C7A7672C } }
+	},
+	/* 6 * 2^24 * G */
+	{
+		{ { 0x49706B14DF08215B, 0x9FF8559B4B014D67,
+		    0x9AAB9CFDB0BC3F36, 0x0B1D42501EADED6A } },
+		{ { 0x191FB4B2787DDC1D, 0x47CFFAA1679F3316,
+		    0x9ED02B6C3A9CD202, 0x51E6CCD32CB07CF8 } }
+	},
+	/* 7 * 2^24 * G */
+	{
+		{ { 0xFDB9185ADDA39B18, 0xEE3C25F56E449C79,
+		    0x3A7BDCE2E82D06AB, 0x19D5E5B2A0250721 } },
+		{ { 0x2F90D0096C674BAE, 0xC197C7C24D6F39E7,
+		    0x9478230B92F223D2, 0x024A9DDA656585DB } }
+	},
+	/* 8 * 2^24 * G */
+	{
+		{ { 0x17D9AE4A66D7A591, 0x5BBB3D31B24E489B,
+		    0x6365D652C6FA63D9, 0x544DECEB723588DC } },
+		{ { 0x7A7F80DCBA9CEB74, 0x9D6CD1B3ED1409E2,
+		    0xC4F1BC8362ED5E81, 0x1BDEF900706DD589 } }
+	},
+	/* 9 * 2^24 * G */
+	{
+		{ { 0x4E58666C4869D126, 0xAEA5DE55C96281A7,
+		    0x3F28A10DB5396AF8, 0x764465DEBB930E24 } },
+		{ { 0xF2AE2B017CA10C1F, 0xD472DED6328BDAF8,
+		    0xE9D502BE1A2D40AC, 0x0FD8B14B9C0802B7 } }
+	},
+	/* 10 * 2^24 * G */
+	{
+		{ { 0xBE587E72006FA5B6, 0xF3E3B8BFBD113B9D,
+		    0x859CCA207B7C688D, 0x46A43E59E5E7B062 } },
+		{ { 0x6346D777094C6BA4, 0x4C95D8903BE1FE68,
+		    0xE7A408CAFC568951, 0x6386574C1B83940E } }
+	},
+	/* 11 * 2^24 * G */
+	{
+		{ { 0x75E0BDAFFCE4BB04, 0x5600C1391F2C7F31,
+		    0xC317C3363C60580F, 0x31FC668F356DDD31 } },
+		{ { 0x90B3C72B7BA2EDCB, 0x5034D84701838CE8,
+		    0xCE0F0349BBCD29FA, 0x2DB0B296028AEC8D } }
+	},
+	/* 12 * 2^24 * G */
+	{
+		{ { 0x9B80903BBC7EF84F, 0xF329254F07E51B22,
+		    0x7E8B873752880B47, 0x31F186C966E30600 } },
+		{ { 0x8157EF9F3DB1CA0E, 0x37012C10F7F527EA,
+		    0xCC8E2B95FBC6B2B9, 0x0C6F364D68215069 } }
+	},
+	/* 13 * 2^24 * G */
+	{
+		{ { 0xCD56E62705EB7351, 0x3664E29C0789A751,
+		    0xAC3B8AE0F5D572C4, 0x71372E4B9338BD87 } },
+		{ { 0xFC961ACC77540461, 0x36C8CDFE26C99A5C,
+		    0xEFAE7A5FEB1860F9, 0x36D13981B140CF4E } }
+	},
+	/* 14 * 2^24 * G */
+	{
+		{ { 0x832C4043BE7E084D, 0x303839C541B1C8D7,
+		    0x59D50EAFB28133DE, 0x4769A4C0AB36B26D } },
+		{ { 0xC77D7C6A51C8A78A, 0x9780F40160C0EA0A,
+		    0x3FF4175D2D9AACF9, 0x016404109861E287 } }
+	},
+	/* 15 * 2^24 * G */
+	{
+		{ { 0x47CF229ADF381433, 0x6E456FA434FED9B0,
+		    0x136B2FA543D8AE1E, 0x525E31911BD9E5BD } },
+		{ { 0x30B58A2351A9E62B, 0xD236E26847BBDE88,
+		    0x8BB8DAE043B4A765, 0x5F8C63EDC651C726 } }
+	},
+	/* 16 * 2^24 * G */
+	{
+		{ { 0xF1DA1269D9E779FF, 0x6CD70DE3C65BDBEB,
+		    0xDF298F95D6E9161B, 0x56593DD150C9CE25 } },
+		{ { 0x6BA2401D83BD6A69, 0x9FC8C9C0980009DE,
+		    0x4D828381AF4D4336, 0x0B1143E272500ED6 } }
+	},
+	/* 17 * 2^24 * G */
+	{
+		{ { 0x6963F4E388C4F756, 0x190BF02DD09CFCB7,
+		    0xAEC8B5D5D45EA64F, 0x73898C2E19D15E61 } },
+		{ { 0xB4D1513294B15911, 0x11927C640E56D770,
+		    0xFC37553B773D8D0B, 0x336BDFAA92A199BF } }
+	},
+	/* 18 * 2^24 * G */
+	{
+		{ { 0xB472E07E3ABB2AB6, 0x2028BE23DAF3737B,
+		    0x4C364059CE4D9E9F, 0x31D5D585A8718E37 } },
+		{ { 0xE58E74BFEBCDD861, 0xFC39539B2F2F8456,
+		    0x3728E0D765191F27, 0x4DE37AD350FA44B9 } }
+	},
+	/* 19 * 2^24 * G */
+	{
+		{ { 0x3ECAC0231CC68A16, 0x21BF49E098935A56,
+		    0xF4BDD5D53696DEE7, 0x612AD7FA4C8390E8 } },
+		{ { 0xD3269C2A3EF16123, 0xE575EC55C624ACC8,
+		    0x659F45AE0676A94C, 0x2EB5CB7B8B0CE52A } }
+	},
+	/* 20 * 2^24 * G */
+	{
+		{ { 0xAAC31F9A3834E668, 0x2EDFE6A57919D30E,
+		    0x00D0CD6AEEA5A02C, 0x0521EB72FEB844C8 } },
+		{ { 0x1557EFBD4BE32F54, 0xEDFEA0CA405F1998,
+		    0x56A5BE8EE271CC17, 0x2E2F96AB41AAB8B7 } }
+	},
+	/* 21 * 2^24 * G */
+	{
+		{ { 0x166F1DF17366952D, 0x952FF3194F67A549,
+		    0x55D0846B3D24E34B, 0x3CE20DC951615B41 } },
+		{ { 0x2A1F86168C5D7B45, 0x382345A4CDC9F524,
+		    0x53019B256728E3C6, 0x099D98AC0D35A198 } }
+	},
+	/* 22 * 2^24 * G */
+	{
+		{ { 0x1DC5A1AC75370C6D, 0xDD819043914D6845,
+		    0x69AFE0636AAACB75, 0x043421798C9F1957 } },
+		{ { 0xB4AC415E3355FC67, 0xA5335E24AC5C1FF4,
+		    0xF97CF9894C67C1A5, 0x693CB9747EE878AE } }
+	},
+	/* 23 * 2^24 * G */
+	{
+		{ { 0x671B7A898FD0CC2F, 0x9F40CBF8C58B2980,
+		    0x3509BDDF7D75BFF1, 0x7F6D95BE51056B20 } },
+		{ { 0x4A9B663D9B5D4312, 0x23D7B148D290752B,
+		    0x6A5DEF513FEDF808, 0x57E851973257AB5E } }
+	},
+	/* 24 * 2^24 * G */
+	{
+		{ { 0xE24091235BE3A6E9, 0x0D626FB73C16DECC,
+		    0xB92C14A28F9E0411, 0x5F7F4E4608F32550 } },
+		{ { 0x683B237C216AC1F2, 0xF23CED57C187B5F8,
+		    0xF49C6F9D39D0F729, 0x012473F6E1DD2DA0 } }
+	},
+	/* 25 * 2^24 * G */
+	{
+		{ { 0x76CF30CC3DC20610, 0xC260A7FA491C666E,
+		    0xE3BB5B3B056F4727, 0x3C47468DB793EABD } },
+		{ { 0x8C7C4F4BA1EE4A27, 0xC7CBDFF94D21873F,
+		    0x05E531893BFB9035, 0x29BCCBC71B71FCBD } }
+	},
+	/* 26 * 2^24 * G */
+	{
+		{ { 0xA9EC6862C772603A, 0x0720D2838DD7DC8B,
+		    0xE1971DE3F041957E, 0x3A49976607AC7A18 } },
+		{ { 0x89C03E33E811DCDE, 0x44C0DD8A959BABE3,
+		    0xDD5B0347857BB301, 0x79A4F3BD878A35BE } }
+	},
+	/* 27 * 2^24 * G */
+	{
+		{ { 0xB01FA1A2B44E767C, 0x230EF87C85793D56,
+		    0xDFEE8E579E24EC75, 0x19FA9D710A31C9DE } },
+		{ { 0xE46CD94F04C3D621, 0x01B0738A65863A6F,
+		    0x2754F7F8268FF18C, 0x6D58AD034C9C3911 } }
+	},
+	/* 28 * 2^24 * G */
+	{
+		{ { 0xBD979663B2ADB93C, 0x005659AAF00AC710,
+		    0x996225CB643EF0BF, 0x6FB209CA31701330 } },
+		{ { 0x42206FC6949217F8, 0x62018E7A641FF93B,
+		    0xF3E1DD61099B4B33, 0x5C1DC97B3FF740FA } }
+	},
+	/* 29 * 2^24 * G */
+	{
+		{ { 0x7265124F3FF7466A, 0x2634C72CBBF20858,
+		    0x891A12A18DDB16B0, 0x47B051DD0D58AA6D } },
+		{ { 0xA2C009BC0FEE8B50, 0x09B42D48C31C9E03,
+		    0x750958C4A6210951, 0x7A5CA3511B6C1421 } }
+	},
+	/* 30 * 2^24 * G */
+	{
+		{ { 0x7F1243D9E1187D8E, 0xA28A32187D9F4A00,
+		    0xFAB99F46660EFA93, 0x32A03C12147A0ECC } },
+		{ { 0xE63D29BDA7DE1119, 0x8821FC36920EE830,
+		    0xE5CBDBF9C0562EB4, 0x429F69D7B57C1FEE } }
+	},
+	/* 31 * 2^24 * G */
+	{
+		{ { 0x7BC8CDEFF032DC62, 0xAFA8F3A5EC59BEDD,
+		    0xDB9445CFB12E95B0, 0x1EC7F4E550CA62CA } },
+		{ { 0xB2ED460C8A4C76E6, 0x9248B8E14C99F3F1,
+		    0x7C0BACBB473FB0CF, 0x3ACAB7B6B6CE3EC3 } }
+	},
+	/* 32 * 2^24 * G */
+	{
+		{ { 0xE4808230A8C23828, 0xEDDE2FB9A8FB3C77,
+		    0x1AB8E3EAE66AEF8B, 0x6D405A8F87849F96 } },
+		{ { 0xF29B25E3EFA5AF6F, 0x2508EA9A7DA1EBCE,
+		    0x0ABA1243CFCE40A7, 0x6F5A798D2BF320B0 } }
+	},
+	/* 1 * 2^48 * G */
+	{
+		{ { 0x2EC20FF710A8C8A9, 0x46DB106F82F261E7,
+		    0x0C424CEA8A00FC57, 0x0578234B6633FDF4 } },
+		{ { 0xAE601F570B83B470, 0xC417FDCB376894E7,
+		    0x75115BCADD1503F3, 0x360EEC64027AF0C0 } }
+	},
+	/* 2 * 2^48 * G */
+	{
+		{ { 0xABCA14D6B81D3C2B, 0x13B7E036F44D3FD8,
+		    0xF813F3F9EF3BE100, 0x0AACE3824BAFB0B8 } },
+		{ { 0xD8D2FDEEE9ADB788, 0x041436CC9B1A9B63,
+		    0xF4A5D67C15495500, 0x5CB106FD05CE6C1E } }
+	},
+	/* 3 * 2^48 * G */
+	{
+		{ { 0x805A53CFF187D090, 0xA3CA73094EC02E02,
+		    0xBE59F72242594D78, 0x5B85105E8F574384 } },
+		{ { 0x49BEDDFD0A585EE5, 0x8B0B1B34004C50E5,
+		    0xCB673DEC33AFCBC3, 0x03E6236A73E0C051 } }
+	},
+	/* 4 * 2^48 * G */
+	{
+		{ { 0x41E25D4050CF1966, 0x74883C07F699D420,
+		    0x9A932B3630E1275B, 0x06E8850DA63C438D } },
+		{ { 0xC6676A4FE90D705B, 0x2D0F5DF3E668E010,
+		    0x21DD0320A884AF27, 0x311D43C6FC6A3B33 } }
+	},
+	/* 5 * 2^48 * G */
+	{
+		{ { 0xB760FD9C31348D33, 0x7FDEA3A5D65E9022,
+		    0x1CB85B85EC60B05A, 0x6CA7AE18C24AB5B6 } },
+		{ { 0x854F3BDD97218567, 0x1F4CDBBFBFD2646B,
+		    0x7FE74A904DF3D3B5, 0x22C2D72E070E485E } }
+	},
+	/* 6 * 2^48 * G */
+	{
+		{ { 0x1D90219080A5BFE2, 0xF2B4AD46F4487833,
+		    0xE75ECC7EEC632986, 0x0075F0B579E3E909 } },
+		{ { 0x0BA023C57A996030, 0x4B685EF39DB29077,
+		    0xE0528B64DCA7D797, 0x3E81C3E9A908E4C9 } }
+	},
+	/* 7 * 2^48 * G */
+	{
+		{ { 0x1A017FA150F91CD5, 0x4646863D9DAB2383,
+		    0x79CEE6F50B699A04, 0x156CB2E4B7AF3208 } },
+		{ { 0x6744733DD4454A7B, 0x96A7C66E3F6A41E8,
+		    0xAF2F34E2650F63F8, 0x2D03B42921665F5D } }
+	},
+	/* 8 * 2^48 * G */
+	{
+		{ { 0x84D2285F80D2036F, 0x6AE4025E9D897D88,
+		    0x9B01FF6A2B2AE0D1, 0x2CF67A738619372C } },
+		{ { 0x10426EA81A9B8520, 0x853F7BF9FAAD2854,
+		    0xCA2C2EE30202FEE3, 0x5CF61AAD101AB5D9 } }
+	},
+	/* 9 * 2^48 * G */
+	{
+		{ { 0xE86854392DC03BB0, 0x946680367629CCB2,
+		    0xEF492DD61E32FCA1, 0x3EDC214F5C66B0A3 } },
+		{ { 0x88D5B9C4D42A2158, 0x3B76C0FB3CD41755,
+		    0x7EA05D23131A30A2, 0x7441554AFA3D6594 } }
+	},
+	/* 10 * 2^48 * G */
+	{
+		{ { 0xEEC87375CA8A3822, 0x60C55961E3A3BC48,
+		    0x5C5470CDCB738C9A, 0x37437A631AF005AB } },
+		{ { 0xC7318B72B047FA88, 0x41A665EE0EAA22DB,
+		    0x57046A8B97415DF9, 0x36B8A91E69CC4499 } }
+	},
+	/* 11 * 2^48 * G */
+	{
+		{ { 0xB039CA78EC03C046, 0x9711250351372585,
+		    0xB9D3212FEA279415, 0x2374147A62A381B7 } },
+		{ { 0x82391334E1B2B1F2, 0xBC16AAF204D7EE06,
+		    0xA864E2DB09F56A07, 0x789B06D9EDCD8327 } }
+	},
+	/* 12 * 2^48 * G */
+	{
+		{ { 0xFE913EEE5FDE1E8A, 0xD108C03E38B248FD,
+		    0x82A4046E1846BD35, 0x47DAB44F6A619B2A } },
+		{ { 0x8AD97430E7870F17, 0x6CC0D50BFED501E8,
+		    0xCF7054B447795449, 0x32DCF349F90D2FCE } }
+	},
+	/* 13 * 2^48 * G */
+	{
+		{ { 0x2A2EBA6C0DC055DF, 0x3954AE900C4A4EDD,
+		    0x4FE3A7E4214439F3, 0x53EE8624FBBAF8C4 } },
+		{ { 0x5A080CE8B804B93E, 0xA366D6A15FD1D249,
+		    0x3F535A0AF0EEE7C8, 0x73FC01963D4C5F48 } }
+	},
+	/* 14 * 2^48 * G */
+	{
+		{ { 0x087FB4297885699B, 0xF91EEC55E0DBF5B2,
+		    0x115B40C492C94D75, 0x71A4F2F07FF49C2C } },
+		{ { 0xB7D5B4367F414D6D, 0x155EA80B36364AE3,
+		    0xA43033E79AF1C296, 0x6BD7E8280820C189 } }
+	},
+	/* 15 * 2^48 * G */
+	{
+		{ { 0x06FE8D1C327A8871, 0x87F6A51403567A24,
+		    0x4AB75BC9E2E90624, 0x1C1C2469F23629AD } },
+		{ { 0x22E70930B61794F7, 0x1FD5EF7898D5EA9B,
+		    0x8196BF1862E85876, 0x0F3D8E511123D8A7 } }
+	},
+	/* 16 * 2^48 * G */
+	{
+		{ { 0x409080C5AB837080, 0x04D8F9BEB6245419,
+		    0xE5506A446B4C644F, 0x623B4C708976566A } },
+		{ { 0xD4EE641B8605F0DA, 0x0C4EC7E0E25FB49D,
+		    0xBF9D44A29B4723BF, 0x19A40EBE3C5629B5 } }
+	},
+	/* 17 * 2^48 * G */
+	{
+		{ { 0xD6FC0BEC2C6E4296, 0x46B4621846606630,
+		    0x281CFEE278A3A116, 0x4A56A10FFFFF677B } },
+		{ { 0xDD862B42028A2E30, 0xC73AF456B0240F0F,
+		    0x081A862255C588BC, 0x78A7CE7268746852 } }
+	},
+	/* 18 * 2^48 * G */
+	{
+		{ { 0x498985EEE4F4BA98, 0xC6D58DBAF921FF17,
+		    0xF1FB25A1BBDF6E4B, 0x75DC9DD6B1B13925 } },
+		{ { 0x4E07D952C83B398E, 0xCDB3E2B2680E4C1D,
+		    0x7A1DCDD182EB5925, 0x610308BB445F6E87 } }
+	},
+	/* 19 * 2^48 * G */
+	{
+		{ { 0xA83FF4AFEB8A0565, 0xC5C66A2D891CF533,
+		    0x371EBFBED6A47981, 0x4A0D4E628C7AD948 } },
+		{ { 0x7E6CC3ABFCEA4AA1, 0xDDD00B8320368B2E,
+		    0xBA58FC00505CCD1B, 0x2A2731773C915C9E } }
+	},
+	/* 20 * 2^48 * G */
+	{
+		{ { 0x810A3D501C80736F, 0x5D87F9079A8C4009,
+		    0x0AB6FDE5F8B6243B, 0x166CBA68C6F5B24C } },
+		{ { 0xB3F3333BC31CC831, 0xED8AA91EA46BE6F5,
+		    0xDCD0015803169887, 0x4ABB06C28C625C40 } }
+	},
+	/* 21 * 2^48 * G */
+	{
+		{ { 0x18C0D138BD85F9B9, 0x1A3054DED7FF3742,
+		    0x8C759793BB6DCFF3, 0x6558C5EC6467D47E } },
+		{ { 0x393B1D9A725383BF, 0x3A9C0719812980A5,
+		    0xAA774595F8F6E6D8, 0x7B23CE31A8284830 } }
+	},
+	/* 22 * 2^48 * G */
+	{
+		{ { 0x79D1CD3D52256D8F, 0x26F1682AFD00AE7E,
+		    0xF50148389DDB8EFA, 0x27BB277F05B88A32 } },
+		{ { 0x81F885DAD6E24C5C, 0x68A5104B596DCCA3,
+		    0xDE939BD50C8FA30B, 0x6EC978C6AA0C519C } }
+	},
+	/* 23 * 2^48 * G */
+	{
+		{ { 0xB3E63EA078A3A696, 0x0A2915CB52E77177,
+		    0x327FBB065C8C5CD7, 0x72F8809D35D9FA65 } },
+		{ { 0x91D71C6643BB9C3C, 0xC588B697D275D985,
+		    0x4C7EBC32330A4AA4, 0x1A967951507A7363 } }
+	},
+	/* 24 * 2^48 * G */
+	{
+		{ { 0x0B07198CDB5B798F, 0x777D3F6094543EE5,
+		    0xA73EBDB9A4ADFA37, 0x3147EA515D4E25DD } },
+		{ { 0x19C1B8D91A52EEC2, 0x13E2962C912AEA51,
+		    0xDBF5B1B2F7C61BFE, 0x20E7424B44E16B27 } }
+	},
+	/* 25 * 2^48 * G */
+	{
+		{ { 0x6E528DD9E24F4FAD, 0xAF40024ABE4A9D14,
+		    0xB7431BA719C65687, 0x081407B71B5F8664 } },
+		{ { 0x02B8E4E8577F5039, 0x99E288C47FF21BC0,
+		    0xF0A509C5434D170F, 0x431B872BCE72213D } }
+	},
+	/* 26 * 2^48 * G */
+	{
+		{ { 0xA3335C85ACD2B678, 0x56BDEFAA3EB7E118,
+		    0x3BCCA605421E455A, 0x05ABC15EDE7D9F16 } },
+		{ { 0x51D35B71A76104C9, 0x97FD8B4BDC348749,
+		    0x3316BA5AB80978FF, 0x7BC9004747845B4E } }
+	},
+	/* 27 * 2^48 * G */
+	{
+		{ { 0x567D990045F7290E, 0xF4479356C27DF12A,
+		    0xE896D3D1437F345F, 0x25E71D44782EC652 } },
+		{ { 0x750F1AA8EEE52FC2, 0x5ABAC1A4CA0BB33E,
+		    0x2B9F1ACFB7B32968, 0x184666DDA6A7B085 } }
+	},
+	/* 28 * 2^48 * G */
+	{
+		{ { 0x481853F6A2020136, 0x30C1974FD071EC89,
+		    0x3D1CF034F675482C, 0x75CB0EA9E9DC65A9 } },
+		{ { 0xCD80B92EBA7CF538, 0x8842B430EEFC61D1,
+		    0x1751EB249E740129, 0x7D9B7590D5749A77 } }
+	},
+	/* 29 * 2^48 * G */
+	{
+		{ { 0xC2CB8C6C0E76622F, 0xBB18EFC7AA0406FF,
+		    0x9088A5F42998505A, 0x55AE871EE7C6B877 } },
+		{ { 0x34A6A406A4B107A4, 0x8DCE151BECF8E19D,
+		    0x1951C907E249BC39, 0x4A6C5737C012DF3B } }
+	},
+	/* 30 * 2^48 * G */
+	{
+		{ { 0xCDFBE6A8A16836B8, 0xFD0AFF45D1B2EAEB,
+		    0x7ABCFD208A928467, 0x3D19BD718B83EFB9 } },
+		{ { 0x44637144F63DA940, 0xFE39935E2507A995,
+		    0xD0035A2646E51EC8, 0x00C9AF756A43AF78 } }
+	},
+	/* 31 * 2^48 * G */
+	{
+		{ { 0xFE3F894815801357, 0x6D699F37EC51F89F,
+		    0xE24031C7945A23B9, 0x5F8841DB535A7A4C } },
+		{ { 0x621F978D8451A2E1, 0x4798B873FBFCB203,
+		    0x295454031B50DF64, 0x3C4153156F547A0E } }
+	},
+	/* 32 * 2^48 * G */
+	{
+		{ { 0x7BF56791DB48704B, 0x9AD892B8B57BB680,
+		    0xA02D40A2312F7297, 0x6A651D1EF19552AD } },
+		{ { 0x433AEE4D3FBB65F6, 0x60C0523D42E8139B,
+		    0x3771B4457C98DFB7, 0x5F15D824C8AFFD06 } }
+	},
+	/* 1 * 2^72 * G */
+	{
+		{ { 0xC4897D95AEADD7D6, 0x6F8C7795C50B1F78,
+		    0x0D11F6A3ADCE1A1B, 0x3299316A0CE18C47 } },
+		{ { 0xFE49953ACC2262C5, 0x7815ABF6F9F7EB33,
+		    0x15CAAA4371BA48C8, 0x1A862BDFAEC9BA7E } }
+	},
+	/* 2 * 2^72 * G */
+	{
+		{ { 0xFC13EC10FCE708E7, 0xC69A5DBAB15F4DC1,
+		    0xD042B06385032111, 0x68B7DCDE420AA88E } },
+		{ { 0xF2084CBDFD537DC2, 0x3322D6110A582B1B,
+		    0x47146F3538126519, 0x327CA95FB155EB6C } }
+	},
+	/* 3 * 2^72 * G */
+	{
+		{ { 0xC7B4836D4A1D8A84, 0x7CED6C84498E8C71,
+		    0x6717034E3BEC27B1, 0x31FDD05DB8234111 } },
+		{ { 0xEA94B7F05CBCB8D8, 0x4440E4DF8269C4DD,
+		    0x6D754D3F96FA0670, 0x35CF01BB7E85185C } }
+	},
+	/* 4 * 2^72 * G */
+	{
+		{ { 0x9C333CBB877C7B89, 0xE7CDEB857493D54C,
+		    0x24FC315DD43864A0, 0x7EB0F1B1E37C2A33 } },
+		{ { 0xB08D23519CDD4088, 0x7BC4FA7C91226DF8,
+		    0x4CD840F7B135D8BA, 0x1CEAE74602BAC86C } }
+	},
+	/* 5 * 2^72 * G */
+	{
+		{ { 0xEDF9C29ED260160A, 0x875196738816CEF0,
+		    0x9CD6F958832E7196, 0x2E7112A978610EB2 } },
+		{ { 0xF9BAD6D0D01F2D09, 0x3EFA4AB9C86D618F,
+		    0x9013774F85E03D0B, 0x085C12EC274C9007 } }
+	},
+	/* 6 * 2^72 * G */
+	{
+		{ { 0x61D58FF635184B16, 0xD233D91B3C8BCBA6,
+		    0x5CFC304086EFB59F, 0x058407D6524DA9ED } },
+		{ { 0x99F842E02788D41B, 0x8075FF7709924364,
+		    0x5CA10E7219779003, 0x42FA8EDBABB3C88B } }
+	},
+	/* 7 * 2^72 * G */
+	{
+		{ { 0x802F63A6E3F023A4, 0x130D5B2043B3060A,
+		    0x3005C8F1DDC6BF2E, 0x1CC35AA4896DAF1E } },
+		{ { 0xC818739CA92004F4, 0xBF5DB0432C0B4A3C,
+		    0xC31BFCF19AD041C9, 0x63D021D375B963F2 } }
+	},
+	/* 8 * 2^72 * G */
+	{
+		{ { 0x9C74297A7334761D, 0xC6F733997500194C,
+		    0x7979DD4E0CA3D16A, 0x0EFDCF42AF215C05 } },
+		{ { 0x6941EAC2C029D16B, 0xEB6E78CB6BE58567,
+		    0x9067C0A097E9EE71, 0x4C2C7238DDBF7894 } }
+	},
+	/* 9 * 2^72 * G */
+	{
+		{ { 0x17A43CB516B107FB, 0x8BA954F2BBE2A3AC,
+		    0xC9013ACA03F71E2D, 0x0A2F0CCCBBEFE25C } },
+		{ { 0xA079A1A2FB7C19DF, 0x19A80A51627C861F,
+		    0x24D50B2E7184A10F, 0x2029394EEC33DB1B } }
+	},
+	/* 10 * 2^72 * G */
+	{
+		{ { 0xAC5341D52C259661, 0x51593BEBD73D2F44,
+		    0x74635605CC86D107, 0x0952054BB43B0ADD } },
+		{ { 0xDD3319295948A97D, 0x1D6BED627C5E46C5,
+		    0xDA297923B390603A, 0x7D7E931D3C17E4DC } }
+	},
+	/* 11 * 2^72 * G */
+	{
+		{ { 0x54A97AA8BB18DB7C, 0x4A4A9B55EBF91C2D,
+		    0xE9FFA94A9B4796F6, 0x4812B48CA0226BBE } },
+		{ { 0x00E1550B69122E12, 0x378696AF5ECD30C4,
+		    0x204EF358E3766523, 0x382DD961CAF9C3D0 } }
+	},
+	/* 12 * 2^72 * G */
+	{
+		{ { 0x47DDA3DE73BC197B, 0x0BF37E8F855CB0F2,
+		    0xF3E9D5796DB508CD, 0x7CF922996C9007B7 } },
+		{ { 0x77FC18795E781439, 0x2F87DC44CF0069D5,
+		    0x16C7A6812FA727D5, 0x14A61DF220C2F65F } }
+	},
+	/* 13 * 2^72 * G */
+	{
+		{ { 0xA401326AC36466B0, 0xD1033824261A5E62,
+		    0x9B57DBB9C706631E, 0x729D45B8D965C64E } },
+		{ { 0x7DC5D88A4C418416, 0x61EDF3B8A774658D,
+		    0x43883ADBAD76368C, 0x3246F911EAE3597F } }
+	},
+	/* 14 * 2^72 * G */
+	{
+		{ { 0xFF3548572DB7998F, 0x24D9467638535149,
+		    0xDC1E47D88FE35BF1, 0x1A579B4C05E2F6CA } },
+		{ { 0x0D623A4777BC1537, 0x83C6E58CD990FD4E,
+		    0x13AECC11001C9D73, 0x7AF4F4EC708C9C63 } }
+	},
+	/* 15 * 2^72 * G */
+	{
+		{ { 0x10AF001C12E30069, 0x01752EC2045D63E6,
+		    0x08F67B816784DF91, 0x04FC1CBA763D6AA2 } },
+		{ { 0x5D3C540C81DF42AD, 0xBDEEC5D0FC19444A,
+		    0xEC13B572C6BD8ACD, 0x0144BA46EFA474E7 } }
+	},
+	/* 16 * 2^72 * G */
+	{
+		{ { 0x865CDB907A0FAC96, 0xD9E78DF716F2DEED,
+		    0xC64C2839A56A953B, 0x117C9F2924E51486 } },
+		{ { 0xC90F0F38F568290F, 0xB0CC18939CA9A3BF,
+		    0x219469CAD34AEDD8, 0x1B4EE256F01D7885 } }
+	},
+	/* 17 * 2^72 * G */
+	{
+		{ { 0x8E12905BF58E4AF1, 0x9A162B86C4C4D355,
+		    0x258CCC387DF25FCC, 0x19B7F43FD22272BB } },
+		{ { 0x0B0BA9931461B19D, 0x8A3AA9F0E5CC3CFD,
+		    0x11DCFB0E4BD22242, 0x72E815F6B5865065 } }
+	},
+	/* 18 * 2^72 * G */
+	{
+		{ { 0x83DB50F8A026AC27, 0xC52A0CF377FC121B,
+		    0xCF76B0B34A2FBD26, 0x41C658783455B545 } },
+		{ { 0xF69D2E8E3E53FDAE, 0xF5275C92F98A7431,
+		    0x45FDACF48C983024, 0x6A5E284411633F68 } }
+	},
+	/* 19 * 2^72 * G */
+	{
+		{ { 0x779FDE315B3AA027, 0x726DC5DAF36E175D,
+		    0x1EEE3D63B1FABF93, 0x2296EC84EDC812C7 } },
+		{ { 0x79BB5F8AF39EB46D, 0xC4983E558C23CD31,
+		    0xCA86B19ED758F3F7, 0x7614F63543FF8F19 } }
+	},
+	/* 20 * 2^72 * G */
+	{
+		{ { 0x9411BDBE1F5A3AFE, 0xBE7F2D2455A80175,
+		    0x41938CFAD3D5E509, 0x3152CAE2066F3B13 } },
+		{ { 0x314D92A2077A3704, 0x9D0E5D5EF71D5529,
+		    0x3659D5A214677AB4, 0x1AFA7A827F7F0627 } }
+	},
+	/* 21 * 2^72 * G */
+	{
+		{ { 0x9766F8FCC1B205C8, 0x46366BC0AD7992E0,
+		    0xA6440A72D201E450, 0x1CBDB4F508D8D920 } },
+		{ { 0x0C1195BBD71DCDD7, 0x96E6BCE5F7DD770A,
+		    0xE3D5394DEBCED636, 0x12AFC5D360031670 } }
+	},
+	/* 22 * 2^72 * G */
+	{
+		{ { 0x4D4A16A2D1A399A6, 0xDB029D61CD8A9070,
+		    0x5D9E51F7F1560418, 0x04C5D81DFBB266A5 } },
+		{ { 0xCF33CC784D888D7E, 0x95FD94AEC9EB2C17,
+		    0xB5BED316F453E455, 0x114C0D4B28F2F342 } }
+	},
+	/* 23 * 2^72 * G */
+	{
+		{ { 0x1BF2E4B2B78B1827, 0xF651C26DD9B97830,
+		    0x4FED5EACE1BA2B7B, 0x4071FA57E9033C74 } },
+		{ { 0xA620FF85F30C41C4, 0x5E6648FA9E274B72,
+		    0xFA0B9D3376672130, 0x11E6AA59055082E5 } }
+	},
+	/* 24 * 2^72 * G */
+	{
+		{ { 0x63DCFBABD14FE2DB, 0xDDD73639AF4A0DA7,
+		    0x31584BA1607471BF, 0x7A4665C8E39EF186 } },
+		{ { 0x1171F4855BCB5E50, 0x1DF7E42C87ACB73C,
+		    0x488670C6EA690D81, 0x4597200EAF709EDB } }
+	},
+	/* 25 * 2^72 * G */
+	{
+		{ { 0x4DEA6678249852E1, 0x2A208DF5867C888B,
+		    0x06BEC56B0CE5E076, 0x2947EEFF9289B17E } },
+		{ { 0xBA756DA32281A3E5, 0xF280A6AE7797FD1B,
+		    0x601B1704F390469A, 0x26296FDB624252ED } }
+	},
+	/* 26 * 2^72 * G */
+	{
+		{ { 0x2512E3016516AF55, 0xFE70820652859990,
+		    0xAA146B48FDD31006, 0x5108CC15BA1E0E06 } },
+		{ { 0xE041CFA5072FE71D, 0x7B937AE1BF23F8A4,
+		    0x8B23DDDF3D00BEDD, 0x28AE1E7D3512420A } }
+	},
+	/* 27 * 2^72 * G */
+	{
+		{ { 0xEA15FEC1DCC5B721, 0x1F3BF68F5BD777D8,
+		    0x284040874FB24724, 0x539F92CEB02B6867 } },
+		{ { 0x83D9A370466B80CD, 0xB38ED0C1999A4119,
+		    0xFE5DEC9D01968CA4, 0x2A88A9785757BCFE } }
+	},
+	/* 28 * 2^72 * G */
+	{
+		{ { 0x52C405EC046163E1, 0x55E8AE050084CB78,
+		    0x5FD146491086C7E4, 0x392145BE6CBDE94C } },
+		{ { 0xFE631C55855A8C2D, 0x32354A2FB123A4F5,
+		    0xC8D47E2A119130CB, 0x164590A2085A2D27 } }
+	},
+	/* 29 * 2^72 * G */
+	{
+		{ { 0x05E84ED93201CE3D, 0xFADCAE1CF1E3647C,
+		    0xE8C977237621FB9C, 0x2FBDEEF81B4FE05A } },
+		{ { 0xE9B4CF2AAF2E615E, 0xAE573A728A9BD238,
+		    0xD47D0259D80A79AF, 0x44A1DD760BDD6E83 } }
+	},
+	/* 30 * 2^72 * G */
+	{
+		{ { 0x53EEC7E958DEF9FB, 0xCA4E3FB7128F4384,
+		    0x39498177B384E2D7, 0x44212BBE2A8F7AAB } },
+		{ { 0x189550DE552F2631, 0x8E5BD64BBFC38FD3,
+		    0x12C0AED2C4201E66, 0x384763D553D1E6D8 } }
+	},
+	/* 31 * 2^72 * G */
+	{
+		{ { 0x1DD42E5C5BA05BCB, 0x933FCC6EAE0744E7,
+		    0x4EF30D854DC9055C, 0x642D8E8629BD02B2 } },
+		{ { 0xA1F66D04417C423A, 0x6D5CFE26A42AE747,
+		    0xE55D7884E0970440, 0x4745A294E79F60F8 } }
+	},
+	/* 32 * 2^72 * G */
+	{
+		{ { 0x2E1AA3F6E96DA24D, 0x53278CFC0685DAAC,
+		    0xC8E6C91FFC9E5FBD, 0x356FE20191BCB076 } },
+		{ { 0x05D0B5EA6DE1E029, 0x9C9EF588AB029F09,
+		    0xC4D6EDDCC285104E, 0x56CB17A581E841FC } }
+	},
+	/* 1 * 2^96 * G */
+	{
+		{ { 0x6AE96E6939AB91F6, 0xA30D355DCB37D0FD,
+		    0x17C6E7C84F05BB75, 0x5EBBC4DBA4554239 } },
+		{ { 0xF42FEB7188314CC7, 0x6E47B812D949306B,
+		    0xCCEC128554FB2EBF, 0x0527198E11E8398F } }
+	},
+	/* 2 * 2^96 * G */
+	{
+		{ { 0x1535010AA8BB9CE3, 0x780C59960C672E1A,
+		    0x3D456E59ADA6AA28, 0x3F4C86562645A8C7 } },
+		{ { 0xCFA2A379144F4EE3, 0xBEB8664E3B46464B,
+		    0x11ABC58D9EF7F4CE, 0x63A19A4AC2160C37 } }
+	},
+	/* 3 * 2^96 * G */
+	{
+		{ { 0x39652960AF7A8BD6, 0xE96C27C8A61EE0A0,
+		    0xCF8890A9875B1339, 0x6DFF595CAB4169DC } },
+		{ { 0xAD0F1CF8D4A2A9ED, 0xCA00F145963AEB78,
+		    0xA5B443E88C8A995B, 0x68FE969D595DA557 } }
+	},
+	/* 4 * 2^96 * G */
+	{
+		{ { 0xB63F58E75A683B5A, 0x915E68E884F0B656,
+		    0x1D6A2EC6E78762B6, 0x115A233AEEFB3EF4 } },
+		{ { 0x2B462BE2026F26BF, 0x769600329037F973,
+		    0xE61AA40355321930, 0x50E1C5CB1035BA92 } }
+	},
+	/* 5 * 2^96 * G */
+	{
+		{ { 0x8F5FBD2691C711EF, 0x3625D797A125A6F8,
+		    0xDC848F2D19B2ACE9, 0x2869414FE69C7983 } },
+		{ { 0xF143D0A2D8197B12, 0x65C3630287E6F750,
+		    0x9A613CA0B8D3CC03, 0x67CA12B3AA2B3592 } }
+	},
+	/* 6 * 2^96 * G */
+	{
+		{ { 0x5B9522DD8B24D210, 0x0CA3CBAA364B31D8,
+		    0x3F0D1E5E40B51801, 0x65EC741551BC8751 } },
+		{ { 0x66D1C4E7F84DBCB7, 0xA8C14E4C401A8725,
+		    0x59164ECA80DBC2BC, 0x14AAD6B599A78A1E } }
+	},
+	/* 7 * 2^96 * G */
+	{
+		{ { 0xD65502F90F67B8C6, 0xA318126D47304FD7,
+		    0x52B0DE0EB6880809, 0x4E17F8E6ABAA780E } },
+		{ { 0x4945F8F959B9DE26, 0xF18F65CE65A3396F,
+		    0x6F473508FECBBD48, 0x0E4BBBA7186F99D8 } }
+	},
+	/* 8 * 2^96 * G */
+	{
+		{ { 0x47C285F71FB2A6B2, 0x59847CA246D6FB17,
+		    0xD7262787B0F62026, 0x14812850DE6EF7F8 } },
+		{ { 0xEB6C22C3F0A9107A, 0x333F90D71213C5D6,
+		    0x708B748FFC2CF704, 0x0A5A0B095EEF3AE2 } }
+	},
+	/* 9 * 2^96 * G */
+	{
+		{ { 0x8ADB44375A819D8C, 0x1243C67BA6F217C3,
+		    0xA5E03CBBDEF34D1C, 0x5403ECFBDB351168 } },
+		{ { 0xB57F038953528D6F, 0x8532FC2EB125FAA9,
+		    0x4939822CA0DFD6E1, 0x564B7C7031F46F71 } }
+	},
+	/* 10 * 2^96 * G */
+	{
+		{ { 0xB8626CEF0B66C315, 0x5AEA78394162E362,
+		    0x422486F3CD916860, 0x27581E0F10C28651 } },
+		{ { 0x040517E7FFF5A9C5, 0x330C9C2D660425BD,
+		    0xCE8D37937C6A07B2, 0x3DD751641DAF0314 } }
+	},
+	/* 11 * 2^96 * G */
+	{
+		{ { 0xA0D846835CF81671, 0x5D67C9059E5E678D,
+		    0x6943085EB005D5C6, 0x3B24448E09F32949 } },
+		{ { 0x18783C03ADA62EC4, 0xC5B45AA571C235CD,
+		    0xBEFEB86A7445E4DA, 0x3D48795BFD0C2552 } }
+	},
+	/* 12 * 2^96 * G */
+	{
+		{ { 0xFE68ABB9FA45F7F3, 0xFAB4C169E791A917,
+		    0xF2937C942DF98099, 0x450EDA2336A5CEFB } },
+		{ { 0x9414326378E30999, 0xEA45DB59B0EBADC6,
+		    0x5D49692585A4CA9A, 0x28CCDF7A077298FB } }
+	},
+	/* 13 * 2^96 * G */
+	{
+		{ { 0x2B0DD3D1F5ADB585, 0x4839FF341290E516,
+		    0x2C0601315A953B85, 0x33472AF0C1C807CC } },
+		{ { 0x1807AFEA74552B95, 0x1AB27832351FD8D9,
+		    0x17A4AEFA664DCFE5, 0x209E350FB83C318F } }
+	},
+	/* 14 * 2^96 * G */
+	{
+		{ { 0xAB50276DA2632117, 0x2405AA1EF6E82B00,
+		    0x6C594B8520AEC105, 0x7265F48EB971A273 } },
+		{ { 0x65574A29BF69FB64, 0x9B643E0E6B23043F,
+		    0x4011E0FFBC5598A9, 0x44EE847F3527D7F1 } }
+	},
+	/* 15 * 2^96 * G */
+	{
+		{ { 0x10508891C714E2B7, 0x24392BC4DEA2F65B,
+		    0x911C383A03967798, 0x15BB152C596593B9 } },
+		{ { 0x9F0A650D09DA3307, 0x0B470BC7CF9DA989,
+		    0x0302B707A8C14A4C, 0x7E34B298C62F3F0C } }
+	},
+	/* 16 * 2^96 * G */
+	{
+		{ { 0x55FB7DCED43732D6, 0x2BCBAD933C3B24B5,
+		    0x496440C07A15050F, 0x436368668D0C3389 } },
+		{ { 0x0B82041B8BED402A, 0x8AA42B784329DB06,
+		    0x5FDD9604C46F91B3, 0x60DE6316B1D2ADD9 } }
+	},
+	/* 17 * 2^96 * G */
+	{
+		{ { 0x18F5D0617F7CB566, 0xE8EFD208571605D1,
+		    0x1FA278507EA06447, 0x033D4FDB5FAFA719 } },
+		{ { 0xCE9FAC89E3F953C1, 0x0E263EF3BC877E58,
+		    0x00099D5A0AEAF898, 0x5073D8F6462B69D8 } }
+	},
+	/* 18 * 2^96 * G */
+	{
+		{ { 0x7BF4447A0F86BCAA, 0x355533E02679FFC5,
+		    0x6F37CA4AF882DF49, 0x2E855C00524A2E5F } },
+		{ { 0xD14625D83C1A5ADB, 0xE872084F04B9FB9D,
+		    0xB04CB63B8051B902, 0x785642709F6859AF } }
+	},
+	/* 19 * 2^96 * G */
+	{
+		{ { 0xAE4EF13CC72E4884, 0xFC32918A6CD9F999,
+		    0x84E0BD44353CF7FB, 0x0F02841A9938148B } },
+		{ { 0x28A8874330603054, 0x3000F562A6F6E7DF,
+		    0xCD3CAA6038DB07E3, 0x7CE0548A41323754 } }
+	},
+	/* 20 * 2^96 * G */
+	{
+		{ { 0x96491475C23769F0, 0xDD7553B63749712D,
+		    0x321FE6BDA2EEA411, 0x39E822A85B806D89 } },
+		{ { 0xF3A61544573CD7CF, 0x428B32A1A0CB56B3,
+		    0xA7893F1598DBB5F9, 0x09E9E28B292D7689 } }
+	},
+	/* 21 * 2^96 * G */
+	{
+		{ { 0xB1C9979B0FEF4E39, 0xA73C4194B7C355F4,
+		    0x3FECAE4B01B19992, 0x1465E39F2B0903A7 } },
+		{ { 0x054070AA742BD71B, 0xCDE741E992536659,
+		    0x0A38362755B8832B, 0x1AF9E4E4AB2F6BD1 } }
+	},
+	/* 22 * 2^96 * G */
+	{
+		{ { 0xDD4085F31FFBCF0E, 0xF3AAFFC981385722,
+		    0xE42CFA943E35A70A, 0x535921CAD386F24D } },
+		{ { 0xD6686ED9C5EBD926, 0x8057F6600DC24B33,
+		    0xA0E9B68737970ABD, 0x38D0254EF20B4A02 } }
+	},
+	/* 23 * 2^96 * G */
+	{
+		{ { 0x91E7C53CF4EB2FBC, 0x4D5DD9F37FF8F584,
+		    0xD32EA02D9C133FD0, 0x4F02B6E66B50B4B0 } },
+		{ { 0x7D66BD42E7E0E221, 0xAEC13DF5BBF0BA5D,
+		    0x966C8292497ECA7B, 0x3FB21C34DCE2C44D } }
+	},
+	/* 24 * 2^96 * G */
+	{
+		{ { 0x61413AD6692C8800, 0xF3B2A441238B9858,
+		    0xE724656AEDF8AD98, 0x3FEACA303D1065E4 } },
+		{ { 0xC8468016A878A3DF, 0x7E6E123CFE2C1954,
+		    0x115A4C7C4A6B1957, 0x6C3BC024E9E721FD } }
+	},
+	/* 25 * 2^96 * G */
+	{
+		{ { 0x43A6053E7F186854, 0xB440A4527BB41E10,
+		    0x728AD6D5FF296083, 0x10A84361CD03D8ED } },
+		{ { 0xA54F83FBBBB49BA8, 0x123149E0D95E62CF,
+		    0x5CA7E480A46FBA62, 0x337FAFDF296DCC13 } }
+	},
+	/* 26 * 2^96 * G */
+	{
+		{ { 0xDC1CBE8F4EB76A3E, 0x3F3EA7B8B9436FBF,
+		    0x8102F3EDA0E9578E, 0x24DFBFC787BE1F74 } },
+		{ { 0x40021B0B70ECE11F, 0xEF44AA65DE63EFE1,
+		    0x0AC62434AC9C5692, 0x26B4C9127A617C0A } }
+	},
+	/* 27 * 2^96 * G */
+	{
+		{ { 0xE6AF220A55A836E3, 0x0B096D641213628D,
+		    0xF4ED93D411F55989, 0x4CA54C6D4F94FCE0 } },
+		{ { 0xB50A3E1806F214B2, 0xC1DF33C36716EB76,
+		    0x39B8E66D43625A92, 0x11C1ADF3ACF71586 } }
+	},
+	/* 28 * 2^96 * G */
+	{
+		{ { 0x841A95BA4D58CD16, 0x5775AED356BD0D00,
+		    0x83C234CFDA6980DB, 0x3D956B0F1DBB725D } },
+		{ { 0x2B992ED18C7662D1, 0x5F19D337A337FFF7,
+		    0x4C20D40EA7505FC2, 0x31DC2E15DC4A5752 } }
+	},
+	/* 29 * 2^96 * G */
+	{
+		{ { 0x834D8EFA2C0BB6DB, 0xDDD5747FAD03A6FA,
+		    0xEB4FE36EA2988E7D, 0x6483085DE95A06AB } },
+		{ { 0x02ED09F0856CFB69, 0xD8B07789B5212DC2,
+		    0xD890C7543ACB52F5, 0x581DD6CB41B2A69A } }
+	},
+	/* 30 * 2^96 * G */
+	{
+		{ { 0xA262A2E275B156A9, 0x16C2299E3D75A04F,
+		    0x8702D27D37DAC87D, 0x586852BFA56AA522 } },
+		{ { 0xCDD28093EC4D59A1, 0xB6B1350214EF28E2,
+		    0x6233D836EF56235D, 0x6FDA2A49A3676479 } }
+	},
+	/* 31 * 2^96 * G */
+	{
+		{ { 0xFCB290EB6D06F270, 0xA48917DC8567490D,
+		    0xB0D0BC8042ECA8A3, 0x4B420B9C25402E4F } },
+		{ { 0x503D95512D20CD5A, 0x383850DA7503A2F6,
+		    0xF0160D1802A28ED9, 0x4DF9ABEED7CDCF25 } }
+	},
+	/* 32 * 2^96 * G */
+	{
+		{ { 0x9A282A62AC7736B4, 0x949CAEE514D7EE13,
+		    0x1936709E72A926CC, 0x0D0EEF1EC55E75B1 } },
+		{ { 0x69DB2605156AB90F, 0x4C1D90ECF808974E,
+		    0xCE4CC2F78C6ED193, 0x60BE686888D67CF9 } }
+	},
+	/* 1 * 2^120 * G */
+	{
+		{ { 0x64E34CF09E6845BE, 0x69C1550748BA1E46,
+		    0xE9D4512AD862DE67, 0x6C188C963AD02A4E } },
+		{ { 0xF8434A880479FBE5, 0x38766500DA9897D6,
+		    0x6C6B162B8EBB29B6, 0x519A048D96B27CE1 } }
+	},
+	/* 2 * 2^120 * G */
+	{
+		{ { 0x8DCC8B34E3EC1F71, 0x8EF3992C4FEB9100,
+		    0x36F2BEC3A464A931, 0x695B8F1225E8BD03 } },
+		{ { 0xEA25B1F81A0A1A29, 0x423BA40152926534,
+		    0x79215003D02D0448, 0x597D7FBEBBC8F4AB } }
+	},
+	/* 3 * 2^120 * G */
+	{
+		{ { 0x82974D73EDB695CB, 0xAF56D2A421D1931A,
+		    0x1AB2EAE4BC35211B, 0x3704EA8997B4A698 } },
+		{ { 0xD48400ABFC492DA5, 0x87254CD0ECDE6769,
+		    0x92BDEE7ED9009BDD, 0x4C4B012E1FCD00B6 } }
+	},
+	/* 4 * 2^120 * G */
+	{
+		{ { 0xC1F37C08A562B029, 0x374990F3425781C6,
+		    0x1812465520AF754B, 0x49D628B18AAE1254 } },
+		{ { 0x4B116A72C6840348, 0xE433053381B80C90,
+		    0x08D340D4B6B79A4B, 0x73C815016D804C86 } }
+	},
+	/* 5 * 2^120 * G */
+	{
+		{ { 0xF35CE166C5DF7446, 0xA29E4A7CBACD269C,
+		    0x8897C6C31F9B9A6D, 0x7AFA4EF7DEE0385D } },
+		{ { 0x528FA0B1B4B9A399, 0xDE3326E7B2609785,
+		    0x05906A676C5A3E1A, 0x60738D1C6F092C57 } }
+	},
+	/* 6 * 2^120 * G */
+	{
+		{ { 0x73DAC6C21C92CBF8, 0x23D3522D7149C062,
+		    0x4BFBF3A696864CD8, 0x40BAC9BCC76D624A } },
+		{ { 0xEDCE0CBC0AA4D095, 0x6E87ABB7264A7A58,
+		    0x8C666322D88C5295, 0x57AB611E79A5E37D } }
+	},
+	/* 7 * 2^120 * G */
+	{
+		{ { 0x6EE8C6737153BDF8, 0x458C4F830013B232,
+		    0xAA0003FFA623C207, 0x1DAD0B80F0718212 } },
+		{ { 0xDA5DAEFC4F99A5F5, 0x70E802BBE858817F,
+		    0x90E4FA5434BADE03, 0x5D93CE3874FA7F43 } }
+	},
+	/* 8 * 2^120 * G */
+	{
+		{ { 0x4D54AA20618FEF23, 0xF244A0BA58AA924B,
+		    0x8C567E62829CE3EB, 0x4341D236027F36D6 } },
+		{ { 0xB49E76C6BF9C0315, 0xB3C637E559A8A73A,
+		    0xE2469D9F56073C80, 0x2AB5765BF5F53A70 } }
+	},
+	/* 9 * 2^120 * G */
+	{
+		{ { 0x6465BB6B33844C9A, 0xAF03CB1A04EE3508,
+		    0xF3E50834B4B3B806, 0x43EBAF96C93B78D7 } },
+		{ { 0xF85FE50CF550D7BF, 0x6D84C67D35343E1F,
+		    0x601D5BAA24BCDB45, 0x4A8B52B0F2CFC0F8 } }
+	},
+	/* 10 * 2^120 * G */
+	{
+		{ { 0x0CEF38DBF26C47F6, 0x5232878FC044FEEB,
+		    0x125DA655837F904C, 0x49299A94620A5F43 } },
+		{ { 0xE1CB02FDF69E4B42, 0xB1DBE3EF4A27F7A3,
+		    0x2D8D996CD759C127, 0x387B5A3E35C76635 } }
+	},
+	/* 11 * 2^120 * G */
+	{
+		{ { 0x2A3923038BC889C6, 0x5CA8418AF2171737,
+		    0x62A499304DE1911D, 0x647F2DBB6B1096F5 } },
+		{ { 0x4B9C8AD9D2B06512, 0x2DEB74A8BC0FD307,
+		    0xF5D877CC0F50E680, 0x41E061208C5D4288 } }
+	},
+	/* 12 * 2^120 * G */
+	{
+		{ { 0xB5D2CBA24A2705EF, 0x156A281B8C4E90B2,
+		    0xC16CDA37F526D53B, 0x76800924FECC7627 } },
+		{ { 0xDCDEDB69FAB8F45C, 0x22BA1D8FC4C4244D,
+		    0x2095FE077DE55A9E, 0x633F616F3A9DB5B7 } }
+	},
+	/* 13 * 2^120 * G */
+	{
+		{ { 0xA1C3C5A03EA3A375, 0x2373EF279A2D8482,
+		    0x5209D9A511A8B739, 0x2427A9BB8D7F3B68 } },
+		{ { 0x562A6924B4436C5A, 0xC30ED1DDE9AE2B37,
+		    0x7E7C8379927FB74F, 0x6726D833F8A5F1B6 } }
+	},
+	/* 14 * 2^120 * G */
+	{
+		{ { 0x28850B188B37FDF3, 0xED03DA4F5EA44CEF,
+		    0xFB5DDFDE54C64EF8, 0x39DBB492D7F97FC5 } },
+		{ { 0x382B7AF7171C5BE8, 0xDBA845CBD6C4B727,
+		    0x0A7A2427EB09443E, 0x3510C92883CCDB55 } }
+	},
+	/* 15 * 2^120 * G */
+	{
+		{ { 0xF5B17CB881CD02C6, 0x2905B550D2196134,
+		    0x428F811AF4775C30, 0x4035EFC68C389C93 } },
+		{ { 0xB66F9322A437083B, 0x95BAA79B9D34F9CF,
+		    0xB0886CEFFB617D26, 0x647A0881B34520A6 } }
+	},
+	/* 16 * 2^120 * G */
+	{
+		{ { 0x072D33F288A716F1, 0x8FEA5D6B30880A69,
+		    0x2C18E02696032207, 0x7704AA5975B3EEED } },
+		{ { 0x3EA8B561CE2C2D83, 0x08BF18715C2E2329,
+		    0x5CB30868709A879A, 0x5DB7BC9861256EE3 } }
+	},
+	/* 17 * 2^120 * G */
+	{
+		{ { 0x5B3427EA73F0254B, 0x95F61BE53621DE7B,
+		    0x3F3BF255A49FE6F5, 0x7A9A6F7BE3676490 } },
+		{ { 0x195C76AB5DDDD79A, 0xEA8C01FD7CEC591B,
+		    0xC884B1C2466DA0EB, 0x14211ADF7E64B765 } }
+	},
+	/* 18 * 2^120 * G */
+	{
+		{ { 0x0993F7AF2EA4FFAD, 0x491CC7A7452CDCC4,
+		    0x246BF987811D9ADF, 0x1BC5F82AC18D9E68 } },
+		{ { 0xCE77AB7CC395136F, 0xAB179CC8EC9DD9A7,
+		    0x884E176FB5922EFB, 0x50DA9E23F2B7E2DE } }
+	},
+	/* 19 * 2^120 * G */
+	{
+		{ { 0x206F7D7DFC5AC82F, 0x16BF8A715F9AE1C0,
+		    0xC3314AF0C4CF0B71, 0x5F9589E80B8BAEAC } },
+		{ { 0x9DD67F397BFA6154, 0xF682E75E16FDF469,
+		    0x04544968D33F9D2E, 0x1C34B49E85625A93 } }
+	},
+	/* 20 * 2^120 * G */
+	{
+		{ { 0x0BECDBD035417C59, 0xF418479785B5ABBB,
+		    0x44FD1EA3D76447F9, 0x19DC3BB5960FC9A3 } },
+		{ { 0x717399B6B4BB0FAA, 0x8C339E0A0AE9F2E8,
+		    0x4C812F4E1EDB3DF3, 0x5B16EBD232213302 } }
+	},
+	/* 21 * 2^120 * G */
+	{
+		{ { 0x833E6FAC6E406089, 0x78020CFCD071ED9A,
+		    0xFE487904B422AF8D, 0x46891C53E1F3ABA3 } },
+		{ { 0x16371381ACAB7B39, 0x4836BBD8EC8BE187,
+		    0x865F515FE39E668F, 0x368DF9992EB3A115 } }
+	},
+	/* 22 * 2^120 * G */
+	{
+		{ { 0x8AB13BBCA3B953B2, 0xDF2E3D99B707D80F,
+		    0xB64C5736BBB61CCF, 0x2F33DFE47AF35C3F } },
+		{ { 0xD03F0271668FED90, 0xA5B69DCCC5E45AE3,
+		    0xBBEB1D07C085B618, 0x34E47C232AE96FAF } }
+	},
+	/* 23 * 2^120 * G */
+	{
+		{ { 0x6A4F846AF6BDAD61, 0x867139CC1FE11D67,
+		    0x560B630994151D06, 0x7D3820D9FBEA18BC } },
+		{ { 0xB324A9285577E5A9, 0x57E65D4C7687EB1F,
+		    0xA3DA98C61D5CDEE9, 0x64BBD8375C7FC2E5 } }
+	},
+	/* 24 * 2^120 * G */
+	{
+		{ { 0xB106A2D9AE941C67, 0x50A3E1E1D5A06C0E,
+		    0xF28FE37363C03E32, 0x30F013B6D2110CB6 } },
+		{ { 0x4DF92AD3C14A7C00, 0x6610EDCAD1AEFC28,
+		    0x696CEBD5131BCE53, 0x5C1192D7B7E3FA22 } }
+	},
+	/* 25 * 2^120 * G */
+	{
+		{ { 0x5D8249FF1907794F, 0x3DF6DD7F08E0FC21,
+		    0xBB83B33A89AE2B31, 0x70FEDD1E42B548B1 } },
+		{ { 0x368BFC057319984E, 0x58B31D236FE18374,
+		    0x57141C75CBC1B7F6, 0x076B0B0E82A077DE } }
+	},
+	/* 26 * 2^120 * G */
+	{
+		{ { 0xE84FE94DF2339CBF, 0x0927DC006AE9C07E,
+		    0xB584E099B5596672, 0x6F13DA339C5E4521 } },
+		{ { 0xD9CEB1811CAC3E4D, 0xB7F63FC9E51A9E28,
+		    0xB40CF0437D8BC662, 0x49B1817020FA7E84 } }
+	},
+	/* 27 * 2^120 * G */
+	{
+		{ { 0x1DF1C64D07A8B37D, 0xAD962FFB94D53E29,
+		    0x88D93766ED20B4E0, 0x7B9E584D908AF90C } },
+		{ { 0x5F2E0F0256654533, 0x1E355EA89A22C886,
+		    0x3DDCD3D52D20D543, 0x72B44BC507C44812 } }
+	},
+	/* 28 * 2^120 * G */
+	{
+		{ { 0xE8D8C0A08CC3E03F, 0xDF32C357D71B26CF,
+		    0x931EEABC4F8D8025, 0x1DEC9AC5C5BC1E2A } },
+		{ { 0xA317DCB6070397CD, 0x311ACE8C5143D9B8,
+		    0xF02407FF927FCC60, 0x5EF8C5B85C122E23 } }
+	},
+	/* 29 * 2^120 * G */
+	{
+		{ { 0xE58680A24A705AEA, 0x2ED14014BFC802F7,
+		    0x61D3CB5340E28A3E, 0x3A3D8E4BE5F28C1B } },
+		{ { 0x0A2339C66F01CCE0, 0x353D17DEAC2B80B2,
+		    0x6076472E8FB8EA3E, 0x27C43F23384FBE3B } }
+	},
+	/* 30 * 2^120 * G */
+	{
+		{ { 0x31A461D797F31970, 0x3E61350E116B6A00,
+		    0x3273F13F199D117D, 0x0ACF24D58C30B5AB } },
+		{ { 0x9361F476B670DC09, 0xAC751D9144C76865,
+		    0x7FFE6F932E4B0B3F, 0x1BE3BB69A019ADB0 } }
+	},
+	/* 31 * 2^120 * G */
+	{
+		{ { 0x8984A684F10F4EB5, 0x6432B35685EEE7A4,
+		    0xD26F747D1AABEE27, 0x330B48D069598E47 } },
+		{ { 0x08388ACC103C0E4A, 0xDB925B867A46BC9F,
+		    0x6E4E994C5D234CF7, 0x1EC1F18BC7F009DF } }
+	},
+	/* 32 * 2^120 * G */
+	{
+		{ { 0x7E8F1C84CBBBFF00, 0x0BDAE3C3218986CE,
+		    0xC1AF55BC7FAD56B9, 0x0292F462E8319A1E } },
+		{ { 0x315A708D9E0D4F0B, 0x794D5F53B6A0F992,
+		    0x01CBCDC00B10D1A0, 0x68A51EB84A5C0467 } }
+	},
+	/* 1 * 2^144 * G */
+	{
+		{ { 0xF1EB054CF95858EF, 0xEF51C4E69CAD0624,
+		    0x3DA5B358C93127AA, 0x50101ACEACE31336 } },
+		{ { 0x5ADA2C67D48EC4BD, 0xB0B8580B2E2B875B,
+		    0x16F7336BD50FDFA1, 0x1AF19892976850AD } }
+	},
+	/* 2 * 2^144 * G */
+	{
+		{ { 0x7F972196394B2D5B, 0x182A32EE34848E41,
+		    0x4AC512DABD4B6326, 0x468266181833870A } },
+		{ { 0x40F1C0AC1ADDB50F, 0xD2A9B35679BB62D3,
+		    0x90304F4933B4E8C4, 0x3C4360E426C147CD } }
+	},
+	/* 3 * 2^144 * G */
+	{
+		{ { 0xA877B1218C330CB4, 0x447E11B8C68610F2,
+		    0x41310C94E14FAA19, 0x529E20B7E6110A95 } },
+		{ { 0x39E7CAEF6DA77BEF, 0x4027FCBB433DD12B,
+		    0x6318886A3C34091F, 0x4D3E31A0AE52F30C } }
+	},
+	/* 4 * 2^144 * G */
+	{
+		{ { 0xD35722B39B5B5D23, 0x4B916E7B6559F95F,
+		    0xD533D612041409BD, 0x13062F0EBFCC80EC } },
+		{ { 0x6271B5254D3669D2, 0x673A016507E2C193,
+		    0x9FE4AF000028A211, 0x328EEAF152CFA2A1 } }
+	},
+	/* 5 * 2^144 * G */
+	{
+		{ { 0x009D5CA6064B0A9B, 0x90E83ED8A4EFD506,
+		    0xD9B46DEFE0FE80D7, 0x43BA577DF3C536B7 } },
+		{ { 0x6CA504F285F0DFE9, 0x5D891CF38791DD72,
+		    0xE3FE732E888FDB67, 0x6CF225B429957016 } }
+	},
+	/* 6 * 2^144 * G */
+	{
+		{ { 0x083BD9FAC900A637, 0x511C5CC0D0FB28BC,
+		    0x64353E63C2FDBCCB, 0x77A8C688001F3115 } },
+		{ { 0x7D0D95B78097A74D, 0x92DD1EC82C122819,
+		    0xEE6128AB42F750D0, 0x2CD2A28EE6FA1E2A } }
+	},
+	/* 7 * 2^144 * G */
+	{
+		{ { 0x03AC141AC154F55F, 0x5572B1DCF33928F3,
+		    0x53D2D1B0D761FE9D, 0x433E867A39F4C51B } },
+		{ { 0x5E7067B47BCEE0F1, 0xE112934D39B233F0,
+		    0xEFF909FA31AA72C5, 0x5604D8F1437585B2 } }
+	},
+	/* 8 * 2^144 * G */
+	{
+		{ { 0xCCDEF224D7BD1B53, 0x598B5684BD0298E2,
+		    0xB8A343CD6BAAC6C5, 0x3C448E76B7F9CE9C } },
+		{ { 0x6B6C2E742D1D4FC1, 0x4FFFAA04E25EECBB,
+		    0xEFE468A87BA4A222, 0x0A5AFE51ED06F671 } }
+	},
+	/* 9 * 2^144 * G */
+	{
+		{ { 0x883C589B6E711126, 0x9607319CD05D1978,
+		    0xFBC7D23B8CABB99F, 0x104DC1544F38A979 } },
+		{ { 0x8A398745C871C629, 0x88684A757D70E476,
+		    0xED2DEE4AADF0CBA3, 0x51DD276BFDBFBF76 } }
+	},
+	/* 10 * 2^144 * G */
+	{
+		{ { 0x9E13C6558C5A2D42, 0x164803768DFE5FCE,
+		    0xC2999130F48DD33E, 0x170F6F58E43807C1 } },
+		{ { 0xF34A011CE164F7AE, 0x71A9E14D2D518969,
+		    0x4B331AAED932379F, 0x79F9247F26514A24 } }
+	},
+	/* 11 * 2^144 * G */
+	{
+		{ { 0x39383DE1A87737EC, 0x18B19663F810772C,
+		    0x75D3EA6795300CD0, 0x7DE9021359F6B125 } },
+		{ { 0x783667A71A9F46D4, 0xCCA14CBDAB867FCC,
+		    0x8147FC2F173EB861, 0x038AC5BDE95FB4E4 } }
+	},
+	/* 12 * 2^144 * G */
+	{
+		{ { 0xB18FD42B37402349, 0xF12BD28E800D54AD,
+		    0x278AB86E0F3EC630, 0x7F8888E842BDF94B } },
+		{ { 0x023D5EE12CE3532F, 0x321FB4A8244AEA08,
+		    0xECA3B52360D64225, 0x3FC4EF5FC309AE8C } }
+	},
+	/* 13 * 2^144 * G */
+	{
+		{ { 0x62F8E4AD263779ED, 0x4FAA9249361C0D8A,
+		    0xC7DA8CAA6E25F568, 0x4E51D383C5E2FFDD } },
+		{ { 0xFF57B50A9E055794, 0x624C0FC54F3E8334,
+		    0x95963612B9B03CAA, 0x479C61CA1FBE6ABF } }
+	},
+	/* 14 * 2^144 * G */
+	{
+		{ { 0xCF008DA0E4964CA0, 0x235519B43E117C9A,
+		    0x9A4744C18709A65D, 0x64BA5A5945A7EE90 } },
+		{ { 0x2AB8A8F03707C115, 0x5DF5193C42358209,
+		    0xA2B5C7ED998F2842, 0x450D9A811184A628 } }
+	},
+	/* 15 * 2^144 * G */
+	{
+		{ { 0xCD7F5307CF1F43CC, 0xDB6E296A10C71924,
+		    0xADE1A63C75BC8DC6, 0x3465FD9553998915 } },
+		{ { 0x9DB426A83A868EAB, 0x17A5849A5BE73726,
+		    0x80AD5E33C4F9DEAC, 0x2291BEE7287B48AB } }
+	},
+	/* 16 * 2^144 * G */
+	{
+		{ { 0xA5E7E4CFCE6FAE6B, 0xA0697B8CBBCF1DA7,
+		    0x07014DF0C4B12A90, 0x0DC979B068157B07 } },
+		{ { 0xC02ADBA93C2EB4A0, 0xF77B20DD76920C5D,
+		    0xA6006BFF59BACF05, 0x3117DE803A320E09 } }
+	},
+	/* 17 * 2^144 * G */
+	{
+		{ { 0xA5DB426C13A904E9, 0xF3F0E94677A6B508,
+		    0xD251A4FF14FD230B, 0x0410F779481F27B8 } },
+		{ { 0x63F5ED50BAF4E22C, 0xB1E066579407E6BD,
+		    0xCE5BEB1D28B91A18, 0x2ECFF998642D46DE } }
+	},
+	/* 18 * 2^144 * G */
+	{
+		{ { 0x796F4D830F634F33, 0x6CA802DC2F4083FD,
+		    0x507FF68A511A2727, 0x47867ABC36A6FBF4 } },
+		{ { 0x755F436C44C1D3B2, 0x80DBC8C11113DAF6,
+		    0x447F65B37E295038, 0x6D05F24B0E6FA261 } }
+	},
+	/* 19 * 2^144 * G */
+	{
+		{ { 0x383086332795933F, 0xB366EE85887F59F9,
+		    0x236D30927715C5ED, 0x69F70BE39D0F617D } },
+		{ { 0x396359079069B09C, 0x4725844E367774CB,
+		    0x734D7E68402E002D, 0x0C083289F88CA1BF } }
+	},
+	/* 20 * 2^144 * G */
+	{
+		{ { 0xB8596C5E17347D45, 0xE38D5EECCE0D85E8,
+		    0x8E5A3A9E1A02944B, 0x58FED47FEFF6173E } },
+		{ { 0xA2322BB95AB82321, 0xF5DB35E8713B7AC0,
+		    0x02AB8081479D6725, 0x11DC91464EB36D26 } }
+	},
+	/* 21 * 2^144 * G */
+	{
+		{ { 0xFFA8CEA93706947D, 0x9114BA54ABC25AF7,
+		    0x569D43AAED9F6487, 0x34EFCC7ACE62B507 } },
+		{ { 0x1AE01FF17E328536, 0xFD2709EA19C2F42C,
+		    0x2BBC996533234FBD, 0x3116ED76D2CD06B1 } }
+	},
+	/* 22 * 2^144 * G */
+	{
+		{ { 0x545250A2AC441BF8, 0x1C04409E761F265E,
+		    0xD640DE795DA1325A, 0x6D3ADC6EAB788CC7 } },
+		{ { 0x1AFE8CF7DE198FB1, 0xF1541E63F7068645,
+		    0x65CDF8B46DEBB19F, 0x7F8845A2969B9D36 } }
+	},
+	/* 23 * 2^144 * G */
+	{
+		{ { 0x37541A9EC0ED1FAC, 0x8087ADBA82030C0C,
+		    0x08E144306843531F, 0x1649AE6959423367 } },
+		{ { 0x1D29167423F55ADB, 0xF4497D299722DB08,
+		    0x190D124FB9A415B8, 0x791C3385098CBF66 } }
+	},
+	/* 24 * 2^144 * G */
+	{
+		{ { 0xC2D2E74763493D54, 0x0535C5D4ACFB513F,
+		    0xF512233191334C4D, 0x5499A5F20AB429CD } },
+		{ { 0xD02D5E52D48B425A, 0x581F1F8FE1D8E954,
+		    0xCE21244992ADDEE6, 0x43714F67A5E0726D } }
+	},
+	/* 25 * 2^144 * G */
+	{
+		{ { 0xF88559368CE7D409, 0x3ECDC11FF2FDA742,
+		    0xB149ED53C1A50B3A, 0x6AD38CC9880DCEFD } },
+		{ { 0x36E29B6B2005DC59, 0x025FC2BCA61772D6,
+		    0xCB3BA7DE0788F557, 0x1B0C0F904BD6000F } }
+	},
+	/* 26 * 2^144 * G */
+	{
+		{ { 0x182EF81AE0AD36DF, 0x66E98349D44B99C0,
+		    0x60CE1B070D4C900F, 0x477259A87542E9AE } },
+		{ { 0x9F3F8CE7C658EFDE, 0xDDD1E0129433BF04,
+		    0x7C0D5F7AD45A281C, 0x69A162C8A9F0C913 } }
+	},
+	/* 27 * 2^144 * G */
+	{
+		{ { 0x45451EB7C9679737, 0xBBA8B79C742C88D1,
+		    0x6CA8C9463BB5B046, 0x35B610A790AED877 } },
+		{ { 0x15CF0F796FDE417C, 0xF6E746ABD421AF18,
+		    0x8F93A629BC259D75, 0x2FCAF328D225A5B4 } }
+	},
+	/* 28 * 2^144 * G */
+	{
+		{ { 0xAE0DAA5555BF5D92, 0x087ADB426456DA4A,
+		    0x2E431CF3E0BB1711, 0x335C554769E301C6 } },
+		{ { 0xF1201B13242F0F78, 0x3440D3205541E110,
+		    0x586104A121256803, 0x3C86374DF13FD9BE } }
+	},
+	/* 29 * 2^144 * G */
+	{
+		{ { 0x8F7E859F54EB78F1, 0xC5A7B77CA798332D,
+		    0x77C4589869DF2DAC, 0x41238909D0677344 } },
+		{ { 0x2B859C4EF4828915, 0x54242D1E18E9D6DD,
+		    0xF8FDF3F1584251BA, 0x69701E931C4E84FE } }
+	},
+	/* 30 * 2^144 * G */
+	{
+		{ { 0xB19F4AE3EED45C20, 0x650BB1086F91EB1C,
+		    0xBC95ACEF90488788, 0x0485932A538C5D14 } },
+		{ { 0x65970F7F42E52A14, 0xED43E1A49DA5316C,
+		    0x87B863C23F9745C5, 0x44B23F3434C9E0B1 } }
+	},
+	/* 31 * 2^144 * G */
+	{
+		{ { 0xED0F5933569AC0CE, 0x18A54D98E0DF31FA,
+		    0xC825FE0DA2199423, 0x6B0C12C2E19A84D6 } },
+		{ { 0x4AF26C8EADA0FDF8, 0x0E5A1477F1E1AE74,
+		    0xC2F2D5F26AB98370, 0x0E8FB2CA9F8C85F8 } }
+	},
+	/* 32 * 2^144 * G */
+	{
+		{ { 0xDD67DA380EB42C3B, 0x7178D1847C0F69D6,
+		    0xFC8324CCB2F61D79, 0x410F51D5A801CDA6 } },
+		{ { 0x60666E7E21E6E0DA, 0x9D81A72274AB9E81,
+		    0xDC609D90644C6954, 0x1A4273FC131F88A9 } }
+	},
+	/* 1 * 2^168 * G */
+	{
+		{ { 0xCEBD72B0F80783BB, 0x6D8FF0935859F620,
+		    0xFBCC45E3233B4195, 0x677D517AA3273B48 } },
+		{ { 0x551D315FC317FF73, 0x1D9415E710160C3E,
+		    0xBCF7CA46FED8D040, 0x5C5CD86D39445017 } }
+	},
+	/* 2 * 2^168 * G */
+	{
+		{ { 0x148E9894C1CE5325, 0xE815766097098A0B,
+		    0xDEEC6742F3806677, 0x2A70787A3A8BB5B5 } },
+		{ { 0x5938FDF68058DCB3, 0x1A8C4DFAE91F35C2,
+		    0x63FC34B770B2B1F6, 0x0C16A36989A05CED } }
+	},
+	/* 3 * 2^168 * G */
+	{
+		{ { 0xF060E98E9D16B07D, 0xAAA775266ED253D6,
+		    0x4DD26E6293E272BC, 0x413012B1200F507B } },
+		{ { 0x2DE3CEEA53494CF7, 0xE1AC3673B3D4A6D1,
+		    0x24C31A4912B0D106, 0x0BEF77512CC808C3 } }
+	},
+	/* 4 * 2^168 * G */
+	{
+		{ { 0xA40508ACB591FF30, 0x5F66345B3E5A07D6,
+		    0xEB4EA9EC1FF8B521, 0x773AE0673514D417 } },
+		{ { 0x7648389876D51442, 0xCC4941A6CE1F8C85,
+		    0x14FB68BF7FB5CA3B, 0x3DDB101F76166D6A } }
+	},
+	/* 5 * 2^168 * G */
+	{
+		{ { 0xE91E28996404CC55, 0x18B9E52F665A8A38,
+		    0x7329C1CC3E9E6B21, 0x708E4E1A2A341CCA } },
+		{ { 0x5907C0E6895AF53F, 0x3A6AFFCF7E1C7C9A,
+		    0x4231687000E25D16, 0x5F77641B38734B08 } }
+	},
+	/* 6 * 2^168 * G */
+	{
+		{ { 0x7003471133EF4768, 0x09A5335E800B08DC,
+		    0x6515C905BCF37349, 0x0708369B73E13F14 } },
+		{ { 0x551DE247024F3DA4, 0xF4CAC6515DF745A6,
+		    0xEC09FD11734FE392, 0x4912A91DDEC544CF } }
+	},
+	/* 7 * 2^168 * G */
+	{
+		{ { 0xC4B1A3BA0134E27C, 0xB459E9C137832747,
+		    0xE0E243952D6235E4, 0x6C038834BF8E1613 } },
+		{ { 0xF03A09893F7280CB, 0x27152D2AB182C4F9,
+		    0x20616347699343C0, 0x50B979AB23D45852 } }
+	},
+	/* 8 * 2^168 * G */
+	{
+		{ { 0x57ACDDB98783BF41, 0x91F3C4633E0FFE01,
+		    0xC990B124298E5217, 0x091B2C1060DCCA54 } },
+		{ { 0x61BFDD48105C7A74, 0x7713223873316561,
+		    0xA17FD0A171D0C99D, 0x0ECAF624D1D803E9 } }
+	},
+	/* 9 * 2^168 * G */
+	{
+		{ { 0xF914CE5F2A05693F, 0x0AED8E2DBA06F030,
+		    0xAD96E4FD55DFB00A, 0x0507D506D4B73BCD } },
+		{ { 0x7945FCBEF49BD4F1, 0x6CA061F2778C2F85,
+		    0x86C1B49FF8B1A885, 0x79388397576959C3 } }
+	},
+	/* 10 * 2^168 * G */
+	{
+		{ { 0x9F63397FD9CF3624, 0xF1C6258C9D9422EF,
+		    0x78C5014B139EA1AA, 0x262403B1FE788C75 } },
+		{ { 0x1B999F2E308391E5, 0x66B1B7EE5C301CF0,
+		    0xA9FD5B807B0541B9, 0x7584E0155B71037C } }
+	},
+	/* 11 * 2^168 * G */
+	{
+		{ { 0x841E7981C4B71A93, 0x2BE7F3474D83F888,
+		    0xD0B42CE25C428723, 0x5D1FDE1BC28C9445 } },
+		{ { 0xDADE954CE98F15E5, 0x892FE45E94AE6A99,
+		    0x35C9E2F40BB3E394, 0x47EB0EACCD23FDFA } }
+	},
+	/* 12 * 2^168 * G */
+	{
+		{ { 0x1FAF70A3D422F639, 0x8CFE5A825B45530F,
+		    0x9216028DBB10BBF9, 0x2BC1CEA60A84B882 } },
+		{ { 0x1D4396FF475C10B3, 0x3FFE6AA3E9906AD4,
+		    0x85E680EEB1B51CB3, 0x47B4A6BA674948C7 } }
+	},
+	/* 13 * 2^168 * G */
+	{
+		{ { 0x93DDC4BFA39EC0CE, 0x9CA6B8D8BE185516,
+		    0x48C8581E8D195E5F, 0x10F3203A3CD8EF73 } },
+		{ { 0x484D8063DDEEEA83, 0xC166861A7F3303A0,
+		    0x2C8DB64574A2DC65, 0x36C7288F2FE7498B } }
+	},
+	/* 14 * 2^168 * G */
+	{
+		{ { 0xBDEB851064F0BE8E, 0x14470D06A8D15D76,
+		    0x9AD620322768B68F, 0x14060693B1ABC16A } },
+		{ { 0x32C33B0B8B5A39B2, 0xFBCC52CD756441AD,
+		    0x4B2006DC7E7AFA98, 0x417F185ED4A85C87 } }
+	},
+	/* 15 * 2^168 * G */
+	{
+		{ { 0x3679C3301EC640FF, 0xFF547B66117FE06E,
+		    0xBC35AC67C550B055, 0x66E54790CE4C9F43 } },
+		{ { 0xD14C9298DE74BE0D, 0x42D5829F8B8B205F,
+		    0x48FB16A1226C2C49, 0x42309D9730ECEFE4 } }
+	},
+	/* 16 * 2^168 * G */
+	{
+		{ { 0x39B86011D4DDD67B, 0x9600E6CC662AC1C8,
+		    0xEAC823BF99A502A2, 0x20DF4B6452750D56 } },
+		{ { 0x9D27790D1B2240CB, 0xE4680F374B0F8017,
+		    0xD42ABAF54A5A93EF, 0x1EB56AA9CABDFA86 } }
+	},
+	/* 17 * 2^168 * G */
+	{
+		{ { 0x2EEB61994B2682AD, 0x474814942D687DC2,
+		    0x26FA68948C3FF576, 0x06FE1E44F2DE9EDA } },
+		{ { 0x6E04078D7D74BEBF, 0x283C7C9434AA6629,
+		    0xB84B16A466D492B0, 0x5F71CBD5EA4F50AD } }
+	},
+	/* 18 * 2^168 * G */
+	{
+		{ { 0x09B9AB7AEEF5DC2F, 0x0326C32E11EAF763,
+		    0xA035F74D01B579DE, 0x33824C89A0B55EB0 } },
+		{ { 0x960C944850D68BA2, 0x9F76616D1A462FB1,
+		    0x0C7451ED12B9C3D4, 0x04509323CFF68076 } }
+	},
+	/* 19 * 2^168 * G */
+	{
+		{ { 0x3D5FD165E64D6908, 0x4F3511DEE393C38C,
+		    0xB356961105C93157, 0x5DFFCF4765CE70DD } },
+		{ { 0x5F38208343454D2B, 0x637AE46DDDDA173B,
+		    0x33620155220A8BB3, 0x562129B78ED38328 } }
+	},
+	/* 20 * 2^168 * G */
+	{
+		{ { 0xA8FDDD2348C996ED, 0x7DA0AB54B8097605,
+		    0xBDDC36596732616B, 0x3106D37F3C02E7C1 } },
+		{ { 0x7514BD7B4A429663, 0x98482E99220DCA6B,
+		    0x766BACBECD6CD2DA, 0x25ECE8F793008317 } }
+	},
+	/* 21 * 2^168 * G */
+	{
+		{ { 0xDABBCEA84FDADBE8, 0x632A8DC2E837F7F6,
+		    0xA2C39E2AC04D5E83, 0x6278BB97B00A491E } },
+		{ { 0x687B27176994C65D, 0x2583E0F5871B4ABA,
+		    0xFD3E9457B1B37859, 0x5B9BC4A162DF862A } }
+	},
+	/* 22 * 2^168 * G */
+	{
+		{ { 0x78932B38207BA8C7, 0x8A00C0AF3AED1FAC,
+		    0xC3108407F5858E44, 0x66C4F22B96C9EA0B } },
+		{ { 0xFAF308ACB16B5D60, 0x6A97EA50C14AA5FA,
+		    0xAC2C3A4C6B892E0F, 0x59A19CC75841950E } }
+	},
+	/* 23 * 2^168 * G */
+	{
+		{ { 0x7018BCF469CE701B, 0x1F24C660F6AEE6EE,
+		    0xAA770C3C1591A6E5, 0x16CEA7D0702A17BB } },
+		{ { 0x9638C1E54C3F65D2, 0xEEB8ABA954D951C5,
+		    0x998871136E566F2C, 0x6D000BF56C1CF8B7 } }
+	},
+	/* 24 * 2^168 * G */
+	{
+		{ { 0x4F4491929D1780D9, 0x520CAE643CF72789,
+		    0xF710056A8DB31C44, 0x2EF4ECA6FA065961 } },
+		{ { 0x93115C5C4115A06A, 0x9C5A6E7754B33E97,
+		    0x1EA736669D08608C, 0x11937CA3BA8FF108 } }
+	},
+	/* 25 * 2^168 * G */
+	{
+		{ { 0xC7956742D0818159, 0xF905FF4F9690A4C8,
+		    0xF5782F9836075042, 0x3319C49E34B57A43 } },
+		{ { 0xEFEC3AE6E626667D, 0x4AFDB3F85E2DAF09,
+		    0xE70F964DC5EC9DB6, 0x4FEAB8D53143C912 } }
+	},
+	/* 26 * 2^168 * G */
+	{
+		{ { 0xDA278EB865B88B3C, 0x02EC55285C3DE05E,
+		    0xFEB3F7B78B72E052, 0x7D84411F399DF665 } },
+		{ { 0x86696BFDB5BE4C03, 0x79F6A5DD6E1A10C8,
+		    0x6F6DDD71FFF57E67, 0x753167C5E975C7CC } }
+	},
+	/* 27 * 2^168 * G */
+	{
+		{ { 0x770A70FEC7A7E0E5, 0x19DE05FF57E3F265,
+		    0x58FAA801F7140694, 0x4437BFBD923AEEA2 } },
+		{ { 0x7BC7D03FB509E39F, 0x98C53A17F2275A67,
+		    0xCEFDD2B54460CF1A, 0x46CCF529B8248A5D } }
+	},
+	/* 28 * 2^168 * G */
+	{
+		{ { 0xA79CE9FCB1DBB668, 0xEA41B0578C01F78D,
+		    0xD9B9AD00C59FC51E, 0x76A5B90D294C1B04 } },
+		{ { 0x5CC1C75CBBCDEB58, 0xC3EA7FBCA72A52B7,
+		    0x50DBBA2FAD5FE233, 0x1D0987FC66A2A442 } }
+	},
+	/* 29 * 2^168 * G */
+	{
+		{ { 0xDDDF189F5C6ACE08, 0x9A52C751A040AE67,
+		    0xA826AD50731A0A17, 0x62A3E310EF7D0305 } },
+		{ { 0x4B352A5D79BC3576, 0x8DF96B229B88C0A0,
+		    0x1F36F8AC039D537D, 0x57F50728C190E0CA } }
+	},
+	/* 30 * 2^168 * G */
+	{
+		{ { 0x5159ECBABB77E58D, 0xA355DA8CCFDE207C,
+		    0xD8DF173BB3884AA4, 0x23BFB84750A0A147 } },
+		{ { 0x7D01C56348ACC76B, 0x560F4329E71CF5F7,
+		    0xBEC1E81F955C6B1F, 0x3E047CD6F21D7B6C } }
+	},
+	/* 31 * 2^168 * G */
+	{
+		{ { 0x6D08C3E000704FC5, 0xC509856D9069D53E,
+		    0x7C08F323F06E68D3, 0x2AF518CCB03B4A26 } },
+		{ { 0xB78E41F08E18A9B9, 0x87BE0809D96AD427,
+		    0x32BA191E64EA7168, 0x368B6E40B480BA20 } }
+	},
+	/* 32 * 2^168 * G */
+	{
+		{ { 0x649FCBF48CD22802, 0x0DCBF26C0D91A4D1,
+		    0xAF37A4451692B219, 0x7F73B168198074DD } },
+		{ { 0x14C6365C3FA6D5B7, 0x93F5A5B24E23399A,
+		    0x9C1E6CDE4B56DDAA, 0x6E41875D380BFC32 } }
+	},
+	/* 1 * 2^192 * G */
+	{
+		{ { 0x299651B149A387B1, 0xDBBBF3CA0EA619DD,
+		    0x32B9793D0447FC6D, 0x5B0539CA48FD74BD } },
+		{ { 0xC2CF1BD2A3207925, 0x0DF0A41FAF2D7854,
+		    0xA9DEC81F792ECF9F, 0x553D899B328C94CB } }
+	},
+	/* 2 * 2^192 * G */
+	{
+		{ { 0xF64B79D93C884959, 0xB251DCFEAC0E0B1E,
+		    0x58A9A996C8983EDD, 0x6336494A4BE960EE } },
+		{ { 0x2FE6DF2ECCCD2ECD, 0x88E041F9D495A757,
+		    0x867B0E5B711E4DC4, 0x29A11311917E839F } }
+	},
+	/* 3 * 2^192 * G */
+	{
+		{ { 0x778CBF5547BDD5E2, 0x3A27EC8F9E30D01E,
+		    0x8C5EBE33EFF3D017, 0x0E09365D462227E7 } },
+		{ { 0xA706C8C0C447B151, 0xEBBE7804DAEE410A,
+		    0x48919032D6BBE4DD, 0x4BD05ACD4CD5F6C3 } }
+	},
+	/* 4 * 2^192 * G */
+	{
+		{ { 0xEB1402F862013ABB, 0x726CE071CB9A3CAF,
+		    0x05A0C0E37E5C377D, 0x2F430D8BDE4F58DE } },
+		{ { 0xA516820973E39618, 0x69B80498137CAEAD,
+		    0xBEBE79BE24D25DF1, 0x73449587BA617D3F } }
+	},
+	/* 5 * 2^192 * G */
+	{
+		{ { 0xE8ACF6B322FFC155, 0x96FCF4C8395D1744,
+		    0xA8172E145FA28430, 0x51120313AF670D78 } },
+		{ { 0x8718291B9A56CFE6, 0xC1B2438246914057,
+		    0xF603458941443C33, 0x63CE6A924B78B1BD } }
+	},
+	/* 6 * 2^192 * G */
+	{
+		{ { 0x0FF4B38189911FA5, 0x323F3CACE4696279,
+		    0x8B16307FB754FE64, 0x12C68BEF8E2F729F } },
+		{ { 0xFC68B3CEDA3331BE, 0xBB412817998694A9,
+		    0xF7FD91E00AD015B5, 0x6E777DBBAC50C135 } }
+	},
+	/* 7 * 2^192 * G */
+	{
+		{ { 0xAD3D5EA0B3D218FF, 0x6FC9D7A8D9E27F66,
+		    0xCDA645EA360755AA, 0x629AD6AFA66796A7 } },
+		{ { 0x48DE2BE6054248BD, 0x777196A00C4C74F1,
+		    0xC874A7B2D5A4F9BD, 0x58F14D66AE285A2D } }
+	},
+	/* 8 * 2^192 * G */
+	{
+		{ { 0xC9D74325CBE23870, 0x3C8F799792EB5981,
+		    0xB4D3EBF20E4ACC9D, 0x5D505019F9CD4639 } },
+		{ { 0xC6C4EA52864B8022, 0x3FACF03027F2FE05,
+		    0x5A78F8FDAFE0F2B2, 0x7A2058682117A352 } }
+	},
+	/* 9 * 2^192 * G */
+	{
+		{ { 0xA89D6B993BD01072, 0x73FEBFAE8AB7FC32,
+		    0x9771E034F46F44DB, 0x795D0FAFB8224292 } },
+		{ { 0x4621F8F40C2BC9F0, 0x86CADF845C86D7FE,
+		    0xA19DDB1A4259D927, 0x21ADCA85745E7FC3 } }
+	},
+	/* 10 * 2^192 * G */
+	{
+		{ { 0xEAE4FA5ADCBDB3FC, 0xB00783908EE2AC55,
+		    0xADBC3403FABF3067, 0x1319EA17954AC433 } },
+		{ { 0x490A48F4FADD97F7, 0x98B673EF39D9DD96,
+		    0x49F093444D7FAA58, 0x3E8F38B79F9D4B60 } }
+	},
+	/* 11 * 2^192 * G */
+	{
+		{ { 0x69F0C1EF92E21937, 0xDE3EE02826B5ED00,
+		    0x34D960BBCAC80176, 0x55D87571B42CA279 } },
+		{ { 0x195216400F719380, 0xEAE774962B225B16,
+		    0xB93594F449A70AA3, 0x511DCFB77D9D4C89 } }
+	},
+	/* 12 * 2^192 * G */
+	{
+		{ { 0xAE73BAA09878F9DB, 0x81DD49A919F2619A,
+		    0x531E07753FFFED9F, 0x327D1155E9D4FF45 } },
+		{ { 0x82162D3B65F3B93F, 0x365C8D7719BD66A5,
+		    0x4D5BCC8B04B7D67A, 0x485CF5B28B1450EA } }
+	},
+	/* 13 * 2^192 * G */
+	{
+		{ { 0x2439D2EE2E4AA720, 0xF0135B845E8C58E2,
+		    0x0CC32D1CCC37182B, 0x49D919D0C4D826F6 } },
+		{ { 0x1088681202CAC6A1, 0x6A7D63ABDC4A6C3B,
+		    0x2A19E932B32EEFF3, 0x73E4A0843D3AAF28 } }
+	},
+	/* 14 * 2^192 * G */
+	{
+		{ { 0x6DC812C735CAE574, 0xB002EDB8D6CA1CCB,
+		    0x1605D774AC708000, 0x193156756832E078 } },
+		{ { 0x4A477D2E18900443, 0xC5610FA61CF69021,
+		    0x353A0CF4340B89F1, 0x62A68688AA21831F } }
+	},
+	/* 15 * 2^192 * G */
+	{
+		{ { 0x255150601327E232, 0x42E4659038E4DDA1,
+		    0x7E10ABAC5454A7A4, 0x46AF66CA55008358 } },
+		{ { 0x16AB1B920BA166C6, 0x7753D0AA0EB410D9,
+		    0x51BA7D926BFE3E8D, 0x12DC9F2D9B4BE3F4 } }
+	},
+	/* 16 * 2^192 * G */
+	{
+		{ { 0xB5FFEA9757F8DCE6, 0x992EAADD0950F49E,
+		    0xC30EE566764DB296, 0x77BEE9FA736A26DC } },
+		{ { 0xE7A9C455FDCCE69F, 0xB043C24E23C52866,
+		    0xCBC1DD8A3179B032, 0x597FE7EC4E366C38 } }
+	},
+	/* 17 * 2^192 * G */
+	{
+		{ { 0x5721F3756287EB14, 0xE29D01CEF96F6F28,
+		    0x803EAA47A2252AB8, 0x501A0F9B5CC59EE0 } },
+		{ { 0xEE63C5DB7A40AE15, 0x3D0F6C91D35C1C5E,
+		    0x35DA9526BE3A704E, 0x3000932EEC8C5796 } }
+	},
+	/* 18 * 2^192 * G */
+	{
+		{ { 0x1908F9F687455A33, 0xD1533E25C7E0FAD1,
+		    0xF01AA5351445AAB7, 0x17AD16B5D93A70EB } },
+		{ { 0x8A219D98CBDD9A41, 0x61D8674710DEA95E,
+		    0xB3F3B19B63651164, 0x7ABD39AD96B97F7C } }
+	},
+	/* 19 * 2^192 * G */
+	{
+		{ { 0xEB57EE7B130F93C6, 0x87517192CE0E01B8,
+		    0xFA16FA8C6DFD0E43, 0x5757E06A4C69A049 } },
+		{ { 0xE8FE48C9AD4207A1, 0x1EFE5F4ACF4E68D8,
+		    0x2912C7C85A9D5D0D, 0x114608652B5EEE95 } }
+	},
+	/* 20 * 2^192 * G */
+	{
+		{ { 0x03E1FB66134843C0, 0x3EFC375ABA328A4B,
+		    0x6D2E6E18E6695FB0, 0x316E0D11C13F0984 } },
+		{ { 0xBD6531C99379F4C5, 0x568AD22A486CAD17,
+		    0x8881B4C67D83DF41, 0x1EDA1D451240E4D0 } }
+	},
+	/* 21 * 2^192 * G */
+	{
+		{ { 0x153A09F2A4793504, 0xAD8BB3B90B9C98F7,
+		    0x314F39FBEC81D021, 0x58F87341D0735890 } },
+		{ { 0x90876721FB7002B8, 0x675E0013CF93ACFD,
+		    0xF14CC0FD69B00040, 0x5688C5472FAEFC0D } }
+	},
+	/* 22 * 2^192 * G */
+	{
+		{ { 0x93972CB869BAB96B, 0x163B298AEDA5201C,
+		    0x4FD9BA7462696953, 0x4F4E047F5E6D9CB0 } },
+		{ { 0x5DFB36F88C133E01, 0x0A19F806407D46E8,
+		    0xE0F8E1B2D036A5E9, 0x01EEDF4D0EA62853 } }
+	},
+	/* 23 * 2^192 * G */
+	{
+		{ { 0xEDC7F154A435C8B3, 0xC3BE237DEF406FD5,
+		    0xE070C8DFEECDC316, 0x440AF1CE6F1DB985 } },
+		{ { 0xC5540BF8BA9A398A, 0x797115FA4089359F,
+		    0x0CD10FB0E77A29C0, 0x5F9B448FDF8E4877 } }
+	},
+	/* 24 * 2^192 * G */
+	{
+		{ { 0xF4762F3FF4FB8115, 0x60D22515C8F29371,
+		    0xE64A746FA6B9C81A, 0x107BB7D6EED2E10E } },
+		{ { 0xEBF1C192782AD7E7, 0xDAC867CE0228990B,
+		    0xB0C0AEB839C2A9BB, 0x5D529C2B2E3222F2 } }
+	},
+	/* 25 * 2^192 * G */
+	{
+		{ { 0x0B3893A14D94FC19, 0x0BAAA8836AB78F90,
+		    0x22153D05024AFE1E, 0x51125B282CA977AD } },
+		{ { 0x96D09B2894B1271C, 0xBBD56F97131BAA5A,
+		    0x0EF4C73711C2CB77, 0x12B96DF4A525B4CB } }
+	},
+	/* 26 * 2^192 * G */
+	{
+		{ { 0x0AC6C874BDBF6C1C, 0x952B8CF3820B546F,
+		    0xF15D28E51D127EA8, 0x58090E660AEEB9BB } },
+		{ { 0x00DB0327DE16FA0B, 0x6FF465FE3F380067,
+		    0xE8812537491C23C2, 0x64992BBD93B370D9 } }
+	},
+	/* 27 * 2^192 * G */
+	{
+		{ { 0x6E400CEC5DF0324D, 0x5D18E9F884CE90C5,
+		    0xEE2049C22B443C1F, 0x186274F097213B6B } },
+		{ { 0xF2D77B3195BCCEB3, 0xE0FA7F6C77382593,
+		    0x298DFE471D5612BA, 0x2B6C189DDED59EB4 } }
+	},
+	/* 28 * 2^192 * G */
+	{
+		{ { 0x90FBD6B0524CF89C, 0xA087DD3DA0F9B48D,
+		    0xB6D04C1AA49DE22C, 0x6AD8892D97857C48 } },
+		{ { 0x6DC40BC12ABE39D8, 0x6FC53D3CA2D96315,
+		    0x6AEE7FA0181874E4, 0x1A4894C61FF0B9CF } }
+	},
+	/* 29 * 2^192 * G */
+	{
+		{ { 0xD1602CA425B88711, 0x0857765FD203FBF6,
+		    0x6B10ADC01E1CCE40, 0x6CC7777F982F8F98 } },
+		{ { 0x530955B9C5C91EF1, 0xCF38EAC12F784016,
+		    0x68B5AE8401D1EDF2, 0x01F2CF8F5F9AF092 } }
+	},
+	/* 30 * 2^192 * G */
+	{
+		{ { 0xDBC46D4F86BB5BFE, 0x8142F5CA68F4006D,
+		    0x9CA5C5A3DE23D46C, 0x3D837D8F8BE72D20 } },
+		{ { 0xBE566B5CC297A91C, 0xAC286067843D2FE6,
+		    0x3DD163AAE0A6F390, 0x4023C651608E785D } }
+	},
+	/* 31 * 2^192 * G */
+	{
+		{ { 0x45D55336CA526497, 0x9541F6C184F54711,
+		    0xCB511C9A1327F44D, 0x0EE92BB1DD90242B } },
+		{ { 0xF85054498AD4DC3B, 0x1954495A94F7E483,
+		    0x155AD8BF6917B42E, 0x290772F45DB330A2 } }
+	},
+	/* 32 * 2^192 * G */
+	{
+		{ { 0xA0C19926FC389D68, 0xD93A4C18F4C2CCCD,
+		    0x09EB7E080DF8E02C, 0x5CD950BF71F691C5 } },
+		{ { 0xE5AD1FDA050CE7CF, 0xD5179DCB398FE9E2,
+		    0x880F0F9CA2B23DE9, 0x73E9DA1D7C583AB6 } }
+	},
+	/* 1 * 2^216 * G */
+	{
+		{ { 0x4986F2F591669C8F, 0xBB45DFB0EF78C17F,
+		    0x05402E987F3B6444, 0x54BCCE8686B16FD5 } },
+		{ { 0xF9CF41EA35023225, 0xEDE1F62FF2912D97,
+		    0xBAF7553784B19150, 0x650C8AD947B675C5 } }
+	},
+	/* 2 * 2^216 * G */
+	{
+		{ { 0x80F8EEAA7AEE07C8, 0x972CBFAAE20DC5BB,
+		    0x36AFFDA170292E9D, 0x5AEC22635A563D72 } },
+		{ { 0x4F0C973029C1EA51, 0xA858B642954F6457,
+		    0xE27B781BCDE8A844, 0x542628B3FBE1A7AC } }
+	},
+	/* 3 * 2^216 * G */
+	{
+		{ { 0x732E701A23A6166E, 0x31C6DDD5C20F4745,
+		    0x17CD68AC0966895F, 0x5777ADB98B71240E } },
+		{ { 0xE55EA3CD8F018287, 0x1A42B2ACD1B8C77F,
+		    0x138EE1F551C95EB5, 0x0C25E9697929B053 } }
+	},
+	/* 4 * 2^216 * G */
+	{
+		{ { 0x8A4E49120AAEE0FE, 0xC8E9F1EA8B333E29,
+		    0xC8AABBF8F71EECE2, 0x010E1FCBA9616504 } },
+		{ { 0xFA9114AC64E1A0B3, 0x0062060DC5FCF2B5,
+		    0x13CC5FB70C508725, 0x6738BB42F94D6316 } }
+	},
+	/* 5 * 2^216 * G */
+	{
+		{ { 0x7E68F527819A857E, 0xA7D303EDCBD89966,
+		    0x7A50601A5E7E9F1F, 0x3D5D8A7E6754F9F4 } },
+		{ { 0xF1D7B25809F51D39, 0x5098076FDA0F8D2E,
+		    0x2DF7A57B344CA7D7, 0x206115394AC11311 } }
+	},
+	/* 6 * 2^216 * G */
+	{
+		{ { 0x0207B1F004AA3195, 0x64F38CB63B658212,
+		    0xFC3E1FC6A211195E, 0x60A24FC4C849AB1C } },
+		{ { 0xA5873EBCFC7227AB, 0xC0C70B122AF85995,
+		    0xD6BB92D2884F938D, 0x0D0DCBBACCED76C8 } }
+	},
+	/* 7 * 2^216 * G */
+	{
+		{ { 0x121A34F8BF49B717, 0x64B6DF6222FF4580,
+		    0x28EDE0CE658DFAD8, 0x23D535351B70162A } },
+		{ { 0xB258F19C9A66D303, 0x570FF123D49D429B,
+		    0x2507ACF991D5587C, 0x7BEF4C98DEE0A8FC } }
+	},
+	/* 8 * 2^216 * G */
+	{
+		{ { 0xB4EBF5BB007C2B4C, 0x6B12A5B04BD3253A,
+		    0x4D6D177C15A81B81, 0x4A2F1D7467C71EC4 } },
+		{ { 0x533529E25808B8BA, 0x1050CA3DF6FDDAE9,
+		    0xBCB6983380CECF2A, 0x0B67E7217D58A91D } }
+	},
+	/* 9 * 2^216 * G */
+	{
+		{ { 0x329562FA0A6576F7, 0x84BDB5AC334FC824,
+		    0x3A7EFA14524297B5, 0x1F9F0FBF6599D60B } },
+		{ { 0x95943EF7015E276C, 0x5C3CD024B5CA692E,
+		    0x693B8F0C0920846B, 0x4B474439C85D5FFC } }
+	},
+	/* 10 * 2^216 * G */
+	{
+		{ { 0x4DF62E08D20C43A0, 0x692A7369870CFC86,
+		    0x263A2D622A564504, 0x1C8A2548D532E9ED } },
+		{ { 0x1D0891C3175A2625, 0x46EE67B055A5D699,
+		    0x6B657627BEBF5FC0, 0x009488CA504E8F1D } }
+	},
+	/* 11 * 2^216 * G */
+	{
+		{ { 0xD0B55823D17B3248, 0xA97D05A7451D1269,
+		    0xDF17BBF7AA5F886E, 0x6F805B7AFE012B03 } },
+		{ { 0x92AE1FBF3F5C05FA, 0x9BB94DBD8EB8EEC1,
+		    0xB64F78301E65EEDE, 0x3528EE313F0FEC34 } }
+	},
+	/* 12 * 2^216 * G */
+	{
+		{ { 0xC86B9BA2313297BF, 0x848B9AA89DAEB1D6,
+		    0xA53463D4A2079FD1, 0x1BF75BBB788F9FA8 } },
+		{ { 0x0808115D623C4BF4, 0xAC1EB3F1C73AFEA0,
+		    0xD8AC1AC092CF0DEA, 0x27217285377B6179 } }
+	},
+	/* 13 * 2^216 * G */
+	{
+		{ { 0x48348FAD76933652, 0x27412121BF811BC4,
+		    0x072365FE2300CCA2, 0x1C191CCAFAA77EDF } },
+		{ { 0x5ADBAFAE6EAFEDDE, 0x389D0AEF33C4936D,
+		    0x5EAF975D3D53E10D, 0x78B9A67A93E2FDD7 } }
+	},
+	/* 14 * 2^216 * G */
+	{
+		{ { 0x699351998FE1E321, 0x730AA7A9141DCA5C,
+		    0xB17978E43024FE11, 0x4B6CF9072F000571 } },
+		{ { 0xA4C63605218F118E, 0x9FDD5AEA82E083BD,
+		    0x34CAF05C5E1DF99A, 0x5C6DA9B671D070F8 } }
+	},
+	/* 15 * 2^216 * G */
+	{
+		{ { 0xE5D85F2CC2CCD57F, 0xAC048055CB92195D,
+		    0x062E4E04FDFE780F, 0x258C7A67E58B9D13 } },
+		{ { 0xCA6FB7332DEA8855, 0x9240C7771B164137,
+		    0xACC3D9BF5BA1F801, 0x3AD5DF1302E0EE12 } }
+	},
+	/* 16 * 2^216 * G */
+	{
+		{ { 0x99C1A7BAFACB599A, 0x8971FCDCCFFF1DAC,
+		    0x7BE7AC43ACF342B2, 0x028FB6791BBD499A } },
+		{ { 0x7747CDC05C4CF718, 0xBB035571917007A4,
+		    0xE18CE30DF6018A94, 0x3AD2A0757EFF2AA7 } }
+	},
+	/* 17 * 2^216 * G */
+	{
+		{ { 0xD23C9F2446B0BDC9, 0x4ABA5620DC1C021A,
+		    0x2402AD1456C732F2, 0x3D810ED8DB325215 } },
+		{ { 0x457402BC2274373A, 0x983CEC7B6979858F,
+		    0xF4DA18F599EB4134, 0x7FADA41BC63EAD72 } }
+	},
+	/* 18 * 2^216 * G */
+	{
+		{ { 0x96BB6DD39439038A, 0x73BDDE2CC92F97F7,
+		    0x8850273F84339C30, 0x23808D49802F348D } },
+		{ { 0x66304BD47BDC67B0, 0x7420452CC42B0F5A,
+		    0x2CA7C8D15C594D6D, 0x203696E143438669 } }
+	},
+	/* 19 * 2^216 * G */
+	{
+		{ { 0x5B6C1295055D2917, 0xF47906963F94C08F,
+		    0x9A472A50DEBDF1E1, 0x3FC3D075BC79E797 } },
+		{ { 0xBB590A3184DCF65F, 0x7221CA01EA434B68,
+		    0x49CCF27B119B2993, 0x5454F08A3EE878A7 } }
+	},
+	/* 20 * 2^216 * G */
+	{
+		{ { 0x29FE2F02039358AD, 0x74A9151FC97ECCBB,
+		    0xB985BE98885FEC11, 0x4A8A98A1D66C621B } },
+		{ { 0x30991B64E5624F83, 0x486A86F4296E4D40,
+		    0x31BD9D27E864C833, 0x440C7512A4F6228B } }
+	},
+	/* 21 * 2^216 * G */
+	{
+		{ { 0xE8822900B534548D, 0x999DCFC23386E676,
+		    0x521358EC75925574, 0x18417755820B39AC } },
+		{ { 0xE08FF96CAAC1420F, 0xF768B8FCFEACD338,
+		    0x3F366E175B926F0B, 0x7E287E1D193F1BFB } }
+	},
+	/* 22 * 2^216 * G */
+	{
+		{ { 0x37D2967E05C8E31D, 0x7884ECC456B56435,
+		    0x7EE43F76B7809303, 0x765943A8BCE5661C } },
+		{ { 0x1CD94BE0E1388A40, 0x0802DD85C714F469,
+		    0x1980A7F5BFA506B3, 0x24A1BABD87690647 } }
+	},
+	/* 23 * 2^216 * G */
+	{
+		{ { 0x6849DBF6651C0DF8, 0x1814E0CF9E8E0504,
+		    0xBA2E3ACAF2212524, 0x54E4103A367EB1C0 } },
+		{ { 0x4EBE881A149D60A2, 0x5581DBCDAA1C7B16,
+		    0xA04B6118514BBFF6, 0x03DA8206F00D2C74 } }
+	},
+	/* 24 * 2^216 * G */
+	{
+		{ { 0x186FB0580099E69E, 0xDC595D419ADAAAAE,
+		    0xCAA091F5FE7912A5, 0x0B56E2AC38361008 } },
+		{ { 0xA5DFFC8AFA8F65B2, 0xEEC102AD117F4933,
+		    0x82822A9D775B1703, 0x2CEC7AD5C3866B46 } }
+	},
+	/* 25 * 2^216 * G */
+	{
+		{ { 0x763D802725D1DFFF, 0xF2F8CA3CB0F5AE8E,
+		    0x5CD8AF8363815254, 0x09E72E3E777419F6 } },
+		{ { 0x1BD59D6FCF595823, 0x07505090A844C48B,
+		    0x757D8CE53BA858BA, 0x0C128BE57A4595E5 } }
+	},
+	/* 26 * 2^216 * G */
+	{
+		{ { 0xDB8698E20D6155AE, 0x3CF5DB4A81323F69,
+		    0x061CDB83B36D2C51, 0x302A7F133A46076C } },
+		{ { 0x229EA43D26099CF1, 0x25F3036624FBBEDA,
+		    0xBA3C443D8AFD1581, 0x38608EB7DCF8CFB8 } }
+	},
+	/* 27 * 2^216 * G */
+	{
+		{ { 0xE18BA82D4CFEB22A, 0x5446BE4BA868478E,
+		    0x8097FC2E519A391B, 0x6F0336ADA2718162 } },
+		{ { 0xDB9D0A0BBBF2D1E5, 0xCF1E1D3F7B567CF3,
+		    0x9D3E4ED8C1BBAC8D, 0x02073544CA5A0018 } }
+	},
+	/* 28 * 2^216 * G */
+	{
+		{ { 0x9E14FF27655D07FA, 0x92A16F4513AC4112,
+		    0x92942DA343A27F8F, 0x0CD021C01F916458 } },
+		{ { 0x509E718797DE2158, 0xECBE5CFB9D5228C6,
+		    0x649D1B17930A1A93, 0x69CF6902431FEFE1 } }
+	},
+	/* 29 * 2^216 * G */
+	{
+		{ { 0x5443489D09C2B8F8, 0xD25551B1FE824EA9,
+		    0xD0689CACD6C35E6F, 0x2484AB8464FA35C2 } },
+		{ { 0x903C4B2F6D7AE856, 0x6A23951384A3D697,
+		    0x97AE5709F4418AC8, 0x5C1900CDF657783C } }
+	},
+	/* 30 * 2^216 * G */
+	{
+		{ { 0xD4BC3A0003C6162A, 0x48329283CD230E4D,
+		    0x8BEB8A759EDDFA5D, 0x250F40C802374E91 } },
+		{ { 0x05E9BAB5190A4AA6, 0xCDA6FF242A97FD0F,
+		    0x5300ACAD299F5CD1, 0x4AD6A847F8766A91 } }
+	},
+	/* 31 * 2^216 * G */
+	{
+		{ { 0xE833B6498F735B14, 0xC8DA9095DB0313AE,
+		    0x5001BF16A491614C, 0x06D470E3C45F6846 } },
+		{ { 0x93952A620E91DDFC, 0xDD3ACD88E2C8B600,
+		    0x5A1EFD27B4B4D103, 0x0AC513D795ACDD77 } }
+	},
+	/* 32 * 2^216 * G */
+	{
+		{ { 0x8E7E5DEC7A0F0FF2, 0x60AFD387A718B9E4,
+		    0xC9333BC4B903F1B7, 0x1C3E4E0E08C5409B } },
+		{ { 0xF08B1FACE591888D, 0x7DA4B4C4CBC3A324,
+		    0x147BB55FF75614A3, 0x666438594563C018 } }
+	},
+	/* 1 * 2^240 * G */
+	{
+		{ { 0xED1D1093A26398FE, 0x302128DEE34BD8CA,
+		    0x26741D17CF81475E, 0x3ED1F5C8B7783221 } },
+		{ { 0xE778FB8BE9EEB802, 0x6013AAB2C14A239D,
+		    0x716B1A97AA5E95D5, 0x0E4F28D7CA428335 } }
+	},
+	/* 2 * 2^240 * G */
+	{
+		{ { 0xED65F8DE45F0A109, 0xAAE3337E23B0075E,
+		    0x04407C089BD0E4C3, 0x3F2FF2BBAD6B73BC } },
+		{ { 0x4C786F4D082EAF3B, 0x84583A70EAC87859,
+		    0x8DDB11C491904BB6, 0x2594A204752E3A17 } }
+	},
+	/* 3 * 2^240 * G */
+	{
+		{ { 0xF32530428158C5A1, 0xF0355385A08F0667,
+		    0x8D1D7C05950878DF, 0x6148755B45EDB343 } },
+		{ { 0x7BFECB806E0A6C8B, 0xB7D6FD9D3EF5142D,
+		    0x80291C9A5991FC43, 0x5BEED079917AF65B } }
+	},
+	/* 4 * 2^240 * G */
+	{
+		{ { 0x18D25860190F7068, 0x963A05FE143968B5,
+		    0xF794FAFC0CD7CE57, 0x44FC3D653AA6450C } },
+		{ { 0x949E0441D6C1CA3C, 0xA12FC35CF43550FC,
+		    0xA113FC7875A4EF38, 0x30871F8EA95F15AC } }
+	},
+	/* 5 * 2^240 * G */
+	{
+		{ { 0xC54C80DEB08F16D9, 0x5036783FAEA55051,
+		    0xF21D54BDF52ECD60, 0x5516C50A841B925E } },
+		{ { 0xF30252FAE2E082FD, 0xB4EC620712EDB0A6,
+		    0x65DFD8906B536B2F, 0x0BAFB39CB8E49B71 } }
+	},
+	/* 6 * 2^240 * G */
+	{
+		{ { 0x23EE80AF298913F9, 0x742E9B2846F94978,
+		    0x5DEC06D2123DF0EC, 0x2F3CA75E4677B600 } },
+		{ { 0xDAFAABAF08EE918E, 0xF07A906663620F81,
+		    0x29DFD894D817BB7D, 0x5A6B82EBF915452D } }
+	},
+	/* 7 * 2^240 * G */
+	{
+		{ { 0x4D9CACEC0CC5DB30, 0x90337B0610EBEE71,
+		    0xAF17736147530114, 0x77FE899F00045471 } },
+		{ { 0x70E41E50BFD6E25D, 0x3CFED50C71616687,
+		    0x8E0C49B29720341D, 0x3119535B13E5F982 } }
+	},
+	/* 8 * 2^240 * G */
+	{
+		{ { 0xE3B253A03DB218EC, 0x9BE58692A389F1F0,
+		    0x45F1879C47432176, 0x086C0AA101087855 } },
+		{ { 0xD41622D8F668A01E, 0x3E87719F9A777BCA,
+		    0x940EDB317BD296C5, 0x3FD1903813AE9E2F } }
+	},
+	/* 9 * 2^240 * G */
+	{
+		{ { 0x150665A6DF610ADE, 0x4C4FF58238AC7838,
+		    0xA556F34D75BD12D3, 0x74FB9E3253E022E1 } },
+		{ { 0x4C41C32E8669D26C, 0x3FE51AA06EC5CD73,
+		    0xA38DB65131882916, 0x31B3B61217BD4FDB } }
+	},
+	/* 10 * 2^240 * G */
+	{
+		{ { 0x528EAA120887F7D0, 0xD63146263D5C3FF9,
+		    0x6CB40FB1F245D6B3, 0x1A94006EFA222E9C } },
+		{ { 0x8FBD4A95137B6DD2, 0x3819772034132863,
+		    0xA784766A01BF4F78, 0x40FBDD2D38E4B6D8 } }
+	},
+	/* 11 * 2^240 * G */
+	{
+		{ { 0x0EE90A8317021CA3, 0x7F484708AE497A80,
+		    0x98E86899D0525BE0, 0x6990E3A302D3F4F3 } },
+		{ { 0xA2A61BF733C11710, 0x680F4B909CDF600E,
+		    0x98D2F275B087850D, 0x0CCDBF48F6283026 } }
+	},
+	/* 12 * 2^240 * G */
+	{
+		{ { 0x0B3318797A58913F, 0x4F3B559C8AA3E05C,
+		    0xA0897DC16E6BD6F9, 0x5A8B6D969247BD03 } },
+		{ { 0xEC25D9C905A794C8, 0x45D74F127E1857C0,
+		    0x7D26D0320EF080E6, 0x360829F6D1C5DE62 } }
+	},
+	/* 13 * 2^240 * G */
+	{
+		{ { 0x6FA9540918AE52EC, 0xD675301E833C8FDA,
+		    0x8C177AA93A6DBEE4, 0x5934F55D6CDB927D } },
+		{ { 0x9FD9835665BFB32D, 0x24BF0B16D51FD72B,
+		    0xD0B271E9D02AB8A5, 0x67EA76BB3FD2E640 } }
+	},
+	/* 14 * 2^240 * G */
+	{
+		{ { 0x5AAE6EDAE765D622, 0x3EBF589609C2ACA5,
+		    0xB7980ED066F8499D, 0x69ECE4623851D175 } },
+		{ { 0xDC3014C6DEEF9961, 0x1E76B4B8726D6574,
+		    0xD7BF97FDF7DF524A, 0x528A8E8A4FB47163 } }
+	},
+	/* 15 * 2^240 * G */
+	{
+		{ { 0x60889D84BD8AED6F, 0x723B4ECC967FA122,
+		    0x1EF14924528F2097, 0x0A96F011AE95C210 } },
+		{ { 0x0F3DBBA96BF337D1, 0x312344684E2AD930,
+		    0x4A86266AD301D350, 0x72DF4ED728313453 } }
+	},
+	/* 16 * 2^240 * G */
+	{
+		{ { 0x0BDA40D5446618A6, 0xCD45F105BEB000FA,
+		    0xF9EBA4C7A545D3D4, 0x3B42253E5CAABB32 } },
+		{ { 0xA4E338F6A59468F5, 0x0B2B12FF649680F4,
+		    0xFA08555941F0931B, 0x48F4BBAE8E52DA73 } }
+	},
+	/* 17 * 2^240 * G */
+	{
+		{ { 0x549DF08BD9B5379D, 0xCF2AC1E4ECFF012F,
+		    0x5C30EC0FDD28E1EE, 0x611A84224E84787B } },
+		{ { 0x098C496C368285C3, 0x2446B3E821A0E2A5,
+		    0xB6A2ADA5467F6B86, 0x3E35C269182BE2EA } }
+	},
+	/* 18 * 2^240 * G */
+	{
+		{ { 0x979C612DED578BC3, 0x4AED755B86AEED48,
+		    0x6DB2C60EDFA453C2, 0x79BB0D0C8AC50D89 } },
+		{ { 0x278141E2F250711A, 0xD43C7FDF8EF4AB84,
+		    0xB6D05DC70FC42EED, 0x527E48D69462A892 } }
+	},
+	/* 19 * 2^240 * G */
+	{
+		{ { 0xB77C2EADD426CAC4, 0x870D61467F52D381,
+		    0xE3667475294E5A08, 0x62F2CB9539FCB826 } },
+		{ { 0xB3F0F23E762B3634, 0x3C82692F795CE4E9,
+		    0xAADDED7A0C4F6F82, 0x36EC382707F5CA19 } }
+	},
+	/* 20 * 2^240 * G */
+	{
+		{ { 0x6F569815FCAA03F5, 0x26BD537D6CBED374,
+		    0x524C687508A935E9, 0x0053092BB8A61EA3 } },
+		{ { 0xB0BFE2500620893E, 0x422CB78B201AA221,
+		    0x5B83C15A2E3D44C3, 0x0954CCEED710898E } }
+	},
+	/* 21 * 2^240 * G */
+	{
+		{ { 0x72577FEEDA34B2E6, 0x7F98A81F803EDAF0,
+		    0x3964E1E0A3B03D1A, 0x71AFF4B8B163C56B } },
+		{ { 0xBFD76FE0FF6EEE58, 0x3F8B45690CF06932,
+		    0x3AC408FA71D533C3, 0x2A04CDC07834BAE2 } }
+	},
+	/* 22 * 2^240 * G */
+	{
+		{ { 0x704C448F8F77DF7D, 0x98B35C9162443EF6,
+		    0x3A171701AA881ABA, 0x00C0D321C2A88A2D } },
+		{ { 0x9F9F8CE828F53139, 0x6B1C3BD17DBA9A6F,
+		    0xEEC3680650549D35, 0x760D12734B328F12 } }
+	},
+	/* 23 * 2^240 * G */
+	{
+		{ { 0x35A101C5AADE4742, 0xC1A928E0B571BE46,
+		    0x9B30ED2780D45D07, 0x6049ABDE941BCF9A } },
+		{ { 0x79044AC6B0F07757, 0x020E81D8F484A3F0,
+		    0xB15E1144A3286A5C, 0x13356CE345C65BF7 } }
+	},
+	/* 24 * 2^240 * G */
+	{
+		{ { 0x642BCCE51A451A45, 0xA3A2817877E8AE14,
+		    0xE7901C902219D8CF, 0x3E7E8BD93535EFED } },
+		{ { 0x9C6B4C661123074A, 0x21846F4A17C9327E,
+		    0xC4B9FB875B469EEE, 0x45D350B08825372E } }
+	},
+	/* 25 * 2^240 * G */
+	{
+		{ { 0x8631EC8DC91D1870, 0xCAA235B47C941C27,
+		    0x250028184467BFDB, 0x1B1E10E1750AED20 } },
+		{ { 0x55B99DA6384C34B2, 0x651D7703D00DC58B,
+		    0x327C1A30940F1148, 0x61747E423B21DE85 } }
+	},
+	/* 26 * 2^240 * G */
+	{
+		{ { 0x5EB73D32DC3AE854, 0x1EBBE1DB679FC9E6,
+		    0x5A922AC3B6C220C7, 0x3365F5F2B2069B2C } },
+		{ { 0xAAF6C9B9C417F32E, 0xBFD4D0246E1AF577,
+		    0x188F30B3246DD7DB, 0x263FB421AFE504DD } }
+	},
+	/* 27 * 2^240 * G */
+	{
+		{ { 0x0A9BDFE86B7DAFB8, 0xE6F001520CF19EC3,
+		    0x9716489D340E0EEA, 0x533C113451FB7E61 } },
+		{ { 0x01A6117ECDEC0AE7, 0x991B6567FC448EA6,
+		    0xA20C567153AF529D, 0x64D9902644A0470C } }
+	},
+	/* 28 * 2^240 * G */
+	{
+		{ { 0x77A26C0C935ED4AE, 0x6F97321D68C44CDC,
+		    0x967069CD99F1778A, 0x61278AC49562D851 } },
+		{ { 0xA37EE8B81D2DE7B7, 0x19405A4FED9B8CC8,
+		    0xA5ECC8C51F040E4E, 0x60420AC43D5269A1 } }
+	},
+	/* 29 * 2^240 * G */
+	{
+		{ { 0x150D28F7BE14EC04, 0xC5EDAA6D4D8A9F7A,
+		    0x72AA9449341D0BD7, 0x5C8378E28C45A84D } },
+		{ { 0xA94D7AE81F2A69CD, 0x7608990755CD9B06,
+		    0x212540B34786FFBB, 0x180CEE140A4567E4 } }
+	},
+	/* 30 * 2^240 * G */
+	{
+		{ { 0x83EEDB91C0109B5C, 0x29E0D60B9BB9686F,
+		    0xBA86D4160A2FF714, 0x651C5154EF5B5EE3 } },
+		{ { 0xC0A0100EEA13BD7C, 0xA692832BAF3D8FE6,
+		    0xF07109427A186FE1, 0x3C8445FA09BE6973 } }
+	},
+	/* 31 * 2^240 * G */
+	{
+		{ { 0x0563021DB2BF7933, 0x46BC55F87A3A1D58,
+		    0x45932BE33BFAF8BD, 0x2A7E354AAFADD4ED } },
+		{ { 0xB14AD8F834079677, 0x8FA4FA0470AA14B0,
+		    0x038D384341057D2C, 0x5E73CFFF20476933 } }
+	},
+	/* 32 * 2^240 * G */
+	{
+		{ { 0x530BC670753A97E0, 0x2E70F554862B9CB0,
+		    0xA1FC2A0B7ADA2D8B, 0x4D86791B6D7BBC8D } },
+		{ { 0xCB95E94E9DEABDB3, 0x06C41C3764FE5FE0,
+		    0x1CEBF37E6DCC18E7, 0x2F319EC36BB393D5 } }
+	}
+};
@@ -0,0 +1,2476 @@
+/*
+ * Precomputed windows of the generator for do255s_mulgen(),
+ * 32-bit limbs. Generated with: mkgtab 6 11 w32
+ * Do not edit.
+ */
+
+#define MULGEN_WIN      6
+#define MULGEN_CHUNKS   11
+#define MULGEN_XU       0
+
+static const do255s_point_affine window_G_comb[] = {
+	/* 1 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x33B156B1, 0x4803AC7D, 0x5840B591, 0x3EF83226,
+		            0xCB010B9D, 0x213759EC, 0x1783FB6D, 0x39BD7265 }} },
+		{ .w32 = {{ 0xAAAAA584, 0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA,
+		            0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA, 0x2AAAAAAA }} }
+	},
+	/* 2 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x318C5721, 0x8C6318C6, 0x6318C631, 0x18C6318C,
+		            0xC6318C63, 0x318C6318, 0x8C6318C6, 0x6318C631 }} },
+		{ .w32 = {{ 0x5C3E5011, 0x7311544E, 0x2F5E574B, 0x3667EAC4,
+		            0xA4176AA4, 0x6DC59919, 0x3F062A69, 0x701BB820 }} }
+	},
+	/* 3 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x5AF542C8, 0xC92EA6A4, 0xEB2EBB62, 0xACA2B1F0,
+		            0x772D49BF, 0x16AA9AB4, 0x68993FDF, 0x586E82D4 }} },
+		{ .w32 = {{ 0x07647DD6, 0xB0E2616D, 0xD9B70D8F, 0x79835A85,
+		            0x733292C6, 0x39545AAB, 0x3EE92301, 0x27A19C07 }} }
+	},
+	/* 4 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x0F24B43F, 0xB21E437C, 0x2A191529, 0xE352D46A,
+		            0x8E691D57, 0x5105F27F, 0x85ABD1BC, 0x203E7421 }} },
+		{ .w32 = {{ 0xAFC4CC85, 0x0AA6E498, 0x51FC11F0, 0x34CABA83,
+		            0x2BD1700A, 0x09F86D5B, 0x0924022E, 0x537BA3D4 }} }
+	},
+	/* 5 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x8FAAFD54, 0xD4C60438, 0xCA27D2A0, 0x478144CA,
+		            0xA3381C38, 0x4B4B7554, 0xA8C94117, 0x78CC3E71 }} },
+		{ .w32 = {{ 0xB48175C6, 0x9819FEFF, 0xA19AC3DD, 0xEB222706,
+		            0xBE5D5845, 0x410723C5, 0xF4EA9551, 0x3C18C25D }} }
+	},
+	/* 6 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x5D8AEC75, 0x0F8CCA9A, 0xF00CFF35, 0x2337B2C5,
+		            0x60F3A520, 0x4C38E257, 0xB38EC25A, 0x5B8B19C1 }} },
+		{ .w32 = {{ 0x77A6F073, 0x5E273AB2, 0x5019A510, 0xDFCD0E54,
+		            0x7DE61215, 0xB4D344CB, 0xE6CE27C4, 0x20CB4C0B }} }
+	},
+	/* 7 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x9916AE56, 0xE4574479, 0x444F94C0, 0xAB719188,
+		            0xF4727AB0, 0x8BCF3B53, 0x4119EE4B, 0x239A8F01 }} },
+		{ .w32 = {{ 0x646D9E07, 0x6D72E617, 0x9844C50F, 0xE08B7A2B,
+		            0x18FDB104, 0x164E30CF, 0xF1A5F7AF, 0x44C18E58 }} }
+	},
+	/* 8 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xD4089F3F, 0x486D0418, 0x7E21EC49, 0x415C3064,
+		            0x6C060489, 0xDB2F693C, 0x5E1CF582, 0x475F06F5 }} },
+		{ .w32 = {{ 0x88DF33A3, 0x716647F9, 0xA7CEE964, 0xFA6FD869,
+		            0xF220CA25, 0xDB2F9858, 0x03825F9C, 0x7F45D8FB }} }
+	},
+	/* 9 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xF35EBE0B, 0x6F20F664, 0xBBE70025, 0x72C56CBC,
+		            0x7A1BC6B3, 0x1B8A888E, 0x4536C750, 0x3AE1B93B }} },
+		{ .w32 = {{ 0xDD9C2BCC, 0x8952D2A9, 0x49EF49CB, 0xF5DA264D,
+		            0x2A4F8A38, 0xAD270B42, 0x0A6E3986, 0x78F62E18 }} }
+	},
+	/* 10 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x05D906A1, 0x0B77022F, 0xA9763928, 0x36553987,
+		            0xD952E579, 0x90C0593C, 0x06ECA253, 0x601889E5 }} },
+		{ .w32 = {{ 0x30ED2DED, 0x273BD4BD, 0x50375EA6, 0x222B7CB5,
+		            0x93C78BC8, 0x375976D9, 0xD6B1DAFA, 0x18B084F5 }} }
+	},
+	/* 11 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xBF390F8E, 0xFC96E106, 0xD17AC934, 0x87F4FE12,
+		            0x455D2425, 0x20DD4A1C, 0xCF96C239, 0x0F489EA0 }} },
+		{ .w32 = {{ 0x3512C58A, 0x3F7E226E, 0xE83EFE42, 0xC44C89C9,
+		            0xF2137EC0, 0xB9E17C3B, 0xFDDB2B1D, 0x3CF2AACD }} }
+	},
+	/* 12 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x80B4DDCF, 0x116E4C01, 0x088C285B, 0xD965D1AE,
+		            0xF0E43F69, 0xCE5A14DB, 0xCC7BF398, 0x2BCC8378 }} },
+		{ .w32 = {{ 0x707DB568, 0xFE21145C, 0x3C0E4257, 0x05499CC6,
+		            0xCB1E187F, 0x3FB7EC2D, 0x0EA27DE1, 0x02A575B6 }} }
+	},
+	/* 13 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x959A60E5, 0xBB832D11, 0x7660C5E6, 0xF3AF5A14,
+		            0xE1FAFA73, 0x1037C50F, 0x59A18E7B, 0x251739F1 }} },
+		{ .w32 = {{ 0x5A7DE759, 0xC611B821, 0xA6307017, 0x958D80A0,
+		            0xE45D5DD5, 0x58717037, 0xECC46A53, 0x4C6EA6D5 }} }
+	},
+	/* 14 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x0CD243C2, 0x238B2417, 0xCC7B0C22, 0xF20B2474,
+		            0x83B667A6, 0xD1AF972D, 0x5A45EA4E, 0x1BC20D83 }} },
+		{ .w32 = {{ 0x3979E8C5, 0x9156BD62, 0x2917B521, 0x0DC39831,
+		            0x49BE6B11, 0xADFDC3EA, 0xC6854B51, 0x71B74A4C }} }
+	},
+	/* 15 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xFAC9FD25, 0x725096F4, 0xA8F661BC, 0x4072199C,
+		            0x54E4B489, 0x1E3D756A, 0xB7C5D81C, 0x36A82923 }} },
+		{ .w32 = {{ 0x00CF6A28, 0x0E7071C3, 0x822D2881, 0x738D92CE,
+		            0x1DCCB0F9, 0x85798A74, 0x37073682, 0x13E1D3C2 }} }
+	},
+	/* 16 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xD508BB00, 0x6ACF66F7, 0x127F8808, 0xFC3A8030,
+		            0x6305A579, 0x70481A4C, 0xBD04AA0E, 0x30664839 }} },
+		{ .w32 = {{ 0x5E49162B, 0x5D419AD4, 0x238BED1D, 0x78530FAA,
+		            0x31C8C7C7, 0xA765AE1A, 0xCEDE5E8D, 0x67207D6B }} }
+	},
+	/* 17 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x26056099, 0x3940993F, 0x45454504, 0x7317F06D,
+		            0xE49D0882, 0x97EFC6E6, 0x18CA6FA5, 0x569BB093 }} },
+		{ .w32 = {{ 0x7584C49B, 0xDD7930EB, 0x6A911FAE, 0xE23AECFA,
+		            0x1E764813, 0x551A661A, 0x4634DB74, 0x50E31FF0 }} }
+	},
+	/* 18 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xB2E1385D, 0xB7CC16E9, 0x678D0FD6, 0x52FFED1A,
+		            0xCEBD12E3, 0xC91277EE, 0xBCA22012, 0x604F0A9F }} },
+		{ .w32 = {{ 0x7D7CEBFE, 0x863FCD77, 0x1FB08287, 0xA3120C9F,
+		            0x60F0746A, 0xE7682CFE, 0x8F38F1C7, 0x415BE221 }} }
+	},
+	/* 19 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x05EDE01B, 0x7874570F, 0xEDE8EAB0, 0xCC7B2FDD,
+		            0x7347EC36, 0x57F5A9A7, 0x91BDDEB1, 0x4ACA5C99 }} },
+		{ .w32 = {{ 0xD1D03717, 0xA20D3062, 0x608E032C, 0xEE5E6C36,
+		            0x67B8CFAC, 0x6923961C, 0xFCE1CE7A, 0x41279DD8 }} }
+	},
+	/* 20 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xB6D05377, 0xF5F025C2, 0x6A39ACCE, 0xA9A0CEFA,
+		            0xE9B889DD, 0x1055D8BE, 0x4C577654, 0x233E5395 }} },
+		{ .w32 = {{ 0x6DEB2150, 0x6464E5C3, 0x2961D859, 0x76D2F6F5,
+		            0xD54D1413, 0x7C8D29A7, 0x32B8A19A, 0x17185751 }} }
+	},
+	/* 21 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x433BEB67, 0x34CF249D, 0x383CE17A, 0x9FFB0B06,
+		            0x76241A5F, 0xC41E0425, 0xE9E35A9C, 0x5C09174F }} },
+		{ .w32 = {{ 0x76EF5323, 0xA9FA13D4, 0x773F989C, 0xD568C0F3,
+		            0x6308EFC4, 0xFC5C3E2A, 0x1DF2207F, 0x4E2A7A0D }} }
+	},
+	/* 22 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x6AFD3F92, 0x2228CC12, 0xDE738EE2, 0xC65CCD4D,
+		            0x8D11D954, 0x4A5B20F5, 0x0E3BB4C7, 0x2A5F13C2 }} },
+		{ .w32 = {{ 0x8C0480CD, 0xD4C6EDE5, 0x84A612BF, 0x4DC1972A,
+		            0x60D5647A, 0xA30FFF62, 0x6BB388EC, 0x4A21C357 }} }
+	},
+	/* 23 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x2ABE0DF4, 0x3341E9A1, 0x3F12F94B, 0x4C8C189A,
+		            0x9F29DDD9, 0x522992FC, 0x0FCBA041, 0x69B183A0 }} },
+		{ .w32 = {{ 0x01463FF0, 0xFD781703, 0xD5FA89B7, 0x7DB2412E,
+		            0x2840A919, 0xF22FCF45, 0x9AB47D5F, 0x18F6726E }} }
+	},
+	/* 24 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x71B637B9, 0xCF49C41C, 0x1EB11DA1, 0x6970B126,
+		            0xC2808BDC, 0x2F84E117, 0x90F08BE0, 0x26230675 }} },
+		{ .w32 = {{ 0x528E1D57, 0xE05986FF, 0x31A633A1, 0x0DF892BA,
+		            0xBEC37906, 0x4795CC0C, 0x6B7788F2, 0x5536D8C1 }} }
+	},
+	/* 25 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x83A57462, 0xAB664C15, 0x53411469, 0x78694911,
+		            0xD0CA6CAF, 0x5C937337, 0x349DFCEF, 0x2734C856 }} },
+		{ .w32 = {{ 0xBE284507, 0xBDA4965F, 0x19F5582E, 0xF3BE5EFF,
+		            0xAC106A0E, 0x14E2B275, 0x3412AE34, 0x65691E34 }} }
+	},
+	/* 26 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x800D5986, 0x87730DDB, 0x9BAAED89, 0x38A46A33,
+		            0x0561A0D9, 0x24CE04C3, 0xE5BF6CBC, 0x1688C835 }} },
+		{ .w32 = {{ 0x1070CB7D, 0x1CACC0B0, 0x5D226843, 0xDB369B19,
+		            0xB0558273, 0x912C1EAE, 0x9C9ABFF9, 0x05769A31 }} }
+	},
+	/* 27 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x64B56D89, 0x0BB6EBAC, 0x3ACDF2B7, 0xA2C3FDED,
+		            0xD6028B9D, 0x97102BA9, 0x7C6227C5, 0x4335DEA2 }} },
+		{ .w32 = {{ 0xF72AD0AE, 0xBA1150B9, 0xBD024002, 0xA4963B7D,
+		            0x27F6BDB9, 0xE4EDC1AF, 0xE7CDE76F, 0x31EEB31E }} }
+	},
+	/* 28 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x6E63197E, 0x87C3108B, 0xC941E739, 0x81C454EB,
+		            0x67763009, 0xA4B61AA8, 0x517962B9, 0x271F7DAF }} },
+		{ .w32 = {{ 0x737A7B8E, 0x58AFD11D, 0xC2B48A33, 0x6422A65A,
+		            0x000EFD92, 0xCE0D165B, 0xB5125A71, 0x0912E522 }} }
+	},
+	/* 29 * 2^0 * G */
+	{
+		{ .w32 = {{ 0x5E2D2399, 0xA6E9DC9B, 0x117C121F, 0xE02B1476,
+		            0xD683A825, 0x13CCC1EB, 0x092595BD, 0x5EBADE7F }} },
+		{ .w32 = {{ 0xBA291608, 0x7EAA3DF6, 0x01FF7806, 0x9D15485F,
+		            0xC5A79920, 0x55C6235F, 0x83128E8A, 0x2F247950 }} }
+	},
+	/* 30 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xCBF1C5D7, 0x031113B8, 0x9E4EF387, 0x012339A2,
+		            0x2CFD3FA9, 0x2A7799B0, 0xA38490E4, 0x4E21C55D }} },
+		{ .w32 = {{ 0xD1023C80, 0x0340EC0D, 0x47D59E65, 0x092F97BA,
+		            0xBDF39303, 0x49634E32, 0x5B19EBAC, 0x72499FBF }} }
+	},
+	/* 31 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xFB942391, 0x58F5498B, 0x698B9ECD, 0x3F02A1C2,
+		            0xDE9E863F, 0x3874F3E1, 0x0ECA574D, 0x2B1D5A33 }} },
+		{ .w32 = {{ 0xA51A1A6A, 0x50586AD6, 0x902D898D, 0xEC7FDDCC,
+		            0x787C082B, 0xAC6552F3, 0xB11873D0, 0x29A869E9 }} }
+	},
+	/* 32 * 2^0 * G */
+	{
+		{ .w32 = {{ 0xF26D5519, 0xCE344EAC, 0x422E9009, 0xFC5F45BC,
+		            0xB0BF1E6B, 0x20FF78D1, 0x9130C405, 0x40A1F8EC }} },
+		{ .w32 = {{ 0x1FD080FA, 0xCEF53483, 0x7E43B47C, 0x61224DE9,
+		            0xC4D12EE2, 0x42946CD9, 0x7A936C0F, 0x510DB9CA }} }
+	},
+	/* 1 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x73E3A0CA, 0x697B9E7B, 0xC421999C, 0xE7085AE6,
+		            0xD1B3A357, 0x074D1124, 0xDFC7FA1A, 0x1A4CB8FF }} },
+		{ .w32 = {{ 0x46D6982D, 0xFCA593AA, 0x0182C270, 0xE9EA3629,
+		            0x098EC001, 0x154A1B59, 0xD3DE0904, 0x0FFE4AA8 }} }
+	},
+	/* 2 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x63A11FF6, 0x55E798B2, 0x0455C40C, 0x0481B5C9,
+		            0x16EAC232, 0xB716A0F5, 0x84CEAC63, 0x67A64166 }} },
+		{ .w32 = {{ 0x2887C7B6, 0xC8FB6202, 0xAF580072, 0x3BD39C49,
+		            0xD3A90820, 0x4140778A, 0x9D5088A2, 0x4463B7B1 }} }
+	},
+	/* 3 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xFFAC0CAB, 0xFC609B5E, 0xDD8B1B45, 0x69878775,
+		            0x856DD67B, 0x077F9FD0, 0xCC209218, 0x4478FACA }} },
+		{ .w32 = {{ 0x08A52C60, 0xF87E904D, 0xE64BE294, 0xB2B2FF5A,
+		            0xA7DA9FFD, 0xB691FD6D, 0xEC6601A0, 0x0FC1CE2E }} }
+	},
+	/* 4 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x6C297487, 0xDEE01B0D, 0xF9139CBA, 0xE57A3673,
+		            0xBEF85004, 0x446CA36E, 0x5513F6B6, 0x59CAC1FD }} },
+		{ .w32 = {{ 0xCFA99CFB, 0xFC50D8F7, 0x9C3E0BBD, 0x49B4F634,
+		            0x0B8E5394, 0x529BA130, 0x8293B4FA, 0x0DF8BA22 }} }
+	},
+	/* 5 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x870B69CE, 0x66BDAB78, 0x2C5ED776, 0x7CD046EE,
+		            0xE9D9B180, 0x4D788EFB, 0x1927E371, 0x4DD5B3E6 }} },
+		{ .w32 = {{ 0x0C728444, 0x70607C5A, 0x6235C9EE, 0x40C0289C,
+		            0x537FB144, 0x23D13C8E, 0x2AA5BA61, 0x7A687BF0 }} }
+	},
+	/* 6 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xE288A82E, 0x1965B2A7, 0xA2DF0854, 0x4EE86A79,
+		            0x1190DB5A, 0x8467920E, 0xB88948E3, 0x591F3510 }} },
+		{ .w32 = {{ 0x385D7F95, 0xAB04D9D7, 0x3087C4D9, 0x624B002B,
+		            0xFB7444F7, 0x22A365C4, 0x990AD76F, 0x1C374A23 }} }
+	},
+	/* 7 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x259EA3FC, 0x1AC622E4, 0x433265E1, 0x0F682EC7,
+		            0xEF2893C9, 0x96AC2146, 0x665B1839, 0x58E7B55B }} },
+		{ .w32 = {{ 0xDDFB0AAE, 0xD1C53564, 0x39F75CAD, 0x03518316,
+		            0x6D892C55, 0x2E88095C, 0x891A166D, 0x7ADB2C41 }} }
+	},
+	/* 8 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xFE081CD0, 0x7FC30833, 0xFEC61727, 0xF09AF664,
+		            0x354211D9, 0xC9E4121D, 0x408229C5, 0x0FB60690 }} },
+		{ .w32 = {{ 0x89E744CD, 0x6CBF30E1, 0x0A79E710, 0x3CAC65C5,
+		            0xA9813A4F, 0x4AD39DE6, 0x00081217, 0x6C74D491 }} }
+	},
+	/* 9 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x5D19A97A, 0x59136069, 0x2AB31753, 0xC977F5FE,
+		            0xE7A4C702, 0xFD434AB4, 0x3739423D, 0x10E91754 }} },
+		{ .w32 = {{ 0x9CCC0486, 0x27AD719E, 0xBBEB2484, 0x32E0739C,
+		            0xC4D6F382, 0x8F5DE598, 0x9F62CFA6, 0x5A9C646A }} }
+	},
+	/* 10 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x2B72CD45, 0xA807CAA8, 0x8AAD4ECF, 0x7D686044,
+		            0x9C26C251, 0x4AFB324E, 0x44E3D8AD, 0x1DFA54CA }} },
+		{ .w32 = {{ 0x5D3E80DB, 0xFEA05940, 0x85ED4D9F, 0xFD9FF97A,
+		            0x046C2A44, 0x234189AC, 0x9FA94D4F, 0x52A91097 }} }
+	},
+	/* 11 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x3AEDB6B4, 0x48482CEB, 0x609F146F, 0x2E2400BC,
+		            0xDACD743E, 0xBEA16F4D, 0x09CCFC5A, 0x3FB6B9A1 }} },
+		{ .w32 = {{ 0x838B2353, 0x681713F9, 0x5286E62E, 0x1FCA8159,
+		            0x970F7821, 0x70BAC1D4, 0x0F377CA1, 0x00F7DB30 }} }
+	},
+	/* 12 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x2BC3F552, 0x2BE57FFA, 0xFD355CE2, 0x8EAF26F3,
+		            0xBB4BADDF, 0x675D8F0F, 0xC1DF9709, 0x51153064 }} },
+		{ .w32 = {{ 0xAC0B5792, 0x8C04B72A, 0xF177A696, 0xEA599C3B,
+		            0x116C4222, 0x74F7499B, 0x7B202F5C, 0x7B79FFDB }} }
+	},
+	/* 13 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x77AF9D4D, 0x44B6D96A, 0x33C619BB, 0x7EA61DB0,
+		            0x5F0C1764, 0x70AB2342, 0x396F2339, 0x72E74713 }} },
+		{ .w32 = {{ 0xB19922F6, 0x491951FD, 0x984E99B7, 0xF1764881,
+		            0x62CF1BF7, 0x3E831407, 0xEF86A231, 0x05BA81C4 }} }
+	},
+	/* 14 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x8315EFEB, 0xAFDFB78E, 0xB20A368E, 0x4BBA69D3,
+		            0x08E180D9, 0x82504E85, 0xDCD9AD26, 0x44E970C1 }} },
+		{ .w32 = {{ 0x4137D57A, 0xE1CBCE39, 0x9706476C, 0x591EB949,
+		            0x3D994FD3, 0x818E34D0, 0x52AFAA03, 0x094A8952 }} }
+	},
+	/* 15 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xED607375, 0xC694DBB9, 0xC1043DE9, 0x797DBA07,
+		            0x62D57C3A, 0xD30A642C, 0xE56B470F, 0x3DF98FC3 }} },
+		{ .w32 = {{ 0xD0EB464D, 0x6A670C5B, 0x00A05FE2, 0x9403F05A,
+		            0x4056329B, 0x3D86636C, 0x148D17AA, 0x1FC48050 }} }
+	},
+	/* 16 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xF7C520F5, 0x1E2BBC30, 0x5CCA2981, 0xD1D650E1,
+		            0x4184B0C0, 0xFDB303DD, 0x7D39D61C, 0x22DE993E }} },
+		{ .w32 = {{ 0x25DD6010, 0x9DCA1F26, 0x158626EB, 0xBB111499,
+		            0x433BEE47, 0x7530BB18, 0x017B170A, 0x0F316861 }} }
+	},
+	/* 17 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xFAB7533A, 0x74D1D99C, 0x54BA2CA1, 0x5D5359A1,
+		            0xA7297742, 0xDFD4CAF2, 0x3EA3BCA2, 0x0E6F2FF3 }} },
+		{ .w32 = {{ 0xC04068A6, 0x7CF423E0, 0x7A81C89C, 0xD3B0E873,
+		            0xEF927D30, 0x229DF0CE, 0x3DCD86AD, 0x3C17B4F9 }} }
+	},
+	/* 18 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xF5F8FBCC, 0xCBD80ADD, 0x0976AB46, 0x885374E2,
+		            0xF4A946D3, 0x11848340, 0xAE6CF081, 0x7C86669D }} },
+		{ .w32 = {{ 0x7550FBAB, 0x0DAC98B1, 0x631216A9, 0x7E6A1E92,
+		            0xC7484A9C, 0x288E4706, 0x7576E7EA, 0x4E708E19 }} }
+	},
+	/* 19 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xD5050113, 0x7FB8FFCF, 0xA0C71A88, 0xA24B5E8E,
+		            0x0497291E, 0x800D6619, 0x39F9BC6E, 0x6431762A }} },
+		{ .w32 = {{ 0x1D7297E2, 0x88E39120, 0x46FA87C8, 0x90E6153F,
+		            0x66F566B4, 0x484EDE3A, 0x0C4E242F, 0x1F1AEA05 }} }
+	},
+	/* 20 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xCB2B9B1B, 0x00EFEA31, 0x244467EE, 0x2CF11B45,
+		            0x2B60983A, 0x4FB7F1C6, 0x2001ABA6, 0x06D469CF }} },
+		{ .w32 = {{ 0x9ACA3874, 0x58C7CAD5, 0xA710681B, 0x92D8292D,
+		            0xD4C981C3, 0x72084F7D, 0x52244294, 0x366EE2BB }} }
+	},
+	/* 21 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x93BEC6DD, 0x345BD85E, 0x23BB80F7, 0x9AE9619C,
+		            0xF003FD4C, 0x5BAE41ED, 0xED73B178, 0x01B24C8D }} },
+		{ .w32 = {{ 0xFE84D1BD, 0xFFC16CE6, 0x4FB8053C, 0x41AF37BB,
+		            0xB09D656B, 0x5DB39C3F, 0x0A84186B, 0x6EEAB342 }} }
+	},
+	/* 22 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x0580B9EC, 0x247B6666, 0x8BB77DE3, 0x4EB74B19,
+		            0xD52C284B, 0x510434DC, 0xEBDEEF2B, 0x1F475B95 }} },
+		{ .w32 = {{ 0xA3F85191, 0x8A65E29C, 0xE1D884EF, 0xE123F1BE,
+		            0x75277629, 0x3E09BE81, 0x6F4C2909, 0x09E0C3B6 }} }
+	},
+	/* 23 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x8C811EC5, 0x7FC6EF75, 0x590EBCF8, 0xEEDACCEC,
+		            0x8648A8CC, 0x9A997C0C, 0xE55CC928, 0x3CF943BB }} },
+		{ .w32 = {{ 0x43ABA2EA, 0x559F6F23, 0x63917537, 0xE94A852F,
+		            0x15E9A97E, 0xF32ED986, 0x5D8A93C9, 0x5D787C53 }} }
+	},
+	/* 24 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x83D95176, 0xC0E90CD2, 0x9D7E200F, 0xDB69DADE,
+		            0x2689A746, 0xB02FC7F6, 0x34ADDFBE, 0x2A888644 }} },
+		{ .w32 = {{ 0xF9616B83, 0xFAC5FEF9, 0x2571210B, 0xB4B0D575,
+		            0x71E23729, 0xDBD3AAC8, 0xAE04568D, 0x2ABE2E06 }} }
+	},
+	/* 25 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x90C2C803, 0x279C71D6, 0x69C0609B, 0xA4DE34D5,
+		            0xD31A1552, 0xB4406B27, 0x888DDBCA, 0x01429E02 }} },
+		{ .w32 = {{ 0xD4031996, 0x86154838, 0x79EB75B8, 0xF85756C1,
+		            0xD5EE4FC4, 0xDBAE0C14, 0xBA05483C, 0x7B850290 }} }
+	},
+	/* 26 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xE2966AE4, 0x9E9F806E, 0xE2B77D1B, 0x4BB8E818,
+		            0xD45508BD, 0x302ACD3F, 0x7972E826, 0x76CAAA27 }} },
+		{ .w32 = {{ 0x8E8FE4F4, 0x05374E15, 0x2EC5DA7A, 0x07233075,
+		            0xA769CE9B, 0xC4C539B0, 0x4BA9CBE0, 0x4B35BA8F }} }
+	},
+	/* 27 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x52ACFA01, 0x33C1D426, 0x75BF6E60, 0x5C5EA13E,
+		            0x293D114B, 0x4431D8B4, 0xAB285C3F, 0x0F6BC830 }} },
+		{ .w32 = {{ 0xD32A3C40, 0x348FE6C9, 0x7F680CBF, 0xF58F4CA9,
+		            0x93E36EA1, 0xF361D858, 0x8F8240D6, 0x49C999FF }} }
+	},
+	/* 28 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x86D72F78, 0x60B3759F, 0xEAD8836A, 0xECE5E52F,
+		            0x00ECE01C, 0x3BD596AE, 0x0EE78E79, 0x5F23A11E }} },
+		{ .w32 = {{ 0x5E020E80, 0x453C4220, 0x0517CBC6, 0x835E3453,
+		            0xC7EB977A, 0xA0BCFDB1, 0x9E440832, 0x4D0CEA3C }} }
+	},
+	/* 29 * 2^24 * G */
+	{
+		{ .w32 = {{ 0x7A575C40, 0x1CF4C21A, 0xE58E7B61, 0x0BBC182F,
+		            0xA3D5D103, 0x80F1D105, 0x938561C3, 0x046B54F4 }} },
+		{ .w32 = {{ 0x3949EC7B, 0xB306A0ED, 0x93FCED50, 0xD84C38BF,
+		            0x3C31ED5C, 0x10F2848E, 0x0766822D, 0x19C64146 }} }
+	},
+	/* 30 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xCE39DD23, 0x9A9D1A7E, 0x1B99CB0B, 0x503CA690,
+		            0x2CBF75C8, 0xA62B65EA, 0x475A5387, 0x14EE89A4 }} },
+		{ .w32 = {{ 0x20D23259, 0x03B038C0, 0x8F911B91, 0xBB857A6C,
+		            0x17697B08, 0xA426D101, 0xB0B828A4, 0x7AB5E87E }} }
+	},
+	/* 31 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xD76DA3CE, 0x06DE3C0B, 0x9CD48C75, 0xE2E39AF1,
+		            0xADEC78A1, 0x8756F00D, 0xF3CA8702, 0x31855F00 }} },
+		{ .w32 = {{ 0x689919CF, 0x64897E65, 0x14DD33A8, 0xF80FCDDD,
+		            0xE084B984, 0x3FC16DC8, 0x509994F9, 0x4B2DC2BA }} }
+	},
+	/* 32 * 2^24 * G */
+	{
+		{ .w32 = {{ 0xD9EB20A5, 0x8CA3EEDD, 0xA792321B, 0x15C3FD19,
+		            0x7587CB86, 0x574A3335, 0xEA64DD2A, 0x392C6D70 }} },
+		{ .w32 = {{ 0x44AFD226, 0x8519D643, 0x54C3E01D, 0xB4754F35,
+		            0xFB766604, 0xC6407883, 0x3A4B8315, 0x4DA53FD1 }} }
+	},
+	/* 1 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xB8C3C407, 0x0A86FCFB, 0xF843E886, 0x7E58D9A4,
+		            0xAD184A5C, 0x0A6E4E0F, 0xE09E9C5C, 0x22786100 }} },
+		{ .w32 = {{ 0xDAA9BA41, 0xA173A66A, 0xBE520CD9, 0x3FEBD0D4,
+		            0xAF4EDD17, 0xD4F5B048, 0x8386A51A, 0x5732340D }} }
+	},
+	/* 2 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x1887E4A0, 0x2787B4E2, 0xE51ED96E, 0x7A0BF2B9,
+		            0xAD9B15DE, 0xBD4BF1D7, 0xDB0C807D, 0x054395B9 }} },
+		{ .w32 = {{ 0x8ED63E01, 0xFFD98B7A, 0x99D9FE50, 0xAE84972F,
+		            0x7223BB2C, 0x57435FED, 0x2ED87B58, 0x78A97890 }} }
+	},
+	/* 3 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xB0E60822, 0xAECDFD11, 0x2A04585D, 0xAC62A360,
+		            0xA8A16C6E, 0xE5F99E8D, 0x89887A09, 0x05BEB157 }} },
+		{ .w32 = {{ 0xB87A4D00, 0x4A4C2620, 0x030859EA, 0xF0FFAAB1,
+		            0xB7460017, 0xA6D72B92, 0x20562D1B, 0x246D88E6 }} }
+	},
+	/* 4 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x1293D33C, 0x4399CE68, 0x8B4B58A7, 0x7BD94CF8,
+		            0xFEC2E894, 0x6ECFCEBB, 0xD644161A, 0x1A7C2E15 }} },
+		{ .w32 = {{ 0xC49DF500, 0x66384F31, 0x60D2061A, 0x6605C9E1,
+		            0xBD032754, 0xB557C1CC, 0x9D80B960, 0x2F30CC48 }} }
+	},
+	/* 5 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x9A7A9649, 0x0A5312AC, 0xDB646658, 0xBF177FDF,
+		            0xFE5D40AC, 0xCA79A4EC, 0xA15628B3, 0x139C53C3 }} },
+		{ .w32 = {{ 0xC46D6C92, 0x3C889664, 0xC5EA2761, 0xD9B23F7E,
+		            0x9075E8F8, 0x6EE5E9AE, 0x2FD98622, 0x7686B730 }} }
+	},
+	/* 6 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x15CF1EBB, 0xC377028D, 0x91411FF6, 0xC7F10607,
+		            0x7DF7700A, 0xA5EE240D, 0xF9C2BEC6, 0x54D2C862 }} },
+		{ .w32 = {{ 0x7733A0C7, 0x97FDF79A, 0x959E1388, 0x1F636457,
+		            0xF14706E1, 0x7E67F9B2, 0xE0676C32, 0x74B1B091 }} }
+	},
+	/* 7 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x6EC91013, 0x8417FC85, 0x157123A1, 0xCF5DD093,
+		            0x89F175EC, 0xA5BF5444, 0x181260BC, 0x6D96A75B }} },
+		{ .w32 = {{ 0x9068B6BB, 0x79FD4668, 0x0633A60E, 0x1B0A154F,
+		            0x95DC192B, 0x489E45C5, 0xEF0A82C0, 0x5C2ECB0E }} }
+	},
+	/* 8 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x3C70F29E, 0xA9602E6D, 0x0737A357, 0xCB21AC39,
+		            0x50F6E6AC, 0x7D49F46A, 0xF9EDC2AB, 0x54536BA5 }} },
+		{ .w32 = {{ 0x600EFB55, 0x0EA12E2D, 0x91ED2244, 0xE7DCEAA8,
+		            0x3B4F4682, 0xE2436526, 0x520132D2, 0x13A2A70E }} }
+	},
+	/* 9 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x61C72D9A, 0x5616678E, 0x54DB5186, 0xBC176920,
+		            0x86F990B7, 0x45556FC7, 0xA5A9D75A, 0x1CCD0A2D }} },
+		{ .w32 = {{ 0x9CD7F3F1, 0xA4A2078A, 0xD5E9E3EA, 0x4B70C883,
+		            0x5E773BD0, 0xCB2932A3, 0xC4AD3C5A, 0x383779BD }} }
+	},
+	/* 10 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x56C31D8F, 0xEC19EA41, 0xA67AA776, 0x42586DCA,
+		            0x627C57EC, 0xCBCF1FA0, 0x324D6012, 0x58B26F63 }} },
+		{ .w32 = {{ 0x261FC264, 0x84E3691C, 0x7C327F26, 0x0B158545,
+		            0xF4599629, 0xE07F06A7, 0x3997DBA3, 0x30829909 }} }
+	},
+	/* 11 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x60861EAB, 0x2CDF011D, 0x1401D12C, 0xA8356C06,
+		            0xE236412C, 0x6BAA9D00, 0x0C5C9DA1, 0x74BDD5ED }} },
+		{ .w32 = {{ 0xCFDF8A9E, 0x584F7D9B, 0x9B68DF17, 0xB411CE34,
+		            0x92EBC681, 0xC107EE76, 0x43366E80, 0x732CF97E }} }
+	},
+	/* 12 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xB089EB98, 0xAB9D2EE1, 0x94764480, 0x6DC9AFDA,
+		            0x2C9FD9FE, 0xC0DD9611, 0xADE89C18, 0x3DFDE31B }} },
+		{ .w32 = {{ 0xFD019D44, 0x8CAE4F50, 0xAC698AD4, 0x67E8320C,
+		            0x82CE8599, 0x20B953CD, 0x8513BB7B, 0x2685F6A5 }} }
+	},
+	/* 13 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x2ACFBD85, 0x2EC71645, 0x835CD58A, 0x36F53761,
+		            0xA21F03C7, 0x399508F5, 0x45B34257, 0x07CD80A8 }} },
+		{ .w32 = {{ 0x25D2D185, 0x1B6969A8, 0xE8A996E4, 0x97F09B89,
+		            0x6E550B8C, 0xA890F0E7, 0x76C462F3, 0x784C84F0 }} }
+	},
+	/* 14 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x9615E6D8, 0x2E16973C, 0x3EE6FE55, 0x9F9C7D19,
+		            0xEA8EBFC6, 0x5441B99B, 0xF6D5C1F9, 0x7D7905B6 }} },
+		{ .w32 = {{ 0x4FABCE7B, 0x29787FE3, 0x42E89D79, 0x45F4DDA0,
+		            0xE524E689, 0x048FF812, 0xC43B9AFB, 0x06D5DAEC }} }
+	},
+	/* 15 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x1EFE10B0, 0xDABC7841, 0x81021DF9, 0x5E80DD36,
+		            0x73BC9080, 0x1961B98A, 0xBB754153, 0x0791F999 }} },
+		{ .w32 = {{ 0x8A9F5266, 0x210E8861, 0xDB8A9ECD, 0x1635A586,
+		            0xBF299011, 0x813C3824, 0xA521C208, 0x36E00130 }} }
+	},
+	/* 16 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x45964330, 0xA287D1C5, 0x1FBB12D2, 0x38BB0D31,
+		            0x4C35AA19, 0xED61F06B, 0x1CDDE7A8, 0x6FF23A1B }} },
+		{ .w32 = {{ 0x4E531CC6, 0x650E7C1E, 0xF57796D0, 0x76A20257,
+		            0x36672F75, 0x3E7EB3D2, 0x3AF3C16F, 0x72A26277 }} }
+	},
+	/* 17 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x955F6B6B, 0xACEF0AD2, 0x402377C6, 0x1A5656D8,
+		            0x70DC70AD, 0x3BB58E81, 0xA6FE65C6, 0x5106E70F }} },
+		{ .w32 = {{ 0xCBA452A4, 0x982DBC4F, 0xCCFFBEB8, 0x55EE7621,
+		            0x6D9279DC, 0xC2E8A813, 0x47DC90A5, 0x1CBED292 }} }
+	},
+	/* 18 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xC8A69279, 0x60A9D260, 0x3836516A, 0x72B467C6,
+		            0xAA5C6AB6, 0x45FD119F, 0x4FE6A3B5, 0x1568E4EB }} },
+		{ .w32 = {{ 0x665F9A3C, 0xE3D7C637, 0xA127A382, 0x33837C6B,
+		            0x9FD65DB4, 0xED121226, 0xA0AA6E99, 0x2A17127D }} }
+	},
+	/* 19 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xA7FCC275, 0x0E14F757, 0x260972C5, 0xB8C18433,
+		            0xBB148BE4, 0x676BA4DC, 0xD962C431, 0x550506F7 }} },
+		{ .w32 = {{ 0xF4E73AC7, 0xE224D081, 0x70C3B371, 0x4C08DEEA,
+		            0xE02B6DEE, 0xE9149EB9, 0x30CF162D, 0x76292F70 }} }
+	},
+	/* 20 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x4E82C9E7, 0x32F2B0A3, 0x23D040F6, 0x09C671D6,
+		            0xA3F47C64, 0x470D6B5E, 0xB396632E, 0x5F04980B }} },
+		{ .w32 = {{ 0x0BDA1046, 0xE2A8E7C8, 0x63447455, 0x2875259B,
+		            0x8639DE1B, 0xB7FC40C3, 0xF185A415, 0x78BD43AD }} }
+	},
+	/* 21 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x39CC2FF1, 0x3EC5962A, 0xF7E2C869, 0xB1337B52,
+		            0x0915B8DA, 0x017B2A72, 0x81475544, 0x32B422EB }} },
+		{ .w32 = {{ 0x0A078E7F, 0x5595B009, 0x60C52F86, 0x90C83C61,
+		            0x0C67E8FD, 0xF7DD9D53, 0xD0A00336, 0x1F6B022E }} }
+	},
+	/* 22 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x0FA51FE9, 0x49386C2C, 0x7FAAB743, 0x60C85D59,
+		            0xCBF85D99, 0xC0D5AE02, 0x9A9A4AAE, 0x51FFE8BD }} },
+		{ .w32 = {{ 0x7D7FE715, 0xE686FDCE, 0x44D1034F, 0x4217C9FA,
+		            0xE4EF741F, 0x3A38D1CC, 0x00CEBCAC, 0x359E1C72 }} }
+	},
+	/* 23 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xCB0ABC6F, 0xB1B7299F, 0xC7C98F2A, 0x3B351786,
+		            0xE0B73BAE, 0x6FDF9D40, 0xB665872F, 0x45ADC6EB }} },
+		{ .w32 = {{ 0x3A025A2B, 0xC2BB8D88, 0x72DBE34F, 0xF4915900,
+		            0x22BCA8B3, 0xBC0786D5, 0x9E7FCE68, 0x764BD2B9 }} }
+	},
+	/* 24 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x22D89306, 0xCFC15794, 0x67645671, 0xBD28B19B,
+		            0xE51E5B9F, 0x4D5C2F89, 0xF2DFEEA2, 0x2990F7DC }} },
+		{ .w32 = {{ 0x24B93887, 0x5BA2B8E5, 0x76213EEB, 0x0CC0B887,
+		            0x4C6D3C83, 0x15E1E4BA, 0xA2FD97B0, 0x3F1B45C1 }} }
+	},
+	/* 25 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xBD54D7FA, 0xCD17056E, 0x040A00E2, 0x2BD9D396,
+		            0x22842027, 0x1EDB2978, 0x2CE6E4AA, 0x511E8B9C }} },
+		{ .w32 = {{ 0x4E9A6603, 0xF1F5273F, 0x86C359EF, 0xADC20A54,
+		            0x8E6F385A, 0x28FE3E38, 0xE366D35B, 0x679508EF }} }
+	},
+	/* 26 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xA6873CFE, 0xF6534424, 0x75BF8058, 0x98BA1528,
+		            0x6F2147B1, 0xB7B90858, 0xC2CBAD18, 0x5BBB11ED }} },
+		{ .w32 = {{ 0xA1EDA6CF, 0x4EDEF134, 0x5954C600, 0xD5DB60EB,
+		            0x100678A8, 0x6801ED68, 0x089B999D, 0x16A2FFCB }} }
+	},
+	/* 27 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x945749E9, 0xEA23A4A6, 0xFF8157D3, 0x0A686460,
+		            0x573DA10D, 0x4DCD3A1B, 0xCB94B443, 0x35CB6B43 }} },
+		{ .w32 = {{ 0x4AC759B6, 0x3E8CD47F, 0xCE47D085, 0x97CEA36D,
+		            0x28FDB4CD, 0x5F4008FF, 0x4E956E0D, 0x67A09310 }} }
+	},
+	/* 28 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xE1107444, 0x7F6B76E9, 0x41C61F8C, 0x5A203B3C,
+		            0x1AAD0FB0, 0x805767EC, 0xED92B12C, 0x1CC621D2 }} },
+		{ .w32 = {{ 0xAE08255E, 0x76B2BDF8, 0xB2F85ED3, 0x3F969DC4,
+		            0xA4356F89, 0x2F6F6076, 0x918F08BD, 0x7C44BDDB }} }
+	},
+	/* 29 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xD16CF098, 0x7AE20679, 0xE65DD072, 0x9212984E,
+		            0x6DEDB8E6, 0xBE96EDEF, 0xEAF92CD7, 0x539F99FA }} },
+		{ .w32 = {{ 0x02007C8B, 0xB8D537F4, 0x6896F8D6, 0x8961108D,
+		            0xB543AA57, 0x69EF184B, 0x630DBC47, 0x1C0B9CBB }} }
+	},
+	/* 30 * 2^48 * G */
+	{
+		{ .w32 = {{ 0xCCAEB333, 0x2B3D009A, 0x2B5CCE45, 0x655494A6,
+		            0xE1D1619E, 0xB4342654, 0xAEE9E584, 0x04F063A1 }} },
+		{ .w32 = {{ 0x82EA3DDA, 0xD50AF449, 0xBBA87EFC, 0x517290DF,
+		            0x7567FA8B, 0xECC71B83, 0xFA1728E2, 0x1F992EA3 }} }
+	},
+	/* 31 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x7083D025, 0x18E5CA6C, 0x085E4396, 0x7A4C087D,
+		            0x359C8E7C, 0x9C70F68E, 0xE43E02A7, 0x6BEF82A4 }} },
+		{ .w32 = {{ 0x07456008, 0x552660F1, 0xF93FC1DF, 0x87004704,
+		            0x4D433848, 0xC2BA38A7, 0xFFA15BF9, 0x34887DD8 }} }
+	},
+	/* 32 * 2^48 * G */
+	{
+		{ .w32 = {{ 0x671AB904, 0x04FB3E38, 0xEEF782CA, 0xD2444A72,
+		            0x88082C00, 0x590ACC32, 0x20CEEA0A, 0x550B175F }} },
+		{ .w32 = {{ 0x22E73B1E, 0xECFFF396, 0xC0564279, 0xD28C96CA,
+		            0x78672981, 0xFBF9A95F, 0x9B535DFA, 0x73144496 }} }
+	},
+	/* 1 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xBCF06D5B, 0xF2FC626A, 0xF14AB11D, 0xD8761B65,
+		            0xD25B59BB, 0xD65FC6DB, 0x2E88789F, 0x7546F172 }} },
+		{ .w32 = {{ 0xF51FAEA7, 0x3C96D6D8, 0x689A77E5, 0x4B2C8537,
+		            0xE8B2436C, 0x2CA66A54, 0x689BBE93, 0x5EB84418 }} }
+	},
+	/* 2 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xE9EC47BF, 0x1E0999BC, 0xEE0489AB, 0x2E3FFF82,
+		            0xC51A3A84, 0x2FC4ADA0, 0xD757DFF3, 0x2933119F }} },
+		{ .w32 = {{ 0xCE559911, 0xF65270F8, 0x47B7E25A, 0x20646F4A,
+		            0x2EA2A272, 0x3C7EAAEE, 0x2B38F53A, 0x63FA228E }} }
+	},
+	/* 3 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x524CB1CD, 0x1981A2BE, 0x85F66559, 0x953B6D66,
+		            0x0BFB9BEB, 0x14A5E5E4, 0xFA60AEEC, 0x3B9C237F }} },
+		{ .w32 = {{ 0x9D251757, 0xFE27AFF3, 0x23A956EC, 0x889F7F73,
+		            0xB1D4B4EE, 0xEE041CD5, 0x85553A35, 0x205FC70E }} }
+	},
+	/* 4 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xA58DAF3A, 0x9AC025FC, 0x677223FD, 0x1E96CFBB,
+		            0x4E427EB9, 0x22325DC7, 0x33CF76BC, 0x41F65354 }} },
+		{ .w32 = {{ 0x25008E3F, 0xD366E656, 0x779A949E, 0x85E37656,
+		            0xCDD7924D, 0x3326209D, 0x674A9E55, 0x2FD3F3DC }} }
+	},
+	/* 5 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x944DC02F, 0x6BC7DDCD, 0x2F11BF4C, 0x027495E9,
+		            0xA27EF870, 0xBED325F2, 0xB444E570, 0x104D36FB }} },
+		{ .w32 = {{ 0x479410C0, 0x42B96671, 0x15DF6DDD, 0xE6D3D932,
+		            0x821C4B8F, 0x80CA3843, 0x1A71850C, 0x48E8A128 }} }
+	},
+	/* 6 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xCC03E41D, 0x9B27CE28, 0x653B0D4E, 0x4D629AFE,
+		            0xB42AE63D, 0x8CE40273, 0x05B696C9, 0x4CABD835 }} },
+		{ .w32 = {{ 0x386F3B6C, 0xF10733FE, 0xFEA16914, 0x9653E386,
+		            0x11B25535, 0x44298823, 0x21101C12, 0x30BE9B21 }} }
+	},
+	/* 7 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xB6C66D49, 0xBEABC135, 0xD6385818, 0x30072CAC,
+		            0x5381E0B0, 0x66A9BE69, 0xEB1EF605, 0x48C7EBF6 }} },
+		{ .w32 = {{ 0x9B9B5D2D, 0xEC4EBBC9, 0xC33E851E, 0x19489B90,
+		            0x9C8A2007, 0x4BCC0FFC, 0x207367FF, 0x2F010F31 }} }
+	},
+	/* 8 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x9578BD90, 0xA1039AD1, 0x16550E4F, 0xF63F6C4A,
+		            0x798885F1, 0x8A9EA069, 0x111C4CDC, 0x37904A16 }} },
+		{ .w32 = {{ 0x32FAE3C7, 0xD445891E, 0x41C931D8, 0xF47A31EE,
+		            0x85C60AB7, 0x4CE939DE, 0xA16C5248, 0x10D869E5 }} }
+	},
+	/* 9 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x16212001, 0x3309C28E, 0xE362EF91, 0x829CB266,
+		            0x94B439FE, 0xD0A1B17A, 0xA0CA34EF, 0x02C61A8D }} },
+		{ .w32 = {{ 0x1C090BF6, 0x5582BF01, 0xA4F23DB1, 0x7502B371,
+		            0x3ED4C99B, 0x75F416A2, 0xEBA846C2, 0x53781644 }} }
+	},
+	/* 10 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xD9B3F982, 0x762AAA47, 0xC4526109, 0x3BDF8427,
+		            0x1DD1EFDF, 0x62AA9333, 0x7CBC16CC, 0x4C212EEA }} },
+		{ .w32 = {{ 0xFE7D50FE, 0x9E15513A, 0x6C4DF85F, 0x66AD4835,
+		            0x74E1D5FB, 0x6D1EA9A3, 0x9CE5DE4E, 0x62557BD4 }} }
+	},
+	/* 11 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x1E9A6523, 0xA7303D84, 0x7140B0B0, 0x5E9B656A,
+		            0xDC9E6DCE, 0x41BA59B6, 0xDF84B260, 0x384D5E31 }} },
+		{ .w32 = {{ 0x0C197DE0, 0xD3EFD382, 0x405AD438, 0xBDE06DB2,
+		            0x0C540484, 0x4861712C, 0xF7792B8C, 0x6780D4B7 }} }
+	},
+	/* 12 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x6E545EE4, 0x3ACD53EB, 0x5E88A914, 0xCFA0144B,
+		            0x83F8B3BA, 0xBFADED5D, 0xFC9FDEE5, 0x6BDD2C47 }} },
+		{ .w32 = {{ 0x0FB62D42, 0xBB33AC2F, 0xF2ACD5BF, 0x50DF6BE6,
+		            0xD6ACB304, 0x89969D24, 0xA6504562, 0x20F2D88C }} }
+	},
+	/* 13 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x3FD4D9CD, 0xE00EF9B0, 0x70F22EB2, 0xFF4577C4,
+		            0x8E7349ED, 0xD6457A51, 0x1C48CC01, 0x5D853506 }} },
+		{ .w32 = {{ 0x2CD0605B, 0x01EBBC67, 0x40DEF2F4, 0xCE1CBD47,
+		            0x9260BCD3, 0xC116292B, 0xA2769FC8, 0x1BB99495 }} }
+	},
+	/* 14 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xF26D956B, 0xFA79FC3B, 0x6AA25CDD, 0xFE52823D,
+		            0x68815CB0, 0x5FFCA0D6, 0xA797A467, 0x10078F52 }} },
+		{ .w32 = {{ 0x1DCBE9C4, 0xC79BEBDB, 0x4391C29A, 0xECDA798F,
+		            0x8A85EF9F, 0xB565C647, 0x36842311, 0x5D9DD77E }} }
+	},
+	/* 15 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xA8F41EEE, 0x82E4D6B2, 0xC64E448D, 0x683028EF,
+		            0x7DEBE73F, 0x5FF4BA0E, 0x767DB19B, 0x4543131D }} },
+		{ .w32 = {{ 0xE19FFCEE, 0x208EA909, 0x73825EEA, 0x50242F4E,
+		            0xD8119696, 0x059BF929, 0xBCF4A027, 0x58E80CDB }} }
+	},
+	/* 16 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xC494F451, 0xE20DD171, 0x6EBCEFE0, 0x0283EB98,
+		            0x912708E7, 0x5D5C93F0, 0xFEE23EF6, 0x4CA02DCF }} },
+		{ .w32 = {{ 0x8AD6FFA3, 0x8F68829D, 0xE39B394A, 0x425E5957,
+		            0x44505CEE, 0x9C0F8AFC, 0x87F89E43, 0x0AD84A5D }} }
+	},
+	/* 17 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x47F2C9DC, 0x1EF728C7, 0xF84274C6, 0x3F403689,
+		            0x5ADD1F5F, 0x88EDF500, 0x6E41F931, 0x4AC1B1DB }} },
+		{ .w32 = {{ 0xE196A795, 0x3FBB22AE, 0x0646DB43, 0xE5613AB2,
+		            0xFE7DD7F7, 0x94D244FF, 0x2A991A52, 0x1BDDE7FD }} }
+	},
+	/* 18 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xB8104C7F, 0x4E66B4BB, 0x1F044BE3, 0x849BA4EF,
+		            0x760B0EBE, 0xEF6ECC8C, 0x2DFD4A0A, 0x66F7C9EF }} },
+		{ .w32 = {{ 0xEC80A171, 0x83715A56, 0xCA4A443E, 0xB2B1E4B9,
+		            0xA8BB2418, 0x0721A813, 0x6CA76168, 0x3A9676F0 }} }
+	},
+	/* 19 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xD40A4731, 0x6124A301, 0x5BF18B32, 0x494CCCF8,
+		            0x263152A0, 0xA6824989, 0x219C5B7A, 0x2A82B6C8 }} },
+		{ .w32 = {{ 0xF934888C, 0x7E56C8D8, 0x9E7FD4FA, 0x8AB85D55,
+		            0x5ADF988F, 0x92AAAA85, 0x1F606E30, 0x41CC347E }} }
+	},
+	/* 20 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xC0F5A435, 0xDEF6DB2F, 0x2F3C15CE, 0xED25BDA7,
+		            0x654F8911, 0xBC75E481, 0xF7286786, 0x39B87255 }} },
+		{ .w32 = {{ 0x818ECD02, 0x7E7F3212, 0xF5EDAD33, 0xCDF5C864,
+		            0xF750D15B, 0x44FB874B, 0xA6C0E1D8, 0x79E64BDA }} }
+	},
+	/* 21 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x6A2EDC7C, 0x72917961, 0xDADBC5A4, 0x9F3424D3,
+		            0x0A0982A6, 0xA0B17066, 0x87245339, 0x7206E4A7 }} },
+		{ .w32 = {{ 0xE72A9ACF, 0x345D6939, 0xCDF5780A, 0x965E7176,
+		            0xB980B662, 0x1719B128, 0x11C03D6F, 0x679B9FFD }} }
+	},
+	/* 22 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x2DCAB9F2, 0x3811D375, 0x606704E3, 0x88736BC2,
+		            0x78ED1729, 0x789FD75F, 0x3AD3510F, 0x5FA60A1F }} },
+		{ .w32 = {{ 0x257BCE51, 0xF126E525, 0x30E571C8, 0x85D8F212,
+		            0xBBD77E99, 0x07935C19, 0x5818A1FE, 0x612BFA50 }} }
+	},
+	/* 23 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xA682A92C, 0x34E5E052, 0x0C91DEDA, 0x79E1859D,
+		            0x2BCB75E1, 0x0C1B78F2, 0x4DF21D13, 0x4D06AFB3 }} },
+		{ .w32 = {{ 0xFB152930, 0xB9770E27, 0x7FEFB56E, 0x476C3FD0,
+		            0xFCB7B7E3, 0x344A6BA5, 0x094A4A41, 0x774C03BB }} }
+	},
+	/* 24 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xAFB44C9D, 0xDA31F243, 0xCE2A1898, 0xC2BE0C76,
+		            0x6C456DE4, 0xC99691DD, 0x9438AAF4, 0x05096636 }} },
+		{ .w32 = {{ 0xAC2CEB7A, 0x2923173C, 0x6AF0F9A0, 0x6ECF44F5,
+		            0x004D2BF2, 0x70A8D9A9, 0xA6773CDB, 0x612720E2 }} }
+	},
+	/* 25 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x9165D822, 0x28C6C17A, 0x341D9BFD, 0x85589032,
+		            0x47B8F097, 0xA64086EC, 0xA8CC5817, 0x05A7FDE8 }} },
+		{ .w32 = {{ 0x89FFA2E2, 0xE75B21D2, 0x564169EF, 0xD06B434D,
+		            0xE3307546, 0x61D37A6B, 0x2DE580A1, 0x16D82548 }} }
+	},
+	/* 26 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xCA94B921, 0xF71D5F07, 0x3A62002D, 0xF30353FB,
+		            0x3C92F8A5, 0x085EECBD, 0xA102CAB5, 0x5B6E2FF8 }} },
+		{ .w32 = {{ 0x4E5BE873, 0x1B60E03D, 0xF3DB77C9, 0x71894FAE,
+		            0x867EE04D, 0xE7475AB2, 0x608731BF, 0x66E7445E }} }
+	},
+	/* 27 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x31964991, 0x5EF772FC, 0x41C79B64, 0xCED5557D,
+		            0x9EEB07A9, 0x58F9FCE4, 0xA49F9701, 0x3620858A }} },
+		{ .w32 = {{ 0x5D0A6253, 0x042A2696, 0x3940482A, 0xB1733EEA,
+		            0x9A6A6404, 0xA5172250, 0x77F82EB2, 0x733629D9 }} }
+	},
+	/* 28 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x8781A596, 0xFCAAE350, 0x44F9572B, 0xE298B679,
+		            0x37533AC1, 0x3B006853, 0x6DFE8A4E, 0x106F9590 }} },
+		{ .w32 = {{ 0x1B4E8402, 0x5824C57B, 0xAEAD83AE, 0xC8A2F3B1,
+		            0xFEE3D997, 0xA92872AB, 0x93BB3996, 0x12D6640D }} }
+	},
+	/* 29 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x429B2E53, 0x589023F7, 0xAE70CD6A, 0x5ED3D484,
+		            0xA49AA5FC, 0x7CEC377D, 0xFF8BC835, 0x3D456521 }} },
+		{ .w32 = {{ 0x1E7C44D0, 0xC892A6AD, 0x20F81061, 0x180D9F25,
+		            0x58792BE8, 0xC055E60A, 0x7D15CF2D, 0x6F5C213F }} }
+	},
+	/* 30 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x1D799F59, 0x9E706A72, 0x77B5D448, 0x171D00D4,
+		            0x00FD9B94, 0x0EC6B698, 0x286C1671, 0x4898F306 }} },
+		{ .w32 = {{ 0xB6ADC5B9, 0x30B332F3, 0x873B44F3, 0x71DEE775,
+		            0xDD50F6DA, 0x658B520D, 0xDD49381F, 0x21237EC1 }} }
+	},
+	/* 31 * 2^72 * G */
+	{
+		{ .w32 = {{ 0x44CBCE53, 0xD91CBD7F, 0x69501923, 0x7DE9A853,
+		            0xA39912B0, 0x467F44B5, 0x44FC4302, 0x40B13A64 }} },
+		{ .w32 = {{ 0xAF20DEC1, 0x812FFFF1, 0xE1843A40, 0x7EB96297,
+		            0xD2F1EC2E, 0x8A88B6B1, 0x1104B6BE, 0x3C023EE9 }} }
+	},
+	/* 32 * 2^72 * G */
+	{
+		{ .w32 = {{ 0xD3A0CEAA, 0xCAE77A6B, 0xA10B8972, 0x5CB44DF3,
+		            0x68FC0877, 0x51135485, 0xE04AAB8E, 0x7D87A3BE }} },
+		{ .w32 = {{ 0x658AD41B, 0xBCCD296F, 0x6314BD63, 0xCB54BE88,
+		            0x937DACA6, 0x1D738A69, 0xCF3D06B9, 0x0188AA58 }} }
+	},
+	/* 1 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x3CAC4D1F, 0x20B101D8, 0xD2B3D76E, 0x53607CC3,
+		            0x7FF1E001, 0x01A762CD, 0xD33408B0, 0x42DDCF5A }} },
+		{ .w32 = {{ 0xC478161E, 0xD908D89C, 0xBFBAD48A, 0x19F155C4,
+		            0x1FC045E5, 0x7F776955, 0x19F5879F, 0x10F03CF2 }} }
+	},
+	/* 2 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x0F5D57BA, 0xFEA075A7, 0xF3EFF86D, 0x3EFDD3C5,
+		            0x074C0C84, 0xD6D8FA58, 0x2B7DA0CB, 0x7F867CF4 }} },
+		{ .w32 = {{ 0x0E4FA612, 0xAC0F4B92, 0x90D39944, 0x47C58E9C,
+		            0xB9E97DBA, 0x9359947E, 0xC357E958, 0x43B86F34 }} }
+	},
+	/* 3 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x32400B23, 0x2B03F994, 0xE6440500, 0x6336FEC6,
+		            0x5D1C0F9E, 0x2482C74F, 0x3AD18E46, 0x7DD8B2D4 }} },
+		{ .w32 = {{ 0x0541EA8D, 0xA077DB77, 0xD2A83645, 0x2795DF80,
+		            0x941282EB, 0xD8476142, 0x0F907152, 0x3E69CC77 }} }
+	},
+	/* 4 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xA811B52A, 0xD1AD1DE1, 0x4EEF0633, 0x14AEF99B,
+		            0x9BB11455, 0x7BC1C4B9, 0x9D444CEE, 0x2AB88D63 }} },
+		{ .w32 = {{ 0x858299B5, 0x1C9B0BAB, 0xFE478293, 0x46CF3FB5,
+		            0x38C7EFA5, 0xD698CF24, 0x16123DC4, 0x40AD7985 }} }
+	},
+	/* 5 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xD9B44FA0, 0x336A8EFB, 0x7C8E9114, 0x6E4F30EF,
+		            0x4845B3E8, 0x20C93AF1, 0x42FDA9C7, 0x2C475CF1 }} },
+		{ .w32 = {{ 0x1CDF548D, 0x3CC23422, 0x6F926678, 0x3A455269,
+		            0x05C696FC, 0xCCFD5625, 0x54415804, 0x026F0956 }} }
+	},
+	/* 6 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x91BE834E, 0xC0D4F15C, 0xCB942B2D, 0x99F219CD,
+		            0x7FB950D6, 0x5BC617C0, 0x30D1288E, 0x51090B62 }} },
+		{ .w32 = {{ 0xB21F1349, 0xF236D5FD, 0x8F49FD15, 0x6F35C769,
+		            0xCB152E8B, 0x0029D35A, 0xA4BEC800, 0x761DB68F }} }
+	},
+	/* 7 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xE3D69CF2, 0xDA2F59FF, 0x62D4C1E9, 0xE9B1CD5A,
+		            0x965B8CEF, 0xBB618072, 0xD788A94D, 0x403E21A3 }} },
+		{ .w32 = {{ 0xA21C54AB, 0x239CD9C2, 0x9984A333, 0x9D141F84,
+		            0xE7E800E6, 0xDFC09257, 0xB6747E05, 0x45056174 }} }
+	},
+	/* 8 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xB73C6A73, 0x5F96EBDC, 0x3F3D8F28, 0x372F43F0,
+		            0x31E13770, 0x565E86AB, 0xB7437AAC, 0x53C15BCD }} },
+		{ .w32 = {{ 0xD14842D6, 0x61551332, 0x7CDC59B9, 0xE2A8F3A5,
+		            0x2F790E2C, 0xC4DB9110, 0x8B231398, 0x5707C8AA }} }
+	},
+	/* 9 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xF6AE81D2, 0xA1DA7F47, 0x47EEADE8, 0xA3BAE7F9,
+		            0x7BFDF38F, 0xFC53E2EE, 0x37A3838B, 0x4E194239 }} },
+		{ .w32 = {{ 0x7934ECE4, 0xDFB9C7B6, 0x799A44E8, 0x0744E01C,
+		            0x5EF49859, 0xA5F1F36A, 0x97359C2E, 0x4C478010 }} }
+	},
+	/* 10 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xF7876478, 0x4BDB091E, 0xF6FF5CBB, 0x5F773CE5,
+		            0x4C75CC1A, 0x306B223C, 0x11C549BC, 0x462D6572 }} },
+		{ .w32 = {{ 0x161DF721, 0x5F636712, 0xC39FC8BB, 0x774C23B9,
+		            0x95FBCC48, 0xA153509B, 0xEBA2532E, 0x3183D156 }} }
+	},
+	/* 11 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xF98F1A34, 0xCBB08FB2, 0x22D73DA9, 0x3D22488E,
+		            0xFB24E2BF, 0xD1AF575F, 0x4855E8F6, 0x3654FB7E }} },
+		{ .w32 = {{ 0x0F91D951, 0x624366A2, 0x1B3F4E03, 0xBA15BDAA,
+		            0x4F4D3398, 0xA2679EEB, 0x42A78B3A, 0x4C215A56 }} }
+	},
+	/* 12 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x7B1425FF, 0x9CC59110, 0xE1CED230, 0xB1BD116A,
+		            0x73A197C2, 0xE7E0C9E9, 0xA860A2C4, 0x26164093 }} },
+		{ .w32 = {{ 0x9CE814C1, 0x32C3371D, 0x013AC345, 0x49EA068F,
+		            0x5A9B1B73, 0xB8F29185, 0x64F0FB7E, 0x09B0B738 }} }
+	},
+	/* 13 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xEDDCB0D1, 0x1D9722A0, 0x778D4BD3, 0xDD6E85A8,
+		            0xEA6B05AA, 0xD9BAEF9D, 0x42EADD98, 0x748C244E }} },
+		{ .w32 = {{ 0x1AF385FA, 0x4EEE3DAB, 0x568D92EC, 0x9ABCA5B9,
+		            0xCE0D1698, 0xE3ED64FC, 0x8CD64C3F, 0x3D3D71B8 }} }
+	},
+	/* 14 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x5DFC2898, 0x477D6FD4, 0x935D95D1, 0x9E4E06F9,
+		            0xF10EB760, 0x437D57B4, 0x61413336, 0x20AE969E }} },
+		{ .w32 = {{ 0xE2D765C3, 0x6F2C41F3, 0x6B320A7D, 0x399968D9,
+		            0x0E5CDB31, 0xE01505C3, 0x42D5B495, 0x01A5D7A9 }} }
+	},
+	/* 15 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x2B8E64CF, 0x0E192053, 0x981E02F7, 0x3DB0812F,
+		            0xC765DD78, 0x17148870, 0xA9CE440A, 0x462DC80C }} },
+		{ .w32 = {{ 0xF21021EC, 0x6F3983F2, 0x9EE5AC83, 0x24B3E270,
+		            0x0DD28D42, 0xF0C37F24, 0x6D3B5F35, 0x25754C32 }} }
+	},
+	/* 16 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x6694277B, 0xA641245B, 0xF5FD757C, 0xDEC08E28,
+		            0xFE3A0575, 0x374AE489, 0x8763A5EF, 0x0D717749 }} },
+		{ .w32 = {{ 0x3762FBE7, 0xA0840628, 0x4A08CC62, 0x207C44A6,
+		            0xCD3A807B, 0x8D460B92, 0x89F71A17, 0x7014D47F }} }
+	},
+	/* 17 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x8BBCDCF3, 0xC6F8E895, 0x8CA01258, 0x4627C15A,
+		            0x9F818E7E, 0x682128D4, 0xCFFCE8F3, 0x1B88D714 }} },
+		{ .w32 = {{ 0xD968D37D, 0xC3264805, 0xDB8E8C28, 0x395C2169,
+		            0x77ACCDA0, 0x8CAC8E49, 0x96782C7F, 0x7B82EBE0 }} }
+	},
+	/* 18 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xA67B2A04, 0x0AB0A1AF, 0x1D03AB60, 0x8E9EA5D4,
+		            0xACF3B14C, 0x05E7B607, 0x723C1AFA, 0x119FD16D }} },
+		{ .w32 = {{ 0x51B37350, 0xCB5CFC94, 0xE4B28C73, 0xC7E3CEF8,
+		            0xF2DD3437, 0x259D0DDE, 0x98DC7509, 0x53DF72AB }} }
+	},
+	/* 19 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x1C0CE513, 0x5197259A, 0x670F0F83, 0xE5328BB7,
+		            0x75BF8C7F, 0x45A0FB70, 0x950FC2A9, 0x0BBDB038 }} },
+		{ .w32 = {{ 0xA8799FEA, 0xDCC615BB, 0xC038455D, 0x7C0EA8B7,
+		            0x574B1ABA, 0x128A68E0, 0x1C4CE7D1, 0x5522CCD5 }} }
+	},
+	/* 20 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x60A93464, 0xB08895B9, 0x66E9CDC9, 0x285AA5D7,
+		            0xA2EC9108, 0xD482F635, 0x8803E77A, 0x408A4838 }} },
+		{ .w32 = {{ 0x137E0AEE, 0x997A996A, 0x5C304904, 0xB10879AD,
+		            0xCD70E647, 0xB34B4AC6, 0x028C3462, 0x49C53AC0 }} }
+	},
+	/* 21 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xF93DA150, 0x5830BAE6, 0xFA7111B9, 0xE944E069,
+		            0xD5F39B50, 0xC2EA5C86, 0x13012E0F, 0x79C7F000 }} },
+		{ .w32 = {{ 0xBB00CDE1, 0x3686E201, 0xBFBC4254, 0x8385034E,
+		            0xDE8BD167, 0x9A9C8E38, 0x24B94D45, 0x0DB0106B }} }
+	},
+	/* 22 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x3C6A28C1, 0x2F22B0D3, 0xA8D33294, 0x0B8137BB,
+		            0xAB070EA1, 0xC868BB77, 0xD53147E2, 0x062A6C17 }} },
+		{ .w32 = {{ 0x080B05B5, 0x59C1A351, 0xCBD6C34E, 0xBC3332AC,
+		            0x549C7D9F, 0x2BA87CA0, 0x9B2664EB, 0x0380D95A }} }
+	},
+	/* 23 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x38C359E5, 0x46B16E9C, 0x27BB89DB, 0x59C57C7C,
+		            0xC00F6D68, 0xDBB59933, 0xAF3D4818, 0x4E9BB57A }} },
+		{ .w32 = {{ 0x10CA96E3, 0xD2E04BFF, 0x22C12CB4, 0xA6859CF8,
+		            0xAFDDB9DC, 0xEA7CC93B, 0x18C074FE, 0x36797D19 }} }
+	},
+	/* 24 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xC83753D8, 0x304A8B3E, 0x5AD77A92, 0x46224872,
+		            0xE5BA2AE8, 0xAEA2398B, 0xDCAD05D9, 0x2C9198B2 }} },
+		{ .w32 = {{ 0x250E3A27, 0x70EEDE88, 0x5BB452CF, 0x5687A470,
+		            0x0B1CA00F, 0x5C11A220, 0xB7349CDD, 0x1CC9E106 }} }
+	},
+	/* 25 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x6DD664A1, 0x36EABC39, 0xD617FE60, 0xA51240B9,
+		            0xAAFA5A71, 0x42988192, 0x6D4F776E, 0x6013E2DF }} },
+		{ .w32 = {{ 0xFC2AD0E1, 0x3A901171, 0xF869B3D2, 0xB0A6E9C7,
+		            0x8DED882A, 0xACB0E728, 0x535F0156, 0x1D84D41C }} }
+	},
+	/* 26 * 2^96 * G */
+	{
+		{ .w32 = {{ 0xE73601C6, 0x525A47BA, 0xE3C606A9, 0x5A177637,
+		            0xFF0E4E1C, 0x753732A1, 0x534431CE, 0x13D15435 }} },
+		{ .w32 = {{ 0x5A41C0D9, 0x41CDCB68, 0x5D44D673, 0x288CCA87,
+		            0x69F78626, 0xEB4CA8C2, 0x4DBECB8C, 0x029C5AB6 }} }
+	},
+	/* 27 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x99FFE1C5, 0x4A894FAA, 0xA51669C9, 0xE03D9D63,
+		            0x836FA3C8, 0xC735C43C, 0xEA5BB0CE, 0x6414B297 }} },
+		{ .w32 = {{ 0xC77A4475, 0x2374AFEF, 0x9FF73E4B, 0x5843F987,
+		            0x01AF10F9, 0x442E90D4, 0x64232CB0, 0x05131F64 }} }
+	},
+	/* 28 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x31E32D39, 0x823C6FAC, 0x89CA19B2, 0xBD09D7AD,
+		            0x1C6BEB0E, 0x01D3CBA8, 0x035D19AC, 0x5F33F416 }} },
+		{ .w32 = {{ 0x92C58894, 0x08A2BC5F, 0x28EE2BCC, 0xE0E44DC6,
+		            0x753A357F, 0xDA751356, 0xBE365AF9, 0x2165162B }} }
+	},
+	/* 29 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x3B25BCAE, 0xEE7F9C3F, 0x3AFCDAF1, 0x0654A62E,
+		            0xE7416790, 0x75EBFE45, 0xCCAC8243, 0x6C5D2906 }} },
+		{ .w32 = {{ 0x7674EF98, 0x1562763B, 0x91790670, 0xDE68C3D6,
+		            0x7E8EC878, 0x10A29985, 0xE07D2B46, 0x1D12AEB1 }} }
+	},
+	/* 30 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x66EAEF7A, 0x3A284632, 0xA0D81EC3, 0xA8AE31BD,
+		            0x016247CA, 0x7BEAE68B, 0x045071AC, 0x78F22FFD }} },
+		{ .w32 = {{ 0x123D4C85, 0x39BBD04B, 0xF8679BCC, 0x0392DDDA,
+		            0x10CC1889, 0x5B9FE31F, 0xA2A9350A, 0x7A81F167 }} }
+	},
+	/* 31 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x4C769663, 0x1EC2D599, 0x78BC71F8, 0x4DA0EB3E,
+		            0xFAC292C1, 0xBD842029, 0x9C3BFE30, 0x0AD5AAAD }} },
+		{ .w32 = {{ 0x62B23BCE, 0xF7C70CC7, 0x4861C188, 0x47D1185F,
+		            0x525B7359, 0xA3DB36A3, 0x3D6EBAAB, 0x4AB59D62 }} }
+	},
+	/* 32 * 2^96 * G */
+	{
+		{ .w32 = {{ 0x0425A76B, 0x4C9BD341, 0x4B4D0C87, 0x5CF87E4F,
+		            0x89E71857, 0x496752BB, 0x81C0C3E3, 0x280CE83F }} },
+		{ .w32 = {{ 0x3E4130E0, 0xB81331F4, 0x3D72420F, 0x2A2812FB,
+		            0xAA14A2CA, 0x4CB495BD, 0xA97A181E, 0x29E0DD7F }} }
+	},
+	/* 1 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xA517E6C9, 0x394C1BBC, 0xB366C8D6, 0xB7670313,
+		            0x3C46F9D9, 0x8CAAD14F, 0x9C6B0FDD, 0x389C8A07 }} },
+		{ .w32 = {{ 0xDCA70DA9, 0x91505ACC, 0x6EE77C6E, 0xB9DD9282,
+		            0xC28B2A72, 0x711AFB10, 0xEA508C25, 0x2257E117 }} }
+	},
+	/* 2 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x8880F6C7, 0x0FE8FCB0, 0x5C39815D, 0xD6BF19ED,
+		            0xB6AAF8E8, 0xC635E4F3, 0x814DCD5A, 0x3325DF85 }} },
+		{ .w32 = {{ 0x46288810, 0xE2785C2E, 0xF8220D09, 0xFF7E7287,
+		            0xBAA3FCE6, 0xE1E17B2E, 0x48E2009E, 0x08BCF437 }} }
+	},
+	/* 3 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xE412C8CA, 0xDC1B1C50, 0x04ECA45E, 0xBE531771,
+		            0x53D6F3B0, 0xD2A4257D, 0x8EBD5524, 0x53202813 }} },
+		{ .w32 = {{ 0xDCA4A180, 0x6E72070C, 0x15B59BD5, 0x3A54268A,
+		            0x5A189CB0, 0xF36361A4, 0xE88F1645, 0x0073AE5A }} }
+	},
+	/* 4 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x5CB1D6B6, 0x4C96CE1F, 0xD670EE40, 0x7F7C49E8,
+		            0xB69FD9F5, 0xB8F7CB6C, 0xFB1C22F8, 0x5C7C2BF7 }} },
+		{ .w32 = {{ 0x3164E70C, 0x587855DF, 0x7EAFFDB3, 0x7E889718,
+		            0x16FBDFC0, 0x75FAAC76, 0x1493D814, 0x466BA211 }} }
+	},
+	/* 5 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x4A2CAF5D, 0xEEDDC785, 0x3A2E8C47, 0x2EF37FA3,
+		            0x30242C1A, 0x16F4B7C7, 0x74801296, 0x7669D42A }} },
+		{ .w32 = {{ 0x9292548A, 0xDF2BCC28, 0x9400E227, 0xC7E9D934,
+		            0x282798D8, 0x929E16A8, 0x4E854CB5, 0x34620589 }} }
+	},
+	/* 6 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xF78D3D5C, 0x5B7B1DE0, 0x8F8004E2, 0xEFAF76FF,
+		            0xBFFDFB4E, 0xD77BD272, 0xA751E300, 0x017708DF }} },
+		{ .w32 = {{ 0x39E8AE4C, 0x4711710B, 0xEA867B61, 0x0E7C0DC5,
+		            0xF44F23BE, 0x24D783E3, 0xECDFC501, 0x65E60FB5 }} }
+	},
+	/* 7 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xF5DDBFBF, 0x62BB5E6C, 0xF37E63BB, 0xE3AEBBC3,
+		            0x9AD799F9, 0x0A5107C8, 0x6180DC0F, 0x25424471 }} },
+		{ .w32 = {{ 0x09C768E8, 0xCBBD975D, 0x1B6B6081, 0x86DDE76A,
+		            0x09F65FAE, 0x684B1735, 0x73FAE6C0, 0x7C538616 }} }
+	},
+	/* 8 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x158F8815, 0xBE1EAC42, 0xAEAB6F12, 0xD7F7B880,
+		            0x92A5A4D9, 0xAAA52A36, 0x485667CE, 0x2DB98420 }} },
+		{ .w32 = {{ 0x59AA2456, 0x4B9599DF, 0x517AC1F8, 0xD5F469FE,
+		            0x93341D10, 0xA9ABF434, 0x6A125B8D, 0x029B74DA }} }
+	},
+	/* 9 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xD54E0B64, 0xA07C473A, 0x4B8BD7C3, 0x42243D17,
+		            0xFAAD84B2, 0xA18F59AC, 0xED5C093C, 0x1C5A32F3 }} },
+		{ .w32 = {{ 0x0E7686A2, 0xCA6F39B3, 0xDB54BE07, 0xD3F68344,
+		            0xAAE63656, 0xEF53DE7D, 0x966C7CAA, 0x516E2A1E }} }
+	},
+	/* 10 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x56E1793A, 0x0D509553, 0xC47251A7, 0xC402B995,
+		            0x0D503F0C, 0x8A83379F, 0xBCB17453, 0x225C381A }} },
+		{ .w32 = {{ 0xFA44C902, 0xFC96F15A, 0xDB2744A4, 0x675978FC,
+		            0xEFE63396, 0x50928BBF, 0xCC3FD9A6, 0x510D770D }} }
+	},
+	/* 11 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xB89B185A, 0xC1275637, 0xE315591B, 0x14109920,
+		            0x6C7DCD1B, 0x3BCE6A02, 0x867B7C72, 0x58449E62 }} },
+		{ .w32 = {{ 0xB627A289, 0xE188C127, 0x1B2E0491, 0x378E9F59,
+		            0xCB626753, 0xBD5E0E37, 0x1799FB82, 0x283D4F93 }} }
+	},
+	/* 12 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xAE91F3F7, 0x9D2D6135, 0xAB3CC901, 0xA3B73CFA,
+		            0x0E20AB59, 0x9B2B0C73, 0xE880915C, 0x5ED9859A }} },
+		{ .w32 = {{ 0xC7D80762, 0xD3D1FDBA, 0x7798F9D3, 0x1BEBA2BC,
+		            0x19D3B58F, 0x745FF458, 0x4A4BAC4A, 0x5AA40FF2 }} }
+	},
+	/* 13 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xF3D51D59, 0xE4FD28BC, 0x759CAEC5, 0x02319FAC,
+		            0x49DAC865, 0x60B580BE, 0xC061E88D, 0x02EDC483 }} },
+		{ .w32 = {{ 0x1CDBCE07, 0xE8A98959, 0x526B41C0, 0xDD5BBF77,
+		            0xC05306B2, 0xE0B972FF, 0xB45A8921, 0x6BD989AA }} }
+	},
+	/* 14 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xF66F451F, 0x4ACF0CD5, 0x5667822A, 0x9F29C8AA,
+		            0xD295A46C, 0x33E4A067, 0xFAE6709F, 0x768136A9 }} },
+		{ .w32 = {{ 0x7A85C50D, 0xB91A8298, 0xF2700110, 0xE3BCFB11,
+		            0x3B8B9600, 0xA092B119, 0x8C232229, 0x56D1A8BC }} }
+	},
+	/* 15 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xD932A98D, 0x7F78014E, 0x5528F581, 0xD107C651,
+		            0x580FA562, 0x9361FB9F, 0x61F8CE47, 0x0395D1E2 }} },
+		{ .w32 = {{ 0x9425C607, 0x07FEE063, 0xCA876886, 0xB4E87B3B,
+		            0x92CDE6C4, 0xF2D40632, 0xB160A59C, 0x5B5045DF }} }
+	},
+	/* 16 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xC6483345, 0xB25AED1B, 0xBD0F4A8A, 0xD01EE014,
+		            0x78FFA3FE, 0xB899390B, 0xF611ECC4, 0x40BB4099 }} },
+		{ .w32 = {{ 0xA2102028, 0xEB8F6AC7, 0x6C6F4577, 0x1C32471C,
+		            0x8814C81F, 0x72A46B51, 0xBCB44073, 0x0443C365 }} }
+	},
+	/* 17 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x0CD89917, 0x281BD9B8, 0x16E45EDE, 0xAD008D0E,
+		            0x4ABD7F41, 0x8318E5B9, 0x2640286E, 0x45584BA2 }} },
+		{ .w32 = {{ 0x50F54495, 0x0F51EF4D, 0x3158009E, 0x21E56917,
+		            0xEDA42E78, 0x2A60090B, 0xCC932B65, 0x0B98DD65 }} }
+	},
+	/* 18 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x9D6F16F4, 0xDA6BEE7D, 0x6D55040E, 0xA8AF37BA,
+		            0x2D019B89, 0xCA698055, 0x4537F254, 0x15CA29B5 }} },
+		{ .w32 = {{ 0x20447123, 0x760E4B1F, 0x7DBA4C19, 0xA77F3A7C,
+		            0x34E020EF, 0xED6213DD, 0xB8F0E750, 0x27D3AE52 }} }
+	},
+	/* 19 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x95DF6DED, 0x02D822D8, 0x935FAEC1, 0xDAD06B08,
+		            0x1C34CAF8, 0x961061FC, 0xE351F71E, 0x5A333AA5 }} },
+		{ .w32 = {{ 0xC6ECFEAC, 0x1830C4DB, 0xEF5FA13B, 0x6DAC3CE0,
+		            0xC841AA21, 0x93390A20, 0x3E33D6BF, 0x71570348 }} }
+	},
+	/* 20 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x5D6AF6FF, 0xB7A4387B, 0x33D8B8DC, 0xDBED3875,
+		            0x043DC0D0, 0x464B29BA, 0x4691B60B, 0x42445502 }} },
+		{ .w32 = {{ 0xAE80D3D1, 0xA5617C0E, 0xC1A10121, 0x489CB43D,
+		            0xC187C2E9, 0x25F33AB1, 0xEFA70068, 0x4FF09D18 }} }
+	},
+	/* 21 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xC5B386E3, 0xE1BF9211, 0x48039CD7, 0xAFA91479,
+		            0x50A31197, 0x7A550B95, 0x25581BB8, 0x381FCAE1 }} },
+		{ .w32 = {{ 0xAF445B0C, 0xD9A36889, 0x189CC2E0, 0xFFAD34D3,
+		            0x42E65A6E, 0x007191D8, 0xCB2B7722, 0x15FB4FAC }} }
+	},
+	/* 22 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xB85B01FF, 0x79409196, 0x3F3B02BA, 0x484CCADC,
+		            0x25A1EC29, 0x73B82C0B, 0x944B8D3E, 0x42332348 }} },
+		{ .w32 = {{ 0x5226EE47, 0xAC537AE4, 0x56013B29, 0x2FC7371A,
+		            0x85702ECC, 0x8D0563C7, 0x0C930270, 0x21D3CB2A }} }
+	},
+	/* 23 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x8FCDA149, 0x49BEE67C, 0xBE24068B, 0x79F70797,
+		            0x1CE51AF4, 0xD3CEEDEF, 0xC844D202, 0x278F0D3D }} },
+		{ .w32 = {{ 0xD276EF07, 0xE34FE422, 0x94BF5B76, 0xB2890DA4,
+		            0xE9215499, 0xD660A365, 0xC32EB2D4, 0x7BF8D8CB }} }
+	},
+	/* 24 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x01D260F4, 0xDDBE3394, 0xF4E4C74C, 0x5F4446EF,
+		            0xAAE75BED, 0xDE5DA39B, 0xC12C1BFD, 0x52E03C6C }} },
+		{ .w32 = {{ 0x18AAB1C5, 0x4D0073C9, 0xF9F0A49E, 0x13718869,
+		            0x3ABF098A, 0x197FB5CB, 0xFA62EA69, 0x5797B3E2 }} }
+	},
+	/* 25 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xB297A867, 0x8BF34626, 0xD0F7496B, 0xA5316212,
+		            0x9AD501AE, 0x875950FA, 0xCFC57687, 0x0A711653 }} },
+		{ .w32 = {{ 0x843C7A11, 0xBB861226, 0x0E9EF16F, 0xD1295D5B,
+		            0x79C7F2BC, 0x63207AE2, 0xFEAB9B09, 0x39C1D0CA }} }
+	},
+	/* 26 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x195402A4, 0x6E6DBFA8, 0xAC65B945, 0xE6E7C82B,
+		            0x38680018, 0x5372D80D, 0x6DE29136, 0x719EE4E4 }} },
+		{ .w32 = {{ 0x8E037CAA, 0x01D1D1F8, 0x6B02A8F3, 0x867792BF,
+		            0x0D0A9DD3, 0x3E7423F6, 0xFBCBE111, 0x57ADBD61 }} }
+	},
+	/* 27 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xD6F53FB4, 0xF48F8E2E, 0xC010614B, 0xA8F369F7,
+		            0x9855AAB3, 0x3BA5AF1B, 0x9CF228AA, 0x3FB62961 }} },
+		{ .w32 = {{ 0xC7315497, 0xA6F516F4, 0xCB66DB66, 0x1E29BACA,
+		            0xD6134A8D, 0x60418675, 0xD9631F84, 0x29F6380F }} }
+	},
+	/* 28 * 2^120 * G */
+	{
+		{ .w32 = {{ 0xA4574385, 0x26F1F287, 0xDE96FBEA, 0x3E4EA8C2,
+		            0x4FFDAB52, 0x1012CEC1, 0xAE4009D5, 0x73C36A7E }} },
+		{ .w32 = {{ 0xD9587D69, 0xD41CC601, 0x5FEC05A9, 0x4BCC7D8C,
+		            0x0947076A, 0xFF71DE38, 0x42558330, 0x04D31683 }} }
+	},
+	/* 29 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x40A47E43, 0xF5A7E1FD, 0x93959C2F, 0xB8CCBB53,
+		            0xE484D5EC, 0x3325378C, 0x145067A6, 0x613826B5 }} },
+		{ .w32 = {{ 0xB0D8D2AD, 0x46B29007, 0x173009CF, 0xEF645D1D,
+		            0xCCA79A39, 0x3B9A44DE, 0x8B28DB13, 0x229993AF }} }
+	},
+	/* 30 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x1CE8F770, 0x3B4913DC, 0x95B090EC, 0xEB3BCF27,
+		            0xF7D5A160, 0x29F817E6, 0x5CFF786A, 0x00B7BADF }} },
+		{ .w32 = {{ 0xE95553B8, 0x9E3B6C7F, 0x7DA12DC0, 0x0A198409,
+		            0x2518C39A, 0xDB8B6313, 0x9BC1311A, 0x19ED954A }} }
+	},
+	/* 31 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x50C2AAB0, 0x67005D0C, 0xE3012BEA, 0x1BB9FE87,
+		            0x6BDC370E, 0xA19BCA11, 0xA0F4BA8E, 0x4CAAFEAB }} },
+		{ .w32 = {{ 0xD9DB90C6, 0xD03BA30F, 0x0BDF3D68, 0x1A60740B,
+		            0xF9ACF70D, 0x9DF2CA8D, 0x054BBB33, 0x4F329975 }} }
+	},
+	/* 32 * 2^120 * G */
+	{
+		{ .w32 = {{ 0x74A8900F, 0xB063D630, 0x1CF44A74, 0x336C8B99,
+		            0x0756F734, 0x7BADC9B5, 0x1EBC1074, 0x02A4185A }} },
+		{ .w32 = {{ 0xC1DA4B40, 0xE44CB5A6, 0x9AFCE2A1, 0x865B16BE,
+		            0x9B03F080, 0x23BA2D3B, 0x6993095E, 0x23358624 }} }
+	},
+	/* 1 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xBE54BA87, 0x1B929B28, 0x686D67D1, 0xB5532554,
+		            0x2F61DC2A, 0xAFC561EE, 0x853B7BD8, 0x63785DC1 }} },
+		{ .w32 = {{ 0xEF0A158E, 0x2F1D7667, 0x11B0589A, 0x629D3566,
+		            0x4C12DA8D, 0xC4BA2225, 0x986BBBE9, 0x72F35314 }} }
+	},
+	/* 2 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x8CE0774D, 0x292F4E28, 0x2055B384, 0xD0ECB551,
+		            0xAEB63D8D, 0x7BB080FE, 0xD001565C, 0x4C8AA048 }} },
+		{ .w32 = {{ 0x2F7EE4CC, 0xAEDFAAEB, 0xBA77E9EA, 0x1AF56238,
+		            0x63D7A41E, 0xDA2BB89E, 0xC118468F, 0x2FBC307C }} }
+	},
+	/* 3 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x80A75AF8, 0x5E13286E, 0x29231F6E, 0x34242D38,
+		            0x4CD17F56, 0x30B5D248, 0x73D1C6F3, 0x25CC1257 }} },
+		{ .w32 = {{ 0x0CD20C90, 0xD20844E0, 0xE0A19D30, 0xC8F9FE6F,
+		            0x73467BDD, 0xB5AF0E01, 0xB4C6E83A, 0x559BC25B }} }
+	},
+	/* 4 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x5B0C36B0, 0xB0910390, 0xD4A689BA, 0x77A87643,
+		            0x2B3F9E5D, 0x83BBBE76, 0x08A71A03, 0x1D48E6D2 }} },
+		{ .w32 = {{ 0x9C259085, 0xE4F1D581, 0x6D7C347B, 0xB4536F48,
+		            0x96195768, 0x8A72DD70, 0xE094DA1B, 0x6DF408A3 }} }
+	},
+	/* 5 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xC5766975, 0x47AF20F4, 0xDBCE6089, 0x029D76ED,
+		            0xFAFE0D46, 0x81D91A39, 0x8B8E34E8, 0x3787532F }} },
+		{ .w32 = {{ 0x4551BF5B, 0xFE4C507D, 0x4DB1DCA3, 0xA7D87D3C,
+		            0x5EF0AE0B, 0x237BDA15, 0x1B2CD7E4, 0x62D10C2B }} }
+	},
+	/* 6 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xD6DC715E, 0x38F21FE3, 0x0871A0EA, 0xBC1A95B2,
+		            0xC6B6D9A3, 0x8D0B0B35, 0xB61E382D, 0x7A2EFFC0 }} },
+		{ .w32 = {{ 0x888FE2EE, 0xC571B7B2, 0x4796519C, 0x33AD2538,
+		            0x1A68F1A3, 0xB1BCD1F1, 0x68FE6058, 0x4547CE03 }} }
+	},
+	/* 7 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x6255E73D, 0x6C9F86BA, 0x5F31EAE4, 0xD8F15995,
+		            0x962E4A1A, 0x55B3B7CC, 0x5577B6D6, 0x7A7BAE99 }} },
+		{ .w32 = {{ 0x4C70B659, 0xF1DEE61F, 0x5CB58AF5, 0xA40D98CF,
+		            0xC58170E6, 0x747AAC86, 0x732281D6, 0x59C113B6 }} }
+	},
+	/* 8 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x9F7A9615, 0xB9ED7247, 0xFE284B4E, 0x570A9B97,
+		            0x41976A22, 0x158FF53F, 0x9609E8DE, 0x2E1A7120 }} },
+		{ .w32 = {{ 0xFA07747F, 0x1214A8E4, 0x5515735F, 0x8779918F,
+		            0x281683E8, 0x587604E7, 0x4807D08F, 0x4B1AA450 }} }
+	},
+	/* 9 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x4778639D, 0xD25BBF9B, 0x0AD92B7E, 0x4AD475D9,
+		            0x27661724, 0x7584109B, 0x32243A74, 0x4BCA1215 }} },
+		{ .w32 = {{ 0x22A00BFE, 0xCF95B115, 0x6EE317FA, 0x213D28A1,
+		            0x156EB288, 0xE560857F, 0x23A7ABC1, 0x7B5E4580 }} }
+	},
+	/* 10 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x3E9610F5, 0xD9B67902, 0xDB7AEAD5, 0xFCECAE97,
+		            0xC420C1FA, 0x2F1BF2BD, 0x8C1E57B0, 0x69DEAD08 }} },
+		{ .w32 = {{ 0xF2F19615, 0x8B937BDF, 0xACDD7E7A, 0x48C42892,
+		            0xDCC3F881, 0x4CC1E8B3, 0xC4C1B482, 0x43B3DA8C }} }
+	},
+	/* 11 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x13051CCF, 0x1EFF0A2B, 0xAD4943BB, 0x64D45CBE,
+		            0xC633686D, 0x7A102957, 0x0E7D2077, 0x0ACC5C86 }} },
+		{ .w32 = {{ 0xA4C21DE1, 0x92725BF0, 0x85C41DDC, 0x0F76CA9B,
+		            0x6F7CF57D, 0xA1737869, 0xC77E4501, 0x10A67D84 }} }
+	},
+	/* 12 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xE27E60CD, 0x349A62A5, 0x01EA2A0D, 0xEB5A5529,
+		            0xEB593633, 0x5AAA0941, 0x27FDAF1A, 0x4A693D83 }} },
+		{ .w32 = {{ 0xE08C03A8, 0xA650190E, 0xE90F0401, 0x6E80D5AB,
+		            0x7828CC0E, 0x59F0A999, 0x2DA0F40E, 0x29275705 }} }
+	},
+	/* 13 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x4FCBA163, 0x13B3078A, 0xF7DA101B, 0x2F614F79,
+		            0x86566AB0, 0x01A21466, 0x310ED587, 0x011248B5 }} },
+		{ .w32 = {{ 0x5BA5F484, 0x2CA8D6AD, 0x0DA0B863, 0xA96F5103,
+		            0xEF46E9BE, 0xF5FCA961, 0x8BF8EDF4, 0x2632A7D0 }} }
+	},
+	/* 14 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x932B3BA1, 0x2B4373CE, 0xFAF693EA, 0xDA08D238,
+		            0x5FA64FA1, 0x9B4DE87B, 0xF2339C8C, 0x646F91FC }} },
+		{ .w32 = {{ 0x94C3CBA9, 0x025A6E25, 0x1F9A6C84, 0x35FFF3C7,
+		            0xE3AC63C2, 0xE64D678A, 0x27630CAC, 0x2500D7F6 }} }
+	},
+	/* 15 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xE34E1C24, 0xF3712D3A, 0x7470AC9A, 0xA99EB98D,
+		            0x16C33EFD, 0x43E8FB88, 0x89106062, 0x4356844D }} },
+		{ .w32 = {{ 0x079F1478, 0xE89D96EB, 0x3E77C6B9, 0x34C148F7,
+		            0xB5B3C1CA, 0x3766D88C, 0x254E80A5, 0x3241815D }} }
+	},
+	/* 16 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x83874A85, 0x55600458, 0xADE174BC, 0x87727FC8,
+		            0xCC3F2DAA, 0x780409E2, 0x078F2142, 0x7B62D056 }} },
+		{ .w32 = {{ 0x38B0A1A1, 0x3991C176, 0xFC3B09EB, 0xFF32B2E1,
+		            0x916C39C4, 0x59D5E45D, 0x472BB416, 0x695A314E }} }
+	},
+	/* 17 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xD704D128, 0x84485564, 0xB16873B2, 0x8FF5CDEF,
+		            0xF136A8C5, 0x0ECF9E60, 0x81A51077, 0x7CC8FCDF }} },
+		{ .w32 = {{ 0x1037A31A, 0x89BEA6DA, 0x7C62EDC3, 0x92D6991E,
+		            0xE53EFE24, 0xE2672633, 0x84C7CC77, 0x690EA6BF }} }
+	},
+	/* 18 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x709B8149, 0x1022DCC0, 0x28217102, 0xD5712661,
+		            0x62B76A54, 0x3367C6ED, 0x959B2CD1, 0x4CDB5C05 }} },
+		{ .w32 = {{ 0x5282A018, 0xC537DA2F, 0xED461C01, 0x364A6D0E,
+		            0x05D87007, 0xD8927810, 0xD6D227E0, 0x70851A7E }} }
+	},
+	/* 19 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x9184A70B, 0xF3DACA96, 0x9E74B439, 0x1041EBC4,
+		            0x85CF5025, 0xA6EC3E8C, 0xBE0FF293, 0x42C3D38D }} },
+		{ .w32 = {{ 0xA39B70F1, 0x7AB04BFE, 0xF6EEC0AF, 0xDDCF8FC7,
+		            0x39A4C124, 0x0CC79490, 0x2C39F943, 0x687EF3B4 }} }
+	},
+	/* 20 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x56DBBDEE, 0xA3CB82CC, 0x55547ABF, 0xE743F9FC,
+		            0xFEB4F058, 0xF2F525E6, 0x82F77630, 0x2E311D20 }} },
+		{ .w32 = {{ 0x40C6E5EC, 0x330A9DF3, 0x8394ACA2, 0x3BB7E9B0,
+		            0x088B98DF, 0x9219DA99, 0xD538EB2F, 0x7CE2DFB6 }} }
+	},
+	/* 21 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x50373879, 0x72F85656, 0x35C85B03, 0x7A5B3E17,
+		            0x6FF557DA, 0xCF978C2D, 0xD9240D59, 0x1E4CD9CC }} },
+		{ .w32 = {{ 0xDDC38A7D, 0x83099082, 0x1DBA34C0, 0x32B04126,
+		            0xFDAC6DA5, 0x59CD6889, 0xB5984376, 0x573A6C36 }} }
+	},
+	/* 22 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x9D498730, 0xD3E5693B, 0x10D28810, 0xE1050CB5,
+		            0x2CDF5E50, 0xD38214DF, 0x726104B2, 0x3C656B76 }} },
+		{ .w32 = {{ 0xF69A2813, 0x745A28D3, 0xD21370C6, 0xAA5FB050,
+		            0x706E5995, 0xDD5A3424, 0xE991636D, 0x3127BED9 }} }
+	},
+	/* 23 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xEA599814, 0x743A221B, 0x5C8CE879, 0x48D76331,
+		            0x95F80AB2, 0x9DFFD99A, 0xD6FBE6A4, 0x1760DB04 }} },
+		{ .w32 = {{ 0x1767A280, 0x2EFA103A, 0x09DFF598, 0xCAFB53FA,
+		            0xAFB23990, 0x7E35A1E2, 0xC3EA8450, 0x30F33E7A }} }
+	},
+	/* 24 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xD20E3307, 0x300A440B, 0x0A7745A9, 0x95AF8A54,
+		            0xA18E5B22, 0x0BA8FB4D, 0x764D43D5, 0x792EF886 }} },
+		{ .w32 = {{ 0xB169F0C3, 0x1512693D, 0xF1F0A840, 0xD6393E21,
+		            0x96B3CEAA, 0x98038181, 0x3F3C10B5, 0x031EE78A }} }
+	},
+	/* 25 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xA0BEB56A, 0xA570C9C4, 0x01A16D97, 0x6BB9FA81,
+		            0x3445E52C, 0x3EC87ADE, 0x16607F90, 0x6F2055D8 }} },
+		{ .w32 = {{ 0x45E5674B, 0xAC036B30, 0x3FDEDAB8, 0x2B78445C,
+		            0x4DF8E6FB, 0x09196C81, 0xFE5046AE, 0x2D09B410 }} }
+	},
+	/* 26 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x988A283F, 0xFBF511AE, 0xD61009C7, 0x09150120,
+		            0x9A79AEC6, 0x65F08E08, 0xE1955046, 0x45D09185 }} },
+		{ .w32 = {{ 0xC8DCC08E, 0x2DFF012D, 0x58F335B4, 0xB54145BC,
+		            0x9F6E75A3, 0x9A85654D, 0x07D64868, 0x10000A22 }} }
+	},
+	/* 27 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xE4B172A8, 0x5697609D, 0x0681F430, 0x1957C2B4,
+		            0xD3381D1D, 0x530C0205, 0xE0020B05, 0x1D3C71D6 }} },
+		{ .w32 = {{ 0x981006DC, 0x5DAE6A62, 0xED6CEAC2, 0xC83476C7,
+		            0x15634CEC, 0x794662EB, 0xDB00BE29, 0x306FD7CC }} }
+	},
+	/* 28 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x6C7F539C, 0x1DDCA0A1, 0x4BCFAAFB, 0x9775307C,
+		            0x767DBF1F, 0xC9DB1400, 0x7B59FF59, 0x41D3B3BA }} },
+		{ .w32 = {{ 0xE4AB6BCC, 0x4754F23A, 0x3CA16EFC, 0x625C874C,
+		            0x428F15D6, 0x5E1A5448, 0x5EEF5C02, 0x25250571 }} }
+	},
+	/* 29 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xE48247CD, 0xD485C9B2, 0xCEFA6F98, 0x43119287,
+		            0xC1612626, 0x9BFE3604, 0xB08084DC, 0x0C433B3D }} },
+		{ .w32 = {{ 0x6FE262E3, 0x7A5B266C, 0xAC2397F0, 0x95EEEA67,
+		            0x6545DBD8, 0xD772B91E, 0xB0DD5F18, 0x2CC85F14 }} }
+	},
+	/* 30 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xA7CFC4FE, 0x0B0FCF92, 0x96461202, 0x819F14BC,
+		            0x672FCD95, 0x4E2CED43, 0x39714D54, 0x0479ADE0 }} },
+		{ .w32 = {{ 0x907C37A5, 0xE43A96CA, 0x4E6BFBD0, 0x87B06F83,
+		            0x85BFE347, 0x10643903, 0x16C470F9, 0x10CCFFBD }} }
+	},
+	/* 31 * 2^144 * G */
+	{
+		{ .w32 = {{ 0x66D90D25, 0xE2907547, 0x55249064, 0x7D843978,
+		            0xFC2E278D, 0xFDC8026D, 0x55FBF020, 0x2A9D4FA8 }} },
+		{ .w32 = {{ 0xEEB8BA65, 0x5FF697E9, 0x33ED0B91, 0xA8B51271,
+		            0x877D5AF1, 0x849163C5, 0xEEE13F55, 0x72282CD7 }} }
+	},
+	/* 32 * 2^144 * G */
+	{
+		{ .w32 = {{ 0xD8508073, 0xF6158FE5, 0x5990BB0E, 0xB108FBE3,
+		            0x95CE9F5F, 0x78505C6E, 0x92FEA506, 0x0036D6A6 }} },
+		{ .w32 = {{ 0xCB4F777D, 0x2F416179, 0x665D0DFB, 0xC1422DDC,
+		            0xBC28980B, 0xC10F720B, 0x200BE76D, 0x61B53B8A }} }
+	},
+	/* 1 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x2C3A05FF, 0x9F833D87, 0xA8856215, 0x729C18FE,
+		            0xD2F3ACCC, 0xC3097AD6, 0x1929D530, 0x3BC12A7D }} },
+		{ .w32 = {{ 0xCC771507, 0xFC2B8475, 0x14D9EB6F, 0x2CB43D8D,
+		            0x6EB07965, 0xB29D395E, 0x8E8E5E00, 0x0DB1BAEA }} }
+	},
+	/* 2 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x69C6AF81, 0xF125BBD2, 0x08D8E3C5, 0x481926E0,
+		            0xDA0E1AB5, 0xB496FBAD, 0x3990FDCD, 0x1EE8248B }} },
+		{ .w32 = {{ 0x395B6770, 0x6E8E784A, 0xF8998D7D, 0xE9682E86,
+		            0x2A39D58B, 0x1537C85E, 0x6ED3FF71, 0x6FA882A8 }} }
+	},
+	/* 3 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xD8F93AF4, 0xAF850DA1, 0x198DA385, 0xD57CAF9F,
+		            0x741A81BD, 0x709BAFAF, 0x6059B9AE, 0x243C1FCD }} },
+		{ .w32 = {{ 0x5898F5B1, 0x9ADB518E, 0xBFA39ABD, 0x558382EF,
+		            0x9F57368B, 0xECB928BE, 0xF748B28A, 0x5A383DEF }} }
+	},
+	/* 4 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x2169AF23, 0x8CE13EBA, 0x4F7F82DD, 0x6495CFC4,
+		            0x9E91ED96, 0x26FDB8E2, 0xADB18566, 0x4F14875B }} },
+		{ .w32 = {{ 0x958D0BE7, 0x4519B27F, 0xE672BE2C, 0x7B9C6FAF,
+		            0x53D59FE8, 0x604C7B9D, 0xF974F0AE, 0x486805AD }} }
+	},
+	/* 5 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xF02B5990, 0xBB6BB564, 0x7F3A3F59, 0x1A99177C,
+		            0xC65AE80F, 0xB92A068A, 0x65A5BA0E, 0x1F9E8C1C }} },
+		{ .w32 = {{ 0x1FE2A1DF, 0x6FEF1416, 0xA1A45497, 0xA414D0A6,
+		            0x03BFDEDB, 0x5EE14D07, 0x3431E24A, 0x56444E88 }} }
+	},
+	/* 6 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x925495EA, 0xB8049469, 0x3DE1F7DB, 0x3E4D55FF,
+		            0xC222A558, 0xF555B1F5, 0x44F0555E, 0x08427468 }} },
+		{ .w32 = {{ 0x6AE60AB6, 0xA5E9E48A, 0x204B8E0B, 0xFCE9B9C1,
+		            0x5B8ACEF7, 0xC8BD3349, 0x7B5AB750, 0x318A003D }} }
+	},
+	/* 7 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x6F26BE51, 0x1A739ED0, 0xBCC12528, 0xD12FB0BE,
+		            0x7D17D043, 0x400E7880, 0x43BD80D9, 0x2B3F4169 }} },
+		{ .w32 = {{ 0xE741BA39, 0xA7C3F996, 0xC75716AD, 0x4607A905,
+		            0x620FF0A6, 0x26C577FB, 0x686C69FD, 0x3D16ECA8 }} }
+	},
+	/* 8 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x8CE0DEC5, 0xD40F5370, 0x720B43CD, 0x0B03B658,
+		            0x6BD37CC1, 0xCD34C122, 0xB6224C6A, 0x0152393C }} },
+		{ .w32 = {{ 0xFF2D9C63, 0x628FC45D, 0xE2B5244E, 0x03913E4A,
+		            0x647ADB81, 0xB94E070D, 0x73BA4345, 0x4C6CA261 }} }
+	},
+	/* 9 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x0F6FE9F3, 0x5C956594, 0x2E5A254E, 0xC2E603F4,
+		            0xDC496034, 0x2E4CD40A, 0x73644FDB, 0x34EDCAA3 }} },
+		{ .w32 = {{ 0x53836838, 0x3A519602, 0x661D0A78, 0x79C53191,
+		            0x4BDD1A7E, 0xE9CBBFF4, 0x2C8F8408, 0x6A21F92F }} }
+	},
+	/* 10 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xCD3E877B, 0xB35467E1, 0xE63BA9C1, 0xFF4A5171,
+		            0x589457F9, 0x0D1E8913, 0x89B0A4F3, 0x7DEBF2DD }} },
+		{ .w32 = {{ 0x8AFB1E1D, 0x973F1012, 0xEEF8A5B3, 0xAEDEA859,
+		            0x5C0D64EE, 0x541DA8BA, 0x1B448979, 0x5BEFCAB3 }} }
+	},
+	/* 11 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xCEE380B1, 0x20DE7138, 0x4BA9601A, 0xEB5CFE07,
+		            0xE955F866, 0x9208A305, 0x9C2D102F, 0x28DB5F7C }} },
+		{ .w32 = {{ 0x6DB1E990, 0x66F35D91, 0x65A118B3, 0xFE997C9F,
+		            0xB6124879, 0x7B08D003, 0x17EE3EEE, 0x1A0623F5 }} }
+	},
+	/* 12 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xE9396F84, 0x42C528B7, 0xA3CFA995, 0xE43FF49F,
+		            0xD547B948, 0x1D4546DE, 0x966B6674, 0x6AD73524 }} },
+		{ .w32 = {{ 0xA249E448, 0x00677A2C, 0x0AE766C8, 0x4B09D6B9,
+		            0xA66C87E5, 0x636AE3A5, 0xF1FEC777, 0x62703C4F }} }
+	},
+	/* 13 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xC9D33D31, 0x98DAC415, 0x2E5F432D, 0xE46616E9,
+		            0x739E130A, 0xF72891A0, 0xBC64B76C, 0x1C04F2E3 }} },
+		{ .w32 = {{ 0xC9776E7E, 0x3ECC1051, 0x89624CD9, 0x03AA15CE,
+		            0x3FE0F6B1, 0x040B9D04, 0x942F6B60, 0x327E7D21 }} }
+	},
+	/* 14 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xBBB87D43, 0x9BCFC177, 0xC27C1191, 0xFB7170A9,
+		            0xEAA2649E, 0x093D4516, 0x6D1D1FD4, 0x67AAFCF9 }} },
+		{ .w32 = {{ 0x02CC2202, 0xE2CA6567, 0x609A56D5, 0x3896A737,
+		            0x5B8AC439, 0x3A3A07CB, 0x70207BEB, 0x0FB54D1E }} }
+	},
+	/* 15 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xDC7E0166, 0x9C75B0AA, 0xE3426D4A, 0x1502DAA6,
+		            0xD2B11A74, 0xC37668AA, 0x0AF03A1D, 0x109157BC }} },
+		{ .w32 = {{ 0xA73C5FC6, 0xD352310E, 0xEF1730C2, 0xC3038845,
+		            0x25CC4DE6, 0x7D4B8962, 0x1C78EA39, 0x6641C4A6 }} }
+	},
+	/* 16 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x8BE37454, 0x70C1A59C, 0x5396B3E2, 0x50789523,
+		            0x6FD7DBF2, 0x4E304A63, 0x94A17A24, 0x7300E857 }} },
+		{ .w32 = {{ 0x7A173BCF, 0xBD0C72D5, 0x1548E0DD, 0x258901F8,
+		            0xB237E6B6, 0xFD237DA4, 0x5D9C5F36, 0x65542B8D }} }
+	},
+	/* 17 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x7C830894, 0xE3F4F937, 0xD2A48841, 0xA60E90A1,
+		            0x77BA3EFA, 0xF6CDDE92, 0x67CCF083, 0x4E021029 }} },
+		{ .w32 = {{ 0x2D430842, 0x3658E860, 0x2541EA5B, 0x3B076CD3,
+		            0xAE825679, 0x4D9BBE7E, 0xADF35200, 0x7D5524CD }} }
+	},
+	/* 18 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x15508DA2, 0x7D84FFE5, 0xD0DA7428, 0x39786096,
+		            0xB2785873, 0x4ED3BD37, 0x8E945271, 0x4A522707 }} },
+		{ .w32 = {{ 0xF34DCA55, 0xEE229537, 0xEEEEE951, 0xB966F5D7,
+		            0xAF3AA301, 0x57F4DE74, 0x4E5DFDA6, 0x16D586CC }} }
+	},
+	/* 19 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x0E2C61F4, 0xBD4CF631, 0xDE941274, 0xE10A5937,
+		            0xFB474AB3, 0xC7FD84A9, 0xB8DFAB67, 0x3704515E }} },
+		{ .w32 = {{ 0xE182D12A, 0x2B8364C0, 0x35E6B884, 0xE3259706,
+		            0x61C88463, 0x6C92EB35, 0x26BD3D18, 0x3085043E }} }
+	},
+	/* 20 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x996A4194, 0xC7E9CCDC, 0xF96D1495, 0x3242908A,
+		            0x3A4DD22E, 0x2DAB5123, 0x3B967025, 0x78F3910E }} },
+		{ .w32 = {{ 0xCE336884, 0x75CFEEE5, 0x92044409, 0x6CF6D3DC,
+		            0xAC6CB6ED, 0x8974618D, 0xC6DAF57D, 0x65C65761 }} }
+	},
+	/* 21 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x6A68A65A, 0xA9EC4DFA, 0x5B07F708, 0x0857BED5,
+		            0xD6D05FC4, 0x78B029D2, 0x86828022, 0x469AD86E }} },
+		{ .w32 = {{ 0x5043158A, 0xDF76BEE8, 0xDB50BEF6, 0x6EAA0C48,
+		            0x6969EF4E, 0x98F32D13, 0xAA3825E1, 0x2B60D70A }} }
+	},
+	/* 22 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xD6F56C76, 0x88009303, 0xFA4242C7, 0x42848816,
+		            0xD2318914, 0xE9B903F5, 0x11E80C96, 0x511D250B }} },
+		{ .w32 = {{ 0x6332B274, 0x6A915DB0, 0x6FF21BBA, 0x9A640553,
+		            0x667097AD, 0xB04222D5, 0xDB71E7DB, 0x0EA49617 }} }
+	},
+	/* 23 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xEB3C80D4, 0x38BEEC00, 0xB34C98AB, 0xC40F8F18,
+		            0xA35E0A28, 0x5DDCB118, 0x2460C6D7, 0x49092CE9 }} },
+		{ .w32 = {{ 0x47C8FD1F, 0x914628FD, 0x98EB4D8F, 0x29821BBA,
+		            0x07A0BA38, 0x90AD97D9, 0x75E85679, 0x46C59B12 }} }
+	},
+	/* 24 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x4399AE98, 0xCD7382B9, 0x8A01E632, 0x77DEAE6B,
+		            0x27EAF9AB, 0x6F6FF860, 0xC27DF59F, 0x006F270A }} },
+		{ .w32 = {{ 0x9728EDDF, 0xEF7AB469, 0x09210327, 0x2BC7A9B4,
+		            0x681E33C3, 0xDF44C540, 0x546BA848, 0x72A52B35 }} }
+	},
+	/* 25 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x77B6A0BA, 0x8946DB07, 0xB8865A0F, 0xEE0EE925,
+		            0x4307804A, 0x6D9FF1F9, 0x85BF4ECF, 0x542BB9A1 }} },
+		{ .w32 = {{ 0xC80B54C1, 0x21BE5196, 0xC965EFF3, 0x8C9445DC,
+		            0xE111E9BF, 0x8009F9B9, 0x808F0BEB, 0x6C758B51 }} }
+	},
+	/* 26 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xE4AADBE0, 0xA7BAFEE2, 0xA4EF50CD, 0x7DD7D847,
+		            0xD8214A96, 0x8E3D13E0, 0x8AD6D743, 0x53A1C12F }} },
+		{ .w32 = {{ 0xF670DBD3, 0x3DB164B6, 0x1E5D37F6, 0xEE54ECF0,
+		            0xB73A03E7, 0x5330239F, 0x00FA7BAD, 0x0BDD74DC }} }
+	},
+	/* 27 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xF3B4F250, 0x46E5EC28, 0x6EA71973, 0xC9BFA535,
+		            0xB7B21468, 0xDC5E79D0, 0x09B0F1C8, 0x5F36CF94 }} },
+		{ .w32 = {{ 0x43EDF93D, 0xEBD75644, 0x3D551AC2, 0x9CF856FC,
+		            0x45560630, 0x26F5DE96, 0xDD59B312, 0x2DB6E66A }} }
+	},
+	/* 28 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xC23B10EC, 0x5CECF93D, 0xB6510E5F, 0xB2D6033B,
+		            0x8DB4366A, 0xEF2F34D2, 0x902D3D6C, 0x7AF890FF }} },
+		{ .w32 = {{ 0xF6D6E7E7, 0xACF7918A, 0x23DAAACF, 0xBC82E4DB,
+		            0xAB1B690B, 0x4AA8C353, 0x872E8B42, 0x69A60501 }} }
+	},
+	/* 29 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x362B85A3, 0xF143DE69, 0xB1CFB437, 0x5364AF84,
+		            0x2A72D399, 0xB76A0756, 0x49797CE2, 0x1D2D82DB }} },
+		{ .w32 = {{ 0xC47A4967, 0x0F46BE6B, 0x50AEB289, 0x326B34A2,
+		            0xD99309D3, 0x47ED2A3D, 0xD2481662, 0x3665261B }} }
+	},
+	/* 30 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x729240DC, 0xC083BFBE, 0x8D1C9582, 0x3B9470FF,
+		            0x5B51CDE1, 0xDA7C0FD7, 0x66F39648, 0x630D72EE }} },
+		{ .w32 = {{ 0x29E5BCDF, 0x4CAEFB54, 0x1F53AE67, 0x79B1D671,
+		            0xEA6CA6FB, 0xF1A263E6, 0x63BF748E, 0x77B463D4 }} }
+	},
+	/* 31 * 2^168 * G */
+	{
+		{ .w32 = {{ 0x4D2C8EB0, 0x3FA96E8C, 0xE3122176, 0xF2839EB6,
+		            0xA10A460E, 0xA5F5B0F1, 0xA678EA97, 0x194C57B2 }} },
+		{ .w32 = {{ 0xB9D71BDD, 0x792E3D61, 0x5C43638C, 0xABDC175B,
+		            0xCCBA1110, 0x717FF89E, 0x4CD0EF1D, 0x19C32407 }} }
+	},
+	/* 32 * 2^168 * G */
+	{
+		{ .w32 = {{ 0xA656C8E7, 0xF09A6271, 0x38F0E876, 0xE988D4BC,
+		            0x46DD4608, 0x28743D8B, 0xFDB5E51F, 0x247AC235 }} },
+		{ .w32 = {{ 0xB854F4E7, 0xF8680FA0, 0x201E97CE, 0x2A2AFC69,
+		            0xACC12438, 0xF7208A71, 0xA5F04456, 0x210545BB }} }
+	},
+	/* 1 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x0A435303, 0x25E4F86C, 0x2C92D6F9, 0xFB1350AF,
+		            0xA9209A23, 0xBB42CF3A, 0x3FE7D419, 0x5CA75997 }} },
+		{ .w32 = {{ 0xDB95C9B1, 0xDB63AE7E, 0x624E03F1, 0xADFC025C,
+		            0x752FDD08, 0x08185CED, 0xFF3B79C9, 0x5DB3D29A }} }
+	},
+	/* 2 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xAEDC3F8C, 0x9A53A899, 0x898348F7, 0xAF074A24,
+		            0x90D94DED, 0x90B71D2F, 0xF702F9AA, 0x4A7E9271 }} },
+		{ .w32 = {{ 0xA64D45B7, 0x6E055713, 0x14F85099, 0x8052CB7C,
+		            0x86425CD2, 0xB63BB7F8, 0x6BF10114, 0x35451641 }} }
+	},
+	/* 3 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x37DC3DE4, 0xB67F7ABB, 0x929F1AD1, 0x18FA3503,
+		            0x569E43DA, 0x925D2711, 0x09D1C53B, 0x7A1B7478 }} },
+		{ .w32 = {{ 0xB121D266, 0x6A6BAD93, 0xE45B328B, 0x8D5B43DA,
+		            0x37AB40DE, 0xA0D5F082, 0xEE791C15, 0x58CDFB5C }} }
+	},
+	/* 4 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x80BC554A, 0xB202F9EA, 0x1B4F5DBC, 0x582E9CC2,
+		            0xEAB2F0CE, 0x35C48881, 0xDC57D3A5, 0x7B6750B1 }} },
+		{ .w32 = {{ 0x3158C2D5, 0x50AA49C4, 0x7B85FDBF, 0x38FE415E,
+		            0x7A7DD9BE, 0x0E7883AF, 0x5D0B9459, 0x69B8E78D }} }
+	},
+	/* 5 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x51B600E4, 0xDDF898D1, 0xCB1749C1, 0xDEBA13EF,
+		            0xD36CEA4A, 0x958A72DF, 0x26B50975, 0x16D05067 }} },
+		{ .w32 = {{ 0xA984B080, 0x12052CAB, 0xA527F662, 0xF6F6C0A3,
+		            0x4002659A, 0x633EF292, 0x1EA30B6B, 0x7E3429FF }} }
+	},
+	/* 6 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x5E2EBD62, 0xD9514371, 0x89448F48, 0xF4D671FD,
+		            0x4C7281E9, 0x6CD2F819, 0x14CDE8FA, 0x125707C4 }} },
+		{ .w32 = {{ 0x2FB9E4A9, 0x1D8A92C5, 0x3791F474, 0x65F9A9D4,
+		            0xD2DF1771, 0x9D2F8902, 0xFABEBDB3, 0x5DE484BC }} }
+	},
+	/* 7 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x0C18BF9C, 0xE4046DEE, 0xA4840D07, 0x1890CEAF,
+		            0x6FB8A6E6, 0xA32DD6DA, 0xFA22AABD, 0x66A9ACFF }} },
+		{ .w32 = {{ 0x43412540, 0x365B9775, 0xA1160301, 0x56064313,
+		            0x69147780, 0xA6B97610, 0x45655A99, 0x44F29938 }} }
+	},
+	/* 8 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x8B607110, 0xA5B332AE, 0x8C5C2A7B, 0xC6A1F588,
+		            0x5F176F78, 0x4686BCEF, 0x0771051D, 0x2EEA2C71 }} },
+		{ .w32 = {{ 0x6AE34331, 0x6D0E9F71, 0x7EBB560C, 0xA2D563E3,
+		            0x13FC17A6, 0x02C47EC2, 0x5FEC969B, 0x6A77A305 }} }
+	},
+	/* 9 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x8C5F819C, 0x40E0CE5D, 0x223CA1F6, 0x6BDC43E0,
+		            0xD7781736, 0xA0D459C2, 0x12CE9923, 0x78B8AD58 }} },
+		{ .w32 = {{ 0x3E9DF237, 0xB540F07A, 0xA1E2CD6F, 0x94DB98D7,
+		            0x78D60A22, 0x24D38776, 0x03B37F74, 0x1CB11ED2 }} }
+	},
+	/* 10 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xB79CB62A, 0x0A9C26E8, 0x96493756, 0xD3FDB013,
+		            0x25739CFE, 0xBB8CE771, 0x0E6475F5, 0x0122EBC2 }} },
+		{ .w32 = {{ 0xDD24A2DB, 0x6E75FAC0, 0xE77A401D, 0x14915A9E,
+		            0x2EC5EBA8, 0x5FFF8900, 0x0DA38704, 0x47DB3ECC }} }
+	},
+	/* 11 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x2552F618, 0x3D529F5F, 0x11C17CF4, 0xAAB3DD99,
+		            0xC915749A, 0x908EA674, 0x40738C42, 0x203502EA }} },
+		{ .w32 = {{ 0x9099BC91, 0x21E65384, 0xB45DAD0D, 0xDF4DF1EA,
+		            0x17FAD1BD, 0x38CDFFD6, 0xA3E3DF6A, 0x703E6A37 }} }
+	},
+	/* 12 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xF2D19D4D, 0xED83533A, 0x6C76872C, 0xFC361DD8,
+		            0xB33E0FAB, 0x21DFE376, 0xA7F350B9, 0x19030349 }} },
+		{ .w32 = {{ 0x4A6136F5, 0x871502A0, 0xE3E34A94, 0x8CBBBB03,
+		            0x3E6070C9, 0xE875D3D0, 0xF4B93724, 0x43CC1CC5 }} }
+	},
+	/* 13 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x2C857E48, 0xC44F63AA, 0x7ADA4D4C, 0xB8700BAE,
+		            0xCD629CAA, 0xAB741005, 0x11D90402, 0x2CDB1D1B }} },
+		{ .w32 = {{ 0x7382202C, 0xE555B234, 0x8AE02A8E, 0xD500C2A8,
+		            0xE62C6043, 0x79E793AA, 0x31FBBA31, 0x6049FFBE }} }
+	},
+	/* 14 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xB005B326, 0x8D2A3C65, 0x1104B4BA, 0xC5BB6CF7,
+		            0xD01F22D5, 0xF1956E52, 0xBC25E03A, 0x4A254E32 }} },
+		{ .w32 = {{ 0x6046C383, 0xFD91053F, 0x8718FCDC, 0x303FC7AF,
+		            0x6A52152A, 0xE40C7E25, 0x0BB50447, 0x24311D50 }} }
+	},
+	/* 15 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xCEC73404, 0xD422BBDD, 0x2C1F62AB, 0xA495B721,
+		            0xB1D70899, 0xD50E049E, 0x9A53C7E5, 0x085B8553 }} },
+		{ .w32 = {{ 0xF251CDDA, 0xE3E52360, 0xB518645C, 0xD92BD114,
+		            0x88688FEF, 0x64586C72, 0x50EC4B3C, 0x07182BFF }} }
+	},
+	/* 16 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xDD36C5D6, 0xD08B3673, 0xDFF50CA5, 0x42875443,
+		            0x00AD977A, 0x4472B3B1, 0xAAAD796C, 0x71BBE2F8 }} },
+		{ .w32 = {{ 0x698BF33D, 0x65535E40, 0x684F6F92, 0xACBC8232,
+		            0x90D0C62E, 0xBBAE0F5B, 0xF8C24E6F, 0x33B00A17 }} }
+	},
+	/* 17 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x241C93A6, 0xD487E627, 0x2CAD2977, 0x095DB5CC,
+		            0xA5681F5B, 0x9A2373BC, 0xB4D88A34, 0x67FAD2F9 }} },
+		{ .w32 = {{ 0x22DECD4F, 0x15167814, 0xCEF95FC2, 0xE29D89B8,
+		            0x40619F8C, 0xD08454DC, 0xAAFFBEA0, 0x494D806B }} }
+	},
+	/* 18 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x57B098E9, 0x7207213F, 0x19EF59CC, 0x35612D73,
+		            0xFF35EC33, 0x3269414C, 0x878A0406, 0x42A569CB }} },
+		{ .w32 = {{ 0x73568974, 0x77471B28, 0x898BE67A, 0x6695BE61,
+		            0x0089C3B0, 0xEBACF16A, 0xB07E67CB, 0x24C9AB6E }} }
+	},
+	/* 19 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x2CC8936F, 0x64D9F2BB, 0x9C91A796, 0xAB8B615A,
+		            0xAE129DC7, 0x31AFE4E1, 0x57570515, 0x02F3E37B }} },
+		{ .w32 = {{ 0x20B9D58A, 0x1B7CEF3A, 0x855446FE, 0x9E5ACBAA,
+		            0x8F6B8870, 0xB02B5DD0, 0x105E183D, 0x6AAE7A89 }} }
+	},
+	/* 20 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xD1F16197, 0x882131F3, 0xC77920CE, 0x27D61348,
+		            0x869B6A13, 0xA0EDCFD2, 0x418C806E, 0x5F156080 }} },
+		{ .w32 = {{ 0x1DA4FB2A, 0x938BBED8, 0xAA053F19, 0x7AAF6260,
+		            0x602F0220, 0x3D329D30, 0x0F28A1BA, 0x18773140 }} }
+	},
+	/* 21 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x622B203D, 0xA12D9AFF, 0x6367BAD6, 0x25A94844,
+		            0x972A65D5, 0xED83DF54, 0x6545538A, 0x70B6F2AF }} },
+		{ .w32 = {{ 0xB6F8DD3C, 0xF09463BD, 0x2E15EB71, 0xA3687A8C,
+		            0xB96C4277, 0xC5A6E35D, 0xA228E128, 0x0FE97CE4 }} }
+	},
+	/* 22 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x2EC21BEB, 0x0294AE4D, 0xAE6BD8A7, 0x20C55D4A,
+		            0xBF51B653, 0x6E47EC3F, 0x41CCDC31, 0x75C57698 }} },
+		{ .w32 = {{ 0x7F660828, 0xBF0E3EA2, 0xEC2E4CDE, 0xFDDD7665,
+		            0xB9F67D1C, 0x736A2A3A, 0xF5AFB8B9, 0x3F005C73 }} }
+	},
+	/* 23 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x02627C4B, 0x62F2A0F2, 0x5D8A6A96, 0x983549AE,
+		            0x588EDA94, 0xCC6F6BBF, 0x33B5017D, 0x5D33E92E }} },
+		{ .w32 = {{ 0x9003FF13, 0xBB445592, 0x09A67025, 0x265C67EC,
+		            0xFBF44C47, 0x6A0C5118, 0x95102DF0, 0x0ED294B6 }} }
+	},
+	/* 24 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x9ECAFD0C, 0x91F7BAAD, 0x2AEBB19D, 0xDF7832A5,
+		            0x53A736B8, 0x72D70D6D, 0x41C9765F, 0x4053B800 }} },
+		{ .w32 = {{ 0x8A3C5206, 0x5B50A6FB, 0x196EB4DC, 0x35F2DDC4,
+		            0x561101BE, 0xA735700F, 0x95E9471D, 0x0A4CA1D9 }} }
+	},
+	/* 25 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xC460BD3F, 0xB2AAB3E7, 0x59A9231A, 0xC66F8B4C,
+		            0x8BFF1644, 0x3266E32C, 0xE6F2350D, 0x6740EA5D }} },
+		{ .w32 = {{ 0x502D0A5A, 0x78D6436E, 0x767BAD5C, 0x75ABAC84,
+		            0x32C26221, 0xA8B67D19, 0x8BB02113, 0x23C56254 }} }
+	},
+	/* 26 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xAFA4112C, 0xE227430B, 0xB62E38EA, 0xB8E453B6,
+		            0x100D694D, 0x9548631A, 0x9AC58E34, 0x1270E1EA }} },
+		{ .w32 = {{ 0x22732261, 0xC4E6C6A0, 0x09885802, 0xC8118C35,
+		            0x33C50BF6, 0x48B848D3, 0xB614C086, 0x24A32E7C }} }
+	},
+	/* 27 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x29531F17, 0x64E66C1D, 0xAE90950B, 0xD3DAC651,
+		            0x6BEABE17, 0x35B92695, 0xA5F845D9, 0x72D758B5 }} },
+		{ .w32 = {{ 0x78475F66, 0x177609A4, 0x96F47E78, 0x57C53C6B,
+		            0x24D0E3A2, 0xF3F89DA5, 0x2F40C13C, 0x47FE7C51 }} }
+	},
+	/* 28 * 2^192 * G */
+	{
+		{ .w32 = {{ 0xD040A46B, 0xC35ADB6F, 0x49E69F38, 0x3FE1FBE8,
+		            0x88777B55, 0x4CC32A67, 0xA2339159, 0x51494F29 }} },
+		{ .w32 = {{ 0x3269BE2F, 0xEA6EE2DF, 0x3D533AA6, 0x4948F988,
+		            0x96CDABB8, 0x04B4EA10, 0x3B2FBE94, 0x61380E0B }} }
+	},
+	/* 29 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x7C0BB978, 0x35ED145F, 0xB3C3DAC7, 0x0C6217E3,
+		            0x8B88D798, 0xD8806901, 0x61567A9C, 0x71589FC8 }} },
+		{ .w32 = {{ 0x89D48839, 0x4712C9A5, 0xB58EA5A5, 0xC2BAA9D0,
+		            0x8E0046EE, 0x6413BD8B, 0xF918BD10, 0x1AB87633 }} }
+	},
+	/* 30 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x671C6CED, 0xA8A61637, 0x3C6327E9, 0x5247064F,
+		            0x06C8A6E5, 0x5C7D9F9B, 0x39E49B17, 0x30D35BD2 }} },
+		{ .w32 = {{ 0x3BC0453E, 0x28F418E4, 0x2FA029F9, 0x1AB9C043,
+		            0x745B58D5, 0xAA1A6BFF, 0xDDB2BC37, 0x45D7EBFD }} }
+	},
+	/* 31 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x67A7D56D, 0xF5EB3886, 0x278D57E8, 0xFFD072B1,
+		            0x7040ABF7, 0xE92B80EE, 0x50CF1290, 0x270F6A76 }} },
+		{ .w32 = {{ 0xA7BE426B, 0x653ADC48, 0xB8CB0946, 0x6EE4AA2A,
+		            0x949B8DE0, 0x9168DD92, 0x0A17FDA2, 0x6D91F90A }} }
+	},
+	/* 32 * 2^192 * G */
+	{
+		{ .w32 = {{ 0x52C0321C, 0x8CFBE623, 0x163A7506, 0x35317478,
+		            0x2F0D350C, 0xB07FB5CF, 0x5B63BEAB, 0x674624CC }} },
+		{ .w32 = {{ 0x0A22576D, 0x54E2D549, 0x3FF99529, 0x2ED76068,
+		            0x1D014750, 0xFDD1AAF9, 0x043FD6A4, 0x44F0E982 }} }
+	},
+	/* 1 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x258E2E47, 0xA48E7116, 0x865AA4C1, 0x389BCA53,
+		            0xBE3E9411, 0x7353BB1F, 0xB02F1414, 0x6F282DAF }} },
+		{ .w32 = {{ 0x1508839D, 0x2BB15729, 0xB513923F, 0xEB59CD9F,
+		            0xD99CE8E0, 0xAD654941, 0x9ED0B81F, 0x268FA6A4 }} }
+	},
+	/* 2 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xBF81C525, 0x939954A5, 0x4E276C25, 0x944AB885,
+		            0x0E3094FE, 0x20087530, 0x6A0B9173, 0x20D606D6 }} },
+		{ .w32 = {{ 0x68C56F49, 0x70881454, 0x1929BB43, 0xAF1FDF6B,
+		            0x270CF50D, 0x1397AFB0, 0x71F7ABB1, 0x4171E1DF }} }
+	},
+	/* 3 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x01117764, 0x31A04D61, 0x6369A1A6, 0x9A2BCE1D,
+		            0x00550B05, 0x565ABB86, 0xFCE943C5, 0x454DA304 }} },
+		{ .w32 = {{ 0x4D7BBC6D, 0x34D880ED, 0x82294060, 0xE1DA0D4E,
+		            0x00B89F55, 0xCE7BF36E, 0xCC421841, 0x37EA5C5B }} }
+	},
+	/* 4 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x3B5B5265, 0xFD8AC94E, 0x65EE05A2, 0xB514EB4E,
+		            0xB0DD033C, 0x3F3BCE50, 0x3A49B4D6, 0x6424AC73 }} },
+		{ .w32 = {{ 0x00AACA52, 0x97E5BE5D, 0xE3518305, 0x31F25450,
+		            0xE66DB9FB, 0xA57F1A84, 0xC7E67488, 0x045F2FBA }} }
+	},
+	/* 5 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x293F2F04, 0x351B75CC, 0x57A0C704, 0x411756A8,
+		            0xAFC16360, 0x3791B9CA, 0x93B51B6C, 0x3E898C13 }} },
+		{ .w32 = {{ 0x21244EB4, 0xF1C180FE, 0xDCA4CD8D, 0xA504DF7B,
+		            0x57512CCC, 0xDBD4AD7F, 0x47FD3F83, 0x73DC4D9D }} }
+	},
+	/* 6 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x6CF22108, 0x7F8F62FD, 0xA5DDDA52, 0x63B2C60A,
+		            0x595200ED, 0xC7E4170E, 0x01C1CE98, 0x28A46671 }} },
+		{ .w32 = {{ 0xD9CAB3F5, 0xA035CC51, 0xE74F1551, 0x99540D2F,
+		            0x08000562, 0x9C32197F, 0x18596ED8, 0x22B2FA94 }} }
+	},
+	/* 7 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x19B3563B, 0xF6655DC7, 0x652D1852, 0x123743FB,
+		            0xCDCD3492, 0x8050A532, 0xCAEABB5B, 0x5C5A198C }} },
+		{ .w32 = {{ 0x548A1682, 0x8C686FC3, 0x6CD10E47, 0x65429E39,
+		            0x468EE741, 0xCC51905D, 0xE20ABA76, 0x22484F9C }} }
+	},
+	/* 8 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xD2E8EF26, 0x4447CA99, 0xA4961D50, 0x549F111D,
+		            0xB8B37A24, 0xCF88F54E, 0x2A2B090B, 0x64AFF95C }} },
+		{ .w32 = {{ 0x28405D64, 0x16392728, 0xCDF3DFD2, 0xAAB19E9C,
+		            0xCAB90F30, 0xAE860830, 0x024DDF40, 0x541D0820 }} }
+	},
+	/* 9 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xF329E661, 0x852D7BDE, 0x54355C5A, 0xCD81576F,
+		            0x410C7F6F, 0xE096461C, 0x60A614CD, 0x380DE660 }} },
+		{ .w32 = {{ 0x6C379A67, 0x6FCC86BB, 0x8732E357, 0x00412EB1,
+		            0x914FE029, 0x97D4897C, 0x545ABD98, 0x20979DA8 }} }
+	},
+	/* 10 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x5AE31FFD, 0x90293D35, 0x87374C01, 0x97701AF5,
+		            0xA2E0B08E, 0xDAF82BC6, 0x6D8EE0BC, 0x0421E4C1 }} },
+		{ .w32 = {{ 0x83D77792, 0x6E1FEE3D, 0xB3EC02E1, 0xA52CBCAC,
+		            0x1EB64947, 0x2E5CA9F4, 0x973EF7E3, 0x124B2A15 }} }
+	},
+	/* 11 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x7CA6BD10, 0xAB70B62A, 0x802CA22E, 0x7F363AAE,
+		            0x1A5F299F, 0xB06199A4, 0x86CFB061, 0x597675E2 }} },
+		{ .w32 = {{ 0x7B3870D5, 0xF6784676, 0xBA0A9AAB, 0x719D34B9,
+		            0xBABE5A5F, 0x6E798F46, 0xD66D03A0, 0x2088FF71 }} }
+	},
+	/* 12 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x1F05C826, 0x64D1FBE3, 0x87593BB4, 0xD13BFFB0,
+		            0x934308DB, 0x2C687EE5, 0x4B23ED91, 0x0A177159 }} },
+		{ .w32 = {{ 0x57A64FD1, 0x68E53298, 0x259B1FFA, 0xA7A9C193,
+		            0xFFA6FD1C, 0x94A8E590, 0xB4E59979, 0x2E5AB502 }} }
+	},
+	/* 13 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x99DB5A9B, 0xFCC074CE, 0xD8069D60, 0xE2A1802B,
+		            0xD515A3C7, 0x203C837F, 0x554CC02F, 0x7658019A }} },
+		{ .w32 = {{ 0xE129CD71, 0x54EDE297, 0xD6816B3D, 0x71C4E960,
+		            0xF06ED937, 0x4AEC94EB, 0xB0F1C019, 0x6A1F3B8F }} }
+	},
+	/* 14 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x32BE3E27, 0x6F8788B7, 0xE7549717, 0x24BA361C,
+		            0x631BD5D4, 0xF588D273, 0xDC4621C2, 0x661AF4C5 }} },
+		{ .w32 = {{ 0x9D6A2E8D, 0x2D054890, 0xE6742320, 0x24D4BB1F,
+		            0x2701B41C, 0x749B5CA7, 0x23F376CF, 0x37A93932 }} }
+	},
+	/* 15 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x7592ED9E, 0x050868FB, 0xB0175897, 0xBE60F863,
+		            0xB610F22C, 0x8AB07C27, 0x6485BAEB, 0x37F19362 }} },
+		{ .w32 = {{ 0x5E36D3A4, 0x7AEB08FB, 0x24864449, 0x50364D6B,
+		            0xC5DD89EA, 0xFF000A52, 0xA296DB5E, 0x54F79E69 }} }
+	},
+	/* 16 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xFDF52AF2, 0x2D1E68EC, 0x97E17E34, 0x6329ABAF,
+		            0xC63F8049, 0x9FA0C53E, 0xD224E62A, 0x68167EB0 }} },
+		{ .w32 = {{ 0x1B1FF472, 0xF948BDDF, 0x58A1D148, 0x702446B8,
+		            0xDE83F28C, 0x40DF20F8, 0x9EC3DA67, 0x297B8534 }} }
+	},
+	/* 17 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xFB0731D1, 0xEC7182B0, 0x4ECFC3C5, 0x0C953020,
+		            0x52B3930C, 0x40F056A1, 0x81D70D99, 0x56362B36 }} },
+		{ .w32 = {{ 0x25C2FB93, 0xBC5BA0EE, 0x24B8F86A, 0x9C32CB5D,
+		            0xFE337AA0, 0x80CED5F4, 0xE69565D8, 0x6B9559BA }} }
+	},
+	/* 18 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xC449332E, 0x78B6542A, 0xC70D5A63, 0xB537F736,
+		            0x60E0EBEB, 0xE7E4C302, 0x990FD5E0, 0x58001B07 }} },
+		{ .w32 = {{ 0xDFCA824B, 0x8156F125, 0xD71FDEBE, 0x5F01969A,
+		            0xCAE64966, 0x9CEF68BA, 0x63BF5720, 0x121D1055 }} }
+	},
+	/* 19 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x69BF65C8, 0x09280E7D, 0x46876532, 0x266A855C,
+		            0x5130D518, 0x1A3E8115, 0xDFC6A8F2, 0x38222D7F }} },
+		{ .w32 = {{ 0xCAB46815, 0x711C9776, 0x0DFFADE9, 0x03716E3A,
+		            0x3692BE2E, 0x54FC664D, 0xDCE91AE3, 0x480CADC4 }} }
+	},
+	/* 20 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xC8B05253, 0x20496B20, 0x6F9AFE99, 0x59F1BB59,
+		            0x4F6122F2, 0x176246C3, 0x68F8E0E3, 0x50C60FE6 }} },
+		{ .w32 = {{ 0x925CC4BF, 0x300200B2, 0x17C2CF7C, 0x5A669D12,
+		            0xC48CFDB8, 0xCEE12871, 0x16A58621, 0x33D3004C }} }
+	},
+	/* 21 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x24F7125F, 0x26B9A398, 0x2611E26A, 0xD6D3A158,
+		            0xEC52CD35, 0x7F12CA64, 0x455C9701, 0x04BA3CD1 }} },
+		{ .w32 = {{ 0xDEF6804F, 0x5EA29F2B, 0xE80887FF, 0x9138646D,
+		            0xE36D4C8F, 0x89A67CB3, 0x39A9ADAF, 0x7D8FF0EF }} }
+	},
+	/* 22 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x083EBEEE, 0xA9057358, 0xC67B26DD, 0x9871B353,
+		            0x83B62723, 0xA8D58297, 0x934809E8, 0x7A0846D0 }} },
+		{ .w32 = {{ 0xD6D6D7DC, 0xFA84750B, 0x892B7394, 0x06BB720A,
+		            0xAC2170C7, 0x0279F940, 0x3405F346, 0x1A295802 }} }
+	},
+	/* 23 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x0A28B327, 0xA1B74929, 0x22716F6C, 0x826FEEAA,
+		            0xC90C241B, 0xD2A8AD7B, 0x9B6D004F, 0x041E349B }} },
+		{ .w32 = {{ 0xCA475D36, 0x6416E342, 0x7083ACED, 0x17CA70CB,
+		            0xB7CDBF58, 0x8CE6B737, 0x70B2FD45, 0x2F954FC8 }} }
+	},
+	/* 24 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x1F865A97, 0xAFB5E79F, 0x659F8416, 0x6797F937,
+		            0xEECD89DD, 0xBF558800, 0xE94656F2, 0x27E5F7CF }} },
+		{ .w32 = {{ 0x2B79B5B7, 0x659804C9, 0x8E442C0B, 0x60FA76C1,
+		            0xDC44B41A, 0xBF963ABE, 0x72AEC6CA, 0x4E3872FE }} }
+	},
+	/* 25 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x2C1D38FE, 0x1F02680D, 0x5A42F57A, 0xC334C44D,
+		            0x60F982DD, 0x2159F7F7, 0x3CB04953, 0x56323053 }} },
+		{ .w32 = {{ 0x03FE61F4, 0xF0DC3689, 0x1BE3B906, 0xB1318380,
+		            0xBC3C3FF6, 0x0A22AA59, 0xEA38D4D3, 0x5534458A }} }
+	},
+	/* 26 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xC97B1B2C, 0xD2C60B3F, 0x3EB33644, 0x1E1CED60,
+		            0xBC14E231, 0x96F610A1, 0x03D3CBF4, 0x1FF32B4E }} },
+		{ .w32 = {{ 0x4081B732, 0x5033408B, 0xC482B6B3, 0x25809978,
+		            0x54D0B387, 0x761E7520, 0x84157D52, 0x7D2BA1F9 }} }
+	},
+	/* 27 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x4FCDB20A, 0x20ACF0E0, 0x65B114FE, 0xE2C82108,
+		            0x57948AB0, 0x917EAFB1, 0xFFCDAC68, 0x26C1EA7F }} },
+		{ .w32 = {{ 0x05E9AC18, 0xC747CBE5, 0x38F5CF8D, 0x2A22B126,
+		            0x11787AC0, 0x0207CD29, 0x761325B9, 0x17F4F29A }} }
+	},
+	/* 28 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x3B926FFE, 0x79C9942C, 0x4526A97F, 0x2FC3B215,
+		            0xE9CFC18C, 0xDC4AAF51, 0xB7DC2C77, 0x50A49DB2 }} },
+		{ .w32 = {{ 0xACDC7781, 0x90A943AE, 0x56715EA4, 0x495FEB06,
+		            0xBAD4B5AE, 0x47D9F47A, 0xFF055586, 0x00D1B0C7 }} }
+	},
+	/* 29 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xB6F03C16, 0x9BE61153, 0x3B4AFF2D, 0x2569E306,
+		            0x79EE19BD, 0x7F1B3CB4, 0xC4F52F70, 0x2D9A75E7 }} },
+		{ .w32 = {{ 0xBA017E0F, 0x6CBF8A90, 0xB89CBB6E, 0x7DD7E2F5,
+		            0x1BDFA4C8, 0xBEC2A28D, 0xD577B6FE, 0x50ECA051 }} }
+	},
+	/* 30 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x403F260C, 0x24B2EBB8, 0xBED9A9B5, 0x7087798C,
+		            0xD3E576A3, 0x6DDE4BFC, 0x1D21C55A, 0x5C2B5819 }} },
+		{ .w32 = {{ 0xF56C1F62, 0x65C41739, 0xA06C944E, 0xD31DD9FA,
+		            0x75514ABE, 0xD81A3737, 0x454DDEC5, 0x7EE844A9 }} }
+	},
+	/* 31 * 2^216 * G */
+	{
+		{ .w32 = {{ 0x146ADA89, 0x7AF00440, 0x0AFA0FE1, 0xA8563189,
+		            0x9C9F323D, 0x54CCA608, 0xE098DB72, 0x06C60BF2 }} },
+		{ .w32 = {{ 0x4A858500, 0xD52E07B8, 0x95E0CEB1, 0x76D8A217,
+		            0x9EF98A0C, 0x042F4F9A, 0x3C9FBD26, 0x0467F8A4 }} }
+	},
+	/* 32 * 2^216 * G */
+	{
+		{ .w32 = {{ 0xE4EB8C9E, 0xF8E3FCE1, 0x06ABB9F4, 0x1F1B9A72,
+		            0xB6ED8A37, 0xCBC11780, 0x7E07A14B, 0x65761C71 }} },
+		{ .w32 = {{ 0x4A078E5D, 0x75EE1F92, 0x6DEBE90B, 0x39259EFC,
+		            0xEE28E159, 0xB41A3E95, 0xF7B9CA53, 0x51F50D55 }} }
+	},
+	/* 1 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xF62248CE, 0x4FB4D309, 0x907CF360, 0x49BC909C,
+		            0x528E6B6C, 0xE59FA74F, 0x9971AF07, 0x0F7C3E76 }} },
+		{ .w32 = {{ 0x26F4E7CD, 0x532FB8B6, 0x5E044979, 0xCE7ED4D9,
+		            0xC567B378, 0x82570C18, 0xD447A406, 0x47098F3C }} }
+	},
+	/* 2 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xFCD8BBDF, 0x63726328, 0xB1E6BEFD, 0xFA973991,
+		            0x1B743E22, 0x077CE141, 0x3BC92B67, 0x284983FF }} },
+		{ .w32 = {{ 0xAFFF429C, 0xE73FE844, 0xE9A88B00, 0xBB2A66E7,
+		            0x63F05F68, 0x709C5F67, 0xD491D5ED, 0x79F2EA40 }} }
+	},
+	/* 3 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xF9FAB796, 0x9A934908, 0x9D745EE1, 0x2BCF43D7,
+		            0xE6F90CB2, 0x176086D7, 0x15C48F7B, 0x24F81EA5 }} },
+		{ .w32 = {{ 0x0927FD15, 0x5E708B90, 0x76B9D8B4, 0xFD5823AF,
+		            0x0F50C28D, 0x07C3A017, 0x6D24840F, 0x760F7E18 }} }
+	},
+	/* 4 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xD0DE42B1, 0xE57DF509, 0x3A982D3C, 0xF1F514F6,
+		            0x932C156D, 0xE6424DB8, 0xF39FAA0C, 0x23298DF2 }} },
+		{ .w32 = {{ 0xBEE08652, 0xA2728008, 0xF3DB99CC, 0x4201D967,
+		            0xFE7F396B, 0x682FD59B, 0xE8E4CE7D, 0x3AC22046 }} }
+	},
+	/* 5 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x8ECCE52B, 0xBFD3272E, 0xD8D59938, 0x8A600D60,
+		            0x73421F91, 0x8608DFB3, 0xB9AA6D46, 0x3B7D3E88 }} },
+		{ .w32 = {{ 0x233EB474, 0x44AAD8E0, 0x25AEE8BE, 0xBB9D66FE,
+		            0x5D4E37CA, 0x209CA569, 0x6EBDF305, 0x17332279 }} }
+	},
+	/* 6 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xE0B5F7B3, 0xE284F1B4, 0xCD5215B1, 0x3BA3E05F,
+		            0x97FA8764, 0x8FD22D9C, 0x540769AA, 0x3ABC484F }} },
+		{ .w32 = {{ 0x5ECF14CD, 0x3AC9177B, 0x1B6FF651, 0x621D7E12,
+		            0xC7E24C76, 0xA6B00E9B, 0x98057637, 0x2480511C }} }
+	},
+	/* 7 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x9F962B4E, 0xADE5673A, 0x14444F67, 0x89E69A08,
+		            0xC74C1B67, 0xF8E1A58C, 0x6BD8B680, 0x2529B5F5 }} },
+		{ .w32 = {{ 0x09F85820, 0x7EC7D870, 0x87B33E8B, 0x6FC9E4CB,
+		            0x5681CC0C, 0x6A78D927, 0x3B47C651, 0x7D95400C }} }
+	},
+	/* 8 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x410FB256, 0xA38F5BF8, 0x6FA50D18, 0x7F1971B6,
+		            0xD4E03469, 0xB19C7572, 0x79E0F6D5, 0x6475FBA7 }} },
+		{ .w32 = {{ 0x557ED9C2, 0x1F227918, 0x3AAB0B39, 0x9D0362EE,
+		            0x14E7EC2A, 0x877D55F9, 0xDB3FE679, 0x6448DC24 }} }
+	},
+	/* 9 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xD10DFE51, 0x474BA128, 0x3983B5CA, 0xD228EE82,
+		            0x624115E8, 0x1874C501, 0xD2725C72, 0x69546402 }} },
+		{ .w32 = {{ 0x8C5D1859, 0x931A32BB, 0x2CF02197, 0x676B4C22,
+		            0xB274B029, 0x3018941F, 0xAF15BEB5, 0x2741C75F }} }
+	},
+	/* 10 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x0022EDD7, 0x97B9D5B2, 0x5ED08EBE, 0xA0FAE0FA,
+		            0x254017B6, 0x0E33502E, 0x7EF3A4CD, 0x28F5508E }} },
+		{ .w32 = {{ 0xE4D938CE, 0x4A46A04C, 0xD5C2E826, 0x8C86B45C,
+		            0xEB871CBE, 0x3B2C475D, 0xB9A64C8D, 0x326F02E9 }} }
+	},
+	/* 11 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x4378F619, 0x7F1EA036, 0xF5BDA421, 0x9712DBDF,
+		            0xB02225A0, 0x13E484B0, 0xE0727AF6, 0x04649E57 }} },
+		{ .w32 = {{ 0xD02D65D9, 0x5CA9E1C1, 0xDCB9189C, 0x74DE4396,
+		            0xB02E7F85, 0x8DBA836C, 0x00590429, 0x6FF8DC11 }} }
+	},
+	/* 12 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xA3FE8550, 0x7C6F0241, 0x150D9E99, 0x2429E6D7,
+		            0xC0506E19, 0xE7680862, 0xA40F00AE, 0x08484D56 }} },
+		{ .w32 = {{ 0x68D07563, 0xDDAF1C5D, 0x7FF8D648, 0xC9786D7F,
+		            0x74CC5A5F, 0x5515E65A, 0xEF9ADAC1, 0x1181AF4E }} }
+	},
+	/* 13 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x14B2459A, 0xC442E3D2, 0x021704DC, 0x690AD7E7,
+		            0x61838FAA, 0x0CFA0F39, 0x93E22825, 0x04D14C8F }} },
+		{ .w32 = {{ 0x7A2FD24A, 0x72508C23, 0x93BACC47, 0x1EB64DF2,
+		            0xB315440C, 0xEBCBF0CE, 0x48268A46, 0x3DBF0CDA }} }
+	},
+	/* 14 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x2540ACF6, 0x68BF3EFB, 0xA9DACEE1, 0x6A2446DA,
+		            0x21A54BFF, 0x95630897, 0x1F702177, 0x57827227 }} },
+		{ .w32 = {{ 0x408404BB, 0xA05B6165, 0xFD78B792, 0x0238B64E,
+		            0xD8BE1F5F, 0x2E1E24CD, 0xA72612F9, 0x28079885 }} }
+	},
+	/* 15 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x324B296B, 0x443F5AC7, 0xC31A51FD, 0x033CC0F8,
+		            0x89A14158, 0x2A654008, 0xDF60B3EA, 0x68BF4443 }} },
+		{ .w32 = {{ 0xAEFD9416, 0x36CF6955, 0x5C2F7BAF, 0xAE6A717A,
+		            0xECA44FD9, 0x07AE80C2, 0xFD888816, 0x24318CCE }} }
+	},
+	/* 16 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xC0236152, 0x5A162FC2, 0x372AD1C0, 0x336B2ABA,
+		            0xFEA94004, 0xC5B9D6C9, 0xE0303D87, 0x271A6427 }} },
+		{ .w32 = {{ 0xE27E4727, 0x7D9C495E, 0x4414C237, 0x032754F9,
+		            0x5D7EC497, 0xE2410901, 0x6BAEE71A, 0x27B21C7A }} }
+	},
+	/* 17 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x7A5783CD, 0xA8969EC6, 0xA7F911B8, 0xEB423CB4,
+		            0x760EB570, 0x8FA2EBFE, 0x2AC96E15, 0x5DFEA4E5 }} },
+		{ .w32 = {{ 0x61A2B71F, 0xB7DC54F9, 0xEEA5935D, 0xC1209219,
+		            0x68B54703, 0xF537EF6F, 0x29B96CBB, 0x406B122E }} }
+	},
+	/* 18 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x58831FB7, 0x35F31114, 0x546BA0DB, 0x8829E217,
+		            0x8225131F, 0x33E4F76C, 0x0F0D1DEE, 0x2EF83781 }} },
+		{ .w32 = {{ 0x281FB6F2, 0x80C6A103, 0xC68BDF5D, 0xF753715E,
+		            0x7062792F, 0x5A6301AE, 0x3E6C2D21, 0x4CB9AD5C }} }
+	},
+	/* 19 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x8DFD629F, 0xCE195F03, 0x5E5CAF2C, 0x741D3BB4,
+		            0xDF03F826, 0xAE4EDF45, 0x2F58497C, 0x7DB79061 }} },
+		{ .w32 = {{ 0xF6552C3A, 0x7C1D2317, 0x886953DA, 0x889A146B,
+		            0xE81BB6AD, 0xD8E403A2, 0xDE4E5A3C, 0x4CFAE167 }} }
+	},
+	/* 20 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x81A35DE2, 0xEB5FE8BF, 0xC1950D4E, 0x3AFA70EF,
+		            0xAFD2FBE9, 0x43A92A46, 0x1A9753C3, 0x3102C9D2 }} },
+		{ .w32 = {{ 0x9429D1B0, 0x819B54EA, 0x82E5C8EB, 0xEFFE6115,
+		            0xED353A58, 0x8E0C1AA3, 0x55E78F42, 0x45EBE02E }} }
+	},
+	/* 21 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xEFC5B4D4, 0x6B7AD6A1, 0xC4C7884D, 0x55305ED5,
+		            0x2276D5EF, 0xD15433DD, 0xE55263C9, 0x3BEFF425 }} },
+		{ .w32 = {{ 0xD8485407, 0x2BEC547D, 0xA1A8140D, 0x01DC35A9,
+		            0x20EEF111, 0x6ACE2FA0, 0x3EEFB678, 0x71353970 }} }
+	},
+	/* 22 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x39BAEEB6, 0x93382197, 0xC2A663E8, 0x9421BCDB,
+		            0xBBC9F6DC, 0xFB15A2E8, 0x9D4CCA97, 0x5540F8C5 }} },
+		{ .w32 = {{ 0xE4C5FEBB, 0x33B36B48, 0x21300BAF, 0xDBB99146,
+		            0xF13EC046, 0x07F8F366, 0x377F0E60, 0x7EE63BB4 }} }
+	},
+	/* 23 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x9DA9B963, 0x793308BA, 0x66617DF2, 0xBD92D63C,
+		            0xB3E7065B, 0x90C7BF0C, 0x0473B938, 0x6D422B54 }} },
+		{ .w32 = {{ 0x32363E59, 0x10F7AF0E, 0xE1E6E659, 0x9561163F,
+		            0x0AA59240, 0xC9109852, 0x76D3B1D4, 0x5E861596 }} }
+	},
+	/* 24 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xAE4BE118, 0x5D2AB05F, 0x71BF691A, 0x8488E1F5,
+		            0x1BCC8D6A, 0x53A26E0D, 0x051AE659, 0x5C7C2CE0 }} },
+		{ .w32 = {{ 0x0A2F061A, 0x6973C654, 0x7371C258, 0xB36D675D,
+		            0x0DA57606, 0x6D64954A, 0xDBC882E4, 0x5887454E }} }
+	},
+	/* 25 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xEAD5D8BC, 0x7C4901E9, 0x44FB08B7, 0x75EDC00D,
+		            0x0C16F3FA, 0x5644DC43, 0xC641116C, 0x70FC47E7 }} },
+		{ .w32 = {{ 0xD2C05DE3, 0x578BAD57, 0x88CEA5CA, 0x3A6B2E1E,
+		            0xEC7DC6A9, 0x3188B6D7, 0xAE6DB107, 0x5203AE8C }} }
+	},
+	/* 26 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x985A66B0, 0x0159E342, 0x7500A6B7, 0x56B060BF,
+		            0x526447F0, 0x927AB286, 0x69CE7B78, 0x36E4F8E9 }} },
+		{ .w32 = {{ 0x759BB07C, 0xBD43CBA9, 0x38DD28E2, 0x0B075253,
+		            0x2F8218F2, 0x84006416, 0xD10B3089, 0x45B18F94 }} }
+	},
+	/* 27 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xCF8BC8B9, 0x0EB0616C, 0xB81F6E0A, 0x57AF3D39,
+		            0xB7CE92EF, 0x5BC8C630, 0xEAC52188, 0x4BCA1096 }} },
+		{ .w32 = {{ 0xA0355E31, 0x9492AD45, 0xBE8099F3, 0xC9B3D8F2,
+		            0x8547A58B, 0xEFECB103, 0x7E665BD2, 0x520E5990 }} }
+	},
+	/* 28 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x269926E5, 0x0284F4AA, 0x023D9367, 0x3997CDF4,
+		            0x977B00CD, 0xF425E59D, 0x8D93E888, 0x6105D8C0 }} },
+		{ .w32 = {{ 0xB738B728, 0xECCBCDA1, 0xD731311E, 0x9884D6F6,
+		            0x5D66CD17, 0x4F531C23, 0xDECD807A, 0x5E251C50 }} }
+	},
+	/* 29 * 2^240 * G */
+	{
+		{ .w32 = {{ 0xE8C4414E, 0xFCAEAD2D, 0x10959B1C, 0x1484A32C,
+		            0x6BD8EF32, 0xA7BF124E, 0xC86D0184, 0x67879A09 }} },
+		{ .w32 = {{ 0x0E8CBF90, 0x660D8A0C, 0x94E205C5, 0xA41B2A19,
+		            0xBB883898, 0xF98CA9B7, 0xADE4256C, 0x04D4BBDD }} }
+	},
+	/* 30 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x672815E7, 0x8CB38541, 0x97F8684B, 0x9A22EA01,
+		            0xE56AD288, 0xA4EFC55B, 0xF0495CB8, 0x29AFE350 }} },
+		{ .w32 = {{ 0xF19F6104, 0x355FD538, 0x43A5DD98, 0x26598643,
+		            0xB7BED817, 0xBBFC436A, 0x2BE074D0, 0x6FDE54AE }} }
+	},
+	/* 31 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x21341CED, 0x8D07E6A6, 0x44A494C8, 0x617EFFF0,
+		            0x30264B4D, 0x0599DE3F, 0x5ED92BB1, 0x485EB32F }} },
+		{ .w32 = {{ 0xC298E795, 0xEFF3324C, 0xF8360CB5, 0x36205825,
+		            0x1F50F95E, 0x7B9BCD0F, 0xE03CF038, 0x6C177BBC }} }
+	},
+	/* 32 * 2^240 * G */
+	{
+		{ .w32 = {{ 0x2080F414, 0x2E1F5185, 0x09758AD7, 0x48125C40,
+		            0xD6CCAECD, 0x1B7A20BB, 0x5C79A33D, 0x6E6F3EC8 }} },
+		{ .w32 = {{ 0x74B12E2D, 0x7770EFB1, 0x5F6EEC65, 0xF809F9E1,
+		            0xEF3A71F3, 0x3CDFD857, 0x02344CEE, 0x52485F8B }} }
+	}
+};
@@ -0,0 +1,2476 @@
+/*
+ * Precomputed windows of the generator for do255s_mulgen(),
+ * 64-bit limbs. Generated with: mkgtab 6 11 w64
+ * Do not edit.
+ */
+
+#define MULGEN_WIN      6
+#define MULGEN_CHUNKS   11
+#define MULGEN_XU       0
+
+static const do255s_point_affine window_G_comb[] = {
+	/* 1 * 2^0 * G */
+	{
+		{ { 0x4803AC7D33B156B1, 0x3EF832265840B591,
+		    0x213759ECCB010B9D, 0x39BD72651783FB6D } },
+		{ { 0xAAAAAAAAAAAAA584, 0xAAAAAAAAAAAAAAAA,
+		    0xAAAAAAAAAAAAAAAA, 0x2AAAAAAAAAAAAAAA } }
+	},
+	/* 2 * 2^0 * G */
+	{
+		{ { 0x8C6318C6318C5721, 0x18C6318C6318C631,
+		    0x318C6318C6318C63, 0x6318C6318C6318C6 } },
+		{ { 0x7311544E5C3E5011, 0x3667EAC42F5E574B,
+		    0x6DC59919A4176AA4, 0x701BB8203F062A69 } }
+	},
+	/* 3 * 2^0 * G */
+	{
+		{ { 0xC92EA6A45AF542C8, 0xACA2B1F0EB2EBB62,
+		    0x16AA9AB4772D49BF, 0x586E82D468993FDF } },
+		{ { 0xB0E2616D07647DD6, 0x79835A85D9B70D8F,
+		    0x39545AAB733292C6, 0x27A19C073EE92301 } }
+	},
+	/* 4 * 2^0 * G */
+	{
+		{ { 0xB21E437C0F24B43F, 0xE352D46A2A191529,
+		    0x5105F27F8E691D57, 0x203E742185ABD1BC } },
+		{ { 0x0AA6E498AFC4CC85, 0x34CABA8351FC11F0,
+		    0x09F86D5B2BD1700A, 0x537BA3D40924022E } }
+	},
+	/* 5 * 2^0 * G */
+	{
+		{ { 0xD4C604388FAAFD54, 0x478144CACA27D2A0,
+		    0x4B4B7554A3381C38, 0x78CC3E71A8C94117 } },
+		{ { 0x9819FEFFB48175C6, 0xEB222706A19AC3DD,
+		    0x410723C5BE5D5845, 0x3C18C25DF4EA9551 } }
+	},
+	/* 6 * 2^0 * G */
+	{
+		{ { 0x0F8CCA9A5D8AEC75, 0x2337B2C5F00CFF35,
+		    0x4C38E25760F3A520, 0x5B8B19C1B38EC25A } },
+		{ { 0x5E273AB277A6F073, 0xDFCD0E545019A510,
+		    0xB4D344CB7DE61215, 0x20CB4C0BE6CE27C4 } }
+	},
+	/* 7 * 2^0 * G */
+	{
+		{ { 0xE45744799916AE56, 0xAB719188444F94C0,
+		    0x8BCF3B53F4727AB0, 0x239A8F014119EE4B } },
+		{ { 0x6D72E617646D9E07, 0xE08B7A2B9844C50F,
+		    0x164E30CF18FDB104, 0x44C18E58F1A5F7AF } }
+	},
+	/* 8 * 2^0 * G */
+	{
+		{ { 0x486D0418D4089F3F, 0x415C30647E21EC49,
+		    0xDB2F693C6C060489, 0x475F06F55E1CF582 } },
+		{ { 0x716647F988DF33A3, 0xFA6FD869A7CEE964,
+		    0xDB2F9858F220CA25, 0x7F45D8FB03825F9C } }
+	},
+	/* 9 * 2^0 * G */
+	{
+		{ { 0x6F20F664F35EBE0B, 0x72C56CBCBBE70025,
+		    0x1B8A888E7A1BC6B3, 0x3AE1B93B4536C750 } },
+		{ { 0x8952D2A9DD9C2BCC, 0xF5DA264D49EF49CB,
+		    0xAD270B422A4F8A38, 0x78F62E180A6E3986 } }
+	},
+	/* 10 * 2^0 * G */
+	{
+		{ { 0x0B77022F05D906A1, 0x36553987A9763928,
+		    0x90C0593CD952E579, 0x601889E506ECA253 } },
+		{ { 0x273BD4BD30ED2DED, 0x222B7CB550375EA6,
+		    0x375976D993C78BC8, 0x18B084F5D6B1DAFA } }
+	},
+	/* 11 * 2^0 * G */
+	{
+		{ { 0xFC96E106BF390F8E, 0x87F4FE12D17AC934,
+		    0x20DD4A1C455D2425, 0x0F489EA0CF96C239 } },
+		{ { 0x3F7E226E3512C58A, 0xC44C89C9E83EFE42,
+		    0xB9E17C3BF2137EC0, 0x3CF2AACDFDDB2B1D } }
+	},
+	/* 12 * 2^0 * G */
+	{
+		{ { 0x116E4C0180B4DDCF, 0xD965D1AE088C285B,
+		    0xCE5A14DBF0E43F69, 0x2BCC8378CC7BF398 } },
+		{ { 0xFE21145C707DB568, 0x05499CC63C0E4257,
+		    0x3FB7EC2DCB1E187F, 0x02A575B60EA27DE1 } }
+	},
+	/* 13 * 2^0 * G */
+	{
+		{ { 0xBB832D11959A60E5, 0xF3AF5A147660C5E6,
+		    0x1037C50FE1FAFA73, 0x251739F159A18E7B } },
+		{ { 0xC611B8215A7DE759, 0x958D80A0A6307017,
+		    0x58717037E45D5DD5, 0x4C6EA6D5ECC46A53 } }
+	},
+	/* 14 * 2^0 * G */
+	{
+		{ { 0x238B24170CD243C2, 0xF20B2474CC7B0C22,
+		    0xD1AF972D83B667A6, 0x1BC20D835A45EA4E } },
+		{ { 0x9156BD623979E8C5, 0x0DC398312917B521,
+		    0xADFDC3EA49BE6B11, 0x71B74A4CC6854B51 } }
+	},
+	/* 15 * 2^0 * G */
+	{
+		{ { 0x725096F4FAC9FD25, 0x4072199CA8F661BC,
+		    0x1E3D756A54E4B489, 0x36A82923B7C5D81C } },
+		{ { 0x0E7071C300CF6A28, 0x738D92CE822D2881,
+		    0x85798A741DCCB0F9, 0x13E1D3C237073682 } }
+	},
+	/* 16 * 2^0 * G */
+	{
+		{ { 0x6ACF66F7D508BB00, 0xFC3A8030127F8808,
+		    0x70481A4C6305A579, 0x30664839BD04AA0E } },
+		{ { 0x5D419AD45E49162B, 0x78530FAA238BED1D,
+		    0xA765AE1A31C8C7C7, 0x67207D6BCEDE5E8D } }
+	},
+	/* 17 * 2^0 * G */
+	{
+		{ { 0x3940993F26056099, 0x7317F06D45454504,
+		    0x97EFC6E6E49D0882, 0x569BB09318CA6FA5 } },
+		{ { 0xDD7930EB7584C49B, 0xE23AECFA6A911FAE,
+		    0x551A661A1E764813, 0x50E31FF04634DB74 } }
+	},
+	/* 18 * 2^0 * G */
+	{
+		{ { 0xB7CC16E9B2E1385D, 0x52FFED1A678D0FD6,
+		    0xC91277EECEBD12E3, 0x604F0A9FBCA22012 } },
+		{ { 0x863FCD777D7CEBFE, 0xA3120C9F1FB08287,
+		    0xE7682CFE60F0746A, 0x415BE2218F38F1C7 } }
+	},
+	/* 19 * 2^0 * G */
+	{
+		{ { 0x7874570F05EDE01B, 0xCC7B2FDDEDE8EAB0,
+		    0x57F5A9A77347EC36, 0x4ACA5C9991BDDEB1 } },
+		{ { 0xA20D3062D1D03717, 0xEE5E6C36608E032C,
+		    0x6923961C67B8CFAC, 0x41279DD8FCE1CE7A } }
+	},
+	/* 20 * 2^0 * G */
+	{
+		{ { 0xF5F025C2B6D05377, 0xA9A0CEFA6A39ACCE,
+		    0x1055D8BEE9B889DD, 0x233E53954C577654 } },
+		{ { 0x6464E5C36DEB2150, 0x76D2F6F52961D859,
+		    0x7C8D29A7D54D1413, 0x1718575132B8A19A } }
+	},
+	/* 21 * 2^0 * G */
+	{
+		{ { 0x34CF249D433BEB67, 0x9FFB0B06383CE17A,
+		    0xC41E042576241A5F, 0x5C09174FE9E35A9C } },
+		{ { 0xA9FA13D476EF5323, 0xD568C0F3773F989C,
+		    0xFC5C3E2A6308EFC4, 0x4E2A7A0D1DF2207F } }
+	},
+	/* 22 * 2^0 * G */
+	{
+		{ { 0x2228CC126AFD3F92, 0xC65CCD4DDE738EE2,
+		    0x4A5B20F58D11D954, 0x2A5F13C20E3BB4C7 } },
+		{ { 0xD4C6EDE58C0480CD, 0x4DC1972A84A612BF,
+		    0xA30FFF6260D5647A, 0x4A21C3576BB388EC } }
+	},
+	/* 23 * 2^0 * G */
+	{
+		{ { 0x3341E9A12ABE0DF4, 0x4C8C189A3F12F94B,
+		    0x522992FC9F29DDD9, 0x69B183A00FCBA041 } },
+		{ { 0xFD78170301463FF0, 0x7DB2412ED5FA89B7,
+		    0xF22FCF452840A919, 0x18F6726E9AB47D5F } }
+	},
+	/* 24 * 2^0 * G */
+	{
+		{ { 0xCF49C41C71B637B9, 0x6970B1261EB11DA1,
+		    0x2F84E117C2808BDC, 0x2623067590F08BE0 } },
+		{ { 0xE05986FF528E1D57, 0x0DF892BA31A633A1,
+		    0x4795CC0CBEC37906, 0x5536D8C16B7788F2 } }
+	},
+	/* 25 * 2^0 * G */
+	{
+		{ { 0xAB664C1583A57462, 0x7869491153411469,
+		    0x5C937337D0CA6CAF, 0x2734C856349DFCEF } },
+		{ { 0xBDA4965FBE284507, 0xF3BE5EFF19F5582E,
+		    0x14E2B275AC106A0E, 0x65691E343412AE34 } }
+	},
+	/* 26 * 2^0 * G */
+	{
+		{ { 0x87730DDB800D5986, 0x38A46A339BAAED89,
+		    0x24CE04C30561A0D9, 0x1688C835E5BF6CBC } },
+		{ { 0x1CACC0B01070CB7D, 0xDB369B195D226843,
+		    0x912C1EAEB0558273, 0x05769A319C9ABFF9 } }
+	},
+	/* 27 * 2^0 * G */
+	{
+		{ { 0x0BB6EBAC64B56D89, 0xA2C3FDED3ACDF2B7,
+		    0x97102BA9D6028B9D, 0x4335DEA27C6227C5 } },
+		{ { 0xBA1150B9F72AD0AE, 0xA4963B7DBD024002,
+		    0xE4EDC1AF27F6BDB9, 0x31EEB31EE7CDE76F } }
+	},
+	/* 28 * 2^0 * G */
+	{
+		{ { 0x87C3108B6E63197E, 0x81C454EBC941E739,
+		    0xA4B61AA867763009, 0x271F7DAF517962B9 } },
+		{ { 0x58AFD11D737A7B8E, 0x6422A65AC2B48A33,
+		    0xCE0D165B000EFD92, 0x0912E522B5125A71 } }
+	},
+	/* 29 * 2^0 * G */
+	{
+		{ { 0xA6E9DC9B5E2D2399, 0xE02B1476117C121F,
+		    0x13CCC1EBD683A825, 0x5EBADE7F092595BD } },
+		{ { 0x7EAA3DF6BA291608, 0x9D15485F01FF7806,
+		    0x55C6235FC5A79920, 0x2F24795083128E8A } }
+	},
+	/* 30 * 2^0 * G */
+	{
+		{ { 0x031113B8CBF1C5D7, 0x012339A29E4EF387,
+		    0x2A7799B02CFD3FA9, 0x4E21C55DA38490E4 } },
+		{ { 0x0340EC0DD1023C80, 0x092F97BA47D59E65,
+		    0x49634E32BDF39303, 0x72499FBF5B19EBAC } }
+	},
+	/* 31 * 2^0 * G */
+	{
+		{ { 0x58F5498BFB942391, 0x3F02A1C2698B9ECD,
+		    0x3874F3E1DE9E863F, 0x2B1D5A330ECA574D } },
+		{ { 0x50586AD6A51A1A6A, 0xEC7FDDCC902D898D,
+		    0xAC6552F3787C082B, 0x29A869E9B11873D0 } }
+	},
+	/* 32 * 2^0 * G */
+	{
+		{ { 0xCE344EACF26D5519, 0xFC5F45BC422E9009,
+		    0x20FF78D1B0BF1E6B, 0x40A1F8EC9130C405 } },
+		{ { 0xCEF534831FD080FA, 0x61224DE97E43B47C,
+		    0x42946CD9C4D12EE2, 0x510DB9CA7A936C0F } }
+	},
+	/* 1 * 2^24 * G */
+	{
+		{ { 0x697B9E7B73E3A0CA, 0xE7085AE6C421999C,
+		    0x074D1124D1B3A357, 0x1A4CB8FFDFC7FA1A } },
+		{ { 0xFCA593AA46D6982D, 0xE9EA36290182C270,
+		    0x154A1B59098EC001, 0x0FFE4AA8D3DE0904 } }
+	},
+	/* 2 * 2^24 * G */
+	{
+		{ { 0x55E798B263A11FF6, 0x0481B5C90455C40C,
+		    0xB716A0F516EAC232, 0x67A6416684CEAC63 } },
+		{ { 0xC8FB62022887C7B6, 0x3BD39C49AF580072,
+		    0x4140778AD3A90820, 0x4463B7B19D5088A2 } }
+	},
+	/* 3 * 2^24 * G */
+	{
+		{ { 0xFC609B5EFFAC0CAB, 0x69878775DD8B1B45,
+		    0x077F9FD0856DD67B, 0x4478FACACC209218 } },
+		{ { 0xF87E904D08A52C60, 0xB2B2FF5AE64BE294,
+		    0xB691FD6DA7DA9FFD, 0x0FC1CE2EEC6601A0 } }
+	},
+	/* 4 * 2^24 * G */
+	{
+		{ { 0xDEE01B0D6C297487, 0xE57A3673F9139CBA,
+		    0x446CA36EBEF85004, 0x59CAC1FD5513F6B6 } },
+		{ { 0xFC50D8F7CFA99CFB, 0x49B4F6349C3E0BBD,
+		    0x529BA1300B8E5394, 0x0DF8BA228293B4FA } }
+	},
+	/* 5 * 2^24 * G */
+	{
+		{ { 0x66BDAB78870B69CE, 0x7CD046EE2C5ED776,
+		    0x4D788EFBE9D9B180, 0x4DD5B3E61927E371 } },
+		{ { 0x70607C5A0C728444, 0x40C0289C6235C9EE,
+		    0x23D13C8E537FB144, 0x7A687BF02AA5BA61 } }
+	},
+	/* 6 * 2^24 * G */
+	{
+		{ { 0x1965B2A7E288A82E, 0x4EE86A79A2DF0854,
+		    0x8467920E1190DB5A, 0x591F3510B88948E3 } },
+		{ { 0xAB04D9D7385D7F95, 0x624B002B3087C4D9,
+		    0x22A365C4FB7444F7, 0x1C374A23990AD76F } }
+	},
+	/* 7 * 2^24 * G */
+	{
+		{ { 0x1AC622E4259EA3FC, 0x0F682EC7433265E1,
+		    0x96AC2146EF2893C9, 0x58E7B55B665B1839 } },
+		{ { 0xD1C53564DDFB0AAE, 0x0351831639F75CAD,
+		    0x2E88095C6D892C55, 0x7ADB2C41891A166D } }
+	},
+	/* 8 * 2^24 * G */
+	{
+		{ { 0x7FC30833FE081CD0, 0xF09AF664FEC61727,
+		    0xC9E4121D354211D9, 0x0FB60690408229C5 } },
+		{ { 0x6CBF30E189E744CD, 0x3CAC65C50A79E710,
+		    0x4AD39DE6A9813A4F, 0x6C74D49100081217 } }
+	},
+	/* 9 * 2^24 * G */
+	{
+		{ { 0x591360695D19A97A, 0xC977F5FE2AB31753,
+		    0xFD434AB4E7A4C702, 0x10E917543739423D } },
+		{ { 0x27AD719E9CCC0486, 0x32E0739CBBEB2484,
+		    0x8F5DE598C4D6F382, 0x5A9C646A9F62CFA6 } }
+	},
+	/* 10 * 2^24 * G */
+	{
+		{ { 0xA807CAA82B72CD45, 0x7D6860448AAD4ECF,
+		    0x4AFB324E9C26C251, 0x1DFA54CA44E3D8AD } },
+		{ { 0xFEA059405D3E80DB, 0xFD9FF97A85ED4D9F,
+		    0x234189AC046C2A44, 0x52A910979FA94D4F } }
+	},
+	/* 11 * 2^24 * G */
+	{
+		{ { 0x48482CEB3AEDB6B4, 0x2E2400BC609F146F,
+		    0xBEA16F4DDACD743E, 0x3FB6B9A109CCFC5A } },
+		{ { 0x681713F9838B2353, 0x1FCA81595286E62E,
+		    0x70BAC1D4970F7821, 0x00F7DB300F377CA1 } }
+	},
+	/* 12 * 2^24 * G */
+	{
+		{ { 0x2BE57FFA2BC3F552, 0x8EAF26F3FD355CE2,
+		    0x675D8F0FBB4BADDF, 0x51153064C1DF9709 } },
+		{ { 0x8C04B72AAC0B5792, 0xEA599C3BF177A696,
+		    0x74F7499B116C4222, 0x7B79FFDB7B202F5C } }
+	},
+	/* 13 * 2^24 * G */
+	{
+		{ { 0x44B6D96A77AF9D4D, 0x7EA61DB033C619BB,
+		    0x70AB23425F0C1764, 0x72E74713396F2339 } },
+		{ { 0x491951FDB19922F6, 0xF1764881984E99B7,
+		    0x3E83140762CF1BF7, 0x05BA81C4EF86A231 } }
+	},
+	/* 14 * 2^24 * G */
+	{
+		{ { 0xAFDFB78E8315EFEB, 0x4BBA69D3B20A368E,
+		    0x82504E8508E180D9, 0x44E970C1DCD9AD26 } },
+		{ { 0xE1CBCE394137D57A, 0x591EB9499706476C,
+		    0x818E34D03D994FD3, 0x094A895252AFAA03 } }
+	},
+	/* 15 * 2^24 * G */
+	{
+		{ { 0xC694DBB9ED607375, 0x797DBA07C1043DE9,
+		    0xD30A642C62D57C3A, 0x3DF98FC3E56B470F } },
+		{ { 0x6A670C5BD0EB464D, 0x9403F05A00A05FE2,
+		    0x3D86636C4056329B, 0x1FC48050148D17AA } }
+	},
+	/* 16 * 2^24 * G */
+	{
+		{ { 0x1E2BBC30F7C520F5, 0xD1D650E15CCA2981,
+		    0xFDB303DD4184B0C0, 0x22DE993E7D39D61C } },
+		{ { 0x9DCA1F2625DD6010, 0xBB111499158626EB,
+		    0x7530BB18433BEE47, 0x0F316861017B170A } }
+	},
+	/* 17 * 2^24 * G */
+	{
+		{ { 0x74D1D99CFAB7533A, 0x5D5359A154BA2CA1,
+		    0xDFD4CAF2A7297742, 0x0E6F2FF33EA3BCA2 } },
+		{ { 0x7CF423E0C04068A6, 0xD3B0E8737A81C89C,
+		    0x229DF0CEEF927D30, 0x3C17B4F93DCD86AD } }
+	},
+	/* 18 * 2^24 * G */
+	{
+		{ { 0xCBD80ADDF5F8FBCC, 0x885374E20976AB46,
+		    0x11848340F4A946D3, 0x7C86669DAE6CF081 } },
+		{ { 0x0DAC98B17550FBAB, 0x7E6A1E92631216A9,
+		    0x288E4706C7484A9C, 0x4E708E197576E7EA } }
+	},
+	/* 19 * 2^24 * G */
+	{
+		{ { 0x7FB8FFCFD5050113, 0xA24B5E8EA0C71A88,
+		    0x800D66190497291E, 0x6431762A39F9BC6E } },
+		{ { 0x88E391201D7297E2, 0x90E6153F46FA87C8,
+		    0x484EDE3A66F566B4, 0x1F1AEA050C4E242F } }
+	},
+	/* 20 * 2^24 * G */
+	{
+		{ { 0x00EFEA31CB2B9B1B, 0x2CF11B45244467EE,
+		    0x4FB7F1C62B60983A, 0x06D469CF2001ABA6 } },
+		{ { 0x58C7CAD59ACA3874, 0x92D8292DA710681B,
+		    0x72084F7DD4C981C3, 0x366EE2BB52244294 } }
+	},
+	/* 21 * 2^24 * G */
+	{
+		{ { 0x345BD85E93BEC6DD, 0x9AE9619C23BB80F7,
+		    0x5BAE41EDF003FD4C, 0x01B24C8DED73B178 } },
+		{ { 0xFFC16CE6FE84D1BD, 0x41AF37BB4FB8053C,
+		    0x5DB39C3FB09D656B, 0x6EEAB3420A84186B } }
+	},
+	/* 22 * 2^24 * G */
+	{
+		{ { 0x247B66660580B9EC, 0x4EB74B198BB77DE3,
+		    0x510434DCD52C284B, 0x1F475B95EBDEEF2B } },
+		{ { 0x8A65E29CA3F85191, 0xE123F1BEE1D884EF,
+		    0x3E09BE8175277629, 0x09E0C3B66F4C2909 } }
+	},
+	/* 23 * 2^24 * G */
+	{
+		{ { 0x7FC6EF758C811EC5, 0xEEDACCEC590EBCF8,
+		    0x9A997C0C8648A8CC, 0x3CF943BBE55CC928 } },
+		{ { 0x559F6F2343ABA2EA, 0xE94A852F63917537,
+		    0xF32ED98615E9A97E, 0x5D787C535D8A93C9 } }
+	},
+	/* 24 * 2^24 * G */
+	{
+		{ { 0xC0E90CD283D95176, 0xDB69DADE9D7E200F,
+		    0xB02FC7F62689A746, 0x2A88864434ADDFBE } },
+		{ { 0xFAC5FEF9F9616B83, 0xB4B0D5752571210B,
+		    0xDBD3AAC871E23729, 0x2ABE2E06AE04568D } }
+	},
+	/* 25 * 2^24 * G */
+	{
+		{ { 0x279C71D690C2C803, 0xA4DE34D569C0609B,
+		    0xB4406B27D31A1552, 0x01429E02888DDBCA } },
+		{ { 0x86154838D4031996, 0xF85756C179EB75B8,
+		    0xDBAE0C14D5EE4FC4, 0x7B850290BA05483C } }
+	},
+	/* 26 * 2^24 * G */
+	{
+		{ { 0x9E9F806EE2966AE4, 0x4BB8E818E2B77D1B,
+		    0x302ACD3FD45508BD, 0x76CAAA277972E826 } },
+		{ { 0x05374E158E8FE4F4, 0x072330752EC5DA7A,
+		    0xC4C539B0A769CE9B, 0x4B35BA8F4BA9CBE0 } }
+	},
+	/* 27 * 2^24 * G */
+	{
+		{ { 0x33C1D42652ACFA01, 0x5C5EA13E75BF6E60,
+		    0x4431D8B4293D114B, 0x0F6BC830AB285C3F } },
+		{ { 0x348FE6C9D32A3C40, 0xF58F4CA97F680CBF,
+		    0xF361D85893E36EA1, 0x49C999FF8F8240D6 } }
+	},
+	/* 28 * 2^24 * G */
+	{
+		{ { 0x60B3759F86D72F78, 0xECE5E52FEAD8836A,
+		    0x3BD596AE00ECE01C, 0x5F23A11E0EE78E79 } },
+		{ { 0x453C42205E020E80, 0x835E34530517CBC6,
+		    0xA0BCFDB1C7EB977A, 0x4D0CEA3C9E440832 } }
+	},
+	/* 29 * 2^24 * G */
+	{
+		{ { 0x1CF4C21A7A575C40, 0x0BBC182FE58E7B61,
+		    0x80F1D105A3D5D103, 0x046B54F4938561C3 } },
+		{ { 0xB306A0ED3949EC7B, 0xD84C38BF93FCED50,
+		    0x10F2848E3C31ED5C, 0x19C641460766822D } }
+	},
+	/* 30 * 2^24 * G */
+	{
+		{ { 0x9A9D1A7ECE39DD23, 0x503CA6901B99CB0B,
+		    0xA62B65EA2CBF75C8, 0x14EE89A4475A5387 } },
+		{ { 0x03B038C020D23259, 0xBB857A6C8F911B91,
+		    0xA426D10117697B08, 0x7AB5E87EB0B828A4 } }
+	},
+	/* 31 * 2^24 * G */
+	{
+		{ { 0x06DE3C0BD76DA3CE, 0xE2E39AF19CD48C75,
+		    0x8756F00DADEC78A1, 0x31855F00F3CA8702 } },
+		{ { 0x64897E65689919CF, 0xF80FCDDD14DD33A8,
+		    0x3FC16DC8E084B984, 0x4B2DC2BA509994F9 } }
+	},
+	/* 32 * 2^24 * G */
+	{
+		{ { 0x8CA3EEDDD9EB20A5, 0x15C3FD19A792321B,
+		    0x574A33357587CB86, 0x392C6D70EA64DD2A } },
+		{ { 0x8519D64344AFD226, 0xB4754F3554C3E01D,
+		    0xC6407883FB766604, 0x4DA53FD13A4B8315 } }
+	},
+	/* 1 * 2^48 * G */
+	{
+		{ { 0x0A86FCFBB8C3C407, 0x7E58D9A4F843E886,
+		    0x0A6E4E0FAD184A5C, 0x22786100E09E9C5C } },
+		{ { 0xA173A66ADAA9BA41, 0x3FEBD0D4BE520CD9,
+		    0xD4F5B048AF4EDD17, 0x5732340D8386A51A } }
+	},
+	/* 2 * 2^48 * G */
+	{
+		{ { 0x2787B4E21887E4A0, 0x7A0BF2B9E51ED96E,
+		    0xBD4BF1D7AD9B15DE, 0x054395B9DB0C807D } },
+		{ { 0xFFD98B7A8ED63E01, 0xAE84972F99D9FE50,
+		    0x57435FED7223BB2C, 0x78A978902ED87B58 } }
+	},
+	/* 3 * 2^48 * G */
+	{
+		{ { 0xAECDFD11B0E60822, 0xAC62A3602A04585D,
+		    0xE5F99E8DA8A16C6E, 0x05BEB15789887A09 } },
+		{ { 0x4A4C2620B87A4D00, 0xF0FFAAB1030859EA,
+		    0xA6D72B92B7460017, 0x246D88E620562D1B } }
+	},
+	/* 4 * 2^48 * G */
+	{
+		{ { 0x4399CE681293D33C, 0x7BD94CF88B4B58A7,
+		    0x6ECFCEBBFEC2E894, 0x1A7C2E15D644161A } },
+		{ { 0x66384F31C49DF500, 0x6605C9E160D2061A,
+		    0xB557C1CCBD032754, 0x2F30CC489D80B960 } }
+	},
+	/* 5 * 2^48 * G */
+	{
+		{ { 0x0A5312AC9A7A9649, 0xBF177FDFDB646658,
+		    0xCA79A4ECFE5D40AC, 0x139C53C3A15628B3 } },
+		{ { 0x3C889664C46D6C92, 0xD9B23F7EC5EA2761,
+		    0x6EE5E9AE9075E8F8, 0x7686B7302FD98622 } }
+	},
+	/* 6 * 2^48 * G */
+	{
+		{ { 0xC377028D15CF1EBB, 0xC7F1060791411FF6,
+		    0xA5EE240D7DF7700A, 0x54D2C862F9C2BEC6 } },
+		{ { 0x97FDF79A7733A0C7, 0x1F636457959E1388,
+		    0x7E67F9B2F14706E1, 0x74B1B091E0676C32 } }
+	},
+	/* 7 * 2^48 * G */
+	{
+		{ { 0x8417FC856EC91013, 0xCF5DD093157123A1,
+		    0xA5BF544489F175EC, 0x6D96A75B181260BC } },
+		{ { 0x79FD46689068B6BB, 0x1B0A154F0633A60E,
+		    0x489E45C595DC192B, 0x5C2ECB0EEF0A82C0 } }
+	},
+	/* 8 * 2^48 * G */
+	{
+		{ { 0xA9602E6D3C70F29E, 0xCB21AC390737A357,
+		    0x7D49F46A50F6E6AC, 0x54536BA5F9EDC2AB } },
+		{ { 0x0EA12E2D600EFB55, 0xE7DCEAA891ED2244,
+		    0xE24365263B4F4682, 0x13A2A70E520132D2 } }
+	},
+	/* 9 * 2^48 * G */
+	{
+		{ { 0x5616678E61C72D9A, 0xBC17692054DB5186,
+		    0x45556FC786F990B7, 0x1CCD0A2DA5A9D75A } },
+		{ { 0xA4A2078A9CD7F3F1, 0x4B70C883D5E9E3EA,
+		    0xCB2932A35E773BD0, 0x383779BDC4AD3C5A } }
+	},
+	/* 10 * 2^48 * G */
+	{
+		{ { 0xEC19EA4156C31D8F, 0x42586DCAA67AA776,
+		    0xCBCF1FA0627C57EC, 0x58B26F63324D6012 } },
+		{ { 0x84E3691C261FC264, 0x0B1585457C327F26,
+		    0xE07F06A7F4599629, 0x308299093997DBA3 } }
+	},
+	/* 11 * 2^48 * G */
+	{
+		{ { 0x2CDF011D60861EAB, 0xA8356C061401D12C,
+		    0x6BAA9D00E236412C, 0x74BDD5ED0C5C9DA1 } },
+		{ { 0x584F7D9BCFDF8A9E, 0xB411CE349B68DF17,
+		    0xC107EE7692EBC681, 0x732CF97E43366E80 } }
+	},
+	/* 12 * 2^48 * G */
+	{
+		{ { 0xAB9D2EE1B089EB98, 0x6DC9AFDA94764480,
+		    0xC0DD96112C9FD9FE, 0x3DFDE31BADE89C18 } },
+		{ { 0x8CAE4F50FD019D44, 0x67E8320CAC698AD4,
+		    0x20B953CD82CE8599, 0x2685F6A58513BB7B } }
+	},
+	/* 13 * 2^48 * G */
+	{
+		{ { 0x2EC716452ACFBD85, 0x36F53761835CD58A,
+		    0x399508F5A21F03C7, 0x07CD80A845B34257 } },
+		{ { 0x1B6969A825D2D185, 0x97F09B89E8A996E4,
+		    0xA890F0E76E550B8C, 0x784C84F076C462F3 } }
+	},
+	/* 14 * 2^48 * G */
+	{
+		{ { 0x2E16973C9615E6D8, 0x9F9C7D193EE6FE55,
+		    0x5441B99BEA8EBFC6, 0x7D7905B6F6D5C1F9 } },
+		{ { 0x29787FE34FABCE7B, 0x45F4DDA042E89D79,
+		    0x048FF812E524E689, 0x06D5DAECC43B9AFB } }
+	},
+	/* 15 * 2^48 * G */
+	{
+		{ { 0xDABC78411EFE10B0, 0x5E80DD3681021DF9,
+		    0x1961B98A73BC9080, 0x0791F999BB754153 } },
+		{ { 0x210E88618A9F5266, 0x1635A586DB8A9ECD,
+		    0x813C3824BF299011, 0x36E00130A521C208 } }
+	},
+	/* 16 * 2^48 * G */
+	{
+		{ { 0xA287D1C545964330, 0x38BB0D311FBB12D2,
+		    0xED61F06B4C35AA19, 0x6FF23A1B1CDDE7A8 } },
+		{ { 0x650E7C1E4E531CC6, 0x76A20257F57796D0,
+		    0x3E7EB3D236672F75, 0x72A262773AF3C16F } }
+	},
+	/* 17 * 2^48 * G */
+	{
+		{ { 0xACEF0AD2955F6B6B, 0x1A5656D8402377C6,
+		    0x3BB58E8170DC70AD, 0x5106E70FA6FE65C6 } },
+		{ { 0x982DBC4FCBA452A4, 0x55EE7621CCFFBEB8,
+		    0xC2E8A8136D9279DC, 0x1CBED29247DC90A5 } }
+	},
+	/* 18 * 2^48 * G */
+	{
+		{ { 0x60A9D260C8A69279, 0x72B467C63836516A,
+		    0x45FD119FAA5C6AB6, 0x1568E4EB4FE6A3B5 } },
+		{ { 0xE3D7C637665F9A3C, 0x33837C6BA127A382,
+		    0xED1212269FD65DB4, 0x2A17127DA0AA6E99 } }
+	},
+	/* 19 * 2^48 * G */
+	{
+		{ { 0x0E14F757A7FCC275, 0xB8C18433260972C5,
+		    0x676BA4DCBB148BE4, 0x550506F7D962C431 } },
+		{ { 0xE224D081F4E73AC7, 0x4C08DEEA70C3B371,
+		    0xE9149EB9E02B6DEE, 0x76292F7030CF162D } }
+	},
+	/* 20 * 2^48 * G */
+	{
+		{ { 0x32F2B0A34E82C9E7, 0x09C671D623D040F6,
+		    0x470D6B5EA3F47C64, 0x5F04980BB396632E } },
+		{ { 0xE2A8E7C80BDA1046, 0x2875259B63447455,
+		    0xB7FC40C38639DE1B, 0x78BD43ADF185A415 } }
+	},
+	/* 21 * 2^48 * G */
+	{
+		{ { 0x3EC5962A39CC2FF1, 0xB1337B52F7E2C869,
+		    0x017B2A720915B8DA, 0x32B422EB81475544 } },
+		{ { 0x5595B0090A078E7F, 0x90C83C6160C52F86,
+		    0xF7DD9D530C67E8FD, 0x1F6B022ED0A00336 } }
+	},
+	/* 22 * 2^48 * G */
+	{
+		{ { 0x49386C2C0FA51FE9, 0x60C85D597FAAB743,
+		    0xC0D5AE02CBF85D99, 0x51FFE8BD9A9A4AAE } },
+		{ { 0xE686FDCE7D7FE715, 0x4217C9FA44D1034F,
+		    0x3A38D1CCE4EF741F, 0x359E1C7200CEBCAC } }
+	},
+	/* 23 * 2^48 * G */
+	{
+		{ { 0xB1B7299FCB0ABC6F, 0x3B351786C7C98F2A,
+		    0x6FDF9D40E0B73BAE, 0x45ADC6EBB665872F } },
+		{ { 0xC2BB8D883A025A2B, 0xF491590072DBE34F,
+		    0xBC0786D522BCA8B3, 0x764BD2B99E7FCE68 } }
+	},
+	/* 24 * 2^48 * G */
+	{
+		{ { 0xCFC1579422D89306, 0xBD28B19B67645671,
+		    0x4D5C2F89E51E5B9F, 0x2990F7DCF2DFEEA2 } },
+		{ { 0x5BA2B8E524B93887, 0x0CC0B88776213EEB,
+		    0x15E1E4BA4C6D3C83, 0x3F1B45C1A2FD97B0 } }
+	},
+	/* 25 * 2^48 * G */
+	{
+		{ { 0xCD17056EBD54D7FA, 0x2BD9D396040A00E2,
+		    0x1EDB297822842027, 0x511E8B9C2CE6E4AA } },
+		{ { 0xF1F5273F4E9A6603, 0xADC20A5486C359EF,
+		    0x28FE3E388E6F385A, 0x679508EFE366D35B } }
+	},
+	/* 26 * 2^48 * G */
+	{
+		{ { 0xF6534424A6873CFE, 0x98BA152875BF8058,
+		    0xB7B908586F2147B1, 0x5BBB11EDC2CBAD18 } },
+		{ { 0x4EDEF134A1EDA6CF, 0xD5DB60EB5954C600,
+		    0x6801ED68100678A8, 0x16A2FFCB089B999D } }
+	},
+	/* 27 * 2^48 * G */
+	{
+		{ { 0xEA23A4A6945749E9, 0x0A686460FF8157D3,
+		    0x4DCD3A1B573DA10D, 0x35CB6B43CB94B443 } },
+		{ { 0x3E8CD47F4AC759B6, 0x97CEA36DCE47D085,
+		    0x5F4008FF28FDB4CD, 0x67A093104E956E0D } }
+	},
+	/* 28 * 2^48 * G */
+	{
+		{ { 0x7F6B76E9E1107444, 0x5A203B3C41C61F8C,
+		    0x805767EC1AAD0FB0, 0x1CC621D2ED92B12C } },
+		{ { 0x76B2BDF8AE08255E, 0x3F969DC4B2F85ED3,
+		    0x2F6F6076A4356F89, 0x7C44BDDB918F08BD } }
+	},
+	/* 29 * 2^48 * G */
+	{
+		{ { 0x7AE20679D16CF098, 0x9212984EE65DD072,
+		    0xBE96EDEF6DEDB8E6, 0x539F99FAEAF92CD7 } },
+		{ { 0xB8D537F402007C8B, 0x8961108D6896F8D6,
+		    0x69EF184BB543AA57, 0x1C0B9CBB630DBC47 } }
+	},
+	/* 30 * 2^48 * G */
+	{
+		{ { 0x2B3D009ACCAEB333, 0x655494A62B5CCE45,
+		    0xB4342654E1D1619E, 0x04F063A1AEE9E584 } },
+		{ { 0xD50AF44982EA3DDA, 0x517290DFBBA87EFC,
+		    0xECC71B837567FA8B, 0x1F992EA3FA1728E2 } }
+	},
+	/* 31 * 2^48 * G */
+	{
+		{ { 0x18E5CA6C7083D025, 0x7A4C087D085E4396,
+		    0x9C70F68E359C8E7C, 0x6BEF82A4E43E02A7 } },
+		{ { 0x552660F107456008, 0x87004704F93FC1DF,
+		    0xC2BA38A74D433848, 0x34887DD8FFA15BF9 } }
+	},
+	/* 32 * 2^48 * G */
+	{
+		{ { 0x04FB3E38671AB904, 0xD2444A72EEF782CA,
+		    0x590ACC3288082C00, 0x550B175F20CEEA0A } },
+		{ { 0xECFFF39622E73B1E, 0xD28C96CAC0564279,
+		    0xFBF9A95F78672981, 0x731444969B535DFA } }
+	},
+	/* 1 * 2^72 * G */
+	{
+		{ { 0xF2FC626ABCF06D5B, 0xD8761B65F14AB11D,
+		    0xD65FC6DBD25B59BB, 0x7546F1722E88789F } },
+		{ { 0x3C96D6D8F51FAEA7, 0x4B2C8537689A77E5,
+		    0x2CA66A54E8B2436C, 0x5EB84418689BBE93 } }
+	},
+	/* 2 * 2^72 * G */
+	{
+		{ { 0x1E0999BCE9EC47BF, 0x2E3FFF82EE0489AB,
+		    0x2FC4ADA0C51A3A84, 0x2933119FD757DFF3 } },
+		{ { 0xF65270F8CE559911, 0x20646F4A47B7E25A,
+		    0x3C7EAAEE2EA2A272, 0x63FA228E2B38F53A } }
+	},
+	/* 3 * 2^72 * G */
+	{
+		{ { 0x1981A2BE524CB1CD, 0x953B6D6685F66559,
+		    0x14A5E5E40BFB9BEB, 0x3B9C237FFA60AEEC } },
+		{ { 0xFE27AFF39D251757, 0x889F7F7323A956EC,
+		    0xEE041CD5B1D4B4EE, 0x205FC70E85553A35 } }
+	},
+	/* 4 * 2^72 * G */
+	{
+		{ { 0x9AC025FCA58DAF3A, 0x1E96CFBB677223FD,
+		    0x22325DC74E427EB9, 0x41F6535433CF76BC } },
+		{ { 0xD366E65625008E3F, 0x85E37656779A949E,
+		    0x3326209DCDD7924D, 0x2FD3F3DC674A9E55 } }
+	},
+	/* 5 * 2^72 * G */
+	{
+		{ { 0x6BC7DDCD944DC02F, 0x027495E92F11BF4C,
+		    0xBED325F2A27EF870, 0x104D36FBB444E570 } },
+		{ { 0x42B96671479410C0, 0xE6D3D93215DF6DDD,
+		    0x80CA3843821C4B8F, 0x48E8A1281A71850C } }
+	},
+	/* 6 * 2^72 * G */
+	{
+		{ { 0x9B27CE28CC03E41D, 0x4D629AFE653B0D4E,
+		    0x8CE40273B42AE63D, 0x4CABD83505B696C9 } },
+		{ { 0xF10733FE386F3B6C, 0x9653E386FEA16914,
+		    0x4429882311B25535, 0x30BE9B2121101C12 } }
+	},
+	/* 7 * 2^72 * G */
+	{
+		{ { 0xBEABC135B6C66D49, 0x30072CACD6385818,
+		    0x66A9BE695381E0B0, 0x48C7EBF6EB1EF605 } },
+		{ { 0xEC4EBBC99B9B5D2D, 0x19489B90C33E851E,
+		    0x4BCC0FFC9C8A2007, 0x2F010F31207367FF } }
+	},
+	/* 8 * 2^72 * G */
+	{
+		{ { 0xA1039AD19578BD90, 0xF63F6C4A16550E4F,
+		    0x8A9EA069798885F1, 0x37904A16111C4CDC } },
+		{ { 0xD445891E32FAE3C7, 0xF47A31EE41C931D8,
+		    0x4CE939DE85C60AB7, 0x10D869E5A16C5248 } }
+	},
+	/* 9 * 2^72 * G */
+	{
+		{ { 0x3309C28E16212001, 0x829CB266E362EF91,
+		    0xD0A1B17A94B439FE, 0x02C61A8DA0CA34EF } },
+		{ { 0x5582BF011C090BF6, 0x7502B371A4F23DB1,
+		    0x75F416A23ED4C99B, 0x53781644EBA846C2 } }
+	},
+	/* 10 * 2^72 * G */
+	{
+		{ { 0x762AAA47D9B3F982, 0x3BDF8427C4526109,
+		    0x62AA93331DD1EFDF, 0x4C212EEA7CBC16CC } },
+		{ { 0x9E15513AFE7D50FE, 0x66AD48356C4DF85F,
+		    0x6D1EA9A374E1D5FB, 0x62557BD49CE5DE4E } }
+	},
+	/* 11 * 2^72 * G */
+	{
+		{ { 0xA7303D841E9A6523, 0x5E9B656A7140B0B0,
+		    0x41BA59B6DC9E6DCE, 0x384D5E31DF84B260 } },
+		{ { 0xD3EFD3820C197DE0, 0xBDE06DB2405AD438,
+		    0x4861712C0C540484, 0x6780D4B7F7792B8C } }
+	},
+	/* 12 * 2^72 * G */
+	{
+		{ { 0x3ACD53EB6E545EE4, 0xCFA0144B5E88A914,
+		    0xBFADED5D83F8B3BA, 0x6BDD2C47FC9FDEE5 } },
+		{ { 0xBB33AC2F0FB62D42, 0x50DF6BE6F2ACD5BF,
+		    0x89969D24D6ACB304, 0x20F2D88CA6504562 } }
+	},
+	/* 13 * 2^72 * G */
+	{
+		{ { 0xE00EF9B03FD4D9CD, 0xFF4577C470F22EB2,
+		    0xD6457A518E7349ED, 0x5D8535061C48CC01 } },
+		{ { 0x01EBBC672CD0605B, 0xCE1CBD4740DEF2F4,
+		    0xC116292B9260BCD3, 0x1BB99495A2769FC8 } }
+	},
+	/* 14 * 2^72 * G */
+	{
+		{ { 0xFA79FC3BF26D956B, 0xFE52823D6AA25CDD,
+		    0x5FFCA0D668815CB0, 0x10078F52A797A467 } },
+		{ { 0xC79BEBDB1DCBE9C4, 0xECDA798F4391C29A,
+		    0xB565C6478A85EF9F, 0x5D9DD77E36842311 } }
+	},
+	/* 15 * 2^72 * G */
+	{
+		{ { 0x82E4D6B2A8F41EEE, 0x683028EFC64E448D,
+		    0x5FF4BA0E7DEBE73F, 0x4543131D767DB19B } },
+		{ { 0x208EA909E19FFCEE, 0x50242F4E73825EEA,
+		    0x059BF929D8119696, 0x58E80CDBBCF4A027 } }
+	},
+	/* 16 * 2^72 * G */
+	{
+		{ { 0xE20DD171C494F451, 0x0283EB986EBCEFE0,
+		    0x5D5C93F0912708E7, 0x4CA02DCFFEE23EF6 } },
+		{ { 0x8F68829D8AD6FFA3, 0x425E5957E39B394A,
+		    0x9C0F8AFC44505CEE, 0x0AD84A5D87F89E43 } }
+	},
+	/* 17 * 2^72 * G */
+	{
+		{ { 0x1EF728C747F2C9DC, 0x3F403689F84274C6,
+		    0x88EDF5005ADD1F5F, 0x4AC1B1DB6E41F931 } },
+		{ { 0x3FBB22AEE196A795, 0xE5613AB20646DB43,
+		    0x94D244FFFE7DD7F7, 0x1BDDE7FD2A991A52 } }
+	},
+	/* 18 * 2^72 * G */
+	{
+		{ { 0x4E66B4BBB8104C7F, 0x849BA4EF1F044BE3,
+		    0xEF6ECC8C760B0EBE, 0x66F7C9EF2DFD4A0A } },
+		{ { 0x83715A56EC80A171, 0xB2B1E4B9CA4A443E,
+		    0x0721A813A8BB2418, 0x3A9676F06CA76168 } }
+	},
+	/* 19 * 2^72 * G */
+	{
+		{ { 0x6124A301D40A4731, 0x494CCCF85BF18B32,
+		    0xA6824989263152A0, 0x2A82B6C8219C5B7A } },
+		{ { 0x7E56C8D8F934888C, 0x8AB85D559E7FD4FA,
+		    0x92AAAA855ADF988F, 0x41CC347E1F606E30 } }
+	},
+	/* 20 * 2^72 * G */
+	{
+		{ { 0xDEF6DB2FC0F5A435, 0xED25BDA72F3C15CE,
+		    0xBC75E481654F8911, 0x39B87255F7286786 } },
+		{ { 0x7E7F3212818ECD02, 0xCDF5C864F5EDAD33,
+		    0x44FB874BF750D15B, 0x79E64BDAA6C0E1D8 } }
+	},
+	/* 21 * 2^72 * G */
+	{
+		{ { 0x729179616A2EDC7C, 0x9F3424D3DADBC5A4,
+		    0xA0B170660A0982A6, 0x7206E4A787245339 } },
+		{ { 0x345D6939E72A9ACF, 0x965E7176CDF5780A,
+		    0x1719B128B980B662, 0x679B9FFD11C03D6F } }
+	},
+	/* 22 * 2^72 * G */
+	{
+		{ { 0x3811D3752DCAB9F2, 0x88736BC2606704E3,
+		    0x789FD75F78ED1729, 0x5FA60A1F3AD3510F } },
+		{ { 0xF126E525257BCE51, 0x85D8F21230E571C8,
+		    0x07935C19BBD77E99, 0x612BFA505818A1FE } }
+	},
+	/* 23 * 2^72 * G */
+	{
+		{ { 0x34E5E052A682A92C, 0x79E1859D0C91DEDA,
+		    0x0C1B78F22BCB75E1, 0x4D06AFB34DF21D13 } },
+		{ { 0xB9770E27FB152930, 0x476C3FD07FEFB56E,
+		    0x344A6BA5FCB7B7E3, 0x774C03BB094A4A41 } }
+	},
+	/* 24 * 2^72 * G */
+	{
+		{ { 0xDA31F243AFB44C9D, 0xC2BE0C76CE2A1898,
+		    0xC99691DD6C456DE4, 0x050966369438AAF4 } },
+		{ { 0x2923173CAC2CEB7A, 0x6ECF44F56AF0F9A0,
+		    0x70A8D9A9004D2BF2, 0x612720E2A6773CDB } }
+	},
+	/* 25 * 2^72 * G */
+	{
+		{ { 0x28C6C17A9165D822, 0x85589032341D9BFD,
+		    0xA64086EC47B8F097, 0x05A7FDE8A8CC5817 } },
+		{ { 0xE75B21D289FFA2E2, 0xD06B434D564169EF,
+		    0x61D37A6BE3307546, 0x16D825482DE580A1 } }
+	},
+	/* 26 * 2^72 * G */
+	{
+		{ { 0xF71D5F07CA94B921, 0xF30353FB3A62002D,
+		    0x085EECBD3C92F8A5, 0x5B6E2FF8A102CAB5 } },
+		{ { 0x1B60E03D4E5BE873, 0x71894FAEF3DB77C9,
+		    0xE7475AB2867EE04D, 0x66E7445E608731BF } }
+	},
+	/* 27 * 2^72 * G */
+	{
+		{ { 0x5EF772FC31964991, 0xCED5557D41C79B64,
+		    0x58F9FCE49EEB07A9, 0x3620858AA49F9701 } },
+		{ { 0x042A26965D0A6253, 0xB1733EEA3940482A,
+		    0xA51722509A6A6404, 0x733629D977F82EB2 } }
+	},
+	/* 28 * 2^72 * G */
+	{
+		{ { 0xFCAAE3508781A596, 0xE298B67944F9572B,
+		    0x3B00685337533AC1, 0x106F95906DFE8A4E } },
+		{ { 0x5824C57B1B4E8402, 0xC8A2F3B1AEAD83AE,
+		    0xA92872ABFEE3D997, 0x12D6640D93BB3996 } }
+	},
+	/* 29 * 2^72 * G */
+	{
+		{ { 0x589023F7429B2E53, 0x5ED3D484AE70CD6A,
+		    0x7CEC377DA49AA5FC, 0x3D456521FF8BC835 } },
+		{ { 0xC892A6AD1E7C44D0, 0x180D9F2520F81061,
+		    0xC055E60A58792BE8, 0x6F5C213F7D15CF2D } }
+	},
+	/* 30 * 2^72 * G */
+	{
+		{ { 0x9E706A721D799F59, 0x171D00D477B5D448,
+		    0x0EC6B69800FD9B94, 0x4898F306286C1671 } },
+		{ { 0x30B332F3B6ADC5B9, 0x71DEE775873B44F3,
+		    0x658B520DDD50F6DA, 0x21237EC1DD49381F } }
+	},
+	/* 31 * 2^72 * G */
+	{
+		{ { 0xD91CBD7F44CBCE53, 0x7DE9A85369501923,
+		    0x467F44B5A39912B0, 0x40B13A6444FC4302 } },
+		{ { 0x812FFFF1AF20DEC1, 0x7EB96297E1843A40,
+		    0x8A88B6B1D2F1EC2E, 0x3C023EE91104B6BE } }
+	},
+	/* 32 * 2^72 * G */
+	{
+		{ { 0xCAE77A6BD3A0CEAA, 0x5CB44DF3A10B8972,
+		    0x5113548568FC0877, 0x7D87A3BEE04AAB8E } },
+		{ { 0xBCCD296F658AD41B, 0xCB54BE886314BD63,
+		    0x1D738A69937DACA6, 0x0188AA58CF3D06B9 } }
+	},
+	/* 1 * 2^96 * G */
+	{
+		{ { 0x20B101D83CAC4D1F, 0x53607CC3D2B3D76E,
+		    0x01A762CD7FF1E001, 0x42DDCF5AD33408B0 } },
+		{ { 0xD908D89CC478161E, 0x19F155C4BFBAD48A,
+		    0x7F7769551FC045E5, 0x10F03CF219F5879F } }
+	},
+	/* 2 * 2^96 * G */
+	{
+		{ { 0xFEA075A70F5D57BA, 0x3EFDD3C5F3EFF86D,
+		    0xD6D8FA58074C0C84, 0x7F867CF42B7DA0CB } },
+		{ { 0xAC0F4B920E4FA612, 0x47C58E9C90D39944,
+		    0x9359947EB9E97DBA, 0x43B86F34C357E958 } }
+	},
+	/* 3 * 2^96 * G */
+	{
+		{ { 0x2B03F99432400B23, 0x6336FEC6E6440500,
+		    0x2482C74F5D1C0F9E, 0x7DD8B2D43AD18E46 } },
+		{ { 0xA077DB770541EA8D, 0x2795DF80D2A83645,
+		    0xD8476142941282EB, 0x3E69CC770F907152 } }
+	},
+	/* 4 * 2^96 * G */
+	{
+		{ { 0xD1AD1DE1A811B52A, 0x14AEF99B4EEF0633,
+		    0x7BC1C4B99BB11455, 0x2AB88D639D444CEE } },
+		{ { 0x1C9B0BAB858299B5, 0x46CF3FB5FE478293,
+		    0xD698CF2438C7EFA5, 0x40AD798516123DC4 } }
+	},
+	/* 5 * 2^96 * G */
+	{
+		{ { 0x336A8EFBD9B44FA0, 0x6E4F30EF7C8E9114,
+		    0x20C93AF14845B3E8, 0x2C475CF142FDA9C7 } },
+		{ { 0x3CC234221CDF548D, 0x3A4552696F926678,
+		    0xCCFD562505C696FC, 0x026F095654415804 } }
+	},
+	/* 6 * 2^96 * G */
+	{
+		{ { 0xC0D4F15C91BE834E, 0x99F219CDCB942B2D,
+		    0x5BC617C07FB950D6, 0x51090B6230D1288E } },
+		{ { 0xF236D5FDB21F1349, 0x6F35C7698F49FD15,
+		    0x0029D35ACB152E8B, 0x761DB68FA4BEC800 } }
+	},
+	/* 7 * 2^96 * G */
+	{
+		{ { 0xDA2F59FFE3D69CF2, 0xE9B1CD5A62D4C1E9,
+		    0xBB618072965B8CEF, 0x403E21A3D788A94D } },
+		{ { 0x239CD9C2A21C54AB, 0x9D141F849984A333,
+		    0xDFC09257E7E800E6, 0x45056174B6747E05 } }
+	},
+	/* 8 * 2^96 * G */
+	{
+		{ { 0x5F96EBDCB73C6A73, 0x372F43F03F3D8F28,
+		    0x565E86AB31E13770, 0x53C15BCDB7437AAC } },
+		{ { 0x61551332D14842D6, 0xE2A8F3A57CDC59B9,
+		    0xC4DB91102F790E2C, 0x5707C8AA8B231398 } }
+	},
+	/* 9 * 2^96 * G */
+	{
+		{ { 0xA1DA7F47F6AE81D2, 0xA3BAE7F947EEADE8,
+		    0xFC53E2EE7BFDF38F, 0x4E19423937A3838B } },
+		{ { 0xDFB9C7B67934ECE4, 0x0744E01C799A44E8,
+		    0xA5F1F36A5EF49859, 0x4C47801097359C2E } }
+	},
+	/* 10 * 2^96 * G */
+	{
+		{ { 0x4BDB091EF7876478, 0x5F773CE5F6FF5CBB,
+		    0x306B223C4C75CC1A, 0x462D657211C549BC } },
+		{ { 0x5F636712161DF721, 0x774C23B9C39FC8BB,
+		    0xA153509B95FBCC48, 0x3183D156EBA2532E } }
+	},
+	/* 11 * 2^96 * G */
+	{
+		{ { 0xCBB08FB2F98F1A34, 0x3D22488E22D73DA9,
+		    0xD1AF575FFB24E2BF, 0x3654FB7E4855E8F6 } },
+		{ { 0x624366A20F91D951, 0xBA15BDAA1B3F4E03,
+		    0xA2679EEB4F4D3398, 0x4C215A5642A78B3A } }
+	},
+	/* 12 * 2^96 * G */
+	{
+		{ { 0x9CC591107B1425FF, 0xB1BD116AE1CED230,
+		    0xE7E0C9E973A197C2, 0x26164093A860A2C4 } },
+		{ { 0x32C3371D9CE814C1, 0x49EA068F013AC345,
+		    0xB8F291855A9B1B73, 0x09B0B73864F0FB7E } }
+	},
+	/* 13 * 2^96 * G */
+	{
+		{ { 0x1D9722A0EDDCB0D1, 0xDD6E85A8778D4BD3,
+		    0xD9BAEF9DEA6B05AA, 0x748C244E42EADD98 } },
+		{ { 0x4EEE3DAB1AF385FA, 0x9ABCA5B9568D92EC,
+		    0xE3ED64FCCE0D1698, 0x3D3D71B88CD64C3F } }
+	},
+	/* 14 * 2^96 * G */
+	{
+		{ { 0x477D6FD45DFC2898, 0x9E4E06F9935D95D1,
+		    0x437D57B4F10EB760, 0x20AE969E61413336 } },
+		{ { 0x6F2C41F3E2D765C3, 0x399968D96B320A7D,
+		    0xE01505C30E5CDB31, 0x01A5D7A942D5B495 } }
+	},
+	/* 15 * 2^96 * G */
+	{
+		{ { 0x0E1920532B8E64CF, 0x3DB0812F981E02F7,
+		    0x17148870C765DD78, 0x462DC80CA9CE440A } },
+		{ { 0x6F3983F2F21021EC, 0x24B3E2709EE5AC83,
+		    0xF0C37F240DD28D42, 0x25754C326D3B5F35 } }
+	},
+	/* 16 * 2^96 * G */
+	{
+		{ { 0xA641245B6694277B, 0xDEC08E28F5FD757C,
+		    0x374AE489FE3A0575, 0x0D7177498763A5EF } },
+		{ { 0xA08406283762FBE7, 0x207C44A64A08CC62,
+		    0x8D460B92CD3A807B, 0x7014D47F89F71A17 } }
+	},
+	/* 17 * 2^96 * G */
+	{
+		{ { 0xC6F8E8958BBCDCF3, 0x4627C15A8CA01258,
+		    0x682128D49F818E7E, 0x1B88D714CFFCE8F3 } },
+		{ { 0xC3264805D968D37D, 0x395C2169DB8E8C28,
+		    0x8CAC8E4977ACCDA0, 0x7B82EBE096782C7F } }
+	},
+	/* 18 * 2^96 * G */
+	{
+		{ { 0x0AB0A1AFA67B2A04, 0x8E9EA5D41D03AB60,
+		    0x05E7B607ACF3B14C, 0x119FD16D723C1AFA } },
+		{ { 0xCB5CFC9451B37350, 0xC7E3CEF8E4B28C73,
+		    0x259D0DDEF2DD3437, 0x53DF72AB98DC7509 } }
+	},
+	/* 19 * 2^96 * G */
+	{
+		{ { 0x5197259A1C0CE513, 0xE5328BB7670F0F83,
+		    0x45A0FB7075BF8C7F, 0x0BBDB038950FC2A9 } },
+		{ { 0xDCC615BBA8799FEA, 0x7C0EA8B7C038455D,
+		    0x128A68E0574B1ABA, 0x5522CCD51C4CE7D1 } }
+	},
+	/* 20 * 2^96 * G */
+	{
+		{ { 0xB08895B960A93464, 0x285AA5D766E9CDC9,
+		    0xD482F635A2EC9108, 0x408A48388803E77A } },
+		{ { 0x997A996A137E0AEE, 0xB10879AD5C304904,
+		    0xB34B4AC6CD70E647, 0x49C53AC0028C3462 } }
+	},
+	/* 21 * 2^96 * G */
+	{
+		{ { 0x5830BAE6F93DA150, 0xE944E069FA7111B9,
+		    0xC2EA5C86D5F39B50, 0x79C7F00013012E0F } },
+		{ { 0x3686E201BB00CDE1, 0x8385034EBFBC4254,
+		    0x9A9C8E38DE8BD167, 0x0DB0106B24B94D45 } }
+	},
+	/* 22 * 2^96 * G */
+	{
+		{ { 0x2F22B0D33C6A28C1, 0x0B8137BBA8D33294,
+		    0xC868BB77AB070EA1, 0x062A6C17D53147E2 } },
+		{ { 0x59C1A351080B05B5, 0xBC3332ACCBD6C34E,
+		    0x2BA87CA0549C7D9F, 0x0380D95A9B2664EB } }
+	},
+	/* 23 * 2^96 * G */
+	{
+		{ { 0x46B16E9C38C359E5, 0x59C57C7C27BB89DB,
+		    0xDBB59933C00F6D68, 0x4E9BB57AAF3D4818 } },
+		{ { 0xD2E04BFF10CA96E3, 0xA6859CF822C12CB4,
+		    0xEA7CC93BAFDDB9DC, 0x36797D1918C074FE } }
+	},
+	/* 24 * 2^96 * G */
+	{
+		{ { 0x304A8B3EC83753D8, 0x462248725AD77A92,
+		    0xAEA2398BE5BA2AE8, 0x2C9198B2DCAD05D9 } },
+		{ { 0x70EEDE88250E3A27, 0x5687A4705BB452CF,
+		    0x5C11A2200B1CA00F, 0x1CC9E106B7349CDD } }
+	},
+	/* 25 * 2^96 * G */
+	{
+		{ { 0x36EABC396DD664A1, 0xA51240B9D617FE60,
+		    0x42988192AAFA5A71, 0x6013E2DF6D4F776E } },
+		{ { 0x3A901171FC2AD0E1, 0xB0A6E9C7F869B3D2,
+		    0xACB0E7288DED882A, 0x1D84D41C535F0156 } }
+	},
+	/* 26 * 2^96 * G */
+	{
+		{ { 0x525A47BAE73601C6, 0x5A177637E3C606A9,
+		    0x753732A1FF0E4E1C, 0x13D15435534431CE } },
+		{ { 0x41CDCB685A41C0D9, 0x288CCA875D44D673,
+		    0xEB4CA8C269F78626, 0x029C5AB64DBECB8C } }
+	},
+	/* 27 * 2^96 * G */
+	{
+		{ { 0x4A894FAA99FFE1C5, 0xE03D9D63A51669C9,
+		    0xC735C43C836FA3C8, 0x6414B297EA5BB0CE } },
+		{ { 0x2374AFEFC77A4475, 0x5843F9879FF73E4B,
+		    0x442E90D401AF10F9, 0x05131F6464232CB0 } }
+	},
+	/* 28 * 2^96 * G */
+	{
+		{ { 0x823C6FAC31E32D39, 0xBD09D7AD89CA19B2,
+		    0x01D3CBA81C6BEB0E, 0x5F33F416035D19AC } },
+		{ { 0x08A2BC5F92C58894, 0xE0E44DC628EE2BCC,
+		    0xDA751356753A357F, 0x2165162BBE365AF9 } }
+	},
+	/* 29 * 2^96 * G */
+	{
+		{ { 0xEE7F9C3F3B25BCAE, 0x0654A62E3AFCDAF1,
+		    0x75EBFE45E7416790, 0x6C5D2906CCAC8243 } },
+		{ { 0x1562763B7674EF98, 0xDE68C3D691790670,
+		    0x10A299857E8EC878, 0x1D12AEB1E07D2B46 } }
+	},
+	/* 30 * 2^96 * G */
+	{
+		{ { 0x3A28463266EAEF7A, 0xA8AE31BDA0D81EC3,
+		    0x7BEAE68B016247CA, 0x78F22FFD045071AC } },
+		{ { 0x39BBD04B123D4C85, 0x0392DDDAF8679BCC,
+		    0x5B9FE31F10CC1889, 0x7A81F167A2A9350A } }
+	},
+	/* 31 * 2^96 * G */
+	{
+		{ { 0x1EC2D5994C769663, 0x4DA0EB3E78BC71F8,
+		    0xBD842029FAC292C1, 0x0AD5AAAD9C3BFE30 } },
+		{ { 0xF7C70CC762B23BCE, 0x47D1185F4861C188,
+		    0xA3DB36A3525B7359, 0x4AB59D623D6EBAAB } }
+	},
+	/* 32 * 2^96 * G */
+	{
+		{ { 0x4C9BD3410425A76B, 0x5CF87E4F4B4D0C87,
+		    0x496752BB89E71857, 0x280CE83F81C0C3E3 } },
+		{ { 0xB81331F43E4130E0, 0x2A2812FB3D72420F,
+		    0x4CB495BDAA14A2CA, 0x29E0DD7FA97A181E } }
+	},
+	/* 1 * 2^120 * G */
+	{
+		{ { 0x394C1BBCA517E6C9, 0xB7670313B366C8D6,
+		    0x8CAAD14F3C46F9D9, 0x389C8A079C6B0FDD } },
+		{ { 0x91505ACCDCA70DA9, 0xB9DD92826EE77C6E,
+		    0x711AFB10C28B2A72, 0x2257E117EA508C25 } }
+	},
+	/* 2 * 2^120 * G */
+	{
+		{ { 0x0FE8FCB08880F6C7, 0xD6BF19ED5C39815D,
+		    0xC635E4F3B6AAF8E8, 0x3325DF85814DCD5A } },
+		{ { 0xE2785C2E46288810, 0xFF7E7287F8220D09,
+		    0xE1E17B2EBAA3FCE6, 0x08BCF43748E2009E } }
+	},
+	/* 3 * 2^120 * G */
+	{
+		{ { 0xDC1B1C50E412C8CA, 0xBE53177104ECA45E,
+		    0xD2A4257D53D6F3B0, 0x532028138EBD5524 } },
+		{ { 0x6E72070CDCA4A180, 0x3A54268A15B59BD5,
+		    0xF36361A45A189CB0, 0x0073AE5AE88F1645 } }
+	},
+	/* 4 * 2^120 * G */
+	{
+		{ { 0x4C96CE1F5CB1D6B6, 0x7F7C49E8D670EE40,
+		    0xB8F7CB6CB69FD9F5, 0x5C7C2BF7FB1C22F8 } },
+		{ { 0x587855DF3164E70C, 0x7E8897187EAFFDB3,
+		    0x75FAAC7616FBDFC0, 0x466BA2111493D814 } }
+	},
+	/* 5 * 2^120 * G */
+	{
+		{ { 0xEEDDC7854A2CAF5D, 0x2EF37FA33A2E8C47,
+		    0x16F4B7C730242C1A, 0x7669D42A74801296 } },
+		{ { 0xDF2BCC289292548A, 0xC7E9D9349400E227,
+		    0x929E16A8282798D8, 0x346205894E854CB5 } }
+	},
+	/* 6 * 2^120 * G */
+	{
+		{ { 0x5B7B1DE0F78D3D5C, 0xEFAF76FF8F8004E2,
+		    0xD77BD272BFFDFB4E, 0x017708DFA751E300 } },
+		{ { 0x4711710B39E8AE4C, 0x0E7C0DC5EA867B61,
+		    0x24D783E3F44F23BE, 0x65E60FB5ECDFC501 } }
+	},
+	/* 7 * 2^120 * G */
+	{
+		{ { 0x62BB5E6CF5DDBFBF, 0xE3AEBBC3F37E63BB,
+		    0x0A5107C89AD799F9, 0x254244716180DC0F } },
+		{ { 0xCBBD975D09C768E8, 0x86DDE76A1B6B6081,
+		    0x684B173509F65FAE, 0x7C53861673FAE6C0 } }
+	},
+	/* 8 * 2^120 * G */
+	{
+		{ { 0xBE1EAC42158F8815, 0xD7F7B880AEAB6F12,
+		    0xAAA52A3692A5A4D9, 0x2DB98420485667CE } },
+		{ { 0x4B9599DF59AA2456, 0xD5F469FE517AC1F8,
+		    0xA9ABF43493341D10, 0x029B74DA6A125B8D } }
+	},
+	/* 9 * 2^120 * G */
+	{
+		{ { 0xA07C473AD54E0B64, 0x42243D174B8BD7C3,
+		    0xA18F59ACFAAD84B2, 0x1C5A32F3ED5C093C } },
+		{ { 0xCA6F39B30E7686A2, 0xD3F68344DB54BE07,
+		    0xEF53DE7DAAE63656, 0x516E2A1E966C7CAA } }
+	},
+	/* 10 * 2^120 * G */
+	{
+		{ { 0x0D50955356E1793A, 0xC402B995C47251A7,
+		    0x8A83379F0D503F0C, 0x225C381ABCB17453 } },
+		{ { 0xFC96F15AFA44C902, 0x675978FCDB2744A4,
+		    0x50928BBFEFE63396, 0x510D770DCC3FD9A6 } }
+	},
+	/* 11 * 2^120 * G */
+	{
+		{ { 0xC1275637B89B185A, 0x14109920E315591B,
+		    0x3BCE6A026C7DCD1B, 0x58449E62867B7C72 } },
+		{ { 0xE188C127B627A289, 0x378E9F591B2E0491,
+		    0xBD5E0E37CB626753, 0x283D4F931799FB82 } }
+	},
+	/* 12 * 2^120 * G */
+	{
+		{ { 0x9D2D6135AE91F3F7, 0xA3B73CFAAB3CC901,
+		    0x9B2B0C730E20AB59, 0x5ED9859AE880915C } },
+		{ { 0xD3D1FDBAC7D80762, 0x1BEBA2BC7798F9D3,
+		    0x745FF45819D3B58F, 0x5AA40FF24A4BAC4A } }
+	},
+	/* 13 * 2^120 * G */
+	{
+		{ { 0xE4FD28BCF3D51D59, 0x02319FAC759CAEC5,
+		    0x60B580BE49DAC865, 0x02EDC483C061E88D } },
+		{ { 0xE8A989591CDBCE07, 0xDD5BBF77526B41C0,
+		    0xE0B972FFC05306B2, 0x6BD989AAB45A8921 } }
+	},
+	/* 14 * 2^120 * G */
+	{
+		{ { 0x4ACF0CD5F66F451F, 0x9F29C8AA5667822A,
+		    0x33E4A067D295A46C, 0x768136A9FAE6709F } },
+		{ { 0xB91A82987A85C50D, 0xE3BCFB11F2700110,
+		    0xA092B1193B8B9600, 0x56D1A8BC8C232229 } }
+	},
+	/* 15 * 2^120 * G */
+	{
+		{ { 0x7F78014ED932A98D, 0xD107C6515528F581,
+		    0x9361FB9F580FA562, 0x0395D1E261F8CE47 } },
+		{ { 0x07FEE0639425C607, 0xB4E87B3BCA876886,
+		    0xF2D4063292CDE6C4, 0x5B5045DFB160A59C } }
+	},
+	/* 16 * 2^120 * G */
+	{
+		{ { 0xB25AED1BC6483345, 0xD01EE014BD0F4A8A,
+		    0xB899390B78FFA3FE, 0x40BB4099F611ECC4 } },
+		{ { 0xEB8F6AC7A2102028, 0x1C32471C6C6F4577,
+		    0x72A46B518814C81F, 0x0443C365BCB44073 } }
+	},
+	/* 17 * 2^120 * G */
+	{
+		{ { 0x281BD9B80CD89917, 0xAD008D0E16E45EDE,
+		    0x8318E5B94ABD7F41, 0x45584BA22640286E } },
+		{ { 0x0F51EF4D50F54495, 0x21E569173158009E,
+		    0x2A60090BEDA42E78, 0x0B98DD65CC932B65 } }
+	},
+	/* 18 * 2^120 * G */
+	{
+		{ { 0xDA6BEE7D9D6F16F4, 0xA8AF37BA6D55040E,
+		    0xCA6980552D019B89, 0x15CA29B54537F254 } },
+		{ { 0x760E4B1F20447123, 0xA77F3A7C7DBA4C19,
+		    0xED6213DD34E020EF, 0x27D3AE52B8F0E750 } }
+	},
+	/* 19 * 2^120 * G */
+	{
+		{ { 0x02D822D895DF6DED, 0xDAD06B08935FAEC1,
+		    0x961061FC1C34CAF8, 0x5A333AA5E351F71E } },
+		{ { 0x1830C4DBC6ECFEAC, 0x6DAC3CE0EF5FA13B,
+		    0x93390A20C841AA21, 0x715703483E33D6BF } }
+	},
+	/* 20 * 2^120 * G */
+	{
+		{ { 0xB7A4387B5D6AF6FF, 0xDBED387533D8B8DC,
+		    0x464B29BA043DC0D0, 0x424455024691B60B } },
+		{ { 0xA5617C0EAE80D3D1, 0x489CB43DC1A10121,
+		    0x25F33AB1C187C2E9, 0x4FF09D18EFA70068 } }
+	},
+	/* 21 * 2^120 * G */
+	{
+		{ { 0xE1BF9211C5B386E3, 0xAFA9147948039CD7,
+		    0x7A550B9550A31197, 0x381FCAE125581BB8 } },
+		{ { 0xD9A36889AF445B0C, 0xFFAD34D3189CC2E0,
+		    0x007191D842E65A6E, 0x15FB4FACCB2B7722 } }
+	},
+	/* 22 * 2^120 * G */
+	{
+		{ { 0x79409196B85B01FF, 0x484CCADC3F3B02BA,
+		    0x73B82C0B25A1EC29, 0x42332348944B8D3E } },
+		{ { 0xAC537AE45226EE47, 0x2FC7371A56013B29,
+		    0x8D0563C785702ECC, 0x21D3CB2A0C930270 } }
+	},
+	/* 23 * 2^120 * G */
+	{
+		{ { 0x49BEE67C8FCDA149, 0x79F70797BE24068B,
+		    0xD3CEEDEF1CE51AF4, 0x278F0D3DC844D202 } },
+		{ { 0xE34FE422D276EF07, 0xB2890DA494BF5B76,
+		    0xD660A365E9215499, 0x7BF8D8CBC32EB2D4 } }
+	},
+	/* 24 * 2^120 * G */
+	{
+		{ { 0xDDBE339401D260F4, 0x5F4446EFF4E4C74C,
+		    0xDE5DA39BAAE75BED, 0x52E03C6CC12C1BFD } },
+		{ { 0x4D0073C918AAB1C5, 0x13718869F9F0A49E,
+		    0x197FB5CB3ABF098A, 0x5797B3E2FA62EA69 } }
+	},
+	/* 25 * 2^120 * G */
+	{
+		{ { 0x8BF34626B297A867, 0xA5316212D0F7496B,
+		    0x875950FA9AD501AE, 0x0A711653CFC57687 } },
+		{ { 0xBB861226843C7A11, 0xD1295D5B0E9EF16F,
+		    0x63207AE279C7F2BC, 0x39C1D0CAFEAB9B09 } }
+	},
+	/* 26 * 2^120 * G */
+	{
+		{ { 0x6E6DBFA8195402A4, 0xE6E7C82BAC65B945,
+		    0x5372D80D38680018, 0x719EE4E46DE29136 } },
+		{ { 0x01D1D1F88E037CAA, 0x867792BF6B02A8F3,
+		    0x3E7423F60D0A9DD3, 0x57ADBD61FBCBE111 } }
+	},
+	/* 27 * 2^120 * G */
+	{
+		{ { 0xF48F8E2ED6F53FB4, 0xA8F369F7C010614B,
+		    0x3BA5AF1B9855AAB3, 0x3FB629619CF228AA } },
+		{ { 0xA6F516F4C7315497, 0x1E29BACACB66DB66,
+		    0x60418675D6134A8D, 0x29F6380FD9631F84 } }
+	},
+	/* 28 * 2^120 * G */
+	{
+		{ { 0x26F1F287A4574385, 0x3E4EA8C2DE96FBEA,
+		    0x1012CEC14FFDAB52, 0x73C36A7EAE4009D5 } },
+		{ { 0xD41CC601D9587D69, 0x4BCC7D8C5FEC05A9,
+		    0xFF71DE380947076A, 0x04D3168342558330 } }
+	},
+	/* 29 * 2^120 * G */
+	{
+		{ { 0xF5A7E1FD40A47E43, 0xB8CCBB5393959C2F,
+		    0x3325378CE484D5EC, 0x613826B5145067A6 } },
+		{ { 0x46B29007B0D8D2AD, 0xEF645D1D173009CF,
+		    0x3B9A44DECCA79A39, 0x229993AF8B28DB13 } }
+	},
+	/* 30 * 2^120 * G */
+	{
+		{ { 0x3B4913DC1CE8F770, 0xEB3BCF2795B090EC,
+		    0x29F817E6F7D5A160, 0x00B7BADF5CFF786A } },
+		{ { 0x9E3B6C7FE95553B8, 0x0A1984097DA12DC0,
+		    0xDB8B63132518C39A, 0x19ED954A9BC1311A } }
+	},
+	/* 31 * 2^120 * G */
+	{
+		{ { 0x67005D0C50C2AAB0, 0x1BB9FE87E3012BEA,
+		    0xA19BCA116BDC370E, 0x4CAAFEABA0F4BA8E } },
+		{ { 0xD03BA30FD9DB90C6, 0x1A60740B0BDF3D68,
+		    0x9DF2CA8DF9ACF70D, 0x4F329975054BBB33 } }
+	},
+	/* 32 * 2^120 * G */
+	{
+		{ { 0xB063D63074A8900F, 0x336C8B991CF44A74,
+		    0x7BADC9B50756F734, 0x02A4185A1EBC1074 } },
+		{ { 0xE44CB5A6C1DA4B40, 0x865B16BE9AFCE2A1,
+		    0x23BA2D3B9B03F080, 0x233586246993095E } }
+	},
+	/* 1 * 2^144 * G */
+	{
+		{ { 0x1B929B28BE54BA87, 0xB5532554686D67D1,
+		    0xAFC561EE2F61DC2A, 0x63785DC1853B7BD8 } },
+		{ { 0x2F1D7667EF0A158E, 0x629D356611B0589A,
+		    0xC4BA22254C12DA8D, 0x72F35314986BBBE9 } }
+	},
+	/* 2 * 2^144 * G */
+	{
+		{ { 0x292F4E288CE0774D, 0xD0ECB5512055B384,
+		    0x7BB080FEAEB63D8D, 0x4C8AA048D001565C } },
+		{ { 0xAEDFAAEB2F7EE4CC, 0x1AF56238BA77E9EA,
+		    0xDA2BB89E63D7A41E, 0x2FBC307CC118468F } }
+	},
+	/* 3 * 2^144 * G */
+	{
+		{ { 0x5E13286E80A75AF8, 0x34242D3829231F6E,
+		    0x30B5D2484CD17F56, 0x25CC125773D1C6F3 } },
+		{ { 0xD20844E00CD20C90, 0xC8F9FE6FE0A19D30,
+		    0xB5AF0E0173467BDD, 0x559BC25BB4C6E83A } }
+	},
+	/* 4 * 2^144 * G */
+	{
+		{ { 0xB09103905B0C36B0, 0x77A87643D4A689BA,
+		    0x83BBBE762B3F9E5D, 0x1D48E6D208A71A03 } },
+		{ { 0xE4F1D5819C259085, 0xB4536F486D7C347B,
+		    0x8A72DD7096195768, 0x6DF408A3E094DA1B } }
+	},
+	/* 5 * 2^144 * G */
+	{
+		{ { 0x47AF20F4C5766975, 0x029D76EDDBCE6089,
+		    0x81D91A39FAFE0D46, 0x3787532F8B8E34E8 } },
+		{ { 0xFE4C507D4551BF5B, 0xA7D87D3C4DB1DCA3,
+		    0x237BDA155EF0AE0B, 0x62D10C2B1B2CD7E4 } }
+	},
+	/* 6 * 2^144 * G */
+	{
+		{ { 0x38F21FE3D6DC715E, 0xBC1A95B20871A0EA,
+		    0x8D0B0B35C6B6D9A3, 0x7A2EFFC0B61E382D } },
+		{ { 0xC571B7B2888FE2EE, 0x33AD25384796519C,
+		    0xB1BCD1F11A68F1A3, 0x4547CE0368FE6058 } }
+	},
+	/* 7 * 2^144 * G */
+	{
+		{ { 0x6C9F86BA6255E73D, 0xD8F159955F31EAE4,
+		    0x55B3B7CC962E4A1A, 0x7A7BAE995577B6D6 } },
+		{ { 0xF1DEE61F4C70B659, 0xA40D98CF5CB58AF5,
+		    0x747AAC86C58170E6, 0x59C113B6732281D6 } }
+	},
+	/* 8 * 2^144 * G */
+	{
+		{ { 0xB9ED72479F7A9615, 0x570A9B97FE284B4E,
+		    0x158FF53F41976A22, 0x2E1A71209609E8DE } },
+		{ { 0x1214A8E4FA07747F, 0x8779918F5515735F,
+		    0x587604E7281683E8, 0x4B1AA4504807D08F } }
+	},
+	/* 9 * 2^144 * G */
+	{
+		{ { 0xD25BBF9B4778639D, 0x4AD475D90AD92B7E,
+		    0x7584109B27661724, 0x4BCA121532243A74 } },
+		{ { 0xCF95B11522A00BFE, 0x213D28A16EE317FA,
+		    0xE560857F156EB288, 0x7B5E458023A7ABC1 } }
+	},
+	/* 10 * 2^144 * G */
+	{
+		{ { 0xD9B679023E9610F5, 0xFCECAE97DB7AEAD5,
+		    0x2F1BF2BDC420C1FA, 0x69DEAD088C1E57B0 } },
+		{ { 0x8B937BDFF2F19615, 0x48C42892ACDD7E7A,
+		    0x4CC1E8B3DCC3F881, 0x43B3DA8CC4C1B482 } }
+	},
+	/* 11 * 2^144 * G */
+	{
+		{ { 0x1EFF0A2B13051CCF, 0x64D45CBEAD4943BB,
+		    0x7A102957C633686D, 0x0ACC5C860E7D2077 } },
+		{ { 0x92725BF0A4C21DE1, 0x0F76CA9B85C41DDC,
+		    0xA17378696F7CF57D, 0x10A67D84C77E4501 } }
+	},
+	/* 12 * 2^144 * G */
+	{
+		{ { 0x349A62A5E27E60CD, 0xEB5A552901EA2A0D,
+		    0x5AAA0941EB593633, 0x4A693D8327FDAF1A } },
+		{ { 0xA650190EE08C03A8, 0x6E80D5ABE90F0401,
+		    0x59F0A9997828CC0E, 0x292757052DA0F40E } }
+	},
+	/* 13 * 2^144 * G */
+	{
+		{ { 0x13B3078A4FCBA163, 0x2F614F79F7DA101B,
+		    0x01A2146686566AB0, 0x011248B5310ED587 } },
+		{ { 0x2CA8D6AD5BA5F484, 0xA96F51030DA0B863,
+		    0xF5FCA961EF46E9BE, 0x2632A7D08BF8EDF4 } }
+	},
+	/* 14 * 2^144 * G */
+	{
+		{ { 0x2B4373CE932B3BA1, 0xDA08D238FAF693EA,
+		    0x9B4DE87B5FA64FA1, 0x646F91FCF2339C8C } },
+		{ { 0x025A6E2594C3CBA9, 0x35FFF3C71F9A6C84,
+		    0xE64D678AE3AC63C2, 0x2500D7F627630CAC } }
+	},
+	/* 15 * 2^144 * G */
+	{
+		{ { 0xF3712D3AE34E1C24, 0xA99EB98D7470AC9A,
+		    0x43E8FB8816C33EFD, 0x4356844D89106062 } },
+		{ { 0xE89D96EB079F1478, 0x34C148F73E77C6B9,
+		    0x3766D88CB5B3C1CA, 0x3241815D254E80A5 } }
+	},
+	/* 16 * 2^144 * G */
+	{
+		{ { 0x5560045883874A85, 0x87727FC8ADE174BC,
+		    0x780409E2CC3F2DAA, 0x7B62D056078F2142 } },
+		{ { 0x3991C17638B0A1A1, 0xFF32B2E1FC3B09EB,
+		    0x59D5E45D916C39C4, 0x695A314E472BB416 } }
+	},
+	/* 17 * 2^144 * G */
+	{
+		{ { 0x84485564D704D128, 0x8FF5CDEFB16873B2,
+		    0x0ECF9E60F136A8C5, 0x7CC8FCDF81A51077 } },
+		{ { 0x89BEA6DA1037A31A, 0x92D6991E7C62EDC3,
+		    0xE2672633E53EFE24, 0x690EA6BF84C7CC77 } }
+	},
+	/* 18 * 2^144 * G */
+	{
+		{ { 0x1022DCC0709B8149, 0xD571266128217102,
+		    0x3367C6ED62B76A54, 0x4CDB5C05959B2CD1 } },
+		{ { 0xC537DA2F5282A018, 0x364A6D0EED461C01,
+		    0xD892781005D87007, 0x70851A7ED6D227E0 } }
+	},
+	/* 19 * 2^144 * G */
+	{
+		{ { 0xF3DACA969184A70B, 0x1041EBC49E74B439,
+		    0xA6EC3E8C85CF5025, 0x42C3D38DBE0FF293 } },
+		{ { 0x7AB04BFEA39B70F1, 0xDDCF8FC7F6EEC0AF,
+		    0x0CC7949039A4C124, 0x687EF3B42C39F943 } }
+	},
+	/* 20 * 2^144 * G */
+	{
+		{ { 0xA3CB82CC56DBBDEE, 0xE743F9FC55547ABF,
+		    0xF2F525E6FEB4F058, 0x2E311D2082F77630 } },
+		{ { 0x330A9DF340C6E5EC, 0x3BB7E9B08394ACA2,
+		    0x9219DA99088B98DF, 0x7CE2DFB6D538EB2F } }
+	},
+	/* 21 * 2^144 * G */
+	{
+		{ { 0x72F8565650373879, 0x7A5B3E1735C85B03,
+		    0xCF978C2D6FF557DA, 0x1E4CD9CCD9240D59 } },
+		{ { 0x83099082DDC38A7D, 0x32B041261DBA34C0,
+		    0x59CD6889FDAC6DA5, 0x573A6C36B5984376 } }
+	},
+	/* 22 * 2^144 * G */
+	{
+		{ { 0xD3E5693B9D498730, 0xE1050CB510D28810,
+		    0xD38214DF2CDF5E50, 0x3C656B76726104B2 } },
+		{ { 0x745A28D3F69A2813, 0xAA5FB050D21370C6,
+		    0xDD5A3424706E5995, 0x3127BED9E991636D } }
+	},
+	/* 23 * 2^144 * G */
+	{
+		{ { 0x743A221BEA599814, 0x48D763315C8CE879,
+		    0x9DFFD99A95F80AB2, 0x1760DB04D6FBE6A4 } },
+		{ { 0x2EFA103A1767A280, 0xCAFB53FA09DFF598,
+		    0x7E35A1E2AFB23990, 0x30F33E7AC3EA8450 } }
+	},
+	/* 24 * 2^144 * G */
+	{
+		{ { 0x300A440BD20E3307, 0x95AF8A540A7745A9,
+		    0x0BA8FB4DA18E5B22, 0x792EF886764D43D5 } },
+		{ { 0x1512693DB169F0C3, 0xD6393E21F1F0A840,
+		    0x9803818196B3CEAA, 0x031EE78A3F3C10B5 } }
+	},
+	/* 25 * 2^144 * G */
+	{
+		{ { 0xA570C9C4A0BEB56A, 0x6BB9FA8101A16D97,
+		    0x3EC87ADE3445E52C, 0x6F2055D816607F90 } },
+		{ { 0xAC036B3045E5674B, 0x2B78445C3FDEDAB8,
+		    0x09196C814DF8E6FB, 0x2D09B410FE5046AE } }
+	},
+	/* 26 * 2^144 * G */
+	{
+		{ { 0xFBF511AE988A283F, 0x09150120D61009C7,
+		    0x65F08E089A79AEC6, 0x45D09185E1955046 } },
+		{ { 0x2DFF012DC8DCC08E, 0xB54145BC58F335B4,
+		    0x9A85654D9F6E75A3, 0x10000A2207D64868 } }
+	},
+	/* 27 * 2^144 * G */
+	{
+		{ { 0x5697609DE4B172A8, 0x1957C2B40681F430,
+		    0x530C0205D3381D1D, 0x1D3C71D6E0020B05 } },
+		{ { 0x5DAE6A62981006DC, 0xC83476C7ED6CEAC2,
+		    0x794662EB15634CEC, 0x306FD7CCDB00BE29 } }
+	},
+	/* 28 * 2^144 * G */
+	{
+		{ { 0x1DDCA0A16C7F539C, 0x9775307C4BCFAAFB,
+		    0xC9DB1400767DBF1F, 0x41D3B3BA7B59FF59 } },
+		{ { 0x4754F23AE4AB6BCC, 0x625C874C3CA16EFC,
+		    0x5E1A5448428F15D6, 0x252505715EEF5C02 } }
+	},
+	/* 29 * 2^144 * G */
+	{
+		{ { 0xD485C9B2E48247CD, 0x43119287CEFA6F98,
+		    0x9BFE3604C1612626, 0x0C433B3DB08084DC } },
+		{ { 0x7A5B266C6FE262E3, 0x95EEEA67AC2397F0,
+		    0xD772B91E6545DBD8, 0x2CC85F14B0DD5F18 } }
+	},
+	/* 30 * 2^144 * G */
+	{
+		{ { 0x0B0FCF92A7CFC4FE, 0x819F14BC96461202,
+		    0x4E2CED43672FCD95, 0x0479ADE039714D54 } },
+		{ { 0xE43A96CA907C37A5, 0x87B06F834E6BFBD0,
+		    0x1064390385BFE347, 0x10CCFFBD16C470F9 } }
+	},
+	/* 31 * 2^144 * G */
+	{
+		{ { 0xE290754766D90D25, 0x7D84397855249064,
+		    0xFDC8026DFC2E278D, 0x2A9D4FA855FBF020 } },
+		{ { 0x5FF697E9EEB8BA65, 0xA8B5127133ED0B91,
+		    0x849163C5877D5AF1, 0x72282CD7EEE13F55 } }
+	},
+	/* 32 * 2^144 * G */
+	{
+		{ { 0xF6158FE5D8508073, 0xB108FBE35990BB0E,
+		    0x78505C6E95CE9F5F, 0x0036D6A692FEA506 } },
+		{ { 0x2F416179CB4F777D, 0xC1422DDC665D0DFB,
+		    0xC10F720BBC28980B, 0x61B53B8A200BE76D } }
+	},
+	/* 1 * 2^168 * G */
+	{
+		{ { 0x9F833D872C3A05FF, 0x729C18FEA8856215,
+		    0xC3097AD6D2F3ACCC, 0x3BC12A7D1929D530 } },
+		{ { 0xFC2B8475CC771507, 0x2CB43D8D14D9EB6F,
+		    0xB29D395E6EB07965, 0x0DB1BAEA8E8E5E00 } }
+	},
+	/* 2 * 2^168 * G */
+	{
+		{ { 0xF125BBD269C6AF81, 0x481926E008D8E3C5,
+		    0xB496FBADDA0E1AB5, 0x1EE8248B3990FDCD } },
+		{ { 0x6E8E784A395B6770, 0xE9682E86F8998D7D,
+		    0x1537C85E2A39D58B, 0x6FA882A86ED3FF71 } }
+	},
+	/* 3 * 2^168 * G */
+	{
+		{ { 0xAF850DA1D8F93AF4, 0xD57CAF9F198DA385,
+		    0x709BAFAF741A81BD, 0x243C1FCD6059B9AE } },
+		{ { 0x9ADB518E5898F5B1, 0x558382EFBFA39ABD,
+		    0xECB928BE9F57368B, 0x5A383DEFF748B28A } }
+	},
+	/* 4 * 2^168 * G */
+	{
+		{ { 0x8CE13EBA2169AF23, 0x6495CFC44F7F82DD,
+		    0x26FDB8E29E91ED96, 0x4F14875BADB18566 } },
+		{ { 0x4519B27F958D0BE7, 0x7B9C6FAFE672BE2C,
+		    0x604C7B9D53D59FE8, 0x486805ADF974F0AE } }
+	},
+	/* 5 * 2^168 * G */
+	{
+		{ { 0xBB6BB564F02B5990, 0x1A99177C7F3A3F59,
+		    0xB92A068AC65AE80F, 0x1F9E8C1C65A5BA0E } },
+		{ { 0x6FEF14161FE2A1DF, 0xA414D0A6A1A45497,
+		    0x5EE14D0703BFDEDB, 0x56444E883431E24A } }
+	},
+	/* 6 * 2^168 * G */
+	{
+		{ { 0xB8049469925495EA, 0x3E4D55FF3DE1F7DB,
+		    0xF555B1F5C222A558, 0x0842746844F0555E } },
+		{ { 0xA5E9E48A6AE60AB6, 0xFCE9B9C1204B8E0B,
+		    0xC8BD33495B8ACEF7, 0x318A003D7B5AB750 } }
+	},
+	/* 7 * 2^168 * G */
+	{
+		{ { 0x1A739ED06F26BE51, 0xD12FB0BEBCC12528,
+		    0x400E78807D17D043, 0x2B3F416943BD80D9 } },
+		{ { 0xA7C3F996E741BA39, 0x4607A905C75716AD,
+		    0x26C577FB620FF0A6, 0x3D16ECA8686C69FD } }
+	},
+	/* 8 * 2^168 * G */
+	{
+		{ { 0xD40F53708CE0DEC5, 0x0B03B658720B43CD,
+		    0xCD34C1226BD37CC1, 0x0152393CB6224C6A } },
+		{ { 0x628FC45DFF2D9C63, 0x03913E4AE2B5244E,
+		    0xB94E070D647ADB81, 0x4C6CA26173BA4345 } }
+	},
+	/* 9 * 2^168 * G */
+	{
+		{ { 0x5C9565940F6FE9F3, 0xC2E603F42E5A254E,
+		    0x2E4CD40ADC496034, 0x34EDCAA373644FDB } },
+		{ { 0x3A51960253836838, 0x79C53191661D0A78,
+		    0xE9CBBFF44BDD1A7E, 0x6A21F92F2C8F8408 } }
+	},
+	/* 10 * 2^168 * G */
+	{
+		{ { 0xB35467E1CD3E877B, 0xFF4A5171E63BA9C1,
+		    0x0D1E8913589457F9, 0x7DEBF2DD89B0A4F3 } },
+		{ { 0x973F10128AFB1E1D, 0xAEDEA859EEF8A5B3,
+		    0x541DA8BA5C0D64EE, 0x5BEFCAB31B448979 } }
+	},
+	/* 11 * 2^168 * G */
+	{
+		{ { 0x20DE7138CEE380B1, 0xEB5CFE074BA9601A,
+		    0x9208A305E955F866, 0x28DB5F7C9C2D102F } },
+		{ { 0x66F35D916DB1E990, 0xFE997C9F65A118B3,
+		    0x7B08D003B6124879, 0x1A0623F517EE3EEE } }
+	},
+	/* 12 * 2^168 * G */
+	{
+		{ { 0x42C528B7E9396F84, 0xE43FF49FA3CFA995,
+		    0x1D4546DED547B948, 0x6AD73524966B6674 } },
+		{ { 0x00677A2CA249E448, 0x4B09D6B90AE766C8,
+		    0x636AE3A5A66C87E5, 0x62703C4FF1FEC777 } }
+	},
+	/* 13 * 2^168 * G */
+	{
+		{ { 0x98DAC415C9D33D31, 0xE46616E92E5F432D,
+		    0xF72891A0739E130A, 0x1C04F2E3BC64B76C } },
+		{ { 0x3ECC1051C9776E7E, 0x03AA15CE89624CD9,
+		    0x040B9D043FE0F6B1, 0x327E7D21942F6B60 } }
+	},
+	/* 14 * 2^168 * G */
+	{
+		{ { 0x9BCFC177BBB87D43, 0xFB7170A9C27C1191,
+		    0x093D4516EAA2649E, 0x67AAFCF96D1D1FD4 } },
+		{ { 0xE2CA656702CC2202, 0x3896A737609A56D5,
+		    0x3A3A07CB5B8AC439, 0x0FB54D1E70207BEB } }
+	},
+	/* 15 * 2^168 * G */
+	{
+		{ { 0x9C75B0AADC7E0166, 0x1502DAA6E3426D4A,
+		    0xC37668AAD2B11A74, 0x109157BC0AF03A1D } },
+		{ { 0xD352310EA73C5FC6, 0xC3038845EF1730C2,
+		    0x7D4B896225CC4DE6, 0x6641C4A61C78EA39 } }
+	},
+	/* 16 * 2^168 * G */
+	{
+		{ { 0x70C1A59C8BE37454, 0x507895235396B3E2,
+		    0x4E304A636FD7DBF2, 0x7300E85794A17A24 } },
+		{ { 0xBD0C72D57A173BCF, 0x258901F81548E0DD,
+		    0xFD237DA4B237E6B6, 0x65542B8D5D9C5F36 } }
+	},
+	/* 17 * 2^168 * G */
+	{
+		{ { 0xE3F4F9377C830894, 0xA60E90A1D2A48841,
+		    0xF6CDDE9277BA3EFA, 0x4E02102967CCF083 } },
+		{ { 0x3658E8602D430842, 0x3B076CD32541EA5B,
+		    0x4D9BBE7EAE825679, 0x7D5524CDADF35200 } }
+	},
+	/* 18 * 2^168 * G */
+	{
+		{ { 0x7D84FFE515508DA2, 0x39786096D0DA7428,
+		    0x4ED3BD37B2785873, 0x4A5227078E945271 } },
+		{ { 0xEE229537F34DCA55, 0xB966F5D7EEEEE951,
+		    0x57F4DE74AF3AA301, 0x16D586CC4E5DFDA6 } }
+	},
+	/* 19 * 2^168 * G */
+	{
+		{ { 0xBD4CF6310E2C61F4, 0xE10A5937DE941274,
+		    0xC7FD84A9FB474AB3, 0x3704515EB8DFAB67 } },
+		{ { 0x2B8364C0E182D12A, 0xE325970635E6B884,
+		    0x6C92EB3561C88463, 0x3085043E26BD3D18 } }
+	},
+	/* 20 * 2^168 * G */
+	{
+		{ { 0xC7E9CCDC996A4194, 0x3242908AF96D1495,
+		    0x2DAB51233A4DD22E, 0x78F3910E3B967025 } },
+		{ { 0x75CFEEE5CE336884, 0x6CF6D3DC92044409,
+		    0x8974618DAC6CB6ED, 0x65C65761C6DAF57D } }
+	},
+	/* 21 * 2^168 * G */
+	{
+		{ { 0xA9EC4DFA6A68A65A, 0x0857BED55B07F708,
+		    0x78B029D2D6D05FC4, 0x469AD86E86828022 } },
+		{ { 0xDF76BEE85043158A, 0x6EAA0C48DB50BEF6,
+		    0x98F32D136969EF4E, 0x2B60D70AAA3825E1 } }
+	},
+	/* 22 * 2^168 * G */
+	{
+		{ { 0x88009303D6F56C76, 0x42848816FA4242C7,
+		    0xE9B903F5D2318914, 0x511D250B11E80C96 } },
+		{ { 0x6A915DB06332B274, 0x9A6405536FF21BBA,
+		    0xB04222D5667097AD, 0x0EA49617DB71E7DB } }
+	},
+	/* 23 * 2^168 * G */
+	{
+		{ { 0x38BEEC00EB3C80D4, 0xC40F8F18B34C98AB,
+		    0x5DDCB118A35E0A28, 0x49092CE92460C6D7 } },
+		{ { 0x914628FD47C8FD1F, 0x29821BBA98EB4D8F,
+		    0x90AD97D907A0BA38, 0x46C59B1275E85679 } }
+	},
+	/* 24 * 2^168 * G */
+	{
+		{ { 0xCD7382B94399AE98, 0x77DEAE6B8A01E632,
+		    0x6F6FF86027EAF9AB, 0x006F270AC27DF59F } },
+		{ { 0xEF7AB4699728EDDF, 0x2BC7A9B409210327,
+		    0xDF44C540681E33C3, 0x72A52B35546BA848 } }
+	},
+	/* 25 * 2^168 * G */
+	{
+		{ { 0x8946DB0777B6A0BA, 0xEE0EE925B8865A0F,
+		    0x6D9FF1F94307804A, 0x542BB9A185BF4ECF } },
+		{ { 0x21BE5196C80B54C1, 0x8C9445DCC965EFF3,
+		    0x8009F9B9E111E9BF, 0x6C758B51808F0BEB } }
+	},
+	/* 26 * 2^168 * G */
+	{
+		{ { 0xA7BAFEE2E4AADBE0, 0x7DD7D847A4EF50CD,
+		    0x8E3D13E0D8214A96, 0x53A1C12F8AD6D743 } },
+		{ { 0x3DB164B6F670DBD3, 0xEE54ECF01E5D37F6,
+		    0x5330239FB73A03E7, 0x0BDD74DC00FA7BAD } }
+	},
+	/* 27 * 2^168 * G */
+	{
+		{ { 0x46E5EC28F3B4F250, 0xC9BFA5356EA71973,
+		    0xDC5E79D0B7B21468, 0x5F36CF9409B0F1C8 } },
+		{ { 0xEBD7564443EDF93D, 0x9CF856FC3D551AC2,
+		    0x26F5DE9645560630, 0x2DB6E66ADD59B312 } }
+	},
+	/* 28 * 2^168 * G */
+	{
+		{ { 0x5CECF93DC23B10EC, 0xB2D6033BB6510E5F,
+		    0xEF2F34D28DB4366A, 0x7AF890FF902D3D6C } },
+		{ { 0xACF7918AF6D6E7E7, 0xBC82E4DB23DAAACF,
+		    0x4AA8C353AB1B690B, 0x69A60501872E8B42 } }
+	},
+	/* 29 * 2^168 * G */
+	{
+		{ { 0xF143DE69362B85A3, 0x5364AF84B1CFB437,
+		    0xB76A07562A72D399, 0x1D2D82DB49797CE2 } },
+		{ { 0x0F46BE6BC47A4967, 0x326B34A250AEB289,
+		    0x47ED2A3DD99309D3, 0x3665261BD2481662 } }
+	},
+	/* 30 * 2^168 * G */
+	{
+		{ { 0xC083BFBE729240DC, 0x3B9470FF8D1C9582,
+		    0xDA7C0FD75B51CDE1, 0x630D72EE66F39648 } },
+		{ { 0x4CAEFB5429E5BCDF, 0x79B1D6711F53AE67,
+		    0xF1A263E6EA6CA6FB, 0x77B463D463BF748E } }
+	},
+	/* 31 * 2^168 * G */
+	{
+		{ { 0x3FA96E8C4D2C8EB0, 0xF2839EB6E3122176,
+		    0xA5F5B0F1A10A460E, 0x194C57B2A678EA97 } },
+		{ { 0x792E3D61B9D71BDD, 0xABDC175B5C43638C,
+		    0x717FF89ECCBA1110, 0x19C324074CD0EF1D } }
+	},
+	/* 32 * 2^168 * G */
+	{
+		{ { 0xF09A6271A656C8E7, 0xE988D4BC38F0E876,
+		    0x28743D8B46DD4608, 0x247AC235FDB5E51F } },
+		{ { 0xF8680FA0B854F4E7, 0x2A2AFC69201E97CE,
+		    0xF7208A71ACC12438, 0x210545BBA5F04456 } }
+	},
+	/* 1 * 2^192 * G */
+	{
+		{ { 0x25E4F86C0A435303, 0xFB1350AF2C92D6F9,
+		    0xBB42CF3AA9209A23, 0x5CA759973FE7D419 } },
+		{ { 0xDB63AE7EDB95C9B1, 0xADFC025C624E03F1,
+		    0x08185CED752FDD08, 0x5DB3D29AFF3B79C9 } }
+	},
+	/* 2 * 2^192 * G */
+	{
+		{ { 0x9A53A899AEDC3F8C, 0xAF074A24898348F7,
+		    0x90B71D2F90D94DED, 0x4A7E9271F702F9AA } },
+		{ { 0x6E055713A64D45B7, 0x8052CB7C14F85099,
+		    0xB63BB7F886425CD2, 0x354516416BF10114 } }
+	},
+	/* 3 * 2^192 * G */
+	{
+		{ { 0xB67F7ABB37DC3DE4, 0x18FA3503929F1AD1,
+		    0x925D2711569E43DA, 0x7A1B747809D1C53B } },
+		{ { 0x6A6BAD93B121D266, 0x8D5B43DAE45B328B,
+		    0xA0D5F08237AB40DE, 0x58CDFB5CEE791C15 } }
+	},
+	/* 4 * 2^192 * G */
+	{
+		{ { 0xB202F9EA80BC554A, 0x582E9CC21B4F5DBC,
+		    0x35C48881EAB2F0CE, 0x7B6750B1DC57D3A5 } },
+		{ { 0x50AA49C43158C2D5, 0x38FE415E7B85FDBF,
+		    0x0E7883AF7A7DD9BE, 0x69B8E78D5D0B9459 } }
+	},
+	/* 5 * 2^192 * G */
+	{
+		{ { 0xDDF898D151B600E4, 0xDEBA13EFCB1749C1,
+		    0x958A72DFD36CEA4A, 0x16D0506726B50975 } },
+		{ { 0x12052CABA984B080, 0xF6F6C0A3A527F662,
+		    0x633EF2924002659A, 0x7E3429FF1EA30B6B } }
+	},
+	/* 6 * 2^192 * G */
+	{
+		{ { 0xD95143715E2EBD62, 0xF4D671FD89448F48,
+		    0x6CD2F8194C7281E9, 0x125707C414CDE8FA } },
+		{ { 0x1D8A92C52FB9E4A9, 0x65F9A9D43791F474,
+		    0x9D2F8902D2DF1771, 0x5DE484BCFABEBDB3 } }
+	},
+	/* 7 * 2^192 * G */
+	{
+		{ { 0xE4046DEE0C18BF9C, 0x1890CEAFA4840D07,
+		    0xA32DD6DA6FB8A6E6, 0x66A9ACFFFA22AABD } },
+		{ { 0x365B977543412540, 0x56064313A1160301,
+		    0xA6B9761069147780, 0x44F2993845655A99 } }
+	},
+	/* 8 * 2^192 * G */
+	{
+		{ { 0xA5B332AE8B607110, 0xC6A1F5888C5C2A7B,
+		    0x4686BCEF5F176F78, 0x2EEA2C710771051D } },
+		{ { 0x6D0E9F716AE34331, 0xA2D563E37EBB560C,
+		    0x02C47EC213FC17A6, 0x6A77A3055FEC969B } }
+	},
+	/* 9 * 2^192 * G */
+	{
+		{ { 0x40E0CE5D8C5F819C, 0x6BDC43E0223CA1F6,
+		    0xA0D459C2D7781736, 0x78B8AD5812CE9923 } },
+		{ { 0xB540F07A3E9DF237, 0x94DB98D7A1E2CD6F,
+		    0x24D3877678D60A22, 0x1CB11ED203B37F74 } }
+	},
+	/* 10 * 2^192 * G */
+	{
+		{ { 0x0A9C26E8B79CB62A, 0xD3FDB01396493756,
+		    0xBB8CE77125739CFE, 0x0122EBC20E6475F5 } },
+		{ { 0x6E75FAC0DD24A2DB, 0x14915A9EE77A401D,
+		    0x5FFF89002EC5EBA8, 0x47DB3ECC0DA38704 } }
+	},
+	/* 11 * 2^192 * G */
+	{
+		{ { 0x3D529F5F2552F618, 0xAAB3DD9911C17CF4,
+		    0x908EA674C915749A, 0x203502EA40738C42 } },
+		{ { 0x21E653849099BC91, 0xDF4DF1EAB45DAD0D,
+		    0x38CDFFD617FAD1BD, 0x703E6A37A3E3DF6A } }
+	},
+	/* 12 * 2^192 * G */
+	{
+		{ { 0xED83533AF2D19D4D, 0xFC361DD86C76872C,
+		    0x21DFE376B33E0FAB, 0x19030349A7F350B9 } },
+		{ { 0x871502A04A6136F5, 0x8CBBBB03E3E34A94,
+		    0xE875D3D03E6070C9, 0x43CC1CC5F4B93724 } }
+	},
+	/* 13 * 2^192 * G */
+	{
+		{ { 0xC44F63AA2C857E48, 0xB8700BAE7ADA4D4C,
+		    0xAB741005CD629CAA, 0x2CDB1D1B11D90402 } },
+		{ { 0xE555B2347382202C, 0xD500C2A88AE02A8E,
+		    0x79E793AAE62C6043, 0x6049FFBE31FBBA31 } }
+	},
+	/* 14 * 2^192 * G */
+	{
+		{ { 0x8D2A3C65B005B326, 0xC5BB6CF71104B4BA,
+		    0xF1956E52D01F22D5, 0x4A254E32BC25E03A } },
+		{ { 0xFD91053F6046C383, 0x303FC7AF8718FCDC,
+		    0xE40C7E256A52152A, 0x24311D500BB50447 } }
+	},
+	/* 15 * 2^192 * G */
+	{
+		{ { 0xD422BBDDCEC73404, 0xA495B7212C1F62AB,
+		    0xD50E049EB1D70899, 0x085B85539A53C7E5 } },
+		{ { 0xE3E52360F251CDDA, 0xD92BD114B518645C,
+		    0x64586C7288688FEF, 0x07182BFF50EC4B3C } }
+	},
+	/* 16 * 2^192 * G */
+	{
+		{ { 0xD08B3673DD36C5D6, 0x42875443DFF50CA5,
+		    0x4472B3B100AD977A, 0x71BBE2F8AAAD796C } },
+		{ { 0x65535E40698BF33D, 0xACBC8232684F6F92,
+		    0xBBAE0F5B90D0C62E, 0x33B00A17F8C24E6F } }
+	},
+	/* 17 * 2^192 * G */
+	{
+		{ { 0xD487E627241C93A6, 0x095DB5CC2CAD2977,
+		    0x9A2373BCA5681F5B, 0x67FAD2F9B4D88A34 } },
+		{ { 0x1516781422DECD4F, 0xE29D89B8CEF95FC2,
+		    0xD08454DC40619F8C, 0x494D806BAAFFBEA0 } }
+	},
+	/* 18 * 2^192 * G */
+	{
+		{ { 0x7207213F57B098E9, 0x35612D7319EF59CC,
+		    0x3269414CFF35EC33, 0x42A569CB878A0406 } },
+		{ { 0x77471B2873568974, 0x6695BE61898BE67A,
+		    0xEBACF16A0089C3B0, 0x24C9AB6EB07E67CB } }
+	},
+	/* 19 * 2^192 * G */
+	{
+		{ { 0x64D9F2BB2CC8936F, 0xAB8B615A9C91A796,
+		    0x31AFE4E1AE129DC7, 0x02F3E37B57570515 } },
+		{ { 0x1B7CEF3A20B9D58A, 0x9E5ACBAA855446FE,
+		    0xB02B5DD08F6B8870, 0x6AAE7A89105E183D } }
+	},
+	/* 20 * 2^192 * G */
+	{
+		{ { 0x882131F3D1F16197, 0x27D61348C77920CE,
+		    0xA0EDCFD2869B6A13, 0x5F156080418C806E } },
+		{ { 0x938BBED81DA4FB2A, 0x7AAF6260AA053F19,
+		    0x3D329D30602F0220, 0x187731400F28A1BA } }
+	},
+	/* 21 * 2^192 * G */
+	{
+		{ { 0xA12D9AFF622B203D, 0x25A948446367BAD6,
+		    0xED83DF54972A65D5, 0x70B6F2AF6545538A } },
+		{ { 0xF09463BDB6F8DD3C, 0xA3687A8C2E15EB71,
+		    0xC5A6E35DB96C4277, 0x0FE97CE4A228E128 } }
+	},
+	/* 22 * 2^192 * G */
+	{
+		{ { 0x0294AE4D2EC21BEB, 0x20C55D4AAE6BD8A7,
+		    0x6E47EC3FBF51B653, 0x75C5769841CCDC31 } },
+		{ { 0xBF0E3EA27F660828, 0xFDDD7665EC2E4CDE,
+		    0x736A2A3AB9F67D1C, 0x3F005C73F5AFB8B9 } }
+	},
+	/* 23 * 2^192 * G */
+	{
+		{ { 0x62F2A0F202627C4B, 0x983549AE5D8A6A96,
+		    0xCC6F6BBF588EDA94, 0x5D33E92E33B5017D } },
+		{ { 0xBB4455929003FF13, 0x265C67EC09A67025,
+		    0x6A0C5118FBF44C47, 0x0ED294B695102DF0 } }
+	},
+	/* 24 * 2^192 * G */
+	{
+		{ { 0x91F7BAAD9ECAFD0C, 0xDF7832A52AEBB19D,
+		    0x72D70D6D53A736B8, 0x4053B80041C9765F } },
+		{ { 0x5B50A6FB8A3C5206, 0x35F2DDC4196EB4DC,
+		    0xA735700F561101BE, 0x0A4CA1D995E9471D } }
+	},
+	/* 25 * 2^192 * G */
+	{
+		{ { 0xB2AAB3E7C460BD3F, 0xC66F8B4C59A9231A,
+		    0x3266E32C8BFF1644, 0x6740EA5DE6F2350D } },
+		{ { 0x78D6436E502D0A5A, 0x75ABAC84767BAD5C,
+		    0xA8B67D1932C26221, 0x23C562548BB02113 } }
+	},
+	/* 26 * 2^192 * G */
+	{
+		{ { 0xE227430BAFA4112C, 0xB8E453B6B62E38EA,
+		    0x9548631A100D694D, 0x1270E1EA9AC58E34 } },
+		{ { 0xC4E6C6A022732261, 0xC8118C3509885802,
+		    0x48B848D333C50BF6, 0x24A32E7CB614C086 } }
+	},
+	/* 27 * 2^192 * G */
+	{
+		{ { 0x64E66C1D29531F17, 0xD3DAC651AE90950B,
+		    0x35B926956BEABE17, 0x72D758B5A5F845D9 } },
+		{ { 0x177609A478475F66, 0x57C53C6B96F47E78,
+		    0xF3F89DA524D0E3A2, 0x47FE7C512F40C13C } }
+	},
+	/* 28 * 2^192 * G */
+	{
+		{ { 0xC35ADB6FD040A46B, 0x3FE1FBE849E69F38,
+		    0x4CC32A6788777B55, 0x51494F29A2339159 } },
+		{ { 0xEA6EE2DF3269BE2F, 0x4948F9883D533AA6,
+		    0x04B4EA1096CDABB8, 0x61380E0B3B2FBE94 } }
+	},
+	/* 29 * 2^192 * G */
+	{
+		{ { 0x35ED145F7C0BB978, 0x0C6217E3B3C3DAC7,
+		    0xD88069018B88D798, 0x71589FC861567A9C } },
+		{ { 0x4712C9A589D48839, 0xC2BAA9D0B58EA5A5,
+		    0x6413BD8B8E0046EE, 0x1AB87633F918BD10 } }
+	},
+	/* 30 * 2^192 * G */
+	{
+		{ { 0xA8A61637671C6CED, 0x5247064F3C6327E9,
+		    0x5C7D9F9B06C8A6E5, 0x30D35BD239E49B17 } },
+		{ { 0x28F418E43BC0453E, 0x1AB9C0432FA029F9,
+		    0xAA1A6BFF745B58D5, 0x45D7EBFDDDB2BC37 } }
+	},
+	/* 31 * 2^192 * G */
+	{
+		{ { 0xF5EB388667A7D56D, 0xFFD072B1278D57E8,
+		    0xE92B80EE7040ABF7, 0x270F6A7650CF1290 } },
+		{ { 0x653ADC48A7BE426B, 0x6EE4AA2AB8CB0946,
+		    0x9168DD92949B8DE0, 0x6D91F90A0A17FDA2 } }
+	},
+	/* 32 * 2^192 * G */
+	{
+		{ { 0x8CFBE62352C0321C, 0x35317478163A7506,
+		    0xB07FB5CF2F0D350C, 0x674624CC5B63BEAB } },
+		{ { 0x54E2D5490A22576D, 0x2ED760683FF99529,
+		    0xFDD1AAF91D014750, 0x44F0E982043FD6A4 } }
+	},
+	/* 1 * 2^216 * G */
+	{
+		{ { 0xA48E7116258E2E47, 0x389BCA53865AA4C1,
+		    0x7353BB1FBE3E9411, 0x6F282DAFB02F1414 } },
+		{ { 0x2BB157291508839D, 0xEB59CD9FB513923F,
+		    0xAD654941D99CE8E0, 0x268FA6A49ED0B81F } }
+	},
+	/* 2 * 2^216 * G */
+	{
+		{ { 0x939954A5BF81C525, 0x944AB8854E276C25,
+		    0x200875300E3094FE, 0x20D606D66A0B9173 } },
+		{ { 0x7088145468C56F49, 0xAF1FDF6B1929BB43,
+		    0x1397AFB0270CF50D, 0x4171E1DF71F7ABB1 } }
+	},
+	/* 3 * 2^216 * G */
+	{
+		{ { 0x31A04D6101117764, 0x9A2BCE1D6369A1A6,
+		    0x565ABB8600550B05, 0x454DA304FCE943C5 } },
+		{ { 0x34D880ED4D7BBC6D, 0xE1DA0D4E82294060,
+		    0xCE7BF36E00B89F55, 0x37EA5C5BCC421841 } }
+	},
+	/* 4 * 2^216 * G */
+	{
+		{ { 0xFD8AC94E3B5B5265, 0xB514EB4E65EE05A2,
+		    0x3F3BCE50B0DD033C, 0x6424AC733A49B4D6 } },
+		{ { 0x97E5BE5D00AACA52, 0x31F25450E3518305,
+		    0xA57F1A84E66DB9FB, 0x045F2FBAC7E67488 } }
+	},
+	/* 5 * 2^216 * G */
+	{
+		{ { 0x351B75CC293F2F04, 0x411756A857A0C704,
+		    0x3791B9CAAFC16360, 0x3E898C1393B51B6C } },
+		{ { 0xF1C180FE21244EB4, 0xA504DF7BDCA4CD8D,
+		    0xDBD4AD7F57512CCC, 0x73DC4D9D47FD3F83 } }
+	},
+	/* 6 * 2^216 * G */
+	{
+		{ { 0x7F8F62FD6CF22108, 0x63B2C60AA5DDDA52,
+		    0xC7E4170E595200ED, 0x28A4667101C1CE98 } },
+		{ { 0xA035CC51D9CAB3F5, 0x99540D2FE74F1551,
+		    0x9C32197F08000562, 0x22B2FA9418596ED8 } }
+	},
+	/* 7 * 2^216 * G */
+	{
+		{ { 0xF6655DC719B3563B, 0x123743FB652D1852,
+		    0x8050A532CDCD3492, 0x5C5A198CCAEABB5B } },
+		{ { 0x8C686FC3548A1682, 0x65429E396CD10E47,
+		    0xCC51905D468EE741, 0x22484F9CE20ABA76 } }
+	},
+	/* 8 * 2^216 * G */
+	{
+		{ { 0x4447CA99D2E8EF26, 0x549F111DA4961D50,
+		    0xCF88F54EB8B37A24, 0x64AFF95C2A2B090B } },
+		{ { 0x1639272828405D64, 0xAAB19E9CCDF3DFD2,
+		    0xAE860830CAB90F30, 0x541D0820024DDF40 } }
+	},
+	/* 9 * 2^216 * G */
+	{
+		{ { 0x852D7BDEF329E661, 0xCD81576F54355C5A,
+		    0xE096461C410C7F6F, 0x380DE66060A614CD } },
+		{ { 0x6FCC86BB6C379A67, 0x00412EB18732E357,
+		    0x97D4897C914FE029, 0x20979DA8545ABD98 } }
+	},
+	/* 10 * 2^216 * G */
+	{
+		{ { 0x90293D355AE31FFD, 0x97701AF587374C01,
+		    0xDAF82BC6A2E0B08E, 0x0421E4C16D8EE0BC } },
+		{ { 0x6E1FEE3D83D77792, 0xA52CBCACB3EC02E1,
+		    0x2E5CA9F41EB64947, 0x124B2A15973EF7E3 } }
+	},
+	/* 11 * 2^216 * G */
+	{
+		{ { 0xAB70B62A7CA6BD10, 0x7F363AAE802CA22E,
+		    0xB06199A41A5F299F, 0x597675E286CFB061 } },
+		{ { 0xF67846767B3870D5, 0x719D34B9BA0A9AAB,
+		    0x6E798F46BABE5A5F, 0x2088FF71D66D03A0 } }
+	},
+	/* 12 * 2^216 * G */
+	{
+		{ { 0x64D1FBE31F05C826, 0xD13BFFB087593BB4,
+		    0x2C687EE5934308DB, 0x0A1771594B23ED91 } },
+		{ { 0x68E5329857A64FD1, 0xA7A9C193259B1FFA,
+		    0x94A8E590FFA6FD1C, 0x2E5AB502B4E59979 } }
+	},
+	/* 13 * 2^216 * G */
+	{
+		{ { 0xFCC074CE99DB5A9B, 0xE2A1802BD8069D60,
+		    0x203C837FD515A3C7, 0x7658019A554CC02F } },
+		{ { 0x54EDE297E129CD71, 0x71C4E960D6816B3D,
+		    0x4AEC94EBF06ED937, 0x6A1F3B8FB0F1C019 } }
+	},
+	/* 14 * 2^216 * G */
+	{
+		{ { 0x6F8788B732BE3E27, 0x24BA361CE7549717,
+		    0xF588D273631BD5D4, 0x661AF4C5DC4621C2 } },
+		{ { 0x2D0548909D6A2E8D, 0x24D4BB1FE6742320,
+		    0x749B5CA72701B41C, 0x37A9393223F376CF } }
+	},
+	/* 15 * 2^216 * G */
+	{
+		{ { 0x050868FB7592ED9E, 0xBE60F863B0175897,
+		    0x8AB07C27B610F22C, 0x37F193626485BAEB } },
+		{ { 0x7AEB08FB5E36D3A4, 0x50364D6B24864449,
+		    0xFF000A52C5DD89EA, 0x54F79E69A296DB5E } }
+	},
+	/* 16 * 2^216 * G */
+	{
+		{ { 0x2D1E68ECFDF52AF2, 0x6329ABAF97E17E34,
+		    0x9FA0C53EC63F8049, 0x68167EB0D224E62A } },
+		{ { 0xF948BDDF1B1FF472, 0x702446B858A1D148,
+		    0x40DF20F8DE83F28C, 0x297B85349EC3DA67 } }
+	},
+	/* 17 * 2^216 * G */
+	{
+		{ { 0xEC7182B0FB0731D1, 0x0C9530204ECFC3C5,
+		    0x40F056A152B3930C, 0x56362B3681D70D99 } },
+		{ { 0xBC5BA0EE25C2FB93, 0x9C32CB5D24B8F86A,
+		    0x80CED5F4FE337AA0, 0x6B9559BAE69565D8 } }
+	},
+	/* 18 * 2^216 * G */
+	{
+		{ { 0x78B6542AC449332E, 0xB537F736C70D5A63,
+		    0xE7E4C30260E0EBEB, 0x58001B07990FD5E0 } },
+		{ { 0x8156F125DFCA824B, 0x5F01969AD71FDEBE,
+		    0x9CEF68BACAE64966, 0x121D105563BF5720 } }
+	},
+	/* 19 * 2^216 * G */
+	{
+		{ { 0x09280E7D69BF65C8, 0x266A855C46876532,
+		    0x1A3E81155130D518, 0x38222D7FDFC6A8F2 } },
+		{ { 0x711C9776CAB46815, 0x03716E3A0DFFADE9,
+		    0x54FC664D3692BE2E, 0x480CADC4DCE91AE3 } }
+	},
+	/* 20 * 2^216 * G */
+	{
+		{ { 0x20496B20C8B05253, 0x59F1BB596F9AFE99,
+		    0x176246C34F6122F2, 0x50C60FE668F8E0E3 } },
+		{ { 0x300200B2925CC4BF, 0x5A669D1217C2CF7C,
+		    0xCEE12871C48CFDB8, 0x33D3004C16A58621 } }
+	},
+	/* 21 * 2^216 * G */
+	{
+		{ { 0x26B9A39824F7125F, 0xD6D3A1582611E26A,
+		    0x7F12CA64EC52CD35, 0x04BA3CD1455C9701 } },
+		{ { 0x5EA29F2BDEF6804F, 0x9138646DE80887FF,
+		    0x89A67CB3E36D4C8F, 0x7D8FF0EF39A9ADAF } }
+	},
+	/* 22 * 2^216 * G */
+	{
+		{ { 0xA9057358083EBEEE, 0x9871B353C67B26DD,
+		    0xA8D5829783B62723, 0x7A0846D0934809E8 } },
+		{ { 0xFA84750BD6D6D7DC, 0x06BB720A892B7394,
+		    0x0279F940AC2170C7, 0x1A2958023405F346 } }
+	},
+	/* 23 * 2^216 * G */
+	{
+		{ { 0xA1B749290A28B327, 0x826FEEAA22716F6C,
+		    0xD2A8AD7BC90C241B, 0x041E349B9B6D004F } },
+		{ { 0x6416E342CA475D36, 0x17CA70CB7083ACED,
+		    0x8CE6B737B7CDBF58, 0x2F954FC870B2FD45 } }
+	},
+	/* 24 * 2^216 * G */
+	{
+		{ { 0xAFB5E79F1F865A97, 0x6797F937659F8416,
+		    0xBF558800EECD89DD, 0x27E5F7CFE94656F2 } },
+		{ { 0x659804C92B79B5B7, 0x60FA76C18E442C0B,
+		    0xBF963ABEDC44B41A, 0x4E3872FE72AEC6CA } }
+	},
+	/* 25 * 2^216 * G */
+	{
+		{ { 0x1F02680D2C1D38FE, 0xC334C44D5A42F57A,
+		    0x2159F7F760F982DD, 0x563230533CB04953 } },
+		{ { 0xF0DC368903FE61F4, 0xB13183801BE3B906,
+		    0x0A22AA59BC3C3FF6, 0x5534458AEA38D4D3 } }
+	},
+	/* 26 * 2^216 * G */
+	{
+		{ { 0xD2C60B3FC97B1B2C, 0x1E1CED603EB33644,
+		    0x96F610A1BC14E231, 0x1FF32B4E03D3CBF4 } },
+		{ { 0x5033408B4081B732, 0x25809978C482B6B3,
+		    0x761E752054D0B387, 0x7D2BA1F984157D52 } }
+	},
+	/* 27 * 2^216 * G */
+	{
+		{ { 0x20ACF0E04FCDB20A, 0xE2C8210865B114FE,
+		    0x917EAFB157948AB0, 0x26C1EA7FFFCDAC68 } },
+		{ { 0xC747CBE505E9AC18, 0x2A22B12638F5CF8D,
+		    0x0207CD2911787AC0, 0x17F4F29A761325B9 } }
+	},
+	/* 28 * 2^216 * G */
+	{
+		{ { 0x79C9942C3B926FFE, 0x2FC3B2154526A97F,
+		    0xDC4AAF51E9CFC18C, 0x50A49DB2B7DC2C77 } },
+		{ { 0x90A943AEACDC7781, 0x495FEB0656715EA4,
+		    0x47D9F47ABAD4B5AE, 0x00D1B0C7FF055586 } }
+	},
+	/* 29 * 2^216 * G */
+	{
+		{ { 0x9BE61153B6F03C16, 0x2569E3063B4AFF2D,
+		    0x7F1B3CB479EE19BD, 0x2D9A75E7C4F52F70 } },
+		{ { 0x6CBF8A90BA017E0F, 0x7DD7E2F5B89CBB6E,
+		    0xBEC2A28D1BDFA4C8, 0x50ECA051D577B6FE } }
+	},
+	/* 30 * 2^216 * G */
+	{
+		{ { 0x24B2EBB8403F260C, 0x7087798CBED9A9B5,
+		    0x6DDE4BFCD3E576A3, 0x5C2B58191D21C55A } },
+		{ { 0x65C41739F56C1F62, 0xD31DD9FAA06C944E,
+		    0xD81A373775514ABE, 0x7EE844A9454DDEC5 } }
+	},
+	/* 31 * 2^216 * G */
+	{
+		{ { 0x7AF00440146ADA89, 0xA85631890AFA0FE1,
+		    0x54CCA6089C9F323D, 0x06C60BF2E098DB72 } },
+		{ { 0xD52E07B84A858500, 0x76D8A21795E0CEB1,
+		    0x042F4F9A9EF98A0C, 0x0467F8A43C9FBD26 } }
+	},
+	/* 32 * 2^216 * G */
+	{
+		{ { 0xF8E3FCE1E4EB8C9E, 0x1F1B9A7206ABB9F4,
+		    0xCBC11780B6ED8A37, 0x65761C717E07A14B } },
+		{ { 0x75EE1F924A078E5D, 0x39259EFC6DEBE90B,
+		    0xB41A3E95EE28E159, 0x51F50D55F7B9CA53 } }
+	},
+	/* 1 * 2^240 * G */
+	{
+		{ { 0x4FB4D309F62248CE, 0x49BC909C907CF360,
+		    0xE59FA74F528E6B6C, 0x0F7C3E769971AF07 } },
+		{ { 0x532FB8B626F4E7CD, 0xCE7ED4D95E044979,
+		    0x82570C18C567B378, 0x47098F3CD447A406 } }
+	},
+	/* 2 * 2^240 * G */
+	{
+		{ { 0x63726328FCD8BBDF, 0xFA973991B1E6BEFD,
+		    0x077CE1411B743E22, 0x284983FF3BC92B67 } },
+		{ { 0xE73FE844AFFF429C, 0xBB2A66E7E9A88B00,
+		    0x709C5F6763F05F68, 0x79F2EA40D491D5ED } }
+	},
+	/* 3 * 2^240 * G */
+	{
+		{ { 0x9A934908F9FAB796, 0x2BCF43D79D745EE1,
+		    0x176086D7E6F90CB2, 0x24F81EA515C48F7B } },
+		{ { 0x5E708B900927FD15, 0xFD5823AF76B9D8B4,
+		    0x07C3A0170F50C28D, 0x760F7E186D24840F } }
+	},
+	/* 4 * 2^240 * G */
+	{
+		{ { 0xE57DF509D0DE42B1, 0xF1F514F63A982D3C,
+		    0xE6424DB8932C156D, 0x23298DF2F39FAA0C } },
+		{ { 0xA2728008BEE08652, 0x4201D967F3DB99CC,
+		    0x682FD59BFE7F396B, 0x3AC22046E8E4CE7D } }
+	},
+	/* 5 * 2^240 * G */
+	{
+		{ { 0xBFD3272E8ECCE52B, 0x8A600D60D8D59938,
+		    0x8608DFB373421F91, 0x3B7D3E88B9AA6D46 } },
+		{ { 0x44AAD8E0233EB474, 0xBB9D66FE25AEE8BE,
+		    0x209CA5695D4E37CA, 0x173322796EBDF305 } }
+	},
+	/* 6 * 2^240 * G */
+	{
+		{ { 0xE284F1B4E0B5F7B3, 0x3BA3E05FCD5215B1,
+		    0x8FD22D9C97FA8764, 0x3ABC484F540769AA } },
+		{ { 0x3AC9177B5ECF14CD, 0x621D7E121B6FF651,
+		    0xA6B00E9BC7E24C76, 0x2480511C98057637 } }
+	},
+	/* 7 * 2^240 * G */
+	{
+		{ { 0xADE5673A9F962B4E, 0x89E69A0814444F67,
+		    0xF8E1A58CC74C1B67, 0x2529B5F56BD8B680 } },
+		{ { 0x7EC7D87009F85820, 0x6FC9E4CB87B33E8B,
+		    0x6A78D9275681CC0C, 0x7D95400C3B47C651 } }
+	},
+	/* 8 * 2^240 * G */
+	{
+		{ { 0xA38F5BF8410FB256, 0x7F1971B66FA50D18,
+		    0xB19C7572D4E03469, 0x6475FBA779E0F6D5 } },
+		{ { 0x1F227918557ED9C2, 0x9D0362EE3AAB0B39,
+		    0x877D55F914E7EC2A, 0x6448DC24DB3FE679 } }
+	},
+	/* 9 * 2^240 * G */
+	{
+		{ { 0x474BA128D10DFE51, 0xD228EE823983B5CA,
+		    0x1874C501624115E8, 0x69546402D2725C72 } },
+		{ { 0x931A32BB8C5D1859, 0x676B4C222CF02197,
+		    0x3018941FB274B029, 0x2741C75FAF15BEB5 } }
+	},
+	/* 10 * 2^240 * G */
+	{
+		{ { 0x97B9D5B20022EDD7, 0xA0FAE0FA5ED08EBE,
+		    0x0E33502E254017B6, 0x28F5508E7EF3A4CD } },
+		{ { 0x4A46A04CE4D938CE, 0x8C86B45CD5C2E826,
+		    0x3B2C475DEB871CBE, 0x326F02E9B9A64C8D } }
+	},
+	/* 11 * 2^240 * G */
+	{
+		{ { 0x7F1EA0364378F619, 0x9712DBDFF5BDA421,
+		    0x13E484B0B02225A0, 0x04649E57E0727AF6 } },
+		{ { 0x5CA9E1C1D02D65D9, 0x74DE4396DCB9189C,
+		    0x8DBA836CB02E7F85, 0x6FF8DC1100590429 } }
+	},
+	/* 12 * 2^240 * G */
+	{
+		{ { 0x7C6F0241A3FE8550, 0x2429E6D7150D9E99,
+		    0xE7680862C0506E19, 0x08484D56A40F00AE } },
+		{ { 0xDDAF1C5D68D07563, 0xC9786D7F7FF8D648,
+		    0x5515E65A74CC5A5F, 0x1181AF4EEF9ADAC1 } }
+	},
+	/* 13 * 2^240 * G */
+	{
+		{ { 0xC442E3D214B2459A, 0x690AD7E7021704DC,
+		    0x0CFA0F3961838FAA, 0x04D14C8F93E22825 } },
+		{ { 0x72508C237A2FD24A, 0x1EB64DF293BACC47,
+		    0xEBCBF0CEB315440C, 0x3DBF0CDA48268A46 } }
+	},
+	/* 14 * 2^240 * G */
+	{
+		{ { 0x68BF3EFB2540ACF6, 0x6A2446DAA9DACEE1,
+		    0x9563089721A54BFF, 0x578272271F702177 } },
+		{ { 0xA05B6165408404BB, 0x0238B64EFD78B792,
+		    0x2E1E24CDD8BE1F5F, 0x28079885A72612F9 } }
+	},
+	/* 15 * 2^240 * G */
+	{
+		{ { 0x443F5AC7324B296B, 0x033CC0F8C31A51FD,
+		    0x2A65400889A14158, 0x68BF4443DF60B3EA } },
+		{ { 0x36CF6955AEFD9416, 0xAE6A717A5C2F7BAF,
+		    0x07AE80C2ECA44FD9, 0x24318CCEFD888816 } }
+	},
+	/* 16 * 2^240 * G */
+	{
+		{ { 0x5A162FC2C0236152, 0x336B2ABA372AD1C0,
+		    0xC5B9D6C9FEA94004, 0x271A6427E0303D87 } },
+		{ { 0x7D9C495EE27E4727, 0x032754F94414C237,
+		    0xE24109015D7EC497, 0x27B21C7A6BAEE71A } }
+	},
+	/* 17 * 2^240 * G */
+	{
+		{ { 0xA8969EC67A5783CD, 0xEB423CB4A7F911B8,
+		    0x8FA2EBFE760EB570, 0x5DFEA4E52AC96E15 } },
+		{ { 0xB7DC54F961A2B71F, 0xC1209219EEA5935D,
+		    0xF537EF6F68B54703, 0x406B122E29B96CBB } }
+	},
+	/* 18 * 2^240 * G */
+	{
+		{ { 0x35F3111458831FB7, 0x8829E217546BA0DB,
+		    0x33E4F76C8225131F, 0x2EF837810F0D1DEE } },
+		{ { 0x80C6A103281FB6F2, 0xF753715EC68BDF5D,
+		    0x5A6301AE7062792F, 0x4CB9AD5C3E6C2D21 } }
+	},
+	/* 19 * 2^240 * G */
+	{
+		{ { 0xCE195F038DFD629F, 0x741D3BB45E5CAF2C,
+		    0xAE4EDF45DF03F826, 0x7DB790612F58497C } },
+		{ { 0x7C1D2317F6552C3A, 0x889A146B886953DA,
+		    0xD8E403A2E81BB6AD, 0x4CFAE167DE4E5A3C } }
+	},
+	/* 20 * 2^240 * G */
+	{
+		{ { 0xEB5FE8BF81A35DE2, 0x3AFA70EFC1950D4E,
+		    0x43A92A46AFD2FBE9, 0x3102C9D21A9753C3 } },
+		{ { 0x819B54EA9429D1B0, 0xEFFE611582E5C8EB,
+		    0x8E0C1AA3ED353A58, 0x45EBE02E55E78F42 } }
+	},
+	/* 21 * 2^240 * G */
+	{
+		{ { 0x6B7AD6A1EFC5B4D4, 0x55305ED5C4C7884D,
+		    0xD15433DD2276D5EF, 0x3BEFF425E55263C9 } },
+		{ { 0x2BEC547DD8485407, 0x01DC35A9A1A8140D,
+		    0x6ACE2FA020EEF111, 0x713539703EEFB678 } }
+	},
+	/* 22 * 2^240 * G */
+	{
+		{ { 0x9338219739BAEEB6, 0x9421BCDBC2A663E8,
+		    0xFB15A2E8BBC9F6DC, 0x5540F8C59D4CCA97 } },
+		{ { 0x33B36B48E4C5FEBB, 0xDBB9914621300BAF,
+		    0x07F8F366F13EC046, 0x7EE63BB4377F0E60 } }
+	},
+	/* 23 * 2^240 * G */
+	{
+		{ { 0x793308BA9DA9B963, 0xBD92D63C66617DF2,
+		    0x90C7BF0CB3E7065B, 0x6D422B540473B938 } },
+		{ { 0x10F7AF0E32363E59, 0x9561163FE1E6E659,
+		    0xC91098520AA59240, 0x5E86159676D3B1D4 } }
+	},
+	/* 24 * 2^240 * G */
+	{
+		{ { 0x5D2AB05FAE4BE118, 0x8488E1F571BF691A,
+		    0x53A26E0D1BCC8D6A, 0x5C7C2CE0051AE659 } },
+		{ { 0x6973C6540A2F061A, 0xB36D675D7371C258,
+		    0x6D64954A0DA57606, 0x5887454EDBC882E4 } }
+	},
+	/* 25 * 2^240 * G */
+	{
+		{ { 0x7C4901E9EAD5D8BC, 0x75EDC00D44FB08B7,
+		    0x5644DC430C16F3FA, 0x70FC47E7C641116C } },
+		{ { 0x578BAD57D2C05DE3, 0x3A6B2E1E88CEA5CA,
+		    0x3188B6D7EC7DC6A9, 0x5203AE8CAE6DB107 } }
+	},
+	/* 26 * 2^240 * G */
+	{
+		{ { 0x0159E342985A66B0, 0x56B060BF7500A6B7,
+		    0x927AB286526447F0, 0x36E4F8E969CE7B78 } },
+		{ { 0xBD43CBA9759BB07C, 0x0B07525338DD28E2,
+		    0x840064162F8218F2, 0x45B18F94D10B3089 } }
+	},
+	/* 27 * 2^240 * G */
+	{
+		{ { 0x0EB0616CCF8BC8B9, 0x57AF3D39B81F6E0A,
+		    0x5BC8C630B7CE92EF, 0x4BCA1096EAC52188 } },
+		{ { 0x9492AD45A0355E31, 0xC9B3D8F2BE8099F3,
+		    0xEFECB1038547A58B, 0x520E59907E665BD2 } }
+	},
+	/* 28 * 2^240 * G */
+	{
+		{ { 0x0284F4AA269926E5, 0x3997CDF4023D9367,
+		    0xF425E59D977B00CD, 0x6105D8C08D93E888 } },
+		{ { 0xECCBCDA1B738B728, 0x9884D6F6D731311E,
+		    0x4F531C235D66CD17, 0x5E251C50DECD807A } }
+	},
+	/* 29 * 2^240 * G */
+	{
+		{ { 0xFCAEAD2DE8C4414E, 0x1484A32C10959B1C,
+		    0xA7BF124E6BD8EF32, 0x67879A09C86D0184 } },
+		{ { 0x660D8A0C0E8CBF90, 0xA41B2A1994E205C5,
+		    0xF98CA9B7BB883898, 0x04D4BBDDADE4256C } }
+	},
+	/* 30 * 2^240 * G */
+	{
+		{ { 0x8CB38541672815E7, 0x9A22EA0197F8684B,
+		    0xA4EFC55BE56AD288, 0x29AFE350F0495CB8 } },
+		{ { 0x355FD538F19F6104, 0x2659864343A5DD98,
+		    0xBBFC436AB7BED817, 0x6FDE54AE2BE074D0 } }
+	},
+	/* 31 * 2^240 * G */
+	{
+		{ { 0x8D07E6A621341CED, 0x617EFFF044A494C8,
+		    0x0599DE3F30264B4D, 0x485EB32F5ED92BB1 } },
+		{ { 0xEFF3324CC298E795, 0x36205825F8360CB5,
+		    0x7B9BCD0F1F50F95E, 0x6C177BBCE03CF038 } }
+	},
+	/* 32 * 2^240 * G */
+	{
+		{ { 0x2E1F51852080F414, 0x48125C4009758AD7,
+		    0x1B7A20BBD6CCAECD, 0x6E6F3EC85C79A33D } },
+		{ { 0x7770EFB174B12E2D, 0xF809F9E15F6EEC65,
+		    0x3CDFD857EF3A71F3, 0x52485F8B02344CEE } }
+	}
+};
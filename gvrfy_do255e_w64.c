@@ -0,0 +1,909 @@
+/*
+ * Odd multiples of G and 2^128*G for do255e_verify_helper_vartime()
+ * (wNAF), 64-bit limbs. Generated with: mkgtab naf 8
+ * Do not edit.
+ */
+
+#define VRFY_NAF_WIN   8
+
+static const do255e_point_affine_xu window_naf_G[] = {
+	/* 1 * 2^0 * G */
+	{
+		{ { 0x0000000000000002, 0x0000000000000000,
+		    0x0000000000000000, 0x0000000000000000 } },
+		{ { 0x0000000000000001, 0x0000000000000000,
+		    0x0000000000000000, 0x0000000000000000 } }
+	},
+	/* 3 * 2^0 * G */
+	{
+		{ { 0x0000000000000152, 0x0000000000000000,
+		    0x0000000000000000, 0x0000000000000000 } },
+		{ { 0xC2F21347C4043E79, 0x6B1CEBA6066D4156,
+		    0xAB617909A3E20224, 0x12358E75D30336A0 } }
+	},
+	/* 5 * 2^0 * G */
+	{
+		{ { 0x9B7D88CD74D7D3CA, 0x0E31B461193896AC,
+		    0x93464506E97D44DB, 0x0ABC8AC61DCD9949 } },
+		{ { 0x1F2B6B08DA5B43EE, 0xE40F8B8BC44A0C63,
+		    0x5866F1F8B35FB70C, 0x185034D250F768D7 } }
+	},
+	/* 7 * 2^0 * G */
+	{
+		{ { 0x33E381251F43C3D5, 0x49BF0E2E71C6FE8F,
+		    0x6AF69CC116BAEF18, 0x36199FBAD0C9585E } },
+		{ { 0x7EB52414159EF4EA, 0xB885C9D1EB4CC9E1,
+		    0x350914B3EE64BF7F, 0x6DD8CDFA520AED5A } }
+	},
+	/* 9 * 2^0 * G */
+	{
+		{ { 0x8DF7F2C9CE799A9C, 0x7AC7F7C3AFDD04F9,
+		    0x915FE4A27D833740, 0x1ED67871986F29BA } },
+		{ { 0xA84A27A9D0A08E61, 0x27E9084D132CCAC1,
+		    0x498C7D8B01F68C40, 0x6957FDFF940E4159 } }
+	},
+	/* 11 * 2^0 * G */
+	{
+		{ { 0x6562064C442E3709, 0xD013EB4D114A7267,
+		    0x166892C716D5320A, 0x2824BCCA3B493396 } },
+		{ { 0xA9A8911D864E7F82, 0x65CF6B9CAB741725,
+		    0x8C133221E772B327, 0x158521078CD1F209 } }
+	},
+	/* 13 * 2^0 * G */
+	{
+		{ { 0x90DF642868789634, 0x267A28B9CB72C6CA,
+		    0x27BE4B2B937625B5, 0x62003971A89B844F } },
+		{ { 0x90F8839881061965, 0x67D0394FF2BFCB98,
+		    0x913200FCCD1396D8, 0x17F96D76306A3580 } }
+	},
+	/* 15 * 2^0 * G */
+	{
+		{ { 0x496055CDC3DFB745, 0x0673F992F547B770,
+		    0x8EFAE8F99B3E5BB3, 0x33C76A13E12C07DD } },
+		{ { 0x7FFA4AF719120727, 0x705D12571BF74984,
+		    0x4AD1FA649FAE1F07, 0x2F4CA2B6265D7456 } }
+	},
+	/* 17 * 2^0 * G */
+	{
+		{ { 0x36AC4B82C8DD950C, 0x3BC71A07581EBCA9,
+		    0x94A66E3610E2FCD1, 0x61DF242C3E9BE9AF } },
+		{ { 0xE3276CF6BDEB0077, 0x5D5663FC26C268C8,
+		    0x23FA50B9ACDC0F67, 0x21DC28E7D2D8965B } }
+	},
+	/* 19 * 2^0 * G */
+	{
+		{ { 0xD1A17C18D218B28D, 0x1F278C04267A218D,
+		    0xEE2FB42277FB76EF, 0x2724E39552EC12E8 } },
+		{ { 0x2E9605460CD12CCD, 0xB16C3B02FC75CB1C,
+		    0x351029554A163102, 0x3709C2591F7E11F3 } }
+	},
+	/* 21 * 2^0 * G */
+	{
+		{ { 0x6DE072071638A7B6, 0xB1732E9C026D3EBA,
+		    0xECA1B8D8D870C351, 0x04F7F1128487A6DC } },
+		{ { 0x233D107E7F5C0492, 0x2A022951CC3C3AAF,
+		    0x0A64893A7EF1CDEB, 0x5345E7B89765645D } }
+	},
+	/* 23 * 2^0 * G */
+	{
+		{ { 0x44790D64037CDF63, 0x77425D46BD49B1DB,
+		    0x023EBF965F3F72F6, 0x317DF35C25F97016 } },
+		{ { 0xE75DF66DD4BAE67A, 0x2547699963FA4FC1,
+		    0x294BE5CB14211F34, 0x5CF37A023D4811EB } }
+	},
+	/* 25 * 2^0 * G */
+	{
+		{ { 0xD9ED2C90C67DCB77, 0x6DC21B6797BC9B74,
+		    0xEC586D5AFB3ECF5D, 0x17D208932915A7D8 } },
+		{ { 0xD7F0756D81426416, 0xF1EF2F5840E42644,
+		    0x2DF6F8D645DC9A1E, 0x482E3C441BB5AB9A } }
+	},
+	/* 27 * 2^0 * G */
+	{
+		{ { 0x49AFAF5A8F49FE50, 0x7154397035321D90,
+		    0xADAF6DED027A7D9C, 0x2B43669AC0BC7A2C } },
+		{ { 0x383007F21604373A, 0x9312067A5D6602D1,
+		    0xB4B4AEEB0EE6F063, 0x3EF161DFC7CA3E3D } }
+	},
+	/* 29 * 2^0 * G */
+	{
+		{ { 0x1A37CFB777744B91, 0x574A3F8DDE46B327,
+		    0xB30DAB47D5627E00, 0x319322FA638590EF } },
+		{ { 0x1B84442949729EF5, 0xB426A97B06873730,
+		    0xA5446EA5C6FC7F85, 0x05563EC126C27BF9 } }
+	},
+	/* 31 * 2^0 * G */
+	{
+		{ { 0x673EEAA32944BD3C, 0xE1045D7ED6F7D7E9,
+		    0x5C62415907E09114, 0x7A2E7FC428291944 } },
+		{ { 0x92351782F5433145, 0x9BAFAE934F6D8619,
+		    0x5811ABA77C22BCE8, 0x141BE6C46E67CFD7 } }
+	},
+	/* 33 * 2^0 * G */
+	{
+		{ { 0xDA24CBA5EA54EF90, 0x664C798A713AC452,
+		    0x8D370D3026F8D608, 0x79CDD0856C7C5BDA } },
+		{ { 0x3ACB23747DEA2F18, 0x1E06E8E5211A3372,
+		    0x87EE13DB45CC37D1, 0x595FE2323D18E784 } }
+	},
+	/* 35 * 2^0 * G */
+	{
+		{ { 0x999DDB2388BE72C8, 0x0F70EE049F02614E,
+		    0xB33C8929FC073BAF, 0x0DEA8579DD797A10 } },
+		{ { 0xB9AA5FF43441301F, 0xC0DB94EEC6660171,
+		    0xE6B38C563E895C8E, 0x41CB7E60C3B57AFD } }
+	},
+	/* 37 * 2^0 * G */
+	{
+		{ { 0xCF1C367A05C5EFBC, 0x9F716D53C7AA5DF3,
+		    0xAF1183CF0B4745E4, 0x1EF34FB0A116EA82 } },
+		{ { 0x3FB9AB9FADFFD32C, 0xFA20CF85EE6733E0,
+		    0x925FDA18345449A8, 0x22F811F67740EBDE } }
+	},
+	/* 39 * 2^0 * G */
+	{
+		{ { 0xAEB83F19B5536350, 0x9F3DE026443F1A1D,
+		    0xC652EB7A415740C0, 0x10EEC686AC330213 } },
+		{ { 0x4496F0D938A12254, 0x3AAF258F6ABF9119,
+		    0x98FAF1B052127FEA, 0x010520645A44A70E } }
+	},
+	/* 41 * 2^0 * G */
+	{
+		{ { 0xB9CA967F74A24A7E, 0xEE36F67110CD79E5,
+		    0x54E7F9EB330011F0, 0x6DE2B11D42F32344 } },
+		{ { 0xB73E011234EA9A91, 0x9124D6C94CF7BDB2,
+		    0x4C7C98F5B5A9B3AE, 0x45A1647FE93C7DEE } }
+	},
+	/* 43 * 2^0 * G */
+	{
+		{ { 0xF0E18F6B184F365C, 0x96520753CEE3695F,
+		    0x9AEC1A6764071E3B, 0x7A4A4EB9A9EAAED9 } },
+		{ { 0x32AA7328CC1C403B, 0x384FBB72B8546E1D,
+		    0x9A76CC859F918B7B, 0x12908EDF3D2D0D77 } }
+	},
+	/* 45 * 2^0 * G */
+	{
+		{ { 0xE64DE89CE143D8DB, 0x9AAC9C25090E98B2,
+		    0x7D9E6FD516DB3F7C, 0x3F21307444337742 } },
+		{ { 0xA0CBD0CD58FD15ED, 0x6E957653A5CC5442,
+		    0xBDDEC72741768B4D, 0x56D37702C2F0671D } }
+	},
+	/* 47 * 2^0 * G */
+	{
+		{ { 0x983B0C2DBB4D79C2, 0x6CC8E1F91F469398,
+		    0x45DF51656EC42FD6, 0x4D47ADFD2134D805 } },
+		{ { 0xE87CE1CFD81E7279, 0x3088F2319DF54BA2,
+		    0xC76B215398AA7571, 0x059FFCB89B2592F1 } }
+	},
+	/* 49 * 2^0 * G */
+	{
+		{ { 0xA99D7FFF30C512B2, 0x0AA799BD3CBF64BB,
+		    0x7C616574CEBA5309, 0x52C99795DE407DF9 } },
+		{ { 0xDA1A5D9909B412CE, 0x21510261D47A34DF,
+		    0x1215D91FFAF6D667, 0x11D65DF5D69978FD } }
+	},
+	/* 51 * 2^0 * G */
+	{
+		{ { 0xD397BC3DC7587340, 0x613B9EA0879F0162,
+		    0xAD17AF745CDD0E31, 0x4FEDC7849CAD1CFF } },
+		{ { 0x8A11DB6276EA8C34, 0x8075A356EE7A49D9,
+		    0x84160545107D227A, 0x6E3D8C63E985EDC3 } }
+	},
+	/* 53 * 2^0 * G */
+	{
+		{ { 0xCAFC83A2B3388BA7, 0x2B46849CA0CDFDEC,
+		    0x63B0551C2056AE24, 0x207D1292FC23167D } },
+		{ { 0x37F46BAFAFF1D8CB, 0x0A80B7FEE1E9CD94,
+		    0x374D086426B7123D, 0x6C689391840BC498 } }
+	},
+	/* 55 * 2^0 * G */
+	{
+		{ { 0x91FCC806F6776184, 0xBDA7A8368718A223,
+		    0x9815A269FB61F11E, 0x318E5895FCB73B78 } },
+		{ { 0xC9F083D8AD1EF3EB, 0x30A69F6DC59207B1,
+		    0x45CCB90BF3F2C251, 0x40C684C52C08BECA } }
+	},
+	/* 57 * 2^0 * G */
+	{
+		{ { 0xD61FC94A85B152F2, 0xFE59EC42EE63C3E7,
+		    0x71DD4235EAA3AA0A, 0x7B5E1772F873321A } },
+		{ { 0x37301873571104E4, 0xFC04207A2C90F130,
+		    0x978C98BD9D932ADD, 0x084C74A7B5FA8279 } }
+	},
+	/* 59 * 2^0 * G */
+	{
+		{ { 0x4A056F2A1CD53AB7, 0x797691AB7DA0BF6D,
+		    0xCE53CD82F86B2274, 0x5D789619C6F9130F } },
+		{ { 0x8183B509100119B5, 0xCF882733B5471E11,
+		    0x607A7FC119F84FEA, 0x515D72C79F8C0DAE } }
+	},
+	/* 61 * 2^0 * G */
+	{
+		{ { 0xFCB46919ACFBA121, 0xE15C25AF33939046,
+		    0x8DAF1D516F4B61AB, 0x7F872F46FAD37CAD } },
+		{ { 0x9A09A709EBBA8BC4, 0xC4D3CE06D01CB448,
+		    0x78BC59430B86CEB7, 0x10764BF6B3E91712 } }
+	},
+	/* 63 * 2^0 * G */
+	{
+		{ { 0xF5345CD891448595, 0xBFC3E4FA973E4A8C,
+		    0xA36885DD37123F42, 0x69C4CD34CCBEF147 } },
+		{ { 0xFF33D7F0DB06A74B, 0x084EE4F57778E055,
+		    0x69B7C7ACD24F64C9, 0x7084BB1E503ADCF6 } }
+	},
+	/* 65 * 2^0 * G */
+	{
+		{ { 0xB0221C35C2448204, 0xF0E0A73552792607,
+		    0xB89CF929FB9BFEDE, 0x22A155E9EBEE3C0C } },
+		{ { 0x2A8F026D0594136E, 0x5E1EE03BE65501C9,
+		    0xFD8B4C4266EEAEE8, 0x3DC8041F381A7448 } }
+	},
+	/* 67 * 2^0 * G */
+	{
+		{ { 0x06135FDACEBE219E, 0x4FD1A1D4F189390E,
+		    0x0589E776A1B32E76, 0x605EB4A05ABAC9F2 } },
+		{ { 0x4D60477FB35254D8, 0xF02579A68415BABE,
+		    0x893D8B9EB226632B, 0x6D2D9D5640EB7FFE } }
+	},
+	/* 69 * 2^0 * G */
+	{
+		{ { 0x49F897D6839C5DBF, 0xEEB95F4E260140DD,
+		    0x7B61A3F7FDD52342, 0x20770ABE2EADAA8E } },
+		{ { 0xE8B397EBF8D89D77, 0x3BF838408003C72B,
+		    0xE8B95A49D6655798, 0x1A1213099C1370F7 } }
+	},
+	/* 71 * 2^0 * G */
+	{
+		{ { 0x70333A50594B7062, 0x3E7744AE1A480A16,
+		    0x96D5B4D22E10C387, 0x70C964ADF7EFFEF9 } },
+		{ { 0x183E10037A149F01, 0x120A211CB6B3896A,
+		    0x4A7523C8C0E6E763, 0x4B190C781D544E12 } }
+	},
+	/* 73 * 2^0 * G */
+	{
+		{ { 0x6FBD7F35CFC1530B, 0xC2878DE8C63A22C1,
+		    0xFE809A7B6CCD5C27, 0x2D74EEE7EBE7CE70 } },
+		{ { 0x698B44C25F83CAEC, 0x68B9F20B7F0D2501,
+		    0x6E7FC6C7F52F668B, 0x78881B816E3DB8BE } }
+	},
+	/* 75 * 2^0 * G */
+	{
+		{ { 0xF97D35194B99909C, 0xC17D508A2BEABCD6,
+		    0x8DA254C43E259DCC, 0x467D4149AD9F2BCA } },
+		{ { 0x528515E0FD8B735A, 0xCD985B2160A6E0B6,
+		    0x0D045084A8999C84, 0x4DA45806F3890926 } }
+	},
+	/* 77 * 2^0 * G */
+	{
+		{ { 0xCBD3F916014643F0, 0xA9C5AD0A090833A3,
+		    0x913315E27D728D23, 0x7DF684A30A6F2580 } },
+		{ { 0x84D9C463D272E60B, 0xE26209D6C77BC049,
+		    0x7D2CD65F812617B3, 0x4954B980DC9C871F } }
+	},
+	/* 79 * 2^0 * G */
+	{
+		{ { 0xA49FC2D7B7341D57, 0xD14677B431F0DA78,
+		    0x36AA38B46D2042A0, 0x7C467F4A8829C560 } },
+		{ { 0x12A3A22567F4E2BE, 0xBD6A9A2A8AD94B32,
+		    0xBD42FAC56F8C24AA, 0x5E708EEC960D7099 } }
+	},
+	/* 81 * 2^0 * G */
+	{
+		{ { 0x055DFC7BF83FFF5E, 0xBD0F1B38D4FB0860,
+		    0xA07EE8A147502A2F, 0x19FB1E7F7AAE9ECA } },
+		{ { 0xB968E670592E4598, 0x9F2537825103EA27,
+		    0x32778C0C45B68859, 0x3C8C15CAD8788429 } }
+	},
+	/* 83 * 2^0 * G */
+	{
+		{ { 0x8C4DC4ABB908EA73, 0xB3AD4247020BD4C0,
+		    0xF0CB5D10E1AD0453, 0x4BA284761F65167A } },
+		{ { 0xF5B0D347C3B29A93, 0x2B0EF18D96AAD37F,
+		    0xA72C3ACF66734FA2, 0x140779B9E3901563 } }
+	},
+	/* 85 * 2^0 * G */
+	{
+		{ { 0x029A29E307649CDA, 0x5F83F10D34FC6909,
+		    0x80EE146AD57405F7, 0x684A96ECA4AF6A65 } },
+		{ { 0xF0BA2B48BBC9D0C1, 0xC80EC910815AE718,
+		    0xD76A91019E02477D, 0x5BD65A02A86409B1 } }
+	},
+	/* 87 * 2^0 * G */
+	{
+		{ { 0x90E7094190624549, 0xA7AA9F12118BF32C,
+		    0x51D3FAF383507AB2, 0x446402FFD74CB141 } },
+		{ { 0x57267E08070DE7B1, 0xFBED9BD5B8752081,
+		    0x05A5F0B4DB45C209, 0x7A844FDDED6C4B7B } }
+	},
+	/* 89 * 2^0 * G */
+	{
+		{ { 0xFB97FF1AF8FC2C09, 0x42819613F109B642,
+		    0x0CFD1001BC430B77, 0x718A382B945E0706 } },
+		{ { 0x51FE090E187F54CF, 0x7608012E3B6D2A5F,
+		    0x33D54D7A063291BE, 0x7B05FC20AF182819 } }
+	},
+	/* 91 * 2^0 * G */
+	{
+		{ { 0x6562EC4CD522161F, 0x6C5683E889B35E53,
+		    0x781FE1F7081019E4, 0x66B8C2DF2636B0B2 } },
+		{ { 0xEDE33301B8CB9147, 0xCA8DA9D17E4C016B,
+		    0xB646C69721C73357, 0x4F812C1455FB2D91 } }
+	},
+	/* 93 * 2^0 * G */
+	{
+		{ { 0x765EB66ABE111E15, 0x8BEA4D1223352851,
+		    0xA10CF3A1C751208D, 0x44F54F9C8FEFE736 } },
+		{ { 0x3E64B388CB98CE97, 0xEB4C16122827BBDA,
+		    0x0FA87EC1C2A75AB5, 0x43005F65E196A0EE } }
+	},
+	/* 95 * 2^0 * G */
+	{
+		{ { 0x14111FDDDE47BE71, 0x28245F6299190089,
+		    0xE9A8D2BB29F55167, 0x418FA9279AB9C95A } },
+		{ { 0xBBFB492454DD7180, 0x8B2A658931BF2984,
+		    0xC9FA96F2383253BC, 0x010DC85CFCC28039 } }
+	},
+	/* 97 * 2^0 * G */
+	{
+		{ { 0x85F08CD4D2F49011, 0x8BAE64B324684CAD,
+		    0x473888AE3B03BAB8, 0x489D22A787860484 } },
+		{ { 0x91C228AAAC7DBE35, 0xA17B9A8BDA3F1628,
+		    0xCA9B6809BF6FE66C, 0x22DD677C109293AD } }
+	},
+	/* 99 * 2^0 * G */
+	{
+		{ { 0x46112219D9418EB5, 0x4B06A5C29BE7A72A,
+		    0x54B3DFA9B7ECD3DD, 0x7A4043722550F0A7 } },
+		{ { 0x4A425114A80EA435, 0x667A48FDBCDD0F5F,
+		    0x49764EEC1054F3A4, 0x3FADABB6F991C6B9 } }
+	},
+	/* 101 * 2^0 * G */
+	{
+		{ { 0x2FDD92D4E67AAD1B, 0x92BC5C552F905A94,
+		    0x4A4CE1960D8C9C2F, 0x7FFD1FB71ECE97BF } },
+		{ { 0xF9568F9739FBB364, 0x313C754EB4BF36FE,
+		    0x449012305E7F3D1C, 0x4A384263B5851AEE } }
+	},
+	/* 103 * 2^0 * G */
+	{
+		{ { 0x95F0E001A91E875E, 0x5A7EA7DCD9472AC0,
+		    0xA2B8C4881DA5136E, 0x19FF7AF9CA6F98FB } },
+		{ { 0xB51F58EB23620D10, 0x4749F28DB35C80BC,
+		    0x277CE119483FBA11, 0x5775E1DA60828903 } }
+	},
+	/* 105 * 2^0 * G */
+	{
+		{ { 0x409C5F1F53E5839D, 0x93E9DD7DF891E13E,
+		    0x4C0EA3A24825A818, 0x2BB8928E7301194F } },
+		{ { 0xCBB3E160F5DB39D1, 0x1709F445BA02E555,
+		    0x988EBB5C45880D7A, 0x326E625445AACCF9 } }
+	},
+	/* 107 * 2^0 * G */
+	{
+		{ { 0x73131FA34F8DC9EB, 0xE5572CC77FA43B57,
+		    0x2CB648EA08D07422, 0x4128086520CCD8EB } },
+		{ { 0x532B8348F555EFE7, 0x751452CD9240F310,
+		    0x7E8173E19DF32828, 0x2966B26E65D90C4D } }
+	},
+	/* 109 * 2^0 * G */
+	{
+		{ { 0xE6780DBCFDA37B3F, 0xBABC591968F7F188,
+		    0x38C04DE846F55F3C, 0x2ED8F536BC8571EB } },
+		{ { 0x744A265E07A97092, 0x2EC78F8F7B841208,
+		    0x511A221139BF65C9, 0x622042F95BE06554 } }
+	},
+	/* 111 * 2^0 * G */
+	{
+		{ { 0x62327AA2739600C5, 0x21C785E4EC1A45FF,
+		    0xE1CA7D4AD0CBA9F8, 0x0DCA3E11DC90143D } },
+		{ { 0x6BCEB7A5C780366A, 0x9205FC00FE03A322,
+		    0xFB5BED015AE82D1F, 0x1EA5AD1A3551C2D0 } }
+	},
+	/* 113 * 2^0 * G */
+	{
+		{ { 0x6FB89822F444781D, 0x86CC2B5F019EFC66,
+		    0xDDCBC1980BD274A8, 0x392DF33E4F6734E4 } },
+		{ { 0x4C8635557427CCA1, 0x477619C90D7E95D6,
+		    0xCEE66E5E49392DC7, 0x21B0FE6DA78E9AF0 } }
+	},
+	/* 115 * 2^0 * G */
+	{
+		{ { 0xA7491437F1C5DE01, 0x7B33E3D840568C05,
+		    0xA27FD31C177C6161, 0x2583EA5195A9259A } },
+		{ { 0xA6A21DBF80AEFA31, 0x16AED199A0729B4D,
+		    0x5FEC53F8D2657571, 0x5B08B47FF6879B1B } }
+	},
+	/* 117 * 2^0 * G */
+	{
+		{ { 0x0CF60490F83E50D9, 0x4627BEAA38C80027,
+		    0x60E45AFCA9333031, 0x73D1E5D529762A35 } },
+		{ { 0xFCB90D228BEFA364, 0xEF3C5D185503E9BD,
+		    0x9F38EB35BFED429A, 0x2819E195085B8F61 } }
+	},
+	/* 119 * 2^0 * G */
+	{
+		{ { 0xA221909866A07E89, 0x859B1755CD417CDD,
+		    0x07144D7ADC98BC8C, 0x7CBA2C1ADC21D8E1 } },
+		{ { 0x24D007294CAAE5A6, 0x3EEE8787E6A4726B,
+		    0xEE90098E52DFF313, 0x7D26B8E1176C8CB4 } }
+	},
+	/* 121 * 2^0 * G */
+	{
+		{ { 0xA21D095DA773DE6F, 0x8871EF61F4C33BBB,
+		    0xDB978F6A96414273, 0x3EEF0D0EA97D0E3B } },
+		{ { 0x47BB2568C84A236B, 0xC5C552FB0549E8D8,
+		    0x08F2E166ACE11DE7, 0x6331D02F9D743795 } }
+	},
+	/* 123 * 2^0 * G */
+	{
+		{ { 0xFA13754140A9BBEA, 0xEC09685CBFF225B3,
+		    0xE6E0084B5AE2B422, 0x41F1501B5C4C6BF5 } },
+		{ { 0x87443FBB23669D17, 0xE251BAB440FD2DD5,
+		    0x37FC523B9505181F, 0x6732F542CBC3C81D } }
+	},
+	/* 125 * 2^0 * G */
+	{
+		{ { 0x75D00FA08F5A7AAF, 0xAF49D46EC1B25748,
+		    0x04A3F6D33BEAD2AF, 0x026ED9768DA7FE37 } },
+		{ { 0xB2735D6915F89F1A, 0x09BF22F5224F22E1,
+		    0x118F37EF00BBE388, 0x2C8A30B3CA6C29D6 } }
+	},
+	/* 127 * 2^0 * G */
+	{
+		{ { 0x02278424831E9F3F, 0xDB959706272CC10C,
+		    0x69066413B54F5649, 0x76CF460819237CA0 } },
+		{ { 0x9A621BC559BDCF44, 0x2FC6098FBA3FE63E,
+		    0xD1E433F6CD64B88F, 0x22B319F19C9E5065 } }
+	}
+};
+
+static const do255e_point_affine_xu window_naf_G128[] = {
+	/* 1 * 2^128 * G */
+	{
+		{ { 0xF4C0EDA0412DC1CF, 0x922CFBCE42CAE105,
+		    0x3DA00EE7A9AB696A, 0x4901F2752D1685D3 } },
+		{ { 0x62D452F8BDA5CF10, 0x50C25327F6EE3087,
+		    0x9A9FE56CF5A910DF, 0x02C7AD54CCC0E440 } }
+	},
+	/* 3 * 2^128 * G */
+	{
+		{ { 0xAE76901F0D4BC8C6, 0x639CF3CA650411FC,
+		    0xBD65C6367A6D29DD, 0x7A9E514A11B00C5F } },
+		{ { 0xF238B8D6F7639FFE, 0xC258F59DEF6F1127,
+		    0x61E2FFEB870B4AD5, 0x58F51A2EA762BCCA } }
+	},
+	/* 5 * 2^128 * G */
+	{
+		{ { 0xD0188F1C90F5B3EF, 0x6EB97D5CCDAA6603,
+		    0x3A02A52F128A881A, 0x24B1E144D48913C2 } },
+		{ { 0x4F01C51935F16389, 0x1E248A4CBC0E42F2,
+		    0x6A1E8ECF8D7A98FD, 0x221D2D6B47025D2C } }
+	},
+	/* 7 * 2^128 * G */
+	{
+		{ { 0xE00A7990AB722BF0, 0x6AECDBE128802BA6,
+		    0x29CBAEC1C1B63688, 0x0A35E90008514327 } },
+		{ { 0xFEA35DFFEB88BDFF, 0x4D9CA40E46D4FCA2,
+		    0x4E24F2C27664057F, 0x5843DA1280DD251B } }
+	},
+	/* 9 * 2^128 * G */
+	{
+		{ { 0x0F3FA75F1BE9B6BA, 0xD95A746F701CE994,
+		    0x11094C182A98E0E1, 0x62CA667253795F40 } },
+		{ { 0x0080B5451EFFAB42, 0xE1DF494342FB6231,
+		    0x52143A0CB4735189, 0x48E72C90F85D15AC } }
+	},
+	/* 11 * 2^128 * G */
+	{
+		{ { 0xA328B19F63F634C4, 0xA773CFAEA81FAC95,
+		    0x742091A7FFCE7668, 0x56FA5ABA605D8086 } },
+		{ { 0x2FD76ABCC1217BED, 0xDA162D41AE45E6F0,
+		    0xAE43474A6CA836D2, 0x3F44E0E3C1D9363D } }
+	},
+	/* 13 * 2^128 * G */
+	{
+		{ { 0x54C7346819750483, 0x39C08415FB0ADF8F,
+		    0x1988BF81B3679D8A, 0x7320CD21C619DFC4 } },
+		{ { 0xD27C0DDF116B03CB, 0xE058DC43EF90B509,
+		    0xF1C24344AC0AED43, 0x50A4589856B872A7 } }
+	},
+	/* 15 * 2^128 * G */
+	{
+		{ { 0x5538EFBFBC112398, 0x2711B7BFFA778C3B,
+		    0xD661E34DC64A6526, 0x075978E25955F69E } },
+		{ { 0xDB313F0EE1FBFEF8, 0x609AA2E6D2230C32,
+		    0xE2C72A258BF029F7, 0x73C0C2564E345EED } }
+	},
+	/* 17 * 2^128 * G */
+	{
+		{ { 0x9CF41EBCEA6ACED0, 0x45C929A3D2F76269,
+		    0x24B90E514682BCF8, 0x1BF4BAFFB25EB969 } },
+		{ { 0x8AC0C19EECBCEA9D, 0x25516C89861E4758,
+		    0x194735DE4798A348, 0x6DAAE3EFED7E9173 } }
+	},
+	/* 19 * 2^128 * G */
+	{
+		{ { 0xE0ED73969E091C95, 0x3C521EC28B8014B4,
+		    0xBB610D80E35C280F, 0x4ED076387DE10B25 } },
+		{ { 0xFE42154B68CCB240, 0x5D151938B73CD137,
+		    0x00B07D94A68B9C8F, 0x7F39AEA190752B21 } }
+	},
+	/* 21 * 2^128 * G */
+	{
+		{ { 0xB7BE2AADAD203DC0, 0x61363A4A86F1D054,
+		    0xC48DDA8084BA4EEA, 0x250670F8FE3A4786 } },
+		{ { 0xFF662BB4F4B7D2A9, 0xB034CA7B00A69AAB,
+		    0xBFE895A98C615823, 0x4AF1F97C071CE899 } }
+	},
+	/* 23 * 2^128 * G */
+	{
+		{ { 0x6D6C4DEB38BC70B6, 0xD3B575DC4B62A84B,
+		    0xDD055026A95579AB, 0x705BA01960D359A6 } },
+		{ { 0xECE73F82445290C2, 0x81C98AA9838BD734,
+		    0x37953556E9140C33, 0x6CDD54DCF7B87219 } }
+	},
+	/* 25 * 2^128 * G */
+	{
+		{ { 0x50E8B4407B2AF771, 0x6C61FB69B3805903,
+		    0x363D11EB78C3BE25, 0x237872142ACD8518 } },
+		{ { 0xC387FFFA9EE26C15, 0xE92BB1552B5987D7,
+		    0xE53DB1621544CBFB, 0x3351FC9E8C6971CB } }
+	},
+	/* 27 * 2^128 * G */
+	{
+		{ { 0xF01CC487682E36BC, 0x8BFB5299D2B23050,
+		    0xF11299A6D70048D1, 0x57A0F2CA9C661C7B } },
+		{ { 0x44F7876EDFD567C9, 0x152F37A961ED6EA4,
+		    0xCC495E20DE8B13A2, 0x4377D7E441EE009C } }
+	},
+	/* 29 * 2^128 * G */
+	{
+		{ { 0xCC581BC251B227A4, 0xC271062F030B3FB2,
+		    0x6BB03256E850901C, 0x0DB1F052491ABF09 } },
+		{ { 0x9EB5E49EBBE33EA4, 0x25A04C74DD2507DA,
+		    0x4E77197BD007F185, 0x72B33B06E95063BE } }
+	},
+	/* 31 * 2^128 * G */
+	{
+		{ { 0x70181D832ABCC789, 0x989C0FBE66C6C389,
+		    0xF71D1A1364BE3C03, 0x3878AF6F9B97F166 } },
+		{ { 0x480DBFBB4BF8B52F, 0xDF9E1D6310287914,
+		    0x0592D1F228EAD094, 0x4468B0F00584A891 } }
+	},
+	/* 33 * 2^128 * G */
+	{
+		{ { 0xA8C8336B22C2BB7B, 0x986D13D62F557737,
+		    0x9DCC80505C3455B3, 0x08B02ECA190DF9F1 } },
+		{ { 0x2D4D75475E8184BA, 0xEE989F736DD1A6B9,
+		    0x15734C56FCBDA697, 0x69F519B233D57079 } }
+	},
+	/* 35 * 2^128 * G */
+	{
+		{ { 0x01ED92778D404FDB, 0x09EC05A534056314,
+		    0xEB6FCCC5BF33C492, 0x3ADA02185CA9C476 } },
+		{ { 0xCA42CD2134D9F20C, 0xD9814C17542275A0,
+		    0xD6F74806A0A2FAB9, 0x227F1F2271486330 } }
+	},
+	/* 37 * 2^128 * G */
+	{
+		{ { 0xACB59C6F6BF3B3FC, 0xF55AE4DC5C080041,
+		    0xF39FD8A50E2851D7, 0x0B1FC57FB2E2DDDD } },
+		{ { 0x6375093E26A7F4A9, 0x174C5A6FED626CC1,
+		    0xBB094ADADC06AB77, 0x7E80736C5AF04EE1 } }
+	},
+	/* 39 * 2^128 * G */
+	{
+		{ { 0x7FB8DE68729B91F8, 0x9D1794CB673BF4A9,
+		    0x445FBF5281E751BB, 0x112D4460E1ACB36C } },
+		{ { 0xE3B71B5BA478A568, 0x8018C7AC0D209559,
+		    0x33054AEA888AAEF7, 0x1DB7F4D179C71E60 } }
+	},
+	/* 41 * 2^128 * G */
+	{
+		{ { 0xDA3A8D8A38A0777B, 0xDF3404B378409C56,
+		    0x60BD02317501A8E0, 0x453C31FBDFE021E5 } },
+		{ { 0x4B187A0010FEE9D1, 0x48CCB7A2207922C9,
+		    0x993FC23063E142DD, 0x28086BEF2623B7CC } }
+	},
+	/* 43 * 2^128 * G */
+	{
+		{ { 0xF3B0668905EA2443, 0x7F9E71A86DBCA6F3,
+		    0x4C401F1D289EC915, 0x487F23D3F2EB6FBB } },
+		{ { 0x05F11AD7C00F665A, 0xEA24D06B4BFC567F,
+		    0xC380F3B2BCDD739E, 0x44DD8AA564ECEEE2 } }
+	},
+	/* 45 * 2^128 * G */
+	{
+		{ { 0x19FE7C4A08FC9E07, 0x928690B7CC9BC083,
+		    0xC684FD1915A0FA12, 0x37A74F2D590C7D01 } },
+		{ { 0xBCC4B267A653CFAD, 0xE3EA662C699303A9,
+		    0xD7D6B2C4D048C252, 0x7919CF9954F2EAB9 } }
+	},
+	/* 47 * 2^128 * G */
+	{
+		{ { 0x99FEEA5449AF4ED5, 0xF94A42594494A98E,
+		    0x88545130C51BC9B2, 0x69DBA73F093FB816 } },
+		{ { 0x25BA84D45B4C73A1, 0xEE9306A49BF54FA1,
+		    0x212B6E5BCC2290E8, 0x3F2485E81CC6F1B1 } }
+	},
+	/* 49 * 2^128 * G */
+	{
+		{ { 0x45BEB860223B7493, 0xEE78AE77DBE1A86B,
+		    0x4C480788661A8DB6, 0x7340DA98516E6210 } },
+		{ { 0x7C9A08F32B4FCF1F, 0xB75285A8ED80D271,
+		    0xDEBE94347E28B0F6, 0x7F1007EE2074E897 } }
+	},
+	/* 51 * 2^128 * G */
+	{
+		{ { 0x14F47AD782973B93, 0x2E183449423B3395,
+		    0x0C3F18B17DCE7E0E, 0x7107493AB7CE3834 } },
+		{ { 0xCD77A0711F4042CB, 0xDC949D764BF4A91E,
+		    0xD089EC8DECA46B41, 0x694486B35ADB38F8 } }
+	},
+	/* 53 * 2^128 * G */
+	{
+		{ { 0x3B0F8DA1C200A47A, 0x48B14FAD37B3758A,
+		    0xD98E386B636A5CC6, 0x695DC49D78142AA6 } },
+		{ { 0xC2CD1714A97A7E39, 0x81118496A8813DEA,
+		    0x1BB4E5B912083318, 0x2E273E0A571AF8A8 } }
+	},
+	/* 55 * 2^128 * G */
+	{
+		{ { 0x65D186B00052C2D4, 0x4793EACBA032B445,
+		    0xCBD1CF2A7D67AB2F, 0x195D9255E2380028 } },
+		{ { 0x3B81E8CC3CE8DFF4, 0xD3D25629632EED71,
+		    0xC58502BAE553283E, 0x2FC54177396D10EA } }
+	},
+	/* 57 * 2^128 * G */
+	{
+		{ { 0xD3F2EF1DB5CDAEDA, 0x5A03FD0CF97942DE,
+		    0xC36C56AB027DF92C, 0x3961B0CB80BD9932 } },
+		{ { 0x5C339A698F2B3B32, 0x5D57D95273AA769B,
+		    0x92D93235AF28E527, 0x01B5BE0D4B87CCE0 } }
+	},
+	/* 59 * 2^128 * G */
+	{
+		{ { 0xCF8D2EF4C2EDB2B0, 0x71E9AB55DA55FE83,
+		    0x481FCBA2F465A6E3, 0x2716FFE7E8D2CDC2 } },
+		{ { 0x2124094EC401BD02, 0xBFBEE0B63E014C85,
+		    0xF822D69295340275, 0x19216F4A8F927615 } }
+	},
+	/* 61 * 2^128 * G */
+	{
+		{ { 0x2172F3D4E906831E, 0xA2C5375C376EB2F3,
+		    0x19EC36C155CB7C7E, 0x35C153D6EB7AE149 } },
+		{ { 0xB2D4E534F4584005, 0x8B6E4DA4A5426B04,
+		    0x56DB9C57F7B34538, 0x0B6EFF8E98CDF148 } }
+	},
+	/* 63 * 2^128 * G */
+	{
+		{ { 0x814F7A18FAA2E8FC, 0xD3117473D0BEF8E0,
+		    0x3E1A7578CB1EFED4, 0x5D4DB237F20BA417 } },
+		{ { 0xAC087C82C384CEEA, 0x0AC6D5801BA34B72,
+		    0x6EA8079D587867BF, 0x61D70F4128DB4929 } }
+	},
+	/* 65 * 2^128 * G */
+	{
+		{ { 0xC04953BE7398C5E2, 0x1957215D8108CDC6,
+		    0x694484CDAC19ECDD, 0x7486A49CF1B6D4AE } },
+		{ { 0x18F4397C60BF1DE0, 0x8F720C8ED22471F6,
+		    0xCF2E9ED22D0A4C1A, 0x07A42DA01A34596D } }
+	},
+	/* 67 * 2^128 * G */
+	{
+		{ { 0xB5F661BA4845EEFD, 0x1475A3D8B7FAFC97,
+		    0x9C716C204C6F30D4, 0x2DD1CA1F9D5C5E30 } },
+		{ { 0xD4ACB2AAFBB3F04D, 0x1D78EB9FAE6292D2,
+		    0x2010DFF02EADA676, 0x210AF1A45E8CC1B4 } }
+	},
+	/* 69 * 2^128 * G */
+	{
+		{ { 0xF5CA8487B755ABEB, 0xA3EBF701E973FC5D,
+		    0x24DF6B953D5886DC, 0x284B9B854DDF7941 } },
+		{ { 0xD6EAD50D21AA877B, 0x12F2732546F40117,
+		    0x720D625C6E539B8F, 0x6644F90732D7FCEB } }
+	},
+	/* 71 * 2^128 * G */
+	{
+		{ { 0x6A2F1EC34415E91D, 0x211451733891DAEE,
+		    0x2C8136AAAA92FB8B, 0x7E6091FCB17AF542 } },
+		{ { 0x16B1B967DAB00363, 0x45C8B8227B91AAF6,
+		    0x616E181D9E4C850C, 0x23F4C0714F1186C1 } }
+	},
+	/* 73 * 2^128 * G */
+	{
+		{ { 0x06BD178B20E45115, 0xA9F865C067BDAEDD,
+		    0xD7EF0AABDD0C0622, 0x6D3B0B9A133AB6AC } },
+		{ { 0x10986A45478FF0A9, 0x1EBF5A79E9A2D842,
+		    0x91CAC49FAD7DC55B, 0x0AA057EDE2C09695 } }
+	},
+	/* 75 * 2^128 * G */
+	{
+		{ { 0x8FA7036F6A1150CC, 0x2917AC39524C8533,
+		    0x81F13CA99E8FAFE9, 0x32B294A07F03E708 } },
+		{ { 0xD0FF8D325C1DDFF1, 0x71698036200EE84F,
+		    0xF14999775BD76026, 0x658F53A1195450D5 } }
+	},
+	/* 77 * 2^128 * G */
+	{
+		{ { 0xADD1125C0BB98605, 0xBFB6029964E460ED,
+		    0x1E17BEB0C8E07CE3, 0x1AA7A3F38005A633 } },
+		{ { 0x414A984FBE0094A9, 0x22E6799748C29135,
+		    0xF1B566CD90B5AED5, 0x30189FED26611BF8 } }
+	},
+	/* 79 * 2^128 * G */
+	{
+		{ { 0x5ADF9A22B826846D, 0xE65A310FC374DD9A,
+		    0xC7F391E253AE0901, 0x35D802FCE8407102 } },
+		{ { 0x8DF3AFA5F2085FD0, 0xE5E0D59FA243F57F,
+		    0xD7ABA26D74F6393F, 0x3C192CCE435F6B9C } }
+	},
+	/* 81 * 2^128 * G */
+	{
+		{ { 0x0CB59C03BD358DCA, 0x3928F9108C9BC391,
+		    0x3B85F0F7E4038C0E, 0x05E8CAF6AC269655 } },
+		{ { 0x5099482834B0B6BA, 0xD8A9432EADFFEB46,
+		    0xDF0B1960D57B69E2, 0x091CEE5B6BDE71FA } }
+	},
+	/* 83 * 2^128 * G */
+	{
+		{ { 0x006D0337819EE2E1, 0x28BF5068F5FCF5F9,
+		    0x4358643CE0DB6D43, 0x73CFA312B36A0B51 } },
+		{ { 0x8F22A943E0183042, 0x1247D5D6D1D50D10,
+		    0xA64ABB48215163F5, 0x45ACB3E925E775AE } }
+	},
+	/* 85 * 2^128 * G */
+	{
+		{ { 0xB0E20213EB775B99, 0xD827A7F3D4ABA95A,
+		    0xE3BBA489862838A5, 0x00228AC8E94E0A4F } },
+		{ { 0xCBF34AA042ADA564, 0x34D4732056EAE5FA,
+		    0x7A56B33F6D3686BB, 0x5E3B4A14A9B32EBE } }
+	},
+	/* 87 * 2^128 * G */
+	{
+		{ { 0xF9AD64C37C884B54, 0xD29CF4F632DF1D4C,
+		    0xA247629CC17D85AF, 0x02954C8D4BD6CABC } },
+		{ { 0x7B91907C2C621683, 0x402597DB1DF0BA3D,
+		    0xF90C9E065985DAA4, 0x36B7FEB92EB1AF07 } }
+	},
+	/* 89 * 2^128 * G */
+	{
+		{ { 0xE558AD8D65953788, 0x3A5ADFA15118E553,
+		    0xAB1B8579D7F6D9C5, 0x499731020945A739 } },
+		{ { 0xC7A705656D2ED8D6, 0x985AAF5DD4C3A28C,
+		    0x85644B37700B7102, 0x39D0D7922D441B6A } }
+	},
+	/* 91 * 2^128 * G */
+	{
+		{ { 0x64717A2546C0E74B, 0xCEE0C9B372B9C0EA,
+		    0x8CAABA66DF2427AE, 0x2271288000B12107 } },
+		{ { 0xC367F884D739C565, 0xD9CDE3964B47DEBB,
+		    0x628C57AE0349108F, 0x4705C52333580CA3 } }
+	},
+	/* 93 * 2^128 * G */
+	{
+		{ { 0x8E3F98A8E5C57788, 0x4229453AE3407EF0,
+		    0x278567CCA92B06C7, 0x2E93049400050198 } },
+		{ { 0x6306A344C422620E, 0x76CE1143D1E57B4B,
+		    0x022E6E3811BF7264, 0x3F415FE32FBBEFE1 } }
+	},
+	/* 95 * 2^128 * G */
+	{
+		{ { 0xF9925A56AD46AED4, 0xA59A12A7C81017B0,
+		    0xCEEA33E91C3634C1, 0x08212970D254336D } },
+		{ { 0xC22136CF59E84168, 0x997ACF2AE8B3B868,
+		    0x909DC5C7AE0A0263, 0x790D67C034543C9E } }
+	},
+	/* 97 * 2^128 * G */
+	{
+		{ { 0x38044B540B371C54, 0x7197E658DD55DB2E,
+		    0x9686531B6F3DE55E, 0x308B09AB0C67CE8E } },
+		{ { 0x23B4AC48FD4B1989, 0xED31B08980A4AC93,
+		    0x00F1AEF4298A2D3B, 0x21978DE26B23FE3E } }
+	},
+	/* 99 * 2^128 * G */
+	{
+		{ { 0x747FB2226AD44979, 0x5CC84026BB534ED5,
+		    0xE5EA9290B79E6037, 0x60A45448D122B61D } },
+		{ { 0x553F3A28FA1094A5, 0xE36D7AF23E11FF3F,
+		    0xAEFF2EF469673688, 0x11F5EAEFE5419404 } }
+	},
+	/* 101 * 2^128 * G */
+	{
+		{ { 0x5B7E9914F651F631, 0x9B7A4BA4B58983B4,
+		    0x497A464FA2FB6402, 0x7AB805544113FB10 } },
+		{ { 0x1DE76984026F583E, 0xC47F644781410F75,
+		    0x46447E44F2C2B88A, 0x3EDCE726369EB9D8 } }
+	},
+	/* 103 * 2^128 * G */
+	{
+		{ { 0xEEC1F20C647D4E88, 0x10B6382EB0B3B55B,
+		    0xF9D4AE81830771EF, 0x0B0A62C511CB03EF } },
+		{ { 0x42401FBC94781763, 0xA3678BE962EA4C74,
+		    0xB559E5A3857940EC, 0x16039F06E6C3C641 } }
+	},
+	/* 105 * 2^128 * G */
+	{
+		{ { 0x80283AC3DD516552, 0xDCA9DA037169B32D,
+		    0xCDC759047D364B0C, 0x331294B2EB028A4D } },
+		{ { 0x8A1E0D116EB124D7, 0x4142100515862D15,
+		    0x4981A94BE7C9D207, 0x5D17F69B7D95F2BD } }
+	},
+	/* 107 * 2^128 * G */
+	{
+		{ { 0x8FA6692C2E4A9E91, 0xC53C7FCFAB1638C9,
+		    0x2F738CD4BD28C4B7, 0x6E18E41C71911379 } },
+		{ { 0xF24250519C7AEB05, 0xF9E23A78C95107F7,
+		    0x2651B0C1D765CBAB, 0x739A05D372253750 } }
+	},
+	/* 109 * 2^128 * G */
+	{
+		{ { 0x8380C09CE9BEEEE2, 0x688EB0E18A886119,
+		    0x09E460E7AECF1BE5, 0x7133ECC6CA0C2B02 } },
+		{ { 0x89737925B160A147, 0x424B9F5A57EB0B35,
+		    0x7886DF342294B110, 0x6F03892D1BB0BE5F } }
+	},
+	/* 111 * 2^128 * G */
+	{
+		{ { 0x5F334FBEFD389083, 0x3F24FE58216EFF6A,
+		    0xC915AB5B98844F66, 0x14546ACB55475A68 } },
+		{ { 0xE15115D1F0B61036, 0x784D82106B4C2937,
+		    0xBA5890B2F42892CF, 0x49BB407CD1DFCBD7 } }
+	},
+	/* 113 * 2^128 * G */
+	{
+		{ { 0x332E06AA38EB0045, 0x5B37B6BE24BB58D6,
+		    0x422569FCA72BE195, 0x1FE6DB81156ABC0F } },
+		{ { 0x464B1A8E1836356A, 0xDD1ECEA0D92D6C5E,
+		    0xF62006D0605A2363, 0x036C2641C0CB646D } }
+	},
+	/* 115 * 2^128 * G */
+	{
+		{ { 0xCC09F65DF7CD482D, 0x33FDA23FFA7E6ADC,
+		    0x37C608D195B5B51D, 0x5A0B003850A9FE4A } },
+		{ { 0x2510BA6549490446, 0x877D55AEB4E52542,
+		    0x4575D7E36333D350, 0x79846D210CAC9CAB } }
+	},
+	/* 117 * 2^128 * G */
+	{
+		{ { 0x87B861CA6A10F42A, 0xA806167D330455B9,
+		    0x5B1309D1582B6EFE, 0x32274E003999F21E } },
+		{ { 0xEF5FCA658F6F3D7F, 0x0D4EB87894981EF4,
+		    0xBB09B6D77A7FB9FB, 0x5A6E51A36FC30440 } }
+	},
+	/* 119 * 2^128 * G */
+	{
+		{ { 0x7F17717C8399DFC0, 0xAC9E1DCC294E6F5C,
+		    0x3C1B41663B1D11CF, 0x00796F4AC4EAAFB0 } },
+		{ { 0xF54B9777260AD07D, 0xEC4B8B37492BAD0F,
+		    0x895A17596B5C32F4, 0x30EEFBE6EAFBA0C4 } }
+	},
+	/* 121 * 2^128 * G */
+	{
+		{ { 0x49573DB1161C8F7C, 0x16AF8F5CA56E50A9,
+		    0xC6EAE86C75E7A995, 0x5394AE2C877B0110 } },
+		{ { 0x4BC136EEF3615C2B, 0xCE173BE28973FD67,
+		    0x12285F712B8D4C48, 0x68BD1C488656D675 } }
+	},
+	/* 123 * 2^128 * G */
+	{
+		{ { 0x2AD1CF51CAF14859, 0xB5F39EC2AB1EB400,
+		    0x2FBA76C39FDC8646, 0x138953BF85B139B1 } },
+		{ { 0xBD4F47F0F680DC6C, 0x3E995A364996C0BA,
+		    0x36F984681B3B1B4C, 0x75EFAC5EE29A5048 } }
+	},
+	/* 125 * 2^128 * G */
+	{
+		{ { 0x6A97E5BD5E213251, 0x754109D232F07C2F,
+		    0xA0BF4343DD5B8E74, 0x467D7B20328B9B6C } },
+		{ { 0xD73F1D3DF4849821, 0x3E0C47A644319964,
+		    0xB95CB7C9CAF13014, 0x2C8F3289C8C56A26 } }
+	},
+	/* 127 * 2^128 * G */
+	{
+		{ { 0xB4CCE62B0084FE87, 0xC0670E3ABF274127,
+		    0x299FE830528D4847, 0x5DB58C6AD4B8442E } },
+		{ { 0xC5ADF96B5B13E761, 0x6356EF8F9A034A3F,
+		    0x2B35BFFE9EB2CBE7, 0x46FE30F59C68B831 } }
+	}
+};
@@ -0,0 +1,909 @@
+/*
+ * Odd multiples of G and 2^128*G for do255s_verify_helper_vartime()
+ * (wNAF), 64-bit limbs. Generated with: mkgtab naf 8
+ * Do not edit.
+ */
+
+#define VRFY_NAF_WIN   8
+
+static const do255s_point_affine window_naf_G[] = {
+	/* 1 * 2^0 * G */
+	{
+		{ { 0x4803AC7D33B156B1, 0x3EF832265840B591,
+		    0x213759ECCB010B9D, 0x39BD72651783FB6D } },
+		{ { 0xAAAAAAAAAAAAA584, 0xAAAAAAAAAAAAAAAA,
+		    0xAAAAAAAAAAAAAAAA, 0x2AAAAAAAAAAAAAAA } }
+	},
+	/* 3 * 2^0 * G */
+	{
+		{ { 0xC92EA6A45AF542C8, 0xACA2B1F0EB2EBB62,
+		    0x16AA9AB4772D49BF, 0x586E82D468993FDF } },
+		{ { 0xB0E2616D07647DD6, 0x79835A85D9B70D8F,
+		    0x39545AAB733292C6, 0x27A19C073EE92301 } }
+	},
+	/* 5 * 2^0 * G */
+	{
+		{ { 0xD4C604388FAAFD54, 0x478144CACA27D2A0,
+		    0x4B4B7554A3381C38, 0x78CC3E71A8C94117 } },
+		{ { 0x9819FEFFB48175C6, 0xEB222706A19AC3DD,
+		    0x410723C5BE5D5845, 0x3C18C25DF4EA9551 } }
+	},
+	/* 7 * 2^0 * G */
+	{
+		{ { 0xE45744799916AE56, 0xAB719188444F94C0,
+		    0x8BCF3B53F4727AB0, 0x239A8F014119EE4B } },
+		{ { 0x6D72E617646D9E07, 0xE08B7A2B9844C50F,
+		    0x164E30CF18FDB104, 0x44C18E58F1A5F7AF } }
+	},
+	/* 9 * 2^0 * G */
+	{
+		{ { 0x6F20F664F35EBE0B, 0x72C56CBCBBE70025,
+		    0x1B8A888E7A1BC6B3, 0x3AE1B93B4536C750 } },
+		{ { 0x8952D2A9DD9C2BCC, 0xF5DA264D49EF49CB,
+		    0xAD270B422A4F8A38, 0x78F62E180A6E3986 } }
+	},
+	/* 11 * 2^0 * G */
+	{
+		{ { 0xFC96E106BF390F8E, 0x87F4FE12D17AC934,
+		    0x20DD4A1C455D2425, 0x0F489EA0CF96C239 } },
+		{ { 0x3F7E226E3512C58A, 0xC44C89C9E83EFE42,
+		    0xB9E17C3BF2137EC0, 0x3CF2AACDFDDB2B1D } }
+	},
+	/* 13 * 2^0 * G */
+	{
+		{ { 0xBB832D11959A60E5, 0xF3AF5A147660C5E6,
+		    0x1037C50FE1FAFA73, 0x251739F159A18E7B } },
+		{ { 0xC611B8215A7DE759, 0x958D80A0A6307017,
+		    0x58717037E45D5DD5, 0x4C6EA6D5ECC46A53 } }
+	},
+	/* 15 * 2^0 * G */
+	{
+		{ { 0x725096F4FAC9FD25, 0x4072199CA8F661BC,
+		    0x1E3D756A54E4B489, 0x36A82923B7C5D81C } },
+		{ { 0x0E7071C300CF6A28, 0x738D92CE822D2881,
+		    0x85798A741DCCB0F9, 0x13E1D3C237073682 } }
+	},
+	/* 17 * 2^0 * G */
+	{
+		{ { 0x3940993F26056099, 0x7317F06D45454504,
+		    0x97EFC6E6E49D0882, 0x569BB09318CA6FA5 } },
+		{ { 0xDD7930EB7584C49B, 0xE23AECFA6A911FAE,
+		    0x551A661A1E764813, 0x50E31FF04634DB74 } }
+	},
+	/* 19 * 2^0 * G */
+	{
+		{ { 0x7874570F05EDE01B, 0xCC7B2FDDEDE8EAB0,
+		    0x57F5A9A77347EC36, 0x4ACA5C9991BDDEB1 } },
+		{ { 0xA20D3062D1D03717, 0xEE5E6C36608E032C,
+		    0x6923961C67B8CFAC, 0x41279DD8FCE1CE7A } }
+	},
+	/* 21 * 2^0 * G */
+	{
+		{ { 0x34CF249D433BEB67, 0x9FFB0B06383CE17A,
+		    0xC41E042576241A5F, 0x5C09174FE9E35A9C } },
+		{ { 0xA9FA13D476EF5323, 0xD568C0F3773F989C,
+		    0xFC5C3E2A6308EFC4, 0x4E2A7A0D1DF2207F } }
+	},
+	/* 23 * 2^0 * G */
+	{
+		{ { 0x3341E9A12ABE0DF4, 0x4C8C189A3F12F94B,
+		    0x522992FC9F29DDD9, 0x69B183A00FCBA041 } },
+		{ { 0xFD78170301463FF0, 0x7DB2412ED5FA89B7,
+		    0xF22FCF452840A919, 0x18F6726E9AB47D5F } }
+	},
+	/* 25 * 2^0 * G */
+	{
+		{ { 0xAB664C1583A57462, 0x7869491153411469,
+		    0x5C937337D0CA6CAF, 0x2734C856349DFCEF } },
+		{ { 0xBDA4965FBE284507, 0xF3BE5EFF19F5582E,
+		    0x14E2B275AC106A0E, 0x65691E343412AE34 } }
+	},
+	/* 27 * 2^0 * G */
+	{
+		{ { 0x0BB6EBAC64B56D89, 0xA2C3FDED3ACDF2B7,
+		    0x97102BA9D6028B9D, 0x4335DEA27C6227C5 } },
+		{ { 0xBA1150B9F72AD0AE, 0xA4963B7DBD024002,
+		    0xE4EDC1AF27F6BDB9, 0x31EEB31EE7CDE76F } }
+	},
+	/* 29 * 2^0 * G */
+	{
+		{ { 0xA6E9DC9B5E2D2399, 0xE02B1476117C121F,
+		    0x13CCC1EBD683A825, 0x5EBADE7F092595BD } },
+		{ { 0x7EAA3DF6BA291608, 0x9D15485F01FF7806,
+		    0x55C6235FC5A79920, 0x2F24795083128E8A } }
+	},
+	/* 31 * 2^0 * G */
+	{
+		{ { 0x58F5498BFB942391, 0x3F02A1C2698B9ECD,
+		    0x3874F3E1DE9E863F, 0x2B1D5A330ECA574D } },
+		{ { 0x50586AD6A51A1A6A, 0xEC7FDDCC902D898D,
+		    0xAC6552F3787C082B, 0x29A869E9B11873D0 } }
+	},
+	/* 33 * 2^0 * G */
+	{
+		{ { 0x972F86A7D9712C0C, 0xB999F95BC97764AA,
+		    0x3C51B5F6A3107218, 0x3895675ED03643FD } },
+		{ { 0x0938808DC011AD7E, 0x2C7B9692B9E163CC,
+		    0xCF54CA93E28359D5, 0x2718553A4EE8A30B } }
+	},
+	/* 35 * 2^0 * G */
+	{
+		{ { 0x772A4EB260D04359, 0x3DF9BF9EDF3CE695,
+		    0xEEABE456C707A944, 0x4880BF7AFDD50ABF } },
+		{ { 0x0B30CDC8FDC02E8C, 0x14ECE563881F1B44,
+		    0x9AA36FD8E3A60A46, 0x7DD1193707505462 } }
+	},
+	/* 37 * 2^0 * G */
+	{
+		{ { 0xF410EF80378370DB, 0xC97A47E8CEBE8258,
+		    0x35854311AA40225F, 0x3D80EB27049F33AE } },
+		{ { 0xDAB971FF7CC029AD, 0x346F64BEC1A3BC4A,
+		    0x4794E710136427CF, 0x089E9A87FE60E7F9 } }
+	},
+	/* 39 * 2^0 * G */
+	{
+		{ { 0x2DDA28D6EC697771, 0x6EFFE207BEB582A4,
+		    0x648BF0CD9E8BDDF9, 0x178CBA6A2555736F } },
+		{ { 0x6ADC15DD1B2563CE, 0xFFAB80E68A1E27AE,
+		    0x651F172736EBA311, 0x20C682E08266DA71 } }
+	},
+	/* 41 * 2^0 * G */
+	{
+		{ { 0x4DF90447C8A0E848, 0xBA2E626C7271800E,
+		    0xB424244BF53577B8, 0x12901F3279285847 } },
+		{ { 0x74ACB01B2D55556A, 0x7A88FD95F3256E73,
+		    0x07B0F5F9B2861935, 0x5CE634A7EF93C828 } }
+	},
+	/* 43 * 2^0 * G */
+	{
+		{ { 0x0AF148FD1EFC0B37, 0xDA1E9BB50D92C185,
+		    0xF561B02C08355175, 0x531B8C6531FBBDA1 } },
+		{ { 0x0FD1747C8BB4AEE9, 0x32965751B64FBB1A,
+		    0x7ABA036AB68D929A, 0x7DEA92EB64C727AD } }
+	},
+	/* 45 * 2^0 * G */
+	{
+		{ { 0x60B8A745F6DE5396, 0xE98F09F5EB8A181C,
+		    0x9C326D7E58BC61AC, 0x7A651ABA16CA0D87 } },
+		{ { 0xA586240532475824, 0xEECC6C388B071B4F,
+		    0xFD8D72D7B6846B1D, 0x65D203AFD687E9B8 } }
+	},
+	/* 47 * 2^0 * G */
+	{
+		{ { 0x93322270A258A905, 0x7D3B61D63E44DDA8,
+		    0x951BCBF2CECDD61E, 0x4C2BC254DA234749 } },
+		{ { 0xE7D7E25A3C536D6B, 0xB4A0F62A436D42D9,
+		    0xEFFB49BDDD61AEBA, 0x67AB9EEF32257AEC } }
+	},
+	/* 49 * 2^0 * G */
+	{
+		{ { 0x9FF7C19F25610581, 0x3CB171BE68767282,
+		    0x5E7D84E15EBA02C7, 0x13E634DD3873253C } },
+		{ { 0x536F19C2DFE16C09, 0x4A023584B16C2D38,
+		    0x8CF0B853215F162A, 0x293A2C88E5FA8E8E } }
+	},
+	/* 51 * 2^0 * G */
+	{
+		{ { 0xB63C180CE811B12F, 0xBFAC7853817CB7E6,
+		    0x29EE3A760D956BCD, 0x19BC272D1FC04355 } },
+		{ { 0x1D8704BEF602556F, 0x89155330BEFFC837,
+		    0x5A9C7B5A5E3491E1, 0x38C421F8E54C5C7E } }
+	},
+	/* 53 * 2^0 * G */
+	{
+		{ { 0x9C48AA5D2B1EBAFF, 0x68B1C9AF21EC37EF,
+		    0x3F053BA9DE658A1C, 0x292E65FFECDB0A5A } },
+		{ { 0x090FC59743117AF7, 0x341B79E9ACE44503,
+		    0xFD1FDD6460C4AA63, 0x1C2035621B649406 } }
+	},
+	/* 55 * 2^0 * G */
+	{
+		{ { 0x0ED989C62B0E9EDD, 0x4AE02FFF9265E3A1,
+		    0x9108AA85156CE5C1, 0x0430B000EB29462A } },
+		{ { 0x06D307E078AE146D, 0x30B8992612DEA845,
+		    0x2D2FAAADE8DFB82D, 0x17ED639EFDBDCF49 } }
+	},
+	/* 57 * 2^0 * G */
+	{
+		{ { 0x8E7BC5E01EB795E5, 0xCAA126E4594D7F99,
+		    0x94363D6112385F75, 0x1DBB59367DA74638 } },
+		{ { 0x60DAD3ACBDA6D0FC, 0x602F723785D5CE58,
+		    0x769F3B8B1CDC0642, 0x0D7DF177753BF105 } }
+	},
+	/* 59 * 2^0 * G */
+	{
+		{ { 0xAFAFE093DFA50302, 0x767E3987B11ABFDB,
+		    0x32DFB03061E59F68, 0x2F0383E9EF01DA2E } },
+		{ { 0x058ADCB0981CC2BC, 0x6EF29BD88E2F92FB,
+		    0x0946A5A0A3084C9C, 0x4D0AF9F74DADFAA2 } }
+	},
+	/* 61 * 2^0 * G */
+	{
+		{ { 0xFC0527274EA1C3D3, 0x0DBBE92E998B9786,
+		    0xBDA82761ED163899, 0x28F2ECD46EFF2AEE } },
+		{ { 0x88556C67727CEAF5, 0x6883C8B21E14DF32,
+		    0x8859B93123994C53, 0x1B593C1C42F2F226 } }
+	},
+	/* 63 * 2^0 * G */
+	{
+		{ { 0x06B030966C090DFA, 0xF20F12DED36E477F,
+		    0x1AE5FDFABC99259E, 0x5982957046B5B2E6 } },
+		{ { 0xD751896613336954, 0x1B6EE253551924BB,
+		    0xDAB7C90B77DDA393, 0x598B55E8897E5C6A } }
+	},
+	/* 65 * 2^0 * G */
+	{
+		{ { 0x522C9B062CD8701D, 0x0203D8A9E45D02C0,
+		    0x3F48B2AF0813218C, 0x13011C430C17C978 } },
+		{ { 0x28026FC00E708FDE, 0xD9D80A20C193AEE2,
+		    0x806B94C732E93F87, 0x40E528A36F8B2946 } }
+	},
+	/* 67 * 2^0 * G */
+	{
+		{ { 0x77E8A552057CFC48, 0x8685D50C18F4E3C0,
+		    0xAC5955B587D9E29A, 0x1E2FB6ADA53FF255 } },
+		{ { 0xD762FDE50CB74461, 0x4ACCBAD96F60ACE4,
+		    0x501B88672C2E9E30, 0x6A34C92E5D47795F } }
+	},
+	/* 69 * 2^0 * G */
+	{
+		{ { 0x8C26CECFC67DFD14, 0x72F639258AA67B8C,
+		    0xE37DB32D493D272A, 0x075A40CD8D9CB523 } },
+		{ { 0xEC870DA896D99AA1, 0xACB72B945D983838,
+		    0x9F51345AF010F0C2, 0x5A46F537B70D10C5 } }
+	},
+	/* 71 * 2^0 * G */
+	{
+		{ { 0x5C34ECC0981C1632, 0xA090704CF0987B99,
+		    0xA6A4E9726DC59E2D, 0x1C4AEB35D4973048 } },
+		{ { 0x326F5023968EFFF8, 0x94674CAF429B200F,
+		    0xF55F4B537F5FCB28, 0x2F710282FE40F648 } }
+	},
+	/* 73 * 2^0 * G */
+	{
+		{ { 0x804F402BE9F2B044, 0xCF05864C7B25D0AE,
+		    0x239B0F8CBDE47D9B, 0x798AA67FD8DA0351 } },
+		{ { 0x621DB9AF298F12AA, 0xC33E57F3746A75E9,
+		    0x4112ADF67E890099, 0x7FDD0E66DCB320B6 } }
+	},
+	/* 75 * 2^0 * G */
+	{
+		{ { 0x93523D885D70518C, 0x9F8A3564BE0344F0,
+		    0xDC5F66A4826F8B4F, 0x60AC3179061D7A03 } },
+		{ { 0x8885AC3D1F7F4402, 0x56A211D7195CC53F,
+		    0x985AB3B21B7D49E6, 0x2D430A4A509ECE27 } }
+	},
+	/* 77 * 2^0 * G */
+	{
+		{ { 0xB8E67F7CAE696564, 0xD9DF246643B1F648,
+		    0x72FB1955B75A0E83, 0x6E91C91E4C045773 } },
+		{ { 0xE872D32BE9B044E2, 0xA9CD433E339EEF52,
+		    0x7C2F029448FF0A3F, 0x2BAE671F58B97E23 } }
+	},
+	/* 79 * 2^0 * G */
+	{
+		{ { 0x6AD4426603BB1142, 0x643C0354A3D0E7F7,
+		    0x3F07D1017893E6BB, 0x008A81007C874F3A } },
+		{ { 0x1BBDBDCCBF913D50, 0x1DE4D1E7367E0F18,
+		    0xD6A43E035FFEB65F, 0x0D2371630AE83EC7 } }
+	},
+	/* 81 * 2^0 * G */
+	{
+		{ { 0x8A44BE04980A9336, 0xF01CF1F3439CA43B,
+		    0xF1BC9A78E43CA250, 0x22D3A3602E855864 } },
+		{ { 0x2BBFD48F74B424CC, 0x8C97432C5D27F5B2,
+		    0xFAD361B6EBF88097, 0x6AC96C2FD93C9282 } }
+	},
+	/* 83 * 2^0 * G */
+	{
+		{ { 0x2B80A2D4854CE894, 0x56FC2706F24F5141,
+		    0x8F5BE59D3EDCD743, 0x3B7656696095181B } },
+		{ { 0x31ADE2E2CA7381AE, 0xA9754F9CD17E7B52,
+		    0x3236766763EB58CD, 0x4190FD30E962388B } }
+	},
+	/* 85 * 2^0 * G */
+	{
+		{ { 0xA89778A23CFC6098, 0x924BCE45C4752A86,
+		    0x8E4217874F2FE196, 0x2D2A2AAA87F920AA } },
+		{ { 0xFD28DB906C9782DC, 0xF2C1A89298074D2B,
+		    0xF41823DCB187B72E, 0x3D09671106107123 } }
+	},
+	/* 87 * 2^0 * G */
+	{
+		{ { 0x9ED45AB4520D62C8, 0x78507299D7D30DA4,
+		    0x371581064A805963, 0x5FF61C15F5D78CF6 } },
+		{ { 0x7A567F9B732E7983, 0xC58C0B7B182F5F8C,
+		    0xC87A2AEFF090F3B5, 0x29A15B2565183A72 } }
+	},
+	/* 89 * 2^0 * G */
+	{
+		{ { 0xE8E0CDDC90CEAB05, 0x69418CD7E55F6B2B,
+		    0xF834F211F35A114F, 0x3BCF18D287D98092 } },
+		{ { 0x20E9659CEA73A4D1, 0x0318A521338560BF,
+		    0x5DF6D1D973F24CE9, 0x28E5BC5A459A121D } }
+	},
+	/* 91 * 2^0 * G */
+	{
+		{ { 0x6902FD37AE95FD86, 0x4609ABE231313564,
+		    0xFF2DF12EFFDA78BD, 0x7D47ABA86E13BBDD } },
+		{ { 0x78964A6C93B79655, 0xE96FF3103710B473,
+		    0x4A496B59FA1BBEDD, 0x4DDCF11DD6FE5C4F } }
+	},
+	/* 93 * 2^0 * G */
+	{
+		{ { 0xA6DDD1576D8DC37E, 0xE6868E1B755618FF,
+		    0xFE0E1C041FC9AA97, 0x2F2C56149B1A2716 } },
+		{ { 0x8F2EDE544BDE288D, 0x1B565A1356E6D66B,
+		    0x13FA56C257A70BB5, 0x5A224D33D6213C21 } }
+	},
+	/* 95 * 2^0 * G */
+	{
+		{ { 0xD84524B15019C618, 0xB1D3A5514EAFB82E,
+		    0x70749841CD755056, 0x66276A5180F049F3 } },
+		{ { 0x0A776A34413C0BF0, 0xA8A34323837064E3,
+		    0x86FE986A148E9BB4, 0x3839DD3688BD6BF8 } }
+	},
+	/* 97 * 2^0 * G */
+	{
+		{ { 0x21343920FBB92628, 0x30128683C0D320E6,
+		    0x85CDD3FD080A5C7B, 0x52097D7D42F067F9 } },
+		{ { 0xEE2B2A34B438D1AB, 0xED1C36A197D67D7A,
+		    0x33DD782747DB5328, 0x37199FAD0986519D } }
+	},
+	/* 99 * 2^0 * G */
+	{
+		{ { 0xED3AF91BA13C62F4, 0xE2ACD9AA6001DEA1,
+		    0x959427CE82984AD4, 0x2376245A3D519F17 } },
+		{ { 0xFAF3DD366BCE87EF, 0x3BE04FDB80AE08F2,
+		    0x98BE5EFBDC1AB930, 0x6BC59A8155D04A9F } }
+	},
+	/* 101 * 2^0 * G */
+	{
+		{ { 0x2E7F3940F7A0E664, 0x9C1DF1269751D9F6,
+		    0x98195F9F9F11E1CB, 0x042E5E1D86CDED0A } },
+		{ { 0x86160CCE802BDE7B, 0xD2497AC2660A7523,
+		    0x71C8C67159770F3B, 0x7DAA5F1A79DDB24C } }
+	},
+	/* 103 * 2^0 * G */
+	{
+		{ { 0x79E2D283BBE7906A, 0xE0CC0F6466598C8A,
+		    0xFFC31E7177C90E3F, 0x11BBBFF589A6F64E } },
+		{ { 0xEE6D9E03E7944AE5, 0x83AFE9D63E0C47F4,
+		    0x8F6546476FC9010D, 0x17D59631A8E11B9C } }
+	},
+	/* 105 * 2^0 * G */
+	{
+		{ { 0xD77F860CFCEB9084, 0x13D7CD0797504EF4,
+		    0x5170406957C1B1F5, 0x66AA8E5D8F550397 } },
+		{ { 0xDA482EF3B2B3627A, 0x98ED732398BEB15B,
+		    0xE8571FE6E865EF9D, 0x672175DD76A22CDA } }
+	},
+	/* 107 * 2^0 * G */
+	{
+		{ { 0xAC1B43AE8F849B7C, 0x7981A2736E1F5BBF,
+		    0x1C4E69BF778A9CB2, 0x02ABB47186B2552D } },
+		{ { 0x8E85C809ACADF531, 0x488BACCEC5339EC7,
+		    0x49BCB8F673BE1FEB, 0x7DACF95D851A5608 } }
+	},
+	/* 109 * 2^0 * G */
+	{
+		{ { 0x6AF557613051BF6C, 0x09BAB4F03D2E9B31,
+		    0x7486955550BAA28A, 0x0C9A1F074543F47E } },
+		{ { 0xC0C182957B1212CB, 0x99FAB8879BCA097A,
+		    0xA7E8D9818757BE48, 0x23EE206784476E43 } }
+	},
+	/* 111 * 2^0 * G */
+	{
+		{ { 0xC96929F74EE79F8C, 0xC167B99743162C99,
+		    0x958C2934FB1CE81F, 0x0A79F9869EF9B4F0 } },
+		{ { 0x8749A9C029DE2983, 0x893F8A34F6151035,
+		    0xE3B48C79799F8436, 0x496A92D152DCDF85 } }
+	},
+	/* 113 * 2^0 * G */
+	{
+		{ { 0xC1A96D42356CF6DE, 0x1680EF0D576CB939,
+		    0xB4C4581317B3652C, 0x557B5D621AAFD02A } },
+		{ { 0x2622E1482F31040E, 0x4BE859B2AEEBE159,
+		    0xD582CED16462F4B4, 0x5BD655AC25609A09 } }
+	},
+	/* 115 * 2^0 * G */
+	{
+		{ { 0x24E7433223CA8E71, 0xB561C1FB1F1A3D10,
+		    0xCF3448B94B3B2028, 0x61859700D6DE2A80 } },
+		{ { 0x8A598C1B675A6F57, 0xBCE09A4F99DDC735,
+		    0xF12EE33D8442C06F, 0x0BF2A63A71000B27 } }
+	},
+	/* 117 * 2^0 * G */
+	{
+		{ { 0xFDBE76EF2DA0D575, 0x666DBA141E9FDE2D,
+		    0xAD1E144622CAE4DE, 0x57D539DCE4FFA740 } },
+		{ { 0x832BB73C074BB76F, 0xD05E6C1E5AE34C50,
+		    0x96F23D4AEE6CB958, 0x4438BDAA0DD7DAC1 } }
+	},
+	/* 119 * 2^0 * G */
+	{
+		{ { 0x4FBF28DAB0F8228F, 0xE9F4228C82B8E46E,
+		    0xCE51C5EF1749B478, 0x61A6CA1860A27621 } },
+		{ { 0x7C5CA410C1C063CA, 0x8274C73D0A01F182,
+		    0x75C1537C75365847, 0x470EF6B3701E2284 } }
+	},
+	/* 121 * 2^0 * G */
+	{
+		{ { 0x10717EA49ECD0B30, 0x48193DD8D8E80F38,
+		    0x5E2B11221E9E1ED1, 0x52AD7F213354750F } },
+		{ { 0x294830F608470252, 0xD4D0E324BA11F8FC,
+		    0x05EDF16960652511, 0x0EACC124371C4F93 } }
+	},
+	/* 123 * 2^0 * G */
+	{
+		{ { 0xFE007ECB24EF182A, 0x895973AE8EF61250,
+		    0xFCB9F9A214BD8003, 0x1AC89376FE7A956F } },
+		{ { 0x5E06D05C75E3071E, 0x450B5ACE65CEB9A0,
+		    0x641BC034703887F1, 0x0235C1EDDE9B9579 } }
+	},
+	/* 125 * 2^0 * G */
+	{
+		{ { 0x7C8597639AB06CAA, 0x69250441C6C6FDB9,
+		    0x004BA954B0A92164, 0x5DA3C5AC57A790B6 } },
+		{ { 0x2997B676654F960D, 0x0949D2B1610DE343,
+		    0xC2CD896C84A91D9D, 0x4B78FB28FA258BC9 } }
+	},
+	/* 127 * 2^0 * G */
+	{
+		{ { 0x29B6B45B059AB55E, 0x41BEBE11B2B4825D,
+		    0x7D7B2A480655626B, 0x4FA1E6B661C79CF1 } },
+		{ { 0xACCE06A847950C0C, 0x8B84D10DC8214E64,
+		    0xE355144020F56B5D, 0x101A669C6790AA12 } }
+	}
+};
+
+static const do255s_point_affine window_naf_G128[] = {
+	/* 1 * 2^128 * G */
+	{
+		{ { 0x4D5B37E47635D9CF, 0xAE7E7A89B313CF11,
+		    0xA277DD52A5963E8B, 0x6B925003EAAC2050 } },
+		{ { 0x5DE53387CC1D108C, 0x1B92AB3FC4102FDF,
+		    0x3B38F632FFC65BC6, 0x01AAC5EEBDEA8465 } }
+	},
+	/* 3 * 2^128 * G */
+	{
+		{ { 0xFB21E7ED777B8F2F, 0x1EE3751840239F37,
+		    0xBE214D43EC00783A, 0x6D6E7DADE49E0AF7 } },
+		{ { 0x8373BB18DF608FBC, 0xCD100440C95742CE,
+		    0xC3F95DCD1E917572, 0x25C181299CDCECBD } }
+	},
+	/* 5 * 2^128 * G */
+	{
+		{ { 0x8CAB4C3A2AF21E15, 0xC5AE64DF9E9632CD,
+		    0x6A931D2B0FE2775D, 0x0F36BEC89C0049FA } },
+		{ { 0x993D9FD0EB3CF496, 0xC53D312DC0BB21FB,
+		    0xAE76833F15D40A91, 0x780E0C232725408B } }
+	},
+	/* 7 * 2^128 * G */
+	{
+		{ { 0xF18009269B2990E5, 0x61572BF5279C58A8,
+		    0x1E0218985E0A0DD4, 0x7286BEC0252D00F2 } },
+		{ { 0xBCEA20E41C2DC846, 0xA59EA984BEFC73C5,
+		    0x283FF87E2EEC48A2, 0x4EC4844FF9D49A0F } }
+	},
+	/* 9 * 2^128 * G */
+	{
+		{ { 0x982D3E3806919B21, 0x67377C5D30280357,
+		    0x275FEB0034E3D766, 0x50DE2E8E79294E1D } },
+		{ { 0x890135722AA76E00, 0x1BA5B63B9269A61B,
+		    0x7A9537CCFB8B2BDB, 0x5ADE24B265A12EA8 } }
+	},
+	/* 11 * 2^128 * G */
+	{
+		{ { 0xAD7FBE69BD662C6E, 0x4E37A5200F8AE01A,
+		    0x2569FF8350DEB165, 0x6CD49CB383A8B03B } },
+		{ { 0xECD177FD068E0B7B, 0x506ABFD9635AEAC2,
+		    0x1DEE852E7D17368A, 0x4FF0E48E97F1AF8E } }
+	},
+	/* 13 * 2^128 * G */
+	{
+		{ { 0xCF19BABC756DA3BF, 0x90873C7AC798DBFB,
+		    0x3870B74997840AE5, 0x15461E24956CF079 } },
+		{ { 0x437050980E624384, 0x046FE876FE2EB5BF,
+		    0xF34631D8A0E9F243, 0x6CD7AF4FABBE4B87 } }
+	},
+	/* 15 * 2^128 * G */
+	{
+		{ { 0x5CA5B722CBAB0243, 0x5A08FD2879864DFF,
+		    0xDC97D186E8D09102, 0x594A1E0688FDE311 } },
+		{ { 0x8C92986E16B6F3F9, 0xA09C1AB78BAD7A68,
+		    0xF22FB7D313032FE8, 0x3C658CD8E3FD70DC } }
+	},
+	/* 17 * 2^128 * G */
+	{
+		{ { 0xCD8EA787114BD542, 0xA7A4EF7CA7207782,
+		    0x06123B4F8A171942, 0x434CB41575E4C1D8 } },
+		{ { 0x674E6C56FBCA9B81, 0xD0B913781552DD5B,
+		    0x181AFEDA0CC00AC7, 0x1FBDD9E512DBFAFD } }
+	},
+	/* 19 * 2^128 * G */
+	{
+		{ { 0x731F669412655794, 0xCF0F56E3744E8169,
+		    0x7B5D117C14D0B3ED, 0x1FBEF7D277DAF4A2 } },
+		{ { 0x17539F0DF9DDA2A3, 0x3F34BF76FED2F53B,
+		    0x02F24C8401B525D1, 0x7D79DC88FA9F35FB } }
+	},
+	/* 21 * 2^128 * G */
+	{
+		{ { 0x5E58F21E2F63E2BF, 0x668D593FFDA29973,
+		    0x598BF62A165B4482, 0x2C64C6DCC20A3A5A } },
+		{ { 0x10935F3A60A285BB, 0x88C892F3C4239409,
+		    0x69FE2E0F8D9F557B, 0x3ACD7AE76990AE3C } }
+	},
+	/* 23 * 2^128 * G */
+	{
+		{ { 0x6B0A4AAD7764374E, 0x804F259E11E9FE5A,
+		    0x6D6183790A09F3C0, 0x5F4AED71132EABEF } },
+		{ { 0xC0E3A85550A4B901, 0x84439731A5918C4B,
+		    0xC62A229D9F4CB08E, 0x2D1A6D5F429BD16D } }
+	},
+	/* 25 * 2^128 * G */
+	{
+		{ { 0x429B5C4D38E4F2B8, 0x61E196CAEBC3DB30,
+		    0x80B994265FFAE2AF, 0x3508F7F24BEE878C } },
+		{ { 0x533007B38FAA58EF, 0xD8193D6DB00F0C6D,
+		    0xA009488CD31EA69F, 0x0D39E6CBAC8E617A } }
+	},
+	/* 27 * 2^128 * G */
+	{
+		{ { 0x6478B57FA442B7C9, 0xE79E5FA886032A3E,
+		    0xFBA4485B91D17A19, 0x4A8FFF5158374F39 } },
+		{ { 0x22D48F0C88BD4161, 0x274B3042BD668873,
+		    0x58F54A7E6794D1B5, 0x74BB627F10A130EA } }
+	},
+	/* 29 * 2^128 * G */
+	{
+		{ { 0xF4978EE3EDF0FFCA, 0x7B04A0E21EC225F8,
+		    0xFD28EFC84A45F444, 0x01AB1C02B403F847 } },
+		{ { 0x451A9F2512D28924, 0x7BEAD2CC374CA0F1,
+		    0x62A00D11FC6CE241, 0x64FE21333161F47A } }
+	},
+	/* 31 * 2^128 * G */
+	{
+		{ { 0x99684C885BEE7887, 0x46C6C4228682052C,
+		    0xBCC5BC216E5057AE, 0x7B0D953EBEFD774E } },
+		{ { 0xF84D8B07F0D3D9EF, 0x962C371D11C3B324,
+		    0xC16AA5FF6BC70CE1, 0x3E35888C234F6B46 } }
+	},
+	/* 33 * 2^128 * G */
+	{
+		{ { 0x554CA0900395EC42, 0xA1B4F5F20F51C561,
+		    0xCC94CB30CBF7A4E7, 0x21FE33B7DDEDF600 } },
+		{ { 0x4ABFFAE38FCCA1E6, 0x8960FA8D763DE98B,
+		    0xF74BE09A1502F0CB, 0x6380B6C428DC40FA } }
+	},
+	/* 35 * 2^128 * G */
+	{
+		{ { 0xFB375983A1139766, 0xD0BF12536927B70A,
+		    0xA8E7646D32B4EDE8, 0x0096383A5990832F } },
+		{ { 0x9BE4370C2E109E0D, 0x0FA79EBD84285554,
+		    0x66999BF91263BD4D, 0x28F6BBD42B61D207 } }
+	},
+	/* 37 * 2^128 * G */
+	{
+		{ { 0xAA9137271A9421C8, 0xDD93358E53684D69,
+		    0x945D76C6677F166E, 0x4E5357CD463CFE7E } },
+		{ { 0xD62DB466D10206D5, 0x92F067A271693FB9,
+		    0xFE1D50B5BAEA7269, 0x260DD0BBF1B839C6 } }
+	},
+	/* 39 * 2^128 * G */
+	{
+		{ { 0xE47C361306C9B6D9, 0x5D9E277ED41ECCD9,
+		    0xE8B0742376488B1A, 0x5F07CD56A5F7B7CD } },
+		{ { 0xEEBB52554B0B613A, 0x2CB41D49418839E5,
+		    0xDBED2AEC6C4B3D3F, 0x56705AA9C4E5C066 } }
+	},
+	/* 41 * 2^128 * G */
+	{
+		{ { 0x20D564FD18AE198C, 0x3C5799B9311B13D3,
+		    0x03E7D9A2CA9C8652, 0x2B294EDA7437B623 } },
+		{ { 0xBABC401A84E9EEFD, 0x6F608A4FFEA53CAD,
+		    0x7873E3A86336E4CD, 0x027FF6EA16FBB774 } }
+	},
+	/* 43 * 2^128 * G */
+	{
+		{ { 0x9E0D3CD6C7CE7D8A, 0x815B60AA0E0EAE16,
+		    0x09D1353C0C96014F, 0x43C55FD68D4B9E19 } },
+		{ { 0x75AC60FA218070BD, 0x096BAA8B8DDD0257,
+		    0xDF96BDB5AD07A36B, 0x534CC8ECB70F453E } }
+	},
+	/* 45 * 2^128 * G */
+	{
+		{ { 0x4FDF354338003156, 0x981F76FFAE47A27D,
+		    0x3F8AD6395CF68D6B, 0x6D9243BD38DD9C41 } },
+		{ { 0x9301BC3304D723E4, 0x939E4A531FD6101B,
+		    0xBFFADA2E93AA1B8B, 0x5DA010EDFC14D37C } }
+	},
+	/* 47 * 2^128 * G */
+	{
+		{ { 0x1D1212D83C8EB23A, 0xE2C0903F1D63885D,
+		    0x45A7988C2674B3C3, 0x4FB164F8CD6B86AF } },
+		{ { 0xCCF23571DC323528, 0x96FD4786936492CA,
+		    0x24F608E7529000C5, 0x62862F11F4D1ADC1 } }
+	},
+	/* 49 * 2^128 * G */
+	{
+		{ { 0x1434F4A097867B61, 0xF1B43498404A52C5,
+		    0x6BBF366B2C777670, 0x09D872685FE6B88D } },
+		{ { 0x64028A2D47D0244F, 0x627991FA95291996,
+		    0xE1D912350EB61536, 0x27A2C449F89B1A9D } }
+	},
+	/* 51 * 2^128 * G */
+	{
+		{ { 0x2DA52256CC7D71C1, 0x2C181D84D91F456E,
+		    0xA785E134E5F7E205, 0x559581E9E7850ACA } },
+		{ { 0x7B15C53125B6DBEA, 0x3C1122596DEDA87A,
+		    0x6152148C15A23CC8, 0x207557A488F4A397 } }
+	},
+	/* 53 * 2^128 * G */
+	{
+		{ { 0x34099EFC6B631BB8, 0xD928299FAC88DB71,
+		    0xA588BE1B3FA80C5D, 0x384C5636F7FC0E7C } },
+		{ { 0x5E0811B1A6FC2701, 0xBCBEFBC547EFC676,
+		    0xE41EFCAD5A64733F, 0x160BD1063A95FA3B } }
+	},
+	/* 55 * 2^128 * G */
+	{
+		{ { 0x96042D58D5995418, 0x8F49A47D070FF0A4,
+		    0x4D212039368C97A2, 0x5EFAB2257E7D83BB } },
+		{ { 0x4C64D1643D84EB0F, 0x63CE109F09C2D18B,
+		    0xA2E3405214C84F0A, 0x5EB12BF8FA4B223C } }
+	},
+	/* 57 * 2^128 * G */
+	{
+		{ { 0x61BBC8B6FA1FC98D, 0xB0004DDDDA841185,
+		    0x9B4B402601A8DECD, 0x4A14B0282462EB9D } },
+		{ { 0xD00E5DE6D408E0BA, 0xBB0283304106C105,
+		    0xAD64CAC33D9AB067, 0x6DA508651E7E58FB } }
+	},
+	/* 59 * 2^128 * G */
+	{
+		{ { 0x4275759F679230CD, 0x9617F5EC98EF6F62,
+		    0x02B8F5904FB17302, 0x12901150662426CF } },
+		{ { 0x64578C6D94E9F8A0, 0x91CB9CC023730C78,
+		    0x160C37ACD065EA3B, 0x5656EA51B094DE1B } }
+	},
+	/* 61 * 2^128 * G */
+	{
+		{ { 0xDFAD42B46E839D40, 0xC208A0EFDD5B3262,
+		    0xAF71E48CB48BA3E1, 0x3C806BD6995CBD12 } },
+		{ { 0xD94274133053510D, 0xCCDABBFE950EDCBD,
+		    0x19DC77FAFA3A1D2A, 0x48AA8FAE5B89596C } }
+	},
+	/* 63 * 2^128 * G */
+	{
+		{ { 0x96629521BFCC139B, 0x55FEA8A148333382,
+		    0xB659E35DEA601511, 0x332EF5D67D825560 } },
+		{ { 0x23581BBA4894C4B1, 0xE09CD4031586545B,
+		    0xE21ACB2F2F215646, 0x750458DC28D03C64 } }
+	},
+	/* 65 * 2^128 * G */
+	{
+		{ { 0x5732B8BEEB2B732D, 0x0ADA8410022E0860,
+		    0x6CA07C614326FF3F, 0x61B696B90263F7DC } },
+		{ { 0x0B4C1EE6C7F59EEF, 0x990E55F13BE11979,
+		    0xCB915B12B034AEAA, 0x40F6A9E61456482B } }
+	},
+	/* 67 * 2^128 * G */
+	{
+		{ { 0x253D44B809234B3E, 0x715749E34DE80BAA,
+		    0x8736715914D06BEA, 0x1A5FA54D89E7D30F } },
+		{ { 0x0974BFC809EC2E51, 0xAEC8147FEA8EF450,
+		    0x5BFF94D90B394CCC, 0x696159D2EF9AD5BA } }
+	},
+	/* 69 * 2^128 * G */
+	{
+		{ { 0xE3E0C495508F1466, 0x81EDA6B72CF54DB2,
+		    0x2A8C0E01DB470CE4, 0x3A3166E9746660DB } },
+		{ { 0xF76A044B47572D0E, 0x79FBFBB768B300B5,
+		    0x9DC73EC37D5E404E, 0x666D6F321D5E65CB } }
+	},
+	/* 71 * 2^128 * G */
+	{
+		{ { 0x731739C58E1C7B16, 0x4A30D9386D1915D7,
+		    0x79C2ACC8D3F03B61, 0x69DE279D53063486 } },
+		{ { 0x62BD2A2834D105A1, 0xF01682CA44FFC0EE,
+		    0x539506E892647A35, 0x1B7A65117ACB164D } }
+	},
+	/* 73 * 2^128 * G */
+	{
+		{ { 0x6C8ADAA53EE82746, 0x928F5DBF833A94F1,
+		    0x22D9721BC2CE2C1D, 0x597A1E6BC8890110 } },
+		{ { 0x25A1973299070D5C, 0x878D49302BAF6764,
+		    0xFF8C988D3CD8722D, 0x430BA38DE86A5AB4 } }
+	},
+	/* 75 * 2^128 * G */
+	{
+		{ { 0x71828DE38425D9FC, 0xAE0C67D39D9EFCF0,
+		    0x34639D26139B925E, 0x0CC9D30EBEEE2BB9 } },
+		{ { 0xBE1208454DB5B942, 0x36D95DCA7902883C,
+		    0x6BAFC41D92B93C74, 0x299403908E198961 } }
+	},
+	/* 77 * 2^128 * G */
+	{
+		{ { 0x06FBD4A141DD805C, 0xEE155321FDBD6CC1,
+		    0xE6FDF2ADC3509A5D, 0x7BF9C457D5F27EA4 } },
+		{ { 0x06D239FAABB7D67A, 0x5C4AC4DF485D5B77,
+		    0xB7141E37734EA7EA, 0x4F7BB1282FE356D8 } }
+	},
+	/* 79 * 2^128 * G */
+	{
+		{ { 0xD9D230892290C69E, 0xACA95C272D1AB06F,
+		    0xBBE30FEDA092201B, 0x1E83070BBD87BF66 } },
+		{ { 0xE2237F620D305226, 0x256D5BD9A9BB678B,
+		    0x5966C7318C0BA34A, 0x6380B0A5F7EE178C } }
+	},
+	/* 81 * 2^128 * G */
+	{
+		{ { 0x5A5938862C217BA2, 0x95D92F6B73B47CF7,
+		    0x6915B2C192A0EF9A, 0x399CAB994788EFB6 } },
+		{ { 0xFF2BA6745A769D8C, 0x21E4746CB7BB4BD3,
+		    0xC75D8A5877C79737, 0x60298731BD62D568 } }
+	},
+	/* 83 * 2^128 * G */
+	{
+		{ { 0xAB7D5B5775B68FD0, 0x49D3094847AE4CD5,
+		    0x335ACC096B653F0F, 0x6F35BC4EF66D2AF7 } },
+		{ { 0x3E2F49C9D37D83AB, 0xDB25C919F5835DC5,
+		    0xFB4BA6E1951ED8FF, 0x414B91F1758147F4 } }
+	},
+	/* 85 * 2^128 * G */
+	{
+		{ { 0xEC22460A7A4467D7, 0x241211CCE5EE650F,
+		    0x8FF08F61DDEC8D73, 0x3F57A574DCBE4685 } },
+		{ { 0xDCE9F1B31BD1CCCD, 0x5BC8B11A745CA8F8,
+		    0xD1DA15FC70CD7322, 0x62DB1B441F937632 } }
+	},
+	/* 87 * 2^128 * G */
+	{
+		{ { 0x06838EAC236BF63B, 0x93A02CCCCE3BF012,
+		    0xE46B9D9DEBB21407, 0x5B2613E54340826F } },
+		{ { 0xDFE95CF5FCF42BF8, 0x389CD7C703467538,
+		    0x84E2FC882CBD8C64, 0x69E02886D0DCDA7D } }
+	},
+	/* 89 * 2^128 * G */
+	{
+		{ { 0x1C665235257746F1, 0x4A2E8B2A80952C0F,
+		    0xF184F788B862CB7A, 0x1DDEEDC77632F3FB } },
+		{ { 0x81929A1FBD6A0F13, 0x2CE4D9A084CB55E3,
+		    0x41F63C6087A95172, 0x1CADF31B1B3A2DEA } }
+	},
+	/* 91 * 2^128 * G */
+	{
+		{ { 0xEFE5DF094247F761, 0xFB9FEC02B51ACEC4,
+		    0x10AF9DF8B51407C9, 0x6EB533BBFE663494 } },
+		{ { 0xBABAEBC8F1542940, 0x24B2367E45A2873F,
+		    0xFF3BC230745DD724, 0x2C086CCDEC8A3099 } }
+	},
+	/* 93 * 2^128 * G */
+	{
+		{ { 0x9B3769F8AE6CBE68, 0xAEA7C2001D70CC93,
+		    0xD04DB45FBE1D8A99, 0x53CABBFEC7541B28 } },
+		{ { 0x00ADCCE0FEDAEF7C, 0x686AF4F4B0E0F73C,
+		    0x52BA617793AE6E14, 0x6F6F87DFB3EAF88C } }
+	},
+	/* 95 * 2^128 * G */
+	{
+		{ { 0x557E722BD9CA1B34, 0xA35CD2A23112BE01,
+		    0xF3D6D1283E4D5391, 0x093B6CE540F258E2 } },
+		{ { 0xCC81244E7B583373, 0x67926F1B42925121,
+		    0x12DC2F8161C5EEDF, 0x3BCA14FB76B4638B } }
+	},
+	/* 97 * 2^128 * G */
+	{
+		{ { 0x45B32B14A2A83CB1, 0xCD3DCDCCF145B00A,
+		    0x505DC9A7CDF67631, 0x7F5A4F5C01C5D327 } },
+		{ { 0xCECA89DBF81F2EE5, 0xA1E20A13613D34CD,
+		    0x2D3E6EEA9E67FBB7, 0x5DFCB419654FF699 } }
+	},
+	/* 99 * 2^128 * G */
+	{
+		{ { 0x90C4900D01E33665, 0xA240E3007ECF9DB0,
+		    0x4F825871B4BA02DD, 0x489807BA1C6E6D43 } },
+		{ { 0x2F5462D91D246056, 0x16B92D638441BEF8,
+		    0xCBB055AF0CC642DF, 0x46A5BDE1D1FE76A1 } }
+	},
+	/* 101 * 2^128 * G */
+	{
+		{ { 0x801A1F9E1AF7B82F, 0x7B33B9EC82ACA492,
+		    0x7571632EBF55BBB1, 0x6F64D7160B75F327 } },
+		{ { 0xF190D79AE6902EF3, 0x651356EA708C4C73,
+		    0x4A92795251080234, 0x4E0425DAD8836AFE } }
+	},
+	/* 103 * 2^128 * G */
+	{
+		{ { 0x9068B326A7644516, 0xA5A87BA1E0C98FFA,
+		    0x36265BAF95563330, 0x2ACA6399F5CE5086 } },
+		{ { 0x70EE38A7365C4602, 0x2491E893C5D47D8C,
+		    0xD167D28B7BF05495, 0x355570EA996E110D } }
+	},
+	/* 105 * 2^128 * G */
+	{
+		{ { 0x9A3679E3185A3753, 0xEA5F2F21D2AEC1CF,
+		    0x213A1CA619F53A23, 0x39294AAFC5C92264 } },
+		{ { 0x480E6EBC49A76E63, 0xBA7686C3CA26F6D1,
+		    0x405DE8A26D12B394, 0x17A6F42C686B6628 } }
+	},
+	/* 107 * 2^128 * G */
+	{
+		{ { 0x9A7EFF1D79816C33, 0xAD63C495E70FBC55,
+		    0x51CC8B66376CEA86, 0x3F1BC2F1CBE65AA8 } },
+		{ { 0xC0D63B8406324CD9, 0xA4968A79C2F8AC14,
+		    0xB0E87D64848CE79C, 0x469BCA158BB3820E } }
+	},
+	/* 109 * 2^128 * G */
+	{
+		{ { 0x1E2B161DBDEA9D38, 0x586F069639ED1932,
+		    0xC2790FF04DFF76FF, 0x5473C3BB99F35462 } },
+		{ { 0x3CC7190A2637A19D, 0x8C02E5544E562936,
+		    0xF76AA0C89C4402F0, 0x6AEC95C42A977F3A } }
+	},
+	/* 111 * 2^128 * G */
+	{
+		{ { 0x0909D65713A34905, 0x69A837F7B8ACB974,
+		    0xEE2E56E73E698481, 0x6F9808288ED865AF } },
+		{ { 0xD570052B5B459986, 0x79C16CBFFFEA1732,
+		    0xE933735E7EE5EC8C, 0x1037B6BC9CC07DDD } }
+	},
+	/* 113 * 2^128 * G */
+	{
+		{ { 0x9306993B54883EC8, 0x6EA975442FB17354,
+		    0x84F6741DF6943EA2, 0x66D21F08889627B7 } },
+		{ { 0xE7E88039A8E77054, 0xA1B7F19903E905F0,
+		    0x14572D34D98776A8, 0x1E68EB72316DF56A } }
+	},
+	/* 115 * 2^128 * G */
+	{
+		{ { 0xD21022D58F5B8014, 0x93656B1C6D4CF3F3,
+		    0x739B34C2D6541900, 0x307413BD068C367A } },
+		{ { 0x5BFEAA3ACB7F8209, 0x876808662FDEDA3A,
+		    0x2349FE817163BF7E, 0x7B72BA22CBB5AACF } }
+	},
+	/* 117 * 2^128 * G */
+	{
+		{ { 0xC656F56219E863DB, 0xBAEF7C9174845CE5,
+		    0xE00DFAD28E40FCF2, 0x1F176339A89709FB } },
+		{ { 0x53C4CE2C326465EE, 0x52F88A14FFDA2C17,
+		    0x960E9F738BA6B9FD, 0x3EBA51C5D09FD772 } }
+	},
+	/* 119 * 2^128 * G */
+	{
+		{ { 0x4E95C92F864AF50B, 0xF687DF0115073183,
+		    0x2652134F063C9301, 0x0CA28766FDBBD864 } },
+		{ { 0xDEE4025059C91819, 0xFDD26CD6C2665CE1,
+		    0x7A67AD71F925AAB5, 0x24E02BCCF389EE85 } }
+	},
+	/* 121 * 2^128 * G */
+	{
+		{ { 0x447129D41BC0E1EE, 0xBF14851EC8D5E1A7,
+		    0x6C105120330FB398, 0x0A99CBB8082CB384 } },
+		{ { 0x13390DD32F53DBA7, 0x6E757298200E2E56,
+		    0x035A0C1A5C7EEE12, 0x48B1F7A0DEE795AF } }
+	},
+	/* 123 * 2^128 * G */
+	{
+		{ { 0xD7AFB29AFE41BB34, 0x1C651E4D8E7C5100,
+		    0xA6303DF6FD62C6AF, 0x541145144E07B2DF } },
+		{ { 0xA4229E7CD4EF3B7D, 0x1D2BE474529FAE21,
+		    0x5D85228CB6F3A3D8, 0x364CACCFDD9566ED } }
+	},
+	/* 125 * 2^128 * G */
+	{
+		{ { 0x09FA4690FD4D0751, 0xC4F9F1069299BF67,
+		    0xC9F8EED0A6026DCF, 0x1D2292BA53501B39 } },
+		{ { 0x0C3133B9BE4DAB7B, 0x305FDF2BD5933D39,
+		    0x9350D62A74AFBD8B, 0x67FC179D5D32A2C1 } }
+	},
+	/* 127 * 2^128 * G */
+	{
+		{ { 0x2F0225BCAC52611A, 0xD52B03F15AF04C01,
+		    0x240FABC7957F5364, 0x0046E0B8B594824A } },
+		{ { 0x0373B2906D717785, 0x44FF37B90E9E084A,
+		    0x9CD725D1EC430004, 0x4895FFCC94215ADB } }
+	}
+};
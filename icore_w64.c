@@ -54,6 +54,23 @@ i128_decode(i128 *d, const void *a)
 	d->v1 = dec64le(buf + 8);
 }
 
+/*
+ * Replace a signed 128-bit integer with its absolute value. Returned
+ * value is 1 if the source was negative, 0 otherwise.
+ */
+UNUSED
+static uint64_t
+i128_abs(i128 *x)
+{
+	uint64_t sg;
+	unsigned char cc;
+
+	sg = x->v1 >> 63;
+	cc = _addcarry_u64(0, x->v0 ^ -sg, sg, (unsigned long long *)&x->v0);
+	(void)_addcarry_u64(cc, x->v1 ^ -sg, 0, (unsigned long long *)&x->v1);
+	return sg;
+}
+
 /*
  * Decode a 32-byte integer.
  */
@@ -68,7 +68,7 @@ bitlength512(const uint64_t *a)
 
 		aw = a[i] ^ m;
 		if (aw != 0) {
-			return 64 * i + 64 - (int)_lzcnt_u64(aw);
+			return 64 * i + 64 - (int)lzcnt64(aw);
 		}
 	}
 	return 0;
@@ -218,7 +218,7 @@ bitlength384(const uint64_t *a)
 
 		aw = a[i] ^ m;
 		if (aw != 0) {
-			return 64 * i + 64 - (int)_lzcnt_u64(aw);
+			return 64 * i + 64 - (int)lzcnt64(aw);
 		}
 	}
 	return 0;
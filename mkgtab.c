@@ -0,0 +1,224 @@
+/*
+ * Generator for precomputed tables of multiples of the generator.
+ *
+ * This program is compiled with the portable 64-bit implementation of
+ * one curve (with -DGTAB_DO255S=0 for do255e, -DGTAB_DO255S=1 for
+ * do255s). It has two modes.
+ *
+ * Large tables for CURVE_mulgen() (used when the library is compiled
+ * with DO255_MULGEN_LARGE=1):
+ *
+ *    mkgtab win chunks limbs
+ *
+ * with win the window width (4 to 8 bits), chunks the number of chunks
+ * (1 to 64), and limbs "w64" or "w32". The C source of the tables is
+ * written on standard output. With win = w and chunks = c, the scalar
+ * is split into D = ceil(257/w) signed digits, in c chunks of
+ * L = ceil(D/c) digits each; the table contains, for each chunk j,
+ * the points i*2^(j*L*w)*G for i = 1 to 2^(w-1), in affine coordinates:
+ * (x,u) for do255e with 64-bit limbs (to match the (x,u) formulas used
+ * by mulgen() in that case), (x,w) otherwise. mulgen() then uses
+ * (L-1)*w doublings and D mixed point additions.
+ *
+ * Tables for the k0*G part of CURVE_verify_helper_vartime() (64-bit
+ * limbs only):
+ *
+ *    mkgtab naf win
+ *
+ * with win the wNAF width (5 to 10 bits). The tables contain the odd
+ * multiples i*G and i*2^128*G for i = 1, 3, 5,... 2^(win-1)-1, in affine
+ * (x,u) coordinates for do255e, (x,w) coordinates for do255s.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if GTAB_DO255S
+#include "do255s_w64.c"
+#define CURVE_NAME   "do255s"
+#else
+#include "do255e_w64.c"
+#define CURVE_NAME   "do255e"
+#endif
+
+/*
+ * Print a field element, normalized, in the format of the tables for
+ * the provided limb size.
+ */
+static void
+print_gf(const gf *a, int w32, const char *indent)
+{
+	gf t;
+	uint64_t v[4];
+
+	gf_normalize(&t, a);
+	v[0] = t.v0;
+	v[1] = t.v1;
+	v[2] = t.v2;
+	v[3] = t.v3;
+	if (w32) {
+		printf("%s{ .w32 = {{ 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX,\n",
+			indent,
+			(unsigned long)(v[0] & 0xFFFFFFFF),
+			(unsigned long)(v[0] >> 32),
+			(unsigned long)(v[1] & 0xFFFFFFFF),
+			(unsigned long)(v[1] >> 32));
+		printf("%s            0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX }} }",
+			indent,
+			(unsigned long)(v[2] & 0xFFFFFFFF),
+			(unsigned long)(v[2] >> 32),
+			(unsigned long)(v[3] & 0xFFFFFFFF),
+			(unsigned long)(v[3] >> 32));
+	} else {
+		printf("%s{ { 0x%016llX, 0x%016llX,\n", indent,
+			(unsigned long long)v[0], (unsigned long long)v[1]);
+		printf("%s    0x%016llX, 0x%016llX } }", indent,
+			(unsigned long long)v[2], (unsigned long long)v[3]);
+	}
+}
+
+/*
+ * Print point P as an affine table entry, in (x,u) coordinates if xu
+ * is non-zero, (x,w) coordinates otherwise. The comment is the entry
+ * label; a comma is added after the entry if 'more' is non-zero.
+ */
+static void
+print_point(const CN(point) *P, int xu, int w32, const char *comment,
+	int more)
+{
+	gf iz, iz2, x, y;
+
+	gf_inv(&iz, &P->Z.w64);
+	gf_sqr(&iz2, &iz);
+	gf_mul(&x, &P->X.w64, &iz2);
+	if (xu) {
+		/* u = 1/w = Z/W */
+		gf_inv(&y, &P->W.w64);
+		gf_mul(&y, &y, &P->Z.w64);
+	} else {
+		gf_mul(&y, &P->W.w64, &iz);
+	}
+	printf("\t/* %s */\n", comment);
+	printf("\t{\n");
+	print_gf(&x, w32, "\t\t");
+	printf(",\n");
+	print_gf(&y, w32, "\t\t");
+	printf("\n");
+	printf("\t}%s\n", more ? "," : "");
+}
+
+/*
+ * Print the wNAF tables for verify_helper_vartime().
+ */
+static int
+make_naf(int win)
+{
+	int xu, i, j;
+	CN(point) B;
+
+	if (win < 5 || win > 10) {
+		fprintf(stderr, "unsupported parameters\n");
+		return EXIT_FAILURE;
+	}
+	xu = !GTAB_DO255S;
+
+	printf("/*\n");
+	printf(" * Odd multiples of G and 2^128*G for %s_verify_helper_vartime()\n",
+		CURVE_NAME);
+	printf(" * (wNAF), 64-bit limbs. Generated with: mkgtab naf %d\n", win);
+	printf(" * Do not edit.\n");
+	printf(" */\n\n");
+	printf("#define VRFY_NAF_WIN   %d\n", win);
+
+	B = CN(generator);
+	for (j = 0; j < 2; j ++) {
+		CN(point) P, B2;
+
+		if (j != 0) {
+			CN(double_x)(&B, &B, 128);
+		}
+		printf("\nstatic const %s_point_affine%s window_naf_G%s[] = {\n",
+			CURVE_NAME, xu ? "_xu" : "", j ? "128" : "");
+		CN(double)(&B2, &B);
+		P = B;
+		for (i = 1; i < (1 << (win - 1)); i += 2) {
+			char tmp[50];
+
+			if (i > 1) {
+				CN(add)(&P, &P, &B2);
+			}
+			sprintf(tmp, "%d * 2^%d * G", i, j * 128);
+			print_point(&P, xu, 0, tmp, i + 2 < (1 << (win - 1)));
+		}
+		printf("};\n");
+	}
+	return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	int win, chunks, w32, xu, num_digits, chunk_len, i, j;
+	CN(point) B;
+
+	if (argc == 3 && strcmp(argv[1], "naf") == 0) {
+		return make_naf(atoi(argv[2]));
+	}
+	if (argc != 4) {
+		fprintf(stderr, "usage: mkgtab win chunks w64|w32\n");
+		fprintf(stderr, "       mkgtab naf win\n");
+		return EXIT_FAILURE;
+	}
+	win = atoi(argv[1]);
+	chunks = atoi(argv[2]);
+	if (strcmp(argv[3], "w64") == 0) {
+		w32 = 0;
+	} else if (strcmp(argv[3], "w32") == 0) {
+		w32 = 1;
+	} else {
+		fprintf(stderr, "unknown limb size: %s\n", argv[3]);
+		return EXIT_FAILURE;
+	}
+	if (win < 4 || win > 8 || chunks < 1 || chunks > 64) {
+		fprintf(stderr, "unsupported parameters\n");
+		return EXIT_FAILURE;
+	}
+	xu = !GTAB_DO255S && !w32;
+	num_digits = (257 + win - 1) / win;
+	chunk_len = (num_digits + chunks - 1) / chunks;
+
+	printf("/*\n");
+	printf(" * Precomputed windows of the generator for %s_mulgen(),\n",
+		CURVE_NAME);
+	printf(" * %d-bit limbs. Generated with: mkgtab %d %d %s\n",
+		w32 ? 32 : 64, win, chunks, argv[3]);
+	printf(" * Do not edit.\n");
+	printf(" */\n\n");
+	printf("#define MULGEN_WIN      %d\n", win);
+	printf("#define MULGEN_CHUNKS   %d\n", chunks);
+	printf("#define MULGEN_XU       %d\n\n", xu);
+	printf("static const %s_point_affine%s window_G_comb[] = {\n",
+		CURVE_NAME, xu ? "_xu" : "");
+
+	B = CN(generator);
+	for (j = 0; j < chunks; j ++) {
+		CN(point) P;
+
+		if (j != 0) {
+			CN(double_x)(&B, &B, (unsigned)(chunk_len * win));
+		}
+		P = B;
+		for (i = 1; i <= (1 << (win - 1)); i ++) {
+			char tmp[50];
+
+			if (i > 1) {
+				CN(add)(&P, &P, &B);
+			}
+			sprintf(tmp, "%d * 2^%d * G", i, j * chunk_len * win);
+			print_point(&P, xu, w32, tmp,
+				j != chunks - 1 || i != (1 << (win - 1)));
+		}
+	}
+	printf("};\n");
+	return 0;
+}
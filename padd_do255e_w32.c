@@ -335,6 +335,8 @@ do255e_add(do255e_point *P3,
 	gf t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, X3, W3, Z3;
 	uint32_t fz1, fz2;
 
+	STATS_INC(point_add);
+
 	/*
 	 * Test whether P1 and/or P2 is neutral.
 	 */
@@ -423,6 +425,8 @@ do255e_add_mixed(do255e_point *P3,
 	gf t1, t5, t6, t7, t8, t9, t10, X3, W3, Z3;
 	uint32_t fz1, fz2;
 
+	STATS_INC(point_add_mixed);
+
 	/*
 	 * Test whether P1 and/or P2 is neutral.
 	 */
@@ -497,6 +501,8 @@ do255e_double(do255e_point *P3, const do255e_point *P1)
 {
 	gf tX, tW, tZ, t4, t5;
 
+	STATS_INC(point_double);
+
 	/*
 	 * X' = W^4         (in tX)
 	 * W' = W^2 - 2*X   (in tW)
@@ -532,6 +538,8 @@ do255e_double_x(do255e_point *P3, const do255e_point *P1, unsigned n)
 {
 	gf tX, tW, tZ, t1, t2;
 
+	STATS_ADD(point_double, n);
+
 	if (n == 0) {
 		*P3 = *P1;
 		return;
@@ -61,6 +61,8 @@ do255e_add(do255e_point *P3,
 	gf t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, X3, W3, Z3;
 	uint64_t fz1, fz2;
 
+	STATS_INC(point_add);
+
 	/*
 	 * Test whether P1 and/or P2 is neutral.
 	 */
@@ -149,6 +151,8 @@ do255e_add_mixed(do255e_point *P3,
 	gf t1, t5, t6, t7, t8, t9, t10, X3, W3, Z3;
 	uint64_t fz1, fz2;
 
+	STATS_INC(point_add_mixed);
+
 	/*
 	 * Test whether P1 and/or P2 is neutral.
 	 */
@@ -223,6 +227,8 @@ do255e_double(do255e_point *P3, const do255e_point *P1)
 {
 	gf tX, tW, tZ, t4, t5;
 
+	STATS_INC(point_double);
+
 	/*
 	 * X' = W^4         (in tX)
 	 * W' = W^2 - 2*X   (in tW)
@@ -258,6 +264,8 @@ do255e_double_x(do255e_point *P3, const do255e_point *P1, unsigned n)
 {
 	gf tX, tW, tZ, t1, t2;
 
+	STATS_ADD(point_double, n);
+
 	if (n == 0) {
 		*P3 = *P1;
 		return;
@@ -806,6 +814,8 @@ do255e_double_xu(do255e_point_xu *P3, const do255e_point_xu *P1)
 {
 	gf tX, tW, tZ, t1, t2;
 
+	STATS_INC(point_double);
+
 	/*
 	 * First half-doubling, combined with conversion from fractional (x,u)
 	 * to Jacobian (x,w); output in E[r](-2*a,a^2-4*b).
@@ -855,6 +865,8 @@ do255e_double_x_xu(do255e_point_xu *P3, const do255e_point_xu *P1, unsigned n)
 {
 	gf tX, tW, tZ, t1, t2;
 
+	STATS_ADD(point_double, n);
+
 	if (n == 0) {
 		*P3 = *P1;
 		return;
@@ -949,6 +961,8 @@ do255e_add_mixed_xu(do255e_point_xu *P3,
 {
 	gf t1, t3, t5, t6, t7, t8, t9, t10;
 
+	STATS_INC(point_add_mixed);
+
 	/* t1 <- X1*X2 */
 	gf_mul_inline(&t1, &P1->X.w64, &P2->X.w64);
 
@@ -1013,6 +1027,8 @@ do255e_add_xu(do255e_point_xu *P3,
 {
 	gf t1, t2, t3, t4, t5, t6, t7, t8, t9, t10;
 
+	STATS_INC(point_add);
+
 	/* t1 <- X1*X2 */
 	gf_mul_inline(&t1, &P1->X.w64, &P2->X.w64);
 
@@ -341,6 +341,8 @@ do255s_add(do255s_point *P3,
 	gf t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, X3, W3, Z3;
 	uint32_t fz1, fz2;
 
+	STATS_INC(point_add);
+
 	/*
 	 * Test whether P1 and/or P2 is neutral.
 	 */
@@ -428,6 +430,8 @@ do255s_add_mixed(do255s_point *P3,
 	gf t1, t5, t6, t7, t8, t9, t10, X3, W3, Z3;
 	uint32_t fz1, fz2;
 
+	STATS_INC(point_add_mixed);
+
 	/*
 	 * Test whether P1 and/or P2 is neutral.
 	 */
@@ -500,6 +504,8 @@ do255s_double_inline(do255s_point *P3, const do255s_point *P1)
 {
 	gf t1, t2, t3, t4, X3;
 
+	STATS_INC(point_double);
+
 	/* t1 <- W*Z */
 	gf_mul_inline(&t1, &P1->W.w32, &P1->Z.w32);
 
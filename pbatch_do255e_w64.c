@@ -0,0 +1,244 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations, additions, multiplications
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_verify_batch_helper_vartime() for curve
+ * do255e. It works with any finite field implementation with 64-bit
+ * limbs.
+ */
+
+/*
+ * Fill win[i] with (2*i+1)*P, in fractional (x,u) coordinates, for
+ * i = 0..7. The source point MUST NOT be the neutral.
+ */
+static void
+window_fill_16odd_xu(CN(point_xu) *win, const CN(point_xu) *P)
+{
+	CN(point_xu) T;
+	int i;
+
+	win[0] = *P;
+	CN(double_xu)(&T, P);
+	for (i = 1; i < 8; i ++) {
+		CN(add_xu)(&win[i], &win[i - 1], &T);
+	}
+}
+
+/* see do255.h */
+int
+CN(verify_batch_helper_vartime)(const void *k0,
+	const CN(point) *P, const void *k1,
+	const void *R_enc, const void *k2, size_t num)
+{
+	/*
+	 * Each scalar k1[i] is split with the endomorphism into two
+	 * signed 128-bit halves, as in CURVE_verify_helper_vartime();
+	 * the window for the high half is obtained by applying the
+	 * endomorphism on the points of the window for the low half.
+	 * Scalars k2[i] are already 128-bit long. All these halves are
+	 * recoded in NAF5, and we precompute the odd multiples of the
+	 * points (in fractional (x,u) coordinates). Scalar k0 uses the
+	 * hardcoded windows for G and 2^130*G, with 5-bit digits.
+	 *
+	 * All point doublings are shared, which is the point of batch
+	 * verification: we perform about 130 doublings in total, instead
+	 * of 130 per signature.
+	 */
+	CN(point_xu) win[3 * DO255_VERIFY_BATCH_MAX][8];
+	int8_t sd[3 * DO255_VERIFY_BATCH_MAX][130];
+	uint8_t sd0[52];
+	CN(point_xu) M;
+	size_t u, n;
+	unsigned dbl;
+	int started, i;
+
+	if (num > DO255_VERIFY_BATCH_MAX) {
+		return 0;
+	}
+
+	/*
+	 * Compute the windows and recode the scalars. Points which are
+	 * the neutral are skipped, since they contribute nothing to
+	 * the sum.
+	 */
+	n = 0;
+	for (u = 0; u < num; u ++) {
+		CN(point) Rd;
+		CN(point_xu) T;
+		i128 k1_lo, k1_hi, z;
+		uint64_t sg;
+		int j;
+
+		if (!CN(decode_vartime)(&Rd, (const uint8_t *)R_enc + 32 * u)) {
+			return 0;
+		}
+
+		if (!CN(is_neutral)(&P[u])) {
+			/*
+			 * Split k1[u], and use -P[u] for the low window if
+			 * the low half is negative. The high window is
+			 * negated as well if the two halves have different
+			 * signs.
+			 */
+			split_scalar(&k1_lo, &k1_hi, (const uint8_t *)k1 + 32 * u);
+			sg = i128_abs(&k1_lo);
+			T.X = P[u].X;
+			gf_sqr(&T.Z.w64, &P[u].Z.w64);
+			T.U = P[u].Z;
+			gf_condneg(&T.T.w64, &P[u].W.w64, sg);
+			window_fill_16odd_xu(win[n], &T);
+			sg ^= i128_abs(&k1_hi);
+			for (j = 0; j < 8; j ++) {
+				gf_neg(&win[n + 1][j].X.w64, &win[n][j].X.w64);
+				win[n + 1][j].Z = win[n][j].Z;
+				win[n + 1][j].U = win[n][j].U;
+				gf_mul(&win[n + 1][j].T.w64, &win[n][j].T.w64,
+					sg ? &ETA : &MINUS_ETA);
+			}
+
+			/*
+			 * Both halves fit on 127 bits, so their NAF5
+			 * recoding cannot yield a carry.
+			 */
+			(void)recode_NAF5_128(sd[n], &k1_lo);
+			sd[n][128] = 0;
+			sd[n][129] = 0;
+			(void)recode_NAF5_128(sd[n + 1], &k1_hi);
+			sd[n + 1][128] = 0;
+			sd[n + 1][129] = 0;
+			n += 2;
+		}
+
+		if (!CN(is_neutral)(&Rd)) {
+			/*
+			 * R is normalized (Z = 1), hence in (x,u)
+			 * coordinates we have X = x, Z = 1, U = 1, T = w.
+			 * The 128-bit scalar k2[u] may yield a carry in
+			 * NAF5 recoding; it is then the digit at index 128.
+			 */
+			T.X = Rd.X;
+			T.Z.w64 = GF_ONE;
+			T.U.w64 = GF_ONE;
+			T.T = Rd.W;
+			window_fill_16odd_xu(win[n], &T);
+			i128_decode(&z, (const uint8_t *)k2 + 16 * u);
+			sd[n][128] = (int8_t)recode_NAF5_128(sd[n], &z);
+			sd[n][129] = 0;
+
+			/*
+			 * We want to subtract k2[u]*R[u], hence we negate
+			 * all the points in the window.
+			 */
+			for (j = 0; j < 8; j ++) {
+				gf_neg(&win[n][j].T.w64, &win[n][j].T.w64);
+			}
+			n ++;
+		}
+	}
+
+	/*
+	 * Recode scalar k0: digits 0 to 25 go with window_G_xu, digits
+	 * 26 to 51 with window_G130_xu.
+	 */
+	recode5(sd0, k0);
+
+	/*
+	 * Perform the combined point multiplications. Digits in sd[][]
+	 * are for bits 129 down to 0, while digits in sd0[] apply only
+	 * at bit indexes which are multiples of 5. Doublings are
+	 * accumulated and performed only when there is something to add,
+	 * so that we may use the faster double_x_xu() with n > 1; as
+	 * long as the accumulator is still the neutral, doublings are
+	 * skipped altogether.
+	 */
+	M.X.w64 = GF_ZERO;
+	M.Z.w64 = GF_ONE;
+	M.U.w64 = GF_ZERO;
+	M.T.w64 = GF_ONE;
+	dbl = 0;
+	started = 0;
+	for (i = 129; i >= 0; i --) {
+		CN(point_xu) Q;
+		CN(point_affine_xu) Qa;
+		int j;
+
+		for (u = 0; u < n; u ++) {
+			int d;
+
+			d = sd[u][i];
+			if (d == 0) {
+				continue;
+			}
+			if (dbl != 0) {
+				CN(double_x_xu)(&M, &M, dbl);
+				dbl = 0;
+			}
+			if (d > 0) {
+				CN(add_xu)(&M, &M, &win[u][d >> 1]);
+			} else {
+				j = (-d) >> 1;
+				Q.X = win[u][j].X;
+				Q.Z = win[u][j].Z;
+				Q.U = win[u][j].U;
+				gf_neg(&Q.T.w64, &win[u][j].T.w64);
+				CN(add_xu)(&M, &M, &Q);
+			}
+			started = 1;
+		}
+
+		if (i % 5 == 0) {
+			uint8_t d0, d1;
+
+			d0 = sd0[i / 5];
+			d1 = sd0[i / 5 + 26];
+			if ((d0 & 31) != 0 || (d1 & 31) != 0) {
+				if (dbl != 0) {
+					CN(double_x_xu)(&M, &M, dbl);
+					dbl = 0;
+				}
+			}
+			if ((d0 & 31) != 0) {
+				j = (d0 & 31) - 1;
+				if (d0 < 0x80) {
+					CN(add_mixed_xu)(&M, &M, &window_G_xu[j]);
+				} else {
+					Qa.X = window_G_xu[j].X;
+					gf_neg(&Qa.U.w64, &window_G_xu[j].U.w64);
+					CN(add_mixed_xu)(&M, &M, &Qa);
+				}
+				started = 1;
+			}
+			if ((d1 & 31) != 0) {
+				j = (d1 & 31) - 1;
+				if (d1 < 0x80) {
+					CN(add_mixed_xu)(&M, &M,
+						&window_G130_xu[j]);
+				} else {
+					Qa.X = window_G130_xu[j].X;
+					gf_neg(&Qa.U.w64,
+						&window_G130_xu[j].U.w64);
+					CN(add_mixed_xu)(&M, &M, &Qa);
+				}
+				started = 1;
+			}
+		}
+
+		if (i > 0 && started) {
+			dbl ++;
+		}
+	}
+	if (dbl != 0) {
+		CN(double_x_xu)(&M, &M, dbl);
+	}
+
+	/*
+	 * The equation is fulfilled if and only if we get the neutral,
+	 * i.e. u = 0 (M.T cannot be zero).
+	 */
+	return (int)gf_iszero(&M.U.w64);
+}
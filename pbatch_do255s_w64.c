@@ -0,0 +1,195 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations, additions, multiplications
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_verify_batch_helper_vartime() for curve
+ * do255s. It works with any finite field implementation with 64-bit
+ * limbs.
+ */
+
+/*
+ * Fill win[8*j + i] with (2*i+1)*P[j], in affine coordinates, for
+ * i = 0..7 and j = 0..num-1. A single inversion is used for all
+ * points. Source points MUST NOT be the neutral.
+ */
+static void
+window_fill_16odd_multi_affine(CN(point_affine) *win,
+	const CN(point) *P, size_t num)
+{
+	CN(point) T, U;
+	gf ZZ[16 * DO255_VERIFY_BATCH_MAX], MZ[16 * DO255_VERIFY_BATCH_MAX];
+	size_t j, n;
+	int i;
+
+	/*
+	 * Compute point multiples; we store the Z coordinates in a
+	 * separate array.
+	 */
+	n = 8 * num;
+	for (j = 0; j < num; j ++) {
+		CN(point_affine) *w;
+
+		w = win + 8 * j;
+		w[0].X = P[j].X;
+		w[0].W = P[j].W;
+		ZZ[8 * j] = P[j].Z.w64;
+		T = P[j];
+		CN(double)(&U, &T);
+		for (i = 1; i < 8; i ++) {
+			CN(add)(&T, &T, &U);
+			w[i].X = T.X;
+			w[i].W = T.W;
+			ZZ[8 * j + i] = T.Z.w64;
+		}
+	}
+
+	batch_affine(win, ZZ, MZ, n);
+}
+
+/* see do255.h */
+int
+CN(verify_batch_helper_vartime)(const void *k0,
+	const CN(point) *P, const void *k1,
+	const void *R_enc, const void *k2, size_t num)
+{
+	/*
+	 * Scalars k0 and k1[i] are reduced modulo r (hence they fit on
+	 * 254 bits) and recoded in NAF5; scalars k2[i] have 128 bits,
+	 * and are also recoded in NAF5 (with a possible carry). We use
+	 * the hardcoded windows for G and 2^128*G for k0. The points
+	 * P[i] and -R[i] get windows of odd multiples, normalized to
+	 * affine coordinates with a single shared inversion.
+	 *
+	 * Unlike CURVE_verify_helper_vartime(), we cannot use Lagrange's
+	 * algorithm to halve the size of k1[i], since that would require
+	 * multiplying each individual equation by a distinct factor,
+	 * while k0 is shared. Doublings are shared among all points,
+	 * which is what makes batch verification worthwhile.
+	 */
+	CN(point) Q[2 * DO255_VERIFY_BATCH_MAX];
+	CN(point_affine) win[2 * DO255_VERIFY_BATCH_MAX][8];
+	int8_t sd[2 * DO255_VERIFY_BATCH_MAX][256];
+	int8_t sd0[256];
+	CN(point) T;
+	i256 t;
+	size_t u, n;
+	int started, i;
+
+	if (num > DO255_VERIFY_BATCH_MAX) {
+		return 0;
+	}
+
+	/*
+	 * Gather the points and recode the scalars. Points which are
+	 * the neutral are skipped, since they contribute nothing to
+	 * the sum.
+	 */
+	n = 0;
+	for (u = 0; u < num; u ++) {
+		CN(point) Rd;
+		i128 z;
+
+		if (!CN(decode_vartime)(&Rd, (const uint8_t *)R_enc + 32 * u)) {
+			return 0;
+		}
+		if (!CN(is_neutral)(&P[u])) {
+			Q[n] = P[u];
+			i256_decode(&t, (const uint8_t *)k1 + 32 * u);
+			modr_reduce256_partial(&t, &t, 0);
+			modr_reduce256_finish(&t, &t);
+			(void)recode_NAF5_256(sd[n], &t);
+			n ++;
+		}
+		if (!CN(is_neutral)(&Rd)) {
+			/*
+			 * We want to subtract k2[u]*R[u], hence we use
+			 * point -R[u]. A carry in NAF5 recoding is the
+			 * digit at index 128.
+			 */
+			CN(neg)(&Q[n], &Rd);
+			i128_decode(&z, (const uint8_t *)k2 + 16 * u);
+			sd[n][128] = (int8_t)recode_NAF5_128(sd[n], &z);
+			memset(&sd[n][129], 0, 127);
+			n ++;
+		}
+	}
+	if (n > 0) {
+		window_fill_16odd_multi_affine(&win[0][0], Q, n);
+	}
+
+	/*
+	 * Recode scalar k0: digits 0 to 127 go with window_G, digits
+	 * 128 to 255 with window_odd_G128.
+	 */
+	i256_decode(&t, k0);
+	modr_reduce256_partial(&t, &t, 0);
+	modr_reduce256_finish(&t, &t);
+	(void)recode_NAF5_256(sd0, &t);
+
+	/*
+	 * Perform the combined point multiplications. Doublings are
+	 * skipped as long as the accumulator is the neutral.
+	 */
+	T.X.w64 = GF_ZERO;
+	T.W.w64 = GF_ONE;
+	T.Z.w64 = GF_ZERO;
+	started = 0;
+	for (i = 255; i >= 0; i --) {
+		CN(point_affine) Qa;
+		int j, d;
+
+		if (started) {
+			CN(double)(&T, &T);
+		}
+		if (i < 128 && sd0[i] != 0) {
+			if (sd0[i] > 0) {
+				j = sd0[i] - 1;
+				CN(add_mixed)(&T, &T, &window_G[j]);
+			} else {
+				j = -sd0[i] - 1;
+				Qa.X = window_G[j].X;
+				gf_neg(&Qa.W.w64, &window_G[j].W.w64);
+				CN(add_mixed)(&T, &T, &Qa);
+			}
+			started = 1;
+		}
+		if (i < 128 && sd0[i + 128] != 0) {
+			if (sd0[i + 128] > 0) {
+				j = sd0[i + 128] >> 1;
+				CN(add_mixed)(&T, &T, &window_odd_G128[j]);
+			} else {
+				j = -sd0[i + 128] >> 1;
+				Qa.X = window_odd_G128[j].X;
+				gf_neg(&Qa.W.w64, &window_odd_G128[j].W.w64);
+				CN(add_mixed)(&T, &T, &Qa);
+			}
+			started = 1;
+		}
+		for (u = 0; u < n; u ++) {
+			d = sd[u][i];
+			if (d == 0) {
+				continue;
+			}
+			if (d > 0) {
+				CN(add_mixed)(&T, &T, &win[u][d >> 1]);
+			} else {
+				j = (-d) >> 1;
+				Qa.X = win[u][j].X;
+				gf_neg(&Qa.W.w64, &win[u][j].W.w64);
+				CN(add_mixed)(&T, &T, &Qa);
+			}
+			started = 1;
+		}
+	}
+
+	/*
+	 * The equation is fulfilled if and only if we get the neutral
+	 * at this point.
+	 */
+	return (int)CN(is_neutral)(&T);
+}
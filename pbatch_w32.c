@@ -0,0 +1,241 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations, additions, multiplications
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_verify_batch_helper_vartime(). It works
+ * with both curves, and with any finite field implementation with 32-bit
+ * limbs (including the ARM assembly implementations).
+ */
+
+/*
+ * NAF4 recoding of an unsigned integer (len bytes, little-endian),
+ * producing 8*len digits. Returned value is the carry (0 or 1); it is
+ * the extra digit at index 8*len.
+ */
+static uint32_t
+recode_NAF4_bytes(int8_t *rc, const uint8_t *s, size_t len)
+{
+	uint32_t x;
+	size_t i, j;
+	int x_len;
+
+	x = 0;
+	x_len = 0;
+	j = 0;
+	for (i = 0; i < 8 * len; i ++) {
+		uint32_t m, t, c;
+
+		if (x_len < 8 && j < len) {
+			x += (uint32_t)s[j ++] << x_len;
+			x_len += 8;
+		}
+
+		/*
+		 * Same process as recode_NAF4_word(), with a refill
+		 * from the source bytes when needed.
+		 */
+		m = -(x & 1);
+		t = x & m & (uint32_t)15;
+		c = (t & (uint32_t)8) << 1;
+		x = (x - t) + c;
+		rc[i] = (int8_t)((int)t - (int)c);
+		x >>= 1;
+		x_len --;
+	}
+	return x;
+}
+
+/*
+ * Invert n field elements zz[i] in place, with a single inversion
+ * (Montgomery's trick); tmp[] must have room for n elements. If any of
+ * the elements is zero, then all output values are zero.
+ */
+UNUSED
+static void
+batch_inv(gf *zz, gf *tmp, size_t n)
+{
+	size_t j;
+
+	if (n == 0) {
+		return;
+	}
+	tmp[0] = zz[0];
+	for (j = 1; j < n; j ++) {
+		gf_mul(&tmp[j], &tmp[j - 1], &zz[j]);
+	}
+	gf_inv(&tmp[n - 1], &tmp[n - 1]);
+	for (j = n - 1; j >= 1; j --) {
+		gf zi;
+
+		gf_mul(&zi, &tmp[j], &tmp[j - 1]);
+		gf_mul(&tmp[j - 1], &tmp[j], &zz[j]);
+		zz[j] = zi;
+	}
+	zz[0] = tmp[0];
+}
+
+/*
+ * Normalize n points to affine coordinates, with a single inversion.
+ * On input, win[i] contains the X and W coordinates of the i-th point,
+ * and zz[i] its Z coordinate; tmp[] must have room for n elements.
+ * Contents of zz[] are destroyed. If any of the points is the neutral,
+ * then all output points are set to (0,0).
+ */
+UNUSED
+static void
+batch_affine(CN(point_affine) *win, gf *zz, gf *tmp, size_t n)
+{
+	size_t j;
+
+	batch_inv(zz, tmp, n);
+	for (j = 0; j < n; j ++) {
+		gf zi2;
+
+		gf_sqr(&zi2, &zz[j]);
+		gf_mul(&win[j].X.w32, &win[j].X.w32, &zi2);
+		gf_mul(&win[j].W.w32, &win[j].W.w32, &zz[j]);
+	}
+}
+
+/*
+ * Fill win[4*j + i] with (2*i+1)*P[j], in affine coordinates, for
+ * i = 0..3 and j = 0..num-1. A single inversion is used for all
+ * points. Source points MUST NOT be the neutral.
+ */
+static void
+window_fill_8odd_multi_affine(CN(point_affine) *win,
+	const CN(point) *P, size_t num)
+{
+	CN(point) T, U;
+	gf ZZ[8 * DO255_VERIFY_BATCH_MAX], MZ[8 * DO255_VERIFY_BATCH_MAX];
+	size_t j, n;
+	int i;
+
+	/*
+	 * Compute point multiples; we store the Z coordinates in a
+	 * separate array.
+	 */
+	n = 4 * num;
+	for (j = 0; j < num; j ++) {
+		CN(point_affine) *w;
+
+		w = win + 4 * j;
+		w[0].X = P[j].X;
+		w[0].W = P[j].W;
+		ZZ[4 * j] = P[j].Z.w32;
+		T = P[j];
+		CN(double)(&U, &T);
+		for (i = 1; i < 4; i ++) {
+			CN(add)(&T, &T, &U);
+			w[i].X = T.X;
+			w[i].W = T.W;
+			ZZ[4 * j + i] = T.Z.w32;
+		}
+	}
+
+	batch_affine(win, ZZ, MZ, n);
+}
+
+/* see do255.h */
+int
+CN(verify_batch_helper_vartime)(const void *k0,
+	const CN(point) *P, const void *k1,
+	const void *R_enc, const void *k2, size_t num)
+{
+	/*
+	 * Each point P[i] or -R[i] gets a window of four odd multiples,
+	 * normalized to affine coordinates with a single shared
+	 * inversion; scalars are recoded in NAF4. The k0*G term is
+	 * computed separately with CURVE_mulgen() and added at the end.
+	 * Doublings are shared among all points.
+	 */
+	CN(point) Q[2 * DO255_VERIFY_BATCH_MAX];
+	CN(point_affine) win[2 * DO255_VERIFY_BATCH_MAX][4];
+	int8_t sd[2 * DO255_VERIFY_BATCH_MAX][256];
+	CN(point) T, U;
+	uint8_t t[32];
+	size_t u, n;
+	int started, i;
+
+	if (num > DO255_VERIFY_BATCH_MAX) {
+		return 0;
+	}
+
+	/*
+	 * Compute the windows and recode the scalars. Points which are
+	 * the neutral are skipped, since they contribute nothing to
+	 * the sum.
+	 */
+	n = 0;
+	for (u = 0; u < num; u ++) {
+		CN(point) Rd;
+
+		if (!CN(decode)(&Rd, (const uint8_t *)R_enc + 32 * u)) {
+			return 0;
+		}
+		if (!CN(is_neutral)(&P[u])) {
+			Q[n] = P[u];
+			CN(scalar_reduce)(t, (const uint8_t *)k1 + 32 * u, 32);
+			(void)recode_NAF4_bytes(sd[n], t, 32);
+			n ++;
+		}
+		if (!CN(is_neutral)(&Rd)) {
+			/*
+			 * We want to subtract k2[u]*R[u], hence we use
+			 * point -R[u]. A carry in NAF4 recoding is the
+			 * digit at index 128.
+			 */
+			CN(neg)(&Q[n], &Rd);
+			sd[n][128] = (int8_t)recode_NAF4_bytes(sd[n],
+				(const uint8_t *)k2 + 16 * u, 16);
+			memset(&sd[n][129], 0, 127);
+			n ++;
+		}
+	}
+	if (n > 0) {
+		window_fill_8odd_multi_affine(&win[0][0], Q, n);
+	}
+
+	/*
+	 * Perform the combined point multiplications. Doublings are
+	 * skipped as long as the accumulator is the neutral.
+	 */
+	T = CN(neutral);
+	started = 0;
+	for (i = 255; i >= 0; i --) {
+		if (started) {
+			CN(double)(&T, &T);
+		}
+		for (u = 0; u < n; u ++) {
+			CN(point_affine) Qa;
+			int d, j;
+
+			d = sd[u][i];
+			if (d == 0) {
+				continue;
+			}
+			if (d > 0) {
+				CN(add_mixed)(&T, &T, &win[u][d >> 1]);
+			} else {
+				j = (-d) >> 1;
+				Qa.X = win[u][j].X;
+				gf_neg(&Qa.W.w32, &win[u][j].W.w32);
+				CN(add_mixed)(&T, &T, &Qa);
+			}
+			started = 1;
+		}
+	}
+
+	/*
+	 * Add k0*G; the equation is fulfilled if and only if we get
+	 * the neutral.
+	 */
+	CN(mulgen)(&U, k0);
+	CN(add)(&T, &T, &U);
+	return CN(is_neutral)(&T);
+}
@@ -11,6 +11,7 @@
  * This file is for all implementations that use 32-bit limbs. It defines:
  *  - CURVE_neutral
  *  - CURVE_decode()
+ *  - CURVE_decode_vartime()
  *  - CURVE_encode()
  *  - CURVE_is_neutral()
  *  - CURVE_eq()
@@ -90,6 +91,17 @@ CN(decode)(CN(point) *P, const void *src)
 	return (int)r;
 }
 
+/* see do255.h */
+int
+CN(decode_vartime)(CN(point) *P, const void *src)
+{
+	/*
+	 * There is no variable-time Legendre symbol implementation with
+	 * 32-bit limbs; we use the constant-time code.
+	 */
+	return CN(decode)(P, src);
+}
+
 /* see do255.h */
 void
 CN(encode)(void *dst, const CN(point) *P)
@@ -4,13 +4,15 @@
  *
  *  - included "do255.h"
  *  - defined macros CURVE and CN()
- *  - defined gf and operations, including gf_sqrt() and gf_issquare()
+ *  - defined gf and operations, including gf_sqrt(), gf_issquare() and
+ *    gf_legendre_vartime()
  *  - defined CURVE_A and CURVE_4B (to curve parameters a and 4*b)
  *  - defined the conventional curve generator
  *
  * This file is for all implementations that use 64-bit limbs. It defines:
  *  - CURVE_neutral
  *  - CURVE_decode()
+ *  - CURVE_decode_vartime()
  *  - CURVE_encode()
  *  - CURVE_is_neutral()
  *  - CURVE_eq()
@@ -23,9 +25,13 @@ const CN(point) CN(neutral) = {
 	{ { 0, 0, 0, 0 } }
 };
 
-/* see do255.h */
-int
-CN(decode)(CN(point) *P, const void *src)
+/*
+ * Point decoding (see CURVE_decode()). If vartime is non-zero, then the
+ * quadratic residue tests use the variable-time Legendre symbol.
+ */
+FORCE_INLINE
+static inline int
+decode_inner(CN(point) *P, const void *src, int vartime)
 {
 	uint64_t r, qr, zz;
 	gf x, w, d;
@@ -52,7 +58,11 @@ CN(decode)(CN(point) *P, const void *src)
 		   root. */
 		uint64_t r3;
 
-		r3 = (uint64_t)gf_legendre(&d);
+		if (vartime) {
+			r3 = (uint64_t)gf_legendre_vartime(&d);
+		} else {
+			r3 = (uint64_t)gf_legendre(&d);
+		}
 		return (int)((r & ~(r3 >> 1)) | zz);
 	}
 	r &= gf_sqrt(&d, &d);
@@ -63,7 +73,11 @@ CN(decode)(CN(point) *P, const void *src)
 
 	/* If x is a square, then we must use the other solution,
 	   i.e. ((w^2 - a) - d)/2, which we obtain by subtracting d. */
-	qr = gf_issquare(&x);
+	if (vartime) {
+		qr = 1 - ((uint64_t)gf_legendre_vartime(&x) >> 63);
+	} else {
+		qr = gf_issquare(&x);
+	}
 	d.v0 &= -qr;
 	d.v1 &= -qr;
 	d.v2 &= -qr;
@@ -94,6 +108,20 @@ CN(decode)(CN(point) *P, const void *src)
 	return (int)r;
 }
 
+/* see do255.h */
+int
+CN(decode)(CN(point) *P, const void *src)
+{
+	return decode_inner(P, src, 0);
+}
+
+/* see do255.h */
+int
+CN(decode_vartime)(CN(point) *P, const void *src)
+{
+	return decode_inner(P, src, 1);
+}
+
 /* see do255.h */
 void
 CN(encode)(void *dst, const CN(point) *P)
@@ -0,0 +1,33 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined CURVE_decode()
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_decode_batch() as sequential calls to
+ * CURVE_decode(). It is used by all implementations that do not have a
+ * 4-way parallel version: unlike encoding, decoding does not involve
+ * any inversion, so there is nothing to share between points.
+ */
+
+/* see do255.h */
+int
+CN(decode_batch)(CN(point) *P, uint8_t *ok, const void *src, size_t num)
+{
+	size_t u;
+	int all;
+
+	all = 1;
+	for (u = 0; u < num; u ++) {
+		int r;
+
+		r = CN(decode)(&P[u], (const uint8_t *)src + 32 * u);
+		if (ok != NULL) {
+			ok[u] = (uint8_t)r;
+		}
+		all &= r;
+	}
+	return all;
+}
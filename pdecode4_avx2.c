@@ -0,0 +1,168 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined macros CURVE and CN()
+ *  - defined gf and operations
+ *  - defined gf4 and operations (gf_avx2.c)
+ *  - defined gf4_sqrt_candidate() (sqrt4_CURVE_avx2.c)
+ *  - defined CURVE_A and CURVE_4B (to curve parameters a and 4*b)
+ *
+ * This file defines CURVE_decode_batch() for the AVX2 implementations:
+ * points are decoded by groups of four, and the two exponentiations
+ * of each decoding (square root of the discriminant, and quadratic
+ * residue test on x) are computed in parallel, one per SIMD lane.
+ * Results are identical to that of CURVE_decode().
+ */
+
+/*
+ * Get a square root of a[j] into d[j] for j = 0..3 (with the same
+ * conventions as gf_sqrt(): the root whose least significant bit is
+ * zero is returned). If a value is not a quadratic residue, then the
+ * corresponding d[j] is set to zero. Bit j of the returned value is
+ * set if a[j] is a quadratic residue. Arrays d and a may be the same.
+ */
+static unsigned
+gf_sqrt_x4(gf *d, const gf *a)
+{
+	gf4 t;
+	gf y[4];
+	unsigned r;
+	int j;
+
+	gf4_set(&t, &a[0], &a[1], &a[2], &a[3]);
+	gf4_sqrt_candidate(&t, &t);
+	gf4_get(&y[0], &y[1], &y[2], &y[3], &t);
+	r = 0;
+	for (j = 0; j < 4; j ++) {
+		gf x;
+		uint64_t qr;
+
+		gf_normalize(&y[j], &y[j]);
+		gf_condneg(&y[j], &y[j], y[j].v0 & 1);
+		gf_sqr(&x, &y[j]);
+		qr = gf_eq(&x, &a[j]);
+		d[j].v0 = y[j].v0 & -qr;
+		d[j].v1 = y[j].v1 & -qr;
+		d[j].v2 = y[j].v2 & -qr;
+		d[j].v3 = y[j].v3 & -qr;
+		r |= (unsigned)qr << j;
+	}
+	return r;
+}
+
+/*
+ * Decode four points (same process as CURVE_decode()). Bit j of the
+ * returned value is set if the decoding of point j succeeded.
+ */
+static unsigned
+decode_x4(CN(point) *P, const uint8_t *src)
+{
+	gf w[4], x[4], d[4], t[4];
+	uint64_t r[4], zz[4];
+	unsigned qr, res;
+	int j;
+
+	for (j = 0; j < 4; j ++) {
+		r[j] = gf_decode(&w[j], src + 32 * j);
+		zz[j] = r[j] & gf_iszero(&w[j]);
+
+		/* x <- w^2 - a */
+		gf_sqr(&x[j], &w[j]);
+		gf_sub(&x[j], &x[j], &CURVE_A);
+
+		/* d <- (w^2 - a)^2 - 4*b */
+		gf_sqr(&d[j], &x[j]);
+		gf_sub(&d[j], &d[j], &CURVE_4B);
+	}
+
+	/* d <- sqrt((w^2 - a)^2 - 4*b) */
+	qr = gf_sqrt_x4(d, d);
+	for (j = 0; j < 4; j ++) {
+		r[j] &= (qr >> j) & 1;
+
+		/* x <- ((w^2 - a) + d)/2 */
+		gf_add(&x[j], &x[j], &d[j]);
+		gf_half(&x[j], &x[j]);
+	}
+
+	/*
+	 * If x is a square, then we must use the other solution,
+	 * i.e. ((w^2 - a) - d)/2, which we obtain by subtracting d.
+	 * The quadratic residue status is that of the square root
+	 * computation.
+	 */
+	qr = gf_sqrt_x4(t, x);
+	res = 0;
+	for (j = 0; j < 4; j ++) {
+		uint64_t m, rm;
+
+		m = -(uint64_t)((qr >> j) & 1);
+		d[j].v0 &= m;
+		d[j].v1 &= m;
+		d[j].v2 &= m;
+		d[j].v3 &= m;
+		gf_sub(&x[j], &x[j], &d[j]);
+
+		/* Clamp to the neutral on failure (see CURVE_decode()). */
+		rm = -r[j];
+		P[j].X.w64.v0 = x[j].v0 & rm;
+		P[j].X.w64.v1 = x[j].v1 & rm;
+		P[j].X.w64.v2 = x[j].v2 & rm;
+		P[j].X.w64.v3 = x[j].v3 & rm;
+		P[j].W.w64.v0 = (w[j].v0 & rm) | (1 - r[j]);
+		P[j].W.w64.v1 = w[j].v1 & rm;
+		P[j].W.w64.v2 = w[j].v2 & rm;
+		P[j].W.w64.v3 = w[j].v3 & rm;
+		P[j].Z.w64.v0 = r[j];
+		P[j].Z.w64.v1 = 0;
+		P[j].Z.w64.v2 = 0;
+		P[j].Z.w64.v3 = 0;
+		res |= (unsigned)(r[j] | zz[j]) << j;
+	}
+	return res;
+}
+
+/* see do255.h */
+int
+CN(decode_batch)(CN(point) *P, uint8_t *ok, const void *src, size_t num)
+{
+	const uint8_t *buf;
+	unsigned all;
+
+	buf = src;
+	all = 1;
+	while (num > 0) {
+		CN(point) Q[4];
+		uint8_t tmp[4 * 32];
+		size_t j, n;
+		unsigned r;
+
+		/*
+		 * An incomplete final group is padded with zeros (which
+		 * decode successfully, as the neutral).
+		 */
+		n = num < 4 ? num : 4;
+		memset(tmp, 0, sizeof tmp);
+		memcpy(tmp, buf, 32 * n);
+		r = decode_x4(Q, tmp);
+		for (j = 0; j < n; j ++) {
+			unsigned rj;
+
+			P[j] = Q[j];
+			rj = (r >> j) & 1;
+			if (ok != NULL) {
+				ok[j] = (uint8_t)rj;
+			}
+			all &= rj;
+		}
+		P += n;
+		if (ok != NULL) {
+			ok += n;
+		}
+		buf += 32 * n;
+		num -= n;
+	}
+	return (int)all;
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined macros CURVE and CN()
+ *  - defined gf and operations
+ *  - defined batch_inv() (pbatch_w32.c)
+ *
+ * This file is for all implementations that use 32-bit limbs. It defines:
+ *  - CURVE_encode_batch()
+ *  - CURVE_encode_squared_w_batch()
+ */
+
+/*
+ * Points are normalized by chunks of ENCODE_BATCH, with one inversion
+ * per chunk.
+ */
+#define ENCODE_BATCH   16
+
+/*
+ * Encode num points into dst (32 bytes per point). If sq is 1, then
+ * the square of w is encoded instead of w.
+ */
+static void
+encode_batch_inner(uint8_t *dst, const CN(point) *P, size_t num, int sq)
+{
+	gf zz[ENCODE_BATCH], tmp[ENCODE_BATCH];
+
+	while (num > 0) {
+		size_t j, n;
+
+		n = num < ENCODE_BATCH ? num : ENCODE_BATCH;
+
+		/*
+		 * A neutral point has Z = 0, which would spoil the shared
+		 * inversion; we use Z = 1 instead, and set w to zero
+		 * afterwards.
+		 */
+		for (j = 0; j < n; j ++) {
+			gf_sel2(&zz[j], &GF_ONE, &P[j].Z.w32,
+				gf_iszero(&P[j].Z.w32));
+		}
+		batch_inv(zz, tmp, n);
+		for (j = 0; j < n; j ++) {
+			gf t;
+
+			gf_mul(&t, &P[j].W.w32, &zz[j]);
+			gf_sel2(&t, &GF_ZERO, &t, gf_iszero(&P[j].Z.w32));
+			if (sq) {
+				gf_sqr(&t, &t);
+			}
+			gf_encode(dst + 32 * j, &t);
+		}
+		P += n;
+		dst += 32 * n;
+		num -= n;
+	}
+}
+
+/* see do255.h */
+void
+CN(encode_batch)(void *dst, const CN(point) *P, size_t num)
+{
+	encode_batch_inner(dst, P, num, 0);
+}
+
+/* see do255.h */
+void
+CN(encode_squared_w_batch)(void *dst, const CN(point) *P, size_t num)
+{
+	encode_batch_inner(dst, P, num, 1);
+}
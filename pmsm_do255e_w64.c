@@ -0,0 +1,243 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations, additions, multiplications
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_msm_vartime() (Pippenger-style multi-scalar
+ * multiplication) for curve do255e. It works with any finite field
+ * implementation with 64-bit limbs.
+ */
+
+/*
+ * Each scalar is split with the endomorphism into two signed 128-bit
+ * halves, so that we work with 2*num points and 128-bit scalars.
+ */
+#define MSM_BITS   128
+
+/*
+ * Compute the window size and the scratch buffer layout for num points.
+ * Offsets (from the aligned scratch start) are written in off[]:
+ *   off[0]   affine points (CN(point_affine_xu), 2*num)
+ *   off[1]   buckets (CN(point_xu), 2^(c-1))
+ *   off[2]   Z*W products (gf, num)
+ *   off[3]   temporaries for inversion (gf, num)
+ *   off[4]   scalar digits (int16_t, 2*num*nw)
+ *   off[5]   bucket flags (uint8_t, 2^(c-1))
+ * Returned value is the total size, including slack for alignment.
+ */
+static size_t
+msm_layout(size_t num, unsigned *c, size_t *nw, size_t *off)
+{
+	size_t nb;
+
+	*c = msm_window(2 * num, MSM_BITS);
+	*nw = MSM_BITS / *c + 1;
+	nb = (size_t)1 << (*c - 1);
+	off[0] = 0;
+	off[1] = off[0] + 2 * num * sizeof(CN(point_affine_xu));
+	off[2] = off[1] + nb * sizeof(CN(point_xu));
+	off[3] = off[2] + num * sizeof(gf);
+	off[4] = off[3] + num * sizeof(gf);
+	off[5] = off[4] + 2 * num * *nw * sizeof(int16_t);
+	return off[5] + nb + 7;
+}
+
+/* see do255.h */
+size_t
+CN(msm_scratch_size)(size_t num)
+{
+	unsigned c;
+	size_t nw, off[6];
+
+	return msm_layout(num, &c, &nw, off);
+}
+
+/* see do255.h */
+void
+CN(msm_vartime)(CN(point) *Q, const CN(point) *P,
+	const void *scalars, size_t num, void *scratch)
+{
+	CN(point_affine_xu) *pts;
+	CN(point_xu) *bk;
+	CN(point_xu) M;
+	gf *zz, *tmp;
+	int16_t *sd;
+	uint8_t *bf;
+	unsigned char *buf;
+	size_t off[6], nw, nb, n, u, j;
+	unsigned c;
+	int started;
+	long w;
+
+	msm_layout(num, &c, &nw, off);
+	nb = (size_t)1 << (c - 1);
+	buf = (unsigned char *)scratch;
+	buf += (size_t)(-(uintptr_t)buf) & 7;
+	pts = (CN(point_affine_xu) *)(void *)(buf + off[0]);
+	bk = (CN(point_xu) *)(void *)(buf + off[1]);
+	zz = (gf *)(void *)(buf + off[2]);
+	tmp = (gf *)(void *)(buf + off[3]);
+	sd = (int16_t *)(void *)(buf + off[4]);
+	bf = buf + off[5];
+
+	/*
+	 * Split and recode the scalars. For the k-th non-neutral point,
+	 * the digits for the low and high halves of the scalar are at
+	 * sd[(2*k)*nw] and sd[(2*k+1)*nw], respectively; the sign of each
+	 * half is applied to its digits. We also gather the coordinates
+	 * of the points for normalization: we temporarily store X and Z
+	 * in pts[2*k], and W in pts[2*k+1].X.
+	 */
+	n = 0;
+	for (u = 0; u < num; u ++) {
+		i128 k[2];
+		uint8_t kb[16];
+		int16_t *d;
+		int i;
+
+		if (CN(is_neutral)(&P[u])) {
+			continue;
+		}
+		split_scalar(&k[0], &k[1], (const uint8_t *)scalars + 32 * u);
+		for (i = 0; i < 2; i ++) {
+			uint64_t sg;
+			size_t v;
+
+			sg = i128_abs(&k[i]);
+			enc64le(kb, k[i].v0);
+			enc64le(kb + 8, k[i].v1);
+			d = sd + (2 * n + (size_t)i) * nw;
+			recode_window_vartime(d, kb, 16, c, nw);
+			if (sg) {
+				for (v = 0; v < nw; v ++) {
+					d[v] = (int16_t)-d[v];
+				}
+			}
+		}
+		pts[2 * n].X = P[u].X;
+		pts[2 * n].U = P[u].Z;
+		pts[2 * n + 1].X = P[u].W;
+		gf_mul(&zz[n], &P[u].Z.w64, &P[u].W.w64);
+		n ++;
+	}
+
+	/*
+	 * Normalize the points to affine (x,u) coordinates with a single
+	 * inversion. For a point in Jacobian (x,w) coordinates:
+	 *   x = X/Z^2 = X*(W/(Z*W))^2
+	 *   u = 1/w = Z/W = Z^2/(Z*W)
+	 * Non-neutral points have Z != 0 and W != 0. The second point
+	 * is the image of the first through the endomorphism; in affine
+	 * (x,u) coordinates, it maps (x,u) to (-x,u*eta) (since eta is
+	 * a square root of -1, this is equivalent to multiplying w by
+	 * -eta).
+	 */
+	batch_inv_vartime(zz, tmp, n);
+	for (j = 0; j < n; j ++) {
+		gf iz, t;
+
+		gf_mul(&iz, &pts[2 * j + 1].X.w64, &zz[j]);
+		gf_sqr(&iz, &iz);
+		gf_mul(&pts[2 * j].X.w64, &pts[2 * j].X.w64, &iz);
+		gf_sqr(&t, &pts[2 * j].U.w64);
+		gf_mul(&pts[2 * j].U.w64, &t, &zz[j]);
+		gf_neg(&pts[2 * j + 1].X.w64, &pts[2 * j].X.w64);
+		gf_mul(&pts[2 * j + 1].U.w64, &pts[2 * j].U.w64, &ETA);
+	}
+	n *= 2;
+
+	/*
+	 * Process windows from top to bottom. In each window, points
+	 * are added into the bucket that matches their digit, then
+	 * the buckets are aggregated with a running sum.
+	 */
+	M.X.w64 = GF_ZERO;
+	M.Z.w64 = GF_ONE;
+	M.U.w64 = GF_ZERO;
+	M.T.w64 = GF_ONE;
+	started = 0;
+	for (w = (long)nw - 1; w >= 0; w --) {
+		CN(point_xu) S, A;
+		int s_ok, a_ok;
+
+		memset(bf, 0, nb);
+		for (u = 0; u < n; u ++) {
+			CN(point_affine_xu) Qa;
+			int d;
+
+			d = sd[u * nw + (size_t)w];
+			if (d == 0) {
+				continue;
+			}
+			Qa.X = pts[u].X;
+			if (d > 0) {
+				Qa.U = pts[u].U;
+			} else {
+				gf_neg(&Qa.U.w64, &pts[u].U.w64);
+				d = -d;
+			}
+			j = (size_t)d - 1;
+			if (bf[j]) {
+				CN(add_mixed_xu)(&bk[j], &bk[j], &Qa);
+			} else {
+				bk[j].X = Qa.X;
+				bk[j].Z.w64 = GF_ONE;
+				bk[j].U = Qa.U;
+				bk[j].T.w64 = GF_ONE;
+				bf[j] = 1;
+			}
+		}
+
+		/*
+		 * Sum of (j+1)*bk[j]: running sum S of buckets from the
+		 * top, accumulated into A.
+		 */
+		s_ok = 0;
+		a_ok = 0;
+		for (j = nb; j -- > 0;) {
+			if (bf[j]) {
+				if (s_ok) {
+					CN(add_xu)(&S, &S, &bk[j]);
+				} else {
+					S = bk[j];
+					s_ok = 1;
+				}
+			}
+			if (s_ok) {
+				if (a_ok) {
+					CN(add_xu)(&A, &A, &S);
+				} else {
+					A = S;
+					a_ok = 1;
+				}
+			}
+		}
+
+		if (started) {
+			CN(double_x_xu)(&M, &M, c);
+		}
+		if (a_ok) {
+			if (started) {
+				CN(add_xu)(&M, &M, &A);
+			} else {
+				M = A;
+				started = 1;
+			}
+		}
+	}
+
+	/*
+	 * Return the result in Jacobian (x,w) coordinates (see
+	 * CURVE_mulgen()).
+	 */
+	gf_mul(&Q->X.w64, &M.X.w64, &M.U.w64);
+	gf_mul(&Q->W.w64, &M.Z.w64, &M.T.w64);
+	gf_mul(&Q->Z.w64, &M.Z.w64, &M.U.w64);
+	gf_mul(&Q->X.w64, &Q->X.w64, &Q->Z.w64);
+}
+
+#undef MSM_BITS
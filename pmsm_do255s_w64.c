@@ -0,0 +1,190 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations, additions, multiplications
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_msm_vartime() (Pippenger-style multi-scalar
+ * multiplication) for curve do255s. It works with any finite field
+ * implementation with 64-bit limbs.
+ */
+
+/*
+ * Scalars are reduced modulo r, hence they fit on 254 bits.
+ */
+#define MSM_BITS   254
+
+/*
+ * Compute the window size and the scratch buffer layout for num points.
+ * Offsets (from the aligned scratch start) are written in off[]:
+ *   off[0]   affine points (CN(point_affine), num)
+ *   off[1]   buckets (CN(point), 2^(c-1))
+ *   off[2]   Z coordinates (gf, num)
+ *   off[3]   temporaries for inversion (gf, num)
+ *   off[4]   scalar digits (int16_t, num*nw)
+ *   off[5]   bucket flags (uint8_t, 2^(c-1))
+ * Returned value is the total size, including slack for alignment.
+ */
+static size_t
+msm_layout(size_t num, unsigned *c, size_t *nw, size_t *off)
+{
+	size_t nb;
+
+	*c = msm_window(num, MSM_BITS);
+	*nw = MSM_BITS / *c + 1;
+	nb = (size_t)1 << (*c - 1);
+	off[0] = 0;
+	off[1] = off[0] + num * sizeof(CN(point_affine));
+	off[2] = off[1] + nb * sizeof(CN(point));
+	off[3] = off[2] + num * sizeof(gf);
+	off[4] = off[3] + num * sizeof(gf);
+	off[5] = off[4] + num * *nw * sizeof(int16_t);
+	return off[5] + nb + 7;
+}
+
+/* see do255.h */
+size_t
+CN(msm_scratch_size)(size_t num)
+{
+	unsigned c;
+	size_t nw, off[6];
+
+	return msm_layout(num, &c, &nw, off);
+}
+
+/* see do255.h */
+void
+CN(msm_vartime)(CN(point) *Q, const CN(point) *P,
+	const void *scalars, size_t num, void *scratch)
+{
+	CN(point_affine) *pts;
+	CN(point) *bk;
+	CN(point) M;
+	gf *zz, *tmp;
+	int16_t *sd;
+	uint8_t *bf;
+	unsigned char *buf;
+	size_t off[6], nw, nb, n, u, j;
+	unsigned c;
+	int started;
+	long w;
+
+	msm_layout(num, &c, &nw, off);
+	nb = (size_t)1 << (c - 1);
+	buf = (unsigned char *)scratch;
+	buf += (size_t)(-(uintptr_t)buf) & 7;
+	pts = (CN(point_affine) *)(void *)(buf + off[0]);
+	bk = (CN(point) *)(void *)(buf + off[1]);
+	zz = (gf *)(void *)(buf + off[2]);
+	tmp = (gf *)(void *)(buf + off[3]);
+	sd = (int16_t *)(void *)(buf + off[4]);
+	bf = buf + off[5];
+
+	/*
+	 * Reduce and recode the scalars, and gather the non-neutral
+	 * points for normalization.
+	 */
+	n = 0;
+	for (u = 0; u < num; u ++) {
+		i256 k;
+		uint8_t kb[32];
+
+		if (CN(is_neutral)(&P[u])) {
+			continue;
+		}
+		i256_decode(&k, (const uint8_t *)scalars + 32 * u);
+		modr_reduce256_partial(&k, &k, 0);
+		modr_reduce256_finish(&k, &k);
+		i256_encode(kb, &k);
+		recode_window_vartime(sd + n * nw, kb, 32, c, nw);
+		pts[n].X = P[u].X;
+		pts[n].W = P[u].W;
+		zz[n] = P[u].Z.w64;
+		n ++;
+	}
+	batch_affine_vartime(pts, zz, tmp, n);
+
+	/*
+	 * Process windows from top to bottom. In each window, points
+	 * are added into the bucket that matches their digit, then
+	 * the buckets are aggregated with a running sum.
+	 */
+	M.X.w64 = GF_ZERO;
+	M.W.w64 = GF_ONE;
+	M.Z.w64 = GF_ZERO;
+	started = 0;
+	for (w = (long)nw - 1; w >= 0; w --) {
+		CN(point) S, A;
+		int s_ok, a_ok;
+
+		memset(bf, 0, nb);
+		for (u = 0; u < n; u ++) {
+			CN(point_affine) Qa;
+			int d;
+
+			d = sd[u * nw + (size_t)w];
+			if (d == 0) {
+				continue;
+			}
+			Qa.X = pts[u].X;
+			if (d > 0) {
+				Qa.W = pts[u].W;
+			} else {
+				gf_neg(&Qa.W.w64, &pts[u].W.w64);
+				d = -d;
+			}
+			j = (size_t)d - 1;
+			if (bf[j]) {
+				CN(add_mixed)(&bk[j], &bk[j], &Qa);
+			} else {
+				bk[j].X = Qa.X;
+				bk[j].W = Qa.W;
+				bk[j].Z.w64 = GF_ONE;
+				bf[j] = 1;
+			}
+		}
+
+		/*
+		 * Sum of (j+1)*bk[j]: running sum S of buckets from the
+		 * top, accumulated into A.
+		 */
+		s_ok = 0;
+		a_ok = 0;
+		for (j = nb; j -- > 0;) {
+			if (bf[j]) {
+				if (s_ok) {
+					CN(add)(&S, &S, &bk[j]);
+				} else {
+					S = bk[j];
+					s_ok = 1;
+				}
+			}
+			if (s_ok) {
+				if (a_ok) {
+					CN(add)(&A, &A, &S);
+				} else {
+					A = S;
+					a_ok = 1;
+				}
+			}
+		}
+
+		if (started) {
+			CN(double_x)(&M, &M, c);
+		}
+		if (a_ok) {
+			if (started) {
+				CN(add)(&M, &M, &A);
+			} else {
+				M = A;
+				started = 1;
+			}
+		}
+	}
+	*Q = M;
+}
+
+#undef MSM_BITS
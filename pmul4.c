@@ -0,0 +1,35 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined CURVE_mul() and CURVE_mulgen()
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_mul_x4() and CURVE_mulgen_x4() as four
+ * sequential calls to CURVE_mul() and CURVE_mulgen(), respectively. It
+ * is used by all implementations that do not have a 4-way parallel
+ * version.
+ */
+
+/* see do255.h */
+void
+CN(mul_x4)(CN(point) *P3, const CN(point) *P1, const void *scalars)
+{
+	int i;
+
+	for (i = 0; i < 4; i ++) {
+		CN(mul)(&P3[i], &P1[i], (const uint8_t *)scalars + 32 * i);
+	}
+}
+
+/* see do255.h */
+void
+CN(mulgen_x4)(CN(point) *P3, const void *scalars)
+{
+	int i;
+
+	for (i = 0; i < 4; i ++) {
+		CN(mulgen)(&P3[i], (const uint8_t *)scalars + 32 * i);
+	}
+}
@@ -0,0 +1,483 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined gf4 and operations (gf_avx2.c)
+ *  - defined curve basic operations, additions, multiplications
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_mul_x4() and CURVE_mulgen_x4() for curve
+ * do255e, with AVX2 opcodes: the four point multiplications are
+ * performed in parallel, one per 64-bit lane. All computations use
+ * the complete formulas in fractional (x,u) coordinates, which never
+ * need to test for the neutral point.
+ */
+
+/*
+ * Four points in fractional (x,u) coordinates, and in affine (x,u)
+ * coordinates.
+ */
+typedef struct {
+	gf4 X, Z, U, T;
+} CN(point4_xu);
+typedef struct {
+	gf4 X, U;
+} CN(point4_affine_xu);
+
+/*
+ * Doubling in fractional (x,u) coordinates (see CURVE_double_xu()).
+ */
+static void
+double_xu4(CN(point4_xu) *P3, const CN(point4_xu) *P1)
+{
+	gf4 tX, tW, tZ, t1, t2;
+
+	STATS_ADD(point_double, 4);
+
+	gf4_sqr_inline(&tW, &P1->U);
+	gf4_mul_inline(&t1, &P1->Z, &P1->T);
+	gf4_mul2(&tW, &tW);
+	gf4_mul_inline(&t2, &t1, &P1->T);
+	gf4_mul_inline(&tW, &tW, &P1->X);
+	gf4_sqr_inline(&tX, &t2);
+	gf4_sub(&tW, &t2, &tW);
+	gf4_mul_inline(&tZ, &t1, &P1->U);
+
+	gf4_sqr_inline(&t2, &tW);
+	gf4_add(&t1, &tW, &tZ);
+	gf4_sqr_inline(&tZ, &tZ);
+	gf4_sqr_inline(&t1, &t1);
+	gf4_mul2(&tX, &tX);
+	gf4_sub2(&P3->U, &t1, &t2, &tZ);
+	gf4_mul8(&tZ, &tZ);
+	gf4_neg(&P3->X, &tZ);
+	P3->Z = t2;
+	gf4_sub(&P3->T, &tX, &t2);
+}
+
+/*
+ * Repeated doublings in fractional (x,u) coordinates (n >= 1; see
+ * CURVE_double_x_xu()).
+ */
+static void
+double_x_xu4(CN(point4_xu) *P3, const CN(point4_xu) *P1, unsigned n)
+{
+	gf4 tX, tW, tZ, t1, t2;
+
+	STATS_ADD(point_double, 4 * (uint64_t)n);
+
+	/*
+	 * X' = Z^2*T^4
+	 * W' = Z*T^2 - 2*X*U^2
+	 * Z' = Z*U*T
+	 */
+	gf4_sqr_inline(&tW, &P1->U);
+	gf4_mul_inline(&t1, &P1->Z, &P1->T);
+	gf4_mul2(&tW, &tW);
+	gf4_mul_inline(&t2, &t1, &P1->T);
+	gf4_mul_inline(&tW, &tW, &P1->X);
+	gf4_sqr_inline(&tX, &t2);
+	gf4_sub(&tW, &t2, &tW);
+	gf4_mul_inline(&tZ, &t1, &P1->U);
+
+	while (n -- > 1) {
+		/*
+		 * X' = W^4
+		 * W' = W^2 - 2*X
+		 * Z' = 2*W*Z
+		 */
+		gf4_sqr_inline(&t1, &tW);
+		gf4_mul2(&t2, &tX);
+		gf4_mul_inline(&tZ, &tW, &tZ);
+		gf4_sub(&tW, &t1, &t2);
+		gf4_sqr_inline(&tX, &t1);
+		gf4_mul2(&tZ, &tZ);
+
+		/*
+		 * X'' = W'^4
+		 * W'' = W'^2 - 2*X'
+		 * Z'' = W'*Z'
+		 */
+		gf4_sqr_inline(&t1, &tW);
+		gf4_mul2(&t2, &tX);
+		gf4_mul_inline(&tZ, &tW, &tZ);
+		gf4_sub(&tW, &t1, &t2);
+		gf4_sqr_inline(&tX, &t1);
+	}
+
+	/*
+	 * X3 = -8*Z^2
+	 * Z3 = W^2
+	 * U3 = 2*W*Z
+	 * T3 = 2*X - W^2
+	 */
+	gf4_sqr_inline(&t2, &tW);
+	gf4_add(&t1, &tW, &tZ);
+	gf4_sqr_inline(&tZ, &tZ);
+	gf4_sqr_inline(&t1, &t1);
+	gf4_mul2(&tX, &tX);
+	gf4_sub2(&P3->U, &t1, &t2, &tZ);
+	gf4_mul8(&tZ, &tZ);
+	gf4_neg(&P3->X, &tZ);
+	P3->Z = t2;
+	gf4_sub(&P3->T, &tX, &t2);
+}
+
+/*
+ * Point addition in fractional (x,u) coordinates (see CURVE_add_xu()).
+ */
+static void
+add_xu4(CN(point4_xu) *P3, const CN(point4_xu) *P1, const CN(point4_xu) *P2)
+{
+	gf4 t1, t2, t3, t4, t5, t6, t7, t8, t9, t10;
+
+	STATS_ADD(point_add, 4);
+
+	gf4_mul_inline(&t1, &P1->X, &P2->X);
+	gf4_mul_inline(&t2, &P1->Z, &P2->Z);
+	gf4_mul_inline(&t3, &P1->U, &P2->U);
+	gf4_mul_inline(&t4, &P1->T, &P2->T);
+
+	gf4_add(&t5, &P1->X, &P1->Z);
+	gf4_add(&t8, &P2->X, &P2->Z);
+	gf4_mul_inline(&t5, &t5, &t8);
+	gf4_sub2(&t5, &t5, &t1, &t2);
+
+	gf4_add(&t6, &P1->U, &P1->T);
+	gf4_add(&t9, &P2->U, &P2->T);
+	gf4_mul_inline(&t6, &t6, &t9);
+	gf4_sub2(&t6, &t6, &t3, &t4);
+
+	gf4_sub2(&t7, &t1, &t2, &t2);
+	gf4_mul_inline(&t8, &t4, &t7);
+
+	gf4_mul_inline(&t9, &t3, &t5);
+	gf4_mul4(&t9, &t9);
+	gf4_neg(&t9, &t9);
+
+	gf4_add(&t5, &t5, &t7);
+	gf4_mul2(&t3, &t3);
+	gf4_add(&t3, &t3, &t4);
+	gf4_mul_inline(&t10, &t3, &t5);
+
+	gf4_neg(&t6, &t6);
+	gf4_mul2(&t2, &t2);
+	gf4_add(&t1, &t1, &t2);
+	gf4_mul_inline(&P3->U, &t6, &t1);
+
+	gf4_sub(&P3->Z, &t8, &t9);
+	gf4_add(&P3->T, &t8, &t9);
+
+	gf4_sub(&t8, &t8, &t10);
+	gf4_mul2(&t8, &t8);
+	gf4_sub(&P3->X, &t8, &t9);
+}
+
+/*
+ * Mixed addition in fractional (x,u) coordinates (see
+ * CURVE_add_mixed_xu()).
+ */
+static void
+add_mixed_xu4(CN(point4_xu) *P3,
+	const CN(point4_xu) *P1, const CN(point4_affine_xu) *P2)
+{
+	gf4 t1, t3, t5, t6, t7, t8, t9, t10;
+
+	STATS_ADD(point_add_mixed, 4);
+
+	gf4_mul_inline(&t1, &P1->X, &P2->X);
+	gf4_mul_inline(&t3, &P1->U, &P2->U);
+
+	gf4_mul_inline(&t5, &P1->Z, &P2->X);
+	gf4_add(&t5, &t5, &P1->X);
+
+	gf4_mul_inline(&t6, &P1->T, &P2->U);
+	gf4_add(&t6, &t6, &P1->U);
+
+	gf4_sub2(&t7, &t1, &P1->Z, &P1->Z);
+	gf4_mul_inline(&t8, &P1->T, &t7);
+
+	gf4_mul_inline(&t9, &t3, &t5);
+	gf4_mul4(&t9, &t9);
+	gf4_neg(&t9, &t9);
+
+	gf4_add(&t5, &t5, &t7);
+	gf4_mul2(&t3, &t3);
+	gf4_add(&t3, &t3, &P1->T);
+	gf4_mul_inline(&t10, &t3, &t5);
+
+	gf4_neg(&t6, &t6);
+	gf4_add(&t1, &t1, &P1->Z);
+	gf4_add(&t1, &t1, &P1->Z);
+	gf4_mul_inline(&P3->U, &t6, &t1);
+
+	gf4_sub(&P3->Z, &t8, &t9);
+	gf4_add(&P3->T, &t8, &t9);
+
+	gf4_sub(&t8, &t8, &t10);
+	gf4_mul2(&t8, &t8);
+	gf4_sub(&P3->X, &t8, &t9);
+}
+
+/*
+ * Lookup an affine point among 16 values (constant-time), separately
+ * in each lane; index[] contains the four lookup indices (0 to 16).
+ * If an index is 0, then the corresponding lane is set to the neutral
+ * (0,0); otherwise, it is set to the value at position index-1 in the
+ * window.
+ */
+static void
+window_lookup_16_affine_xu4(CN(point4_affine_xu) *P,
+	const CN(point4_affine_xu) *win, __m256i index)
+{
+	int i, u;
+
+	STATS_ADD(window_lookup, 4);
+
+	for (i = 0; i < 10; i ++) {
+		P->X.v[i] = _mm256_setzero_si256();
+		P->U.v[i] = _mm256_setzero_si256();
+	}
+	for (u = 0; u < 16; u ++) {
+		__m256i m;
+
+		m = _mm256_cmpeq_epi64(index, _mm256_set1_epi64x(u + 1));
+		for (i = 0; i < 10; i ++) {
+			P->X.v[i] = _mm256_or_si256(P->X.v[i],
+				_mm256_and_si256(m, win[u].X.v[i]));
+			P->U.v[i] = _mm256_or_si256(P->U.v[i],
+				_mm256_and_si256(m, win[u].U.v[i]));
+		}
+	}
+}
+
+/*
+ * Get the lookup indices and negation masks for four digits
+ * (sign+mantissa format).
+ */
+static inline void
+digits4(__m256i *index, __m256i *neg,
+	unsigned d0, unsigned d1, unsigned d2, unsigned d3)
+{
+	*index = _mm256_setr_epi64x(d0 & 31, d1 & 31, d2 & 31, d3 & 31);
+	*neg = _mm256_setr_epi64x(-(int64_t)(d0 >> 7), -(int64_t)(d1 >> 7),
+		-(int64_t)(d2 >> 7), -(int64_t)(d3 >> 7));
+}
+
+/*
+ * Set P3[0..3] to the four points in P, converted back to Jacobian
+ * (x,w) coordinates:
+ *   X3 = X*Z*U^2
+ *   W3 = Z*T   (necessarily non-zero)
+ *   Z3 = Z*U
+ */
+static void
+store_xu4(CN(point) *P3, const CN(point4_xu) *P)
+{
+	gf4 X, W, Z;
+
+	gf4_mul_inline(&X, &P->X, &P->U);
+	gf4_mul_inline(&W, &P->Z, &P->T);
+	gf4_mul_inline(&Z, &P->Z, &P->U);
+	gf4_mul_inline(&X, &X, &Z);
+	gf4_get(&P3[0].X.w64, &P3[1].X.w64, &P3[2].X.w64, &P3[3].X.w64, &X);
+	gf4_get(&P3[0].W.w64, &P3[1].W.w64, &P3[2].W.w64, &P3[3].W.w64, &W);
+	gf4_get(&P3[0].Z.w64, &P3[1].Z.w64, &P3[2].Z.w64, &P3[3].Z.w64, &Z);
+}
+
+/* see do255.h */
+void
+CN(mul_x4)(CN(point) *P3, const CN(point) *P1, const void *scalars)
+{
+	CN(point4_xu) tw[16], P;
+	CN(point4_affine_xu) win0[16], win1[16], Qa;
+	gf4 zt[16], mz[16], iz, eta;
+	gf X[4], Z[4], U[4], T[4];
+	uint8_t sd0[4][26], sd1[4][26];
+	uint64_t sg0[4], sg1[4];
+	__m256i index, neg, ms;
+	int i, j;
+
+	/*
+	 * Split and recode the scalars. Each source point is converted
+	 * to fractional (x,u) coordinates, and negated if k0 is negative:
+	 *   (X:W:Z) -> (X:Z^2:Z:W)
+	 * For the neutral point (0:W:0), we get (0:0:0:W), which we fix
+	 * by setting the second coordinate to 1.
+	 */
+	for (j = 0; j < 4; j ++) {
+		i128 k0, k1;
+
+		split_scalar(&k0, &k1, (const uint8_t *)scalars + 32 * j);
+		sg0[j] = recode5_small(sd0[j], &k0);
+		sg1[j] = sg0[j] ^ recode5_small(sd1[j], &k1);
+		X[j] = P1[j].X.w64;
+		gf_sqr(&Z[j], &P1[j].Z.w64);
+		gf_sel2(&Z[j], &GF_ONE, &Z[j], gf_iszero(&P1[j].Z.w64));
+		gf_condneg(&U[j], &P1[j].Z.w64, sg0[j]);
+		T[j] = P1[j].W.w64;
+	}
+	gf4_set(&tw[0].X, &X[0], &X[1], &X[2], &X[3]);
+	gf4_set(&tw[0].Z, &Z[0], &Z[1], &Z[2], &Z[3]);
+	gf4_set(&tw[0].U, &U[0], &U[1], &U[2], &U[3]);
+	gf4_set(&tw[0].T, &T[0], &T[1], &T[2], &T[3]);
+
+	/*
+	 * Compute the window (multiples 1 to 16 of the points) in
+	 * fractional coordinates.
+	 */
+	double_xu4(&tw[1], &tw[0]);
+	for (i = 3; i <= 15; i += 2) {
+		add_xu4(&tw[i - 1], &tw[i - 2], &tw[0]);
+		double_xu4(&tw[i], &tw[i >> 1]);
+	}
+
+	/*
+	 * Normalize the window to affine coordinates, with a single
+	 * inversion per lane:
+	 *   x = X/Z = X*T/(Z*T)
+	 *   u = U/T = U*Z/(Z*T)
+	 * Z and T are never zero in fractional (x,u) coordinates.
+	 */
+	for (i = 0; i < 16; i ++) {
+		gf4_mul_inline(&zt[i], &tw[i].Z, &tw[i].T);
+	}
+	mz[0] = zt[0];
+	for (i = 1; i < 16; i ++) {
+		gf4_mul_inline(&mz[i], &mz[i - 1], &zt[i]);
+	}
+	gf4_inv(&iz, &mz[15]);
+	for (i = 15; i >= 0; i --) {
+		gf4 t;
+
+		if (i > 0) {
+			gf4_mul_inline(&t, &iz, &mz[i - 1]);
+			gf4_mul_inline(&iz, &iz, &zt[i]);
+		} else {
+			t = iz;
+		}
+		gf4_mul_inline(&win0[i].X, &tw[i].X, &tw[i].T);
+		gf4_mul_inline(&win0[i].X, &win0[i].X, &t);
+		gf4_mul_inline(&win0[i].U, &tw[i].U, &tw[i].Z);
+		gf4_mul_inline(&win0[i].U, &win0[i].U, &t);
+	}
+
+	/*
+	 * Second window: apply the endomorphism (x,u) -> (-x,u*eta),
+	 * and negate the points in lanes where k0 and k1 have distinct
+	 * signs.
+	 */
+	gf4_set1(&eta, &ETA);
+	ms = _mm256_setr_epi64x(-(int64_t)sg1[0], -(int64_t)sg1[1],
+		-(int64_t)sg1[2], -(int64_t)sg1[3]);
+	for (i = 0; i < 16; i ++) {
+		gf4_neg(&win1[i].X, &win0[i].X);
+		gf4_mul_inline(&win1[i].U, &win0[i].U, &eta);
+		gf4_condneg(&win1[i].U, &win1[i].U, ms);
+	}
+
+	/*
+	 * Top digits are nonnegative. A looked-up neutral is (0,0) in
+	 * affine coordinates, which is (0:1:0:1) in fractional
+	 * coordinates.
+	 */
+	digits4(&index, &neg, sd0[0][25], sd0[1][25], sd0[2][25], sd0[3][25]);
+	window_lookup_16_affine_xu4(&Qa, win0, index);
+	P.X = Qa.X;
+	P.U = Qa.U;
+	gf4_set1(&P.Z, &GF_ONE);
+	P.T = P.Z;
+	digits4(&index, &neg, sd1[0][25], sd1[1][25], sd1[2][25], sd1[3][25]);
+	window_lookup_16_affine_xu4(&Qa, win1, index);
+	add_mixed_xu4(&P, &P, &Qa);
+
+	for (i = 24; i >= 0; i --) {
+		double_x_xu4(&P, &P, 5);
+		digits4(&index, &neg,
+			sd0[0][i], sd0[1][i], sd0[2][i], sd0[3][i]);
+		window_lookup_16_affine_xu4(&Qa, win0, index);
+		gf4_condneg(&Qa.U, &Qa.U, neg);
+		add_mixed_xu4(&P, &P, &Qa);
+		digits4(&index, &neg,
+			sd1[0][i], sd1[1][i], sd1[2][i], sd1[3][i]);
+		window_lookup_16_affine_xu4(&Qa, win1, index);
+		gf4_condneg(&Qa.U, &Qa.U, neg);
+		add_mixed_xu4(&P, &P, &Qa);
+	}
+
+	store_xu4(P3, &P);
+}
+
+/*
+ * Lookup a point in a precomputed window of multiples of the generator,
+ * with one digit per lane (constant-time); the point is negated in
+ * lanes where the digit is negative.
+ */
+static void
+window_lookup_gen4(CN(point4_affine_xu) *Qa,
+	const CN(point_affine_xu) *win, const uint8_t *d)
+{
+	CN(point_affine_xu) q[4];
+	__m256i index, neg;
+	int j;
+
+	for (j = 0; j < 4; j ++) {
+		window_lookup_16_affine_xu(&q[j], win, d[j] & 31);
+	}
+	gf4_set(&Qa->X, &q[0].X.w64, &q[1].X.w64, &q[2].X.w64, &q[3].X.w64);
+	gf4_set(&Qa->U, &q[0].U.w64, &q[1].U.w64, &q[2].U.w64, &q[3].U.w64);
+	digits4(&index, &neg, d[0], d[1], d[2], d[3]);
+	gf4_condneg(&Qa->U, &Qa->U, neg);
+}
+
+/* see do255.h */
+void
+CN(mulgen_x4)(CN(point) *P3, const void *scalars)
+{
+	CN(point4_xu) P;
+	CN(point4_affine_xu) Qa;
+	uint8_t sd[52][4], t[52];
+	int i, j;
+
+	/*
+	 * Recode the scalars; digits are transposed so that the four
+	 * digits with the same index are consecutive.
+	 */
+	for (j = 0; j < 4; j ++) {
+		recode5(t, (const uint8_t *)scalars + 32 * j);
+		for (i = 0; i < 52; i ++) {
+			sd[i][j] = t[i];
+		}
+	}
+
+	/*
+	 * Same process as CURVE_mulgen(); top digit is nonnegative.
+	 */
+	window_lookup_gen4(&Qa, window_G195_xu, sd[51]);
+	P.X = Qa.X;
+	P.U = Qa.U;
+	gf4_set1(&P.Z, &GF_ONE);
+	P.T = P.Z;
+	window_lookup_gen4(&Qa, window_G_xu, sd[12]);
+	add_mixed_xu4(&P, &P, &Qa);
+	window_lookup_gen4(&Qa, window_G65_xu, sd[25]);
+	add_mixed_xu4(&P, &P, &Qa);
+	window_lookup_gen4(&Qa, window_G130_xu, sd[38]);
+	add_mixed_xu4(&P, &P, &Qa);
+
+	for (i = 11; i >= 0; i --) {
+		double_x_xu4(&P, &P, 5);
+		window_lookup_gen4(&Qa, window_G_xu, sd[i]);
+		add_mixed_xu4(&P, &P, &Qa);
+		window_lookup_gen4(&Qa, window_G65_xu, sd[i + 13]);
+		add_mixed_xu4(&P, &P, &Qa);
+		window_lookup_gen4(&Qa, window_G130_xu, sd[i + 26]);
+		add_mixed_xu4(&P, &P, &Qa);
+		window_lookup_gen4(&Qa, window_G195_xu, sd[i + 39]);
+		add_mixed_xu4(&P, &P, &Qa);
+	}
+
+	store_xu4(P3, &P);
+}
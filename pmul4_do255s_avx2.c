@@ -0,0 +1,436 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined gf4 and operations (gf_avx2.c)
+ *  - defined curve basic operations, additions, multiplications
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_mul_x4() and CURVE_mulgen_x4() for curve
+ * do255s, with AVX2 opcodes: the four point multiplications are
+ * performed in parallel, one per 64-bit lane. Jacobian (x,w)
+ * coordinates are used, with the same formulas as the 64-bit code.
+ */
+
+/*
+ * Four points in Jacobian (x,w) coordinates, and in affine coordinates
+ * (affine point (0,0) is the neutral).
+ */
+typedef struct {
+	gf4 X, W, Z;
+} CN(point4);
+typedef struct {
+	gf4 X, W;
+} CN(point4_affine);
+
+/*
+ * Point doubling (see CURVE_double()).
+ */
+static void
+double4(CN(point4) *P3, const CN(point4) *P1)
+{
+	gf4 t1, t2, t3, t4, t5, t6, t7, t8, t9;
+
+	STATS_ADD(point_double, 4);
+
+	/* t1 <- W*Z */
+	gf4_mul_inline(&t1, &P1->W, &P1->Z);
+
+	/* t2 <- t1^2 */
+	gf4_sqr_inline(&t2, &t1);
+
+	/* t3 <- (W + Z)^2 - 2*t1 */
+	gf4_add(&t3, &P1->W, &P1->Z);
+	gf4_mul2(&t9, &t1);
+	gf4_sqr_inline(&t3, &t3);
+	gf4_sub(&t3, &t3, &t9);
+
+	/* Z' <- 2*t1*(2*X - t3) */
+	gf4_mul2(&t4, &P1->X);
+	gf4_sub(&t4, &t4, &t3);
+	gf4_mul2(&t5, &t1);
+	gf4_mul_inline(&P3->Z, &t4, &t5);
+
+	/* W' <- 2*t2 - t3^2 */
+	gf4_sqr_inline(&t6, &t3);
+	gf4_mul2(&t7, &t2);
+	gf4_sub(&P3->W, &t7, &t6);
+
+	/* X' <- 8*t2^2 */
+	gf4_sqr_inline(&t8, &t2);
+	gf4_mul8(&P3->X, &t8);
+}
+
+/*
+ * Point addition (see CURVE_add()). Masks fz1 and fz2 identify the
+ * lanes where P1 and P2 (respectively) are the neutral. Value half
+ * is 1/2 in all lanes.
+ */
+static void
+add4(CN(point4) *P3, const CN(point4) *P1, const CN(point4) *P2,
+	__m256i fz1, __m256i fz2, const gf4 *half)
+{
+	gf4 t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, X3, W3, Z3;
+
+	STATS_ADD(point_add, 4);
+
+	gf4_sqr_inline(&t1, &P1->Z);
+	gf4_sqr_inline(&t2, &P2->Z);
+
+	gf4_add(&t3, &P1->Z, &P2->Z);
+	gf4_sqr_inline(&t3, &t3);
+	gf4_sub2(&t3, &t3, &t1, &t2);
+	gf4_mul_inline(&t3, &t3, half);
+
+	gf4_sqr_inline(&t4, &t3);
+	gf4_mul_inline(&t5, &P1->W, &P2->W);
+	gf4_mul_inline(&t6, &P1->X, &P2->X);
+
+	gf4_add(&t7, &P1->W, &P1->Z);
+	gf4_add(&t8, &P2->W, &P2->Z);
+	gf4_mul_inline(&t7, &t7, &t8);
+	gf4_sub2(&t7, &t7, &t3, &t5);
+
+	gf4_add(&t8, &P1->X, &t1);
+	gf4_add(&t9, &P2->X, &t2);
+	gf4_mul_inline(&t8, &t8, &t9);
+	gf4_sub2(&t8, &t8, &t4, &t6);
+
+	gf4_mul_inline(&t4, &t4, half);
+	gf4_sub(&t9, &t6, &t4);
+	gf4_mul_inline(&Z3, &t9, &t7);
+
+	gf4_sqr_inline(&t9, &t7);
+	gf4_sqr_inline(&t9, &t9);
+
+	gf4_mul_inline(&X3, &t6, &t9);
+	gf4_mul_inline(&X3, &X3, half);
+
+	gf4_sub(&t5, &t5, &t3);
+	gf4_add(&t6, &t6, &t4);
+	gf4_mul_inline(&t10, &t5, &t6);
+
+	gf4_mul_inline(&t8, &t3, &t8);
+	gf4_add(&t8, &t8, &t10);
+	gf4_neg(&W3, &t8);
+
+	/*
+	 * If P1 is neutral, replace P3 with P2.
+	 * If P2 is neutral, replace P3 with P1.
+	 */
+	gf4_sel(&X3, &P1->X, &X3, fz2);
+	gf4_sel(&W3, &P1->W, &W3, fz2);
+	gf4_sel(&Z3, &P1->Z, &Z3, fz2);
+	gf4_sel(&P3->X, &P2->X, &X3, fz1);
+	gf4_sel(&P3->W, &P2->W, &W3, fz1);
+	gf4_sel(&P3->Z, &P2->Z, &Z3, fz1);
+}
+
+/*
+ * Mixed addition (see CURVE_add_mixed()). Mask fz2 identifies the
+ * lanes where P2 is the neutral. Value half is 1/2 in all lanes.
+ */
+static void
+add_mixed4(CN(point4) *P3, const CN(point4) *P1,
+	const CN(point4_affine) *P2, __m256i fz2, const gf4 *half)
+{
+	gf4 t1, t5, t6, t7, t8, t9, t10, t11, X3, W3, Z3, one;
+	__m256i fz1;
+
+	STATS_ADD(point_add_mixed, 4);
+
+	fz1 = gf4_iszero(&P1->X);
+
+	gf4_sqr_inline(&t1, &P1->Z);
+	gf4_mul_inline(&t5, &P1->W, &P2->W);
+	gf4_mul_inline(&t6, &P1->X, &P2->X);
+
+	gf4_mul_inline(&t7, &P1->Z, &P2->W);
+	gf4_add(&t7, &t7, &P1->W);
+
+	gf4_mul_inline(&t8, &t1, &P2->X);
+	gf4_add(&t8, &t8, &P1->X);
+
+	gf4_mul_inline(&t1, &t1, half);
+	gf4_sub(&t11, &t6, &t1);
+	gf4_mul_inline(&Z3, &t11, &t7);
+
+	gf4_sqr_inline(&t9, &t7);
+	gf4_sqr_inline(&t9, &t9);
+
+	gf4_mul_inline(&X3, &t6, &t9);
+	gf4_mul_inline(&X3, &X3, half);
+
+	gf4_sub(&t5, &t5, &P1->Z);
+	gf4_add(&t6, &t6, &t1);
+	gf4_mul_inline(&t10, &t5, &t6);
+
+	gf4_mul_inline(&t8, &P1->Z, &t8);
+	gf4_add(&t8, &t8, &t10);
+	gf4_neg(&W3, &t8);
+
+	/*
+	 * If P1 is neutral, replace P3 with P2 (with Z = 1).
+	 * If P2 is neutral, replace P3 with P1.
+	 * If both are neutral, we use P1.
+	 */
+	gf4_set1(&one, &GF_ONE);
+	gf4_sel(&X3, &P2->X, &X3, fz1);
+	gf4_sel(&W3, &P2->W, &W3, fz1);
+	gf4_sel(&Z3, &one, &Z3, fz1);
+	gf4_sel(&P3->X, &P1->X, &X3, fz2);
+	gf4_sel(&P3->W, &P1->W, &W3, fz2);
+	gf4_sel(&P3->Z, &P1->Z, &Z3, fz2);
+}
+
+/*
+ * Lookup an affine point among 16 values (constant-time), separately
+ * in each lane; index[] contains the four lookup indices (0 to 16).
+ * If an index is 0, then the corresponding lane is set to the neutral
+ * (0,0); otherwise, it is set to the value at position index-1 in the
+ * window.
+ */
+static void
+window_lookup_16_affine4(CN(point4_affine) *P,
+	const CN(point4_affine) *win, __m256i index)
+{
+	int i, u;
+
+	STATS_ADD(window_lookup, 4);
+
+	for (i = 0; i < 10; i ++) {
+		P->X.v[i] = _mm256_setzero_si256();
+		P->W.v[i] = _mm256_setzero_si256();
+	}
+	for (u = 0; u < 16; u ++) {
+		__m256i m;
+
+		m = _mm256_cmpeq_epi64(index, _mm256_set1_epi64x(u + 1));
+		for (i = 0; i < 10; i ++) {
+			P->X.v[i] = _mm256_or_si256(P->X.v[i],
+				_mm256_and_si256(m, win[u].X.v[i]));
+			P->W.v[i] = _mm256_or_si256(P->W.v[i],
+				_mm256_and_si256(m, win[u].W.v[i]));
+		}
+	}
+}
+
+/*
+ * Get the lookup indices and negation masks for four digits
+ * (sign+mantissa format).
+ */
+static inline void
+digits4(__m256i *index, __m256i *neg, const uint8_t *d)
+{
+	*index = _mm256_setr_epi64x(
+		d[0] & 31, d[1] & 31, d[2] & 31, d[3] & 31);
+	*neg = _mm256_setr_epi64x(
+		-(int64_t)(d[0] >> 7), -(int64_t)(d[1] >> 7),
+		-(int64_t)(d[2] >> 7), -(int64_t)(d[3] >> 7));
+}
+
+/*
+ * Set P to the looked-up affine points Qa; in lanes where the index
+ * is zero, this yields the neutral (0:1:0).
+ */
+static void
+set_affine4(CN(point4) *P, const CN(point4_affine) *Qa, __m256i qz)
+{
+	gf4 zero, one;
+
+	gf4_set1(&zero, &GF_ZERO);
+	gf4_set1(&one, &GF_ONE);
+	P->X = Qa->X;
+	gf4_sel(&P->W, &one, &Qa->W, qz);
+	gf4_sel(&P->Z, &zero, &one, qz);
+}
+
+/*
+ * Recode four scalars; digits are transposed so that the four digits
+ * with the same index are consecutive.
+ */
+static void
+recode5_x4(uint8_t sd[52][4], const void *scalars)
+{
+	uint8_t t[52];
+	int i, j;
+
+	for (j = 0; j < 4; j ++) {
+		recode5(t, (const uint8_t *)scalars + 32 * j);
+		for (i = 0; i < 52; i ++) {
+			sd[i][j] = t[i];
+		}
+	}
+}
+
+/*
+ * Set P3[0..3] to the four points in P.
+ */
+static void
+store4(CN(point) *P3, const CN(point4) *P)
+{
+	gf4_get(&P3[0].X.w64, &P3[1].X.w64, &P3[2].X.w64, &P3[3].X.w64,
+		&P->X);
+	gf4_get(&P3[0].W.w64, &P3[1].W.w64, &P3[2].W.w64, &P3[3].W.w64,
+		&P->W);
+	gf4_get(&P3[0].Z.w64, &P3[1].Z.w64, &P3[2].Z.w64, &P3[3].Z.w64,
+		&P->Z);
+}
+
+/* see do255.h */
+void
+CN(mul_x4)(CN(point) *P3, const CN(point) *P1, const void *scalars)
+{
+	CN(point4) tw[16], P;
+	CN(point4_affine) win[16], Qa;
+	gf4 mz[16], iz, half;
+	gf hh;
+	uint8_t sd[52][4];
+	__m256i pn, index, neg;
+	int i;
+
+	recode5_x4(sd, scalars);
+	gf_half(&hh, &GF_ONE);
+	gf4_set1(&half, &hh);
+
+	/*
+	 * Compute the window (multiples 1 to 16 of the points). Mask pn
+	 * identifies the lanes where the source point is the neutral;
+	 * all its multiples are then neutral as well.
+	 */
+	gf4_set(&tw[0].X, &P1[0].X.w64, &P1[1].X.w64,
+		&P1[2].X.w64, &P1[3].X.w64);
+	gf4_set(&tw[0].W, &P1[0].W.w64, &P1[1].W.w64,
+		&P1[2].W.w64, &P1[3].W.w64);
+	gf4_set(&tw[0].Z, &P1[0].Z.w64, &P1[1].Z.w64,
+		&P1[2].Z.w64, &P1[3].Z.w64);
+	pn = gf4_iszero(&tw[0].Z);
+	double4(&tw[1], &tw[0]);
+	for (i = 3; i <= 15; i += 2) {
+		add4(&tw[i - 1], &tw[i - 2], &tw[0], pn, pn, &half);
+		double4(&tw[i], &tw[i >> 1]);
+	}
+
+	/*
+	 * Normalize the window to affine coordinates, with a single
+	 * inversion per lane. In lanes where the source point is the
+	 * neutral, all Z coordinates are zero, and we get (0,0) for
+	 * all window points, which is the affine neutral.
+	 */
+	mz[0] = tw[0].Z;
+	for (i = 1; i < 16; i ++) {
+		gf4_mul_inline(&mz[i], &mz[i - 1], &tw[i].Z);
+	}
+	gf4_inv(&iz, &mz[15]);
+	for (i = 15; i >= 0; i --) {
+		gf4 t;
+
+		if (i > 0) {
+			gf4_mul_inline(&t, &iz, &mz[i - 1]);
+			gf4_mul_inline(&iz, &iz, &tw[i].Z);
+		} else {
+			t = iz;
+		}
+		gf4_mul_inline(&win[i].W, &tw[i].W, &t);
+		gf4_sqr_inline(&t, &t);
+		gf4_mul_inline(&win[i].X, &tw[i].X, &t);
+	}
+
+	/*
+	 * Top digit is nonnegative, but it can be 0.
+	 */
+	digits4(&index, &neg, sd[51]);
+	window_lookup_16_affine4(&Qa, win, index);
+	set_affine4(&P, &Qa, _mm256_or_si256(pn,
+		_mm256_cmpeq_epi64(index, _mm256_setzero_si256())));
+
+	for (i = 50; i >= 0; i --) {
+		int k;
+
+		for (k = 0; k < 5; k ++) {
+			double4(&P, &P);
+		}
+		digits4(&index, &neg, sd[i]);
+		window_lookup_16_affine4(&Qa, win, index);
+		gf4_condneg(&Qa.W, &Qa.W, neg);
+		add_mixed4(&P, &P, &Qa, _mm256_or_si256(pn,
+			_mm256_cmpeq_epi64(index, _mm256_setzero_si256())),
+			&half);
+	}
+
+	store4(P3, &P);
+}
+
+/*
+ * Lookup a point in a precomputed window of multiples of the generator,
+ * with one digit per lane (constant-time); the point is negated in
+ * lanes where the digit is negative. Returned value is the mask of
+ * lanes where the digit is zero (the looked-up point is the neutral).
+ */
+static __m256i
+window_lookup_gen4(CN(point4_affine) *Qa,
+	const CN(point_affine) *win, const uint8_t *d)
+{
+	CN(point_affine) q[4];
+	__m256i index, neg;
+	int j;
+
+	for (j = 0; j < 4; j ++) {
+		window_lookup_16_affine(&q[j], win, d[j] & 31);
+	}
+	gf4_set(&Qa->X, &q[0].X.w64, &q[1].X.w64, &q[2].X.w64, &q[3].X.w64);
+	gf4_set(&Qa->W, &q[0].W.w64, &q[1].W.w64, &q[2].W.w64, &q[3].W.w64);
+	digits4(&index, &neg, d);
+	gf4_condneg(&Qa->W, &Qa->W, neg);
+	return _mm256_cmpeq_epi64(index, _mm256_setzero_si256());
+}
+
+/* see do255.h */
+void
+CN(mulgen_x4)(CN(point) *P3, const void *scalars)
+{
+	CN(point4) P;
+	CN(point4_affine) Qa;
+	gf4 half;
+	gf hh;
+	uint8_t sd[52][4];
+	__m256i qz;
+	int i;
+
+	recode5_x4(sd, scalars);
+	gf_half(&hh, &GF_ONE);
+	gf4_set1(&half, &hh);
+
+	/*
+	 * Same process as CURVE_mulgen(); top digit is nonnegative, but
+	 * it may be zero.
+	 */
+	qz = window_lookup_gen4(&Qa, window_G195, sd[51]);
+	set_affine4(&P, &Qa, qz);
+	qz = window_lookup_gen4(&Qa, window_G, sd[12]);
+	add_mixed4(&P, &P, &Qa, qz, &half);
+	qz = window_lookup_gen4(&Qa, window_G65, sd[25]);
+	add_mixed4(&P, &P, &Qa, qz, &half);
+	qz = window_lookup_gen4(&Qa, window_G130, sd[38]);
+	add_mixed4(&P, &P, &Qa, qz, &half);
+
+	for (i = 11; i >= 0; i --) {
+		int k;
+
+		for (k = 0; k < 5; k ++) {
+			double4(&P, &P);
+		}
+		qz = window_lookup_gen4(&Qa, window_G, sd[i]);
+		add_mixed4(&P, &P, &Qa, qz, &half);
+		qz = window_lookup_gen4(&Qa, window_G65, sd[i + 13]);
+		add_mixed4(&P, &P, &Qa, qz, &half);
+		qz = window_lookup_gen4(&Qa, window_G130, sd[i + 26]);
+		add_mixed4(&P, &P, &Qa, qz, &half);
+		qz = window_lookup_gen4(&Qa, window_G195, sd[i + 39]);
+		add_mixed4(&P, &P, &Qa, qz, &half);
+	}
+
+	store4(P3, &P);
+}
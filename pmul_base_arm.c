@@ -11,8 +11,16 @@
  * This file implements CURVE_mulgen() with a 4-bit window, and support
  * functions for window creation and lookups. It is specific to ARM
  * platforms.
+ *
+ * The large generator tables (DO255_MULGEN_LARGE) are not supported
+ * here, since the window lookups are implemented in assembly for the
+ * fixed 8-point windows.
  */
 
+#if DO255_MULGEN_LARGE
+#error DO255_MULGEN_LARGE is not supported on ARM
+#endif
+
 /*
  * Lookup an affine point among 8 values (constant-time).
  * Lookup index is between 0 and 8 (inclusive). The provided array
@@ -99,6 +99,8 @@ window_lookup_8_affine(CN(point_affine) *P,
 {
 	uint32_t mf, u;
 
+	STATS_INC(window_lookup);
+
 	/*
 	 * Set mf to -1 if index == 0, 0 otherwise.
 	 */
@@ -177,6 +179,7 @@ recode4(uint8_t *sd, const void *scalar)
 	}
 }
 
+#if !DO255_MULGEN_LARGE
 /* see do255.h */
 void
 CN(mulgen)(CN(point) *P3, const void *scalar)
@@ -251,6 +254,7 @@ CN(mulgen)(CN(point) *P3, const void *scalar)
 	 */
 	*P3 = P;
 }
+#endif
 
 /*
  * NAF4 recoding, producing 'num' digits out of the provided 32-bit word.
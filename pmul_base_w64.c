@@ -9,8 +9,9 @@
  *  - defined CURVE to the curve name
  *
  * This file implements CURVE_mulgen() with a 5-bit window, and support
- * functions for window creation and lookups. It works with any finite
- * field implementation with 64-bit limbs.
+ * functions for window creation and lookups, batch normalization to
+ * affine coordinates, and scalar recoding (with 5-bit windows, and NAF).
+ * It works with any finite field implementation with 64-bit limbs.
  */
 
 /*
@@ -97,6 +98,8 @@ window_lookup_16_affine(CN(point_affine) *P,
 {
 	uint64_t mf, u;
 
+	STATS_INC(window_lookup);
+
 	/*
 	 * Set mf to -1 if index == 0, 0 otherwise.
 	 */
@@ -139,6 +142,175 @@ window_lookup_16_affine(CN(point_affine) *P,
 	}
 }
 
+/*
+ * Invert n field elements zz[i] in place, with a single inversion
+ * (Montgomery's trick); tmp[] must have room for n elements. If any of
+ * the elements is zero, then all output values are zero. If vartime is
+ * non-zero, then the variable-time inversion is used (public data only).
+ */
+FORCE_INLINE
+static inline void
+batch_inv_ext(gf *zz, gf *tmp, size_t n, int vartime)
+{
+	size_t j;
+
+	if (n == 0) {
+		return;
+	}
+	tmp[0] = zz[0];
+	for (j = 1; j < n; j ++) {
+		gf_mul(&tmp[j], &tmp[j - 1], &zz[j]);
+	}
+	if (vartime) {
+		gf_inv_vartime(&tmp[n - 1], &tmp[n - 1]);
+	} else {
+		gf_inv(&tmp[n - 1], &tmp[n - 1]);
+	}
+	for (j = n - 1; j >= 1; j --) {
+		gf zi;
+
+		gf_mul(&zi, &tmp[j], &tmp[j - 1]);
+		gf_mul(&tmp[j - 1], &tmp[j], &zz[j]);
+		zz[j] = zi;
+	}
+	zz[0] = tmp[0];
+}
+
+/*
+ * Constant-time batch inversion (see batch_inv_ext()).
+ */
+UNUSED
+static void
+batch_inv(gf *zz, gf *tmp, size_t n)
+{
+	batch_inv_ext(zz, tmp, n, 0);
+}
+
+/*
+ * Variable-time batch inversion (see batch_inv_ext()).
+ */
+UNUSED
+static void
+batch_inv_vartime(gf *zz, gf *tmp, size_t n)
+{
+	batch_inv_ext(zz, tmp, n, 1);
+}
+
+/*
+ * Normalize n points to affine coordinates, with a single inversion.
+ * On input, win[i] contains the X and W coordinates of the i-th point,
+ * and zz[i] its Z coordinate; tmp[] must have room for n elements.
+ * Contents of zz[] are destroyed. If any of the points is the neutral,
+ * then all output points are set to (0,0).
+ */
+UNUSED
+static void
+batch_affine(CN(point_affine) *win, gf *zz, gf *tmp, size_t n)
+{
+	size_t j;
+
+	batch_inv(zz, tmp, n);
+	for (j = 0; j < n; j ++) {
+		gf zi2;
+
+		gf_sqr(&zi2, &zz[j]);
+		gf_mul(&win[j].X.w64, &win[j].X.w64, &zi2);
+		gf_mul(&win[j].W.w64, &win[j].W.w64, &zz[j]);
+	}
+}
+
+/*
+ * Same as batch_affine(), but with a variable-time inversion (public
+ * data only).
+ */
+UNUSED
+static void
+batch_affine_vartime(CN(point_affine) *win, gf *zz, gf *tmp, size_t n)
+{
+	size_t j;
+
+	batch_inv_vartime(zz, tmp, n);
+	for (j = 0; j < n; j ++) {
+		gf zi2;
+
+		gf_sqr(&zi2, &zz[j]);
+		gf_mul(&win[j].X.w64, &win[j].X.w64, &zi2);
+		gf_mul(&win[j].W.w64, &win[j].W.w64, &zz[j]);
+	}
+}
+
+/*
+ * Fill win[16*j + i] with (i+1)*P[j] in affine coordinates, for
+ * i = 0..15 and j = 0..num-1. A single inversion is used for all points;
+ * zz[] and tmp[] must have room for 16*num elements each. Unlike
+ * batch_affine(), source points may be the neutral (the corresponding
+ * window is then filled with (0,0)). This function is constant-time.
+ */
+UNUSED
+static void
+window_fill_16_multi_affine(CN(point_affine) *win,
+	const CN(point) *P, size_t num, gf *zz, gf *tmp)
+{
+	CN(point) T;
+	size_t j;
+	int i;
+
+	/*
+	 * Compute point multiples. Since the group has prime order r,
+	 * multiples of a non-neutral point are non-neutral. For a
+	 * neutral point, we replace all Z coordinates with 1, so that
+	 * the shared inversion is not spoiled; the window contents are
+	 * cleared afterwards.
+	 */
+	for (j = 0; j < num; j ++) {
+		CN(point_affine) *w;
+		gf *z;
+		uint64_t nz;
+
+		w = win + 16 * j;
+		z = zz + 16 * j;
+		w[0].X = P[j].X;
+		w[0].W = P[j].W;
+		z[0] = P[j].Z.w64;
+		T = P[j];
+		for (i = 2; i <= 16; i ++) {
+			if ((i & 1) == 0) {
+				T.X = w[(i >> 1) - 1].X;
+				T.W = w[(i >> 1) - 1].W;
+				T.Z.w64 = z[(i >> 1) - 1];
+				CN(double)(&T, &T);
+			} else {
+				T.X = w[i - 2].X;
+				T.W = w[i - 2].W;
+				T.Z.w64 = z[i - 2];
+				CN(add)(&T, &T, &P[j]);
+			}
+			w[i - 1].X = T.X;
+			w[i - 1].W = T.W;
+			z[i - 1] = T.Z.w64;
+		}
+		nz = gf_iszero(&P[j].Z.w64);
+		for (i = 0; i < 16; i ++) {
+			gf_sel2(&z[i], &GF_ONE, &z[i], nz);
+		}
+	}
+
+	batch_affine(win, zz, tmp, 16 * num);
+
+	for (j = 0; j < num; j ++) {
+		uint64_t nz;
+
+		nz = gf_iszero(&P[j].Z.w64);
+		for (i = 0; i < 16; i ++) {
+			CN(point_affine) *w;
+
+			w = win + 16 * j + i;
+			gf_sel2(&w->X.w64, &GF_ZERO, &w->X.w64, nz);
+			gf_sel2(&w->W.w64, &GF_ZERO, &w->W.w64, nz);
+		}
+	}
+}
+
 /*
  * Scalar recoding with a 5-bit window: for a 256-bit scalar s, this
  * function computes a 52-digit integer such that all digits are in
@@ -196,3 +368,191 @@ recode5(uint8_t *sd, const uint8_t *s)
 	 */
 	sd[51] = (uint8_t)(acc + cc);
 }
+
+/*
+ * NAF recoding with width w (2 <= w <= 10), producing 'num' digits out
+ * of the provided 64-bit word. Output contains unprocessed bits, with
+ * carries added in. All non-zero digits are odd and in the
+ * -(2^(w-1)-1)..+(2^(w-1)-1) range.
+ */
+UNUSED
+static uint64_t
+recode_NAFw_word(int8_t *rc, uint64_t x, int num, unsigned w)
+{
+	int i;
+	uint64_t wm, wh;
+
+	wm = ((uint64_t)1 << w) - 1;
+	wh = (uint64_t)1 << (w - 1);
+	for (i = 0; i < num; i ++) {
+		/*
+		 * We use a branchless algorithm to avoid misprediction
+		 * penalties. Use of NAF is inherently non-constant-time.
+		 *
+		 * If x is even, then next digit is a zero.
+		 * Otherwise:
+		 *  - if the w low bits are in the 1..2^(w-1)-1 range, then
+		 *    this value is the next digit;
+		 *  - otherwise, the w low bits are in 2^(w-1)+1..2^w-1,
+		 *    and we subtract 2^w to make it a negative digit;
+		 *    this implies an extra +2^w to add to the x word
+		 *    (carry).
+		 *  Either way, the w low bits of x are then cleared.
+		 *
+		 * Since x is then even in all cases, we divide it by 2.
+		 */
+		uint64_t m, t, c;
+
+		m = -(uint64_t)(x & 1);
+		t = x & m & wm;
+		c = (t & wh) << 1;
+		x = (x - t) + c;
+		rc[i] = (int8_t)((int)t - (int)c);
+		x >>= 1;
+	}
+	return x;
+}
+
+/*
+ * NAF recoding with width w (2 <= w <= 10). Returned value is 1 on
+ * carry, 0 otherwise. A carry is returned if the computed digit encode
+ * a value which is 2^n lower (exactly) than the intended value, where n
+ * is the length of the scalar (in bits).
+ * This function is for a 256-bit scalar.
+ */
+UNUSED
+static uint64_t
+recode_NAFw_256(int8_t *rc, const i256 *c, unsigned w)
+{
+	uint64_t x;
+
+	/*
+	 * We need to leave a bit of room for carries and look-ahead, so we
+	 * must call recode_NAFw_word() five times. We use four 52-bit
+	 * chunks and one final 48-bit chunk.
+	 */
+	x = c->v0 & 0x000FFFFFFFFFFFFF;
+	x = recode_NAFw_word(rc, x, 52, w);
+	x += ((c->v0 >> 52) | (c->v1 << 12)) & 0x000FFFFFFFFFFFFF;
+	x = recode_NAFw_word(rc + 52, x, 52, w);
+	x += ((c->v1 >> 40) | (c->v2 << 24)) & 0x000FFFFFFFFFFFFF;
+	x = recode_NAFw_word(rc + 104, x, 52, w);
+	x += ((c->v2 >> 28) | (c->v3 << 36)) & 0x000FFFFFFFFFFFFF;
+	x = recode_NAFw_word(rc + 156, x, 52, w);
+	x += c->v3 >> 16;
+	x = recode_NAFw_word(rc + 208, x, 48, w);
+
+	return x;
+}
+
+/*
+ * NAF recoding with width w (2 <= w <= 10). Returned value is 1 on
+ * carry, 0 otherwise (see recode_NAFw_256()).
+ * This function is for a 128-bit scalar.
+ */
+UNUSED
+static uint64_t
+recode_NAFw_128(int8_t *rc, const i128 *c, unsigned w)
+{
+	uint64_t x;
+
+	/*
+	 * We need to leave a bit of room for carries and look-ahead, so we
+	 * must call recode_NAFw_word() three times. We use two 52-bit
+	 * chunks and one final 24-bit chunk.
+	 */
+	x = c->v0 & 0x000FFFFFFFFFFFFF;
+	x = recode_NAFw_word(rc, x, 52, w);
+	x += ((c->v0 >> 52) | (c->v1 << 12)) & 0x000FFFFFFFFFFFFF;
+	x = recode_NAFw_word(rc + 52, x, 52, w);
+	x += c->v1 >> 40;
+	x = recode_NAFw_word(rc + 104, x, 24, w);
+
+	return x;
+}
+
+/*
+ * NAF5 recoding (see recode_NAFw_256()), for a 256-bit scalar.
+ */
+UNUSED
+static uint64_t
+recode_NAF5_256(int8_t *rc, const i256 *c)
+{
+	return recode_NAFw_256(rc, c, 5);
+}
+
+/*
+ * NAF5 recoding (see recode_NAFw_128()), for a 128-bit scalar.
+ */
+UNUSED
+static uint64_t
+recode_NAF5_128(int8_t *rc, const i128 *c)
+{
+	return recode_NAFw_128(rc, c, 5);
+}
+
+/*
+ * Signed recoding of an unsigned integer (len bytes, little-endian) with
+ * c-bit windows (2 <= c <= 15). This function computes nw digits such
+ * that all digits are in the -2^(c-1)..+2^(c-1) range, and the integer
+ * is equal to \sum_i sd[i]*2^(c*i). The caller must ensure that c*nw is
+ * greater than the bit length of the integer.
+ */
+UNUSED
+static void
+recode_window_vartime(int16_t *sd, const uint8_t *s, size_t len,
+	unsigned c, size_t nw)
+{
+	uint64_t acc;
+	uint32_t m, h, cc;
+	unsigned acc_len;
+	size_t i, j;
+
+	acc = 0;
+	acc_len = 0;
+	j = 0;
+	cc = 0;
+	m = ((uint32_t)1 << c) - 1;
+	h = (uint32_t)1 << (c - 1);
+	for (i = 0; i < nw; i ++) {
+		uint32_t d;
+
+		while (acc_len < c && j < len) {
+			acc |= (uint64_t)s[j ++] << acc_len;
+			acc_len += 8;
+		}
+		d = ((uint32_t)acc & m) + cc;
+		acc >>= c;
+		acc_len = acc_len > c ? acc_len - c : 0;
+		cc = (d > h);
+		sd[i] = (int16_t)((int32_t)d - (int32_t)(cc << c));
+	}
+}
+
+/*
+ * Choose the window size for a Pippenger-style multi-scalar
+ * multiplication with n points and scalars of b bits. We estimate the
+ * cost as (number of windows)*(n + 2^c) point additions (n additions
+ * into buckets, and two additions per bucket for the aggregation), and
+ * return the value of c (2 to 15) which minimizes it.
+ */
+UNUSED
+static unsigned
+msm_window(size_t n, unsigned b)
+{
+	unsigned c, best_c;
+	uint64_t best_cost;
+
+	best_c = 2;
+	best_cost = (uint64_t)-1;
+	for (c = 2; c <= 15; c ++) {
+		uint64_t cost;
+
+		cost = (uint64_t)(b / c + 1) * ((uint64_t)n + ((uint64_t)1 << c));
+		if (cost < best_cost) {
+			best_cost = cost;
+			best_c = c;
+		}
+	}
+	return best_c;
+}
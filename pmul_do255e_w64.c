@@ -424,6 +424,8 @@ window_lookup_16(CN(point) *P, const CN(point) *win, size_t index)
 {
 	uint64_t mf, u;
 
+	STATS_INC(window_lookup);
+
 	/*
 	 * Set mf to -1 if index == 0, 0 otherwise.
 	 */
@@ -573,12 +575,15 @@ CN(mul)(CN(point) *P3, const CN(point) *P1, const void *scalar)
  * point Q. If the index is 0, this returns the neutral; otherwise,
  * this returns index*Q.
  */
+UNUSED
 static void
 window_lookup_16_affine_xu(CN(point_affine_xu) *P,
 	const CN(point_affine_xu) *win, size_t index)
 {
 	uint64_t mf, u;
 
+	STATS_INC(window_lookup);
+
 	/*
 	 * Set mf to -1 if index == 0, 0 otherwise.
 	 */
@@ -621,6 +626,7 @@ window_lookup_16_affine_xu(CN(point_affine_xu) *P,
 	}
 }
 
+#if !DO255_MULGEN_LARGE
 /* see do255.h */
 void
 CN(mulgen)(CN(point) *P3, const void *scalar)
@@ -707,3 +713,4 @@ CN(mulgen)(CN(point) *P3, const void *scalar)
 	gf_mul(&P3->Z.w64, &P.Z.w64, &P.U.w64);
 	gf_mul(&P3->X.w64, &P3->X.w64, &P3->Z.w64);
 }
+#endif
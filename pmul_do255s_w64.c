@@ -67,6 +67,7 @@ CN(mul)(CN(point) *P3, const CN(point) *P1, const void *scalar)
 	*P3 = P;
 }
 
+#if !DO255_MULGEN_LARGE
 /* see do255.h */
 void
 CN(mulgen)(CN(point) *P3, const void *scalar)
@@ -142,3 +143,4 @@ CN(mulgen)(CN(point) *P3, const void *scalar)
 	 */
 	*P3 = P;
 }
+#endif
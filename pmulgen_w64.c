@@ -0,0 +1,224 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations
+ *  - defined macros CURVE and CN()
+ *  - included the generated table file (gtab_CURVE_w64.c), which
+ *    defines MULGEN_WIN, MULGEN_CHUNKS, MULGEN_XU and window_G_comb[]
+ *
+ * This file implements CURVE_mulgen() with the large precomputed tables
+ * (option DO255_MULGEN_LARGE, see support.c). It works with any finite
+ * field implementation with 64-bit limbs.
+ *
+ * The scalar is recoded into MULGEN_DIGITS signed digits of MULGEN_WIN
+ * bits, which are split into MULGEN_CHUNKS chunks of MULGEN_LEN digits.
+ * For chunk j, the table contains i*2^(j*MULGEN_LEN*MULGEN_WIN)*G for
+ * i = 1 to 2^(MULGEN_WIN-1); the point multiplication is then a comb
+ * with (MULGEN_LEN-1)*MULGEN_WIN doublings and MULGEN_DIGITS mixed
+ * additions. If MULGEN_XU is non-zero, then the table points are in
+ * affine (x,u) coordinates, and the computation uses the (x,u) formulas;
+ * otherwise, (x,w) coordinates are used.
+ */
+
+#define MULGEN_DIGITS   ((257 + MULGEN_WIN - 1) / MULGEN_WIN)
+#define MULGEN_LEN      ((MULGEN_DIGITS + MULGEN_CHUNKS - 1) / MULGEN_CHUNKS)
+#define MULGEN_SIZE     (1u << (MULGEN_WIN - 1))
+
+#if MULGEN_XU
+typedef CN(point_xu) CN(mulgen_point);
+typedef CN(point_affine_xu) CN(mulgen_affine);
+#define MULGEN_Y          U
+#define mulgen_add        CN(add_mixed_xu)
+#define mulgen_double_x   CN(double_x_xu)
+#else
+typedef CN(point) CN(mulgen_point);
+typedef CN(point_affine) CN(mulgen_affine);
+#define MULGEN_Y          W
+#define mulgen_add        CN(add_mixed)
+#define mulgen_double_x   CN(double_x)
+#endif
+
+/*
+ * Scalar recoding with a MULGEN_WIN-bit window: for a 256-bit scalar s,
+ * this function computes MULGEN_DIGITS digits in the
+ * -(2^(w-1)-1)..+2^(w-1) range (with w = MULGEN_WIN), such that
+ * s = \sum_i d[i]*2^(w*i). The top digit is always nonnegative.
+ *
+ * Digits are encoded in sign+mantissa format: sign bit is bit 15 (1 for
+ * negative, 0 for positive).
+ */
+static void
+recode_comb(uint16_t *sd, const uint8_t *s)
+{
+	int i, k;
+	uint32_t cc, acc;
+	int acc_len;
+
+	acc = 0;
+	acc_len = 0;
+	cc = 0;
+	k = 0;
+	for (i = 0; i < MULGEN_DIGITS - 1; i ++) {
+		uint32_t b, m;
+
+		/*
+		 * Get next bits (beyond the 32 bytes of the scalar, we
+		 * use zeros).
+		 */
+		if (acc_len < MULGEN_WIN) {
+			if (k < 32) {
+				acc |= (uint32_t)s[k ++] << acc_len;
+			}
+			acc_len += 8;
+		}
+
+		/*
+		 * Digit value, unsigned, with carry: 0..2^w. Values
+		 * greater than 2^(w-1) are replaced with their negation
+		 * 2^w-b (in sign+mantissa format), with a carry.
+		 */
+		b = (acc & ((1u << MULGEN_WIN) - 1)) + cc;
+		acc >>= MULGEN_WIN;
+		acc_len -= MULGEN_WIN;
+		m = MULGEN_SIZE - b;
+		m = (uint32_t)(*(int32_t *)&m >> 31);
+		b ^= m & (b ^ (((1u << MULGEN_WIN) - b) | 0x8000));
+		cc = m & 1;
+		sd[i] = (uint16_t)b;
+	}
+
+	/*
+	 * Last digit is nonnegative; it gets all remaining bits.
+	 */
+	while (k < 32) {
+		acc |= (uint32_t)s[k ++] << acc_len;
+		acc_len += 8;
+	}
+	sd[MULGEN_DIGITS - 1] = (uint16_t)(acc + cc);
+}
+
+/*
+ * Lookup an affine point in the window for chunk j (constant-time),
+ * and negate it if the sign bit of the digit is set. For a zero digit,
+ * the all-zeros (neutral) point is returned.
+ */
+static void
+window_lookup_comb(CN(mulgen_affine) *P, int j, uint32_t digit)
+{
+	const CN(mulgen_affine) *win;
+	uint32_t index, u;
+
+	STATS_INC(window_lookup);
+
+	win = window_G_comb + (size_t)j * MULGEN_SIZE;
+	index = digit & 0x7FFF;
+	memset(P, 0, sizeof *P);
+	for (u = 0; u < MULGEN_SIZE; u ++) {
+		uint64_t m;
+
+		/*
+		 * m is -1 if index == u+1, 0 otherwise.
+		 */
+		m = (uint64_t)(index ^ (u + 1)) - 1;
+		m = (uint64_t)(*(int64_t *)&m >> 63);
+
+		P->X.w64.v0 |= m & win[u].X.w64.v0;
+		P->X.w64.v1 |= m & win[u].X.w64.v1;
+		P->X.w64.v2 |= m & win[u].X.w64.v2;
+		P->X.w64.v3 |= m & win[u].X.w64.v3;
+		P->MULGEN_Y.w64.v0 |= m & win[u].MULGEN_Y.w64.v0;
+		P->MULGEN_Y.w64.v1 |= m & win[u].MULGEN_Y.w64.v1;
+		P->MULGEN_Y.w64.v2 |= m & win[u].MULGEN_Y.w64.v2;
+		P->MULGEN_Y.w64.v3 |= m & win[u].MULGEN_Y.w64.v3;
+	}
+	gf_condneg(&P->MULGEN_Y.w64, &P->MULGEN_Y.w64, digit >> 15);
+}
+
+/* see do255.h */
+void
+CN(mulgen)(CN(point) *P3, const void *scalar)
+{
+	CN(mulgen_point) P;
+	CN(mulgen_affine) Qa;
+	uint16_t sd[MULGEN_DIGITS];
+	int i, j, first;
+
+	/*
+	 * Recode the scalar.
+	 */
+	recode_comb(sd, scalar);
+
+	/*
+	 * Digit i of chunk j has index j*MULGEN_LEN+i; indices beyond the
+	 * last digit are skipped (this depends only on the parameters,
+	 * not on the scalar). The first lookup initializes the
+	 * accumulator.
+	 */
+	first = 1;
+	for (i = MULGEN_LEN - 1; i >= 0; i --) {
+		if (!first) {
+			mulgen_double_x(&P, &P, MULGEN_WIN);
+		}
+		for (j = 0; j < MULGEN_CHUNKS; j ++) {
+			int k;
+
+			k = j * MULGEN_LEN + i;
+			if (k >= MULGEN_DIGITS) {
+				continue;
+			}
+			window_lookup_comb(&Qa, j, sd[k]);
+			if (first) {
+#if MULGEN_XU
+				/*
+				 * (x,u) = (0,0) with Z = T = 1 is a valid
+				 * representation of the neutral.
+				 */
+				P.X = Qa.X;
+				P.U = Qa.U;
+				P.Z.w64 = GF_ONE;
+				P.T.w64 = GF_ONE;
+#else
+				uint64_t qz;
+
+				/*
+				 * A zero digit yields X = 0; the neutral is
+				 * then (0,1,0).
+				 */
+				qz = gf_iszero(&Qa.X.w64);
+				P.X = Qa.X;
+				P.W = Qa.W;
+				P.W.w64.v0 |= qz;
+				P.Z.w64.v0 = 1 - qz;
+				P.Z.w64.v1 = 0;
+				P.Z.w64.v2 = 0;
+				P.Z.w64.v3 = 0;
+#endif
+				first = 0;
+			} else {
+				mulgen_add(&P, &P, &Qa);
+			}
+		}
+	}
+
+#if MULGEN_XU
+	/*
+	 * Return the result in Jacobian (x,w) coordinates.
+	 *   X3 = X*Z*U^2
+	 *   W3 = Z*T   (necessarily non-zero)
+	 *   Z3 = Z*U
+	 */
+	gf_mul(&P3->X.w64, &P.X.w64, &P.U.w64);
+	gf_mul(&P3->W.w64, &P.Z.w64, &P.T.w64);
+	gf_mul(&P3->Z.w64, &P.Z.w64, &P.U.w64);
+	gf_mul(&P3->X.w64, &P3->X.w64, &P3->Z.w64);
+#else
+	*P3 = P;
+#endif
+}
+
+#undef MULGEN_Y
+#undef mulgen_add
+#undef mulgen_double_x
@@ -0,0 +1,117 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations
+ *  - defined curve multiplication core operations
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_mul_multi() with a 5-bit window, for curve
+ * do255e; it works with any finite field implementation with 64-bit
+ * limbs.
+ */
+
+/*
+ * Points are processed by groups of at most MUL_MULTI_GROUP; each point
+ * in a group uses two windows of 16 affine points (2 kB), and 1 kB of
+ * temporaries for normalization, on the stack.
+ */
+#define MUL_MULTI_GROUP   8
+
+/* see do255.h */
+void
+CN(mul_multi)(CN(point) *Q, const CN(point) *P,
+	const void *scalars, size_t num)
+{
+	CN(point) T;
+	size_t u, v, n;
+
+	/*
+	 * T contains the sum of the results of the previous groups.
+	 */
+	T.X.w64 = GF_ZERO;
+	T.W.w64 = GF_ONE;
+	T.Z.w64 = GF_ZERO;
+	for (u = 0; u < num; u += n) {
+		CN(point_affine) win0[MUL_MULTI_GROUP][16];
+		CN(point_affine) win1[MUL_MULTI_GROUP][16];
+		CN(point_affine) Qa;
+		CN(point) Pt[MUL_MULTI_GROUP];
+		gf zz[16 * MUL_MULTI_GROUP], tmp[16 * MUL_MULTI_GROUP];
+		uint8_t sd0[MUL_MULTI_GROUP][26], sd1[MUL_MULTI_GROUP][26];
+		uint64_t sg1[MUL_MULTI_GROUP];
+		CN(point) M;
+		int i;
+
+		n = num - u;
+		if (n > MUL_MULTI_GROUP) {
+			n = MUL_MULTI_GROUP;
+		}
+
+		/*
+		 * For each point, split the scalar and compute the two
+		 * windows, as in CURVE_mul(). The windows for all points
+		 * in the group are normalized with a single inversion.
+		 */
+		for (v = 0; v < n; v ++) {
+			i128 k0, k1;
+			uint64_t sg;
+
+			split_scalar(&k0, &k1,
+				(const uint8_t *)scalars + 32 * (u + v));
+			sg = recode5_small(sd0[v], &k0);
+			Pt[v] = P[u + v];
+			gf_condneg(&Pt[v].W.w64, &Pt[v].W.w64, sg);
+			sg1[v] = sg ^ recode5_small(sd1[v], &k1);
+		}
+		window_fill_16_multi_affine(&win0[0][0], Pt, n, zz, tmp);
+		for (v = 0; v < n; v ++) {
+			for (i = 0; i < 16; i ++) {
+				gf_neg(&win1[v][i].X.w64, &win0[v][i].X.w64);
+				gf_mul_inline(&win1[v][i].W.w64,
+					&win0[v][i].W.w64, &MINUS_ETA);
+				gf_condneg(&win1[v][i].W.w64,
+					&win1[v][i].W.w64, sg1[v]);
+			}
+		}
+
+		/*
+		 * Process digits from top to bottom, with a single chain
+		 * of doublings shared by all points. Top digits are
+		 * nonnegative; all additions use the complete mixed
+		 * addition formulas, which also work when the looked-up
+		 * point is the neutral (affine (0,0)).
+		 */
+		M.X.w64 = GF_ZERO;
+		M.W.w64 = GF_ONE;
+		M.Z.w64 = GF_ZERO;
+		for (v = 0; v < n; v ++) {
+			window_lookup_16_affine(&Qa, win0[v], sd0[v][25]);
+			CN(add_mixed)(&M, &M, &Qa);
+			window_lookup_16_affine(&Qa, win1[v], sd1[v][25]);
+			CN(add_mixed)(&M, &M, &Qa);
+		}
+		for (i = 24; i >= 0; i --) {
+			CN(double_x)(&M, &M, 5);
+			for (v = 0; v < n; v ++) {
+				window_lookup_16_affine(&Qa,
+					win0[v], sd0[v][i] & 31);
+				gf_condneg(&Qa.W.w64, &Qa.W.w64,
+					sd0[v][i] >> 7);
+				CN(add_mixed)(&M, &M, &Qa);
+				window_lookup_16_affine(&Qa,
+					win1[v], sd1[v][i] & 31);
+				gf_condneg(&Qa.W.w64, &Qa.W.w64,
+					sd1[v][i] >> 7);
+				CN(add_mixed)(&M, &M, &Qa);
+			}
+		}
+
+		CN(add)(&T, &T, &M);
+	}
+	*Q = T;
+}
+
+#undef MUL_MULTI_GROUP
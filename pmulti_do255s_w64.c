@@ -0,0 +1,89 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations
+ *  - defined curve multiplication core operations
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_mul_multi() with a 5-bit window, for curve
+ * do255s; it works with any finite field implementation with 64-bit
+ * limbs.
+ */
+
+/*
+ * Points are processed by groups of at most MUL_MULTI_GROUP; each point
+ * in a group uses a window of 16 affine points (1 kB), and 1 kB of
+ * temporaries for normalization, on the stack.
+ */
+#define MUL_MULTI_GROUP   8
+
+/* see do255.h */
+void
+CN(mul_multi)(CN(point) *Q, const CN(point) *P,
+	const void *scalars, size_t num)
+{
+	CN(point) T;
+	size_t u, v, n;
+
+	/*
+	 * T contains the sum of the results of the previous groups.
+	 */
+	T.X.w64 = GF_ZERO;
+	T.W.w64 = GF_ONE;
+	T.Z.w64 = GF_ZERO;
+	for (u = 0; u < num; u += n) {
+		CN(point_affine) win[MUL_MULTI_GROUP][16];
+		CN(point_affine) Qa;
+		gf zz[16 * MUL_MULTI_GROUP], tmp[16 * MUL_MULTI_GROUP];
+		uint8_t sd[MUL_MULTI_GROUP][52];
+		CN(point) M;
+		int i;
+
+		n = num - u;
+		if (n > MUL_MULTI_GROUP) {
+			n = MUL_MULTI_GROUP;
+		}
+
+		/*
+		 * Recode the scalars and fill the windows; the windows
+		 * for all points in the group are normalized with a single
+		 * inversion.
+		 */
+		for (v = 0; v < n; v ++) {
+			recode5(sd[v], (const uint8_t *)scalars + 32 * (u + v));
+		}
+		window_fill_16_multi_affine(&win[0][0], P + u, n, zz, tmp);
+
+		/*
+		 * Process digits from top to bottom, with a single chain
+		 * of doublings shared by all points. Top digits are
+		 * nonnegative; all additions use the complete mixed
+		 * addition formulas, which also work when the looked-up
+		 * point is the neutral (affine (0,0)).
+		 */
+		M.X.w64 = GF_ZERO;
+		M.W.w64 = GF_ONE;
+		M.Z.w64 = GF_ZERO;
+		for (v = 0; v < n; v ++) {
+			window_lookup_16_affine(&Qa, win[v], sd[v][51]);
+			CN(add_mixed)(&M, &M, &Qa);
+		}
+		for (i = 50; i >= 0; i --) {
+			CN(double_x)(&M, &M, 5);
+			for (v = 0; v < n; v ++) {
+				window_lookup_16_affine(&Qa,
+					win[v], sd[v][i] & 31);
+				gf_condneg(&Qa.W.w64, &Qa.W.w64, sd[v][i] >> 7);
+				CN(add_mixed)(&M, &M, &Qa);
+			}
+		}
+
+		CN(add)(&T, &T, &M);
+	}
+	*Q = T;
+}
+
+#undef MUL_MULTI_GROUP
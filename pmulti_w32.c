@@ -0,0 +1,156 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations
+ *  - defined curve multiplication core operations
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_mul_multi() with a 4-bit window. It works
+ * with both curves, and with any finite field implementation with 32-bit
+ * limbs (including the ARM assembly implementations). The endomorphism
+ * of do255e is not used here, to keep RAM usage low.
+ */
+
+/*
+ * Points are processed by groups of at most MUL_MULTI_GROUP; each point
+ * in a group uses a window of 8 affine points (512 bytes), and 512 bytes
+ * of temporaries for normalization, on the stack.
+ */
+#define MUL_MULTI_GROUP   4
+
+/*
+ * Fill win[8*j + i] with (i+1)*P[j] in affine coordinates, for i = 0..7
+ * and j = 0..num-1 (with num <= MUL_MULTI_GROUP). A single inversion is
+ * used for all points. Source points may be the neutral (the
+ * corresponding window is then filled with (0,0)). This function is
+ * constant-time.
+ */
+static void
+window_fill_8_multi_affine(CN(point_affine) *win,
+	const CN(point) *P, size_t num)
+{
+	CN(point) T;
+	gf ZZ[8 * MUL_MULTI_GROUP], MZ[8 * MUL_MULTI_GROUP];
+	size_t j;
+	int i;
+
+	/*
+	 * Compute point multiples. Since the group has prime order r,
+	 * multiples of a non-neutral point are non-neutral. For a
+	 * neutral point, we replace all Z coordinates with 1, so that
+	 * the shared inversion is not spoiled; the window contents are
+	 * cleared afterwards.
+	 */
+	for (j = 0; j < num; j ++) {
+		CN(point_affine) *w;
+		gf *z;
+		uint32_t nz;
+
+		w = win + 8 * j;
+		z = ZZ + 8 * j;
+		w[0].X = P[j].X;
+		w[0].W = P[j].W;
+		z[0] = P[j].Z.w32;
+		for (i = 2; i <= 8; i ++) {
+			if ((i & 1) == 0) {
+				T.X = w[(i >> 1) - 1].X;
+				T.W = w[(i >> 1) - 1].W;
+				T.Z.w32 = z[(i >> 1) - 1];
+				CN(double)(&T, &T);
+			} else {
+				T.X = w[i - 2].X;
+				T.W = w[i - 2].W;
+				T.Z.w32 = z[i - 2];
+				CN(add)(&T, &T, &P[j]);
+			}
+			w[i - 1].X = T.X;
+			w[i - 1].W = T.W;
+			z[i - 1] = T.Z.w32;
+		}
+		nz = gf_iszero(&P[j].Z.w32);
+		for (i = 0; i < 8; i ++) {
+			gf_sel2(&z[i], &GF_ONE, &z[i], nz);
+		}
+	}
+
+	batch_affine(win, ZZ, MZ, 8 * num);
+
+	for (j = 0; j < num; j ++) {
+		uint32_t nz;
+
+		nz = gf_iszero(&P[j].Z.w32);
+		for (i = 0; i < 8; i ++) {
+			CN(point_affine) *w;
+
+			w = win + 8 * j + i;
+			gf_sel2(&w->X.w32, &GF_ZERO, &w->X.w32, nz);
+			gf_sel2(&w->W.w32, &GF_ZERO, &w->W.w32, nz);
+		}
+	}
+}
+
+/* see do255.h */
+void
+CN(mul_multi)(CN(point) *Q, const CN(point) *P,
+	const void *scalars, size_t num)
+{
+	CN(point) T;
+	size_t u, v, n;
+
+	/*
+	 * T contains the sum of the results of the previous groups.
+	 */
+	T = CN(neutral);
+	for (u = 0; u < num; u += n) {
+		CN(point_affine) win[MUL_MULTI_GROUP][8];
+		CN(point_affine) Qa;
+		uint8_t sd[MUL_MULTI_GROUP][64];
+		CN(point) M;
+		int i;
+
+		n = num - u;
+		if (n > MUL_MULTI_GROUP) {
+			n = MUL_MULTI_GROUP;
+		}
+
+		/*
+		 * Recode the scalars and fill the windows; the windows
+		 * for all points in the group are normalized with a single
+		 * inversion.
+		 */
+		for (v = 0; v < n; v ++) {
+			recode4(sd[v], (const uint8_t *)scalars + 32 * (u + v));
+		}
+		window_fill_8_multi_affine(&win[0][0], P + u, n);
+
+		/*
+		 * Process digits from top to bottom, with a single chain
+		 * of doublings shared by all points. Top digits are
+		 * nonnegative; all additions use the complete mixed
+		 * addition formulas, which also work when the looked-up
+		 * point is the neutral (affine (0,0)).
+		 */
+		M = CN(neutral);
+		for (v = 0; v < n; v ++) {
+			window_lookup_8_affine(&Qa, win[v], sd[v][63]);
+			CN(add_mixed)(&M, &M, &Qa);
+		}
+		for (i = 62; i >= 0; i --) {
+			CN(double_x)(&M, &M, 4);
+			for (v = 0; v < n; v ++) {
+				window_lookup_8_affine(&Qa,
+					win[v], sd[v][i] & 15);
+				gf_condneg(&Qa.W.w32, &Qa.W.w32, sd[v][i] >> 7);
+				CN(add_mixed)(&M, &M, &Qa);
+			}
+		}
+
+		CN(add)(&T, &T, &M);
+	}
+	*Q = T;
+}
+
+#undef MUL_MULTI_GROUP
@@ -0,0 +1,119 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - included <string.h> (for memset())
+ *  - defined gf and operations
+ *  - defined curve basic operations, including CURVE_add_mixed()
+ *  - defined recode4() and window_lookup_8_affine() (pmul_base_*.c)
+ *  - defined window_fill_8_multi_affine() (pmulti_w32.c)
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_precomp_init() and CURVE_mul_precomp() for
+ * all implementations that use 32-bit limbs. The precomputed table has
+ * the same structure as the static tables used by CURVE_mulgen(): four
+ * windows of 8 affine points, for base points P, 2^64*P, 2^128*P and
+ * 2^192*P. Points are in affine (x,w) coordinates for both curves. Only
+ * the first half of the CURVE_precomp structure is used.
+ */
+
+/*
+ * Get the four windows of a precomputed table.
+ */
+#define PRECOMP_WIN(table)   ((CN(point_affine) *)(void *)(table)->t)
+
+/* see do255.h */
+void
+CN(precomp_init)(CN(precomp) *table, const CN(point) *P)
+{
+	CN(point) T[4];
+	int i;
+
+	/*
+	 * Base points for the four chunks of 16 digits (4 bits each);
+	 * a single inversion is used to normalize all windows.
+	 */
+	T[0] = *P;
+	for (i = 1; i < 4; i ++) {
+		CN(double_x)(&T[i], &T[i - 1], 64);
+	}
+	memset(table, 0, sizeof *table);
+	window_fill_8_multi_affine(PRECOMP_WIN(table), T, 4);
+}
+
+/* see do255.h */
+void
+CN(mul_precomp)(CN(point) *P3, const CN(precomp) *table, const void *scalar)
+{
+	const CN(point_affine) *win;
+	CN(point) P;
+	CN(point_affine) Qa;
+	int i;
+	uint8_t sd[64];
+	uint32_t qz;
+
+	win = PRECOMP_WIN(table);
+
+	/*
+	 * Recode the scalar.
+	 */
+	recode4(sd, scalar);
+
+	/*
+	 * This follows the same process as CURVE_mulgen(). Top digit of
+	 * the full scalar is nonnegative; however, it can be zero, which
+	 * requires a specific treatment (the looked-up point is also the
+	 * neutral if the table was built for the neutral).
+	 */
+	window_lookup_8_affine(&Qa, win + 24, sd[63]);
+	qz = gf_iszero(&Qa.X.w32);
+	P.X = Qa.X;
+	P.W = Qa.W;
+	memset(&P.Z.w32, 0, sizeof P.Z.w32);
+	P.W.w32.v[0] |= qz;
+	P.Z.w32.v[0] = 1 - qz;
+
+	/*
+	 * Lookups and additions for the top digits of the three other
+	 * chunks.
+	 */
+	window_lookup_8_affine(&Qa, win, sd[15] & 15);
+	gf_condneg(&Qa.W.w32, &Qa.W.w32, sd[15] >> 7);
+	CN(add_mixed)(&P, &P, &Qa);
+
+	window_lookup_8_affine(&Qa, win + 8, sd[31] & 15);
+	gf_condneg(&Qa.W.w32, &Qa.W.w32, sd[31] >> 7);
+	CN(add_mixed)(&P, &P, &Qa);
+
+	window_lookup_8_affine(&Qa, win + 16, sd[47] & 15);
+	gf_condneg(&Qa.W.w32, &Qa.W.w32, sd[47] >> 7);
+	CN(add_mixed)(&P, &P, &Qa);
+
+	for (i = 14; i >= 0; i --) {
+		CN(double_x)(&P, &P, 4);
+
+		window_lookup_8_affine(&Qa, win, sd[i] & 15);
+		gf_condneg(&Qa.W.w32, &Qa.W.w32, sd[i] >> 7);
+		CN(add_mixed)(&P, &P, &Qa);
+
+		window_lookup_8_affine(&Qa, win + 8, sd[i + 16] & 15);
+		gf_condneg(&Qa.W.w32, &Qa.W.w32, sd[i + 16] >> 7);
+		CN(add_mixed)(&P, &P, &Qa);
+
+		window_lookup_8_affine(&Qa, win + 16, sd[i + 32] & 15);
+		gf_condneg(&Qa.W.w32, &Qa.W.w32, sd[i + 32] >> 7);
+		CN(add_mixed)(&P, &P, &Qa);
+
+		window_lookup_8_affine(&Qa, win + 24, sd[i + 48] & 15);
+		gf_condneg(&Qa.W.w32, &Qa.W.w32, sd[i + 48] >> 7);
+		CN(add_mixed)(&P, &P, &Qa);
+	}
+
+	/*
+	 * Return the result.
+	 */
+	*P3 = P;
+}
+
+#undef PRECOMP_WIN
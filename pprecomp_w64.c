@@ -0,0 +1,119 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf and operations
+ *  - defined curve basic operations, including CURVE_add_mixed()
+ *  - defined recode5(), window_lookup_16_affine() and
+ *    window_fill_16_multi_affine() (pmul_base_w64.c)
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_precomp_init() and CURVE_mul_precomp() for
+ * all implementations that use 64-bit limbs. The precomputed table has
+ * the same structure as the static tables used by CURVE_mulgen(): four
+ * windows of 16 affine points, for base points P, 2^65*P, 2^130*P and
+ * 2^195*P. Points are in affine (x,w) coordinates for both curves.
+ */
+
+/*
+ * Get the four windows of a precomputed table.
+ */
+#define PRECOMP_WIN(table)   ((CN(point_affine) *)(void *)(table)->t)
+
+/* see do255.h */
+void
+CN(precomp_init)(CN(precomp) *table, const CN(point) *P)
+{
+	CN(point) T[4];
+	gf zz[64], tmp[64];
+	int i;
+
+	/*
+	 * Base points for the four chunks of 13 digits (5 bits each);
+	 * a single inversion is used to normalize all windows.
+	 */
+	T[0] = *P;
+	for (i = 1; i < 4; i ++) {
+		CN(double_x)(&T[i], &T[i - 1], 65);
+	}
+	window_fill_16_multi_affine(PRECOMP_WIN(table), T, 4, zz, tmp);
+}
+
+/* see do255.h */
+void
+CN(mul_precomp)(CN(point) *P3, const CN(precomp) *table, const void *scalar)
+{
+	const CN(point_affine) *win;
+	CN(point) P;
+	CN(point_affine) Qa;
+	int i;
+	uint8_t sd[52];
+	uint64_t qz;
+
+	win = PRECOMP_WIN(table);
+
+	/*
+	 * Recode the scalar.
+	 */
+	recode5(sd, scalar);
+
+	/*
+	 * This follows the same process as CURVE_mulgen() (with the
+	 * do255s point representation). Top digit of the full scalar is
+	 * nonnegative, but it may be zero; the looked-up point is also
+	 * the neutral if the table was built for the neutral.
+	 */
+	window_lookup_16_affine(&Qa, win + 48, sd[51]);
+	qz = gf_iszero(&Qa.X.w64);
+	P.X = Qa.X;
+	P.W = Qa.W;
+	P.W.w64.v0 |= qz;
+	P.Z.w64.v0 = 1 - qz;
+	P.Z.w64.v1 = 0;
+	P.Z.w64.v2 = 0;
+	P.Z.w64.v3 = 0;
+
+	/*
+	 * Lookups and additions for the top digits of the three other
+	 * chunks.
+	 */
+	window_lookup_16_affine(&Qa, win, sd[12] & 31);
+	gf_condneg(&Qa.W.w64, &Qa.W.w64, sd[12] >> 7);
+	CN(add_mixed)(&P, &P, &Qa);
+
+	window_lookup_16_affine(&Qa, win + 16, sd[25] & 31);
+	gf_condneg(&Qa.W.w64, &Qa.W.w64, sd[25] >> 7);
+	CN(add_mixed)(&P, &P, &Qa);
+
+	window_lookup_16_affine(&Qa, win + 32, sd[38] & 31);
+	gf_condneg(&Qa.W.w64, &Qa.W.w64, sd[38] >> 7);
+	CN(add_mixed)(&P, &P, &Qa);
+
+	for (i = 11; i >= 0; i --) {
+		CN(double_x)(&P, &P, 5);
+
+		window_lookup_16_affine(&Qa, win, sd[i] & 31);
+		gf_condneg(&Qa.W.w64, &Qa.W.w64, sd[i] >> 7);
+		CN(add_mixed)(&P, &P, &Qa);
+
+		window_lookup_16_affine(&Qa, win + 16, sd[i + 13] & 31);
+		gf_condneg(&Qa.W.w64, &Qa.W.w64, sd[i + 13] >> 7);
+		CN(add_mixed)(&P, &P, &Qa);
+
+		window_lookup_16_affine(&Qa, win + 32, sd[i + 26] & 31);
+		gf_condneg(&Qa.W.w64, &Qa.W.w64, sd[i + 26] >> 7);
+		CN(add_mixed)(&P, &P, &Qa);
+
+		window_lookup_16_affine(&Qa, win + 48, sd[i + 39] & 31);
+		gf_condneg(&Qa.W.w64, &Qa.W.w64, sd[i + 39] >> 7);
+		CN(add_mixed)(&P, &P, &Qa);
+	}
+
+	/*
+	 * Return the result.
+	 */
+	*P3 = P;
+}
+
+#undef PRECOMP_WIN
@@ -8,10 +8,32 @@
  *  - defined CURVE to the curve name
  *
  * This file implements CURVE_verify_helper_vartime() with a 5-bit window,
+ * and its variant with a precomputed table for the point
+ * (CURVE_verify_table_init() and CURVE_verify_helper_table_vartime()),
  * for curve do255e. It works with any finite field implementation with
- * 64-bit limbs.
+ * 64-bit limbs. The generator part uses wider wNAF digits (VRFY_NAF_WIN
+ * bits) with the static tables window_naf_G and window_naf_G128 (from
+ * gvrfy_do255e_w64.c).
  */
 
+/*
+ * Add d*Q to M, for d a wNAF digit (odd, or zero), with win[] the odd
+ * multiples of Q (1*Q, 3*Q, 5*Q...) in affine (x,u) coordinates.
+ */
+static inline void
+add_naf_G_xu(CN(point_xu) *M, const CN(point_affine_xu) *win, int d)
+{
+	CN(point_affine_xu) Qa;
+
+	if (d > 0) {
+		CN(add_mixed_xu)(M, M, &win[d >> 1]);
+	} else if (d < 0) {
+		Qa.X = win[(-d) >> 1].X;
+		gf_neg(&Qa.U.w64, &win[(-d) >> 1].U.w64);
+		CN(add_mixed_xu)(M, M, &Qa);
+	}
+}
+
 /* see do255.h */
 int
 CN(verify_helper_vartime)(const void *k0,
@@ -19,15 +41,18 @@ CN(verify_helper_vartime)(const void *k0,
 {
 	/*
 	 * We use the endomorphism to split scalar k1; for scalar k0,
-	 * we simply use a normal split since windows for G and
-	 * 2^130*G are hardcoded.
+	 * we use wNAF recoding (VRFY_NAF_WIN bits) and a normal split,
+	 * since the odd multiples of G and 2^128*G are hardcoded.
 	 */
+	i256 t0;
 	i128 k1_lo, k1_hi;
 	CN(point_xu) M;
 	CN(point_xu) win_lo[16], win_hi[16];
-	uint8_t sd0[52], sd1_lo[26], sd1_hi[26];
-	uint64_t sg;
+	int8_t sd0[256];
+	uint8_t sd1_lo[26], sd1_hi[26];
+	uint64_t sg, cc;
 	int i;
+	unsigned ndbl;
 	gf Rw;
 
 	/* Decode R_enc into its w coordinate. We do not need to verify
@@ -54,9 +79,12 @@ CN(verify_helper_vartime)(const void *k0,
 	}
 
 	/*
-	 * Recode scalar k0.
+	 * Recode scalar k0. Digits 0 to 127 are used with G, and digits
+	 * 128 to 255 with 2^128*G; a carry is an extra 2^256*G, i.e. an
+	 * extra digit 1 at index 128 for 2^128*G.
 	 */
-	recode5(sd0, k0);
+	i256_decode(&t0, k0);
+	cc = recode_NAFw_256(sd0, &t0, VRFY_NAF_WIN);
 
 	/*
 	 * Split scalar k1 into two signed 128-bit values.
@@ -97,48 +125,51 @@ CN(verify_helper_vartime)(const void *k0,
 	}
 
 	/*
-	 * Perform the combined point multiplications.
+	 * Perform the combined point multiplications. The k0 digits
+	 * may be non-zero at any bit position, while the k1 digits are
+	 * at positions multiple of 5; doublings are delayed until the
+	 * next addition, so that consecutive doublings are merged
+	 * (CURVE_double_x_xu() is cheaper per doubling for larger counts).
 	 */
-	M.X.w64 = GF_ZERO;
+	if (cc) {
+		M.X = window_naf_G128[0].X;
+		M.U = window_naf_G128[0].U;
+	} else {
+		M.X.w64 = GF_ZERO;
+		M.U.w64 = GF_ZERO;
+	}
 	M.Z.w64 = GF_ONE;
-	M.U.w64 = GF_ZERO;
 	M.T.w64 = GF_ONE;
-	for (i = 25; i >= 0; i --) {
+	ndbl = 0;
+	for (i = 127; i >= 0; i --) {
 		CN(point_xu) Q;
-		CN(point_affine_xu) Qa;
-		int j;
+		int j, d0, d1;
+		unsigned e_lo, e_hi;
 
-		if (i != 25) {
-			CN(double_x_xu)(&M, &M, 5);
-		}
-		if ((sd0[i] & 31) != 0) {
-			if (sd0[i] < 0x80) {
-				j = sd0[i] - 1;
-				CN(add_mixed_xu)(&M, &M, &window_G_xu[j]);
-			} else {
-				j = (sd0[i] & 31) - 1;
-				Qa.X = window_G_xu[j].X;
-				gf_neg(&Qa.U.w64, &window_G_xu[j].U.w64);
-				CN(add_mixed_xu)(&M, &M, &Qa);
-			}
+		ndbl ++;
+		d0 = sd0[i];
+		d1 = sd0[i + 128];
+		if (i % 5 == 0) {
+			e_lo = sd1_lo[i / 5];
+			e_hi = sd1_hi[i / 5];
+		} else {
+			e_lo = 0;
+			e_hi = 0;
 		}
-		if ((sd0[i + 26] & 31) != 0) {
-			if (sd0[i + 26] < 0x80) {
-				j = sd0[i + 26] - 1;
-				CN(add_mixed_xu)(&M, &M, &window_G130_xu[j]);
-			} else {
-				j = (sd0[i + 26] & 31) - 1;
-				Qa.X = window_G130_xu[j].X;
-				gf_neg(&Qa.U.w64, &window_G130_xu[j].U.w64);
-				CN(add_mixed_xu)(&M, &M, &Qa);
-			}
+		if ((d0 | d1) == 0 && ((e_lo | e_hi) & 31) == 0) {
+			continue;
 		}
-		if ((sd1_lo[i] & 31) != 0) {
-			if (sd1_lo[i] < 0x80) {
-				j = sd1_lo[i] - 1;
+		CN(double_x_xu)(&M, &M, ndbl);
+		ndbl = 0;
+
+		add_naf_G_xu(&M, window_naf_G, d0);
+		add_naf_G_xu(&M, window_naf_G128, d1);
+		if ((e_lo & 31) != 0) {
+			if (e_lo < 0x80) {
+				j = e_lo - 1;
 				CN(add_xu)(&M, &M, &win_lo[j]);
 			} else {
-				j = (sd1_lo[i] & 31) - 1;
+				j = (e_lo & 31) - 1;
 				Q.X = win_lo[j].X;
 				Q.Z = win_lo[j].Z;
 				Q.U = win_lo[j].U;
@@ -146,12 +177,12 @@ CN(verify_helper_vartime)(const void *k0,
 				CN(add_xu)(&M, &M, &Q);
 			}
 		}
-		if ((sd1_hi[i] & 31) != 0) {
-			if (sd1_hi[i] < 0x80) {
-				j = sd1_hi[i] - 1;
+		if ((e_hi & 31) != 0) {
+			if (e_hi < 0x80) {
+				j = e_hi - 1;
 				CN(add_xu)(&M, &M, &win_hi[j]);
 			} else {
-				j = (sd1_hi[i] & 31) - 1;
+				j = (e_hi & 31) - 1;
 				Q.X = win_hi[j].X;
 				Q.Z = win_hi[j].Z;
 				Q.U = win_hi[j].U;
@@ -160,6 +191,7 @@ CN(verify_helper_vartime)(const void *k0,
 			}
 		}
 	}
+	CN(double_x_xu)(&M, &M, ndbl);
 
 	/*
 	 * Verify that the resulting point matches the encoded value.
@@ -186,3 +218,176 @@ CN(verify_helper_vartime)(const void *k0,
 		return (int)gf_eq(&Rw, &M.T.w64);
 	}
 }
+
+/*
+ * Layout of a verification table: the point P itself (Jacobian
+ * coordinates), then the window of P (1*P to 16*P) and the window of
+ * phi(P), both in affine (x,u) coordinates. If P is the neutral, then
+ * the windows are not filled.
+ */
+#define VTAB_POINT(tab)   ((CN(point) *)(void *)(tab)->t)
+#define VTAB_WIN(tab)     ((CN(point_affine_xu) *)(void *)((tab)->t + 3))
+
+/* see do255.h */
+void
+CN(verify_table_init)(CN(verify_table) *tab, const CN(point) *P)
+{
+	CN(point_xu) win[16];
+	CN(point_affine_xu) *win_lo, *win_hi;
+	gf zz[32], tmp[32];
+	int i;
+
+	*VTAB_POINT(tab) = *P;
+	win_lo = VTAB_WIN(tab);
+	win_hi = win_lo + 16;
+	if (CN(is_neutral)(P)) {
+		memset(win_lo, 0, 32 * sizeof *win_lo);
+		return;
+	}
+
+	/*
+	 * Compute the window of P in fractional (x,u) coordinates, as
+	 * in CURVE_verify_helper_vartime(), then normalize it to affine
+	 * coordinates (Z and T are non-zero, since P is not the neutral).
+	 */
+	win[0].X = P->X;
+	gf_sqr_inline(&win[0].Z.w64, &P->Z.w64);
+	win[0].U = P->Z;
+	win[0].T = P->W;
+	CN(double_xu)(&win[1], &win[0]);
+	for (i = 3; i <= 15; i += 2) {
+		CN(add_xu)(&win[i - 1], &win[i - 2], &win[0]);
+		CN(double_xu)(&win[i], &win[((i + 1) >> 1) - 1]);
+	}
+	for (i = 0; i < 16; i ++) {
+		zz[2 * i] = win[i].Z.w64;
+		zz[2 * i + 1] = win[i].T.w64;
+	}
+	batch_inv_vartime(zz, tmp, 32);
+
+	/*
+	 * The window for phi(P) is obtained with phi(x, u) = (-x, eta*u).
+	 */
+	for (i = 0; i < 16; i ++) {
+		gf_mul(&win_lo[i].X.w64, &win[i].X.w64, &zz[2 * i]);
+		gf_mul(&win_lo[i].U.w64, &win[i].U.w64, &zz[2 * i + 1]);
+		gf_neg(&win_hi[i].X.w64, &win_lo[i].X.w64);
+		gf_mul(&win_hi[i].U.w64, &win_lo[i].U.w64, &ETA);
+	}
+}
+
+/* see do255.h */
+int
+CN(verify_helper_table_vartime)(const void *k0,
+	const CN(verify_table) *tab, const void *k1, const void *R_enc)
+{
+	const CN(point) *P;
+	const CN(point_affine_xu) *win_lo, *win_hi;
+	i256 t0;
+	i128 k1_lo, k1_hi;
+	CN(point_xu) M;
+	int8_t sd0[256];
+	uint8_t sd1_lo[26], sd1_hi[26];
+	unsigned sg_lo, sg_hi, ndbl;
+	uint64_t cc;
+	int i;
+	gf Rw;
+
+	/*
+	 * The neutral is handled by the generic function (it uses only
+	 * mulgen()).
+	 */
+	P = VTAB_POINT(tab);
+	if (CN(is_neutral)(P)) {
+		return CN(verify_helper_vartime)(k0, P, k1, R_enc);
+	}
+	win_lo = VTAB_WIN(tab);
+	win_hi = win_lo + 16;
+
+	/*
+	 * Decode R_enc into its w coordinate (range check only).
+	 */
+	if (!gf_decode(&Rw, R_enc)) {
+		return 0;
+	}
+
+	/*
+	 * Recode k0, and split and recode k1. The windows were computed
+	 * for P and phi(P); instead of negating the windows when the
+	 * halves of k1 are negative, we flip the signs of their digits.
+	 */
+	i256_decode(&t0, k0);
+	cc = recode_NAFw_256(sd0, &t0, VRFY_NAF_WIN);
+	split_scalar(&k1_lo, &k1_hi, k1);
+	sg_lo = (unsigned)recode5_small(sd1_lo, &k1_lo) << 7;
+	sg_hi = (unsigned)recode5_small(sd1_hi, &k1_hi) << 7;
+
+	/*
+	 * Perform the combined point multiplications; all additions
+	 * are mixed additions. Doublings are delayed as in
+	 * CURVE_verify_helper_vartime().
+	 */
+	if (cc) {
+		M.X = window_naf_G128[0].X;
+		M.U = window_naf_G128[0].U;
+	} else {
+		M.X.w64 = GF_ZERO;
+		M.U.w64 = GF_ZERO;
+	}
+	M.Z.w64 = GF_ONE;
+	M.T.w64 = GF_ONE;
+	ndbl = 0;
+	for (i = 127; i >= 0; i --) {
+		CN(point_affine_xu) Qa;
+		int d0, d1;
+		unsigned e_lo, e_hi;
+
+		ndbl ++;
+		d0 = sd0[i];
+		d1 = sd0[i + 128];
+		if (i % 5 == 0) {
+			e_lo = sd1_lo[i / 5] ^ sg_lo;
+			e_hi = sd1_hi[i / 5] ^ sg_hi;
+		} else {
+			e_lo = 0;
+			e_hi = 0;
+		}
+		if ((d0 | d1) == 0 && ((e_lo | e_hi) & 31) == 0) {
+			continue;
+		}
+		CN(double_x_xu)(&M, &M, ndbl);
+		ndbl = 0;
+
+		add_naf_G_xu(&M, window_naf_G, d0);
+		add_naf_G_xu(&M, window_naf_G128, d1);
+		if ((e_lo & 31) != 0) {
+			Qa = win_lo[(e_lo & 31) - 1];
+			if (e_lo >= 0x80) {
+				gf_neg(&Qa.U.w64, &Qa.U.w64);
+			}
+			CN(add_mixed_xu)(&M, &M, &Qa);
+		}
+		if ((e_hi & 31) != 0) {
+			Qa = win_hi[(e_hi & 31) - 1];
+			if (e_hi >= 0x80) {
+				gf_neg(&Qa.U.w64, &Qa.U.w64);
+			}
+			CN(add_mixed_xu)(&M, &M, &Qa);
+		}
+	}
+	CN(double_x_xu)(&M, &M, ndbl);
+
+	/*
+	 * Compare the w coordinate of M (M.T / M.U) with that of R
+	 * (see CURVE_verify_helper_vartime()).
+	 */
+	if (gf_iszero(&Rw)) {
+		return (int)gf_iszero(&M.U.w64);
+	} else {
+		gf_mul(&Rw, &Rw, &M.U.w64);
+		return (int)gf_eq(&Rw, &M.T.w64);
+	}
+}
+
+#undef VTAB_POINT
+#undef VTAB_WIN
@@ -8,106 +8,14 @@
  *  - defined CURVE to the curve name
  *
  * This file implements CURVE_verify_helper_vartime() with a 5-bit window,
+ * and its variant with a precomputed table for the point
+ * (CURVE_verify_table_init() and CURVE_verify_helper_table_vartime()),
  * for curve do255s. It works with any finite field implementation with
- * 64-bit limbs.
+ * 64-bit limbs. The generator part uses wider wNAF digits (VRFY_NAF_WIN
+ * bits) with the static tables window_naf_G and window_naf_G128 (from
+ * gvrfy_do255s_w64.c).
  */
 
-/*
- * NAF5 recoding, producing 'num' digits out of the provided 64-bit word.
- * Output contains unprocessed bits, with carries added in.
- */
-static uint64_t
-recode_NAF5_word(int8_t *rc, uint64_t x, int num)
-{
-	int i;
-
-	for (i = 0; i < num; i ++) {
-		/*
-		 * We use a branchless algorithm to avoid misprediction
-		 * penalties. Use of NAF5 is inherently non-constant-time.
-		 *
-		 * If x is even, then next digit is a zero.
-		 * Otherwise:
-		 *  - if the five low bits are in the 1..15 range, then
-		 *    this value is the next digit;
-		 *  - otherwise, the five low bits are in 17..31, and
-		 *    we subtract 32 to make it a negative digit in the
-		 *    -15..-1 range; this implies an extra +32 to add to
-		 *    the x word (carry).
-		 *  Either way, the five low bits of x are then cleared.
-		 *
-		 * Since x is then even in all cases, we divide it by 2.
-		 */
-		uint64_t m, t, c;
-
-		m = -(uint64_t)(x & 1);
-		t = x & m & (uint64_t)31;
-		c = (t & (uint64_t)16) << 1;
-		x = (x - t) + c;
-		rc[i] = (int8_t)((int)t - (int)c);
-		x >>= 1;
-	}
-	return x;
-}
-
-/*
- * NAF5 recoding. Returned value is 1 on carry, 0 otherwise. A carry is
- * returned if the computed digit encode a value which is 2^n lower
- * (exactly) than the intended value, where n is the length of the scalar
- * (in bits).
- * This function is for a 256-bit scalar.
- */
-static uint64_t
-recode_NAF5_256(int8_t *rc, const i256 *c)
-{
-	uint64_t x;
-
-	/*
-	 * We need to leave a bit of room for carries and look-ahead, so we
-	 * must call recode_NAF5_word() five times. We use four 52-bit chunks
-	 * and one final 48-bit chunk.
-	 */
-	x = c->v0 & 0x000FFFFFFFFFFFFF;
-	x = recode_NAF5_word(rc, x, 52);
-	x += ((c->v0 >> 52) | (c->v1 << 12)) & 0x000FFFFFFFFFFFFF;
-	x = recode_NAF5_word(rc + 52, x, 52);
-	x += ((c->v1 >> 40) | (c->v2 << 24)) & 0x000FFFFFFFFFFFFF;
-	x = recode_NAF5_word(rc + 104, x, 52);
-	x += ((c->v2 >> 28) | (c->v3 << 36)) & 0x000FFFFFFFFFFFFF;
-	x = recode_NAF5_word(rc + 156, x, 52);
-	x += c->v3 >> 16;
-	x = recode_NAF5_word(rc + 208, x, 48);
-
-	return x;
-}
-
-/*
- * NAF5 recoding. Returned value is 1 on carry, 0 otherwise. A carry is
- * returned if the computed digit encode a value which is 2^n lower
- * (exactly) than the intended value, where n is the length of the scalar
- * (in bits).
- * This function is for a 128-bit scalar.
- */
-static uint64_t
-recode_NAF5_128(int8_t *rc, const i128 *c)
-{
-	uint64_t x;
-
-	/*
-	 * We need to leave a bit of room for carries and look-ahead, so we
-	 * must call recode_NAF5_word() three times. We use two 52-bit chunks
-	 * and one final 24-bit chunk.
-	 */
-	x = c->v0 & 0x000FFFFFFFFFFFFF;
-	x = recode_NAF5_word(rc, x, 52);
-	x += ((c->v0 >> 52) | (c->v1 << 12)) & 0x000FFFFFFFFFFFFF;
-	x = recode_NAF5_word(rc + 52, x, 52);
-	x += c->v1 >> 40;
-	x = recode_NAF5_word(rc + 104, x, 24);
-
-	return x;
-}
-
 /*
  * Fill win1[i] with (2*i+1)*P1 and win2[i] with (2*i+1)*P2, both in
  * affine coordinates, for i = 0..7.
@@ -149,13 +57,14 @@ window_fill_16odd_x2_affine(CN(point_affine) *win1, CN(point_affine) *win2,
 	}
 
 	/*
-	 * Invert all Z coordinates.
+	 * Invert all Z coordinates. The points are public, so we can use
+	 * the variable-time inversion.
 	 */
 	MZ[0] = ZZ[0];
 	for (i = 2; i <= 16; i ++) {
 		gf_mul(&MZ[i - 1], &MZ[i - 2], &ZZ[i - 1]);
 	}
-	gf_inv(&MZ[15], &MZ[15]);
+	gf_inv_vartime(&MZ[15], &MZ[15]);
 	for (i = 16; i >= 2; i --) {
 		gf zi;
 
@@ -183,6 +92,24 @@ window_fill_16odd_x2_affine(CN(point_affine) *win1, CN(point_affine) *win2,
 	}
 }
 
+/*
+ * Add d*Q to T, for d a wNAF digit (odd, or zero), with win[] the odd
+ * multiples of Q (1*Q, 3*Q, 5*Q...) in affine coordinates.
+ */
+static inline void
+add_naf_G(CN(point) *T, const CN(point_affine) *win, int d)
+{
+	CN(point_affine) Qa;
+
+	if (d > 0) {
+		CN(add_mixed)(T, T, &win[d >> 1]);
+	} else if (d < 0) {
+		Qa.X = win[(-d) >> 1].X;
+		gf_neg(&Qa.W.w64, &win[(-d) >> 1].W.w64);
+		CN(add_mixed)(T, T, &Qa);
+	}
+}
+
 /* see do255.h */
 int
 CN(verify_helper_vartime)(const void *k0,
@@ -209,7 +136,7 @@ CN(verify_helper_vartime)(const void *k0,
 	/*
 	 * Decode point R. If decoding fails, then it's hopeless.
 	 */
-	if (!CN(decode)(&U4, R_enc)) {
+	if (!CN(decode_vartime)(&U4, R_enc)) {
 		return 0;
 	}
 
@@ -278,12 +205,14 @@ CN(verify_helper_vartime)(const void *k0,
 	 * We now have the base points G (implicit), U3 and U4, and the
 	 * scalars k2 (256 bits), k3 and k4 (128 bits each). All these
 	 * scalars are unsigned. We proceed to compute windows, apply
-	 * NAF5 recoding on scalars, and initialize the accumulator T.
+	 * wNAF recoding on scalars (width VRFY_NAF_WIN for k2, which
+	 * uses the static tables, and 5 for k3 and k4), and initialize
+	 * the accumulator T.
 	 */
 	window_fill_16odd_x2_affine(win3, win4, &U3, &U4);
-	if (recode_NAF5_256(sd2, &k2)) {
-		T.X = window_odd_G128[0].X;
-		T.W = window_odd_G128[0].W;
+	if (recode_NAFw_256(sd2, &k2, VRFY_NAF_WIN)) {
+		T.X = window_naf_G128[0].X;
+		T.W = window_naf_G128[0].W;
 		T.Z.w64 = GF_ONE;
 	} else {
 		T.X.w64 = GF_ZERO;
@@ -305,28 +234,8 @@ CN(verify_helper_vartime)(const void *k0,
 		CN(point_affine) Qa;
 
 		CN(double)(&T, &T);
-		if (sd2[i] != 0) {
-			if (sd2[i] > 0) {
-				j = sd2[i] - 1;
-				CN(add_mixed)(&T, &T, &window_G[j]);
-			} else {
-				j = -sd2[i] - 1;
-				Qa.X = window_G[j].X;
-				gf_neg(&Qa.W.w64, &window_G[j].W.w64);
-				CN(add_mixed)(&T, &T, &Qa);
-			}
-		}
-		if (sd2[i + 128] != 0) {
-			if (sd2[i + 128] > 0) {
-				j = sd2[i + 128] >> 1;
-				CN(add_mixed)(&T, &T, &window_odd_G128[j]);
-			} else {
-				j = -sd2[i + 128] >> 1;
-				Qa.X = window_odd_G128[j].X;
-				gf_neg(&Qa.W.w64, &window_odd_G128[j].W.w64);
-				CN(add_mixed)(&T, &T, &Qa);
-			}
-		}
+		add_naf_G(&T, window_naf_G, sd2[i]);
+		add_naf_G(&T, window_naf_G128, sd2[i + 128]);
 		if (sd3[i] != 0) {
 			if (sd3[i] > 0) {
 				j = sd3[i] >> 1;
@@ -357,3 +266,148 @@ CN(verify_helper_vartime)(const void *k0,
 	 */
 	return (int)CN(is_neutral)(&T);
 }
+
+/*
+ * Fill win[i] with (2*i+1)*P in affine coordinates, for i = 0..7. If P
+ * is the neutral, then all points are set to (0,0).
+ */
+static void
+window_fill_16odd_affine(CN(point_affine) *win, const CN(point) *P)
+{
+	CN(point) T, U;
+	gf zz[8], tmp[8];
+	int i;
+
+	win[0].X = P->X;
+	win[0].W = P->W;
+	zz[0] = P->Z.w64;
+	T = *P;
+	CN(double)(&U, &T);
+	for (i = 1; i < 8; i ++) {
+		CN(add)(&T, &T, &U);
+		win[i].X = T.X;
+		win[i].W = T.W;
+		zz[i] = T.Z.w64;
+	}
+	batch_affine_vartime(win, zz, tmp, 8);
+}
+
+/*
+ * Layout of a verification table: the point P itself (Jacobian
+ * coordinates), then the odd multiples of P (1*P to 15*P) in affine
+ * coordinates.
+ */
+#define VTAB_POINT(tab)   ((CN(point) *)(void *)(tab)->t)
+#define VTAB_WIN(tab)     ((CN(point_affine) *)(void *)((tab)->t + 3))
+
+/* see do255.h */
+void
+CN(verify_table_init)(CN(verify_table) *tab, const CN(point) *P)
+{
+	*VTAB_POINT(tab) = *P;
+	window_fill_16odd_affine(VTAB_WIN(tab), P);
+}
+
+/* see do255.h */
+int
+CN(verify_helper_table_vartime)(const void *k0,
+	const CN(verify_table) *tab, const void *k1, const void *R_enc)
+{
+	/*
+	 * This is CURVE_verify_helper_vartime(), except that the window
+	 * for P is read from the table. That window is for P, not -P;
+	 * when U3 = -P, we negate the digits of k3 instead.
+	 */
+	const CN(point_affine) *win3;
+	CN(point) U4, T;
+	CN(point_affine) win4[8], Qa;
+	uint8_t c0[17], c1[17];
+	i256 k2;
+	i128 k3, k4;
+	int8_t sd2[256], sd3[128], sd4[128];
+	int i, s3;
+
+	win3 = VTAB_WIN(tab);
+	if (!CN(decode_vartime)(&U4, R_enc)) {
+		return 0;
+	}
+	reduce_basis_vartime(c0, c1, k1);
+	i128_decode(&k3, c0);
+	i128_decode(&k4, c1);
+	s3 = (c0[16] ^ c1[16]) != 0 ? -1 : 1;
+	if (c0[16] != 0) {
+		unsigned char cc;
+
+		cc = _subborrow_u64(0, 0, k3.v0,
+			(unsigned long long *)&k3.v0);
+		(void)_subborrow_u64(cc, 0, k3.v1,
+			(unsigned long long *)&k3.v1);
+	}
+	if (c1[16] != 0) {
+		unsigned char cc;
+
+		cc = _subborrow_u64(0, 0, k4.v0,
+			(unsigned long long *)&k4.v0);
+		(void)_subborrow_u64(cc, 0, k4.v1,
+			(unsigned long long *)&k4.v1);
+	}
+	CN(neg)(&U4, &U4);
+	i256_decode(&k2, k0);
+	modr_mul256x128(&k2, &k2, &k4);
+
+	window_fill_16odd_affine(win4, &U4);
+	if (recode_NAFw_256(sd2, &k2, VRFY_NAF_WIN)) {
+		T.X = window_naf_G128[0].X;
+		T.W = window_naf_G128[0].W;
+		T.Z.w64 = GF_ONE;
+	} else {
+		T.X.w64 = GF_ZERO;
+		T.W.w64 = GF_ONE;
+		T.Z.w64 = GF_ZERO;
+	}
+	if (recode_NAF5_128(sd3, &k3)) {
+		Qa = win3[0];
+		if (s3 < 0) {
+			gf_neg(&Qa.W.w64, &Qa.W.w64);
+		}
+		CN(add_mixed)(&T, &T, &Qa);
+	}
+	if (recode_NAF5_128(sd4, &k4)) {
+		CN(add_mixed)(&T, &T, &win4[0]);
+	}
+
+	for (i = 127; i >= 0; i --) {
+		int j, d;
+
+		CN(double)(&T, &T);
+		add_naf_G(&T, window_naf_G, sd2[i]);
+		add_naf_G(&T, window_naf_G128, sd2[i + 128]);
+		d = sd3[i] * s3;
+		if (d != 0) {
+			if (d > 0) {
+				CN(add_mixed)(&T, &T, &win3[d >> 1]);
+			} else {
+				j = -d >> 1;
+				Qa.X = win3[j].X;
+				gf_neg(&Qa.W.w64, &win3[j].W.w64);
+				CN(add_mixed)(&T, &T, &Qa);
+			}
+		}
+		if (sd4[i] != 0) {
+			if (sd4[i] > 0) {
+				j = sd4[i] >> 1;
+				CN(add_mixed)(&T, &T, &win4[j]);
+			} else {
+				j = -sd4[i] >> 1;
+				Qa.X = win4[j].X;
+				gf_neg(&Qa.W.w64, &win4[j].W.w64);
+				CN(add_mixed)(&T, &T, &Qa);
+			}
+		}
+	}
+
+	return (int)CN(is_neutral)(&T);
+}
+
+#undef VTAB_POINT
+#undef VTAB_WIN
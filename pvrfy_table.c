@@ -0,0 +1,48 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - included <string.h> (for memset() and memcmp())
+ *  - defined CURVE_verify_helper_vartime(), CURVE_mulgen() and
+ *    CURVE_encode()
+ *  - defined CURVE to the curve name
+ *
+ * This file implements CURVE_verify_table_init() and
+ * CURVE_verify_helper_table_vartime() for the implementations with
+ * 32-bit limbs. The table only stores the (already decoded) point,
+ * which saves the decoding cost; the windows are still computed for
+ * each verification, since these implementations target small systems
+ * where RAM is scarce.
+ */
+
+/* see do255.h */
+void
+CN(verify_table_init)(CN(verify_table) *tab, const CN(point) *P)
+{
+	memset(tab, 0, sizeof *tab);
+	*(CN(point) *)(void *)tab->t = *P;
+}
+
+/* see do255.h */
+int
+CN(verify_helper_table_vartime)(const void *k0,
+	const CN(verify_table) *tab, const void *k1, const void *R_enc)
+{
+	const CN(point) *P;
+
+	/*
+	 * If P is the neutral, then the equation is k0*G = R; R_enc
+	 * must then be the (canonical) encoding of k0*G.
+	 */
+	P = (const CN(point) *)(const void *)tab->t;
+	if (CN(is_neutral)(P)) {
+		CN(point) T;
+		uint8_t tmp[32];
+
+		CN(mulgen)(&T, k0);
+		CN(encode)(tmp, &T);
+		return memcmp(tmp, R_enc, 32) == 0;
+	}
+	return CN(verify_helper_vartime)(k0, P, k1, R_enc);
+}
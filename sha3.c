@@ -8,6 +8,20 @@
 
 #include "sha3.h"
 
+/*
+ * If DO255_STATS is non-zero (see support.c), then each Keccak-f
+ * permutation is counted in the per-thread counters of do255_stats_get().
+ */
+#ifndef DO255_STATS
+#define DO255_STATS   0
+#endif
+#if DO255_STATS
+#include "do255_stats_internal.h"
+#define STATS_KECCAK(n)   (do255_stats_current.keccak += (n))
+#else
+#define STATS_KECCAK(n)   ((void)0)
+#endif
+
 /*
  * Round constants.
  */
@@ -27,10 +41,52 @@ static const uint64_t RC[] = {
 };
 
 /*
- * Process the provided state.
+ * SHA3_BMI2 selects the Keccak-f implementation: if non-zero, then the
+ * permutation from sha3_bmi2.c (for x86-64 with BMI1 and BMI2) is used;
+ * otherwise, the generic code below is used. Default is to use
+ * sha3_bmi2.c when the compiler is told that the target supports both
+ * BMI1 and BMI2 (e.g. with -march=haswell or later).
+ */
+#ifndef SHA3_BMI2
+#if (defined __GNUC__ || defined __clang__) && defined __x86_64__ \
+	&& defined __BMI__ && defined __BMI2__
+#define SHA3_BMI2   1
+#else
+#define SHA3_BMI2   0
+#endif
+#endif
+
+/*
+ * SHA3_AVX2 selects the implementation of the four-way permutation
+ * (process_block_x4(), used by the shake_x4_*() functions): if
+ * non-zero, then sha3_avx2.c is used; otherwise, the four states are
+ * processed one after the other with process_block(). Default is to
+ * use sha3_avx2.c when the compiler is told that the target supports
+ * AVX2.
+ */
+#ifndef SHA3_AVX2
+#if (defined __GNUC__ || defined __clang__) && defined __x86_64__ \
+	&& defined __AVX2__
+#define SHA3_AVX2   1
+#else
+#define SHA3_AVX2   0
+#endif
+#endif
+
+#if SHA3_BMI2
+
+#include "sha3_bmi2.c"
+
+#else
+
+/*
+ * Process the provided state: apply rounds r0 to 23 of Keccak-f[1600].
+ * With r0 = 0, this is the full permutation (SHA3, SHAKE); with
+ * r0 = 12, this is Keccak-p[1600,12] (TurboSHAKE, KangarooTwelve).
+ * r0 must be even.
  */
 static void
-process_block(uint64_t *A)
+process_block(uint64_t *A, int r0)
 {
 	uint64_t t0, t1, t2, t3, t4;
 	uint64_t tt0, tt1, tt2, tt3;
@@ -50,10 +106,10 @@ process_block(uint64_t *A)
 	A[20] = ~A[20];
 
 	/*
-	 * Compute the 24 rounds. This loop is partially unrolled (each
+	 * Compute the rounds. This loop is partially unrolled (each
 	 * iteration computes two rounds).
 	 */
-	for (j = 0; j < 24; j += 2) {
+	for (j = r0; j < 24; j += 2) {
 
 		tt0 = A[ 1] ^ A[ 6];
 		tt1 = A[11] ^ A[16];
@@ -457,6 +513,230 @@ process_block(uint64_t *A)
 	A[20] = ~A[20];
 }
 
+#endif
+
+#if SHA3_AVX2
+
+#include "sha3_avx2.c"
+
+#else
+
+/*
+ * Process the provided four interleaved states (see shake_x4_context),
+ * one at a time (rounds r0 to 23, as in process_block()).
+ */
+static void
+process_block_x4(uint64_t *A, int r0)
+{
+	uint64_t t[25];
+	int i, j;
+
+	for (j = 0; j < 4; j ++) {
+		for (i = 0; i < 25; i ++) {
+			t[i] = A[(i << 2) + j];
+		}
+		process_block(t, r0);
+		for (i = 0; i < 25; i ++) {
+			A[(i << 2) + j] = t[i];
+		}
+	}
+}
+
+#endif
+
+/*
+ * Decode a 64-bit integer from 8 bytes (little-endian). Compilers
+ * recognize this pattern and use a single (unaligned) load on
+ * little-endian architectures that support it.
+ */
+static inline uint64_t
+dec64le(const uint8_t *buf)
+{
+	return (uint64_t)buf[0]
+		| ((uint64_t)buf[1] << 8)
+		| ((uint64_t)buf[2] << 16)
+		| ((uint64_t)buf[3] << 24)
+		| ((uint64_t)buf[4] << 32)
+		| ((uint64_t)buf[5] << 40)
+		| ((uint64_t)buf[6] << 48)
+		| ((uint64_t)buf[7] << 56);
+}
+
+/*
+ * Encode a 64-bit integer into 8 bytes (little-endian).
+ */
+static inline void
+enc64le(uint8_t *buf, uint64_t x)
+{
+	buf[0] = (uint8_t)x;
+	buf[1] = (uint8_t)(x >> 8);
+	buf[2] = (uint8_t)(x >> 16);
+	buf[3] = (uint8_t)(x >> 24);
+	buf[4] = (uint8_t)(x >> 32);
+	buf[5] = (uint8_t)(x >> 40);
+	buf[6] = (uint8_t)(x >> 48);
+	buf[7] = (uint8_t)(x >> 56);
+}
+
+/*
+ * XOR len bytes from buf into the state, starting at byte offset off.
+ * Whole lanes are processed with 64-bit words; only the bytes before
+ * the first lane boundary and after the last one are handled one by
+ * one.
+ */
+static void
+xor_bytes(uint64_t *A, size_t off, const uint8_t *buf, size_t len)
+{
+	while (len > 0 && (off & 7) != 0) {
+		A[off >> 3] ^= (uint64_t)*buf ++ << ((off & 7) << 3);
+		off ++;
+		len --;
+	}
+	while (len >= 8) {
+		A[off >> 3] ^= dec64le(buf);
+		buf += 8;
+		off += 8;
+		len -= 8;
+	}
+	while (len > 0) {
+		A[off >> 3] ^= (uint64_t)*buf ++ << ((off & 7) << 3);
+		off ++;
+		len --;
+	}
+}
+
+/*
+ * Copy len bytes from the state, starting at byte offset off, into
+ * buf. Whole lanes are processed with 64-bit words, as in xor_bytes().
+ */
+static void
+copy_bytes(uint8_t *buf, const uint64_t *A, size_t off, size_t len)
+{
+	while (len > 0 && (off & 7) != 0) {
+		*buf ++ = (uint8_t)(A[off >> 3] >> ((off & 7) << 3));
+		off ++;
+		len --;
+	}
+	while (len >= 8) {
+		enc64le(buf, A[off >> 3]);
+		buf += 8;
+		off += 8;
+		len -= 8;
+	}
+	while (len > 0) {
+		*buf ++ = (uint8_t)(A[off >> 3] >> ((off & 7) << 3));
+		off ++;
+		len --;
+	}
+}
+
+/*
+ * Sponge operations, shared by SHAKE, SHA3 and TurboSHAKE. Parameter
+ * r0 selects the permutation (see process_block()).
+ */
+static void
+sponge_inject(shake_context *sc, const void *in, size_t len, int r0)
+{
+	size_t dptr, rate;
+	const uint8_t *buf;
+
+	dptr = sc->dptr;
+	rate = sc->rate;
+	buf = in;
+
+	/*
+	 * Complete the current partial block, if any.
+	 */
+	if (dptr > 0) {
+		size_t clen;
+
+		clen = rate - dptr;
+		if (clen > len) {
+			clen = len;
+		}
+		xor_bytes(sc->A, dptr, buf, clen);
+		dptr += clen;
+		buf += clen;
+		len -= clen;
+		if (dptr < rate) {
+			sc->dptr = dptr;
+			return;
+		}
+		STATS_KECCAK(1);
+		process_block(sc->A, r0);
+		dptr = 0;
+	}
+
+	/*
+	 * Bulk path: full blocks are absorbed directly (the rate is
+	 * always a multiple of 8, so this is whole lanes only).
+	 */
+	while (len >= rate) {
+		xor_bytes(sc->A, 0, buf, rate);
+		STATS_KECCAK(1);
+		process_block(sc->A, r0);
+		buf += rate;
+		len -= rate;
+	}
+
+	/*
+	 * Remaining bytes start a new partial block.
+	 */
+	xor_bytes(sc->A, 0, buf, len);
+	sc->dptr = len;
+}
+
+/*
+ * Apply the padding with the provided domain separation byte (0x1F for
+ * SHAKE, 0x06 for SHA3, caller-provided for TurboSHAKE) and switch to
+ * output mode.
+ */
+static void
+sponge_flip(shake_context *sc, unsigned ds)
+{
+	/*
+	 * We apply padding and pre-XOR the value into the state. We
+	 * set dptr to the end of the buffer, so that first call to
+	 * sponge_extract() will process the block.
+	 */
+	unsigned v;
+
+	v = (unsigned)sc->dptr;
+	sc->A[v >> 3] ^= (uint64_t)ds << ((v & 7) << 3);
+	v = (unsigned)(sc->rate - 1);
+	sc->A[v >> 3] ^= (uint64_t)0x80 << ((v & 7) << 3);
+	sc->dptr = sc->rate;
+}
+
+static void
+sponge_extract(shake_context *sc, void *out, size_t len, int r0)
+{
+	size_t dptr, rate;
+	uint8_t *buf;
+
+	dptr = sc->dptr;
+	rate = sc->rate;
+	buf = out;
+	while (len > 0) {
+		size_t clen;
+
+		if (dptr == rate) {
+			STATS_KECCAK(1);
+			process_block(sc->A, r0);
+			dptr = 0;
+		}
+		clen = rate - dptr;
+		if (clen > len) {
+			clen = len;
+		}
+		copy_bytes(buf, sc->A, dptr, clen);
+		dptr += clen;
+		buf += clen;
+		len -= clen;
+	}
+	sc->dptr = dptr;
+}
+
 /* see sha3.h */
 void
 shake_init(shake_context *sc, unsigned size)
@@ -470,85 +750,195 @@ shake_init(shake_context *sc, unsigned size)
 void
 shake_inject(shake_context *sc, const void *in, size_t len)
 {
+	sponge_inject(sc, in, len, 0);
+}
+
+/* see sha3.h */
+void
+shake_flip(shake_context *sc)
+{
+	sponge_flip(sc, 0x1F);
+}
+
+/* see sha3.h */
+void
+shake_extract(shake_context *sc, void *out, size_t len)
+{
+	sponge_extract(sc, out, len, 0);
+}
+
+/*
+ * XOR len bytes from buf into state j of four interleaved states,
+ * starting at byte offset off (same as xor_bytes()).
+ */
+static void
+xor_bytes_x4(uint64_t *A, int j, size_t off, const uint8_t *buf, size_t len)
+{
+	while (len > 0 && (off & 7) != 0) {
+		A[((off >> 3) << 2) + j] ^=
+			(uint64_t)*buf ++ << ((off & 7) << 3);
+		off ++;
+		len --;
+	}
+	while (len >= 8) {
+		A[((off >> 3) << 2) + j] ^= dec64le(buf);
+		buf += 8;
+		off += 8;
+		len -= 8;
+	}
+	while (len > 0) {
+		A[((off >> 3) << 2) + j] ^=
+			(uint64_t)*buf ++ << ((off & 7) << 3);
+		off ++;
+		len --;
+	}
+}
+
+/*
+ * Copy len bytes from state j of four interleaved states, starting at
+ * byte offset off, into buf (same as copy_bytes()).
+ */
+static void
+copy_bytes_x4(uint8_t *buf, const uint64_t *A, int j, size_t off, size_t len)
+{
+	while (len > 0 && (off & 7) != 0) {
+		*buf ++ = (uint8_t)(A[((off >> 3) << 2) + j]
+			>> ((off & 7) << 3));
+		off ++;
+		len --;
+	}
+	while (len >= 8) {
+		enc64le(buf, A[((off >> 3) << 2) + j]);
+		buf += 8;
+		off += 8;
+		len -= 8;
+	}
+	while (len > 0) {
+		*buf ++ = (uint8_t)(A[((off >> 3) << 2) + j]
+			>> ((off & 7) << 3));
+		off ++;
+		len --;
+	}
+}
+
+/*
+ * Four-way sponge operations (same as sponge_inject(), sponge_flip()
+ * and sponge_extract(), on four interleaved states).
+ */
+static void
+sponge_x4_inject(shake_x4_context *sc,
+	const void *const *in, size_t len, int r0)
+{
+	const uint8_t *buf[4];
 	size_t dptr, rate;
-	const uint8_t *buf;
+	int j;
 
+	for (j = 0; j < 4; j ++) {
+		buf[j] = in[j];
+	}
 	dptr = sc->dptr;
 	rate = sc->rate;
-	buf = in;
 	while (len > 0) {
-		size_t clen, u;
+		size_t clen;
 
 		clen = rate - dptr;
 		if (clen > len) {
 			clen = len;
 		}
-		for (u = 0; u < clen; u ++) {
-			size_t v;
-
-			v = u + dptr;
-			sc->A[v >> 3] ^= (uint64_t)buf[u] << ((v & 7) << 3);
+		for (j = 0; j < 4; j ++) {
+			xor_bytes_x4(sc->A, j, dptr, buf[j], clen);
+			buf[j] += clen;
 		}
 		dptr += clen;
-		buf += clen;
 		len -= clen;
 		if (dptr == rate) {
-			process_block(sc->A);
+			STATS_KECCAK(4);
+			process_block_x4(sc->A, r0);
 			dptr = 0;
 		}
 	}
 	sc->dptr = dptr;
 }
 
-/* see sha3.h */
-void
-shake_flip(shake_context *sc)
+static void
+sponge_x4_flip(shake_x4_context *sc, unsigned ds)
 {
-	/*
-	 * We apply padding and pre-XOR the value into the state. We
-	 * set dptr to the end of the buffer, so that first call to
-	 * shake_extract() will process the block.
-	 */
 	unsigned v;
+	int j;
 
-	v = (unsigned)sc->dptr;
-	sc->A[v >> 3] ^= (uint64_t)0x1F << ((v & 7) << 3);
-	v = (unsigned)(sc->rate - 1);
-	sc->A[v >> 3] ^= (uint64_t)0x80 << ((v & 7) << 3);
+	for (j = 0; j < 4; j ++) {
+		v = (unsigned)sc->dptr;
+		sc->A[((v >> 3) << 2) + j] ^= (uint64_t)ds << ((v & 7) << 3);
+		v = (unsigned)(sc->rate - 1);
+		sc->A[((v >> 3) << 2) + j] ^= (uint64_t)0x80 << ((v & 7) << 3);
+	}
 	sc->dptr = sc->rate;
 }
 
-/* see sha3.h */
-void
-shake_extract(shake_context *sc, void *out, size_t len)
+static void
+sponge_x4_extract(shake_x4_context *sc, void *const *out, size_t len, int r0)
 {
+	uint8_t *buf[4];
 	size_t dptr, rate;
-	uint8_t *buf;
+	int j;
 
+	for (j = 0; j < 4; j ++) {
+		buf[j] = out[j];
+	}
 	dptr = sc->dptr;
 	rate = sc->rate;
-	buf = out;
 	while (len > 0) {
 		size_t clen;
 
 		if (dptr == rate) {
-			process_block(sc->A);
+			STATS_KECCAK(4);
+			process_block_x4(sc->A, r0);
 			dptr = 0;
 		}
 		clen = rate - dptr;
 		if (clen > len) {
 			clen = len;
 		}
-		len -= clen;
-		while (clen -- > 0) {
-			*buf ++ = (uint8_t)
-				(sc->A[dptr >> 3] >> ((dptr & 7) << 3));
-			dptr ++;
+		for (j = 0; j < 4; j ++) {
+			copy_bytes_x4(buf[j], sc->A, j, dptr, clen);
+			buf[j] += clen;
 		}
+		dptr += clen;
+		len -= clen;
 	}
 	sc->dptr = dptr;
 }
 
+/* see sha3.h */
+void
+shake_x4_init(shake_x4_context *sc, unsigned size)
+{
+	sc->rate = 200 - (size_t)(size >> 2);
+	sc->dptr = 0;
+	memset(sc->A, 0, sizeof sc->A);
+}
+
+/* see sha3.h */
+void
+shake_x4_inject(shake_x4_context *sc, const void *const *in, size_t len)
+{
+	sponge_x4_inject(sc, in, len, 0);
+}
+
+/* see sha3.h */
+void
+shake_x4_flip(shake_x4_context *sc)
+{
+	sponge_x4_flip(sc, 0x1F);
+}
+
+/* see sha3.h */
+void
+shake_x4_extract(shake_x4_context *sc, void *const *out, size_t len)
+{
+	sponge_x4_extract(sc, out, len, 0);
+}
+
 /* see sha3.h */
 void
 sha3_init(sha3_context *sc, unsigned size)
@@ -567,30 +957,217 @@ sha3_update(sha3_context *sc, const void *in, size_t len)
 void
 sha3_close(sha3_context *sc, void *out)
 {
-	unsigned v;
-	uint8_t *buf;
-	size_t u, len;
-
 	/*
-	 * Apply padding. It differs from the SHAKE padding in that
-	 * we append '01', not '1111'.
+	 * The SHA3 padding differs from the SHAKE padding in that we
+	 * append '01', not '1111'. Output length (in bytes) is obtained
+	 * from the rate.
 	 */
-	v = (unsigned)sc->dptr;
-	sc->A[v >> 3] ^= (uint64_t)0x06 << ((v & 7) << 3);
-	v = (unsigned)(sc->rate - 1);
-	sc->A[v >> 3] ^= (uint64_t)0x80 << ((v & 7) << 3);
+	sponge_flip(sc, 0x06);
+	sponge_extract(sc, out, (200 - sc->rate) >> 1, 0);
+}
 
-	/*
-	 * Process the padded block.
-	 */
-	process_block(sc->A);
+/* see sha3.h */
+void
+turboshake_init(turboshake_context *sc, unsigned size)
+{
+	shake_init(sc, size);
+}
 
-	/*
-	 * Write output. Output length (in bytes) is obtained from the rate.
-	 */
-	buf = out;
-	len = (200 - sc->rate) >> 1;
-	for (u = 0; u < len; u ++) {
-		buf[u] = (uint8_t)(sc->A[u >> 3] >> ((u & 7) << 3));
+/* see sha3.h */
+void
+turboshake_inject(turboshake_context *sc, const void *in, size_t len)
+{
+	sponge_inject(sc, in, len, 12);
+}
+
+/* see sha3.h */
+void
+turboshake_flip(turboshake_context *sc, unsigned ds)
+{
+	sponge_flip(sc, ds);
+}
+
+/* see sha3.h */
+void
+turboshake_extract(turboshake_context *sc, void *out, size_t len)
+{
+	sponge_extract(sc, out, len, 12);
+}
+
+/*
+ * KangarooTwelve (KT128) chunk size, in bytes.
+ */
+#define KT_CHUNK   8192
+
+/*
+ * Encode x with the length_encode() function of KangarooTwelve: the
+ * minimal big-endian encoding of x, followed by its length (one byte).
+ * Output is at most 9 bytes; the output length is returned.
+ */
+static size_t
+kt_length_encode(uint8_t *buf, uint64_t x)
+{
+	size_t n, u;
+
+	n = 0;
+	while (n < 8 && (x >> (n << 3)) != 0) {
+		n ++;
+	}
+	for (u = 0; u < n; u ++) {
+		buf[u] = (uint8_t)(x >> ((n - 1 - u) << 3));
+	}
+	buf[n] = (uint8_t)n;
+	return n + 1;
+}
+
+/*
+ * Finish the current leaf; its chaining value is injected into the
+ * final node.
+ */
+static void
+kt128_leaf_close(kt128_context *kc)
+{
+	uint8_t cv[32];
+
+	sponge_flip(&kc->leaf, 0x0B);
+	sponge_extract(&kc->leaf, cv, sizeof cv, 12);
+	sponge_inject(&kc->node, cv, sizeof cv, 12);
+	kc->num_leaves ++;
+}
+
+#if SHA3_AVX2
+/*
+ * Process four complete leaves (4*KT_CHUNK bytes from buf) with the
+ * four-way permutation, and inject their chaining values into the
+ * final node. This is used only when the four-way permutation is
+ * native (with the generic process_block_x4(), leaves are faster to
+ * process one at a time).
+ */
+static void
+kt128_leaves_x4(kt128_context *kc, const uint8_t *buf)
+{
+	shake_x4_context sx;
+	const void *in[4];
+	void *out[4];
+	uint8_t cv[4][32];
+	int j;
+
+	shake_x4_init(&sx, 128);
+	for (j = 0; j < 4; j ++) {
+		in[j] = buf + (size_t)j * KT_CHUNK;
+		out[j] = cv[j];
 	}
+	sponge_x4_inject(&sx, in, KT_CHUNK, 12);
+	sponge_x4_flip(&sx, 0x0B);
+	sponge_x4_extract(&sx, out, sizeof cv[0], 12);
+	sponge_inject(&kc->node, cv, sizeof cv, 12);
+	kc->num_leaves += 4;
+}
+#endif
+
+/* see sha3.h */
+void
+kt128_init(kt128_context *kc)
+{
+	shake_init(&kc->node, 128);
+	kc->num_leaves = 0;
+	kc->cptr = 0;
+	kc->tree = 0;
+}
+
+/* see sha3.h */
+void
+kt128_inject(kt128_context *kc, const void *in, size_t len)
+{
+	const uint8_t *buf;
+	size_t cptr;
+
+	buf = in;
+	cptr = kc->cptr;
+	while (len > 0) {
+		size_t clen;
+
+		if (!kc->tree) {
+			/*
+			 * The first chunk goes directly into the final
+			 * node. If more data follows a full first chunk,
+			 * then we switch to tree mode.
+			 */
+			if (cptr == KT_CHUNK) {
+				static const uint8_t marker[8] = { 0x03 };
+
+				sponge_inject(&kc->node, marker, 8, 12);
+				kc->tree = 1;
+				cptr = 0;
+				continue;
+			}
+			clen = KT_CHUNK - cptr;
+			if (clen > len) {
+				clen = len;
+			}
+			sponge_inject(&kc->node, buf, clen, 12);
+			cptr += clen;
+		} else {
+#if SHA3_AVX2
+			/*
+			 * Leaves are processed four at a time when
+			 * enough data is available.
+			 */
+			if (cptr == 0 && len >= 4 * KT_CHUNK) {
+				kt128_leaves_x4(kc, buf);
+				buf += 4 * KT_CHUNK;
+				len -= 4 * KT_CHUNK;
+				continue;
+			}
+#endif
+			if (cptr == 0) {
+				shake_init(&kc->leaf, 128);
+			}
+			clen = KT_CHUNK - cptr;
+			if (clen > len) {
+				clen = len;
+			}
+			sponge_inject(&kc->leaf, buf, clen, 12);
+			cptr += clen;
+			if (cptr == KT_CHUNK) {
+				kt128_leaf_close(kc);
+				cptr = 0;
+			}
+		}
+		buf += clen;
+		len -= clen;
+	}
+	kc->cptr = cptr;
+}
+
+/* see sha3.h */
+void
+kt128_flip(kt128_context *kc, const void *custom, size_t custom_len)
+{
+	uint8_t tmp[11];
+	size_t n;
+
+	kt128_inject(kc, custom, custom_len);
+	n = kt_length_encode(tmp, custom_len);
+	kt128_inject(kc, tmp, n);
+	if (!kc->tree) {
+		sponge_flip(&kc->node, 0x07);
+		return;
+	}
+	if (kc->cptr > 0) {
+		kt128_leaf_close(kc);
+		kc->cptr = 0;
+	}
+	n = kt_length_encode(tmp, kc->num_leaves);
+	tmp[n ++] = 0xFF;
+	tmp[n ++] = 0xFF;
+	sponge_inject(&kc->node, tmp, n, 12);
+	sponge_flip(&kc->node, 0x06);
+}
+
+/* see sha3.h */
+void
+kt128_extract(kt128_context *kc, void *out, size_t len)
+{
+	sponge_extract(&kc->node, out, len, 12);
 }
@@ -57,6 +57,44 @@ void shake_flip(shake_context *sc);
  */
 void shake_extract(shake_context *sc, void *out, size_t len);
 
+/*
+ * Context for four parallel SHAKE computations. Contents are opaque.
+ * The four states are interleaved: lane i of state j is A[4*i + j],
+ * so that they can be processed with SIMD registers (AVX2, when
+ * available at compile time). Like shake_context, this structure
+ * contains no pointer and can be cloned by copying.
+ */
+typedef struct {
+	uint64_t A[100];
+	size_t dptr, rate;
+} shake_x4_context;
+
+/*
+ * Initialize four SHAKE states at once (as with shake_init()). All
+ * four states use the same SHAKE variant.
+ */
+void shake_x4_init(shake_x4_context *sc, unsigned size);
+
+/*
+ * Inject data into the four states: in[j] points to len bytes to
+ * inject into state j. All four states always receive the same number
+ * of bytes; the four pointers may be equal (e.g. for a common domain
+ * separation string).
+ */
+void shake_x4_inject(shake_x4_context *sc,
+	const void *const *in, size_t len);
+
+/*
+ * Flip the four states to output mode (as with shake_flip()).
+ */
+void shake_x4_flip(shake_x4_context *sc);
+
+/*
+ * Extract len bytes from each of the four states: out[j] receives the
+ * output of state j. The four output buffers must not overlap.
+ */
+void shake_x4_extract(shake_x4_context *sc, void *const *out, size_t len);
+
 /*
  * Context for SHA3 computations. Contents are opaque.
  * A running state can be cloned by copying the structure; this is
@@ -86,6 +124,78 @@ void sha3_update(sha3_context *sc, const void *in, size_t len);
  */
 void sha3_close(sha3_context *sc, void *out);
 
+/*
+ * Context for TurboSHAKE computations (RFC 9861). TurboSHAKE is SHAKE
+ * with the Keccak-p[1600,12] permutation (12 rounds instead of 24),
+ * and a caller-chosen domain separation byte. Contents are opaque, and
+ * can be cloned by copying, as with shake_context.
+ */
+typedef shake_context turboshake_context;
+
+/*
+ * Initialize a TurboSHAKE context; size is 128 for TurboSHAKE128, 256
+ * for TurboSHAKE256.
+ */
+void turboshake_init(turboshake_context *sc, unsigned size);
+
+/*
+ * Inject some data bytes into the TurboSHAKE context.
+ */
+void turboshake_inject(turboshake_context *sc, const void *in, size_t len);
+
+/*
+ * Flip the TurboSHAKE context to output mode. The domain separation
+ * byte ds must be in the 0x01 to 0x7F range (0x1F is the default value
+ * of RFC 9861).
+ */
+void turboshake_flip(turboshake_context *sc, unsigned ds);
+
+/*
+ * Extract bytes from the TurboSHAKE context (after flipping).
+ */
+void turboshake_extract(turboshake_context *sc, void *out, size_t len);
+
+/*
+ * Context for KangarooTwelve (KT128, RFC 9861). Contents are opaque.
+ * Input is split into 8192-byte chunks; beyond the first chunk, chunks
+ * are hashed independently (as "leaves") with TurboSHAKE128, and only
+ * their 32-byte chaining values go through the final node. Thus, when
+ * large amounts of data are injected at once, leaves are hashed four
+ * at a time with the four-way permutation (see shake_x4_context).
+ * Contents are pure data and the context can be cloned by copying.
+ */
+typedef struct {
+	shake_context node, leaf;
+	uint64_t num_leaves;
+	size_t cptr;
+	int tree;
+} kt128_context;
+
+/*
+ * Initialize a KT128 context.
+ */
+void kt128_init(kt128_context *kc);
+
+/*
+ * Inject some message bytes into the KT128 context. Injecting data in
+ * chunks of at least 32768 bytes (with all previous chunks having a
+ * total length that is multiple of 8192) allows the four-way
+ * processing of leaves.
+ */
+void kt128_inject(kt128_context *kc, const void *in, size_t len);
+
+/*
+ * Flip the KT128 context to output mode. The customization string
+ * (custom[], of length custom_len bytes) is appended to the message;
+ * it may be empty (custom_len = 0, and custom may be NULL).
+ */
+void kt128_flip(kt128_context *kc, const void *custom, size_t custom_len);
+
+/*
+ * Extract bytes from the KT128 context (after flipping).
+ */
+void kt128_extract(kt128_context *kc, void *out, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
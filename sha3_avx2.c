@@ -0,0 +1,183 @@
+/*
+ * Four-way Keccak-f[1600] permutation for x86-64 CPUs with AVX2.
+ *
+ * This file is meant to be included, not compiled by itself; it is
+ * included by sha3.c (which then does not define its generic
+ * process_block_x4()) when SHA3_AVX2 is non-zero. The four states are
+ * interleaved (see shake_x4_context in sha3.h): each 256-bit register
+ * holds the same lane of the four states. As in sha3_bmi2.c, the state
+ * is kept in two sets of 25 local variables, used alternately as
+ * source and destination of each round. AVX2 has no 64-bit rotate
+ * opcode; rotations are shifts and an OR, except rotations by 8 and
+ * 56 bits, which are byte shuffles.
+ */
+
+#include <immintrin.h>
+
+#define XOR4(x, y)    _mm256_xor_si256(x, y)
+#define ANDN4(x, y)   _mm256_andnot_si256(x, y)
+#define ROL4(x, n)    _mm256_or_si256( \
+		_mm256_slli_epi64(x, n), _mm256_srli_epi64(x, 64 - (n)))
+#define ROL4_8(x)     _mm256_shuffle_epi8(x, rot8)
+#define ROL4_56(x)    _mm256_shuffle_epi8(x, rot56)
+
+/*
+ * One round: state E receives the image of state A, with round
+ * constant rc (broadcast to the four states).
+ */
+#define KECCAK_ROUND_X4(A, E, rc)   do { \
+		__m256i c0, c1, c2, c3, c4, d0, d1, d2, d3, d4; \
+		__m256i b0, b1, b2, b3, b4; \
+		c0 = XOR4(XOR4(A ## 00, A ## 05), \
+			XOR4(XOR4(A ## 10, A ## 15), A ## 20)); \
+		c1 = XOR4(XOR4(A ## 01, A ## 06), \
+			XOR4(XOR4(A ## 11, A ## 16), A ## 21)); \
+		c2 = XOR4(XOR4(A ## 02, A ## 07), \
+			XOR4(XOR4(A ## 12, A ## 17), A ## 22)); \
+		c3 = XOR4(XOR4(A ## 03, A ## 08), \
+			XOR4(XOR4(A ## 13, A ## 18), A ## 23)); \
+		c4 = XOR4(XOR4(A ## 04, A ## 09), \
+			XOR4(XOR4(A ## 14, A ## 19), A ## 24)); \
+		d0 = XOR4(c4, ROL4(c1, 1)); \
+		d1 = XOR4(c0, ROL4(c2, 1)); \
+		d2 = XOR4(c1, ROL4(c3, 1)); \
+		d3 = XOR4(c2, ROL4(c4, 1)); \
+		d4 = XOR4(c3, ROL4(c0, 1)); \
+		b0 = XOR4(A ## 00, d0); \
+		b1 = ROL4(XOR4(A ## 06, d1), 44); \
+		b2 = ROL4(XOR4(A ## 12, d2), 43); \
+		b3 = ROL4(XOR4(A ## 18, d3), 21); \
+		b4 = ROL4(XOR4(A ## 24, d4), 14); \
+		E ## 00 = XOR4(XOR4(b0, ANDN4(b1, b2)), rc); \
+		E ## 01 = XOR4(b1, ANDN4(b2, b3)); \
+		E ## 02 = XOR4(b2, ANDN4(b3, b4)); \
+		E ## 03 = XOR4(b3, ANDN4(b4, b0)); \
+		E ## 04 = XOR4(b4, ANDN4(b0, b1)); \
+		b0 = ROL4(XOR4(A ## 03, d3), 28); \
+		b1 = ROL4(XOR4(A ## 09, d4), 20); \
+		b2 = ROL4(XOR4(A ## 10, d0), 3); \
+		b3 = ROL4(XOR4(A ## 16, d1), 45); \
+		b4 = ROL4(XOR4(A ## 22, d2), 61); \
+		E ## 05 = XOR4(b0, ANDN4(b1, b2)); \
+		E ## 06 = XOR4(b1, ANDN4(b2, b3)); \
+		E ## 07 = XOR4(b2, ANDN4(b3, b4)); \
+		E ## 08 = XOR4(b3, ANDN4(b4, b0)); \
+		E ## 09 = XOR4(b4, ANDN4(b0, b1)); \
+		b0 = ROL4(XOR4(A ## 01, d1), 1); \
+		b1 = ROL4(XOR4(A ## 07, d2), 6); \
+		b2 = ROL4(XOR4(A ## 13, d3), 25); \
+		b3 = ROL4_8(XOR4(A ## 19, d4)); \
+		b4 = ROL4(XOR4(A ## 20, d0), 18); \
+		E ## 10 = XOR4(b0, ANDN4(b1, b2)); \
+		E ## 11 = XOR4(b1, ANDN4(b2, b3)); \
+		E ## 12 = XOR4(b2, ANDN4(b3, b4)); \
+		E ## 13 = XOR4(b3, ANDN4(b4, b0)); \
+		E ## 14 = XOR4(b4, ANDN4(b0, b1)); \
+		b0 = ROL4(XOR4(A ## 04, d4), 27); \
+		b1 = ROL4(XOR4(A ## 05, d0), 36); \
+		b2 = ROL4(XOR4(A ## 11, d1), 10); \
+		b3 = ROL4(XOR4(A ## 17, d2), 15); \
+		b4 = ROL4_56(XOR4(A ## 23, d3)); \
+		E ## 15 = XOR4(b0, ANDN4(b1, b2)); \
+		E ## 16 = XOR4(b1, ANDN4(b2, b3)); \
+		E ## 17 = XOR4(b2, ANDN4(b3, b4)); \
+		E ## 18 = XOR4(b3, ANDN4(b4, b0)); \
+		E ## 19 = XOR4(b4, ANDN4(b0, b1)); \
+		b0 = ROL4(XOR4(A ## 02, d2), 62); \
+		b1 = ROL4(XOR4(A ## 08, d3), 55); \
+		b2 = ROL4(XOR4(A ## 14, d4), 39); \
+		b3 = ROL4(XOR4(A ## 15, d0), 41); \
+		b4 = ROL4(XOR4(A ## 21, d1), 2); \
+		E ## 20 = XOR4(b0, ANDN4(b1, b2)); \
+		E ## 21 = XOR4(b1, ANDN4(b2, b3)); \
+		E ## 22 = XOR4(b2, ANDN4(b3, b4)); \
+		E ## 23 = XOR4(b3, ANDN4(b4, b0)); \
+		E ## 24 = XOR4(b4, ANDN4(b0, b1)); \
+	} while (0)
+
+#define KECCAK_LOAD_X4(S)   do { \
+		S ## 00 = _mm256_loadu_si256((const __m256i *)A +  0); \
+		S ## 01 = _mm256_loadu_si256((const __m256i *)A +  1); \
+		S ## 02 = _mm256_loadu_si256((const __m256i *)A +  2); \
+		S ## 03 = _mm256_loadu_si256((const __m256i *)A +  3); \
+		S ## 04 = _mm256_loadu_si256((const __m256i *)A +  4); \
+		S ## 05 = _mm256_loadu_si256((const __m256i *)A +  5); \
+		S ## 06 = _mm256_loadu_si256((const __m256i *)A +  6); \
+		S ## 07 = _mm256_loadu_si256((const __m256i *)A +  7); \
+		S ## 08 = _mm256_loadu_si256((const __m256i *)A +  8); \
+		S ## 09 = _mm256_loadu_si256((const __m256i *)A +  9); \
+		S ## 10 = _mm256_loadu_si256((const __m256i *)A + 10); \
+		S ## 11 = _mm256_loadu_si256((const __m256i *)A + 11); \
+		S ## 12 = _mm256_loadu_si256((const __m256i *)A + 12); \
+		S ## 13 = _mm256_loadu_si256((const __m256i *)A + 13); \
+		S ## 14 = _mm256_loadu_si256((const __m256i *)A + 14); \
+		S ## 15 = _mm256_loadu_si256((const __m256i *)A + 15); \
+		S ## 16 = _mm256_loadu_si256((const __m256i *)A + 16); \
+		S ## 17 = _mm256_loadu_si256((const __m256i *)A + 17); \
+		S ## 18 = _mm256_loadu_si256((const __m256i *)A + 18); \
+		S ## 19 = _mm256_loadu_si256((const __m256i *)A + 19); \
+		S ## 20 = _mm256_loadu_si256((const __m256i *)A + 20); \
+		S ## 21 = _mm256_loadu_si256((const __m256i *)A + 21); \
+		S ## 22 = _mm256_loadu_si256((const __m256i *)A + 22); \
+		S ## 23 = _mm256_loadu_si256((const __m256i *)A + 23); \
+		S ## 24 = _mm256_loadu_si256((const __m256i *)A + 24); \
+	} while (0)
+
+#define KECCAK_STORE_X4(S)   do { \
+		_mm256_storeu_si256((__m256i *)A +  0, S ## 00); \
+		_mm256_storeu_si256((__m256i *)A +  1, S ## 01); \
+		_mm256_storeu_si256((__m256i *)A +  2, S ## 02); \
+		_mm256_storeu_si256((__m256i *)A +  3, S ## 03); \
+		_mm256_storeu_si256((__m256i *)A +  4, S ## 04); \
+		_mm256_storeu_si256((__m256i *)A +  5, S ## 05); \
+		_mm256_storeu_si256((__m256i *)A +  6, S ## 06); \
+		_mm256_storeu_si256((__m256i *)A +  7, S ## 07); \
+		_mm256_storeu_si256((__m256i *)A +  8, S ## 08); \
+		_mm256_storeu_si256((__m256i *)A +  9, S ## 09); \
+		_mm256_storeu_si256((__m256i *)A + 10, S ## 10); \
+		_mm256_storeu_si256((__m256i *)A + 11, S ## 11); \
+		_mm256_storeu_si256((__m256i *)A + 12, S ## 12); \
+		_mm256_storeu_si256((__m256i *)A + 13, S ## 13); \
+		_mm256_storeu_si256((__m256i *)A + 14, S ## 14); \
+		_mm256_storeu_si256((__m256i *)A + 15, S ## 15); \
+		_mm256_storeu_si256((__m256i *)A + 16, S ## 16); \
+		_mm256_storeu_si256((__m256i *)A + 17, S ## 17); \
+		_mm256_storeu_si256((__m256i *)A + 18, S ## 18); \
+		_mm256_storeu_si256((__m256i *)A + 19, S ## 19); \
+		_mm256_storeu_si256((__m256i *)A + 20, S ## 20); \
+		_mm256_storeu_si256((__m256i *)A + 21, S ## 21); \
+		_mm256_storeu_si256((__m256i *)A + 22, S ## 22); \
+		_mm256_storeu_si256((__m256i *)A + 23, S ## 23); \
+		_mm256_storeu_si256((__m256i *)A + 24, S ## 24); \
+	} while (0)
+
+/*
+ * Process the provided four interleaved states (rounds r0 to 23, see
+ * sha3.c).
+ */
+static void
+process_block_x4(uint64_t *A, int r0)
+{
+	__m256i a00, a01, a02, a03, a04, a05, a06, a07, a08, a09;
+	__m256i a10, a11, a12, a13, a14, a15, a16, a17, a18, a19;
+	__m256i a20, a21, a22, a23, a24;
+	__m256i e00, e01, e02, e03, e04, e05, e06, e07, e08, e09;
+	__m256i e10, e11, e12, e13, e14, e15, e16, e17, e18, e19;
+	__m256i e20, e21, e22, e23, e24;
+	__m256i rot8, rot56;
+	int j;
+
+	rot8 = _mm256_setr_epi8(
+		7, 0, 1, 2, 3, 4, 5, 6, 15, 8, 9, 10, 11, 12, 13, 14,
+		7, 0, 1, 2, 3, 4, 5, 6, 15, 8, 9, 10, 11, 12, 13, 14);
+	rot56 = _mm256_setr_epi8(
+		1, 2, 3, 4, 5, 6, 7, 0, 9, 10, 11, 12, 13, 14, 15, 8,
+		1, 2, 3, 4, 5, 6, 7, 0, 9, 10, 11, 12, 13, 14, 15, 8);
+	KECCAK_LOAD_X4(a);
+	for (j = r0; j < 24; j += 2) {
+		KECCAK_ROUND_X4(a, e, _mm256_set1_epi64x((long long)RC[j]));
+		KECCAK_ROUND_X4(e, a,
+			_mm256_set1_epi64x((long long)RC[j + 1]));
+	}
+	KECCAK_STORE_X4(a);
+}
@@ -0,0 +1,134 @@
+/*
+ * Keccak-f[1600] permutation for x86-64 CPUs with BMI1 and BMI2.
+ *
+ * This file is meant to be included, not compiled by itself; it is
+ * included by sha3.c (which then does not define its generic
+ * process_block()) when SHA3_BMI2 is non-zero. The state is kept in 25
+ * local variables (two copies, used alternately as source and
+ * destination of each round), so that the pi step is a renaming and
+ * not a sequence of memory moves. The chi step uses the ANDN opcode,
+ * which computes (~x & y) in a single instruction; thus, the plain
+ * representation of the state needs no NOT at all, and the lane
+ * complementing trick of the generic code is not needed. Constant
+ * rotations are compiled into RORX, which does not overwrite its
+ * source operand.
+ */
+
+#include <immintrin.h>
+
+#define ROL64(x, n)   (((x) << (n)) | ((x) >> (64 - (n))))
+
+/*
+ * One round: state E receives the image of state A, with round
+ * constant rc.
+ */
+#define KECCAK_ROUND(A, E, rc)   do { \
+		uint64_t c0, c1, c2, c3, c4, d0, d1, d2, d3, d4; \
+		uint64_t b0, b1, b2, b3, b4; \
+		c0 = A ## 00 ^ A ## 05 ^ A ## 10 ^ A ## 15 ^ A ## 20; \
+		c1 = A ## 01 ^ A ## 06 ^ A ## 11 ^ A ## 16 ^ A ## 21; \
+		c2 = A ## 02 ^ A ## 07 ^ A ## 12 ^ A ## 17 ^ A ## 22; \
+		c3 = A ## 03 ^ A ## 08 ^ A ## 13 ^ A ## 18 ^ A ## 23; \
+		c4 = A ## 04 ^ A ## 09 ^ A ## 14 ^ A ## 19 ^ A ## 24; \
+		d0 = c4 ^ ROL64(c1, 1); \
+		d1 = c0 ^ ROL64(c2, 1); \
+		d2 = c1 ^ ROL64(c3, 1); \
+		d3 = c2 ^ ROL64(c4, 1); \
+		d4 = c3 ^ ROL64(c0, 1); \
+		b0 = A ## 00 ^ d0; \
+		b1 = ROL64(A ## 06 ^ d1, 44); \
+		b2 = ROL64(A ## 12 ^ d2, 43); \
+		b3 = ROL64(A ## 18 ^ d3, 21); \
+		b4 = ROL64(A ## 24 ^ d4, 14); \
+		E ## 00 = b0 ^ _andn_u64(b1, b2) ^ (rc); \
+		E ## 01 = b1 ^ _andn_u64(b2, b3); \
+		E ## 02 = b2 ^ _andn_u64(b3, b4); \
+		E ## 03 = b3 ^ _andn_u64(b4, b0); \
+		E ## 04 = b4 ^ _andn_u64(b0, b1); \
+		b0 = ROL64(A ## 03 ^ d3, 28); \
+		b1 = ROL64(A ## 09 ^ d4, 20); \
+		b2 = ROL64(A ## 10 ^ d0, 3); \
+		b3 = ROL64(A ## 16 ^ d1, 45); \
+		b4 = ROL64(A ## 22 ^ d2, 61); \
+		E ## 05 = b0 ^ _andn_u64(b1, b2); \
+		E ## 06 = b1 ^ _andn_u64(b2, b3); \
+		E ## 07 = b2 ^ _andn_u64(b3, b4); \
+		E ## 08 = b3 ^ _andn_u64(b4, b0); \
+		E ## 09 = b4 ^ _andn_u64(b0, b1); \
+		b0 = ROL64(A ## 01 ^ d1, 1); \
+		b1 = ROL64(A ## 07 ^ d2, 6); \
+		b2 = ROL64(A ## 13 ^ d3, 25); \
+		b3 = ROL64(A ## 19 ^ d4, 8); \
+		b4 = ROL64(A ## 20 ^ d0, 18); \
+		E ## 10 = b0 ^ _andn_u64(b1, b2); \
+		E ## 11 = b1 ^ _andn_u64(b2, b3); \
+		E ## 12 = b2 ^ _andn_u64(b3, b4); \
+		E ## 13 = b3 ^ _andn_u64(b4, b0); \
+		E ## 14 = b4 ^ _andn_u64(b0, b1); \
+		b0 = ROL64(A ## 04 ^ d4, 27); \
+		b1 = ROL64(A ## 05 ^ d0, 36); \
+		b2 = ROL64(A ## 11 ^ d1, 10); \
+		b3 = ROL64(A ## 17 ^ d2, 15); \
+		b4 = ROL64(A ## 23 ^ d3, 56); \
+		E ## 15 = b0 ^ _andn_u64(b1, b2); \
+		E ## 16 = b1 ^ _andn_u64(b2, b3); \
+		E ## 17 = b2 ^ _andn_u64(b3, b4); \
+		E ## 18 = b3 ^ _andn_u64(b4, b0); \
+		E ## 19 = b4 ^ _andn_u64(b0, b1); \
+		b0 = ROL64(A ## 02 ^ d2, 62); \
+		b1 = ROL64(A ## 08 ^ d3, 55); \
+		b2 = ROL64(A ## 14 ^ d4, 39); \
+		b3 = ROL64(A ## 15 ^ d0, 41); \
+		b4 = ROL64(A ## 21 ^ d1, 2); \
+		E ## 20 = b0 ^ _andn_u64(b1, b2); \
+		E ## 21 = b1 ^ _andn_u64(b2, b3); \
+		E ## 22 = b2 ^ _andn_u64(b3, b4); \
+		E ## 23 = b3 ^ _andn_u64(b4, b0); \
+		E ## 24 = b4 ^ _andn_u64(b0, b1); \
+	} while (0)
+
+#define KECCAK_LOAD(S)   do { \
+		S ## 00 = A[ 0]; S ## 01 = A[ 1]; S ## 02 = A[ 2]; \
+		S ## 03 = A[ 3]; S ## 04 = A[ 4]; S ## 05 = A[ 5]; \
+		S ## 06 = A[ 6]; S ## 07 = A[ 7]; S ## 08 = A[ 8]; \
+		S ## 09 = A[ 9]; S ## 10 = A[10]; S ## 11 = A[11]; \
+		S ## 12 = A[12]; S ## 13 = A[13]; S ## 14 = A[14]; \
+		S ## 15 = A[15]; S ## 16 = A[16]; S ## 17 = A[17]; \
+		S ## 18 = A[18]; S ## 19 = A[19]; S ## 20 = A[20]; \
+		S ## 21 = A[21]; S ## 22 = A[22]; S ## 23 = A[23]; \
+		S ## 24 = A[24]; \
+	} while (0)
+
+#define KECCAK_STORE(S)   do { \
+		A[ 0] = S ## 00; A[ 1] = S ## 01; A[ 2] = S ## 02; \
+		A[ 3] = S ## 03; A[ 4] = S ## 04; A[ 5] = S ## 05; \
+		A[ 6] = S ## 06; A[ 7] = S ## 07; A[ 8] = S ## 08; \
+		A[ 9] = S ## 09; A[10] = S ## 10; A[11] = S ## 11; \
+		A[12] = S ## 12; A[13] = S ## 13; A[14] = S ## 14; \
+		A[15] = S ## 15; A[16] = S ## 16; A[17] = S ## 17; \
+		A[18] = S ## 18; A[19] = S ## 19; A[20] = S ## 20; \
+		A[21] = S ## 21; A[22] = S ## 22; A[23] = S ## 23; \
+		A[24] = S ## 24; \
+	} while (0)
+
+/*
+ * Process the provided state (rounds r0 to 23, see sha3.c).
+ */
+static void
+process_block(uint64_t *A, int r0)
+{
+	uint64_t a00, a01, a02, a03, a04, a05, a06, a07, a08, a09;
+	uint64_t a10, a11, a12, a13, a14, a15, a16, a17, a18, a19;
+	uint64_t a20, a21, a22, a23, a24;
+	uint64_t e00, e01, e02, e03, e04, e05, e06, e07, e08, e09;
+	uint64_t e10, e11, e12, e13, e14, e15, e16, e17, e18, e19;
+	uint64_t e20, e21, e22, e23, e24;
+	int j;
+
+	KECCAK_LOAD(a);
+	for (j = r0; j < 24; j += 2) {
+		KECCAK_ROUND(a, e, RC[j]);
+		KECCAK_ROUND(e, a, RC[j + 1]);
+	}
+	KECCAK_STORE(a);
+}
@@ -0,0 +1,559 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h", "do255_alg.h" and "sha3.h"
+ *  - defined macros CURVE, CN() and SPEED_STR()
+ *  - defined the speed_op type, SPEED_NUM and SPEED_TLS (see
+ *    speed_do255.c)
+ *
+ * This file defines the benchmarked operations of CURVE: one function
+ * per public function of do255.h and do255_alg.h (or per sequence of
+ * calls, for the streaming contexts), and the CN(speed_ops)[] table
+ * that lists them. All operations work on the CN(ss) structure, which
+ * is filled with valid data by CN(speed_setup)(): points, scalars and
+ * signatures are such that all verifications succeed. That structure is
+ * thread-local; each thread that runs operations must call
+ * CN(speed_setup)() first (and CN(speed_clear)() at the end).
+ */
+
+typedef struct {
+	CN(point) P[SPEED_NUM], Q[SPEED_NUM];
+	uint8_t enc[SPEED_NUM * 32];
+	uint8_t sc[SPEED_NUM * 32];
+	uint8_t k0[32];
+	uint8_t k1[SPEED_NUM * 32];
+	uint8_t k2[SPEED_NUM * 16];
+	uint8_t R_enc[SPEED_NUM * 32];
+	uint8_t ok[SPEED_NUM];
+	uint8_t wide[64];
+	CN(precomp) precomp;
+	CN(verify_table) vtab;
+	void *scratch;
+	CN(private_key) sk, sk2;
+	CN(public_key) pk, pk2;
+	CN(expanded_public_key) epk;
+	CN(signature) sig[SPEED_NUM], sig_ctx;
+	CN(nonce) pool_entries[SPEED_POOL];
+	CN(nonce_pool) pool;
+	uint8_t hv[SPEED_NUM][32];
+	uint8_t msg[1024];
+	unsigned char results[SPEED_NUM];
+	shake_context rng;
+	unsigned sink;
+} CN(speed_state);
+
+static SPEED_TLS CN(speed_state) CN(ss);
+
+/*
+ * Fill the state with pseudorandom (but reproducible) data.
+ */
+static void
+CN(speed_setup)(void)
+{
+	CN(speed_state) *ss;
+	shake_context rng;
+	uint8_t tmp[32], p[32], r[32];
+	CN(sign_context) sc;
+	size_t u;
+
+	ss = &CN(ss);
+	shake_init(&rng, 256);
+	shake_inject(&rng, SPEED_STR(CURVE), strlen(SPEED_STR(CURVE)));
+	shake_flip(&rng);
+
+	/*
+	 * Random points and scalars (scalars are reduced, so that they
+	 * can also be used with the scalar_*() functions).
+	 */
+	for (u = 0; u < SPEED_NUM; u ++) {
+		shake_extract(&rng, ss->wide, sizeof ss->wide);
+		CN(map_to_curve)(&ss->P[u], ss->wide, sizeof ss->wide);
+		CN(encode)(ss->enc + 32 * u, &ss->P[u]);
+		shake_extract(&rng, ss->wide, sizeof ss->wide);
+		CN(scalar_reduce)(ss->sc + 32 * u, ss->wide, sizeof ss->wide);
+	}
+	memcpy(ss->Q, ss->P, sizeof ss->P);
+
+	/*
+	 * Inputs for the verification helpers: with P[i] = p_i*G and
+	 * R[i] = r_i*G (p_i and r_i derived from the same seed), the
+	 * scalar k0 is chosen so that the equation is fulfilled:
+	 *    k0 = \sum_i (k2[i]*r_i - k1[i]*p_i) mod r
+	 * The single-point helpers use P[0], R_enc[0], k1[0] and the
+	 * first term of the sum (ss->sc + 0 holds that k0).
+	 */
+	memset(ss->k0, 0, sizeof ss->k0);
+	for (u = 0; u < SPEED_NUM; u ++) {
+		CN(point) T;
+
+		shake_extract(&rng, p, sizeof p);
+		CN(scalar_reduce)(p, p, sizeof p);
+		shake_extract(&rng, r, sizeof r);
+		CN(scalar_reduce)(r, r, sizeof r);
+		CN(mulgen)(&ss->Q[u], p);
+		CN(mulgen)(&T, r);
+		CN(encode)(ss->R_enc + 32 * u, &T);
+		shake_extract(&rng, ss->k1 + 32 * u, 32);
+		CN(scalar_reduce)(ss->k1 + 32 * u, ss->k1 + 32 * u, 32);
+		if (u == 0) {
+			memset(ss->k2, 0, 16);
+			ss->k2[0] = 1;
+		} else {
+			shake_extract(&rng, ss->k2 + 16 * u, 16);
+		}
+		memset(tmp, 0, sizeof tmp);
+		memcpy(tmp, ss->k2 + 16 * u, 16);
+		CN(scalar_mul)(tmp, tmp, r);
+		CN(scalar_mul)(p, ss->k1 + 32 * u, p);
+		CN(scalar_sub)(tmp, tmp, p);
+		if (u == 0) {
+			memcpy(ss->sc, tmp, 32);
+		}
+		CN(scalar_add)(ss->k0, ss->k0, tmp);
+	}
+	CN(verify_table_init)(&ss->vtab, &ss->Q[0]);
+	CN(precomp_init)(&ss->precomp, &ss->P[0]);
+	ss->scratch = malloc(CN(msm_scratch_size)(SPEED_NUM));
+	if (ss->scratch == NULL) {
+		fprintf(stderr, "memory allocation failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/*
+	 * Keys and signatures: SPEED_NUM signatures from the same key,
+	 * on distinct hash values, and one streamed signature on msg[].
+	 */
+	shake_extract(&rng, tmp, sizeof tmp);
+	shake_init(&ss->rng, 256);
+	shake_inject(&ss->rng, tmp, sizeof tmp);
+	shake_flip(&ss->rng);
+	CN(keygen)(&ss->rng, &ss->sk, &ss->pk);
+	CN(keygen)(&ss->rng, &ss->sk2, &ss->pk2);
+	CN(expand_public_key)(&ss->epk, &ss->pk);
+	for (u = 0; u < SPEED_NUM; u ++) {
+		shake_extract(&rng, ss->hv[u], 32);
+		CN(sign)(&ss->sig[u], &ss->sk, &ss->pk,
+			DO255_OID_SHA3_256, ss->hv[u], 32, NULL, 0);
+	}
+	shake_extract(&rng, ss->msg, sizeof ss->msg);
+	CN(sign_ctx_init)(&sc);
+	CN(sign_ctx_update)(&sc, ss->msg, sizeof ss->msg);
+	CN(sign_ctx_final)(&ss->sig_ctx, &sc, &ss->sk, &ss->pk, NULL, 0);
+	shake_extract(&rng, tmp, sizeof tmp);
+	CN(nonce_pool_init)(&ss->pool, ss->pool_entries, SPEED_POOL,
+		tmp, sizeof tmp);
+
+	/*
+	 * Check that verifications succeed, so that we do not benchmark
+	 * the failure paths.
+	 */
+	if (!CN(verify_helper_vartime)(ss->sc, &ss->Q[0], ss->k1, ss->R_enc)
+		|| !CN(verify_batch_helper_vartime)(ss->k0, ss->Q, ss->k1,
+			ss->R_enc, ss->k2, SPEED_NUM)
+		|| !CN(verify_vartime)(&ss->sig[0], &ss->pk,
+			DO255_OID_SHA3_256, ss->hv[0], 32))
+	{
+		fprintf(stderr, "%s: setup failed\n", SPEED_STR(CURVE));
+		exit(EXIT_FAILURE);
+	}
+}
+
+/*
+ * Release the resources allocated by CN(speed_setup)().
+ */
+static void
+CN(speed_clear)(void)
+{
+	free(CN(ss).scratch);
+	CN(ss).scratch = NULL;
+	CN(nonce_pool_clear)(&CN(ss).pool);
+}
+
+static void
+CN(sp_decode)(void)
+{
+	CN(ss).sink += CN(decode)(&CN(ss).Q[1], CN(ss).enc);
+}
+
+static void
+CN(sp_decode_vartime)(void)
+{
+	CN(ss).sink += CN(decode_vartime)(&CN(ss).Q[1], CN(ss).enc);
+}
+
+static void
+CN(sp_decode_batch)(void)
+{
+	CN(ss).sink += CN(decode_batch)(CN(ss).P, CN(ss).ok,
+		CN(ss).enc, SPEED_NUM);
+}
+
+static void
+CN(sp_encode)(void)
+{
+	CN(encode)(CN(ss).enc + 32, &CN(ss).P[1]);
+}
+
+static void
+CN(sp_encode_squared_w)(void)
+{
+	CN(encode_squared_w)(CN(ss).wide, &CN(ss).P[1]);
+}
+
+static void
+CN(sp_encode_batch)(void)
+{
+	CN(encode_batch)(CN(ss).enc, CN(ss).P, SPEED_NUM);
+}
+
+static void
+CN(sp_encode_squared_w_batch)(void)
+{
+	static uint8_t buf[SPEED_NUM * 32];
+
+	CN(encode_squared_w_batch)(buf, CN(ss).P, SPEED_NUM);
+}
+
+static void
+CN(sp_is_neutral)(void)
+{
+	CN(ss).sink += CN(is_neutral)(&CN(ss).P[2]);
+}
+
+static void
+CN(sp_eq)(void)
+{
+	CN(ss).sink += CN(eq)(&CN(ss).P[2], &CN(ss).P[3]);
+}
+
+static void
+CN(sp_add)(void)
+{
+	CN(add)(&CN(ss).P[2], &CN(ss).P[2], &CN(ss).P[3]);
+}
+
+static void
+CN(sp_double)(void)
+{
+	CN(double)(&CN(ss).P[2], &CN(ss).P[2]);
+}
+
+static void
+CN(sp_double_x)(void)
+{
+	CN(double_x)(&CN(ss).P[2], &CN(ss).P[2], 5);
+}
+
+static void
+CN(sp_neg)(void)
+{
+	CN(neg)(&CN(ss).P[2], &CN(ss).P[2]);
+}
+
+static void
+CN(sp_mul)(void)
+{
+	CN(mul)(&CN(ss).P[4], &CN(ss).P[4], CN(ss).sc);
+}
+
+static void
+CN(sp_mulgen)(void)
+{
+	CN(mulgen)(&CN(ss).P[4], CN(ss).sc);
+}
+
+static void
+CN(sp_precomp_init)(void)
+{
+	CN(precomp_init)(&CN(ss).precomp, &CN(ss).P[0]);
+}
+
+static void
+CN(sp_mul_precomp)(void)
+{
+	CN(mul_precomp)(&CN(ss).P[4], &CN(ss).precomp, CN(ss).sc);
+}
+
+static void
+CN(sp_mul_x4)(void)
+{
+	CN(mul_x4)(CN(ss).P + 4, CN(ss).P + 4, CN(ss).sc);
+}
+
+static void
+CN(sp_mulgen_x4)(void)
+{
+	CN(mulgen_x4)(CN(ss).P + 4, CN(ss).sc);
+}
+
+static void
+CN(sp_verify_helper_vartime)(void)
+{
+	CN(ss).sink += CN(verify_helper_vartime)(CN(ss).sc,
+		&CN(ss).Q[0], CN(ss).k1, CN(ss).R_enc);
+}
+
+static void
+CN(sp_verify_table_init)(void)
+{
+	CN(verify_table_init)(&CN(ss).vtab, &CN(ss).Q[0]);
+}
+
+static void
+CN(sp_verify_helper_table_vartime)(void)
+{
+	CN(ss).sink += CN(verify_helper_table_vartime)(CN(ss).sc,
+		&CN(ss).vtab, CN(ss).k1, CN(ss).R_enc);
+}
+
+static void
+CN(sp_verify_batch_helper_vartime)(void)
+{
+	CN(ss).sink += CN(verify_batch_helper_vartime)(CN(ss).k0,
+		CN(ss).Q, CN(ss).k1, CN(ss).R_enc, CN(ss).k2, SPEED_NUM);
+}
+
+static void
+CN(sp_msm_scratch_size)(void)
+{
+	CN(ss).sink += (unsigned)CN(msm_scratch_size)(SPEED_NUM);
+}
+
+static void
+CN(sp_msm_vartime)(void)
+{
+	CN(msm_vartime)(&CN(ss).P[4], CN(ss).Q, CN(ss).sc,
+		SPEED_NUM, CN(ss).scratch);
+}
+
+static void
+CN(sp_mul_multi)(void)
+{
+	CN(mul_multi)(&CN(ss).P[4], CN(ss).Q, CN(ss).sc, SPEED_NUM);
+}
+
+static void
+CN(sp_map_to_curve)(void)
+{
+	CN(map_to_curve)(&CN(ss).P[5], CN(ss).wide, 32);
+}
+
+static void
+CN(sp_scalar_is_reduced)(void)
+{
+	CN(ss).sink += CN(scalar_is_reduced)(CN(ss).sc + 32);
+}
+
+static void
+CN(sp_scalar_reduce)(void)
+{
+	CN(scalar_reduce)(CN(ss).sc + 32, CN(ss).wide, 64);
+}
+
+static void
+CN(sp_scalar_add)(void)
+{
+	CN(scalar_add)(CN(ss).sc + 32, CN(ss).sc + 32, CN(ss).sc + 64);
+}
+
+static void
+CN(sp_scalar_sub)(void)
+{
+	CN(scalar_sub)(CN(ss).sc + 32, CN(ss).sc + 32, CN(ss).sc + 64);
+}
+
+static void
+CN(sp_scalar_neg)(void)
+{
+	CN(scalar_neg)(CN(ss).sc + 32, CN(ss).sc + 32);
+}
+
+static void
+CN(sp_scalar_half)(void)
+{
+	CN(scalar_half)(CN(ss).sc + 32, CN(ss).sc + 32);
+}
+
+static void
+CN(sp_scalar_mul)(void)
+{
+	CN(scalar_mul)(CN(ss).sc + 32, CN(ss).sc + 32, CN(ss).sc + 64);
+}
+
+static void
+CN(sp_keygen)(void)
+{
+	CN(keygen)(&CN(ss).rng, &CN(ss).sk2, &CN(ss).pk2);
+}
+
+static void
+CN(sp_make_public)(void)
+{
+	CN(make_public)(&CN(ss).pk2, &CN(ss).sk2);
+}
+
+static void
+CN(sp_check_public)(void)
+{
+	CN(ss).sink += CN(check_public)(&CN(ss).pk);
+}
+
+static void
+CN(sp_key_exchange)(void)
+{
+	uint8_t secret[32];
+
+	CN(ss).sink += CN(key_exchange)(secret, sizeof secret,
+		&CN(ss).sk2, &CN(ss).pk2, &CN(ss).pk);
+	CN(ss).sink += secret[0];
+}
+
+static void
+CN(sp_sign)(void)
+{
+	CN(signature) sig;
+
+	CN(sign)(&sig, &CN(ss).sk, &CN(ss).pk,
+		DO255_OID_SHA3_256, CN(ss).hv[0], 32, NULL, 0);
+	CN(ss).sink += sig.b[0];
+}
+
+/*
+ * The pool is refilled when empty; the refill cost thus appears in the
+ * upper percentiles only.
+ */
+static void
+CN(sp_sign_with_pool)(void)
+{
+	CN(signature) sig;
+
+	if (CN(ss).pool.count == 0) {
+		CN(nonce_pool_refill)(&CN(ss).pool, 0);
+	}
+	CN(sign_with_pool)(&sig, &CN(ss).pool, &CN(ss).sk, &CN(ss).pk,
+		DO255_OID_SHA3_256, CN(ss).hv[0], 32);
+	CN(ss).sink += sig.b[0];
+}
+
+static void
+CN(sp_nonce_pool_refill)(void)
+{
+	CN(ss).pool.count = 0;
+	CN(nonce_pool_refill)(&CN(ss).pool, SPEED_NUM);
+}
+
+static void
+CN(sp_verify_vartime)(void)
+{
+	CN(ss).sink += CN(verify_vartime)(&CN(ss).sig[0], &CN(ss).pk,
+		DO255_OID_SHA3_256, CN(ss).hv[0], 32);
+}
+
+static void
+CN(sp_expand_public_key)(void)
+{
+	CN(ss).sink += CN(expand_public_key)(&CN(ss).epk, &CN(ss).pk);
+}
+
+static void
+CN(sp_verify_vartime_expanded)(void)
+{
+	CN(ss).sink += CN(verify_vartime_expanded)(&CN(ss).sig[0],
+		&CN(ss).epk, DO255_OID_SHA3_256, CN(ss).hv[0], 32);
+}
+
+static void
+CN(sp_verify_batch_vartime)(void)
+{
+	CN(ss).sink += CN(verify_batch_vartime)(CN(ss).results,
+		CN(ss).sig, sizeof(CN(signature)), &CN(ss).pk, 0,
+		DO255_OID_SHA3_256, CN(ss).hv, 32, 32, SPEED_NUM, NULL);
+}
+
+static void
+CN(sp_sign_ctx)(void)
+{
+	CN(sign_context) sc;
+	CN(signature) sig;
+
+	CN(sign_ctx_init)(&sc);
+	CN(sign_ctx_update)(&sc, CN(ss).msg, sizeof CN(ss).msg);
+	CN(sign_ctx_final)(&sig, &sc, &CN(ss).sk, &CN(ss).pk, NULL, 0);
+	CN(ss).sink += sig.b[0];
+}
+
+static void
+CN(sp_verify_ctx)(void)
+{
+	CN(verify_context) vc;
+
+	CN(verify_ctx_init)(&vc);
+	CN(verify_ctx_update)(&vc, CN(ss).msg, sizeof CN(ss).msg);
+	CN(ss).sink += CN(verify_ctx_final_vartime)(&vc,
+		&CN(ss).sig_ctx, &CN(ss).pk);
+}
+
+/*
+ * Operation table. The second field is the number of items processed
+ * by one call (points, scalars, signatures or doublings). Operations
+ * declared with SPEED_OP_MT() are also run by the multi-threaded mode.
+ */
+#define SPEED_OP(name, items) \
+	{ SPEED_STR(CN(name)), items, 0, &CN(sp_ ## name) }
+#define SPEED_OP_MT(name, items) \
+	{ SPEED_STR(CN(name)), items, 1, &CN(sp_ ## name) }
+
+static const speed_op CN(speed_ops)[] = {
+	SPEED_OP(decode, 1),
+	SPEED_OP(decode_vartime, 1),
+	SPEED_OP(decode_batch, SPEED_NUM),
+	SPEED_OP(encode, 1),
+	SPEED_OP(encode_squared_w, 1),
+	SPEED_OP(encode_batch, SPEED_NUM),
+	SPEED_OP(encode_squared_w_batch, SPEED_NUM),
+	SPEED_OP(is_neutral, 1),
+	SPEED_OP(eq, 1),
+	SPEED_OP(add, 1),
+	SPEED_OP(double, 1),
+	SPEED_OP(double_x, 5),
+	SPEED_OP(neg, 1),
+	SPEED_OP(mul, 1),
+	SPEED_OP(mulgen, 1),
+	SPEED_OP(precomp_init, 1),
+	SPEED_OP(mul_precomp, 1),
+	SPEED_OP(mul_x4, 4),
+	SPEED_OP(mulgen_x4, 4),
+	SPEED_OP(verify_helper_vartime, 1),
+	SPEED_OP(verify_table_init, 1),
+	SPEED_OP(verify_helper_table_vartime, 1),
+	SPEED_OP(verify_batch_helper_vartime, SPEED_NUM),
+	SPEED_OP(msm_scratch_size, 1),
+	SPEED_OP(msm_vartime, SPEED_NUM),
+	SPEED_OP(mul_multi, SPEED_NUM),
+	SPEED_OP_MT(map_to_curve, 1),
+	SPEED_OP(scalar_is_reduced, 1),
+	SPEED_OP(scalar_reduce, 1),
+	SPEED_OP(scalar_add, 1),
+	SPEED_OP(scalar_sub, 1),
+	SPEED_OP(scalar_neg, 1),
+	SPEED_OP(scalar_half, 1),
+	SPEED_OP(scalar_mul, 1),
+	SPEED_OP_MT(keygen, 1),
+	SPEED_OP(make_public, 1),
+	SPEED_OP(check_public, 1),
+	SPEED_OP_MT(key_exchange, 1),
+	SPEED_OP_MT(sign, 1),
+	SPEED_OP(sign_with_pool, 1),
+	SPEED_OP(nonce_pool_refill, SPEED_NUM),
+	SPEED_OP_MT(verify_vartime, 1),
+	SPEED_OP(expand_public_key, 1),
+	SPEED_OP(verify_vartime_expanded, 1),
+	SPEED_OP(verify_batch_vartime, SPEED_NUM),
+	SPEED_OP(sign_ctx, 1),
+	SPEED_OP(verify_ctx, 1),
+	{ NULL, 0, 0, 0 }
+};
+
+#undef SPEED_OP
+#undef SPEED_OP_MT
@@ -0,0 +1,919 @@
+/*
+ * Benchmark of all public functions of do255.h and do255_alg.h, with
+ * machine-readable output.
+ *
+ * This program is linked with the implementations of both curves for
+ * one backend (speed_do255_w64, speed_do255_bmi2...), or with libdo255
+ * (speed_do255_lib, compiled with DO255_DISPATCH=1, in which case the
+ * backend can be selected with -b). For each operation, a number of
+ * warm-up calls is first made; they are also used to choose how many
+ * calls are made per sample, so that each sample lasts at least about
+ * SPEED_SAMPLE_NS nanoseconds (this keeps the timer overhead negligible
+ * for fast operations). Each sample then yields the cost of one call,
+ * in nanoseconds (clock_gettime(CLOCK_MONOTONIC)) and, on x86, in clock
+ * cycles (rdtsc; on recent CPUs, this counts at the nominal frequency,
+ * not the actual core frequency). Results are reported as the minimum,
+ * maximum, mean and percentiles over all samples, as plain text, JSON
+ * or CSV.
+ *
+ * With -t, the multi-threaded mode is used instead: the operations that
+ * a server typically runs concurrently (key pair generation, key
+ * exchange, signature generation and verification, map-to-curve) are
+ * run on 1, 2... up to the provided number of threads at once, each
+ * thread calling the operation in a loop for a fixed duration. This
+ * reports the aggregate throughput (calls per second over all threads)
+ * and its scaling relative to a single thread, and the distribution of
+ * the latency of individual calls (median, 99th and 99.9th percentile,
+ * maximum). Contention between threads for execution units (SMT) and
+ * shared caches, and frequency changes under load, show up in these
+ * numbers; they are not visible in the single-threaded samples.
+ *
+ * Usage: speed_do255_* [options] [name...]
+ *   -n num    number of measured samples per operation (default: 1000)
+ *   -w num    number of warm-up calls per operation (default: 100)
+ *   -c cpu    pin the process to the provided CPU (Linux only); with -t,
+ *             thread i (starting at 0) is pinned to CPU cpu+i
+ *   -f fmt    output format: text (default), json or csv
+ *   -b name   backend (libdo255 only: w64, bmi2 or avx2)
+ *   -t num    multi-threaded mode, with up to num threads
+ *   -d ms     duration of each multi-threaded run (default: 1000)
+ *   -l        list the operations and exit
+ * If names are provided, then only the operations whose name contains
+ * one of them are run (e.g. "sign" or "do255s_").
+ */
+
+#if defined __linux__ && !defined _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#if defined __linux__
+#include <sched.h>
+#endif
+
+/*
+ * SPEED_THREADS enables the multi-threaded mode (-t), which uses POSIX
+ * threads; it is enabled by default except on Windows.
+ */
+#ifndef SPEED_THREADS
+#if defined _WIN32
+#define SPEED_THREADS   0
+#else
+#define SPEED_THREADS   1
+#endif
+#endif
+
+#if SPEED_THREADS
+#include <pthread.h>
+#endif
+
+/*
+ * The state used by the benchmarked operations is thread-local, so that
+ * threads do not share (and write to) the same cache lines.
+ */
+#if defined _MSC_VER
+#define SPEED_TLS   __declspec(thread)
+#else
+#define SPEED_TLS   __thread
+#endif
+
+#include "do255.h"
+#include "do255_alg.h"
+#include "sha3.h"
+
+#ifndef SPEED_RDTSC
+#if defined __i386__ || defined _M_IX86 || defined __x86_64__ || defined _M_X64
+#define SPEED_RDTSC   1
+#else
+#define SPEED_RDTSC   0
+#endif
+#endif
+
+#if SPEED_RDTSC
+#include <immintrin.h>
+#endif
+
+#ifndef DO255_DISPATCH
+#define DO255_DISPATCH   0
+#endif
+
+/*
+ * Name of the backend (set by the Makefile, except for libdo255).
+ */
+#ifndef SPEED_BACKEND
+#define SPEED_BACKEND   unknown
+#endif
+
+#define SPEED_STR(x)    SPEED_STR_(x)
+#define SPEED_STR_(x)   #x
+
+/*
+ * Minimum duration of a sample (nanoseconds).
+ */
+#define SPEED_SAMPLE_NS   2000
+
+/*
+ * Number of points, scalars or signatures for the batch operations
+ * (at most DO255_VERIFY_BATCH_MAX, and at least 8).
+ */
+#define SPEED_NUM   16
+
+/*
+ * Capacity of the nonce pools used by the sign_with_pool operations.
+ */
+#define SPEED_POOL   256
+
+/*
+ * A benchmarked operation; mt is non-zero for the operations that are
+ * run by the multi-threaded mode.
+ */
+typedef struct {
+	const char *name;
+	unsigned items;
+	int mt;
+	void (*run)(void);
+} speed_op;
+
+#define CN(x)            CNN(CURVE, x)
+#define CNN(cname, x)    CNN_(cname, x)
+#define CNN_(cname, x)   cname ## _ ## x
+
+#define CURVE   do255e
+#include "speed_curve.c"
+#undef CURVE
+
+#define CURVE   do255s
+#include "speed_curve.c"
+#undef CURVE
+
+static const speed_op *const all_ops[] = {
+	do255e_speed_ops,
+	do255s_speed_ops
+};
+
+/*
+ * Statistics over all samples of one operation (cost of one call).
+ */
+typedef struct {
+	double min, p10, p50, p90, p99, max, mean;
+} speed_stats;
+
+typedef struct {
+	const speed_op *op;
+	unsigned long batch;
+	speed_stats cycles, ns;
+} speed_result;
+
+static inline uint64_t
+now_cycles(void)
+{
+#if SPEED_RDTSC
+#if defined __GNUC__ && !defined __clang__
+	uint32_t hi, lo;
+
+	_mm_lfence();
+	__asm__ __volatile__ ("rdtsc" : "=d" (hi), "=a" (lo) : : );
+	return ((uint64_t)hi << 32) | (uint64_t)lo;
+#else
+	_mm_lfence();
+	return __rdtsc();
+#endif
+#else
+	return 0;
+#endif
+}
+
+static inline uint64_t
+now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+static int
+cmp_double(const void *p1, const void *p2)
+{
+	double v1, v2;
+
+	v1 = *(const double *)p1;
+	v2 = *(const double *)p2;
+	if (v1 < v2) {
+		return -1;
+	} else if (v1 == v2) {
+		return 0;
+	} else {
+		return 1;
+	}
+}
+
+/*
+ * Compute the statistics over num values (num > 0); the array is sorted.
+ */
+static void
+compute_stats(speed_stats *st, double *v, size_t num)
+{
+	double s;
+	size_t u;
+
+	qsort(v, num, sizeof *v, &cmp_double);
+	s = 0.0;
+	for (u = 0; u < num; u ++) {
+		s += v[u];
+	}
+	st->min = v[0];
+	st->p10 = v[((num - 1) * 10 + 50) / 100];
+	st->p50 = v[((num - 1) * 50 + 50) / 100];
+	st->p90 = v[((num - 1) * 90 + 50) / 100];
+	st->p99 = v[((num - 1) * 99 + 50) / 100];
+	st->max = v[num - 1];
+	st->mean = s / (double)num;
+}
+
+/*
+ * Measure one operation.
+ */
+static void
+measure(speed_result *res, const speed_op *op,
+	unsigned long num_samples, unsigned long num_warmup,
+	double *tmp_cycles, double *tmp_ns)
+{
+	unsigned long u, batch;
+	uint64_t best;
+
+	/*
+	 * Warm-up; the fastest call is used to set the batch size.
+	 */
+	best = (uint64_t)-1;
+	for (u = 0; u <= num_warmup; u ++) {
+		uint64_t begin, end;
+
+		begin = now_ns();
+		op->run();
+		end = now_ns();
+		if (end - begin < best) {
+			best = end - begin;
+		}
+	}
+	if (best == 0) {
+		best = 1;
+	}
+	batch = (unsigned long)((SPEED_SAMPLE_NS + best - 1) / best);
+
+	for (u = 0; u < num_samples; u ++) {
+		uint64_t n0, n1, c0, c1;
+		unsigned long v;
+
+		n0 = now_ns();
+		c0 = now_cycles();
+		for (v = 0; v < batch; v ++) {
+			op->run();
+		}
+		c1 = now_cycles();
+		n1 = now_ns();
+		tmp_cycles[u] = (double)(c1 - c0) / (double)batch;
+		tmp_ns[u] = (double)(n1 - n0) / (double)batch;
+	}
+	res->op = op;
+	res->batch = batch;
+	compute_stats(&res->cycles, tmp_cycles, num_samples);
+	compute_stats(&res->ns, tmp_ns, num_samples);
+}
+
+/*
+ * Pin the calling thread to the provided CPU. Returned value is 1 on
+ * success, 0 on error.
+ */
+static int
+pin_cpu(long cpu)
+{
+#if defined __linux__
+	cpu_set_t cs;
+
+	CPU_ZERO(&cs);
+	CPU_SET((int)cpu, &cs);
+	return sched_setaffinity(0, sizeof cs, &cs) == 0;
+#else
+	(void)cpu;
+	return 0;
+#endif
+}
+
+#if SPEED_THREADS
+
+/*
+ * Result of one multi-threaded run: total number of calls, aggregate
+ * throughput (calls per second), and latency of individual calls
+ * (nanoseconds) over all threads.
+ */
+typedef struct {
+	const speed_op *op;
+	unsigned threads;
+	uint64_t calls;
+	double calls_per_s;
+	uint64_t lat_p50, lat_p99, lat_p999, lat_max;
+} speed_mt_result;
+
+/*
+ * Per-thread context: the thread appends the latency of each call to
+ * lat[], and records the time at which its last call completed.
+ */
+typedef struct {
+	const speed_op *op;
+	long cpu;
+	unsigned long num_warmup;
+	uint64_t *lat;
+	size_t num, cap;
+	uint64_t end;
+} speed_worker;
+
+/*
+ * Start synchronization: the main thread waits until all workers are
+ * ready (mt_ready), then sets the deadline and raises mt_go.
+ */
+static pthread_mutex_t mt_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t mt_cond = PTHREAD_COND_INITIALIZER;
+static unsigned mt_ready;
+static int mt_go;
+static uint64_t mt_deadline;
+
+static void *
+mt_worker(void *arg)
+{
+	speed_worker *w;
+	unsigned long u;
+	uint64_t deadline, t1;
+
+	w = arg;
+	if (w->cpu >= 0 && !pin_cpu(w->cpu)) {
+		fprintf(stderr, "cannot pin to CPU %ld\n", w->cpu);
+		exit(EXIT_FAILURE);
+	}
+	do255e_speed_setup();
+	do255s_speed_setup();
+	for (u = 0; u < w->num_warmup; u ++) {
+		w->op->run();
+	}
+
+	pthread_mutex_lock(&mt_lock);
+	mt_ready ++;
+	pthread_cond_broadcast(&mt_cond);
+	while (!mt_go) {
+		pthread_cond_wait(&mt_cond, &mt_lock);
+	}
+	deadline = mt_deadline;
+	pthread_mutex_unlock(&mt_lock);
+
+	do {
+		uint64_t t0;
+
+		t0 = now_ns();
+		w->op->run();
+		t1 = now_ns();
+		if (w->num == w->cap) {
+			uint64_t *nl;
+
+			w->cap = w->cap == 0 ? 4096 : 2 * w->cap;
+			nl = realloc(w->lat, w->cap * sizeof *w->lat);
+			if (nl == NULL) {
+				fprintf(stderr, "memory allocation failed\n");
+				exit(EXIT_FAILURE);
+			}
+			w->lat = nl;
+		}
+		w->lat[w->num ++] = t1 - t0;
+	} while (t1 < deadline);
+	w->end = t1;
+
+	do255e_speed_clear();
+	do255s_speed_clear();
+	return NULL;
+}
+
+static int
+cmp_u64(const void *p1, const void *p2)
+{
+	uint64_t v1, v2;
+
+	v1 = *(const uint64_t *)p1;
+	v2 = *(const uint64_t *)p2;
+	if (v1 < v2) {
+		return -1;
+	} else if (v1 == v2) {
+		return 0;
+	} else {
+		return 1;
+	}
+}
+
+/*
+ * Run one operation on the provided number of threads at once, for
+ * duration_ns nanoseconds. The workers[] array must have room for
+ * num_threads entries.
+ */
+static void
+measure_mt(speed_mt_result *res, const speed_op *op, unsigned num_threads,
+	uint64_t duration_ns, unsigned long num_warmup, long cpu,
+	speed_worker *workers)
+{
+	pthread_t *th;
+	uint64_t *all, start, end;
+	size_t num, off;
+	unsigned i;
+
+	th = malloc(num_threads * sizeof *th);
+	if (th == NULL) {
+		fprintf(stderr, "memory allocation failed\n");
+		exit(EXIT_FAILURE);
+	}
+	mt_ready = 0;
+	mt_go = 0;
+	for (i = 0; i < num_threads; i ++) {
+		speed_worker *w;
+
+		w = &workers[i];
+		memset(w, 0, sizeof *w);
+		w->op = op;
+		w->cpu = cpu >= 0 ? cpu + (long)i : -1;
+		w->num_warmup = num_warmup;
+		if (pthread_create(&th[i], NULL, &mt_worker, w) != 0) {
+			fprintf(stderr, "cannot create thread\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	pthread_mutex_lock(&mt_lock);
+	while (mt_ready < num_threads) {
+		pthread_cond_wait(&mt_cond, &mt_lock);
+	}
+	start = now_ns();
+	mt_deadline = start + duration_ns;
+	mt_go = 1;
+	pthread_cond_broadcast(&mt_cond);
+	pthread_mutex_unlock(&mt_lock);
+
+	num = 0;
+	end = start;
+	for (i = 0; i < num_threads; i ++) {
+		pthread_join(th[i], NULL);
+		num += workers[i].num;
+		if (workers[i].end > end) {
+			end = workers[i].end;
+		}
+	}
+	free(th);
+
+	/*
+	 * Merge the latencies of all threads.
+	 */
+	all = malloc(num * sizeof *all);
+	if (all == NULL) {
+		fprintf(stderr, "memory allocation failed\n");
+		exit(EXIT_FAILURE);
+	}
+	off = 0;
+	for (i = 0; i < num_threads; i ++) {
+		memcpy(all + off, workers[i].lat,
+			workers[i].num * sizeof *all);
+		off += workers[i].num;
+		free(workers[i].lat);
+		workers[i].lat = NULL;
+	}
+	qsort(all, num, sizeof *all, &cmp_u64);
+
+	res->op = op;
+	res->threads = num_threads;
+	res->calls = num;
+	res->calls_per_s = (double)num * 1e9 / (double)(end - start);
+	res->lat_p50 = all[((num - 1) * 500 + 500) / 1000];
+	res->lat_p99 = all[((num - 1) * 990 + 500) / 1000];
+	res->lat_p999 = all[((num - 1) * 999 + 500) / 1000];
+	res->lat_max = all[num - 1];
+	free(all);
+}
+
+#endif
+
+static int
+selected(const char *name, char *const *filters, int num_filters)
+{
+	int i;
+
+	if (num_filters == 0) {
+		return 1;
+	}
+	for (i = 0; i < num_filters; i ++) {
+		if (strstr(name, filters[i]) != NULL) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static void
+print_json_stats(const char *label, const speed_stats *st, int valid)
+{
+	if (!valid) {
+		printf("\"%s\": null", label);
+		return;
+	}
+	printf("\"%s\": {\"min\": %.1f, \"p10\": %.1f, \"p50\": %.1f,"
+		" \"p90\": %.1f, \"p99\": %.1f, \"max\": %.1f,"
+		" \"mean\": %.1f}",
+		label, st->min, st->p10, st->p50, st->p90, st->p99,
+		st->max, st->mean);
+}
+
+static void
+print_csv_stats(const speed_stats *st, int valid)
+{
+	if (!valid) {
+		printf(",,,,,,,");
+		return;
+	}
+	printf(",%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f",
+		st->min, st->p10, st->p50, st->p90, st->p99,
+		st->max, st->mean);
+}
+
+#if SPEED_THREADS
+
+/*
+ * Run all selected multi-threaded operations, for 1 to max_threads
+ * threads, and print the results.
+ */
+static void
+run_mt(const char *fmt, const char *backend, unsigned max_threads,
+	unsigned long duration_ms, unsigned long num_warmup, long cpu,
+	char *const *filters, int num_filters)
+{
+	speed_worker *workers;
+	size_t u, v;
+	int first;
+
+	workers = malloc(max_threads * sizeof *workers);
+	if (workers == NULL) {
+		fprintf(stderr, "memory allocation failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (strcmp(fmt, "json") == 0) {
+		printf("{\n  \"backend\": \"%s\",\n", backend);
+		printf("  \"timer\": \"clock_gettime\",\n");
+		printf("  \"threads\": %u,\n  \"duration_ms\": %lu,\n"
+			"  \"warmup\": %lu,\n",
+			max_threads, duration_ms, num_warmup);
+		if (cpu >= 0) {
+			printf("  \"cpu\": %ld,\n", cpu);
+		} else {
+			printf("  \"cpu\": null,\n");
+		}
+		printf("  \"results\": [");
+	} else if (strcmp(fmt, "csv") == 0) {
+		printf("backend,name,threads,calls,calls_per_s,scaling,"
+			"lat_p50_ns,lat_p99_ns,lat_p999_ns,lat_max_ns\n");
+	} else {
+		printf("backend: %s, 1 to %u threads, %lu ms per run"
+			" (aggregate calls/s, scaling,"
+			" latency p50 / p99 / p99.9)\n",
+			backend, max_threads, duration_ms);
+		fflush(stdout);
+	}
+
+	first = 1;
+	for (u = 0; u < (sizeof all_ops) / sizeof all_ops[0]; u ++) {
+		for (v = 0; all_ops[u][v].name != NULL; v ++) {
+			const speed_op *op;
+			double base;
+			unsigned t;
+
+			op = &all_ops[u][v];
+			if (!op->mt || !selected(op->name, filters, num_filters)) {
+				continue;
+			}
+			base = 0.0;
+			for (t = 1; t <= max_threads; t ++) {
+				speed_mt_result res;
+				double scaling;
+
+				measure_mt(&res, op, t,
+					(uint64_t)duration_ms * 1000000,
+					num_warmup, cpu, workers);
+				if (t == 1) {
+					base = res.calls_per_s;
+				}
+				scaling = res.calls_per_s / base;
+				if (strcmp(fmt, "json") == 0) {
+					printf("%s\n    {\"name\": \"%s\","
+						" \"threads\": %u,"
+						" \"calls\": %llu,"
+						" \"calls_per_s\": %.1f,"
+						" \"scaling\": %.3f,"
+						" \"latency_ns\": {\"p50\": %llu,"
+						" \"p99\": %llu, \"p999\": %llu,"
+						" \"max\": %llu}}",
+						first ? "" : ",", op->name, t,
+						(unsigned long long)res.calls,
+						res.calls_per_s, scaling,
+						(unsigned long long)res.lat_p50,
+						(unsigned long long)res.lat_p99,
+						(unsigned long long)res.lat_p999,
+						(unsigned long long)res.lat_max);
+				} else if (strcmp(fmt, "csv") == 0) {
+					printf("%s,%s,%u,%llu,%.1f,%.3f,"
+						"%llu,%llu,%llu,%llu\n",
+						backend, op->name, t,
+						(unsigned long long)res.calls,
+						res.calls_per_s, scaling,
+						(unsigned long long)res.lat_p50,
+						(unsigned long long)res.lat_p99,
+						(unsigned long long)res.lat_p999,
+						(unsigned long long)res.lat_max);
+				} else {
+					printf("%-28s %3u thr %11.1f/s  x%-5.2f"
+						" %9.1f / %9.1f / %9.1f us\n",
+						op->name, t, res.calls_per_s,
+						scaling,
+						(double)res.lat_p50 / 1000.0,
+						(double)res.lat_p99 / 1000.0,
+						(double)res.lat_p999 / 1000.0);
+				}
+				first = 0;
+				fflush(stdout);
+			}
+		}
+	}
+	if (strcmp(fmt, "json") == 0) {
+		printf("\n  ]\n}\n");
+	}
+	free(workers);
+}
+
+#endif
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+"usage: speed_do255 [options] [name...]\n"
+"options:\n"
+"   -n num    number of measured samples per operation (default: 1000)\n"
+"   -w num    number of warm-up calls per operation (default: 100)\n"
+"   -c cpu    pin the process to the provided CPU (Linux only)\n"
+"   -f fmt    output format: text (default), json or csv\n"
+#if DO255_DISPATCH
+"   -b name   backend: w64, bmi2 or avx2\n"
+#endif
+#if SPEED_THREADS
+"   -t num    multi-threaded mode, with up to num threads\n"
+"   -d ms     duration of each multi-threaded run (default: 1000)\n"
+#endif
+"   -l        list the operations and exit\n"
+"Only the operations whose name contains one of the provided names are\n"
+"run (all operations if no name is provided).\n");
+	exit(EXIT_FAILURE);
+}
+
+static unsigned long
+parse_num(const char *s)
+{
+	char *end;
+	unsigned long x;
+
+	x = strtoul(s, &end, 10);
+	if (*s == 0 || *end != 0) {
+		fprintf(stderr, "invalid number: %s\n", s);
+		usage();
+	}
+	return x;
+}
+
+int
+main(int argc, char *argv[])
+{
+	unsigned long num_samples, num_warmup, num_threads, duration_ms;
+	long cpu;
+	const char *fmt, *backend;
+	char **filters;
+	int num_filters, list, i, first;
+	size_t u, v;
+	double *tmp_cycles, *tmp_ns;
+
+	num_samples = 1000;
+	num_warmup = 100;
+	cpu = -1;
+	num_threads = 0;
+	duration_ms = 1000;
+	fmt = "text";
+	list = 0;
+	filters = malloc((size_t)argc * sizeof *filters);
+	if (filters == NULL) {
+		fprintf(stderr, "memory allocation failed\n");
+		exit(EXIT_FAILURE);
+	}
+	num_filters = 0;
+#if DO255_DISPATCH
+	backend = NULL;
+#endif
+	for (i = 1; i < argc; i ++) {
+		const char *a;
+
+		a = argv[i];
+		if (a[0] != '-') {
+			filters[num_filters ++] = argv[i];
+			continue;
+		}
+		if (strcmp(a, "-l") == 0) {
+			list = 1;
+			continue;
+		}
+		if (a[1] == 0 || a[2] != 0 || i + 1 >= argc) {
+			usage();
+		}
+		switch (a[1]) {
+		case 'n':
+			num_samples = parse_num(argv[++ i]);
+			if (num_samples == 0) {
+				usage();
+			}
+			break;
+		case 'w':
+			num_warmup = parse_num(argv[++ i]);
+			break;
+		case 'c':
+			cpu = (long)parse_num(argv[++ i]);
+			break;
+		case 'f':
+			fmt = argv[++ i];
+			if (strcmp(fmt, "text") != 0
+				&& strcmp(fmt, "json") != 0
+				&& strcmp(fmt, "csv") != 0)
+			{
+				usage();
+			}
+			break;
+#if DO255_DISPATCH
+		case 'b':
+			backend = argv[++ i];
+			break;
+#endif
+#if SPEED_THREADS
+		case 't':
+			num_threads = parse_num(argv[++ i]);
+			if (num_threads == 0 || num_threads > 1024) {
+				usage();
+			}
+			break;
+		case 'd':
+			duration_ms = parse_num(argv[++ i]);
+			if (duration_ms == 0) {
+				usage();
+			}
+			break;
+#endif
+		default:
+			usage();
+		}
+	}
+
+	if (list) {
+		for (u = 0; u < (sizeof all_ops) / sizeof all_ops[0]; u ++) {
+			for (v = 0; all_ops[u][v].name != NULL; v ++) {
+				printf("%s\n", all_ops[u][v].name);
+			}
+		}
+		return 0;
+	}
+
+	if (cpu >= 0) {
+#if defined __linux__
+		if (!pin_cpu(cpu)) {
+			fprintf(stderr, "cannot pin to CPU %ld\n", cpu);
+			exit(EXIT_FAILURE);
+		}
+#else
+		fprintf(stderr, "CPU pinning is not supported\n");
+		exit(EXIT_FAILURE);
+#endif
+	}
+
+#if DO255_DISPATCH
+	if (backend != NULL && !do255_set_backend(backend)) {
+		fprintf(stderr, "backend not supported: %s\n", backend);
+		exit(EXIT_FAILURE);
+	}
+	backend = do255_backend_name();
+#else
+	backend = SPEED_STR(SPEED_BACKEND);
+#endif
+
+#if SPEED_THREADS
+	if (num_threads > 0) {
+		run_mt(fmt, backend, (unsigned)num_threads, duration_ms,
+			num_warmup, cpu, filters, num_filters);
+		free(filters);
+		return 0;
+	}
+#endif
+
+	do255e_speed_setup();
+	do255s_speed_setup();
+
+	tmp_cycles = malloc(num_samples * sizeof *tmp_cycles);
+	tmp_ns = malloc(num_samples * sizeof *tmp_ns);
+	if (tmp_cycles == NULL || tmp_ns == NULL) {
+		fprintf(stderr, "memory allocation failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (strcmp(fmt, "json") == 0) {
+		printf("{\n  \"backend\": \"%s\",\n", backend);
+		printf("  \"timer\": \"%s\",\n",
+			SPEED_RDTSC ? "rdtsc+clock_gettime" : "clock_gettime");
+		printf("  \"samples\": %lu,\n  \"warmup\": %lu,\n",
+			num_samples, num_warmup);
+		if (cpu >= 0) {
+			printf("  \"cpu\": %ld,\n", cpu);
+		} else {
+			printf("  \"cpu\": null,\n");
+		}
+		printf("  \"results\": [");
+	} else if (strcmp(fmt, "csv") == 0) {
+		printf("backend,name,items,batch,samples,"
+			"cycles_min,cycles_p10,cycles_p50,cycles_p90,"
+			"cycles_p99,cycles_max,cycles_mean,"
+			"ns_min,ns_p10,ns_p50,ns_p90,ns_p99,ns_max,ns_mean\n");
+	} else {
+		printf("backend: %s, %lu samples per operation"
+			" (median, 10th .. 90th percentile)\n",
+			backend, num_samples);
+		fflush(stdout);
+	}
+
+	/*
+	 * Run all selected operations; results are printed as soon as
+	 * they are obtained.
+	 */
+	first = 1;
+	for (u = 0; u < (sizeof all_ops) / sizeof all_ops[0]; u ++) {
+		for (v = 0; all_ops[u][v].name != NULL; v ++) {
+			const speed_op *op;
+			speed_result sr, *res;
+
+			op = &all_ops[u][v];
+			if (!selected(op->name, filters, num_filters)) {
+				continue;
+			}
+			res = &sr;
+			measure(res, op, num_samples, num_warmup,
+				tmp_cycles, tmp_ns);
+			if (strcmp(fmt, "json") == 0) {
+				printf("%s\n    {\"name\": \"%s\", \"items\": %u,"
+					" \"batch\": %lu, ",
+					first ? "" : ",",
+					op->name, op->items, res->batch);
+				print_json_stats("cycles",
+					&res->cycles, SPEED_RDTSC);
+				printf(", ");
+				print_json_stats("ns", &res->ns, 1);
+				printf("}");
+			} else if (strcmp(fmt, "csv") == 0) {
+				printf("%s,%s,%u,%lu,%lu", backend, op->name,
+					op->items, res->batch, num_samples);
+				print_csv_stats(&res->cycles, SPEED_RDTSC);
+				print_csv_stats(&res->ns, 1);
+				printf("\n");
+			} else {
+				printf("%-36s", op->name);
+#if SPEED_RDTSC
+				printf(" %10.0f cy (%.0f .. %.0f)",
+					res->cycles.p50, res->cycles.p10,
+					res->cycles.p90);
+#endif
+				printf(" %11.1f ns", res->ns.p50);
+				if (op->items > 1) {
+					printf("  (%u items)", op->items);
+				}
+				printf("\n");
+			}
+			first = 0;
+			fflush(stdout);
+		}
+	}
+	if (strcmp(fmt, "json") == 0) {
+		printf("\n  ]\n}\n");
+	}
+
+	free(tmp_cycles);
+	free(tmp_ns);
+	free(filters);
+	do255e_speed_clear();
+	do255s_speed_clear();
+	return 0;
+}
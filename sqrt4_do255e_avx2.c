@@ -0,0 +1,86 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf4 and operations (gf_avx2.c)
+ *
+ * This file is for the AVX2 implementation of do255e. It defines:
+ *  - gf4_sqrt_candidate()
+ */
+
+/*
+ * Compute a candidate square root of each lane of a. If the lane value
+ * is a quadratic residue, then the output is one of its square roots;
+ * otherwise, the output is some unspecified value. The caller must
+ * verify the result, and select the "sign" of the root (see gf_sqrt()).
+ */
+UNUSED
+static void
+gf4_sqrt_candidate(gf4 *d, const gf4 *a)
+{
+	/*
+	 * Same computation as gf_sqrt() (Atkin's algorithm):
+	 *   b <- (2*a)^((p-5)/8)
+	 *   c <- 2*a*b^2
+	 *   return a*b*(c - 1)
+	 */
+	gf4 b, c, e, x, x2, x96, y, one;
+
+	STATS_ADD(gf_sqrt, 4);
+
+	gf4_set1(&one, &GF_ONE);
+	gf4_mul2(&e, a);
+
+	/* x2 <- e^3 */
+	gf4_sqr(&x2, &e);
+	gf4_mul(&x2, &x2, &e);
+
+	/* x <- e^(2^4-1) */
+	gf4_sqr_x(&x, &x2, 2);
+	gf4_mul(&x, &x, &x2);
+
+	/* x <- e^(2^8-1) */
+	gf4_sqr_x(&y, &x, 4);
+	gf4_mul(&x, &y, &x);
+
+	/* x <- e^(2^16-1) */
+	gf4_sqr_x(&y, &x, 8);
+	gf4_mul(&x, &y, &x);
+
+	/* x <- e^(2^48-1) */
+	gf4_sqr_x(&y, &x, 16);
+	gf4_mul(&y, &y, &x);
+	gf4_sqr_x(&y, &y, 16);
+	gf4_mul(&x, &y, &x);
+
+	/* x96 <- e^(2^96-1) */
+	gf4_sqr_x(&y, &x, 48);
+	gf4_mul(&x96, &y, &x);
+
+	/* x <- e^(2^240-1) */
+	gf4_sqr_x(&y, &x96, 96);
+	gf4_mul(&y, &y, &x96);
+	gf4_sqr_x(&y, &y, 48);
+	gf4_mul(&x, &y, &x);
+
+	/* x <- e^((p-5)/8) */
+	gf4_sqr_x(&x, &x, 3);
+	gf4_mul(&x, &x, &x2);
+	gf4_sqr_x(&x, &x, 2);
+	gf4_mul(&x, &x, &e);
+	gf4_sqr_x(&x, &x, 2);
+	gf4_mul(&x, &x, &x2);
+	gf4_sqr_x(&x, &x, 3);
+	gf4_mul(&x, &x, &e);
+	gf4_sqr_x(&b, &x, 2);
+
+	/* c <- 2*a*b^2 */
+	gf4_sqr(&c, &b);
+	gf4_mul(&c, &c, &e);
+
+	/* d <- a*b*(c - 1) */
+	gf4_sub(&x, &c, &one);
+	gf4_mul(&x, &x, a);
+	gf4_mul(d, &x, &b);
+}
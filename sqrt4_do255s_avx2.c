@@ -0,0 +1,67 @@
+/*
+ * This file is meant to be included, not compiled by itself.
+ * Caller must have included/defined the following prior to inclusion:
+ *
+ *  - included "do255.h"
+ *  - defined gf4 and operations (gf_avx2.c)
+ *
+ * This file is for the AVX2 implementation of do255s. It defines:
+ *  - gf4_sqrt_candidate()
+ */
+
+/*
+ * Compute a candidate square root of each lane of a. If the lane value
+ * is a quadratic residue, then the output is one of its square roots;
+ * otherwise, the output is some unspecified value. The caller must
+ * verify the result, and select the "sign" of the root (see gf_sqrt()).
+ */
+UNUSED
+static void
+gf4_sqrt_candidate(gf4 *d, const gf4 *a)
+{
+	/*
+	 * Same computation as gf_sqrt(): since p = 3 mod 4, we raise
+	 * the value to power (p+1)/4.
+	 */
+	gf4 x, x2, y;
+
+	STATS_ADD(gf_sqrt, 4);
+
+	/* x2 <- a^3 */
+	gf4_sqr(&x2, a);
+	gf4_mul(&x2, &x2, a);
+
+	/* x <- a^(2^3-1) */
+	gf4_sqr(&x, &x2);
+	gf4_mul(&x, &x, a);
+
+	/* x <- a^(2^9-1) */
+	gf4_sqr_x(&y, &x, 3);
+	gf4_mul(&y, &y, &x);
+	gf4_sqr_x(&y, &y, 3);
+	gf4_mul(&x, &y, &x);
+
+	/* x <- a^(2^27-1) */
+	gf4_sqr_x(&y, &x, 9);
+	gf4_mul(&y, &y, &x);
+	gf4_sqr_x(&y, &y, 9);
+	gf4_mul(&x, &y, &x);
+
+	/* x <- a^(2^81-1) */
+	gf4_sqr_x(&y, &x, 27);
+	gf4_mul(&y, &y, &x);
+	gf4_sqr_x(&y, &y, 27);
+	gf4_mul(&x, &y, &x);
+
+	/* x <- a^(2^243-1) */
+	gf4_sqr_x(&y, &x, 81);
+	gf4_mul(&y, &y, &x);
+	gf4_sqr_x(&y, &y, 81);
+	gf4_mul(&x, &y, &x);
+
+	/* d <- a^(2^253 - 1024 + 35) */
+	gf4_sqr_x(&x, &x, 5);
+	gf4_mul(&x, &x, a);
+	gf4_sqr_x(&x, &x, 5);
+	gf4_mul(d, &x, &x2);
+}
@@ -39,6 +39,8 @@ gf_sqrt(gf *d, const gf *a)
 		return 1 - ((uint32_t)gf_legendre(a) >> 31);
 	}
 
+	STATS_INC(gf_sqrt);
+
 	/* e <- 2*a */
 	gf_mul2(&e, a);
 
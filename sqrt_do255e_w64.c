@@ -38,6 +38,8 @@ gf_sqrt(gf *d, const gf *a)
 		return 1 - ((uint64_t)gf_legendre(a) >> 63);
 	}
 
+	STATS_INC(gf_sqrt);
+
 	/* e <- 2*a */
 	gf_mul2(&e, a);
 
@@ -39,6 +39,8 @@ gf_sqrt(gf *d, const gf *a)
 		return 1 - ((uint32_t)gf_legendre(a) >> 31);
 	}
 
+	STATS_INC(gf_sqrt);
+
 	/* x2 <- a^3 */
 	gf_sqr(&x2, a);
 	gf_mul(&x2, &x2, a);
@@ -38,6 +38,8 @@ gf_sqrt(gf *d, const gf *a)
 		return 1 - ((uint64_t)gf_legendre(a) >> 63);
 	}
 
+	STATS_INC(gf_sqrt);
+
 	/* x2 <- a^3 */
 	gf_sqr(&x2, a);
 	gf_mul(&x2, &x2, a);
@@ -4,6 +4,27 @@
  *
  *  - defined macro CURVE to the curve identifier (e.g. do255s)
  *
+ * If macro DO255_NS is defined, then the public names are renamed with
+ * that backend name (see dispatch_ns.c).
+ *
+ * If macro DO255_MULGEN_LARGE is defined to a non-zero value, then
+ * CURVE_mulgen() uses the larger precomputed tables of the gtab_*.c
+ * files (see mkgtab.c) instead of the default four small windows.
+ * This is supported by the w64, bmi2, avx2 and w32 implementations only.
+ *
+ * If macro DO255_INV_SAFEGCD is defined to a non-zero value, then field
+ * inversion in the w64, bmi2 and avx2 implementations uses the
+ * Bernstein-Yang "safegcd" algorithm (batches of 62 divsteps) instead
+ * of the default optimized binary GCD. Results are identical, and so
+ * is performance, within a few percent (see bench_inv.c).
+ *
+ * If macro DO255_STATS is defined to a non-zero value, then field
+ * operations, point operations and window lookups are counted in the
+ * per-thread counters of do255_stats_get(), with the STATS_INC() and
+ * STATS_ADD() macros. This is supported by the w64, bmi2, avx2 and w32
+ * implementations only; it slows down all operations a bit, and is
+ * meant for profiling.
+ *
  * This file does the following:
  *
  *  - include "do255.h"
@@ -11,8 +32,37 @@
  */
 
 #include <string.h>
+#ifdef DO255_NS
+#include "dispatch_ns.c"
+#endif
 #include "do255.h"
 
+#ifndef DO255_MULGEN_LARGE
+#define DO255_MULGEN_LARGE   0
+#endif
+/*
+ * safegcd is off by default because it is not faster than the binary
+ * GCD on the tested x86 CPUs (see bench_inv.c). It can be enabled on
+ * CPUs where bench_inv shows it to be faster, or to get an inversion
+ * whose constant-time behaviour follows from a simpler argument (fixed
+ * number of divsteps, no approximation of the operands).
+ */
+#ifndef DO255_INV_SAFEGCD
+#define DO255_INV_SAFEGCD    0
+#endif
+#ifndef DO255_STATS
+#define DO255_STATS          0
+#endif
+
+#if DO255_STATS
+#include "do255_stats_internal.h"
+#define STATS_ADD(name, n) \
+	(do255_stats_current.name += (uint64_t)(n))
+#else
+#define STATS_ADD(name, n)   ((void)0)
+#endif
+#define STATS_INC(name)      STATS_ADD(name, 1)
+
 #define CN(x)            CNN(CURVE, x)
 #define CNN(cname, x)    CNN_(cname, x)
 #define CNN_(cname, x)   cname ## _ ## x
@@ -26,3 +76,45 @@
 #define FORCE_INLINE
 #define NO_INLINE
 #endif
+
+#if defined __LZCNT__
+#include <immintrin.h>
+#elif defined _MSC_VER && defined _M_X64
+#include <intrin.h>
+#endif
+
+/*
+ * Count the leading zeros of a 64-bit word (returned value is 64 if
+ * x == 0). The LZCNT opcode is used only when the compiler is allowed
+ * to assume it (e.g. with -mlzcnt); otherwise, BSR is used, since
+ * LZCNT silently executes as BSR (with a different result) on CPUs
+ * that do not support it, e.g. Intel CPUs older than Haswell, which
+ * use the w64 implementation in libdo255. Both opcodes are
+ * constant-time.
+ */
+UNUSED
+static inline uint64_t
+lzcnt64(uint64_t x)
+{
+#if defined __LZCNT__
+	return _lzcnt_u64(x);
+#elif defined __GNUC__ || defined __clang__
+	return (uint64_t)__builtin_clzll(x | 1) + (uint64_t)(x == 0);
+#elif defined _MSC_VER && defined _M_X64
+	unsigned long r;
+
+	_BitScanReverse64(&r, x | 1);
+	return (uint64_t)(63 - r) + (uint64_t)(x == 0);
+#else
+	uint64_t n, m;
+	int s;
+
+	n = 0;
+	for (s = 32; s > 0; s >>= 1) {
+		m = -(uint64_t)((x >> (64 - s)) == 0);
+		n += m & (uint64_t)s;
+		x ^= m & (x ^ (x << s));
+	}
+	return n + (uint64_t)(x == 0);
+#endif
+}
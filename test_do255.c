@@ -20,6 +20,29 @@
 #include <immintrin.h>
 #endif
 
+/*
+ * DO_PERF enables the collection of hardware performance counters
+ * (with perf_event_open()) around the measured calls of the benchmarks.
+ * It is enabled by default on Linux; if the counters cannot be opened
+ * at runtime (e.g. they are forbidden by perf_event_paranoid or by the
+ * container), then only the cycle counts are reported.
+ */
+#ifndef DO_PERF
+#if DO_BENCH86 && defined __linux__
+#define DO_PERF   1
+#else
+#define DO_PERF   0
+#endif
+#endif
+
+#if DO_PERF
+#include <errno.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
 static size_t
 hextobin(void *dst, size_t max_len, const char *src)
 {
@@ -271,6 +294,303 @@ static const uint8_t DO255S_R[] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40
 };
 
+static void
+test_shake_x4(void)
+{
+	shake_context rng;
+	int i;
+
+	printf("Test shake_x4: ");
+	fflush(stdout);
+
+	shake_init(&rng, 256);
+	shake_inject(&rng, "test shake_x4", 13);
+	shake_flip(&rng);
+
+	for (i = 0; i < 200; i ++) {
+		shake_context sc[4];
+		shake_x4_context scx;
+		uint8_t data[4][400], out1[4][300], out2[4][300];
+		const void *in[4];
+		void *out[4];
+		size_t len, off, clen;
+		unsigned size;
+		int j;
+
+		/*
+		 * Four random inputs of the same length (up to 400 bytes,
+		 * i.e. several blocks), injected and extracted in random
+		 * chunks; output must match that of four separate SHAKE
+		 * contexts.
+		 */
+		size = (i & 1) != 0 ? 256 : 128;
+		len = (size_t)i * 2;
+		for (j = 0; j < 4; j ++) {
+			shake_extract(&rng, data[j], len);
+			shake_init(&sc[j], size);
+			shake_inject(&sc[j], data[j], len);
+			shake_flip(&sc[j]);
+			shake_extract(&sc[j], out1[j], sizeof out1[j]);
+		}
+		shake_x4_init(&scx, size);
+		for (off = 0; off < len; off += clen) {
+			uint8_t x;
+
+			shake_extract(&rng, &x, 1);
+			clen = x;
+			if (clen > len - off) {
+				clen = len - off;
+			}
+			for (j = 0; j < 4; j ++) {
+				in[j] = data[j] + off;
+			}
+			shake_x4_inject(&scx, in, clen);
+		}
+		shake_x4_flip(&scx);
+		for (off = 0; off < sizeof out2[0]; off += clen) {
+			uint8_t x;
+
+			shake_extract(&rng, &x, 1);
+			clen = x;
+			if (clen > sizeof out2[0] - off) {
+				clen = sizeof out2[0] - off;
+			}
+			for (j = 0; j < 4; j ++) {
+				out[j] = out2[j] + off;
+			}
+			shake_x4_extract(&scx, out, clen);
+		}
+		for (j = 0; j < 4; j ++) {
+			check_equals(out1[j], out2[j], sizeof out1[j],
+				"shake_x4");
+		}
+
+		if (i % 10 == 0) {
+			printf(".");
+			fflush(stdout);
+		}
+	}
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+/*
+ * KangarooTwelve test vectors (RFC 9861): message is ptn(17^i bytes)
+ * for i = 0 to 5 (i.e. 1 to 1419857 bytes; ptn(n) is the sequence
+ * 00 01 02 .. F9 FA, repeated, truncated to n bytes), with an empty
+ * customization string and a 32-byte output. First vector is for the
+ * empty message.
+ */
+static const char *const KAT_KT128[] = {
+	"1ac2d450fc3b4205d19da7bfca1b37513c0803577ac7167f06fe2ce1f0ef39e5",
+	"2bda92450e8b147f8a7cb629e784a058efca7cf7d8218e02d345dfaa65244a1f",
+	"6bf75fa2239198db4772e36478f8e19b0f371205f6a9a93a273f51df37122888",
+	"0c315ebcdedbf61426de7dcf8fb725d1e74675d7f5327a5067f367b108ecb67c",
+	"cb552e2ec77d9910701d578b457ddf772c12e322e4ee7fe417f92c758f0d59d0",
+	"8701045e22205345ff4dda05555cbb5c3af1a771c2b89baef37db43d9998b9fe",
+	"844d610933b1b9963cbdeb5ae3b6b05cc7cbd67ceedf883eb678a0a8e0371682",
+	NULL
+};
+
+static void
+test_kt128(void)
+{
+	static uint8_t msg[1419857];
+	uint8_t out[64], ref[64];
+	turboshake_context tc;
+	kt128_context kc;
+	shake_context rng;
+	size_t u, len;
+	int i;
+
+	printf("Test kt128: ");
+	fflush(stdout);
+
+	for (u = 0; u < sizeof msg; u ++) {
+		msg[u] = (uint8_t)(u % 251);
+	}
+
+	/*
+	 * TurboSHAKE on the empty message (RFC 9861).
+	 */
+	turboshake_init(&tc, 128);
+	turboshake_flip(&tc, 0x1F);
+	turboshake_extract(&tc, out, 32);
+	HEXTOBIN_LEN(ref, 32, "1e415f1c5983aff2169217277d17bb53"
+		"8cd945a397ddec541f1ce41af2c1b74c");
+	check_equals(out, ref, 32, "TurboSHAKE128");
+	turboshake_init(&tc, 256);
+	turboshake_flip(&tc, 0x1F);
+	turboshake_extract(&tc, out, 64);
+	HEXTOBIN_LEN(ref, 64, "367a329dafea871c7802ec67f905ae13"
+		"c57695dc2c6663c61035f59a18f8e7db"
+		"11edc0e12e91ea60eb6b32df06dd7f00"
+		"2fbafabb6e13ec1cc20d995547600db0");
+	check_equals(out, ref, 64, "TurboSHAKE256");
+	printf(".");
+	fflush(stdout);
+
+	/*
+	 * KAT, with the message injected in one call.
+	 */
+	len = 0;
+	for (i = 0; KAT_KT128[i] != NULL; i ++) {
+		kt128_init(&kc);
+		kt128_inject(&kc, msg, len);
+		kt128_flip(&kc, NULL, 0);
+		kt128_extract(&kc, out, 32);
+		HEXTOBIN_LEN(ref, 32, KAT_KT128[i]);
+		check_equals(out, ref, 32, "KT128 KAT");
+		len = (len == 0) ? 1 : len * 17;
+		printf(".");
+		fflush(stdout);
+	}
+
+	/*
+	 * Customization string (RFC 9861): M = FF FF FF, C = ptn(41^2).
+	 */
+	kt128_init(&kc);
+	memset(out, 0xFF, 3);
+	kt128_inject(&kc, out, 3);
+	kt128_flip(&kc, msg, 41 * 41);
+	kt128_extract(&kc, out, 32);
+	HEXTOBIN_LEN(ref, 32, "c389e5009ae57120854c2e8c64670ac0"
+		"1358cf4c1baf89447a724234dc7ced74");
+	check_equals(out, ref, 32, "KT128 custom");
+	printf(".");
+	fflush(stdout);
+
+	/*
+	 * Same output when the message is injected in random chunks
+	 * (which exercises both the one-by-one and four-way leaf
+	 * processing).
+	 */
+	shake_init(&rng, 256);
+	shake_inject(&rng, "test kt128", 10);
+	shake_flip(&rng);
+	for (i = 0; i < 10; i ++) {
+		size_t off;
+
+		len = 83521 + (size_t)i * 40000;
+		kt128_init(&kc);
+		kt128_inject(&kc, msg, len);
+		kt128_flip(&kc, "test", 4);
+		kt128_extract(&kc, ref, 32);
+		kt128_init(&kc);
+		for (off = 0; off < len;) {
+			uint8_t tmp[2];
+			size_t clen;
+
+			shake_extract(&rng, tmp, 2);
+			clen = (size_t)tmp[0] | ((size_t)tmp[1] << 8);
+			if (i % 2 == 0) {
+				clen = (clen & 7) * 8192;
+			}
+			if (clen > len - off) {
+				clen = len - off;
+			}
+			kt128_inject(&kc, msg + off, clen);
+			off += clen;
+		}
+		kt128_flip(&kc, "test", 4);
+		kt128_extract(&kc, out, 32);
+		check_equals(out, ref, 32, "KT128 chunks");
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+#ifndef DO255_STATS
+#define DO255_STATS   0
+#endif
+
+static void
+test_stats(void)
+{
+	do255_stats st;
+	do255e_point Pe;
+	do255s_point Ps;
+	shake_context sc;
+	uint8_t buf[200];
+	size_t u;
+
+	printf("Test stats: ");
+	fflush(stdout);
+
+	/*
+	 * Exact counts for operations with a known cost: five doublings
+	 * on each curve; one Keccak-f for the 200-byte input (rate is
+	 * 136 bytes for SHAKE256) and one for the output.
+	 */
+	memset(buf, 0x5A, sizeof buf);
+	do255_stats_reset();
+	do255e_double_x(&Pe, &do255e_generator, 5);
+	do255s_double_x(&Ps, &do255s_generator, 5);
+	shake_init(&sc, 256);
+	shake_inject(&sc, buf, sizeof buf);
+	shake_flip(&sc);
+	shake_extract(&sc, buf, 32);
+	do255_stats_get(&st);
+	if (st.point_double != (DO255_STATS ? 10 : 0)
+		|| st.point_add != 0 || st.point_add_mixed != 0
+		|| st.window_lookup != 0
+		|| st.keccak != (DO255_STATS ? 2 : 0))
+	{
+		fprintf(stderr, "unexpected stats (doublings)\n");
+		exit(EXIT_FAILURE);
+	}
+	printf(".");
+	fflush(stdout);
+
+	/*
+	 * Generator multiplication uses all kinds of field operations,
+	 * point operations and window lookups.
+	 */
+	do255_stats_reset();
+	do255e_mulgen(&Pe, buf);
+	do255s_mulgen(&Ps, buf);
+	do255e_encode(buf, &Pe);
+	do255s_encode(buf, &Ps);
+	do255_stats_get(&st);
+	if (DO255_STATS) {
+		if (st.gf_mul == 0 || st.gf_sqr == 0 || st.gf_inv == 0
+			|| st.point_add_mixed == 0 || st.window_lookup == 0)
+		{
+			fprintf(stderr, "missing stats (mulgen)\n");
+			exit(EXIT_FAILURE);
+		}
+	} else {
+		if (st.gf_mul != 0 || st.gf_sqr != 0 || st.gf_inv != 0
+			|| st.point_add_mixed != 0 || st.window_lookup != 0)
+		{
+			fprintf(stderr, "unexpected stats (mulgen)\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	printf(".");
+	fflush(stdout);
+
+	/*
+	 * Reset clears all counters.
+	 */
+	do255_stats_reset();
+	do255_stats_get(&st);
+	for (u = 0; u < (sizeof st) / sizeof(uint64_t); u ++) {
+		if (((const uint64_t *)&st)[u] != 0) {
+			fprintf(stderr, "stats not reset\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	printf(".");
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
 static void
 test_do255e_scalar(void)
 {
@@ -1702,93 +2022,107 @@ test_do255s_add(void)
 }
 
 static void
-test_do255e_add(void)
+test_do255e_encode_batch(void)
 {
-	const char *const *s;
+	static const size_t nums[] = { 0, 1, 2, 5, 31, 32, 33, 70 };
+	do255e_point P[70];
+	uint8_t buf[70 * 32], tmp[32];
+	shake_context rng;
+	size_t i;
 
-	printf("Test do255e add: ");
+	printf("Test do255e encode_batch: ");
 	fflush(stdout);
 
-	s = KAT_DO255E_POINT_ADD;
-	while (*s != NULL) {
-		uint8_t e1[32], e2[32], e3[32], e4[32], e5[32], e6[32];
-		uint8_t tmp[32];
-		do255e_point P1, P2, P3, P4, P5, P6, T, U;
-		int j, n;
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_encode_batch", 24);
+	shake_flip(&rng);
 
-		HEXTOBIN(e1, *s ++);
-		HEXTOBIN(e2, *s ++);
-		HEXTOBIN(e3, *s ++);
-		HEXTOBIN(e4, *s ++);
-		HEXTOBIN(e5, *s ++);
-		HEXTOBIN(e6, *s ++);
-		if (!do255e_decode(&P1, e1)
-			|| !do255e_decode(&P2, e2)
-			|| !do255e_decode(&P3, e3)
-			|| !do255e_decode(&P4, e4)
-			|| !do255e_decode(&P5, e5)
-			|| !do255e_decode(&P6, e6))
-		{
-			fprintf(stderr, "Decoding failed\n");
-			exit(EXIT_FAILURE);
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		size_t u, num;
+
+		/*
+		 * Points are in Jacobian coordinates with random Z
+		 * (results of point multiplications); some of them are
+		 * the neutral.
+		 */
+		num = nums[i];
+		for (u = 0; u < num; u ++) {
+			shake_extract(&rng, tmp, 32);
+			do255e_mulgen(&P[u], tmp);
+			shake_extract(&rng, tmp, 32);
+			do255e_mul(&P[u], &P[u], tmp);
+			if (u % 7 == 3) {
+				P[u] = do255e_neutral;
+			}
 		}
 
-		/* P1 + N = P1 */
-		do255e_add(&T, &P1, &do255e_neutral);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e1, 32, "KAT add 1");
-		do255e_add(&T, &do255e_neutral, &P1);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e1, 32, "KAT add 2");
+		do255e_encode_batch(buf, P, num);
+		for (u = 0; u < num; u ++) {
+			do255e_encode(tmp, &P[u]);
+			check_equals(buf + 32 * u, tmp, 32,
+				"encode_batch");
+		}
+		do255e_encode_squared_w_batch(buf, P, num);
+		for (u = 0; u < num; u ++) {
+			do255e_encode_squared_w(tmp, &P[u]);
+			check_equals(buf + 32 * u, tmp, 32,
+				"encode_squared_w_batch");
+		}
 
-		/* P3 = P1 + P2 */
-		do255e_add(&T, &P1, &P2);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e3, 32, "KAT add 3");
-		do255e_add(&T, &P2, &P1);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e3, 32, "KAT add 4");
+		printf(".");
+		fflush(stdout);
+	}
 
-		/* P4 = 2*P1 */
-		do255e_add(&T, &P1, &P1);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e4, 32, "KAT add 5");
-		do255e_double(&T, &P1);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e4, 32, "KAT add 6");
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-		/* P5 = 2*P1 + P2 */
-		do255e_double(&T, &P1);
-		do255e_add(&T, &T, &P2);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e5, 32, "KAT add 7");
-		do255e_add(&T, &P1, &P2);
-		do255e_add(&T, &T, &P1);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e5, 32, "KAT add 8");
+static void
+test_do255s_encode_batch(void)
+{
+	static const size_t nums[] = { 0, 1, 2, 5, 31, 32, 33, 70 };
+	do255s_point P[70];
+	uint8_t buf[70 * 32], tmp[32];
+	shake_context rng;
+	size_t i;
 
-		/* P6 = 2*(P1 + P2) = 2*P1 + 2*P2 */
-		do255e_add(&T, &P1, &P2);
-		do255e_double(&T, &T);
-		do255e_encode(tmp, &T);
-		check_equals(tmp, e6, 32, "KAT add 9");
-		do255e_double(&T, &P1);
-		do255e_double(&U, &P2);
-		do255e_add(&U, &T, &U);
-		do255e_encode(tmp, &U);
-		check_equals(tmp, e6, 32, "KAT add 10");
+	printf("Test do255s encode_batch: ");
+	fflush(stdout);
 
-		/* Check multiple doublings. */
-		for (n = 0; n < 8; n ++) {
-			do255e_double_x(&T, &P1, n);
-			do255e_encode(e1, &T);
-			U = P1;
-			for (j = 0; j < n; j ++) {
-				do255e_double(&U, &U);
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_encode_batch", 24);
+	shake_flip(&rng);
+
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		size_t u, num;
+
+		/*
+		 * Points are in Jacobian coordinates with random Z
+		 * (results of point multiplications); some of them are
+		 * the neutral.
+		 */
+		num = nums[i];
+		for (u = 0; u < num; u ++) {
+			shake_extract(&rng, tmp, 32);
+			do255s_mulgen(&P[u], tmp);
+			shake_extract(&rng, tmp, 32);
+			do255s_mul(&P[u], &P[u], tmp);
+			if (u % 7 == 3) {
+				P[u] = do255s_neutral;
 			}
-			do255e_encode(e2, &U);
-			sprintf((char *)tmp, "double_x %d", n);
-			check_equals(e1, e2, 32, (char *)tmp);
+		}
+
+		do255s_encode_batch(buf, P, num);
+		for (u = 0; u < num; u ++) {
+			do255s_encode(tmp, &P[u]);
+			check_equals(buf + 32 * u, tmp, 32,
+				"encode_batch");
+		}
+		do255s_encode_squared_w_batch(buf, P, num);
+		for (u = 0; u < num; u ++) {
+			do255s_encode_squared_w(tmp, &P[u]);
+			check_equals(buf + 32 * u, tmp, 32,
+				"encode_squared_w_batch");
 		}
 
 		printf(".");
@@ -1799,41 +2133,465 @@ test_do255e_add(void)
 	fflush(stdout);
 }
 
-/*
- * Each entry is: point, scalar, result.
- */
-static const char *KAT_DO255S_POINT_MUL[] = {
-	"5dc536d2997635a8a3bbff585cebccb8b05f4689535d464a687daf26b0a85e50",
-	"ee5f3f239a06a05bb113cd4f568e4f85ec3a6fd7f394b0d35c30af7ef25cb088",
-	"294d9711c65e9d92d6a461390c74af1e6736d9eb1beab7956c95c5f93f7b0016",
-
-	"22cdffbbb8f87841aab2ec1afa2c5fb5cb8f67e286d0fdcaf6124951a21a597a",
-	"24c84823084e64146d09b64a58ed5f39256b568834c4215687ac642436a5d17e",
-	"1ea8dba51fd35925488a671414cbb276c1e9bae3731967ca63cf53cae6428b0d",
+static void
+test_do255e_decode_batch(void)
+{
+	static const size_t nums[] = { 0, 1, 2, 3, 4, 5, 7, 8, 13, 40 };
+	do255e_point P[40], Q;
+	uint8_t buf[40 * 32], ok[40];
+	shake_context rng;
+	size_t i;
 
-	"2ca39783b2d55263d0b1c8f0cdce65f35536959e0127d8522b9624535d750e7c",
-	"0fe8dd3dacef7df60e4ba71de3d35e5e6aeb6fbf7c960f72626fd3aae43c8b88",
-	"ba32589f0ec3475f0ec62059e65a370df09ddcca269c0548d14e66967b95f664",
+	printf("Test do255e decode_batch: ");
+	fflush(stdout);
 
-	"b514f908b623f7858ab324cdef9eea187b094192cf3c5c55e0a657cc13faeb14",
-	"84d3e49037e45ecde991d0742d2f82c3ba9e2a0f0902fde2596369d9b0e5dd94",
-	"8715245a20000eb3af5970f87237c4bba588af8e703143089b6b9f86fa1df51b",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_decode_batch", 24);
+	shake_flip(&rng);
 
-	"73156faf9fbd65fd4af9ad2fec458760cb13ae044adf35bc4212ea0698e46d4e",
-	"d350128f36b85d365060770fa450cb4a37a95842b5b84de39528c2a66b5425e6",
-	"89daddb7da6f0379478aa027e963d140c6a3696b791140fee1e6b50ded5c1c56",
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		size_t u, num;
+		int all, r;
 
-	"e74f7f5f0deaebbecac8ec772db37e5d495ba594e4f97a42e36ae544d1b6b748",
-	"8ee094aed7a63b40981dddc40ec2e8ac9e1b8d3d3e40bdb4fdf6e35ad2afb262",
-	"0a5fd0843da111a93b585a877690136cc610a0042d90937cbd5c88a7b9bfd76d",
+		/*
+		 * Inputs are a mix of valid encodings, encodings of the
+		 * neutral, random bytes (about half of them are invalid),
+		 * non-canonical values, and values with the top bit set.
+		 */
+		num = nums[i];
+		for (u = 0; u < num; u ++) {
+			uint8_t *enc;
+
+			enc = buf + 32 * u;
+			shake_extract(&rng, enc, 32);
+			switch (u % 5) {
+			case 0:
+			case 1:
+				do255e_mulgen(&Q, enc);
+				do255e_encode(enc, &Q);
+				break;
+			case 2:
+				if (u % 3 == 0) {
+					memset(enc, 0, 32);
+				} else {
+					enc[31] &= 0x7F;
+				}
+				break;
+			case 3:
+				if (u % 2 == 0) {
+					memset(enc, 0xFF, 32);
+					enc[31] = 0x7F;
+				} else {
+					enc[31] &= 0x7F;
+				}
+				break;
+			default:
+				enc[31] |= 0x80;
+				break;
+			}
+		}
 
-	"ea9fab33e79dc4c47f83d95eb0f8cc0d486c78d1cb512603cd83aa7f7ecda23a",
-	"a8e4a6496f60ea4cc879bfce649ffde1651c6258e6fdb6109dc431faf1f1676a",
-	"7fd8e7464f704e0e4476ff6f188ee8b89ba8687d2dcf2097e30926289859c45c",
+		memset(ok, 0xA5, sizeof ok);
+		all = do255e_decode_batch(P, ok, buf, num);
+		r = 1;
+		for (u = 0; u < num; u ++) {
+			int rq;
 
-	"1bcb940392743b88e7bd5162aba895bd215e6726ae560d7c50162ccf60d61229",
-	"078d80335d06b2f52557ba6382a32d6531bef339e7b6fd96881a332800f4d85a",
-	"270537a047f33d4b82c4d9f12c3c3e1a3ee981dbaa78c7715f5874add68b9f7f",
+			rq = do255e_decode(&Q, buf + 32 * u);
+			if (ok[u] != rq) {
+				fprintf(stderr, "ERR decode_batch status\n");
+				exit(EXIT_FAILURE);
+			}
+			if (do255e_eq(&P[u], &Q) != 1
+				|| do255e_is_neutral(&P[u]) != do255e_is_neutral(&Q))
+			{
+				fprintf(stderr, "ERR decode_batch point\n");
+				exit(EXIT_FAILURE);
+			}
+			r &= rq;
+		}
+		if (all != r) {
+			fprintf(stderr, "ERR decode_batch return\n");
+			exit(EXIT_FAILURE);
+		}
+		if (do255e_decode_batch(P, NULL, buf, num) != r) {
+			fprintf(stderr, "ERR decode_batch (ok == NULL)\n");
+			exit(EXIT_FAILURE);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255s_decode_batch(void)
+{
+	static const size_t nums[] = { 0, 1, 2, 3, 4, 5, 7, 8, 13, 40 };
+	do255s_point P[40], Q;
+	uint8_t buf[40 * 32], ok[40];
+	shake_context rng;
+	size_t i;
+
+	printf("Test do255s decode_batch: ");
+	fflush(stdout);
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_decode_batch", 24);
+	shake_flip(&rng);
+
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		size_t u, num;
+		int all, r;
+
+		/*
+		 * Inputs are a mix of valid encodings, encodings of the
+		 * neutral, random bytes (about half of them are invalid),
+		 * non-canonical values, and values with the top bit set.
+		 */
+		num = nums[i];
+		for (u = 0; u < num; u ++) {
+			uint8_t *enc;
+
+			enc = buf + 32 * u;
+			shake_extract(&rng, enc, 32);
+			switch (u % 5) {
+			case 0:
+			case 1:
+				do255s_mulgen(&Q, enc);
+				do255s_encode(enc, &Q);
+				break;
+			case 2:
+				if (u % 3 == 0) {
+					memset(enc, 0, 32);
+				} else {
+					enc[31] &= 0x7F;
+				}
+				break;
+			case 3:
+				if (u % 2 == 0) {
+					memset(enc, 0xFF, 32);
+					enc[31] = 0x7F;
+				} else {
+					enc[31] &= 0x7F;
+				}
+				break;
+			default:
+				enc[31] |= 0x80;
+				break;
+			}
+		}
+
+		memset(ok, 0xA5, sizeof ok);
+		all = do255s_decode_batch(P, ok, buf, num);
+		r = 1;
+		for (u = 0; u < num; u ++) {
+			int rq;
+
+			rq = do255s_decode(&Q, buf + 32 * u);
+			if (ok[u] != rq) {
+				fprintf(stderr, "ERR decode_batch status\n");
+				exit(EXIT_FAILURE);
+			}
+			if (do255s_eq(&P[u], &Q) != 1
+				|| do255s_is_neutral(&P[u]) != do255s_is_neutral(&Q))
+			{
+				fprintf(stderr, "ERR decode_batch point\n");
+				exit(EXIT_FAILURE);
+			}
+			r &= rq;
+		}
+		if (all != r) {
+			fprintf(stderr, "ERR decode_batch return\n");
+			exit(EXIT_FAILURE);
+		}
+		if (do255s_decode_batch(P, NULL, buf, num) != r) {
+			fprintf(stderr, "ERR decode_batch (ok == NULL)\n");
+			exit(EXIT_FAILURE);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255e_decode_vartime(void)
+{
+	shake_context rng;
+	int i;
+
+	printf("Test do255e decode_vartime: ");
+	fflush(stdout);
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_decode_vartime", 25);
+	shake_flip(&rng);
+
+	for (i = 0; i < 200; i ++) {
+		do255e_point P, Q;
+		uint8_t enc[32];
+		int r1, r2;
+
+		/*
+		 * Same mix of inputs as in test_do255e_decode_batch().
+		 */
+		shake_extract(&rng, enc, 32);
+		switch (i % 5) {
+		case 0:
+		case 1:
+			do255e_mulgen(&Q, enc);
+			do255e_encode(enc, &Q);
+			break;
+		case 2:
+			if (i % 3 == 0) {
+				memset(enc, 0, 32);
+			} else {
+				enc[31] &= 0x7F;
+			}
+			break;
+		case 3:
+			if (i % 2 == 0) {
+				memset(enc, 0xFF, 32);
+				enc[31] = 0x7F;
+			} else {
+				enc[31] &= 0x7F;
+			}
+			break;
+		default:
+			enc[31] |= 0x80;
+			break;
+		}
+
+		r1 = do255e_decode(&P, enc);
+		r2 = do255e_decode_vartime(&Q, enc);
+		if (r1 != r2 || memcmp(&P, &Q, sizeof P) != 0) {
+			fprintf(stderr, "ERR decode_vartime\n");
+			exit(EXIT_FAILURE);
+		}
+		if (do255e_decode_vartime(NULL, enc) != r1) {
+			fprintf(stderr, "ERR decode_vartime (P == NULL)\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if (i % 10 == 0) {
+			printf(".");
+			fflush(stdout);
+		}
+	}
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255s_decode_vartime(void)
+{
+	shake_context rng;
+	int i;
+
+	printf("Test do255s decode_vartime: ");
+	fflush(stdout);
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_decode_vartime", 25);
+	shake_flip(&rng);
+
+	for (i = 0; i < 200; i ++) {
+		do255s_point P, Q;
+		uint8_t enc[32];
+		int r1, r2;
+
+		/*
+		 * Same mix of inputs as in test_do255s_decode_batch().
+		 */
+		shake_extract(&rng, enc, 32);
+		switch (i % 5) {
+		case 0:
+		case 1:
+			do255s_mulgen(&Q, enc);
+			do255s_encode(enc, &Q);
+			break;
+		case 2:
+			if (i % 3 == 0) {
+				memset(enc, 0, 32);
+			} else {
+				enc[31] &= 0x7F;
+			}
+			break;
+		case 3:
+			if (i % 2 == 0) {
+				memset(enc, 0xFF, 32);
+				enc[31] = 0x7F;
+			} else {
+				enc[31] &= 0x7F;
+			}
+			break;
+		default:
+			enc[31] |= 0x80;
+			break;
+		}
+
+		r1 = do255s_decode(&P, enc);
+		r2 = do255s_decode_vartime(&Q, enc);
+		if (r1 != r2 || memcmp(&P, &Q, sizeof P) != 0) {
+			fprintf(stderr, "ERR decode_vartime\n");
+			exit(EXIT_FAILURE);
+		}
+		if (do255s_decode_vartime(NULL, enc) != r1) {
+			fprintf(stderr, "ERR decode_vartime (P == NULL)\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if (i % 10 == 0) {
+			printf(".");
+			fflush(stdout);
+		}
+	}
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255e_add(void)
+{
+	const char *const *s;
+
+	printf("Test do255e add: ");
+	fflush(stdout);
+
+	s = KAT_DO255E_POINT_ADD;
+	while (*s != NULL) {
+		uint8_t e1[32], e2[32], e3[32], e4[32], e5[32], e6[32];
+		uint8_t tmp[32];
+		do255e_point P1, P2, P3, P4, P5, P6, T, U;
+		int j, n;
+
+		HEXTOBIN(e1, *s ++);
+		HEXTOBIN(e2, *s ++);
+		HEXTOBIN(e3, *s ++);
+		HEXTOBIN(e4, *s ++);
+		HEXTOBIN(e5, *s ++);
+		HEXTOBIN(e6, *s ++);
+		if (!do255e_decode(&P1, e1)
+			|| !do255e_decode(&P2, e2)
+			|| !do255e_decode(&P3, e3)
+			|| !do255e_decode(&P4, e4)
+			|| !do255e_decode(&P5, e5)
+			|| !do255e_decode(&P6, e6))
+		{
+			fprintf(stderr, "Decoding failed\n");
+			exit(EXIT_FAILURE);
+		}
+
+		/* P1 + N = P1 */
+		do255e_add(&T, &P1, &do255e_neutral);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e1, 32, "KAT add 1");
+		do255e_add(&T, &do255e_neutral, &P1);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e1, 32, "KAT add 2");
+
+		/* P3 = P1 + P2 */
+		do255e_add(&T, &P1, &P2);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e3, 32, "KAT add 3");
+		do255e_add(&T, &P2, &P1);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e3, 32, "KAT add 4");
+
+		/* P4 = 2*P1 */
+		do255e_add(&T, &P1, &P1);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e4, 32, "KAT add 5");
+		do255e_double(&T, &P1);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e4, 32, "KAT add 6");
+
+		/* P5 = 2*P1 + P2 */
+		do255e_double(&T, &P1);
+		do255e_add(&T, &T, &P2);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e5, 32, "KAT add 7");
+		do255e_add(&T, &P1, &P2);
+		do255e_add(&T, &T, &P1);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e5, 32, "KAT add 8");
+
+		/* P6 = 2*(P1 + P2) = 2*P1 + 2*P2 */
+		do255e_add(&T, &P1, &P2);
+		do255e_double(&T, &T);
+		do255e_encode(tmp, &T);
+		check_equals(tmp, e6, 32, "KAT add 9");
+		do255e_double(&T, &P1);
+		do255e_double(&U, &P2);
+		do255e_add(&U, &T, &U);
+		do255e_encode(tmp, &U);
+		check_equals(tmp, e6, 32, "KAT add 10");
+
+		/* Check multiple doublings. */
+		for (n = 0; n < 8; n ++) {
+			do255e_double_x(&T, &P1, n);
+			do255e_encode(e1, &T);
+			U = P1;
+			for (j = 0; j < n; j ++) {
+				do255e_double(&U, &U);
+			}
+			do255e_encode(e2, &U);
+			sprintf((char *)tmp, "double_x %d", n);
+			check_equals(e1, e2, 32, (char *)tmp);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+/*
+ * Each entry is: point, scalar, result.
+ */
+static const char *KAT_DO255S_POINT_MUL[] = {
+	"5dc536d2997635a8a3bbff585cebccb8b05f4689535d464a687daf26b0a85e50",
+	"ee5f3f239a06a05bb113cd4f568e4f85ec3a6fd7f394b0d35c30af7ef25cb088",
+	"294d9711c65e9d92d6a461390c74af1e6736d9eb1beab7956c95c5f93f7b0016",
+
+	"22cdffbbb8f87841aab2ec1afa2c5fb5cb8f67e286d0fdcaf6124951a21a597a",
+	"24c84823084e64146d09b64a58ed5f39256b568834c4215687ac642436a5d17e",
+	"1ea8dba51fd35925488a671414cbb276c1e9bae3731967ca63cf53cae6428b0d",
+
+	"2ca39783b2d55263d0b1c8f0cdce65f35536959e0127d8522b9624535d750e7c",
+	"0fe8dd3dacef7df60e4ba71de3d35e5e6aeb6fbf7c960f72626fd3aae43c8b88",
+	"ba32589f0ec3475f0ec62059e65a370df09ddcca269c0548d14e66967b95f664",
+
+	"b514f908b623f7858ab324cdef9eea187b094192cf3c5c55e0a657cc13faeb14",
+	"84d3e49037e45ecde991d0742d2f82c3ba9e2a0f0902fde2596369d9b0e5dd94",
+	"8715245a20000eb3af5970f87237c4bba588af8e703143089b6b9f86fa1df51b",
+
+	"73156faf9fbd65fd4af9ad2fec458760cb13ae044adf35bc4212ea0698e46d4e",
+	"d350128f36b85d365060770fa450cb4a37a95842b5b84de39528c2a66b5425e6",
+	"89daddb7da6f0379478aa027e963d140c6a3696b791140fee1e6b50ded5c1c56",
+
+	"e74f7f5f0deaebbecac8ec772db37e5d495ba594e4f97a42e36ae544d1b6b748",
+	"8ee094aed7a63b40981dddc40ec2e8ac9e1b8d3d3e40bdb4fdf6e35ad2afb262",
+	"0a5fd0843da111a93b585a877690136cc610a0042d90937cbd5c88a7b9bfd76d",
+
+	"ea9fab33e79dc4c47f83d95eb0f8cc0d486c78d1cb512603cd83aa7f7ecda23a",
+	"a8e4a6496f60ea4cc879bfce649ffde1651c6258e6fdb6109dc431faf1f1676a",
+	"7fd8e7464f704e0e4476ff6f188ee8b89ba8687d2dcf2097e30926289859c45c",
+
+	"1bcb940392743b88e7bd5162aba895bd215e6726ae560d7c50162ccf60d61229",
+	"078d80335d06b2f52557ba6382a32d6531bef339e7b6fd96881a332800f4d85a",
+	"270537a047f33d4b82c4d9f12c3c3e1a3ee981dbaa78c7715f5874add68b9f7f",
 
 	"fed66edc33f4bab3130c952ad4593bdf572b2b05ee0c422f4f7681d14549a55b",
 	"cce339e0bfd3f9e30f14a44217e1c0bafdcb03120031a9eb234db4b25a6b359e",
@@ -2187,28 +2945,68 @@ test_do255e_verify_helper(void)
 		}
 	}
 
-	printf(" done.\n");
-	fflush(stdout);
-}
-
-static void
-test_do255s_verify_helper(void)
-{
-	shake_context rng;
-	int i;
-
-	printf("Test do255s verify helper: ");
-	fflush(stdout);
-
-	shake_init(&rng, 128);
-	shake_inject(&rng, "test do255s_verify_helper", 25);
-	shake_flip(&rng);
-
-	for (i = 0; i < 1000; i ++) {
+	/*
+	 * Precomputed table: random points, and the neutral (which is
+	 * tested with the table only, since the plain helper assumes a
+	 * non-neutral P on some implementations).
+	 */
+	for (i = 0; i < 100; i ++) {
 		uint8_t tmp[32], k0[32], k1[32];
-		do255s_point P, T, U;
+		do255e_point P, T, U;
+		do255e_verify_table tab;
 
-		shake_extract(&rng, tmp, 32);
+		if (i == 0) {
+			P = do255e_neutral;
+		} else {
+			shake_extract(&rng, tmp, 32);
+			do255e_mulgen(&P, tmp);
+		}
+		do255e_verify_table_init(&tab, &P);
+		shake_extract(&rng, k0, 32);
+		do255e_mulgen(&T, k0);
+		shake_extract(&rng, k1, 32);
+		do255e_mul(&U, &P, k1);
+		do255e_add(&T, &T, &U);
+		do255e_encode(tmp, &T);
+		if (!do255e_verify_helper_table_vartime(k0, &tab, k1, tmp)) {
+			fprintf(stderr, "verify (table) failed\n");
+			exit(EXIT_FAILURE);
+		}
+		do255e_add(&T, &T, &do255e_generator);
+		do255e_encode(tmp, &T);
+		if (do255e_verify_helper_table_vartime(k0, &tab, k1, tmp)) {
+			fprintf(stderr, "verify (table) should have failed\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if (i % 10 == 0) {
+			printf(".");
+			fflush(stdout);
+		}
+	}
+
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255s_verify_helper(void)
+{
+	shake_context rng;
+	int i;
+
+	printf("Test do255s verify helper: ");
+	fflush(stdout);
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_verify_helper", 25);
+	shake_flip(&rng);
+
+	for (i = 0; i < 1000; i ++) {
+		uint8_t tmp[32], k0[32], k1[32];
+		do255s_point P, T, U;
+
+		shake_extract(&rng, tmp, 32);
 		do255s_mulgen(&P, tmp);
 		shake_extract(&rng, k0, 32);
 		do255s_mulgen(&T, k0);
@@ -2233,1248 +3031,3404 @@ test_do255s_verify_helper(void)
 		}
 	}
 
+	/*
+	 * Precomputed table: random points, and the neutral (which is
+	 * tested with the table only, since the plain helper assumes a
+	 * non-neutral P on some implementations).
+	 */
+	for (i = 0; i < 100; i ++) {
+		uint8_t tmp[32], k0[32], k1[32];
+		do255s_point P, T, U;
+		do255s_verify_table tab;
+
+		if (i == 0) {
+			P = do255s_neutral;
+		} else {
+			shake_extract(&rng, tmp, 32);
+			do255s_mulgen(&P, tmp);
+		}
+		do255s_verify_table_init(&tab, &P);
+		shake_extract(&rng, k0, 32);
+		do255s_mulgen(&T, k0);
+		shake_extract(&rng, k1, 32);
+		do255s_mul(&U, &P, k1);
+		do255s_add(&T, &T, &U);
+		do255s_encode(tmp, &T);
+		if (!do255s_verify_helper_table_vartime(k0, &tab, k1, tmp)) {
+			fprintf(stderr, "verify (table) failed\n");
+			exit(EXIT_FAILURE);
+		}
+		do255s_add(&T, &T, &do255s_generator);
+		do255s_encode(tmp, &T);
+		if (do255s_verify_helper_table_vartime(k0, &tab, k1, tmp)) {
+			fprintf(stderr, "verify (table) should have failed\n");
+			exit(EXIT_FAILURE);
+		}
+
+		if (i % 10 == 0) {
+			printf(".");
+			fflush(stdout);
+		}
+	}
+
 	printf(" done.\n");
 	fflush(stdout);
 }
 
-/*
- * KAT do255e keygen.
- * For i in 0..19, keygen with SHAKE256((byte)i) as source.
- */
-static const char *const KAT_DO255E_KEYGEN[] = {
-	"938b4583a72eb5382f3a2fa2ce57c3a4e5de0bbf30042ef0a86e36f4b8600d14",
-	"b7d9c6c6adaf587b03120202c168831bc23b2a67f66d15aa0ce1382baaf14d52",
-
-	"4a50b29655af442c8499c037f18ce8c278153d5b748baf796190856803d9773a",
-	"ff2ac7224924892e240c731ec2e48309015d811568c9973d35ecdbc894a64704",
+static void
+test_do255e_mul_multi(void)
+{
+	static const size_t nums[] = { 0, 1, 2, 3, 4, 5, 8, 9, 13, 17 };
+	do255e_point P[17];
+	uint8_t k[17][32];
+	shake_context rng;
+	size_t i;
 
-	"642e9115343df132c945255f0ff3d6969a9b5b7d7cb4adb2ca59716b5eacf811",
-	"7f98f2bbf09789958c3613236c91b71762eb003778add1885490ee94c20aed47",
+	printf("Test do255e mul_multi: ");
+	fflush(stdout);
 
-	"db4252337900d8ab7f609d170135d459a6798945d5a574d4a9db7b623c754d07",
-	"5c9faa85d638a92d9e5c12afa46d49c2420efaab23190241530094b8efe72806",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_mul_multi", 21);
+	shake_flip(&rng);
 
-	"87f1eb67b2f70780ff554843c8bd2980540cf15ed1d23499d013359759ef5927",
-	"017536300dc562e33776b4ae9ee43a5e120667e292852e3aa978ab34fcc7820d",
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		do255e_point Q, T, U;
+		size_t u, num;
 
-	"41bc5a124a6e723eb004fb536a17dd1a577816bd83143f2397703f794ba3e130",
-	"24d5334513be93d7eeac84f5694e9c20659107c17fe2055280e09d4c8819387a",
+		num = nums[i];
+		for (u = 0; u < num; u ++) {
+			uint8_t tmp[32];
 
-	"02c20375cc557dcb57eb02dc25f7f2390926071c3f4223cc321ba4cd0aec6502",
-	"18dd6b94a95c55d29204751031bb915b6c6adc8878aecc305757b51e81dd983a",
+			shake_extract(&rng, tmp, 32);
+			do255e_mulgen(&P[u], tmp);
+			shake_extract(&rng, k[u], 32);
+		}
 
-	"493b59ef92575b18a6ad3ee1dbf2114c4aaa2571ae69543fa6a7a837532d0632",
-	"f65a28c4afba44303bd8f1325c61d456e2e1f32b1525d0ccafa43dc36d204a27",
+		/*
+		 * Include some corner cases: a neutral point, a zero
+		 * scalar, a scalar equal to 2^256-1, and twice the same
+		 * point.
+		 */
+		if (num >= 4) {
+			P[0] = do255e_neutral;
+			memset(k[1], 0, 32);
+			memset(k[2], 0xFF, 32);
+			P[3] = P[num - 1];
+		}
 
-	"a662b8f9275568027b9bd157b6708b73ba8ca34a127e1c9f5d71d9ecb3afd423",
-	"1cbe4b02bb3acbbc20764101c452061591b80d52eb89301424332c8a39ba9314",
+		T = do255e_neutral;
+		for (u = 0; u < num; u ++) {
+			do255e_mul(&U, &P[u], k[u]);
+			do255e_add(&T, &T, &U);
+		}
+		do255e_mul_multi(&Q, P, k, num);
+		if (!do255e_eq(&Q, &T)) {
+			fprintf(stderr, "mul_multi failed (num = %u)\n",
+				(unsigned)num);
+			exit(EXIT_FAILURE);
+		}
 
-	"288f7a3125bd12be279cb827b897c255267f97e4f7913713a80cb2630b646935",
-	"59300e36d3d7d5a435c79b8dad6a974bffbeb3c9bc3ed54270e612dc10972451",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"200f6e952677c538c9d831e3aeca6fc257a5b711d99cda07ff14042c4d8b833a",
-	"9c9728c88778a9b6586d6f7049453160467829e16bb5ce4a7f63fac47e6f7f1f",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"a56bc5fdf870fa3b77b648eb5ed73a6f0173659eededed0b7e6f6ebb886d392d",
-	"26c4a638f7591e1a405a205594ce888992e24fbf5d9d8e14ea485d99c1908028",
+static void
+test_do255s_mul_multi(void)
+{
+	static const size_t nums[] = { 0, 1, 2, 3, 4, 5, 8, 9, 13, 17 };
+	do255s_point P[17];
+	uint8_t k[17][32];
+	shake_context rng;
+	size_t i;
 
-	"47a53550f794a851c0dd80a0901cccbe981e40b1c4d1d69210f9f802e85fda1f",
-	"289d5098634f96fe4e8ee706c580937946706db1b231458d4929cab8a482bf0a",
+	printf("Test do255s mul_multi: ");
+	fflush(stdout);
 
-	"41ae0bf1dd0839c48045d6352642bb3119d92cff32063a1d3985f140fa2cfb2f",
-	"c0a812552fc0516a4a3f131ed076fc95b4d98267683aeeed8d93655211cd5246",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_mul_multi", 21);
+	shake_flip(&rng);
 
-	"4cf1f2bc5c4181cd0665fdae60d6e144a97e77a291188897de766170d6131503",
-	"277d8ee6a02bfbfc276889c11ed2f5421713d7e61dd5e4dcd7bd080cbabc046e",
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		do255s_point Q, T, U;
+		size_t u, num;
 
-	"aabb07488ff9edd05d6a603b7791b60a16d45093608f1badc0c9cc9a9154f215",
-	"da6a979fc42038aa88d27daf4df743322c4ab176c33ef1b310f5cd69f7f83b3c",
+		num = nums[i];
+		for (u = 0; u < num; u ++) {
+			uint8_t tmp[32];
 
-	"8d3e0b22c9824647109c1000aef645d43d83b327ef8d86caab540ef295edb33e",
-	"2b2c16261d10532a98d7f88d68d5984b47e787842f158c9b46878c1a64e0bb55",
+			shake_extract(&rng, tmp, 32);
+			do255s_mulgen(&P[u], tmp);
+			shake_extract(&rng, k[u], 32);
+		}
 
-	"cd82320c3e9d68b16d40a3aefda68027950f0333bd845b66933d0bfabbec842f",
-	"1e11506f4a8caef900bee6d2d9c80488ea8addedb1bfd663784a18a34615af04",
+		/*
+		 * Include some corner cases: a neutral point, a zero
+		 * scalar, a scalar equal to 2^256-1, and twice the same
+		 * point.
+		 */
+		if (num >= 4) {
+			P[0] = do255s_neutral;
+			memset(k[1], 0, 32);
+			memset(k[2], 0xFF, 32);
+			P[3] = P[num - 1];
+		}
 
-	"d3e72a448061f8c22a68661eef211387cd2851ebab1dc1cf4bff878a13686133",
-	"d4bff10c04cfaa62793adb12318c9630361b4ebc62c17a4586585925f5570d27",
+		T = do255s_neutral;
+		for (u = 0; u < num; u ++) {
+			do255s_mul(&U, &P[u], k[u]);
+			do255s_add(&T, &T, &U);
+		}
+		do255s_mul_multi(&Q, P, k, num);
+		if (!do255s_eq(&Q, &T)) {
+			fprintf(stderr, "mul_multi failed (num = %u)\n",
+				(unsigned)num);
+			exit(EXIT_FAILURE);
+		}
 
-	"9ca015753a43f52834bab8182c96edbd895070a9998371ad3bab311da54c9716",
-	"86ebdf40ca5df688a5534bd88066995f67502f1136818c609e1f92fc810d2f03",
+		printf(".");
+		fflush(stdout);
+	}
 
-	NULL
-};
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-/*
- * KAT do255e ECDH.
- * Each group of five value is:
- *   private key
- *   public peer point (valid)
- *   secret from ECDH with valid peer point
- *   public peer point (invalid)
- *   secret from ECDH with invalid peer point
- */
-static const char *const KAT_DO255E_ECDH[] = {
-	"ef28a690f4129956e9309b080a4a9314a70f070bf23a4ac5a5c7ceccd79bf713",
-	"1d80ce62a0a2b3916844eee076f0ede0f58c6b1569076c80d931f482af777023",
-	"1958e2c1e90c16bd1ce032d65389acc03ca40e86d7cb7d2c3da4951d8bc1d053",
-	"c72d892b575ba6bf2120d8d376db16a79c8bd835af80661bdcfd4b5149267907",
-	"fac3236e3b3841f2f08274c58ecd704535a285ebbdd7767e1b45d33261083141",
+static void
+test_do255e_mul_precomp(void)
+{
+	do255e_precomp tab;
+	do255e_point P, Q, T;
+	uint8_t k[32];
+	shake_context rng;
+	int i;
 
-	"c8e5bd9585757ca9e984c08b6d5f04bfeacca23ae70c08d6cf483566460fc22c",
-	"b6544dcc56df2c151507957542bdbdd8cd89f905eeb7f586df21650bd3034928",
-	"c00d4181e7f07693440b531c0c4c0321d11787155cb810955a07d7db6639dc6e",
-	"efa30b7f745011a1c2179bdeb65bf676f6699ed7fac93753483f3a18a7b4e31c",
-	"f8fbf93e12a1340a64e3540c9fd6868f9425c32e4d2dd8e05ed0befd643af586",
+	printf("Test do255e mul_precomp: ");
+	fflush(stdout);
 
-	"d65c50065aa45d6184712e758c95e7d73dca997dc5b670354e9be636bd31181a",
-	"31bffbc837e9295be72eb55281c82a258663503b1846e8e65d492c6f78d33718",
-	"4b220af3c0b0c53051fe3f392b7a750ca37bb193dbd8122922f8480cd10de520",
-	"53b0e353877607a0c33d544da0cca0248fa932e9460e42734a25cfc404bd5364",
-	"398c5dab9da224b7064be994198ad14b4b231fce7432fa92e301d9ceafa8ffd6",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_mul_precomp", 19);
+	shake_flip(&rng);
 
-	"52fc76c0f047480bfa05b3a5da31ab2c28828cb6b7465209b2635a9fd567b23e",
-	"f6a806c9c087fd2b8af290f83446870447cdb1f9e702f8117da313ef96d97605",
-	"76e190d84232eefcaf6140296b710c22d725176008f3aa7aadde7c54325bdc26",
-	"8dde1bbcfc6a2be8665d07e992c387277638b86aab3f96cd7be78f6eb22da12e",
-	"612d7131f7b769f918544cf187b95b30fb25366d4a3d03895e906319c171acbb",
+	for (i = 0; i < 20; i ++) {
+		int j;
 
-	"4c0469f97b0245cfead8fbc104ca54d18a917010f50eee1a4fca31e6d0b44d11",
-	"f4254ce377b6bfb57b6b78202d5cec1deb66b00ad7441c691ea5166156de7c7d",
-	"7696af08c6d643d1e1473016a61d50edcdfa7d43cca6d8968a7b00b3a8f2e1ff",
-	"d168edbebd43705c4d03cb3368d0e25aa333553da0637cf5ed7e6f74e6f23c0c",
-	"b0dc53f8f55edd519f4106704e29c676df46f67d48039aa31debb30f0911a464",
+		/*
+		 * Iteration 0 uses the neutral, iteration 1 the
+		 * generator; other iterations use random points.
+		 */
+		shake_extract(&rng, k, 32);
+		switch (i) {
+		case 0:
+			P = do255e_neutral;
+			break;
+		case 1:
+			P = do255e_generator;
+			break;
+		default:
+			do255e_mulgen(&P, k);
+			break;
+		}
+		do255e_precomp_init(&tab, &P);
+
+		for (j = 0; j < 5; j ++) {
+			shake_extract(&rng, k, 32);
+			switch (j) {
+			case 1:
+				memset(k, 0, 32);
+				break;
+			case 2:
+				memset(k, 0xFF, 32);
+				break;
+			}
+			do255e_mul_precomp(&Q, &tab, k);
+			do255e_mul(&T, &P, k);
+			if (!do255e_eq(&Q, &T)) {
+				fprintf(stderr, "mul_precomp failed"
+					" (i = %d, j = %d)\n", i, j);
+				exit(EXIT_FAILURE);
+			}
+		}
 
-	"61f3fa5e5c6aaa53815d2f4458bb55f9dc78dfa0b871bb507551538b7b7aa907",
-	"80772b696144793e55dc706a007aff79c4df1718aafa8bc224ccb993a27d2a7a",
-	"3a2d8c445b2c3905ab81524718801adb0a762e7c17a259427b367ddf92c3d4a0",
-	"de029424e3c3f4fed8e42b36865a645895e2430373dfc5c309f55a130954a42a",
-	"a6b8713d608f63f8afea100db16949071e5e257c4dbfa3ce9327285d12f2204d",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"9754017a70bd45fbda023f0a315502d394a424e3191368228a6f2e8b62e15818",
-	"8533475f7404f1fc9cb904c61768035293e3787308da15a601aaee3b60f8034e",
-	"f260f1faba57ee8a8bac32a0595696eea9b9ab683c145f9274213d0717d4c108",
-	"4f19f142b0fbd94563629227cd36f047ea7edbf973d540e778227966257c142b",
-	"47560853d57536c2f910d26536d53e2a594432d02994c4a5ee4080273c0e7b21",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"12604b60bb1bada85a247f47cbbf2a14647ab8828110353fee8180c7feb0f708",
-	"222aaa94d01a6bbeca96eaa5af11b6e350e04a5590c7b2536606d6c363b4f41e",
-	"77f5b1a5f608f96d952439feef5ee7547453e29f04499b123d3944d3e48439e1",
-	"b79607b0cbeb197c8705e2999f255af712ebc583ce819f2bf0e40008f20eb23f",
-	"32fe19e0ee4589f3d9fe0212c9a2ab3b8f61d1067867fb9cfb6b3caf457e12bf",
+static void
+test_do255s_mul_precomp(void)
+{
+	do255s_precomp tab;
+	do255s_point P, Q, T;
+	uint8_t k[32];
+	shake_context rng;
+	int i;
 
-	"3cfd86fc7dbf092f33a0a3c92022684216c6d10576cd7b3f7f64dbf5d85a6726",
-	"d4c1d69dd7868fc85a37716ef5621b6787a274180f27c9d6e7e3c08908b8d069",
-	"274ca75b281d5fb6f3304fe716123dacf7222d7b9efe6453ac50e83ac145e9e0",
-	"c6511b4cfbe214659a02642c1c0e7893ef73802b21ef39d10a0710c674a79e5d",
-	"23f57d371414d13ff1a516fae7a9db71ea1633efd42c69d7a27f62c997b79803",
+	printf("Test do255s mul_precomp: ");
+	fflush(stdout);
 
-	"1db9a064623f90f985e3f66cf8ff46bfffdb64e2fb73c8dc31d62acd362df419",
-	"d6ba5e02dff611438c8a82d01790f257dfa7dc0c576e8ddd27cb1e9075eae008",
-	"d89bdfe6b78549e7abe8e94819ae2eb817cd57d3cf340a3ae962baf777745a66",
-	"bb733ca5f060f156bc08ba9865adf28febc683f14146d91259327750bb49af62",
-	"788ecb175be5a165bfef25a6fd296a059ccc432c354e55afbd92a261605c773a",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_mul_precomp", 19);
+	shake_flip(&rng);
 
-	"ca00d92e95336b0bff5db5cc624e6c58b0e259a8ec1b0f3e3df6b92b22751214",
-	"cdc2f220bb4d0ee2839cda1cb2bd4ff3f8f3c0144e5bce7b040a543285016442",
-	"5e6755dd5e3282729ab5255a9f244fb1716ee5f5ed86c3b0c65998fa36d6b770",
-	"9ff0fc35d268faec8ac0facd3c8c07d35ed8e4015cc7a492e7035b1396d7d94b",
-	"38eb314008e1514309fdd940880dbf14bab3dc6b45e6ee6ef72d5eea9cf1e288",
+	for (i = 0; i < 20; i ++) {
+		int j;
 
-	"b56284ea283943c82b3326e7df3a7743b4cb5ffc8015465f3e5dfa14d1aa0627",
-	"56ff5c7c341845844bac18776aad2eb36e76a2e740800ee5f9fa3e2189acd91c",
-	"b9e5f0b180d56f6a92db793e0a3830cd9ea39f8cf8269f5c644ed47b22d61a3c",
-	"d6f8a731ffd43a2da991fbf88b32cd7beeb77243d8e1d72dd966a17b21e5d657",
-	"0620573ba4423ca1e6466d1dff02cccfd2895b89ff26a7426a1c903cb9970ae9",
+		/*
+		 * Iteration 0 uses the neutral, iteration 1 the
+		 * generator; other iterations use random points.
+		 */
+		shake_extract(&rng, k, 32);
+		switch (i) {
+		case 0:
+			P = do255s_neutral;
+			break;
+		case 1:
+			P = do255s_generator;
+			break;
+		default:
+			do255s_mulgen(&P, k);
+			break;
+		}
+		do255s_precomp_init(&tab, &P);
+
+		for (j = 0; j < 5; j ++) {
+			shake_extract(&rng, k, 32);
+			switch (j) {
+			case 1:
+				memset(k, 0, 32);
+				break;
+			case 2:
+				memset(k, 0xFF, 32);
+				break;
+			}
+			do255s_mul_precomp(&Q, &tab, k);
+			do255s_mul(&T, &P, k);
+			if (!do255s_eq(&Q, &T)) {
+				fprintf(stderr, "mul_precomp failed"
+					" (i = %d, j = %d)\n", i, j);
+				exit(EXIT_FAILURE);
+			}
+		}
 
-	"ea394e65ffed2af6f374ee698cbed8fc13aab0af934a1b67b15ed7c6caf1a721",
-	"e80856ed01be82403a378cf21f91eab1de8dea8b9fc2ed7da8916d2166add716",
-	"3e98515fe823f348975cb5d3b58679d68efa0a3c063e5909b97b0ba4abdcf496",
-	"373520a86245d80d6807cb1af60b912f1a4d3e277c7c05d60276484f76353c2d",
-	"889ce022eebfd41a508e4acf21346698f35bfba35d5d284e00467d6610e586dc",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"395446b0114c7c2f5fdf9c84b445738b4b6af5b421610a6234f151f58999aa16",
-	"efb29c8aaa0701a1c71ec9077571bb6d97a21c8dbb580714d655c3aa50943b72",
-	"5473acad9ee583c23912093e553db4a31b45a539333825bb81b878d6844b5a56",
-	"0b49ed1ee6809c76e3b342fd54ee375e1a54cf297d179d590dc6927ce31f5c67",
-	"caceca76026bd4f8553b261b2eb7e40f96785de03df5b3a263b152d7894b590d",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"093b4502c12f43f1d68888211a083efc7e551146f7385fe0e0203c3a87b6f902",
-	"2204f8dee58e75732662dc0fd8ae5c9aacd9c288e8520431ff34bfd229a0b856",
-	"681eab3e0f73552bbcffe9e8acb22b8446e65447818be1c022a0e9d7f719e16b",
-	"2461e08ebafc979aca3af695553fb1f510bc96bbcca1c409226ee642a301c112",
-	"065e2afb921b257909e17cf7a9df7ab803a491d80315688aa94ef3b2d8e9fbaf",
+static void
+test_do255e_mul_x4(void)
+{
+	do255e_point P[4], Q[4], T;
+	uint8_t k[4][32];
+	shake_context rng;
+	int i;
 
-	"296e9c430cf963e46fc2de1e48709a9f535e7e54184741598689b082f2fb712f",
-	"e09b38d065ee00bebed7613ebc77392b54d72c1c59ac13975561bf00ae62be5c",
-	"812047baacb81e4840bdf7c5fec3c0107fb2879eba441fda416736258e95d2bb",
-	"42548ab4526e5176aff6631263881f57144329b132622b2ed0ecc49d1491f36f",
-	"51d7cc6309ce07eeb509bef43a290364f2a285c0e8b99792a8711c40211c5a77",
+	printf("Test do255e mul_x4: ");
+	fflush(stdout);
 
-	"d550a88023a96a010b7f0b7a93be2fa67bdb72cc2ef8a1addd9c27d1464fd211",
-	"ab4e38805ce3870142e9327fb63fa51ea3ed9110f028bb225f4806fe34e3b165",
-	"47a4065fbd3beb39477675449febeb0833736dd0585957019446b6b6f4d38003",
-	"ffbf316c28bc263ea9e7ec7f19ab66ffdac6e751f4b9d5b59173c953c2f06f3d",
-	"b89d3a6a00953f1586e1176254adc1dd098070b8e05eb54e3ccfcf9cfa17c2d9",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_mul_x4", 18);
+	shake_flip(&rng);
 
-	"738b0034bcb054c33bde8b804a14c55e9035bd917cf09085133788835cbbb326",
-	"d1c9fc36def70c49c4388050dbf568319a873bd86a5e17697064999015ef6e21",
-	"28ae15ca72336e4fcd1bd5ad809abd7d4a7fa7c6a94356df2a199308a0c59746",
-	"6c299b2954771e58e67cb03585e481c00a5a76bad24dcd34cfe988df8361d675",
-	"4299fb5f1f0e1b9f3b02b0ae44eeb9e62275210257bbef944cb2aad78973236c",
+	for (i = 0; i < 20; i ++) {
+		int u;
 
-	"303b84fec8756acdfc55d108800ed5c78795a79bfc718fc47cee55b1b2d1741d",
-	"92a8956299d060f6bb3a1ae456d4e27a16054130460efefe3827a624a83e9a05",
-	"3d7d64b38c30375ccc7b7252b432766e84b738e6ee40b48d722a94c47d85c246",
-	"b3587506e4711f45e1f9de2355e1dd4ca403d892907ca3505ac842049556dc2e",
-	"09ec0b7c6fb336f28d8b983dcfce94d0043e8090f1b74660c0b657a873d694b9",
+		for (u = 0; u < 4; u ++) {
+			uint8_t tmp[32];
 
-	"95c863ec9ebdf963536500f4610964b96941d25e47f3098f5c6fd82704836703",
-	"8129d1f4e3d8e63bcca497ba0fa234b6d915fb052dd6d75f7febaa1b0f31e80b",
-	"64af14c411a4b660b3572382496a1b762fe5db9f049614aecfb80325d4ab0405",
-	"2cb6327b08618354aaef4ed354c90875569277ee6ef8cc5e3eeae8e2091e1f22",
-	"b8366704521d00c86b2cceab783b73135ab1bd80aa568aebfd3f24f073d80a75",
+			shake_extract(&rng, tmp, 32);
+			do255e_mulgen(&P[u], tmp);
+			shake_extract(&rng, k[u], 32);
+		}
 
-	NULL
-};
+		/*
+		 * Some iterations exercise corner cases in a single
+		 * lane: neutral point, zero scalar, scalar equal to
+		 * 2^256-1, and the same point in all lanes.
+		 */
+		switch (i) {
+		case 1:
+			P[i & 3] = do255e_neutral;
+			break;
+		case 2:
+			memset(k[i & 3], 0, 32);
+			break;
+		case 3:
+			memset(k[i & 3], 0xFF, 32);
+			break;
+		case 4:
+			P[1] = P[2] = P[3] = P[0];
+			break;
+		case 5:
+			P[0] = P[1] = P[2] = P[3] = do255e_neutral;
+			break;
+		}
 
-/*
- * KAT do255e signature.
- * Each group of five value is:
- *   private key
- *   public key
- *   seed (can be empty!)
- *   data (SHA3-256 of "sample X" with X = 0, 1,...)
- *   signature
- */
-static const char *const KAT_DO255E_SIGN[] = {
-	"e7fefa881bd07b1c363b68a0f9e01ee04439f4aec941f402ae7be67993bcdf36",
-	"4b383536c514fdd88fadd4699bb00f57cb16af174d086e65a291cb35957ee25f",
-	"",
-	"9eb7ccdd65cfb6e02f99210264c6424c911ab8890fcd93f064399d747b503ecf",
-	"02df67f802428c4842a9337006f99bbe366e9d45330ebe59775fe233e24a1b471b450b81d63c76dfbf24b65dad69dcf19471a49346ae4e4239bc7846246bad29",
+		/*
+		 * mulgen_x4 is checked against mulgen, and mul_x4
+		 * against mul. mul_x4 is computed in place on odd
+		 * iterations.
+		 */
+		do255e_mulgen_x4(Q, k);
+		for (u = 0; u < 4; u ++) {
+			do255e_mulgen(&T, k[u]);
+			if (!do255e_eq(&Q[u], &T)) {
+				fprintf(stderr, "mulgen_x4 failed"
+					" (i = %d, lane %d)\n", i, u);
+				exit(EXIT_FAILURE);
+			}
+		}
+		if ((i & 1) != 0) {
+			memcpy(Q, P, sizeof P);
+			do255e_mul_x4(Q, Q, k);
+		} else {
+			do255e_mul_x4(Q, P, k);
+		}
+		for (u = 0; u < 4; u ++) {
+			do255e_mul(&T, &P[u], k[u]);
+			if (!do255e_eq(&Q[u], &T)) {
+				fprintf(stderr, "mul_x4 failed"
+					" (i = %d, lane %d)\n", i, u);
+				exit(EXIT_FAILURE);
+			}
+		}
 
-	"dd97542958b1929860ce00bbf16e70b96f585bdb40fe1c689c45089a25d2a33a",
-	"2b2eaafa51faff7bb254388efe931a45efcccc9a18e0d2f22009ffac4a67dd33",
-	"f6",
-	"45515ea2aec5e64eab4ca100c26b030447c07b66a9fb6f532cba12e1f62ae627",
-	"88bee51daef88d0122eefed288068e481d8600845232426c78833a2d3e2fb80d0d78997bedc3040667e65e37b6a73358a6b8be292c906dc924c0d87a1cf47c0c",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"d621461ed0119fef78d82658d56db9a81e9de2a7dba43213941b150146cdd023",
-	"82f078e1d7d4c27b87b44e94a5d65d10defa34b6c6187cdf27b6ba1cd0c8a416",
-	"54e0",
-	"61954339a2d5ff28e0d496af0716d757891010625c8859cf2ffde8fc75f3e74d",
-	"aa362ed028a877b0e66c24ddfe04adff7168cafb6916e425f5997fe209de2e397eeed6838c1b2f37770612c2d816d1ee4b6dd72859131b92322ed6539403d035",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"f1d2e620bdc765a7cca0da13c0181b15974d5ee3de8b66da9824b47706e8a90d",
-	"245f4b6febec6d65a18dc721b92234b60f8cdd5cd6ec4bf379e2dbf1c4b3b960",
-	"e2a81f",
-	"e1bc41167127f1944e47d6c3e9775ea31919040ede6f1843baf1a039a363467e",
-	"baa56a21d8d424da430e4b559faf3ce3d5c4a3500059ae91bd77b9c731b2a31657ca7fc36839b77045bedc022d17ebce315228dd7706225d3240cced47b0f21b",
+static void
+test_do255s_mul_x4(void)
+{
+	do255s_point P[4], Q[4], T;
+	uint8_t k[4][32];
+	shake_context rng;
+	int i;
 
-	"7bf1ed60ed68b9ab68cd108f59ccf8c5244b3c67196ed682cdbdba199f2da826",
-	"8d19cf9e1a466c45b25783295a5d7faa9c87aeebb66c3587b0a545c434c50062",
-	"24e5f829",
-	"68b268348810d58120705fe0ac3faaa11218c81f6560541891772c58305d3f6e",
-	"f9dea4b04fdd1abcf5f363ac3baf8f9893c725ec7267257c7148fe6d9add5226d2ae40338d9b16826ce237b73f102271a5d3fc4c4d99b59824e4f90366ec1a38",
+	printf("Test do255s mul_x4: ");
+	fflush(stdout);
 
-	"6a2c113c429adda15575b0df0e25423dcff7d999119e0259939fe13528976128",
-	"242cc70b5bd1710e449864474cace3934da479971a462292ddfc86017533996c",
-	"1d657c0787",
-	"91cc12bdabea62f2fad09995b2177f3d01011d2b52fa51219d961e8801cf9b84",
-	"afbf38a01391aabc062969fc90ae24844a05040804c254ab59c9e9ee4f27603a8702bfe8730c538ab1436e63b54dc73e1ea4826093a413b1940fd224de617507",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_mul_x4", 18);
+	shake_flip(&rng);
 
-	"fdcb0a1f06aa24e5dfc01cd078e70509867d604275a1ac888cfccf45f4b4043e",
-	"e84854f98bbed4bfc5cbb341ea31d74087818fb522828f0bc02300a9a3d84009",
-	"5095bc20dffd",
-	"0e298aef020cdd9cb9382d54f950d975b35f7807324d064c968cfb973f4d88a9",
-	"5faef8cbc141c974bcb72a2174025730ba2cad3425e94302ab846c9b65ce935a6e8dfee1acfad9839506d6bbe7efc38b55e9bd8da0c591e9b206caaf4759f028",
+	for (i = 0; i < 20; i ++) {
+		int u;
 
-	"e6f1ae77baf9b052eae31cae22ee3733fb976840f4b6ae4ad08188f00299f524",
-	"2001c1321ef199a346ed03e826d93ea8d625a7aeb2e068abca08039409cd8c3b",
-	"318a89d0101549",
-	"bd6fa43ba1f3558c945ad97b86a16e46f18689d631832f36655808e0ae9625c4",
-	"938102026e490a693d99f80c4385920006e6fb02a6fc751c3674fd739531e312aebf70726ee8454381d003310e7b3ea6010916283f7a54bf3ea8546558523709",
+		for (u = 0; u < 4; u ++) {
+			uint8_t tmp[32];
 
-	"155e454cb96e895531ade93353db7b117fc99e6c4f5d3a7d66276e7f6230a42f",
-	"1b758dfe2ac44b162db76c8763f0b942eb26dde011e6b69e5efdcbdbda5e9549",
-	"b8000b24b6cad595",
-	"15cad315726640f061a87262b030f8013d698829808ca191d29eab06e000d526",
-	"c42e60dbaf1cc00342561dcbed70cc94bd80d37e261863721793682cab9e3502d94db97e792c2da4b0f3a386b8951b1f86dbda8371c1523dd67ca5c7ab5e101b",
+			shake_extract(&rng, tmp, 32);
+			do255s_mulgen(&P[u], tmp);
+			shake_extract(&rng, k[u], 32);
+		}
 
-	"4f73e0da62d285b6cb935de905cc86c5eb1172ce592b5a3f1b06329381db5e05",
-	"42e38f43a66885ac8d5b55b096e1f2fbdac68c0cd734c95643cbbb1fc00a2e3c",
-	"c37daa05a878983373",
-	"a3a01a7f31c626a828d91a2ba34453fac4864a1c2418f22d135ac28158e12ab3",
-	"75a0ae260f2fa0a64cd558a4adc7d3df092880201435d0181655453d3f6f715a57f9814be5265f9e087d47eef3b6cbe793cea5d090704161c5286df0cbec2e19",
+		/*
+		 * Some iterations exercise corner cases in a single
+		 * lane: neutral point, zero scalar, scalar equal to
+		 * 2^256-1, and the same point in all lanes.
+		 */
+		switch (i) {
+		case 1:
+			P[i & 3] = do255s_neutral;
+			break;
+		case 2:
+			memset(k[i & 3], 0, 32);
+			break;
+		case 3:
+			memset(k[i & 3], 0xFF, 32);
+			break;
+		case 4:
+			P[1] = P[2] = P[3] = P[0];
+			break;
+		case 5:
+			P[0] = P[1] = P[2] = P[3] = do255s_neutral;
+			break;
+		}
 
-	"ca209856bb248fccd018843b0b10e9fe1cb294a9213d78254a86a23ee5a79106",
-	"7f8cb0ca92e9f8d0f1c9630833e6e28cfda0cb97d4728b1d28009abab545c234",
-	"8b2bf5bec449e73da381",
-	"3e2b0342ad12868adf498fc2a3c7bf168d115a3ca37fcb475541ead259f20c9a",
-	"1699138979a0d5900446a16b31d7c3e30d438fbf482a6b026191f1fe11c37a7deb4033c7581705572a48b170d4e8c9ebbd3883f62f5bc5028bbc8b479e93501e",
+		/*
+		 * mulgen_x4 is checked against mulgen, and mul_x4
+		 * against mul. mul_x4 is computed in place on odd
+		 * iterations.
+		 */
+		do255s_mulgen_x4(Q, k);
+		for (u = 0; u < 4; u ++) {
+			do255s_mulgen(&T, k[u]);
+			if (!do255s_eq(&Q[u], &T)) {
+				fprintf(stderr, "mulgen_x4 failed"
+					" (i = %d, lane %d)\n", i, u);
+				exit(EXIT_FAILURE);
+			}
+		}
+		if ((i & 1) != 0) {
+			memcpy(Q, P, sizeof P);
+			do255s_mul_x4(Q, Q, k);
+		} else {
+			do255s_mul_x4(Q, P, k);
+		}
+		for (u = 0; u < 4; u ++) {
+			do255s_mul(&T, &P[u], k[u]);
+			if (!do255s_eq(&Q[u], &T)) {
+				fprintf(stderr, "mul_x4 failed"
+					" (i = %d, lane %d)\n", i, u);
+				exit(EXIT_FAILURE);
+			}
+		}
 
-	"9c5511323d7c143272ad5bbffb91a6af2f2be9a9d7a72643df3a7a790c944724",
-	"6d76fe597859b316bec4f4c6a10403d84b8fd8797106ce8853a15e7a78318129",
-	"4f3f552712d3c7ff7bb212",
-	"8947bdb1b77d2117bc43d4933b89d835c28b0f5e228a2993f53711f0d6067499",
-	"17330ef2c47365191905fa1ad9343b289340d62c44c94de0e1070dfc406fc335f12e800f4dc2600f18c61d9fa5cdb49f9af34a472d61720d346d402d9f2c6314",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"4760c2b72a73b22cae763ce3903369fca15ab3fc3394aca4955e071213313820",
-	"13d8e61e4a811bed22aec12fc4eb5176e05257c9e0ca62a75dedeb31b7d4832d",
-	"867d02c2829dc1a05a553943",
-	"ee4d9fd7516a121d065a71ba92bc70177ed7b12e1f62506d8f79127d790518c7",
-	"a19560523ee01ad590ef3e6415713c3c0e7995cc2507de210e4ac4d20151a961a72c7ff988fe26ef7853780d6c87af552c22f61cfe0d083ce5d15a476484bd31",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"6efd6cf3bc41af751a47a7a568c43fe05538c9bf4a4b56b92c87e384c369f701",
-	"c790dfcf644d53bdb5c067df4a2d61e4d031d0422cdc6eae9e3a79572723a957",
-	"9210040ba76b0d31aabbe1b79a",
-	"1e713421d1a44b6ef1944e973d17764e44f580b91c53b9e11f4a1dc2783b435a",
-	"6af33b5c8943e7e531a8fadb9a2a2da527f1219d6dcf9d56691dcccf505a4401f8e71e6710a5298005174c38e199782c7a26462219ab37fe0fb5919b1d5c8100",
+static void
+test_do255e_msm(void)
+{
+	static const size_t nums[] = { 0, 1, 2, 3, 5, 8, 17, 40, 100, 300 };
+	do255e_point P[300];
+	uint8_t k[300][32];
+	shake_context rng;
+	void *scratch;
+	size_t i, len;
 
-	"9753da22261a95cdb29a35b2a53286ef3e091799fe88b80df7f081a05fbf8321",
-	"cf8b7f0b66aad2ef6c53633c42f621406dd9c24ba97161a2efd451ed1422ae08",
-	"4da18d848fa826de260ddc0c9cf6",
-	"8584de70ef2a343366c334bc11b8d9e837ba63833dbb619127075bdb906ac403",
-	"d9da40776f84ffbbdc0dd6dc765ffa3495e03502b5c628ee5a2f1d3ade7e2003cf43be376783a1fa6bf83644945f8036e08ab8c760fd78a456faa8794f77783a",
+	printf("Test do255e msm: ");
+	fflush(stdout);
 
-	"c87f825b563e86217e6eee2ed660982c7c9239c6cd90d011dc4a46fbba94e914",
-	"bdd7e46cbba76e666be2a551564d449d3b3d10a480550c8a34c40ce696c82612",
-	"338df4d100a8f105c7bc47ae7146cb",
-	"018571598ecb3dc0b96a693a85de4927aba6e64ba6be14ffc9e9ff65896bc3dd",
-	"79b67f4eef3383e68d53c63c76c185d87adec18f034ec476f416a12f5100a9050b059077f179902c0d8756e04e361f80a78b4596610f74d88fff7f7c58ccce0f",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_msm", 15);
+	shake_flip(&rng);
 
-	"d0cd7614980205ffdeb4cf87b81135d04a3975188ad1967b57f1a7b87d212a2a",
-	"e7bedad9a67f17050b95d18978d1966cfc00300f39f4c9a706f7a1505e15ee34",
-	"08495927e9336209338bf36dcf3aaa4e",
-	"c02b87d23b05e56f0f7b96500368a41c23e83c5b0603642e5de35f4cda0d9b89",
-	"d8effddf72c876db57beb1bc82b2e0feccd711bf5cc7384a92f2b9f2a987443744395abd62a55816333654cf1567a65d787da41444f80202d837dbce2c0d3805",
+	len = 0;
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		size_t t;
 
-	"81db954da4ae7a5e0379a974094e64e6e23ff33e610de5e950d865f510adf325",
-	"faf0d180629d98acbc28069304f932729689d72f72d4236b3fbbf189cf81141c",
-	"fb52854932e67673d964ad8faad81bf1f9",
-	"4739c6afd6c5b3f1f58efe807bb068940bdc6725057661660442af88f9050aa8",
-	"6f2e0c0859922f76013ddd0830201723fb99cc58152edb121251e2a9c91c2b312bad2e2bbbe79ebb35b4b060843535b96cbe8a031a6eca6035e86706bebd1a16",
+		t = do255e_msm_scratch_size(nums[i]);
+		if (t > len) {
+			len = t;
+		}
+	}
+	scratch = malloc(len + 7);
+	if (scratch == NULL) {
+		fprintf(stderr, "memory allocation failed\n");
+		exit(EXIT_FAILURE);
+	}
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		do255e_point Q, T, U;
+		size_t u, num;
 
-	"7f3365a6ac0fb684333b7d709b121369cd9a5cc6c191ee1df8cb40bda2635220",
-	"9e07d0e40289c1c708f4d3f0bb3ee2fddafee94cf5bf3a441412edbc4a1e1c44",
-	"da1eebfdebeb0b6e5c8999e3fbefd29d622a",
-	"f8ec137d474d2fa4eebdd1f4acaa713743f0315f9480affad04af23ff7e4af4d",
-	"cff66066d447a4d876590cfb0b02d1b553a7d942e6bbd65de3fdecf7ba6f2204861a5f4b112fc48cd0ff2f10ac987fbc2e2361c68da48f2cb3d4a05ec380561f",
+		num = nums[i];
+		for (u = 0; u < num; u ++) {
+			uint8_t tmp[32];
 
-	"3ea73a6a9e94de49026fa6c9385aed5a95b31643c0bc436e71ec15b55c7a6036",
-	"78f4da98c85c33699114e047fcbb6d3cac9012bafe039e562356b1cae58bb53c",
-	"e6efaa60b93f0c579dd6bd2f7bc6a60e4e9baa",
-	"9403502de9faadba9fca6c0737f0f93058bcde07c7c0165714ace3084fb44086",
-	"8dcb51309953408d891bd3a402dfb0dfced54130aabe5b490ad41614106d4c4aad6adb92ccc83a0fa95bdafd6084cf58b3d327525a80ca041a39e47bec759d01",
+			shake_extract(&rng, tmp, 32);
+			do255e_mulgen(&P[u], tmp);
+			shake_extract(&rng, k[u], 32);
+		}
 
-	NULL
-};
+		/*
+		 * Include some corner cases: a neutral point, a zero
+		 * scalar, and twice the same point.
+		 */
+		if (num >= 3) {
+			P[0] = do255e_neutral;
+			memset(k[1], 0, 32);
+			P[2] = P[num - 1];
+		}
+
+		T = do255e_neutral;
+		for (u = 0; u < num; u ++) {
+			do255e_mul(&U, &P[u], k[u]);
+			do255e_add(&T, &T, &U);
+		}
+		/* Use a misaligned scratch buffer. */
+		do255e_msm_vartime(&Q, P, k, num,
+			(unsigned char *)scratch + (i & 7));
+		if (!do255e_eq(&Q, &T)) {
+			fprintf(stderr, "msm failed (num = %u)\n",
+				(unsigned)num);
+			exit(EXIT_FAILURE);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+	free(scratch);
+
+	printf(" done.\n");
+	fflush(stdout);
+}
 
 static void
-test_do255e_keygen(void)
+test_do255s_msm(void)
 {
-	const char *const *s;
-	int i;
+	static const size_t nums[] = { 0, 1, 2, 3, 5, 8, 17, 40, 100, 300 };
+	do255s_point P[300];
+	uint8_t k[300][32];
+	shake_context rng;
+	void *scratch;
+	size_t i, len;
 
-	printf("Test do255e keygen: ");
+	printf("Test do255s msm: ");
 	fflush(stdout);
 
-	for (s = KAT_DO255E_KEYGEN, i = 0; *s != NULL; i ++) {
-		do255e_private_key sk, ref_sk;
-		do255e_public_key pk, ref_pk;
-		shake_context sc;
-		uint8_t x;
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_msm", 15);
+	shake_flip(&rng);
 
-		HEXTOBIN(ref_sk.b, *s ++);
-		HEXTOBIN(ref_pk.b, *s ++);
-		x = (uint8_t)i;
-		shake_init(&sc, 256);
-		shake_inject(&sc, &x, 1);
-		shake_flip(&sc);
-		do255e_keygen(&sc, &sk, NULL);
-		check_equals(sk.b, ref_sk.b, 32, "KAT keygen sk 1");
-		memset(sk.b, 0, sizeof sk.b);
-		shake_init(&sc, 256);
-		shake_inject(&sc, &x, 1);
-		shake_flip(&sc);
-		do255e_keygen(&sc, &sk, &pk);
-		check_equals(sk.b, ref_sk.b, 32, "KAT keygen sk 2");
-		check_equals(pk.b, ref_pk.b, 32, "KAT keygen pk 1");
-		memset(pk.b, 32, sizeof pk.b);
-		do255e_make_public(&pk, &sk);
-		check_equals(pk.b, ref_pk.b, 32, "KAT keygen pk 2");
+	len = 0;
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		size_t t;
+
+		t = do255s_msm_scratch_size(nums[i]);
+		if (t > len) {
+			len = t;
+		}
+	}
+	scratch = malloc(len + 7);
+	if (scratch == NULL) {
+		fprintf(stderr, "memory allocation failed\n");
+		exit(EXIT_FAILURE);
+	}
+	for (i = 0; i < (sizeof nums) / sizeof nums[0]; i ++) {
+		do255s_point Q, T, U;
+		size_t u, num;
+
+		num = nums[i];
+		for (u = 0; u < num; u ++) {
+			uint8_t tmp[32];
+
+			shake_extract(&rng, tmp, 32);
+			do255s_mulgen(&P[u], tmp);
+			shake_extract(&rng, k[u], 32);
+		}
+
+		/*
+		 * Include some corner cases: a neutral point, a zero
+		 * scalar, and twice the same point.
+		 */
+		if (num >= 3) {
+			P[0] = do255s_neutral;
+			memset(k[1], 0, 32);
+			P[2] = P[num - 1];
+		}
+
+		T = do255s_neutral;
+		for (u = 0; u < num; u ++) {
+			do255s_mul(&U, &P[u], k[u]);
+			do255s_add(&T, &T, &U);
+		}
+		/* Use a misaligned scratch buffer. */
+		do255s_msm_vartime(&Q, P, k, num,
+			(unsigned char *)scratch + (i & 7));
+		if (!do255s_eq(&Q, &T)) {
+			fprintf(stderr, "msm failed (num = %u)\n",
+				(unsigned)num);
+			exit(EXIT_FAILURE);
+		}
 
 		printf(".");
 		fflush(stdout);
 	}
+	free(scratch);
+
 	printf(" done.\n");
 	fflush(stdout);
 }
 
 static void
-test_do255e_ecdh(void)
+test_do255e_sign_ctx(void)
 {
-	const char *const *s;
+	static uint8_t msg[100000];
+	do255e_private_key sk;
+	do255e_public_key pk;
+	shake_context rng;
+	int i;
 
-	printf("Test do255e ECDH: ");
+	printf("Test do255e sign_ctx: ");
 	fflush(stdout);
 
-	s = KAT_DO255E_ECDH;
-	while (*s != NULL) {
-		do255e_private_key sk;
-		do255e_public_key pk1, pk2, pk_self;
-		uint8_t sec1[32], sec2[32], tmp[32];
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_sign_ctx", 20);
+	shake_flip(&rng);
+	do255e_keygen(&rng, &sk, &pk);
+	shake_extract(&rng, msg, sizeof msg);
 
-		HEXTOBIN(sk.b, *s ++);
-		HEXTOBIN(pk1.b, *s ++);
-		HEXTOBIN(sec1, *s ++);
-		HEXTOBIN(pk2.b, *s ++);
-		HEXTOBIN(sec2, *s ++);
-		do255e_make_public(&pk_self, &sk);
-		if (!do255e_key_exchange(tmp, 32, &sk, &pk_self, &pk1)) {
-			fprintf(stderr, "ECDH failed\n");
+	for (i = 0; i < 10; i ++) {
+		do255e_sign_context sc;
+		do255e_verify_context vc;
+		do255e_signature sig, sig_ref;
+		kt128_context kc;
+		uint8_t hv[32], seed[8];
+		size_t len, off, clen;
+
+		/*
+		 * The streaming signature must be equal to the signature
+		 * of the KT128 hash of the message, whatever the chunking
+		 * of the message.
+		 */
+		len = (size_t)i * 10001;
+		shake_extract(&rng, seed, sizeof seed);
+		kt128_init(&kc);
+		kt128_inject(&kc, msg, len);
+		kt128_flip(&kc, NULL, 0);
+		kt128_extract(&kc, hv, sizeof hv);
+		do255e_sign(&sig_ref, &sk, &pk, DO255_OID_KT128,
+			hv, sizeof hv, seed, sizeof seed);
+		do255e_sign_ctx_init(&sc);
+		for (off = 0; off < len; off += clen) {
+			uint8_t tmp[2];
+
+			shake_extract(&rng, tmp, 2);
+			clen = (size_t)tmp[0] | ((size_t)tmp[1] << 8);
+			if (clen > len - off) {
+				clen = len - off;
+			}
+			do255e_sign_ctx_update(&sc, msg + off, clen);
+		}
+		do255e_sign_ctx_final(&sig, &sc, &sk, &pk, seed, sizeof seed);
+		check_equals(sig.b, sig_ref.b, 64, "sign_ctx");
+
+		do255e_verify_ctx_init(&vc);
+		do255e_verify_ctx_update(&vc, msg, len);
+		if (!do255e_verify_ctx_final_vartime(&vc, &sig, &pk)) {
+			fprintf(stderr, "verify_ctx 1\n");
 			exit(EXIT_FAILURE);
 		}
-		check_equals(tmp, sec1, 32, "KAT ECDH 1");
-		if (do255e_key_exchange(tmp, 32, &sk, &pk_self, &pk2)) {
-			fprintf(stderr, "ECDH should have failed\n");
+		do255e_verify_ctx_init(&vc);
+		do255e_verify_ctx_update(&vc, msg, len);
+		do255e_verify_ctx_update(&vc, "", 1);
+		if (do255e_verify_ctx_final_vartime(&vc, &sig, &pk)) {
+			fprintf(stderr, "verify_ctx 2\n");
 			exit(EXIT_FAILURE);
 		}
-		check_equals(tmp, sec2, 32, "KAT ECDH 2");
 
 		printf(".");
 		fflush(stdout);
 	}
+
 	printf(" done.\n");
 	fflush(stdout);
 }
 
 static void
-test_do255e_sign(void)
+test_do255s_sign_ctx(void)
 {
-	const char *const *s;
+	static uint8_t msg[100000];
+	do255s_private_key sk;
+	do255s_public_key pk;
+	shake_context rng;
+	int i;
 
-	printf("Test do255e sign: ");
+	printf("Test do255s sign_ctx: ");
 	fflush(stdout);
 
-	s = KAT_DO255E_SIGN;
-	while (*s != NULL) {
-		do255e_private_key sk;
-		do255e_public_key pk, pk_ref;
-		do255e_signature sig, sig_ref;
-		uint8_t seed[32], data[32];
-		size_t seed_len;
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_sign_ctx", 20);
+	shake_flip(&rng);
+	do255s_keygen(&rng, &sk, &pk);
+	shake_extract(&rng, msg, sizeof msg);
 
-		HEXTOBIN(sk.b, *s ++);
-		HEXTOBIN(pk_ref.b, *s ++);
-		seed_len = hextobin(seed, sizeof seed, *s ++);
-		HEXTOBIN(data, *s ++);
-		HEXTOBIN(sig_ref.b, *s ++);
-		do255e_make_public(&pk, &sk);
-		check_equals(pk.b, pk_ref.b, 32, "KAT sign pk");
-		do255e_sign(&sig, &sk, &pk, DO255_OID_SHA3_256,
-			data, 32, seed, seed_len);
-		check_equals(sig.b, sig_ref.b, 64, "KAT sign sig");
-		if (!do255e_verify_vartime(&sig, &pk,
-			DO255_OID_SHA3_256, data, 32))
-		{
-			fprintf(stderr, "KAT sign verify 1");
+	for (i = 0; i < 10; i ++) {
+		do255s_sign_context sc;
+		do255s_verify_context vc;
+		do255s_signature sig, sig_ref;
+		kt128_context kc;
+		uint8_t hv[32], seed[8];
+		size_t len, off, clen;
+
+		/*
+		 * The streaming signature must be equal to the signature
+		 * of the KT128 hash of the message, whatever the chunking
+		 * of the message.
+		 */
+		len = (size_t)i * 10001;
+		shake_extract(&rng, seed, sizeof seed);
+		kt128_init(&kc);
+		kt128_inject(&kc, msg, len);
+		kt128_flip(&kc, NULL, 0);
+		kt128_extract(&kc, hv, sizeof hv);
+		do255s_sign(&sig_ref, &sk, &pk, DO255_OID_KT128,
+			hv, sizeof hv, seed, sizeof seed);
+		do255s_sign_ctx_init(&sc);
+		for (off = 0; off < len; off += clen) {
+			uint8_t tmp[2];
+
+			shake_extract(&rng, tmp, 2);
+			clen = (size_t)tmp[0] | ((size_t)tmp[1] << 8);
+			if (clen > len - off) {
+				clen = len - off;
+			}
+			do255s_sign_ctx_update(&sc, msg + off, clen);
+		}
+		do255s_sign_ctx_final(&sig, &sc, &sk, &pk, seed, sizeof seed);
+		check_equals(sig.b, sig_ref.b, 64, "sign_ctx");
+
+		do255s_verify_ctx_init(&vc);
+		do255s_verify_ctx_update(&vc, msg, len);
+		if (!do255s_verify_ctx_final_vartime(&vc, &sig, &pk)) {
+			fprintf(stderr, "verify_ctx 1\n");
 			exit(EXIT_FAILURE);
 		}
-		data[0] ^= 0x01;
-		if (do255e_verify_vartime(&sig, &pk,
-			DO255_OID_SHA3_256, data, 32))
-		{
-			fprintf(stderr, "KAT sign verify 2");
+		do255s_verify_ctx_init(&vc);
+		do255s_verify_ctx_update(&vc, msg, len);
+		do255s_verify_ctx_update(&vc, "", 1);
+		if (do255s_verify_ctx_final_vartime(&vc, &sig, &pk)) {
+			fprintf(stderr, "verify_ctx 2\n");
 			exit(EXIT_FAILURE);
 		}
 
 		printf(".");
 		fflush(stdout);
 	}
+
 	printf(" done.\n");
 	fflush(stdout);
 }
 
-/*
- * KAT do255s keygen.
- * For i in 0..19, keygen with SHAKE256((byte)i) as source.
- */
-static const char *const KAT_DO255S_KEYGEN[] = {
-	"f17dbcbef04a157b7e470b6563940017e5de0bbf30042ef0a86e36f4b8600d14",
-	"07e4009d918a6c56f5a65896a8720ae26d4beeefcf67acd236886ca5475a1219",
+static void
+test_do255e_sign_pool(void)
+{
+	static do255e_nonce ent1[37], ent2[37];
+	do255e_nonce_pool pool1, pool2;
+	do255e_private_key sk;
+	do255e_public_key pk;
+	do255e_signature sig;
+	shake_context rng;
+	uint8_t seed[32], zero[sizeof ent1[0]];
+	size_t u;
 
-	"0635a00de8e704b122b478bd1a0663a777153d5b748baf796190856803d9773a",
-	"a6b4f6eff4a248044f7421d32c85ec7dec6677afc90df497beadd489f104f729",
+	printf("Test do255e sign_pool: ");
+	fflush(stdout);
 
-	"c22008517d59517518530122a42f14099a9b5b7d7cb4adb2ca59716b5eacf811",
-	"26b85f600b2f03b027024bb5156f16c6a39f72eb34c9133c3b50c14050218979",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_sign_pool", 21);
+	shake_flip(&rng);
+	do255e_keygen(&rng, &sk, &pk);
+	shake_extract(&rng, seed, sizeof seed);
+	memset(zero, 0, sizeof zero);
+
+	/*
+	 * Refill by parts (including partial batches); two pools with
+	 * the same seed and refilled in the same way produce the same
+	 * entries, and each entry is a valid (k, encode(k*G)) pair.
+	 */
+	do255e_nonce_pool_init(&pool1, ent1, 37, seed, sizeof seed);
+	do255e_nonce_pool_init(&pool2, ent2, 37, seed, sizeof seed);
+	if (do255e_nonce_pool_refill(&pool1, 5) != 5
+		|| do255e_nonce_pool_refill(&pool1, 0) != 32
+		|| do255e_nonce_pool_refill(&pool1, 0) != 0
+		|| do255e_nonce_pool_refill(&pool2, 5) != 5
+		|| do255e_nonce_pool_refill(&pool2, 0) != 32
+		|| pool1.count != 37 || pool2.count != 37)
+	{
+		fprintf(stderr, "nonce_pool_refill count\n");
+		exit(EXIT_FAILURE);
+	}
+	for (u = 0; u < 37; u ++) {
+		do255e_point R;
+		uint8_t R_enc[32];
 
-	"db4252337900d8ab7f609d170135d459a6798945d5a574d4a9db7b623c754d07",
-	"dc450fc99fe87dbec0f5f31edb85eb133ec9cbe6598481a09d2fb9bd92f48057",
+		do255e_mulgen(&R, ent1[u].k);
+		do255e_encode(R_enc, &R);
+		check_equals(R_enc, ent1[u].R_enc, 32, "nonce_pool R_enc");
+	}
+	check_equals(ent1, ent2, sizeof ent1, "nonce_pool determinism");
+	seed[0] ^= 0x01;
+	do255e_nonce_pool_init(&pool2, ent2, 37, seed, sizeof seed);
+	do255e_nonce_pool_refill(&pool2, 1);
+	if (memcmp(ent1[0].k, ent2[0].k, 32) == 0) {
+		fprintf(stderr, "nonce_pool seed\n");
+		exit(EXIT_FAILURE);
+	}
 
-	"87f1eb67b2f70780ff554843c8bd2980540cf15ed1d23499d013359759ef5927",
-	"41492f6a1150193c44abae47ed6b164e27d808c10ac6d98c3d3ac6d87b7ca607",
+	/*
+	 * Sign until the pool is empty; used entries are wiped.
+	 */
+	for (u = 0; u < 37; u ++) {
+		uint8_t hv[32], R_enc[32];
 
-	"fda04889dca632c34e1fb3d9939057ff557816bd83143f2397703f794ba3e130",
-	"ef070d9bbff46988e6899511ebe3b532afb8caab3aa7a3bfe7280c23764a2559",
+		shake_extract(&rng, hv, sizeof hv);
+		memcpy(R_enc, ent1[36 - u].R_enc, 32);
+		if (!do255e_sign_with_pool(&sig, &pool1, &sk, &pk,
+			DO255_OID_SHA3_256, hv, sizeof hv))
+		{
+			fprintf(stderr, "sign_with_pool 1\n");
+			exit(EXIT_FAILURE);
+		}
+		check_equals(sig.b, R_enc, 32, "sign_with_pool R");
+		check_equals(&ent1[36 - u], zero, sizeof zero,
+			"sign_with_pool wipe");
+		if (pool1.count != 36 - u) {
+			fprintf(stderr, "sign_with_pool count\n");
+			exit(EXIT_FAILURE);
+		}
+		if (!do255e_verify_vartime(&sig, &pk,
+			DO255_OID_SHA3_256, hv, sizeof hv))
+		{
+			fprintf(stderr, "sign_with_pool verify 1\n");
+			exit(EXIT_FAILURE);
+		}
+		hv[u & 31] ^= 0x04;
+		if (do255e_verify_vartime(&sig, &pk,
+			DO255_OID_SHA3_256, hv, sizeof hv))
+		{
+			fprintf(stderr, "sign_with_pool verify 2\n");
+			exit(EXIT_FAILURE);
+		}
+		if (u % 4 == 0) {
+			printf(".");
+			fflush(stdout);
+		}
+	}
 
-	"bea6f1eb5e8e3d50f605bb614f706d1e0826071c3f4223cc321ba4cd0aec6502",
-	"0211f9839282ba0d86761aafb129e2c76da9312c492210aa96fe7d841b302c3e",
+	/*
+	 * Empty pool; raw message (hash_oid == NULL); pool clearing.
+	 */
+	if (do255e_sign_with_pool(&sig, &pool1, &sk, &pk, NULL, "abc", 3)) {
+		fprintf(stderr, "sign_with_pool empty\n");
+		exit(EXIT_FAILURE);
+	}
+	do255e_nonce_pool_refill(&pool1, 1);
+	do255e_sign_with_pool(&sig, &pool1, &sk, &pk, NULL, "abc", 3);
+	if (!do255e_verify_vartime(&sig, &pk, NULL, "abc", 3)) {
+		fprintf(stderr, "sign_with_pool verify 3\n");
+		exit(EXIT_FAILURE);
+	}
+	do255e_nonce_pool_refill(&pool2, 0);
+	do255e_nonce_pool_clear(&pool2);
+	for (u = 0; u < 37; u ++) {
+		check_equals(&ent2[u], zero, sizeof zero, "nonce_pool_clear");
+	}
+	if (pool2.count != 0) {
+		fprintf(stderr, "nonce_pool_clear count\n");
+		exit(EXIT_FAILURE);
+	}
 
-	"6312bea16eac7bdf93d5d2299aa8c9a248aa2571ae69543fa6a7a837532d0632",
-	"8680740b543c20ce1dd3d2bc4950258cdad26b53a904fe531397e5e25e5aaf53",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"c0391dac03aa88c968c365a0742643cab88ca34a127e1c9f5d71d9ecb3afd423",
-	"e12f617a9656751a45db6f00746e90eb56e7b31933bf1afd3a4fa554ab31695f",
+static void
+test_do255s_sign_pool(void)
+{
+	static do255s_nonce ent1[37], ent2[37];
+	do255s_nonce_pool pool1, pool2;
+	do255s_private_key sk;
+	do255s_public_key pk;
+	do255s_signature sig;
+	shake_context rng;
+	uint8_t seed[32], zero[sizeof ent1[0]];
+	size_t u;
 
-	"4266dfe30012338515c44c70764d7aac247f97e4f7913713a80cb2630b646935",
-	"665bc6df189d53fc4d59d3b5e8cf45349ab7ae15f1ad1b0aa2705feef4741129",
+	printf("Test do255s sign_pool: ");
+	fflush(stdout);
 
-	"7e01e5d06f93257b18e60da64307ad3457a5b711d99cda07ff14042c4d8b833a",
-	"2e608d5fe618f81088d25e06d561f89ca90679c27673053d334a53dfee00817d",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_sign_pool", 21);
+	shake_flip(&rng);
+	do255s_keygen(&rng, &sk, &pk);
+	shake_extract(&rng, seed, sizeof seed);
+	memset(zero, 0, sizeof zero);
+
+	/*
+	 * Refill by parts (including partial batches); two pools with
+	 * the same seed and refilled in the same way produce the same
+	 * entries, and each entry is a valid (k, encode(k*G)) pair.
+	 */
+	do255s_nonce_pool_init(&pool1, ent1, 37, seed, sizeof seed);
+	do255s_nonce_pool_init(&pool2, ent2, 37, seed, sizeof seed);
+	if (do255s_nonce_pool_refill(&pool1, 5) != 5
+		|| do255s_nonce_pool_refill(&pool1, 0) != 32
+		|| do255s_nonce_pool_refill(&pool1, 0) != 0
+		|| do255s_nonce_pool_refill(&pool2, 5) != 5
+		|| do255s_nonce_pool_refill(&pool2, 0) != 32
+		|| pool1.count != 37 || pool2.count != 37)
+	{
+		fprintf(stderr, "nonce_pool_refill count\n");
+		exit(EXIT_FAILURE);
+	}
+	for (u = 0; u < 37; u ++) {
+		do255s_point R;
+		uint8_t R_enc[32];
 
-	"6150b3748ba9bac015d100718850b5530073659eededed0b7e6f6ebb886d392d",
-	"924e4fef4a4c467a01c0631ad3f3b2127e48ac4102eb806af3dee20b0ef2fd17",
+		do255s_mulgen(&R, ent1[u].k);
+		do255s_encode(R_enc, &R);
+		check_equals(R_enc, ent1[u].R_enc, 32, "nonce_pool R_enc");
+	}
+	check_equals(ent1, ent2, sizeof ent1, "nonce_pool determinism");
+	seed[0] ^= 0x01;
+	do255s_nonce_pool_init(&pool2, ent2, 37, seed, sizeof seed);
+	do255s_nonce_pool_refill(&pool2, 1);
+	if (memcmp(ent1[0].k, ent2[0].k, 32) == 0) {
+		fprintf(stderr, "nonce_pool seed\n");
+		exit(EXIT_FAILURE);
+	}
 
-	"a597ac8b40b108940feb5c6325590931981e40b1c4d1d69210f9f802e85fda1f",
-	"27fceec7ac050d8353143392e2d63c38203fa1233af5ec37e8296639e0ba6770",
+	/*
+	 * Sign until the pool is empty; used entries are wiped.
+	 */
+	for (u = 0; u < 37; u ++) {
+		uint8_t hv[32], R_enc[32];
 
-	"9fa0822c27259906d052b2f8ba7ef8a318d92cff32063a1d3985f140fa2cfb2f",
-	"a23666c90f966c199ab0727a274abf39f4921d2f5df2d264da73a80856f4ef33",
+		shake_extract(&rng, hv, sizeof hv);
+		memcpy(R_enc, ent1[36 - u].R_enc, 32);
+		if (!do255s_sign_with_pool(&sig, &pool1, &sk, &pk,
+			DO255_OID_SHA3_256, hv, sizeof hv))
+		{
+			fprintf(stderr, "sign_with_pool 1\n");
+			exit(EXIT_FAILURE);
+		}
+		check_equals(sig.b, R_enc, 32, "sign_with_pool R");
+		check_equals(&ent1[36 - u], zero, sizeof zero,
+			"sign_with_pool wipe");
+		if (pool1.count != 36 - u) {
+			fprintf(stderr, "sign_with_pool count\n");
+			exit(EXIT_FAILURE);
+		}
+		if (!do255s_verify_vartime(&sig, &pk,
+			DO255_OID_SHA3_256, hv, sizeof hv))
+		{
+			fprintf(stderr, "sign_with_pool verify 1\n");
+			exit(EXIT_FAILURE);
+		}
+		hv[u & 31] ^= 0x04;
+		if (do255s_verify_vartime(&sig, &pk,
+			DO255_OID_SHA3_256, hv, sizeof hv))
+		{
+			fprintf(stderr, "sign_with_pool verify 2\n");
+			exit(EXIT_FAILURE);
+		}
+		if (u % 4 == 0) {
+			printf(".");
+			fflush(stdout);
+		}
+	}
 
-	"66c8576f3896a194f48c91f71e8c999ba77e77a291188897de766170d6131503",
-	"4675d07601fabed44c2835dd417efa263655c6fd0aca3fdfdf2dfc316240ef07",
+	/*
+	 * Empty pool; raw message (hash_oid == NULL); pool clearing.
+	 */
+	if (do255s_sign_with_pool(&sig, &pool1, &sk, &pk, NULL, "abc", 3)) {
+		fprintf(stderr, "sign_with_pool empty\n");
+		exit(EXIT_FAILURE);
+	}
+	do255s_nonce_pool_refill(&pool1, 1);
+	do255s_sign_with_pool(&sig, &pool1, &sk, &pk, NULL, "abc", 3);
+	if (!do255s_verify_vartime(&sig, &pk, NULL, "abc", 3)) {
+		fprintf(stderr, "sign_with_pool verify 3\n");
+		exit(EXIT_FAILURE);
+	}
+	do255s_nonce_pool_refill(&pool2, 0);
+	do255s_nonce_pool_clear(&pool2);
+	for (u = 0; u < 37; u ++) {
+		check_equals(&ent2[u], zero, sizeof zero, "nonce_pool_clear");
+	}
+	if (pool2.count != 0) {
+		fprintf(stderr, "nonce_pool_clear count\n");
+		exit(EXIT_FAILURE);
+	}
 
-	"aabb07488ff9edd05d6a603b7791b60a16d45093608f1badc0c9cc9a9154f215",
-	"3ecbb71ee68ca84fbedd6167c48265aeee3df84dcf526b4042f52248649c0912",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"a71570d4a4d7660efec3a4486cacfd2a3c83b327ef8d86caab540ef295edb33e",
-	"05fbd65bf8cfc86403ef17f896c4396bb6aa3bcf9048c67330041a850ae7c119",
+static void
+test_do255e_verify_batch(void)
+{
+	struct {
+		do255e_signature sig;
+		do255e_public_key pk;
+		unsigned char hv[32];
+	} rec[40];
+	do255e_private_key sk[3];
+	do255e_public_key pk[3];
+	shake_context rng;
+	int i, j;
 
-	"2b75a94787b9c8f3bc4d7f7192e3bd99940f0333bd845b66933d0bfabbec842f",
-	"443294a320d54e81c54cd32d7f5b68eaee96331515887e19253cb897996c4260",
+	printf("Test do255e verify batch: ");
+	fflush(stdout);
 
-	"edbe8ff65bb6188a1890fa66add7caddcb2851ebab1dc1cf4bff878a13686133",
-	"8f35d1a21a173ca61247229a6e16a98e77b37a4d52f7a0baa2e482ad3691b255",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255e_verify_batch", 24);
+	shake_flip(&rng);
+	for (i = 0; i < 3; i ++) {
+		do255e_keygen(&rng, &sk[i], &pk[i]);
+	}
 
-	"fa928cb0835f556b83c794dbc0d22a30895070a9998371ad3bab311da54c9716",
-	"a45d4fae9b1c3f0d553b2b181bd6f3f2362d59898b99b83fab2d0d5aa90d655d",
+	for (i = 0; i < 20; i ++) {
+		unsigned char res[40], tmp[2];
+		size_t u, num;
+		int r, all;
+
+		/*
+		 * Iteration i uses num = 2*i signatures (plus one, so that
+		 * we get a batch of size 1 too), with a few keys; some
+		 * entries are then corrupted.
+		 */
+		num = (size_t)(2 * i + 1);
+		for (u = 0; u < num; u ++) {
+			shake_extract(&rng, tmp, 2);
+			j = tmp[0] % 3;
+			shake_extract(&rng, rec[u].hv, 32);
+			do255e_sign(&rec[u].sig, &sk[j], &pk[j],
+				DO255_OID_SHA3_256, rec[u].hv, 32, NULL, 0);
+			rec[u].pk = pk[j];
+			if (i % 3 != 0) {
+				switch (tmp[1] & 31) {
+				case 0:
+					rec[u].hv[tmp[1] >> 5] ^= 0x01;
+					break;
+				case 1:
+					rec[u].sig.b[tmp[1] >> 5] ^= 0x04;
+					break;
+				case 2:
+					rec[u].sig.b[63 - (tmp[1] >> 5)] ^= 0x10;
+					break;
+				case 3:
+					rec[u].pk = pk[(j + 1) % 3];
+					break;
+				}
+			}
+		}
 
-	NULL
-};
+		all = 1;
+		for (u = 0; u < num; u ++) {
+			res[u] = (unsigned char)do255e_verify_vartime(
+				&rec[u].sig, &rec[u].pk,
+				DO255_OID_SHA3_256, rec[u].hv, 32);
+			all &= res[u];
+			if (i % 3 == 0 && !res[u]) {
+				fprintf(stderr, "verify failed\n");
+				exit(EXIT_FAILURE);
+			}
+			res[u] ^= 0xFF;
+		}
+		r = do255e_verify_batch_vartime(res,
+			&rec[0].sig, sizeof rec[0], &rec[0].pk, sizeof rec[0],
+			DO255_OID_SHA3_256, rec[0].hv, 32, sizeof rec[0],
+			num, (i & 1) ? &rng : NULL);
+		if (r != all) {
+			fprintf(stderr, "batch verify failed (%d / %d)\n",
+				r, all);
+			exit(EXIT_FAILURE);
+		}
+		for (u = 0; u < num; u ++) {
+			if (res[u] != (unsigned char)do255e_verify_vartime(
+				&rec[u].sig, &rec[u].pk,
+				DO255_OID_SHA3_256, rec[u].hv, 32))
+			{
+				fprintf(stderr, "batch verify failed (%u)\n",
+					(unsigned)u);
+				exit(EXIT_FAILURE);
+			}
+		}
 
-/*
- * KAT do255s ECDH.
- * Each group of five value is:
- *   private key
- *   public peer point (valid)
- *   secret from ECDH with valid peer point
- *   public peer point (invalid)
- *   secret from ECDH with invalid peer point
- */
-static const char *const KAT_DO255S_ECDH[] = {
-	"0b60d9af0d907ad367c24916a2a5a7304d91627c062995a4247952fb90a67e07",
-	"d642ebc9d2c25d04dd4f5a2b2fec9bb113c4a5e7cf18f133012a9ecc0c34805d",
-	"496dc32968fa89024ccbbfa52a0fee974e5046dfdc61ea8b4c818e73e3bddf25",
-	"76c6b5d3de8130ff877421680d399121e3940cb0de15f32b85ed660beeca5b05",
-	"af8aa84ca1a92b5a493c09e10d015915659d53ee17eacaf30bcc6eef031c3a5c",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"8f95a611095c4ef62bbff5655ef9709ec282624bcfcef0c6c397d2017e8c682b",
-	"a80f03420c7a1f97f53e3ee1f7b250510870b47c05697aec5d0c6a78e5f38651",
-	"5976a88675c86548925f463d02ca025199bae4b2b8eb543e60ba613f43650fd9",
-	"bdbedc86551dac2f4e5aedd8dedd23f737bfecafc4d3ccef98c12434486acd21",
-	"4edbf4dceef3fab819d65e748a8bac665d9a92e25d85678fd882186a7c5531ae",
+	/*
+	 * Same signer and same data for all signatures (stride 0).
+	 */
+	for (i = 0; i < 10; i ++) {
+		do255e_signature sig[20];
+		unsigned char hv[32], seed[1];
+
+		shake_extract(&rng, hv, 32);
+		for (j = 0; j < 20; j ++) {
+			seed[0] = (unsigned char)j;
+			do255e_sign(&sig[j], &sk[0], &pk[0],
+				DO255_OID_SHA3_256, hv, 32, seed, 1);
+		}
+		if (!do255e_verify_batch_vartime(NULL,
+			sig, sizeof sig[0], &pk[0], 0,
+			DO255_OID_SHA3_256, hv, 32, 0, 20, &rng))
+		{
+			fprintf(stderr, "batch verify failed (same signer)\n");
+			exit(EXIT_FAILURE);
+		}
+		sig[i].b[40] ^= 0x01;
+		if (do255e_verify_batch_vartime(NULL,
+			sig, sizeof sig[0], &pk[0], 0,
+			DO255_OID_SHA3_256, hv, 32, 0, 20, &rng))
+		{
+			fprintf(stderr, "batch verify should have failed\n");
+			exit(EXIT_FAILURE);
+		}
 
-	"5c1ddcb969ceff6d08376f37620e8db26d547988a9711bc0ceb81aecb287510e",
-	"9be0a372230295c530ac8f1068b51798bb71e09db69a29e9bc6f24aca87c7313",
-	"7727be9d3e2a49a12218501dd2f15f8133460e870d322f6793a5b037febd96ea",
-	"23d40935d51eea778bbe72645278f0a738f33aee6b089a7a94c3426c519b893a",
-	"db0b45c097684f8bbae4515a0b58aa4e1e42a5f0d883fedb758f6efb68e6581f",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"58eb59334187c7b1177b19734e412115d8a83b87744d6f1c646f002d2fd56d2a",
-	"3a52a1735586f1ae3f7bc97c3e04d342b861755874e92191191b03ae20ae9a3f",
-	"02f70f575c05cc8f195c62f5c9371609f116c50aeddcfa037af678c3b032d7d4",
-	"15483dea69a547c3a6ddbcb81e3374145344e64e38918ff40b3e0e8df5f78f0f",
-	"55a7c3a1146e07ae19fab223e3d909672ac24e6c7949beadf6ee96493a7a6206",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"6d206c6ef982d5de8b6142bf3d4e7a95dcb4e3db20a0cfd8fba72a5afe956531",
-	"dd6e99b75e6b83422ce683f5a4081de22926767d3e34c21f51b4b88925256663",
-	"7762e2dd5b5aed06ee17675931cc9540e9a917489e1ba05c82ca691e493f1f23",
-	"a8b7403e0618b033ef62139deea274bbb7c7d455de8646bffd9f4a1ab3e3ba11",
-	"389814e5e5c1479a8d7e7db177ee5b50029ab90ffe51e9f0c98685934c09a844",
+static void
+test_do255s_verify_batch(void)
+{
+	struct {
+		do255s_signature sig;
+		do255s_public_key pk;
+		unsigned char hv[32];
+	} rec[40];
+	do255s_private_key sk[3];
+	do255s_public_key pk[3];
+	shake_context rng;
+	int i, j;
 
-	"e9cdb07c36fe154b43433e593f6f96cb2bd4352f66d530fb54b6401cdcb1942f",
-	"15fbedede4fe2a5b48d74ed6bb44fbe85efc7da2648064d5e6e8c1c436de866e",
-	"9279a6f3c4a6fcfe2be8de9ae27b7f4ef315cd360cad44e4def29b2e69aba62c",
-	"a888375439a860c2f5f4b5e21366d7b27afd47c8e3c02f4577aa459c3db6a455",
-	"3b9f382ebfbc5734f082867ebbacadea5e80e611b53400fce10312d657a73a74",
+	printf("Test do255s verify batch: ");
+	fflush(stdout);
 
-	"4a90bd7b42af4bddd61339010b58a87887990fd63883fb30825d15442f84de09",
-	"b3d3629f8ebb06c6495c5e43da2dda4d70411e9b4dd2c5d547c1f71f4aa39b45",
-	"eadc84acb8c474582062c9e028e35b06a027e19850dfbd6e5361dc02abb5f7a6",
-	"5d54defb01469867de1586693abca766725a7614c0efaf3abd3971a365ee062f",
-	"044ca8c19987d9e6147e70d2da59a55be892dc23e57e9b494cb01d4ede14ece5",
+	shake_init(&rng, 128);
+	shake_inject(&rng, "test do255s_verify_batch", 24);
+	shake_flip(&rng);
+	for (i = 0; i < 3; i ++) {
+		do255s_keygen(&rng, &sk[i], &pk[i]);
+	}
 
-	"bedf5af3c0cacde96ec1774eddc4572bbd598fa53b9d8e91710260d67a4f782e",
-	"a53dca0723c4fd22e8bc2ea0667a79658dad95c32b64f09b5fb5013e4e07391a",
-	"4f0453d61d07dac237b44b6847408fc9757a8e6475b37d3275fdfcf740b34169",
-	"5316bafd1104ea456a817c1a6967f2e3ad50257aad97ce4323090ab4809a7827",
-	"5a2965d2e6cb6540c56d2e9a9e18a7f8b1f4ae904ca26b65cb228137c7c9ec16",
+	for (i = 0; i < 20; i ++) {
+		unsigned char res[40], tmp[2];
+		size_t u, num;
+		int r, all;
+
+		/*
+		 * Iteration i uses num = 2*i signatures (plus one, so that
+		 * we get a batch of size 1 too), with a few keys; some
+		 * entries are then corrupted.
+		 */
+		num = (size_t)(2 * i + 1);
+		for (u = 0; u < num; u ++) {
+			shake_extract(&rng, tmp, 2);
+			j = tmp[0] % 3;
+			shake_extract(&rng, rec[u].hv, 32);
+			do255s_sign(&rec[u].sig, &sk[j], &pk[j],
+				DO255_OID_SHA3_256, rec[u].hv, 32, NULL, 0);
+			rec[u].pk = pk[j];
+			if (i % 3 != 0) {
+				switch (tmp[1] & 31) {
+				case 0:
+					rec[u].hv[tmp[1] >> 5] ^= 0x01;
+					break;
+				case 1:
+					rec[u].sig.b[tmp[1] >> 5] ^= 0x04;
+					break;
+				case 2:
+					rec[u].sig.b[63 - (tmp[1] >> 5)] ^= 0x10;
+					break;
+				case 3:
+					rec[u].pk = pk[(j + 1) % 3];
+					break;
+				}
+			}
+		}
 
-	"2a6fbfc17da763851cec7006abaee6a5890077891912801d6e7654cf4da0353b",
-	"a7ee66e44141aec2ba0b01801db5785b686de1a1a1254f8ebc3de3c2505c730c",
-	"64636087be0e692c209f302430febc61447436ebbd1b3bd92a1e89e971a07cc8",
-	"8747b9b81a5152a075dfd12d6ccdb987cff6d069dd528fb895e5abdb9ca67526",
-	"6568ce09e4f0390b060a2c8735d4137da14d46b39740b1ad503419b3e74a16fc",
+		all = 1;
+		for (u = 0; u < num; u ++) {
+			res[u] = (unsigned char)do255s_verify_vartime(
+				&rec[u].sig, &rec[u].pk,
+				DO255_OID_SHA3_256, rec[u].hv, 32);
+			all &= res[u];
+			if (i % 3 == 0 && !res[u]) {
+				fprintf(stderr, "verify failed\n");
+				exit(EXIT_FAILURE);
+			}
+			res[u] ^= 0xFF;
+		}
+		r = do255s_verify_batch_vartime(res,
+			&rec[0].sig, sizeof rec[0], &rec[0].pk, sizeof rec[0],
+			DO255_OID_SHA3_256, rec[0].hv, 32, sizeof rec[0],
+			num, (i & 1) ? &rng : NULL);
+		if (r != all) {
+			fprintf(stderr, "batch verify failed (%d / %d)\n",
+				r, all);
+			exit(EXIT_FAILURE);
+		}
+		for (u = 0; u < num; u ++) {
+			if (res[u] != (unsigned char)do255s_verify_vartime(
+				&rec[u].sig, &rec[u].pk,
+				DO255_OID_SHA3_256, rec[u].hv, 32))
+			{
+				fprintf(stderr, "batch verify failed (%u)\n",
+					(unsigned)u);
+				exit(EXIT_FAILURE);
+			}
+		}
 
-	"978fe1674bb4875a12de35acdd4fa5bc703154f401e120c9c93f6a65f9015c28",
-	"974a59c33edcf045159d8a8bcc4ea0dc8fad2ac8db0d2a6ebebcac8e503b7276",
-	"dcab715ecccaf190a1d4bbca320908883c143df8c45055f32f83057b109938dc",
-	"0d3c17ce3c7b8cb19d73a868e66892572688abd9ecd7c19b725efd3aa0138216",
-	"119bb167339e0202cc240650e4e456b607cc19c54ce449e9d27047da7bde779f",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"c888bb347d7a05609ba08dec3245db1af77dee4d854e07c0da9e20cee358473a",
-	"faa6f8374e37d0d431f25b2b5249cfbad8b472b6aa931eac85ee3ac005326832",
-	"ee942c37d828c77ad8cbd89effa1993628d336aca02b981f9df05b6e087537c8",
-	"0b3aa099e0bca5abc5bd6736dcf6de294406e8e86f0af1e76db469fced569e26",
-	"64cab2da182bf86382f4016fc902f5f9f79afffe20a0849a3597b86dc8eb13c2",
+	/*
+	 * Same signer and same data for all signatures (stride 0).
+	 */
+	for (i = 0; i < 10; i ++) {
+		do255s_signature sig[20];
+		unsigned char hv[32], seed[1];
+
+		shake_extract(&rng, hv, 32);
+		for (j = 0; j < 20; j ++) {
+			seed[0] = (unsigned char)j;
+			do255s_sign(&sig[j], &sk[0], &pk[0],
+				DO255_OID_SHA3_256, hv, 32, seed, 1);
+		}
+		if (!do255s_verify_batch_vartime(NULL,
+			sig, sizeof sig[0], &pk[0], 0,
+			DO255_OID_SHA3_256, hv, 32, 0, 20, &rng))
+		{
+			fprintf(stderr, "batch verify failed (same signer)\n");
+			exit(EXIT_FAILURE);
+		}
+		sig[i].b[40] ^= 0x01;
+		if (do255s_verify_batch_vartime(NULL,
+			sig, sizeof sig[0], &pk[0], 0,
+			DO255_OID_SHA3_256, hv, 32, 0, 20, &rng))
+		{
+			fprintf(stderr, "batch verify should have failed\n");
+			exit(EXIT_FAILURE);
+		}
 
-	"20074bd97f8f2d40ac4e1811bbf3405be9bc900cd7ac662b64f48d97f324bd1e",
-	"8c1f8896cc56dfda73317b21403ba1ee38a9823230565fbe5706cb9d23a87f5d",
-	"db25cdcd75c919ee5d10d1e9420061ebf4ea4e83a6dda8531c7ad63532981d41",
-	"540910e3bb076075da39700f6b72cdc6c611a315ff0402a1471218a18e46991d",
-	"79a4c3b6f27046ab7d7495dab1f1ee95b9da22e4660a1bb8555a9c7da6a9d760",
+		printf(".");
+		fflush(stdout);
+	}
 
-	"71fe7be0cefac677f315e53d9bbb5a317ee024ae8c82ea904aa7d5496dcd3a11",
-	"f68bd5940810a1c3c85b50ac2b656eab983f0507bccedae3329adfc4876a7565",
-	"ccf688fc2d007e78bc9f34ffb928839d6c60f6184cfc2307100c891439f4cd57",
-	"865f2cf34ea2ee326d42b62d7868b9a12dbcb2b26858c333ea978df37b5d2870",
-	"a33f09bef70a295702bfbfd992cea1fc31038667c2accc8b3873fd72ac143255",
+	printf(" done.\n");
+	fflush(stdout);
+}
 
-	"c179c485ff5cb0537268906d66f36a25fb11b551662b799d761a4a9097f2fc32",
-	"68bef03de98f175a15121a01234c6084882008eebab1c6cf95576724faa8e27c",
-	"5ce14f7915ba47a14377c1bed66c79b4640cd0a243aa3b1748dd756a8fb68b55",
-	"31596598561f475e5379c15129b1c9f833c831a376e4b639bb57ed77f7faa126",
-	"6bcc12eee8e88b3ad3878e089bd07dd803256358ca71951cece61d65e62b3aa9",
+/*
+ * KAT do255e keygen.
+ * For i in 0..19, keygen with SHAKE256((byte)i) as source.
+ */
+static const char *const KAT_DO255E_KEYGEN[] = {
+	"938b4583a72eb5382f3a2fa2ce57c3a4e5de0bbf30042ef0a86e36f4b8600d14",
+	"b7d9c6c6adaf587b03120202c168831bc23b2a67f66d15aa0ce1382baaf14d52",
 
-	"6abe395062e48c5a4ff278c5aedfdca9a80ebe474ea5eb88849468802a58b83b",
-	"b49af1e1ec15880fb7c5a0e5f97538a86130058f58758af5fb6d0272bf8f0237",
-	"05145ccd3dbe28e76dfb7b48072c82a379e36fef1720d7343d257f488eb7a50e",
-	"b355f9c90587debc900a7498491736785ec79c97de7b4b8ddcc3f9cfc8cc3f34",
-	"4793c316b9ec1fc75fd9d83c9a050ace3b79940d2622208957c3ad8480f006e9",
+	"4a50b29655af442c8499c037f18ce8c278153d5b748baf796190856803d9773a",
+	"ff2ac7224924892e240c731ec2e48309015d811568c9973d35ecdbc894a64704",
 
-	"6446de55796eb238e30fadff35977e2d62de45ce5a27c794017ed9790c869101",
-	"2a0cdf633153be7cda181aa8e9967c92ce13212a7f13c337e25661fbc971c658",
-	"82210570ba2a9783aa80ede04921e45c9c03c59076e8e36a28b735fcaf2dc3a0",
-	"1097272b8bd51660c911f48e293198ef7b1dd83804d80f8728d83f1320b5400e",
-	"01ad6b464607fe30fefb419c25709c386b30b58e79ba1075d7ba82f16d0baefc",
+	"642e9115343df132c945255f0ff3d6969a9b5b7d7cb4adb2ca59716b5eacf811",
+	"7f98f2bbf09789958c3613236c91b71762eb003778add1885490ee94c20aed47",
 
-	"8ccc3f94c4c0f0fe6fee9b853a54907811a95f66696dc72843ebfc2ff8445536",
-	"7dc8d90e4139704f345c6bd80d7e029af6e2c7208bf5d6a4b679a60da53ba87e",
-	"0ac8906f35d3f43d973ebc85c51d2137f8e6c9271082d22f2f8183e0d97376ff",
-	"154e473e1bbd2b3a4326602079aa69f066359ea2cb6a71455a8ff72da1f9f724",
-	"c676c044aaf9dedb19b9b4113b41952234e9ba8d6d46e47295b4009a484b6b93",
+	"db4252337900d8ab7f609d170135d459a6798945d5a574d4a9db7b623c754d07",
+	"5c9faa85d638a92d9e5c12afa46d49c2420efaab23190241530094b8efe72806",
 
-	"50ddc9d34d0e9cbb63f877ca2724a29a02a5e5aa74eab98065a379c29f319d1c",
-	"e5fa050131dfa6d36627441b248e3bce51553041cdb1292d4a6c1b08890c1313",
-	"3fb891468269d14360b875a4f80071474e66cb8069f8086f15931ea69c943acc",
-	"4fc6ef3f31cd4ab2cf4ba4f9ad9cbdf27e3c7819ff3d6556b1d3746dabfd651c",
-	"4f6f90ec5f3634d888a5f0a395bb50924cde20baddb25eaf8c86461221912cb5",
+	"87f1eb67b2f70780ff554843c8bd2980540cf15ed1d23499d013359759ef5927",
+	"017536300dc562e33776b4ae9ee43a5e120667e292852e3aa978ab34fcc7820d",
 
-	"8c707a5ca1995b331b83ef6fc2cf9d11106ed16da7b5283004cc76d4af708215",
-	"2a92fc430bca0b9cc36f89dd9832e68a947723fc5839b117b8bfc47b12029e4b",
-	"ad40abf4e50de087d601bc5ca8f62dbe8809f172fcdcbf074f1aa9a3ac86d73a",
-	"008930651ab148f1aad3b9432a2258d15c3216bde9931ef1bfb1a06b29202007",
-	"8bb1833a245779a2ff346bc231c6924d2b4c5a991336b5997de85c694153c518",
+	"41bc5a124a6e723eb004fb536a17dd1a577816bd83143f2397703f794ba3e130",
+	"24d5334513be93d7eeac84f5694e9c20659107c17fe2055280e09d4c8819387a",
 
-	"87553a36be57779d14f14f7a3e4112e1ceb051fe6a849f003f6a2bb9ac266e39",
-	"7c2b52951827b02e740edf0ce42cc98a6c2d6422f1ccd2d7a873daa47533dd4b",
-	"32213ceb8b8d81b101a004bf12ca17704a77dd7135e383769904425a10fd4b9b",
-	"c6ea83ef596207d6493e07158da61d1e5ff5e323d00436e3d7c874fdd167572c",
-	"a83506244231388ae7a981fbe8fc816d7ea350e3a5d5d52492ad03d0fbc911ac",
+	"02c20375cc557dcb57eb02dc25f7f2390926071c3f4223cc321ba4cd0aec6502",
+	"18dd6b94a95c55d29204751031bb915b6c6adc8878aecc305757b51e81dd983a",
 
-	NULL
-};
+	"493b59ef92575b18a6ad3ee1dbf2114c4aaa2571ae69543fa6a7a837532d0632",
+	"f65a28c4afba44303bd8f1325c61d456e2e1f32b1525d0ccafa43dc36d204a27",
 
-/*
- * KAT do255s signature.
- * Each group of five value is:
- *   private key
- *   public key
- *   seed (can be empty!)
- *   data (SHA3-256 of "sample X" with X = 0, 1,...)
- *   signature
- */
-static const char *const KAT_DO255S_SIGN[] = {
-	"e7c1f12f0f7000d7f67a5a5c8d6a14700fba7a69d530c935c68105109ddce608",
-	"e5a5789fe4447b6de68259cb8916a29d92b11bf817d51ba4423305c1ca22497d",
-	"",
-	"9eb7ccdd65cfb6e02f99210264c6424c911ab8890fcd93f064399d747b503ecf",
-	"89d6cfd9a701d5a65b2f14570b340a21ba68d1d3c32e44a429b33d2db055910f0800d734bc10da80a0b2ab6e192d495eca1e71cc8ea53d8e70cbedf70a30643a",
+	"a662b8f9275568027b9bd157b6708b73ba8ca34a127e1c9f5d71d9ecb3afd423",
+	"1cbe4b02bb3acbbc20764101c452061591b80d52eb89301424332c8a39ba9314",
 
-	"115d54b74937d20f24816af4d1b35583f2c092285f59317b3b5c4ac4841ea113",
-	"6bead75292150e0898e3404199f2d9490ac9ee2ff395d3a93458821bc29d2a1c",
-	"b1",
-	"45515ea2aec5e64eab4ca100c26b030447c07b66a9fb6f532cba12e1f62ae627",
-	"59bb28b2be7735a883a2ce67b76352a9a993bd8dbf0739c4577b8ca6f6b7ae160dd09db54c27b3369405d6f5293628cb213c04fbc95550d7471c5465e4c1a239",
+	"288f7a3125bd12be279cb827b897c255267f97e4f7913713a80cb2630b646935",
+	"59300e36d3d7d5a435c79b8dad6a974bffbeb3c9bc3ed54270e612dc10972451",
 
-	"471329a46cd075adc0c4c36ac161a157e7900e7ce69457a58f9e2df4165cb401",
-	"f306e28993bc5aa9ae3444bd59eb8ae3944c7b2b1393d53c182ab88566342210",
-	"896d",
-	"61954339a2d5ff28e0d496af0716d757891010625c8859cf2ffde8fc75f3e74d",
-	"a71e987ee3a2e685376e2d91a8b169f6152b64ec59bc1a24ee070d9c5a06fd21db4173a6dd85818fe8d1f1c4136ef78e4e5112d8e4f8649bc1a1bda876df8d12",
+	"200f6e952677c538c9d831e3aeca6fc257a5b711d99cda07ff14042c4d8b833a",
+	"9c9728c88778a9b6586d6f7049453160467829e16bb5ce4a7f63fac47e6f7f1f",
 
-	"cca6d9c557d0fec812da945f15258fd49288ac956ef6cfb46d5108ce14f2a604",
-	"78e06a93e5d7e560f6a82695e7c5a3c74424f1ac0ea7cb9810f8d6aa7193ec7d",
-	"356c39",
-	"e1bc41167127f1944e47d6c3e9775ea31919040ede6f1843baf1a039a363467e",
-	"57c144e06afe0e8434dd5619c6ad0edbc8117e42619267622a44df8efd8aea378d01662a382c49a6d6dafacb83762f6516f305150f1eb519740f758f2c604f12",
+	"a56bc5fdf870fa3b77b648eb5ed73a6f0173659eededed0b7e6f6ebb886d392d",
+	"26c4a638f7591e1a405a205594ce888992e24fbf5d9d8e14ea485d99c1908028",
 
-	"4f818f5503cac86c4988919dc6363e16646f677b35a8ffab5340d7144c301607",
-	"7d528e8e6ba5fe7b942a31b881fe862febd67c53425a4eb1624bfadb70f1f430",
-	"50c27940",
-	"68b268348810d58120705fe0ac3faaa11218c81f6560541891772c58305d3f6e",
-	"aa26f4b682f080f32cc265590c44cddede467d7454333dcf469687c629fb60668d6a8504e178e0492023996c05b4f8f320c0f2594f3fa76b6c21f4314c4c6425",
+	"47a53550f794a851c0dd80a0901cccbe981e40b1c4d1d69210f9f802e85fda1f",
+	"289d5098634f96fe4e8ee706c580937946706db1b231458d4929cab8a482bf0a",
 
-	"ec92eec04e4d608b7949b6673b223b0fada4b5cd0a45ed018d4d8341e7d73817",
-	"ca8cfb6022395629da3be657808fd3985b34a5ecd20de61b023323b44e6eb711",
-	"e47d5a9a3f",
-	"91cc12bdabea62f2fad09995b2177f3d01011d2b52fa51219d961e8801cf9b84",
-	"936599dbf96cdc7eadb145aa8e5c86c008d8810652cc91bfb26df3076b16e178328c28f89c4e4662be676d7994a02b96d9ae6c0f57e9702349c0c25955fe601e",
+	"41ae0bf1dd0839c48045d6352642bb3119d92cff32063a1d3985f140fa2cfb2f",
+	"c0a812552fc0516a4a3f131ed076fc95b4d98267683aeeed8d93655211cd5246",
 
-	"60f9d0bfbccf4b880b8c7961ef4c7f18c1424bfd38d68812ba288da371941d09",
-	"903b6ce5c39c3a15f1f6a2782462cc39185192253fa1a8532e027e9a38fed13d",
-	"e38710ceebd6",
-	"0e298aef020cdd9cb9382d54f950d975b35f7807324d064c968cfb973f4d88a9",
-	"28b268e0ce9ee196537ad9145ba51bb7911a21c383f698809b77f0a67fe355611559b223aaff4371d43d1c2f1eb15b4521b409062247a93b9e041089dfa21b1f",
+	"4cf1f2bc5c4181cd0665fdae60d6e144a97e77a291188897de766170d6131503",
+	"277d8ee6a02bfbfc276889c11ed2f5421713d7e61dd5e4dcd7bd080cbabc046e",
 
-	"38cab63ea60e7ccf213d04b3416c795e047f4897cc79968a3a28c2487c8dd51b",
-	"00679269eebba60db4b8c2ef5dade2828d907ec582b8eefb13ea78b770402254",
-	"e9ec0b55184b69",
-	"bd6fa43ba1f3558c945ad97b86a16e46f18689d631832f36655808e0ae9625c4",
-	"b250f5ee957d1fb1627e386947c8c6763797b3dfd818ec4601e169aff00db10ef88e829f7fc668c6f7d301b7c79f7d1feb45089ac4b4b7043185b2374a274815",
+	"aabb07488ff9edd05d6a603b7791b60a16d45093608f1badc0c9cc9a9154f215",
+	"da6a979fc42038aa88d27daf4df743322c4ab176c33ef1b310f5cd69f7f83b3c",
 
-	"a0c852217d57f54af23b22c24663c08dfa39080a4ce479f15b29ca98aa1f7126",
-	"7385259b9b2c90cb454e2a06ca0da0f7a2bd431a341d8df85592613f6519c06b",
-	"89f04c834dc56e08",
-	"15cad315726640f061a87262b030f8013d698829808ca191d29eab06e000d526",
-	"3f699ff1c85c8355e95250a08cfa319ae38c5631a060878fd3feaae1a16c4d3a02d5f9c610306ecfc6be5692c01ae31dc915df2d864343d507093b0c396c3e29",
+	"8d3e0b22c9824647109c1000aef645d43d83b327ef8d86caab540ef295edb33e",
+	"2b2c16261d10532a98d7f88d68d5984b47e787842f158c9b46878c1a64e0bb55",
 
-	"5f2aee1f839af4437708be00dc9fdd4b464f78cce503a2a46b7e49c7f8801e31",
-	"cb6a952d21f8dac3e73719c5a2e25a5c0d25d296baa914a91017d4e2fd607543",
-	"6ffcf67ae37c48bd44",
-	"a3a01a7f31c626a828d91a2ba34453fac4864a1c2418f22d135ac28158e12ab3",
-	"fc4e13e24ca421d18cd2abcac996c5583da63dab668862870e8338c984797d3f3f1e8ffabab56fe7b845d8f635d25f410105286244c288ab63ea73c2d75ba32e",
+	"cd82320c3e9d68b16d40a3aefda68027950f0333bd845b66933d0bfabbec842f",
+	"1e11506f4a8caef900bee6d2d9c80488ea8addedb1bfd663784a18a34615af04",
 
-	"5180783172ddc9a101ea14d267606e7b086b9f199d285b9d963ad74e9c6a6129",
-	"316e6c618476ff7f51315d9d4d7f2ec63099818b5d41fe64f109ad57365fc86b",
-	"b5ec13448a6074acbe72",
+	"d3e72a448061f8c22a68661eef211387cd2851ebab1dc1cf4bff878a13686133",
+	"d4bff10c04cfaa62793adb12318c9630361b4ebc62c17a4586585925f5570d27",
+
+	"9ca015753a43f52834bab8182c96edbd895070a9998371ad3bab311da54c9716",
+	"86ebdf40ca5df688a5534bd88066995f67502f1136818c609e1f92fc810d2f03",
+
+	NULL
+};
+
+/*
+ * KAT do255e ECDH.
+ * Each group of five value is:
+ *   private key
+ *   public peer point (valid)
+ *   secret from ECDH with valid peer point
+ *   public peer point (invalid)
+ *   secret from ECDH with invalid peer point
+ */
+static const char *const KAT_DO255E_ECDH[] = {
+	"ef28a690f4129956e9309b080a4a9314a70f070bf23a4ac5a5c7ceccd79bf713",
+	"1d80ce62a0a2b3916844eee076f0ede0f58c6b1569076c80d931f482af777023",
+	"1958e2c1e90c16bd1ce032d65389acc03ca40e86d7cb7d2c3da4951d8bc1d053",
+	"c72d892b575ba6bf2120d8d376db16a79c8bd835af80661bdcfd4b5149267907",
+	"fac3236e3b3841f2f08274c58ecd704535a285ebbdd7767e1b45d33261083141",
+
+	"c8e5bd9585757ca9e984c08b6d5f04bfeacca23ae70c08d6cf483566460fc22c",
+	"b6544dcc56df2c151507957542bdbdd8cd89f905eeb7f586df21650bd3034928",
+	"c00d4181e7f07693440b531c0c4c0321d11787155cb810955a07d7db6639dc6e",
+	"efa30b7f745011a1c2179bdeb65bf676f6699ed7fac93753483f3a18a7b4e31c",
+	"f8fbf93e12a1340a64e3540c9fd6868f9425c32e4d2dd8e05ed0befd643af586",
+
+	"d65c50065aa45d6184712e758c95e7d73dca997dc5b670354e9be636bd31181a",
+	"31bffbc837e9295be72eb55281c82a258663503b1846e8e65d492c6f78d33718",
+	"4b220af3c0b0c53051fe3f392b7a750ca37bb193dbd8122922f8480cd10de520",
+	"53b0e353877607a0c33d544da0cca0248fa932e9460e42734a25cfc404bd5364",
+	"398c5dab9da224b7064be994198ad14b4b231fce7432fa92e301d9ceafa8ffd6",
+
+	"52fc76c0f047480bfa05b3a5da31ab2c28828cb6b7465209b2635a9fd567b23e",
+	"f6a806c9c087fd2b8af290f83446870447cdb1f9e702f8117da313ef96d97605",
+	"76e190d84232eefcaf6140296b710c22d725176008f3aa7aadde7c54325bdc26",
+	"8dde1bbcfc6a2be8665d07e992c387277638b86aab3f96cd7be78f6eb22da12e",
+	"612d7131f7b769f918544cf187b95b30fb25366d4a3d03895e906319c171acbb",
+
+	"4c0469f97b0245cfead8fbc104ca54d18a917010f50eee1a4fca31e6d0b44d11",
+	"f4254ce377b6bfb57b6b78202d5cec1deb66b00ad7441c691ea5166156de7c7d",
+	"7696af08c6d643d1e1473016a61d50edcdfa7d43cca6d8968a7b00b3a8f2e1ff",
+	"d168edbebd43705c4d03cb3368d0e25aa333553da0637cf5ed7e6f74e6f23c0c",
+	"b0dc53f8f55edd519f4106704e29c676df46f67d48039aa31debb30f0911a464",
+
+	"61f3fa5e5c6aaa53815d2f4458bb55f9dc78dfa0b871bb507551538b7b7aa907",
+	"80772b696144793e55dc706a007aff79c4df1718aafa8bc224ccb993a27d2a7a",
+	"3a2d8c445b2c3905ab81524718801adb0a762e7c17a259427b367ddf92c3d4a0",
+	"de029424e3c3f4fed8e42b36865a645895e2430373dfc5c309f55a130954a42a",
+	"a6b8713d608f63f8afea100db16949071e5e257c4dbfa3ce9327285d12f2204d",
+
+	"9754017a70bd45fbda023f0a315502d394a424e3191368228a6f2e8b62e15818",
+	"8533475f7404f1fc9cb904c61768035293e3787308da15a601aaee3b60f8034e",
+	"f260f1faba57ee8a8bac32a0595696eea9b9ab683c145f9274213d0717d4c108",
+	"4f19f142b0fbd94563629227cd36f047ea7edbf973d540e778227966257c142b",
+	"47560853d57536c2f910d26536d53e2a594432d02994c4a5ee4080273c0e7b21",
+
+	"12604b60bb1bada85a247f47cbbf2a14647ab8828110353fee8180c7feb0f708",
+	"222aaa94d01a6bbeca96eaa5af11b6e350e04a5590c7b2536606d6c363b4f41e",
+	"77f5b1a5f608f96d952439feef5ee7547453e29f04499b123d3944d3e48439e1",
+	"b79607b0cbeb197c8705e2999f255af712ebc583ce819f2bf0e40008f20eb23f",
+	"32fe19e0ee4589f3d9fe0212c9a2ab3b8f61d1067867fb9cfb6b3caf457e12bf",
+
+	"3cfd86fc7dbf092f33a0a3c92022684216c6d10576cd7b3f7f64dbf5d85a6726",
+	"d4c1d69dd7868fc85a37716ef5621b6787a274180f27c9d6e7e3c08908b8d069",
+	"274ca75b281d5fb6f3304fe716123dacf7222d7b9efe6453ac50e83ac145e9e0",
+	"c6511b4cfbe214659a02642c1c0e7893ef73802b21ef39d10a0710c674a79e5d",
+	"23f57d371414d13ff1a516fae7a9db71ea1633efd42c69d7a27f62c997b79803",
+
+	"1db9a064623f90f985e3f66cf8ff46bfffdb64e2fb73c8dc31d62acd362df419",
+	"d6ba5e02dff611438c8a82d01790f257dfa7dc0c576e8ddd27cb1e9075eae008",
+	"d89bdfe6b78549e7abe8e94819ae2eb817cd57d3cf340a3ae962baf777745a66",
+	"bb733ca5f060f156bc08ba9865adf28febc683f14146d91259327750bb49af62",
+	"788ecb175be5a165bfef25a6fd296a059ccc432c354e55afbd92a261605c773a",
+
+	"ca00d92e95336b0bff5db5cc624e6c58b0e259a8ec1b0f3e3df6b92b22751214",
+	"cdc2f220bb4d0ee2839cda1cb2bd4ff3f8f3c0144e5bce7b040a543285016442",
+	"5e6755dd5e3282729ab5255a9f244fb1716ee5f5ed86c3b0c65998fa36d6b770",
+	"9ff0fc35d268faec8ac0facd3c8c07d35ed8e4015cc7a492e7035b1396d7d94b",
+	"38eb314008e1514309fdd940880dbf14bab3dc6b45e6ee6ef72d5eea9cf1e288",
+
+	"b56284ea283943c82b3326e7df3a7743b4cb5ffc8015465f3e5dfa14d1aa0627",
+	"56ff5c7c341845844bac18776aad2eb36e76a2e740800ee5f9fa3e2189acd91c",
+	"b9e5f0b180d56f6a92db793e0a3830cd9ea39f8cf8269f5c644ed47b22d61a3c",
+	"d6f8a731ffd43a2da991fbf88b32cd7beeb77243d8e1d72dd966a17b21e5d657",
+	"0620573ba4423ca1e6466d1dff02cccfd2895b89ff26a7426a1c903cb9970ae9",
+
+	"ea394e65ffed2af6f374ee698cbed8fc13aab0af934a1b67b15ed7c6caf1a721",
+	"e80856ed01be82403a378cf21f91eab1de8dea8b9fc2ed7da8916d2166add716",
+	"3e98515fe823f348975cb5d3b58679d68efa0a3c063e5909b97b0ba4abdcf496",
+	"373520a86245d80d6807cb1af60b912f1a4d3e277c7c05d60276484f76353c2d",
+	"889ce022eebfd41a508e4acf21346698f35bfba35d5d284e00467d6610e586dc",
+
+	"395446b0114c7c2f5fdf9c84b445738b4b6af5b421610a6234f151f58999aa16",
+	"efb29c8aaa0701a1c71ec9077571bb6d97a21c8dbb580714d655c3aa50943b72",
+	"5473acad9ee583c23912093e553db4a31b45a539333825bb81b878d6844b5a56",
+	"0b49ed1ee6809c76e3b342fd54ee375e1a54cf297d179d590dc6927ce31f5c67",
+	"caceca76026bd4f8553b261b2eb7e40f96785de03df5b3a263b152d7894b590d",
+
+	"093b4502c12f43f1d68888211a083efc7e551146f7385fe0e0203c3a87b6f902",
+	"2204f8dee58e75732662dc0fd8ae5c9aacd9c288e8520431ff34bfd229a0b856",
+	"681eab3e0f73552bbcffe9e8acb22b8446e65447818be1c022a0e9d7f719e16b",
+	"2461e08ebafc979aca3af695553fb1f510bc96bbcca1c409226ee642a301c112",
+	"065e2afb921b257909e17cf7a9df7ab803a491d80315688aa94ef3b2d8e9fbaf",
+
+	"296e9c430cf963e46fc2de1e48709a9f535e7e54184741598689b082f2fb712f",
+	"e09b38d065ee00bebed7613ebc77392b54d72c1c59ac13975561bf00ae62be5c",
+	"812047baacb81e4840bdf7c5fec3c0107fb2879eba441fda416736258e95d2bb",
+	"42548ab4526e5176aff6631263881f57144329b132622b2ed0ecc49d1491f36f",
+	"51d7cc6309ce07eeb509bef43a290364f2a285c0e8b99792a8711c40211c5a77",
+
+	"d550a88023a96a010b7f0b7a93be2fa67bdb72cc2ef8a1addd9c27d1464fd211",
+	"ab4e38805ce3870142e9327fb63fa51ea3ed9110f028bb225f4806fe34e3b165",
+	"47a4065fbd3beb39477675449febeb0833736dd0585957019446b6b6f4d38003",
+	"ffbf316c28bc263ea9e7ec7f19ab66ffdac6e751f4b9d5b59173c953c2f06f3d",
+	"b89d3a6a00953f1586e1176254adc1dd098070b8e05eb54e3ccfcf9cfa17c2d9",
+
+	"738b0034bcb054c33bde8b804a14c55e9035bd917cf09085133788835cbbb326",
+	"d1c9fc36def70c49c4388050dbf568319a873bd86a5e17697064999015ef6e21",
+	"28ae15ca72336e4fcd1bd5ad809abd7d4a7fa7c6a94356df2a199308a0c59746",
+	"6c299b2954771e58e67cb03585e481c00a5a76bad24dcd34cfe988df8361d675",
+	"4299fb5f1f0e1b9f3b02b0ae44eeb9e62275210257bbef944cb2aad78973236c",
+
+	"303b84fec8756acdfc55d108800ed5c78795a79bfc718fc47cee55b1b2d1741d",
+	"92a8956299d060f6bb3a1ae456d4e27a16054130460efefe3827a624a83e9a05",
+	"3d7d64b38c30375ccc7b7252b432766e84b738e6ee40b48d722a94c47d85c246",
+	"b3587506e4711f45e1f9de2355e1dd4ca403d892907ca3505ac842049556dc2e",
+	"09ec0b7c6fb336f28d8b983dcfce94d0043e8090f1b74660c0b657a873d694b9",
+
+	"95c863ec9ebdf963536500f4610964b96941d25e47f3098f5c6fd82704836703",
+	"8129d1f4e3d8e63bcca497ba0fa234b6d915fb052dd6d75f7febaa1b0f31e80b",
+	"64af14c411a4b660b3572382496a1b762fe5db9f049614aecfb80325d4ab0405",
+	"2cb6327b08618354aaef4ed354c90875569277ee6ef8cc5e3eeae8e2091e1f22",
+	"b8366704521d00c86b2cceab783b73135ab1bd80aa568aebfd3f24f073d80a75",
+
+	NULL
+};
+
+/*
+ * KAT do255e signature.
+ * Each group of five value is:
+ *   private key
+ *   public key
+ *   seed (can be empty!)
+ *   data (SHA3-256 of "sample X" with X = 0, 1,...)
+ *   signature
+ */
+static const char *const KAT_DO255E_SIGN[] = {
+	"e7fefa881bd07b1c363b68a0f9e01ee04439f4aec941f402ae7be67993bcdf36",
+	"4b383536c514fdd88fadd4699bb00f57cb16af174d086e65a291cb35957ee25f",
+	"",
+	"9eb7ccdd65cfb6e02f99210264c6424c911ab8890fcd93f064399d747b503ecf",
+	"02df67f802428c4842a9337006f99bbe366e9d45330ebe59775fe233e24a1b471b450b81d63c76dfbf24b65dad69dcf19471a49346ae4e4239bc7846246bad29",
+
+	"dd97542958b1929860ce00bbf16e70b96f585bdb40fe1c689c45089a25d2a33a",
+	"2b2eaafa51faff7bb254388efe931a45efcccc9a18e0d2f22009ffac4a67dd33",
+	"f6",
+	"45515ea2aec5e64eab4ca100c26b030447c07b66a9fb6f532cba12e1f62ae627",
+	"88bee51daef88d0122eefed288068e481d8600845232426c78833a2d3e2fb80d0d78997bedc3040667e65e37b6a73358a6b8be292c906dc924c0d87a1cf47c0c",
+
+	"d621461ed0119fef78d82658d56db9a81e9de2a7dba43213941b150146cdd023",
+	"82f078e1d7d4c27b87b44e94a5d65d10defa34b6c6187cdf27b6ba1cd0c8a416",
+	"54e0",
+	"61954339a2d5ff28e0d496af0716d757891010625c8859cf2ffde8fc75f3e74d",
+	"aa362ed028a877b0e66c24ddfe04adff7168cafb6916e425f5997fe209de2e397eeed6838c1b2f37770612c2d816d1ee4b6dd72859131b92322ed6539403d035",
+
+	"f1d2e620bdc765a7cca0da13c0181b15974d5ee3de8b66da9824b47706e8a90d",
+	"245f4b6febec6d65a18dc721b92234b60f8cdd5cd6ec4bf379e2dbf1c4b3b960",
+	"e2a81f",
+	"e1bc41167127f1944e47d6c3e9775ea31919040ede6f1843baf1a039a363467e",
+	"baa56a21d8d424da430e4b559faf3ce3d5c4a3500059ae91bd77b9c731b2a31657ca7fc36839b77045bedc022d17ebce315228dd7706225d3240cced47b0f21b",
+
+	"7bf1ed60ed68b9ab68cd108f59ccf8c5244b3c67196ed682cdbdba199f2da826",
+	"8d19cf9e1a466c45b25783295a5d7faa9c87aeebb66c3587b0a545c434c50062",
+	"24e5f829",
+	"68b268348810d58120705fe0ac3faaa11218c81f6560541891772c58305d3f6e",
+	"f9dea4b04fdd1abcf5f363ac3baf8f9893c725ec7267257c7148fe6d9add5226d2ae40338d9b16826ce237b73f102271a5d3fc4c4d99b59824e4f90366ec1a38",
+
+	"6a2c113c429adda15575b0df0e25423dcff7d999119e0259939fe13528976128",
+	"242cc70b5bd1710e449864474cace3934da479971a462292ddfc86017533996c",
+	"1d657c0787",
+	"91cc12bdabea62f2fad09995b2177f3d01011d2b52fa51219d961e8801cf9b84",
+	"afbf38a01391aabc062969fc90ae24844a05040804c254ab59c9e9ee4f27603a8702bfe8730c538ab1436e63b54dc73e1ea4826093a413b1940fd224de617507",
+
+	"fdcb0a1f06aa24e5dfc01cd078e70509867d604275a1ac888cfccf45f4b4043e",
+	"e84854f98bbed4bfc5cbb341ea31d74087818fb522828f0bc02300a9a3d84009",
+	"5095bc20dffd",
+	"0e298aef020cdd9cb9382d54f950d975b35f7807324d064c968cfb973f4d88a9",
+	"5faef8cbc141c974bcb72a2174025730ba2cad3425e94302ab846c9b65ce935a6e8dfee1acfad9839506d6bbe7efc38b55e9bd8da0c591e9b206caaf4759f028",
+
+	"e6f1ae77baf9b052eae31cae22ee3733fb976840f4b6ae4ad08188f00299f524",
+	"2001c1321ef199a346ed03e826d93ea8d625a7aeb2e068abca08039409cd8c3b",
+	"318a89d0101549",
+	"bd6fa43ba1f3558c945ad97b86a16e46f18689d631832f36655808e0ae9625c4",
+	"938102026e490a693d99f80c4385920006e6fb02a6fc751c3674fd739531e312aebf70726ee8454381d003310e7b3ea6010916283f7a54bf3ea8546558523709",
+
+	"155e454cb96e895531ade93353db7b117fc99e6c4f5d3a7d66276e7f6230a42f",
+	"1b758dfe2ac44b162db76c8763f0b942eb26dde011e6b69e5efdcbdbda5e9549",
+	"b8000b24b6cad595",
+	"15cad315726640f061a87262b030f8013d698829808ca191d29eab06e000d526",
+	"c42e60dbaf1cc00342561dcbed70cc94bd80d37e261863721793682cab9e3502d94db97e792c2da4b0f3a386b8951b1f86dbda8371c1523dd67ca5c7ab5e101b",
+
+	"4f73e0da62d285b6cb935de905cc86c5eb1172ce592b5a3f1b06329381db5e05",
+	"42e38f43a66885ac8d5b55b096e1f2fbdac68c0cd734c95643cbbb1fc00a2e3c",
+	"c37daa05a878983373",
+	"a3a01a7f31c626a828d91a2ba34453fac4864a1c2418f22d135ac28158e12ab3",
+	"75a0ae260f2fa0a64cd558a4adc7d3df092880201435d0181655453d3f6f715a57f9814be5265f9e087d47eef3b6cbe793cea5d090704161c5286df0cbec2e19",
+
+	"ca209856bb248fccd018843b0b10e9fe1cb294a9213d78254a86a23ee5a79106",
+	"7f8cb0ca92e9f8d0f1c9630833e6e28cfda0cb97d4728b1d28009abab545c234",
+	"8b2bf5bec449e73da381",
 	"3e2b0342ad12868adf498fc2a3c7bf168d115a3ca37fcb475541ead259f20c9a",
-	"3fda8fcb7d32f98ecc7f7e1ed218bca9005774260e9db9ec7f26c0b9bef7dd0a1924bdca462df14986e740e8fb6fb498efb55765dc8de83eac6fb8cd9c8bed02",
+	"1699138979a0d5900446a16b31d7c3e30d438fbf482a6b026191f1fe11c37a7deb4033c7581705572a48b170d4e8c9ebbd3883f62f5bc5028bbc8b479e93501e",
 
-	"6bfbb1a80603bb69eb67e30ec92a9643009223ae066317cd580763c74a5fee06",
-	"e5625e553805421578ba2ee5399a5e6665ab343a67d0915cd4f789d22ee07652",
-	"af57e5cd20151b84cb9b50",
+	"9c5511323d7c143272ad5bbffb91a6af2f2be9a9d7a72643df3a7a790c944724",
+	"6d76fe597859b316bec4f4c6a10403d84b8fd8797106ce8853a15e7a78318129",
+	"4f3f552712d3c7ff7bb212",
 	"8947bdb1b77d2117bc43d4933b89d835c28b0f5e228a2993f53711f0d6067499",
-	"d7c5d21aa9fcd5632c5c5e79accdb1002e9930615f9d1f07c5f443f82ebed07a052060c8aa6b367bf9a4fda0b2cf2b488372ff57b9b4c6c48ade2d9dfbd9d024",
+	"17330ef2c47365191905fa1ad9343b289340d62c44c94de0e1070dfc406fc335f12e800f4dc2600f18c61d9fa5cdb49f9af34a472d61720d346d402d9f2c6314",
 
-	"cebef0642b7dddf73345d784b85018b8c1f26b4fb9f1bfbb717bfc153e82c60f",
-	"bda06c4aa5091c2bc2b7d81bf6962935f1e16fa4858bfe0bdd36ceaca8553200",
-	"df6d2a11e996f8622c06c698",
+	"4760c2b72a73b22cae763ce3903369fca15ab3fc3394aca4955e071213313820",
+	"13d8e61e4a811bed22aec12fc4eb5176e05257c9e0ca62a75dedeb31b7d4832d",
+	"867d02c2829dc1a05a553943",
 	"ee4d9fd7516a121d065a71ba92bc70177ed7b12e1f62506d8f79127d790518c7",
-	"ecc43c40ab39fbdaac1217d8407b540fcd41af0179ac06b595afaf1602ee1f564d9501f96e000ee249728df187dc8c3143e30f4d2967be37ebde283889f54939",
+	"a19560523ee01ad590ef3e6415713c3c0e7995cc2507de210e4ac4d20151a961a72c7ff988fe26ef7853780d6c87af552c22f61cfe0d083ce5d15a476484bd31",
 
-	"d163603878563d7a36f840d22c7a850363a6e8b094e471f60f7bfdc75da18e0a",
-	"0721d84e87361db69031bf970e8bd5f3ae9d86c751b59417ee7139230f88da43",
-	"fd6326d2da4c6683622d212e37",
+	"6efd6cf3bc41af751a47a7a568c43fe05538c9bf4a4b56b92c87e384c369f701",
+	"c790dfcf644d53bdb5c067df4a2d61e4d031d0422cdc6eae9e3a79572723a957",
+	"9210040ba76b0d31aabbe1b79a",
 	"1e713421d1a44b6ef1944e973d17764e44f580b91c53b9e11f4a1dc2783b435a",
-	"0262368df64a673dcbdf5ba3791a1068e941e482d7d5aa06bdfa75847a4b5e2ed4b005878774c8884822bc8cd9f19d9f55a6aafb2f2b44899dd1c80e3e57bc0d",
+	"6af33b5c8943e7e531a8fadb9a2a2da527f1219d6dcf9d56691dcccf505a4401f8e71e6710a5298005174c38e199782c7a26462219ab37fe0fb5919b1d5c8100",
 
-	"93ae6d9673f5c48e26b37047d79c95bb1fe9aa1b496b5aaa1eb49eca880f2339",
-	"7151af8a2e5cdaf205eb64172e88b23c257c73b0c1826a09ef5f02af37955118",
-	"4f5b169cd6ae70f1490291708205",
+	"9753da22261a95cdb29a35b2a53286ef3e091799fe88b80df7f081a05fbf8321",
+	"cf8b7f0b66aad2ef6c53633c42f621406dd9c24ba97161a2efd451ed1422ae08",
+	"4da18d848fa826de260ddc0c9cf6",
 	"8584de70ef2a343366c334bc11b8d9e837ba63833dbb619127075bdb906ac403",
-	"41c78cf12f0c1fe16ab9d180d086d2faee58607fc891ab8132e641cefc9ea25e4e340928d90259419a08a9ebfa789ceff91bd86caf49d3875e83573a631fe226",
+	"d9da40776f84ffbbdc0dd6dc765ffa3495e03502b5c628ee5a2f1d3ade7e2003cf43be376783a1fa6bf83644945f8036e08ab8c760fd78a456faa8794f77783a",
 
-	"3b70f2cc6d753938d23ecdfab9621db34d1b606ddaafef479bdc0cf5fda83a18",
-	"e73f4c27bfe24e2fda57ad76aab76554dc9f410589e78c93f4d152b5c4438807",
-	"1ca32967015de8ec8276e1408ff3ce",
-	"018571598ecb3dc0b96a693a85de4927aba6e64ba6be14ffc9e9ff65896bc3dd",
+	"c87f825b563e86217e6eee2ed660982c7c9239c6cd90d011dc4a46fbba94e914",
+	"bdd7e46cbba76e666be2a551564d449d3b3d10a480550c8a34c40ce696c82612",
+	"338df4d100a8f105c7bc47ae7146cb",
+	"018571598ecb3dc0b96a693a85de4927aba6e64ba6be14ffc9e9ff65896bc3dd",
+	"79b67f4eef3383e68d53c63c76c185d87adec18f034ec476f416a12f5100a9050b059077f179902c0d8756e04e361f80a78b4596610f74d88fff7f7c58ccce0f",
+
+	"d0cd7614980205ffdeb4cf87b81135d04a3975188ad1967b57f1a7b87d212a2a",
+	"e7bedad9a67f17050b95d18978d1966cfc00300f39f4c9a706f7a1505e15ee34",
+	"08495927e9336209338bf36dcf3aaa4e",
+	"c02b87d23b05e56f0f7b96500368a41c23e83c5b0603642e5de35f4cda0d9b89",
+	"d8effddf72c876db57beb1bc82b2e0feccd711bf5cc7384a92f2b9f2a987443744395abd62a55816333654cf1567a65d787da41444f80202d837dbce2c0d3805",
+
+	"81db954da4ae7a5e0379a974094e64e6e23ff33e610de5e950d865f510adf325",
+	"faf0d180629d98acbc28069304f932729689d72f72d4236b3fbbf189cf81141c",
+	"fb52854932e67673d964ad8faad81bf1f9",
+	"4739c6afd6c5b3f1f58efe807bb068940bdc6725057661660442af88f9050aa8",
+	"6f2e0c0859922f76013ddd0830201723fb99cc58152edb121251e2a9c91c2b312bad2e2bbbe79ebb35b4b060843535b96cbe8a031a6eca6035e86706bebd1a16",
+
+	"7f3365a6ac0fb684333b7d709b121369cd9a5cc6c191ee1df8cb40bda2635220",
+	"9e07d0e40289c1c708f4d3f0bb3ee2fddafee94cf5bf3a441412edbc4a1e1c44",
+	"da1eebfdebeb0b6e5c8999e3fbefd29d622a",
+	"f8ec137d474d2fa4eebdd1f4acaa713743f0315f9480affad04af23ff7e4af4d",
+	"cff66066d447a4d876590cfb0b02d1b553a7d942e6bbd65de3fdecf7ba6f2204861a5f4b112fc48cd0ff2f10ac987fbc2e2361c68da48f2cb3d4a05ec380561f",
+
+	"3ea73a6a9e94de49026fa6c9385aed5a95b31643c0bc436e71ec15b55c7a6036",
+	"78f4da98c85c33699114e047fcbb6d3cac9012bafe039e562356b1cae58bb53c",
+	"e6efaa60b93f0c579dd6bd2f7bc6a60e4e9baa",
+	"9403502de9faadba9fca6c0737f0f93058bcde07c7c0165714ace3084fb44086",
+	"8dcb51309953408d891bd3a402dfb0dfced54130aabe5b490ad41614106d4c4aad6adb92ccc83a0fa95bdafd6084cf58b3d327525a80ca041a39e47bec759d01",
+
+	NULL
+};
+
+static void
+test_do255e_keygen(void)
+{
+	const char *const *s;
+	int i;
+
+	printf("Test do255e keygen: ");
+	fflush(stdout);
+
+	for (s = KAT_DO255E_KEYGEN, i = 0; *s != NULL; i ++) {
+		do255e_private_key sk, ref_sk;
+		do255e_public_key pk, ref_pk;
+		shake_context sc;
+		uint8_t x;
+
+		HEXTOBIN(ref_sk.b, *s ++);
+		HEXTOBIN(ref_pk.b, *s ++);
+		x = (uint8_t)i;
+		shake_init(&sc, 256);
+		shake_inject(&sc, &x, 1);
+		shake_flip(&sc);
+		do255e_keygen(&sc, &sk, NULL);
+		check_equals(sk.b, ref_sk.b, 32, "KAT keygen sk 1");
+		memset(sk.b, 0, sizeof sk.b);
+		shake_init(&sc, 256);
+		shake_inject(&sc, &x, 1);
+		shake_flip(&sc);
+		do255e_keygen(&sc, &sk, &pk);
+		check_equals(sk.b, ref_sk.b, 32, "KAT keygen sk 2");
+		check_equals(pk.b, ref_pk.b, 32, "KAT keygen pk 1");
+		memset(pk.b, 32, sizeof pk.b);
+		do255e_make_public(&pk, &sk);
+		check_equals(pk.b, ref_pk.b, 32, "KAT keygen pk 2");
+
+		printf(".");
+		fflush(stdout);
+	}
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255e_ecdh(void)
+{
+	const char *const *s;
+
+	printf("Test do255e ECDH: ");
+	fflush(stdout);
+
+	s = KAT_DO255E_ECDH;
+	while (*s != NULL) {
+		do255e_private_key sk;
+		do255e_public_key pk1, pk2, pk_self;
+		uint8_t sec1[32], sec2[32], tmp[32];
+
+		HEXTOBIN(sk.b, *s ++);
+		HEXTOBIN(pk1.b, *s ++);
+		HEXTOBIN(sec1, *s ++);
+		HEXTOBIN(pk2.b, *s ++);
+		HEXTOBIN(sec2, *s ++);
+		do255e_make_public(&pk_self, &sk);
+		if (!do255e_key_exchange(tmp, 32, &sk, &pk_self, &pk1)) {
+			fprintf(stderr, "ECDH failed\n");
+			exit(EXIT_FAILURE);
+		}
+		check_equals(tmp, sec1, 32, "KAT ECDH 1");
+		if (do255e_key_exchange(tmp, 32, &sk, &pk_self, &pk2)) {
+			fprintf(stderr, "ECDH should have failed\n");
+			exit(EXIT_FAILURE);
+		}
+		check_equals(tmp, sec2, 32, "KAT ECDH 2");
+
+		printf(".");
+		fflush(stdout);
+	}
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255e_sign(void)
+{
+	const char *const *s;
+
+	printf("Test do255e sign: ");
+	fflush(stdout);
+
+	s = KAT_DO255E_SIGN;
+	while (*s != NULL) {
+		do255e_private_key sk;
+		do255e_public_key pk, pk_ref;
+		do255e_expanded_public_key epk;
+		do255e_signature sig, sig_ref;
+		uint8_t seed[32], data[32];
+		size_t seed_len;
+
+		HEXTOBIN(sk.b, *s ++);
+		HEXTOBIN(pk_ref.b, *s ++);
+		seed_len = hextobin(seed, sizeof seed, *s ++);
+		HEXTOBIN(data, *s ++);
+		HEXTOBIN(sig_ref.b, *s ++);
+		do255e_make_public(&pk, &sk);
+		check_equals(pk.b, pk_ref.b, 32, "KAT sign pk");
+		do255e_sign(&sig, &sk, &pk, DO255_OID_SHA3_256,
+			data, 32, seed, seed_len);
+		check_equals(sig.b, sig_ref.b, 64, "KAT sign sig");
+		if (!do255e_verify_vartime(&sig, &pk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify 1");
+			exit(EXIT_FAILURE);
+		}
+		data[0] ^= 0x01;
+		if (do255e_verify_vartime(&sig, &pk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify 2");
+			exit(EXIT_FAILURE);
+		}
+		if (!do255e_expand_public_key(&epk, &pk)) {
+			fprintf(stderr, "KAT sign expand\n");
+			exit(EXIT_FAILURE);
+		}
+		if (do255e_verify_vartime_expanded(&sig, &epk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify expanded 2");
+			exit(EXIT_FAILURE);
+		}
+		data[0] ^= 0x01;
+		if (!do255e_verify_vartime_expanded(&sig, &epk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify expanded 1");
+			exit(EXIT_FAILURE);
+		}
+		memset(pk.b, 0, sizeof pk.b);
+		if (do255e_expand_public_key(&epk, &pk)
+			|| do255e_verify_vartime_expanded(&sig, &epk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify expanded 3");
+			exit(EXIT_FAILURE);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+/*
+ * KAT do255s keygen.
+ * For i in 0..19, keygen with SHAKE256((byte)i) as source.
+ */
+static const char *const KAT_DO255S_KEYGEN[] = {
+	"f17dbcbef04a157b7e470b6563940017e5de0bbf30042ef0a86e36f4b8600d14",
+	"07e4009d918a6c56f5a65896a8720ae26d4beeefcf67acd236886ca5475a1219",
+
+	"0635a00de8e704b122b478bd1a0663a777153d5b748baf796190856803d9773a",
+	"a6b4f6eff4a248044f7421d32c85ec7dec6677afc90df497beadd489f104f729",
+
+	"c22008517d59517518530122a42f14099a9b5b7d7cb4adb2ca59716b5eacf811",
+	"26b85f600b2f03b027024bb5156f16c6a39f72eb34c9133c3b50c14050218979",
+
+	"db4252337900d8ab7f609d170135d459a6798945d5a574d4a9db7b623c754d07",
+	"dc450fc99fe87dbec0f5f31edb85eb133ec9cbe6598481a09d2fb9bd92f48057",
+
+	"87f1eb67b2f70780ff554843c8bd2980540cf15ed1d23499d013359759ef5927",
+	"41492f6a1150193c44abae47ed6b164e27d808c10ac6d98c3d3ac6d87b7ca607",
+
+	"fda04889dca632c34e1fb3d9939057ff557816bd83143f2397703f794ba3e130",
+	"ef070d9bbff46988e6899511ebe3b532afb8caab3aa7a3bfe7280c23764a2559",
+
+	"bea6f1eb5e8e3d50f605bb614f706d1e0826071c3f4223cc321ba4cd0aec6502",
+	"0211f9839282ba0d86761aafb129e2c76da9312c492210aa96fe7d841b302c3e",
+
+	"6312bea16eac7bdf93d5d2299aa8c9a248aa2571ae69543fa6a7a837532d0632",
+	"8680740b543c20ce1dd3d2bc4950258cdad26b53a904fe531397e5e25e5aaf53",
+
+	"c0391dac03aa88c968c365a0742643cab88ca34a127e1c9f5d71d9ecb3afd423",
+	"e12f617a9656751a45db6f00746e90eb56e7b31933bf1afd3a4fa554ab31695f",
+
+	"4266dfe30012338515c44c70764d7aac247f97e4f7913713a80cb2630b646935",
+	"665bc6df189d53fc4d59d3b5e8cf45349ab7ae15f1ad1b0aa2705feef4741129",
+
+	"7e01e5d06f93257b18e60da64307ad3457a5b711d99cda07ff14042c4d8b833a",
+	"2e608d5fe618f81088d25e06d561f89ca90679c27673053d334a53dfee00817d",
+
+	"6150b3748ba9bac015d100718850b5530073659eededed0b7e6f6ebb886d392d",
+	"924e4fef4a4c467a01c0631ad3f3b2127e48ac4102eb806af3dee20b0ef2fd17",
+
+	"a597ac8b40b108940feb5c6325590931981e40b1c4d1d69210f9f802e85fda1f",
+	"27fceec7ac050d8353143392e2d63c38203fa1233af5ec37e8296639e0ba6770",
+
+	"9fa0822c27259906d052b2f8ba7ef8a318d92cff32063a1d3985f140fa2cfb2f",
+	"a23666c90f966c199ab0727a274abf39f4921d2f5df2d264da73a80856f4ef33",
+
+	"66c8576f3896a194f48c91f71e8c999ba77e77a291188897de766170d6131503",
+	"4675d07601fabed44c2835dd417efa263655c6fd0aca3fdfdf2dfc316240ef07",
+
+	"aabb07488ff9edd05d6a603b7791b60a16d45093608f1badc0c9cc9a9154f215",
+	"3ecbb71ee68ca84fbedd6167c48265aeee3df84dcf526b4042f52248649c0912",
+
+	"a71570d4a4d7660efec3a4486cacfd2a3c83b327ef8d86caab540ef295edb33e",
+	"05fbd65bf8cfc86403ef17f896c4396bb6aa3bcf9048c67330041a850ae7c119",
+
+	"2b75a94787b9c8f3bc4d7f7192e3bd99940f0333bd845b66933d0bfabbec842f",
+	"443294a320d54e81c54cd32d7f5b68eaee96331515887e19253cb897996c4260",
+
+	"edbe8ff65bb6188a1890fa66add7caddcb2851ebab1dc1cf4bff878a13686133",
+	"8f35d1a21a173ca61247229a6e16a98e77b37a4d52f7a0baa2e482ad3691b255",
+
+	"fa928cb0835f556b83c794dbc0d22a30895070a9998371ad3bab311da54c9716",
+	"a45d4fae9b1c3f0d553b2b181bd6f3f2362d59898b99b83fab2d0d5aa90d655d",
+
+	NULL
+};
+
+/*
+ * KAT do255s ECDH.
+ * Each group of five value is:
+ *   private key
+ *   public peer point (valid)
+ *   secret from ECDH with valid peer point
+ *   public peer point (invalid)
+ *   secret from ECDH with invalid peer point
+ */
+static const char *const KAT_DO255S_ECDH[] = {
+	"0b60d9af0d907ad367c24916a2a5a7304d91627c062995a4247952fb90a67e07",
+	"d642ebc9d2c25d04dd4f5a2b2fec9bb113c4a5e7cf18f133012a9ecc0c34805d",
+	"496dc32968fa89024ccbbfa52a0fee974e5046dfdc61ea8b4c818e73e3bddf25",
+	"76c6b5d3de8130ff877421680d399121e3940cb0de15f32b85ed660beeca5b05",
+	"af8aa84ca1a92b5a493c09e10d015915659d53ee17eacaf30bcc6eef031c3a5c",
+
+	"8f95a611095c4ef62bbff5655ef9709ec282624bcfcef0c6c397d2017e8c682b",
+	"a80f03420c7a1f97f53e3ee1f7b250510870b47c05697aec5d0c6a78e5f38651",
+	"5976a88675c86548925f463d02ca025199bae4b2b8eb543e60ba613f43650fd9",
+	"bdbedc86551dac2f4e5aedd8dedd23f737bfecafc4d3ccef98c12434486acd21",
+	"4edbf4dceef3fab819d65e748a8bac665d9a92e25d85678fd882186a7c5531ae",
+
+	"5c1ddcb969ceff6d08376f37620e8db26d547988a9711bc0ceb81aecb287510e",
+	"9be0a372230295c530ac8f1068b51798bb71e09db69a29e9bc6f24aca87c7313",
+	"7727be9d3e2a49a12218501dd2f15f8133460e870d322f6793a5b037febd96ea",
+	"23d40935d51eea778bbe72645278f0a738f33aee6b089a7a94c3426c519b893a",
+	"db0b45c097684f8bbae4515a0b58aa4e1e42a5f0d883fedb758f6efb68e6581f",
+
+	"58eb59334187c7b1177b19734e412115d8a83b87744d6f1c646f002d2fd56d2a",
+	"3a52a1735586f1ae3f7bc97c3e04d342b861755874e92191191b03ae20ae9a3f",
+	"02f70f575c05cc8f195c62f5c9371609f116c50aeddcfa037af678c3b032d7d4",
+	"15483dea69a547c3a6ddbcb81e3374145344e64e38918ff40b3e0e8df5f78f0f",
+	"55a7c3a1146e07ae19fab223e3d909672ac24e6c7949beadf6ee96493a7a6206",
+
+	"6d206c6ef982d5de8b6142bf3d4e7a95dcb4e3db20a0cfd8fba72a5afe956531",
+	"dd6e99b75e6b83422ce683f5a4081de22926767d3e34c21f51b4b88925256663",
+	"7762e2dd5b5aed06ee17675931cc9540e9a917489e1ba05c82ca691e493f1f23",
+	"a8b7403e0618b033ef62139deea274bbb7c7d455de8646bffd9f4a1ab3e3ba11",
+	"389814e5e5c1479a8d7e7db177ee5b50029ab90ffe51e9f0c98685934c09a844",
+
+	"e9cdb07c36fe154b43433e593f6f96cb2bd4352f66d530fb54b6401cdcb1942f",
+	"15fbedede4fe2a5b48d74ed6bb44fbe85efc7da2648064d5e6e8c1c436de866e",
+	"9279a6f3c4a6fcfe2be8de9ae27b7f4ef315cd360cad44e4def29b2e69aba62c",
+	"a888375439a860c2f5f4b5e21366d7b27afd47c8e3c02f4577aa459c3db6a455",
+	"3b9f382ebfbc5734f082867ebbacadea5e80e611b53400fce10312d657a73a74",
+
+	"4a90bd7b42af4bddd61339010b58a87887990fd63883fb30825d15442f84de09",
+	"b3d3629f8ebb06c6495c5e43da2dda4d70411e9b4dd2c5d547c1f71f4aa39b45",
+	"eadc84acb8c474582062c9e028e35b06a027e19850dfbd6e5361dc02abb5f7a6",
+	"5d54defb01469867de1586693abca766725a7614c0efaf3abd3971a365ee062f",
+	"044ca8c19987d9e6147e70d2da59a55be892dc23e57e9b494cb01d4ede14ece5",
+
+	"bedf5af3c0cacde96ec1774eddc4572bbd598fa53b9d8e91710260d67a4f782e",
+	"a53dca0723c4fd22e8bc2ea0667a79658dad95c32b64f09b5fb5013e4e07391a",
+	"4f0453d61d07dac237b44b6847408fc9757a8e6475b37d3275fdfcf740b34169",
+	"5316bafd1104ea456a817c1a6967f2e3ad50257aad97ce4323090ab4809a7827",
+	"5a2965d2e6cb6540c56d2e9a9e18a7f8b1f4ae904ca26b65cb228137c7c9ec16",
+
+	"2a6fbfc17da763851cec7006abaee6a5890077891912801d6e7654cf4da0353b",
+	"a7ee66e44141aec2ba0b01801db5785b686de1a1a1254f8ebc3de3c2505c730c",
+	"64636087be0e692c209f302430febc61447436ebbd1b3bd92a1e89e971a07cc8",
+	"8747b9b81a5152a075dfd12d6ccdb987cff6d069dd528fb895e5abdb9ca67526",
+	"6568ce09e4f0390b060a2c8735d4137da14d46b39740b1ad503419b3e74a16fc",
+
+	"978fe1674bb4875a12de35acdd4fa5bc703154f401e120c9c93f6a65f9015c28",
+	"974a59c33edcf045159d8a8bcc4ea0dc8fad2ac8db0d2a6ebebcac8e503b7276",
+	"dcab715ecccaf190a1d4bbca320908883c143df8c45055f32f83057b109938dc",
+	"0d3c17ce3c7b8cb19d73a868e66892572688abd9ecd7c19b725efd3aa0138216",
+	"119bb167339e0202cc240650e4e456b607cc19c54ce449e9d27047da7bde779f",
+
+	"c888bb347d7a05609ba08dec3245db1af77dee4d854e07c0da9e20cee358473a",
+	"faa6f8374e37d0d431f25b2b5249cfbad8b472b6aa931eac85ee3ac005326832",
+	"ee942c37d828c77ad8cbd89effa1993628d336aca02b981f9df05b6e087537c8",
+	"0b3aa099e0bca5abc5bd6736dcf6de294406e8e86f0af1e76db469fced569e26",
+	"64cab2da182bf86382f4016fc902f5f9f79afffe20a0849a3597b86dc8eb13c2",
+
+	"20074bd97f8f2d40ac4e1811bbf3405be9bc900cd7ac662b64f48d97f324bd1e",
+	"8c1f8896cc56dfda73317b21403ba1ee38a9823230565fbe5706cb9d23a87f5d",
+	"db25cdcd75c919ee5d10d1e9420061ebf4ea4e83a6dda8531c7ad63532981d41",
+	"540910e3bb076075da39700f6b72cdc6c611a315ff0402a1471218a18e46991d",
+	"79a4c3b6f27046ab7d7495dab1f1ee95b9da22e4660a1bb8555a9c7da6a9d760",
+
+	"71fe7be0cefac677f315e53d9bbb5a317ee024ae8c82ea904aa7d5496dcd3a11",
+	"f68bd5940810a1c3c85b50ac2b656eab983f0507bccedae3329adfc4876a7565",
+	"ccf688fc2d007e78bc9f34ffb928839d6c60f6184cfc2307100c891439f4cd57",
+	"865f2cf34ea2ee326d42b62d7868b9a12dbcb2b26858c333ea978df37b5d2870",
+	"a33f09bef70a295702bfbfd992cea1fc31038667c2accc8b3873fd72ac143255",
+
+	"c179c485ff5cb0537268906d66f36a25fb11b551662b799d761a4a9097f2fc32",
+	"68bef03de98f175a15121a01234c6084882008eebab1c6cf95576724faa8e27c",
+	"5ce14f7915ba47a14377c1bed66c79b4640cd0a243aa3b1748dd756a8fb68b55",
+	"31596598561f475e5379c15129b1c9f833c831a376e4b639bb57ed77f7faa126",
+	"6bcc12eee8e88b3ad3878e089bd07dd803256358ca71951cece61d65e62b3aa9",
+
+	"6abe395062e48c5a4ff278c5aedfdca9a80ebe474ea5eb88849468802a58b83b",
+	"b49af1e1ec15880fb7c5a0e5f97538a86130058f58758af5fb6d0272bf8f0237",
+	"05145ccd3dbe28e76dfb7b48072c82a379e36fef1720d7343d257f488eb7a50e",
+	"b355f9c90587debc900a7498491736785ec79c97de7b4b8ddcc3f9cfc8cc3f34",
+	"4793c316b9ec1fc75fd9d83c9a050ace3b79940d2622208957c3ad8480f006e9",
+
+	"6446de55796eb238e30fadff35977e2d62de45ce5a27c794017ed9790c869101",
+	"2a0cdf633153be7cda181aa8e9967c92ce13212a7f13c337e25661fbc971c658",
+	"82210570ba2a9783aa80ede04921e45c9c03c59076e8e36a28b735fcaf2dc3a0",
+	"1097272b8bd51660c911f48e293198ef7b1dd83804d80f8728d83f1320b5400e",
+	"01ad6b464607fe30fefb419c25709c386b30b58e79ba1075d7ba82f16d0baefc",
+
+	"8ccc3f94c4c0f0fe6fee9b853a54907811a95f66696dc72843ebfc2ff8445536",
+	"7dc8d90e4139704f345c6bd80d7e029af6e2c7208bf5d6a4b679a60da53ba87e",
+	"0ac8906f35d3f43d973ebc85c51d2137f8e6c9271082d22f2f8183e0d97376ff",
+	"154e473e1bbd2b3a4326602079aa69f066359ea2cb6a71455a8ff72da1f9f724",
+	"c676c044aaf9dedb19b9b4113b41952234e9ba8d6d46e47295b4009a484b6b93",
+
+	"50ddc9d34d0e9cbb63f877ca2724a29a02a5e5aa74eab98065a379c29f319d1c",
+	"e5fa050131dfa6d36627441b248e3bce51553041cdb1292d4a6c1b08890c1313",
+	"3fb891468269d14360b875a4f80071474e66cb8069f8086f15931ea69c943acc",
+	"4fc6ef3f31cd4ab2cf4ba4f9ad9cbdf27e3c7819ff3d6556b1d3746dabfd651c",
+	"4f6f90ec5f3634d888a5f0a395bb50924cde20baddb25eaf8c86461221912cb5",
+
+	"8c707a5ca1995b331b83ef6fc2cf9d11106ed16da7b5283004cc76d4af708215",
+	"2a92fc430bca0b9cc36f89dd9832e68a947723fc5839b117b8bfc47b12029e4b",
+	"ad40abf4e50de087d601bc5ca8f62dbe8809f172fcdcbf074f1aa9a3ac86d73a",
+	"008930651ab148f1aad3b9432a2258d15c3216bde9931ef1bfb1a06b29202007",
+	"8bb1833a245779a2ff346bc231c6924d2b4c5a991336b5997de85c694153c518",
+
+	"87553a36be57779d14f14f7a3e4112e1ceb051fe6a849f003f6a2bb9ac266e39",
+	"7c2b52951827b02e740edf0ce42cc98a6c2d6422f1ccd2d7a873daa47533dd4b",
+	"32213ceb8b8d81b101a004bf12ca17704a77dd7135e383769904425a10fd4b9b",
+	"c6ea83ef596207d6493e07158da61d1e5ff5e323d00436e3d7c874fdd167572c",
+	"a83506244231388ae7a981fbe8fc816d7ea350e3a5d5d52492ad03d0fbc911ac",
+
+	NULL
+};
+
+/*
+ * KAT do255s signature.
+ * Each group of five value is:
+ *   private key
+ *   public key
+ *   seed (can be empty!)
+ *   data (SHA3-256 of "sample X" with X = 0, 1,...)
+ *   signature
+ */
+static const char *const KAT_DO255S_SIGN[] = {
+	"e7c1f12f0f7000d7f67a5a5c8d6a14700fba7a69d530c935c68105109ddce608",
+	"e5a5789fe4447b6de68259cb8916a29d92b11bf817d51ba4423305c1ca22497d",
+	"",
+	"9eb7ccdd65cfb6e02f99210264c6424c911ab8890fcd93f064399d747b503ecf",
+	"89d6cfd9a701d5a65b2f14570b340a21ba68d1d3c32e44a429b33d2db055910f0800d734bc10da80a0b2ab6e192d495eca1e71cc8ea53d8e70cbedf70a30643a",
+
+	"115d54b74937d20f24816af4d1b35583f2c092285f59317b3b5c4ac4841ea113",
+	"6bead75292150e0898e3404199f2d9490ac9ee2ff395d3a93458821bc29d2a1c",
+	"b1",
+	"45515ea2aec5e64eab4ca100c26b030447c07b66a9fb6f532cba12e1f62ae627",
+	"59bb28b2be7735a883a2ce67b76352a9a993bd8dbf0739c4577b8ca6f6b7ae160dd09db54c27b3369405d6f5293628cb213c04fbc95550d7471c5465e4c1a239",
+
+	"471329a46cd075adc0c4c36ac161a157e7900e7ce69457a58f9e2df4165cb401",
+	"f306e28993bc5aa9ae3444bd59eb8ae3944c7b2b1393d53c182ab88566342210",
+	"896d",
+	"61954339a2d5ff28e0d496af0716d757891010625c8859cf2ffde8fc75f3e74d",
+	"a71e987ee3a2e685376e2d91a8b169f6152b64ec59bc1a24ee070d9c5a06fd21db4173a6dd85818fe8d1f1c4136ef78e4e5112d8e4f8649bc1a1bda876df8d12",
+
+	"cca6d9c557d0fec812da945f15258fd49288ac956ef6cfb46d5108ce14f2a604",
+	"78e06a93e5d7e560f6a82695e7c5a3c74424f1ac0ea7cb9810f8d6aa7193ec7d",
+	"356c39",
+	"e1bc41167127f1944e47d6c3e9775ea31919040ede6f1843baf1a039a363467e",
+	"57c144e06afe0e8434dd5619c6ad0edbc8117e42619267622a44df8efd8aea378d01662a382c49a6d6dafacb83762f6516f305150f1eb519740f758f2c604f12",
+
+	"4f818f5503cac86c4988919dc6363e16646f677b35a8ffab5340d7144c301607",
+	"7d528e8e6ba5fe7b942a31b881fe862febd67c53425a4eb1624bfadb70f1f430",
+	"50c27940",
+	"68b268348810d58120705fe0ac3faaa11218c81f6560541891772c58305d3f6e",
+	"aa26f4b682f080f32cc265590c44cddede467d7454333dcf469687c629fb60668d6a8504e178e0492023996c05b4f8f320c0f2594f3fa76b6c21f4314c4c6425",
+
+	"ec92eec04e4d608b7949b6673b223b0fada4b5cd0a45ed018d4d8341e7d73817",
+	"ca8cfb6022395629da3be657808fd3985b34a5ecd20de61b023323b44e6eb711",
+	"e47d5a9a3f",
+	"91cc12bdabea62f2fad09995b2177f3d01011d2b52fa51219d961e8801cf9b84",
+	"936599dbf96cdc7eadb145aa8e5c86c008d8810652cc91bfb26df3076b16e178328c28f89c4e4662be676d7994a02b96d9ae6c0f57e9702349c0c25955fe601e",
+
+	"60f9d0bfbccf4b880b8c7961ef4c7f18c1424bfd38d68812ba288da371941d09",
+	"903b6ce5c39c3a15f1f6a2782462cc39185192253fa1a8532e027e9a38fed13d",
+	"e38710ceebd6",
+	"0e298aef020cdd9cb9382d54f950d975b35f7807324d064c968cfb973f4d88a9",
+	"28b268e0ce9ee196537ad9145ba51bb7911a21c383f698809b77f0a67fe355611559b223aaff4371d43d1c2f1eb15b4521b409062247a93b9e041089dfa21b1f",
+
+	"38cab63ea60e7ccf213d04b3416c795e047f4897cc79968a3a28c2487c8dd51b",
+	"00679269eebba60db4b8c2ef5dade2828d907ec582b8eefb13ea78b770402254",
+	"e9ec0b55184b69",
+	"bd6fa43ba1f3558c945ad97b86a16e46f18689d631832f36655808e0ae9625c4",
+	"b250f5ee957d1fb1627e386947c8c6763797b3dfd818ec4601e169aff00db10ef88e829f7fc668c6f7d301b7c79f7d1feb45089ac4b4b7043185b2374a274815",
+
+	"a0c852217d57f54af23b22c24663c08dfa39080a4ce479f15b29ca98aa1f7126",
+	"7385259b9b2c90cb454e2a06ca0da0f7a2bd431a341d8df85592613f6519c06b",
+	"89f04c834dc56e08",
+	"15cad315726640f061a87262b030f8013d698829808ca191d29eab06e000d526",
+	"3f699ff1c85c8355e95250a08cfa319ae38c5631a060878fd3feaae1a16c4d3a02d5f9c610306ecfc6be5692c01ae31dc915df2d864343d507093b0c396c3e29",
+
+	"5f2aee1f839af4437708be00dc9fdd4b464f78cce503a2a46b7e49c7f8801e31",
+	"cb6a952d21f8dac3e73719c5a2e25a5c0d25d296baa914a91017d4e2fd607543",
+	"6ffcf67ae37c48bd44",
+	"a3a01a7f31c626a828d91a2ba34453fac4864a1c2418f22d135ac28158e12ab3",
+	"fc4e13e24ca421d18cd2abcac996c5583da63dab668862870e8338c984797d3f3f1e8ffabab56fe7b845d8f635d25f410105286244c288ab63ea73c2d75ba32e",
+
+	"5180783172ddc9a101ea14d267606e7b086b9f199d285b9d963ad74e9c6a6129",
+	"316e6c618476ff7f51315d9d4d7f2ec63099818b5d41fe64f109ad57365fc86b",
+	"b5ec13448a6074acbe72",
+	"3e2b0342ad12868adf498fc2a3c7bf168d115a3ca37fcb475541ead259f20c9a",
+	"3fda8fcb7d32f98ecc7f7e1ed218bca9005774260e9db9ec7f26c0b9bef7dd0a1924bdca462df14986e740e8fb6fb498efb55765dc8de83eac6fb8cd9c8bed02",
+
+	"6bfbb1a80603bb69eb67e30ec92a9643009223ae066317cd580763c74a5fee06",
+	"e5625e553805421578ba2ee5399a5e6665ab343a67d0915cd4f789d22ee07652",
+	"af57e5cd20151b84cb9b50",
+	"8947bdb1b77d2117bc43d4933b89d835c28b0f5e228a2993f53711f0d6067499",
+	"d7c5d21aa9fcd5632c5c5e79accdb1002e9930615f9d1f07c5f443f82ebed07a052060c8aa6b367bf9a4fda0b2cf2b488372ff57b9b4c6c48ade2d9dfbd9d024",
+
+	"cebef0642b7dddf73345d784b85018b8c1f26b4fb9f1bfbb717bfc153e82c60f",
+	"bda06c4aa5091c2bc2b7d81bf6962935f1e16fa4858bfe0bdd36ceaca8553200",
+	"df6d2a11e996f8622c06c698",
+	"ee4d9fd7516a121d065a71ba92bc70177ed7b12e1f62506d8f79127d790518c7",
+	"ecc43c40ab39fbdaac1217d8407b540fcd41af0179ac06b595afaf1602ee1f564d9501f96e000ee249728df187dc8c3143e30f4d2967be37ebde283889f54939",
+
+	"d163603878563d7a36f840d22c7a850363a6e8b094e471f60f7bfdc75da18e0a",
+	"0721d84e87361db69031bf970e8bd5f3ae9d86c751b59417ee7139230f88da43",
+	"fd6326d2da4c6683622d212e37",
+	"1e713421d1a44b6ef1944e973d17764e44f580b91c53b9e11f4a1dc2783b435a",
+	"0262368df64a673dcbdf5ba3791a1068e941e482d7d5aa06bdfa75847a4b5e2ed4b005878774c8884822bc8cd9f19d9f55a6aafb2f2b44899dd1c80e3e57bc0d",
+
+	"93ae6d9673f5c48e26b37047d79c95bb1fe9aa1b496b5aaa1eb49eca880f2339",
+	"7151af8a2e5cdaf205eb64172e88b23c257c73b0c1826a09ef5f02af37955118",
+	"4f5b169cd6ae70f1490291708205",
+	"8584de70ef2a343366c334bc11b8d9e837ba63833dbb619127075bdb906ac403",
+	"41c78cf12f0c1fe16ab9d180d086d2faee58607fc891ab8132e641cefc9ea25e4e340928d90259419a08a9ebfa789ceff91bd86caf49d3875e83573a631fe226",
+
+	"3b70f2cc6d753938d23ecdfab9621db34d1b606ddaafef479bdc0cf5fda83a18",
+	"e73f4c27bfe24e2fda57ad76aab76554dc9f410589e78c93f4d152b5c4438807",
+	"1ca32967015de8ec8276e1408ff3ce",
+	"018571598ecb3dc0b96a693a85de4927aba6e64ba6be14ffc9e9ff65896bc3dd",
 	"2e523cd538a1500265144b5d8c5d75e614045d398ffbaa44a9a65cee8f9b5717aa1e6e7ae16ec82682eddb547a4a2cb02feaafdecfa07d102b9802358c412f2d",
 
-	"8becb40aff59d9d93289bb56b1957675794211bc3427882d1c54c7f3563d6c2d",
-	"e29619933aaa702f0b733626eb7b7d3ae54047095d2448cf9a0281c1eb20114b",
-	"38493f0d9d3f93d250a46ccfac0ad4f5",
-	"c02b87d23b05e56f0f7b96500368a41c23e83c5b0603642e5de35f4cda0d9b89",
-	"d31254216e4fd07da82d0c5ab5cc904dd475f44177e73d38e96551de6ec54c17c8b5a7239f05abea895e5831a58ad7c16246bdd6f40d6cba0880e18420e6612b",
+	"8becb40aff59d9d93289bb56b1957675794211bc3427882d1c54c7f3563d6c2d",
+	"e29619933aaa702f0b733626eb7b7d3ae54047095d2448cf9a0281c1eb20114b",
+	"38493f0d9d3f93d250a46ccfac0ad4f5",
+	"c02b87d23b05e56f0f7b96500368a41c23e83c5b0603642e5de35f4cda0d9b89",
+	"d31254216e4fd07da82d0c5ab5cc904dd475f44177e73d38e96551de6ec54c17c8b5a7239f05abea895e5831a58ad7c16246bdd6f40d6cba0880e18420e6612b",
+
+	"25f0dfdeee9e6091cf0d2dc21c511c9a83cc341b62580e046aaaac8635aff502",
+	"5b2244cfe0fdbc2dd9ca51c788b2ecf633c9877536e2ce2a9c444b58469a7b53",
+	"a7e6bbd4302d191956d3e23a247b46b0ba",
+	"4739c6afd6c5b3f1f58efe807bb068940bdc6725057661660442af88f9050aa8",
+	"195773730c0136df3c4544437af5a8f10ec973e597990d2319b46eae58710a02c6c219c2afc30aaf96d769dbaf2b5157d4664299ea6e5b1533047d2b22e40911",
+
+	"bd3c1a07a2961e85dd0ccca39045567a1f1f4c4e4f41e1190c8d5712be9a5b15",
+	"b2faec833d71736c0fc8d28c5261bd4b61f29679d726fc17df3d68599e14435e",
+	"c15641937d84e33443da70b5b5458a767097",
+	"f8ec137d474d2fa4eebdd1f4acaa713743f0315f9480affad04af23ff7e4af4d",
+	"a289f0ebeae6106d6e9d33721814c640a4cdaff4f856cdf582ba41819b958049a1eff69cdcbe022dfaa6889924687d5ed72e94982d0d2213f6a8d8e76d04931e",
+
+	"56beec9f18c40a560e280e84d25480a68b6cabb1771f81828e3eac64d3d7530a",
+	"723f50876ceccbd10f706ec389e34ecddc54552a1d6b5b2307879143dca1a365",
+	"ace83bb731fdd197c1ac260a0b243057ca5f3c",
+	"9403502de9faadba9fca6c0737f0f93058bcde07c7c0165714ace3084fb44086",
+	"ebd4f2c77aa76448041f9c4e405fd4f1aef2fcc9a150a2257c60dd9dd68761657e1f4e2b7e331bede740598c35247401b251412261d4144832eaf2be18e1061b",
+
+	NULL
+};
+
+static void
+test_do255s_keygen(void)
+{
+	const char *const *s;
+	int i;
+
+	printf("Test do255s keygen: ");
+	fflush(stdout);
+
+	for (s = KAT_DO255S_KEYGEN, i = 0; *s != NULL; i ++) {
+		do255s_private_key sk, ref_sk;
+		do255s_public_key pk, ref_pk;
+		shake_context sc;
+		uint8_t x;
+
+		HEXTOBIN(ref_sk.b, *s ++);
+		HEXTOBIN(ref_pk.b, *s ++);
+		x = (uint8_t)i;
+		shake_init(&sc, 256);
+		shake_inject(&sc, &x, 1);
+		shake_flip(&sc);
+		do255s_keygen(&sc, &sk, NULL);
+		check_equals(sk.b, ref_sk.b, 32, "KAT keygen sk 1");
+		memset(sk.b, 0, sizeof sk.b);
+		shake_init(&sc, 256);
+		shake_inject(&sc, &x, 1);
+		shake_flip(&sc);
+		do255s_keygen(&sc, &sk, &pk);
+		check_equals(sk.b, ref_sk.b, 32, "KAT keygen sk 2");
+		check_equals(pk.b, ref_pk.b, 32, "KAT keygen pk 1");
+		memset(pk.b, 32, sizeof pk.b);
+		do255s_make_public(&pk, &sk);
+		check_equals(pk.b, ref_pk.b, 32, "KAT keygen pk 2");
+
+		printf(".");
+		fflush(stdout);
+	}
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255s_ecdh(void)
+{
+	const char *const *s;
+
+	printf("Test do255s ECDH: ");
+	fflush(stdout);
+
+	s = KAT_DO255S_ECDH;
+	while (*s != NULL) {
+		do255s_private_key sk;
+		do255s_public_key pk1, pk2, pk_self;
+		uint8_t sec1[32], sec2[32], tmp[32];
+
+		HEXTOBIN(sk.b, *s ++);
+		HEXTOBIN(pk1.b, *s ++);
+		HEXTOBIN(sec1, *s ++);
+		HEXTOBIN(pk2.b, *s ++);
+		HEXTOBIN(sec2, *s ++);
+		do255s_make_public(&pk_self, &sk);
+		if (!do255s_key_exchange(tmp, 32, &sk, &pk_self, &pk1)) {
+			fprintf(stderr, "ECDH failed\n");
+			exit(EXIT_FAILURE);
+		}
+		check_equals(tmp, sec1, 32, "KAT ECDH 1");
+		if (do255s_key_exchange(tmp, 32, &sk, &pk_self, &pk2)) {
+			fprintf(stderr, "ECDH should have failed\n");
+			exit(EXIT_FAILURE);
+		}
+		check_equals(tmp, sec2, 32, "KAT ECDH 2");
+
+		printf(".");
+		fflush(stdout);
+	}
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+static void
+test_do255s_sign(void)
+{
+	const char *const *s;
+
+	printf("Test do255s sign: ");
+	fflush(stdout);
+
+	s = KAT_DO255S_SIGN;
+	while (*s != NULL) {
+		do255s_private_key sk;
+		do255s_public_key pk, pk_ref;
+		do255s_expanded_public_key epk;
+		do255s_signature sig, sig_ref;
+		uint8_t seed[32], data[32];
+		size_t seed_len;
+
+		HEXTOBIN(sk.b, *s ++);
+		HEXTOBIN(pk_ref.b, *s ++);
+		seed_len = hextobin(seed, sizeof seed, *s ++);
+		HEXTOBIN(data, *s ++);
+		HEXTOBIN(sig_ref.b, *s ++);
+		do255s_make_public(&pk, &sk);
+		check_equals(pk.b, pk_ref.b, 32, "KAT sign pk");
+		do255s_sign(&sig, &sk, &pk, DO255_OID_SHA3_256,
+			data, 32, seed, seed_len);
+		check_equals(sig.b, sig_ref.b, 64, "KAT sign sig");
+		if (!do255s_verify_vartime(&sig, &pk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify 1");
+			exit(EXIT_FAILURE);
+		}
+		data[0] ^= 0x01;
+		if (do255s_verify_vartime(&sig, &pk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify 2");
+			exit(EXIT_FAILURE);
+		}
+		if (!do255s_expand_public_key(&epk, &pk)) {
+			fprintf(stderr, "KAT sign expand\n");
+			exit(EXIT_FAILURE);
+		}
+		if (do255s_verify_vartime_expanded(&sig, &epk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify expanded 2");
+			exit(EXIT_FAILURE);
+		}
+		data[0] ^= 0x01;
+		if (!do255s_verify_vartime_expanded(&sig, &epk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify expanded 1");
+			exit(EXIT_FAILURE);
+		}
+		memset(pk.b, 0, sizeof pk.b);
+		if (do255s_expand_public_key(&epk, &pk)
+			|| do255s_verify_vartime_expanded(&sig, &epk,
+			DO255_OID_SHA3_256, data, 32))
+		{
+			fprintf(stderr, "KAT sign verify expanded 3");
+			exit(EXIT_FAILURE);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+	printf(" done.\n");
+	fflush(stdout);
+}
+
+#if DO_BENCH86
+
+static inline uint64_t
+core_cycles(void)
+{
+#if defined __GNUC__ && !defined __clang__
+	uint32_t hi, lo;
+
+	_mm_lfence();
+	__asm__ __volatile__ ("rdtsc" : "=d" (hi), "=a" (lo) : : );
+	return ((uint64_t)hi << 32) | (uint64_t)lo;
+#else
+	_mm_lfence();
+	return __rdtsc();
+#endif
+}
+
+static int
+cmp_u64(const void *p1, const void *p2)
+{
+	uint64_t v1, v2;
+
+	v1 = *(const uint64_t *)p1;
+	v2 = *(const uint64_t *)p2;
+	if (v1 < v2) {
+		return -1;
+	} else if (v1 == v2) {
+		return 0;
+	} else {
+		return 1;
+	}
+}
+
+/*
+ * Hardware performance counters. perf_start() enables the counters,
+ * perf_stop() disables them and records the counts since perf_start(),
+ * and perf_report() prints the values recorded by the last perf_stop(),
+ * then a newline: instructions per cycle, and branch and L1 data cache
+ * misses per 1000 instructions. If the counters are not available, then
+ * these functions only print the newline.
+ */
+
+#define PERF_INSTR      0
+#define PERF_CYCLES     1
+#define PERF_BRMISS     2
+#define PERF_L1DMISS    3
+#define PERF_NUM        4
+
+#if DO_PERF
+
+/*
+ * perf_state is 0 if the counters were not opened yet, 1 if they are
+ * open, -1 if they are not available. The instructions counter is the
+ * group leader; the other counters are optional (perf_fd[i] < 0 if
+ * they could not be opened); perf_slot[i] is the index of counter i in
+ * the group read() output.
+ */
+static int perf_state = 0;
+static int perf_fd[PERF_NUM] = { -1, -1, -1, -1 };
+static int perf_slot[PERF_NUM];
+static int perf_valid = 0;
+static double perf_val[PERF_NUM];
+
+/*
+ * Group read() output: nr, time_enabled, time_running, then one value
+ * per counter. The times are not cleared by PERF_EVENT_IOC_RESET, hence
+ * perf_start() records them (with the counter values) in perf_base[],
+ * and perf_stop() uses the differences.
+ */
+static uint64_t perf_base[3 + PERF_NUM];
+
+static int
+perf_read(uint64_t *buf)
+{
+	return read(perf_fd[0], buf, (3 + PERF_NUM) * sizeof *buf)
+		>= (ssize_t)(4 * sizeof *buf);
+}
+
+static int
+perf_open(uint32_t type, uint64_t config, int group_fd)
+{
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof attr);
+	attr.size = sizeof attr;
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = (group_fd < 0);
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP
+		| PERF_FORMAT_TOTAL_TIME_ENABLED
+		| PERF_FORMAT_TOTAL_TIME_RUNNING;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+static void
+perf_init(void)
+{
+	static const struct {
+		uint32_t type;
+		uint64_t config;
+	} ev[PERF_NUM] = {
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+		{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+			| (PERF_COUNT_HW_CACHE_OP_READ << 8)
+			| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) }
+	};
+	int i, n;
+
+	if (perf_state != 0) {
+		return;
+	}
+	perf_fd[0] = perf_open(ev[0].type, ev[0].config, -1);
+	if (perf_fd[0] < 0) {
+		printf("(hardware performance counters not available: %s)\n",
+			strerror(errno));
+		fflush(stdout);
+		perf_state = -1;
+		return;
+	}
+	perf_slot[0] = 0;
+	n = 1;
+	for (i = 1; i < PERF_NUM; i ++) {
+		perf_fd[i] = perf_open(ev[i].type, ev[i].config, perf_fd[0]);
+		if (perf_fd[i] >= 0) {
+			perf_slot[i] = n ++;
+		}
+	}
+	perf_state = 1;
+}
+
+static void
+perf_start(void)
+{
+	perf_init();
+	if (perf_state < 0) {
+		return;
+	}
+	memset(perf_base, 0, sizeof perf_base);
+	perf_read(perf_base);
+	ioctl(perf_fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+static void
+perf_stop(void)
+{
+	uint64_t buf[3 + PERF_NUM];
+	double scale;
+	int i;
+
+	perf_valid = 0;
+	if (perf_state <= 0) {
+		return;
+	}
+	ioctl(perf_fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	if (!perf_read(buf) || buf[2] == perf_base[2]) {
+		return;
+	}
+
+	/*
+	 * If the counters were multiplexed with other events, then they
+	 * ran only for a fraction of the time; we scale them accordingly.
+	 */
+	scale = (double)(buf[1] - perf_base[1])
+		/ (double)(buf[2] - perf_base[2]);
+	for (i = 0; i < PERF_NUM; i ++) {
+		if (perf_fd[i] >= 0) {
+			int j;
+
+			j = 3 + perf_slot[i];
+			perf_val[i] = (double)(buf[j] - perf_base[j]) * scale;
+		} else {
+			perf_val[i] = -1.0;
+		}
+	}
+	perf_valid = perf_val[PERF_INSTR] > 0.0;
+}
+
+static void
+perf_report(void)
+{
+	if (perf_valid) {
+		double ki;
+
+		ki = perf_val[PERF_INSTR] / 1000.0;
+		if (perf_val[PERF_CYCLES] > 0.0) {
+			printf("  IPC %4.2f", perf_val[PERF_INSTR]
+				/ perf_val[PERF_CYCLES]);
+		}
+		if (perf_val[PERF_BRMISS] >= 0.0) {
+			printf("  br-miss %5.2f/ki",
+				perf_val[PERF_BRMISS] / ki);
+		}
+		if (perf_val[PERF_L1DMISS] >= 0.0) {
+			printf("  L1D-miss %5.2f/ki",
+				perf_val[PERF_L1DMISS] / ki);
+		}
+	}
+	printf("\n");
+}
+
+#else
 
-	"25f0dfdeee9e6091cf0d2dc21c511c9a83cc341b62580e046aaaac8635aff502",
-	"5b2244cfe0fdbc2dd9ca51c788b2ecf633c9877536e2ce2a9c444b58469a7b53",
-	"a7e6bbd4302d191956d3e23a247b46b0ba",
-	"4739c6afd6c5b3f1f58efe807bb068940bdc6725057661660442af88f9050aa8",
-	"195773730c0136df3c4544437af5a8f10ec973e597990d2319b46eae58710a02c6c219c2afc30aaf96d769dbaf2b5157d4664299ea6e5b1533047d2b22e40911",
+static void
+perf_init(void)
+{
+}
 
-	"bd3c1a07a2961e85dd0ccca39045567a1f1f4c4e4f41e1190c8d5712be9a5b15",
-	"b2faec833d71736c0fc8d28c5261bd4b61f29679d726fc17df3d68599e14435e",
-	"c15641937d84e33443da70b5b5458a767097",
-	"f8ec137d474d2fa4eebdd1f4acaa713743f0315f9480affad04af23ff7e4af4d",
-	"a289f0ebeae6106d6e9d33721814c640a4cdaff4f856cdf582ba41819b958049a1eff69cdcbe022dfaa6889924687d5ed72e94982d0d2213f6a8d8e76d04931e",
+static void
+perf_start(void)
+{
+}
 
-	"56beec9f18c40a560e280e84d25480a68b6cabb1771f81828e3eac64d3d7530a",
-	"723f50876ceccbd10f706ec389e34ecddc54552a1d6b5b2307879143dca1a365",
-	"ace83bb731fdd197c1ac260a0b243057ca5f3c",
-	"9403502de9faadba9fca6c0737f0f93058bcde07c7c0165714ace3084fb44086",
-	"ebd4f2c77aa76448041f9c4e405fd4f1aef2fcc9a150a2257c60dd9dd68761657e1f4e2b7e331bede740598c35247401b251412261d4144832eaf2be18e1061b",
+static void
+perf_stop(void)
+{
+}
 
-	NULL
-};
+static void
+perf_report(void)
+{
+	printf("\n");
+}
+
+#endif
 
 static void
-test_do255s_keygen(void)
+speed_do255s_decode(void)
 {
-	const char *const *s;
-	int i;
+	size_t u;
+	uint64_t tt[1000];
+	do255s_point P;
+	uint8_t buf[32];
 
-	printf("Test do255s keygen: ");
+	do255s_encode(buf, &do255s_generator);
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_decode(&P, buf);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s decode:         %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
+}
 
-	for (s = KAT_DO255S_KEYGEN, i = 0; *s != NULL; i ++) {
-		do255s_private_key sk, ref_sk;
-		do255s_public_key pk, ref_pk;
-		shake_context sc;
-		uint8_t x;
+static void
+speed_do255e_decode(void)
+{
+	size_t u;
+	uint64_t tt[1000];
+	do255e_point P;
+	uint8_t buf[32];
 
-		HEXTOBIN(ref_sk.b, *s ++);
-		HEXTOBIN(ref_pk.b, *s ++);
-		x = (uint8_t)i;
-		shake_init(&sc, 256);
-		shake_inject(&sc, &x, 1);
-		shake_flip(&sc);
-		do255s_keygen(&sc, &sk, NULL);
-		check_equals(sk.b, ref_sk.b, 32, "KAT keygen sk 1");
-		memset(sk.b, 0, sizeof sk.b);
-		shake_init(&sc, 256);
-		shake_inject(&sc, &x, 1);
-		shake_flip(&sc);
-		do255s_keygen(&sc, &sk, &pk);
-		check_equals(sk.b, ref_sk.b, 32, "KAT keygen sk 2");
-		check_equals(pk.b, ref_pk.b, 32, "KAT keygen pk 1");
-		memset(pk.b, 32, sizeof pk.b);
-		do255s_make_public(&pk, &sk);
-		check_equals(pk.b, ref_pk.b, 32, "KAT keygen pk 2");
+	do255e_encode(buf, &do255e_generator);
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
 
-		printf(".");
-		fflush(stdout);
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_decode(&P, buf);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
 	}
-	printf(" done.\n");
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e decode:         %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-test_do255s_ecdh(void)
+speed_do255s_encode(void)
 {
-	const char *const *s;
+	size_t u;
+	uint64_t tt[1000];
+	do255s_point P;
+	uint8_t buf[32];
 
-	printf("Test do255s ECDH: ");
+	P = do255s_generator;
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_encode(buf, &P);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s encode:         %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
+}
 
-	s = KAT_DO255S_ECDH;
-	while (*s != NULL) {
-		do255s_private_key sk;
-		do255s_public_key pk1, pk2, pk_self;
-		uint8_t sec1[32], sec2[32], tmp[32];
+static void
+speed_do255e_encode(void)
+{
+	size_t u;
+	uint64_t tt[1000];
+	do255e_point P;
+	uint8_t buf[32];
 
-		HEXTOBIN(sk.b, *s ++);
-		HEXTOBIN(pk1.b, *s ++);
-		HEXTOBIN(sec1, *s ++);
-		HEXTOBIN(pk2.b, *s ++);
-		HEXTOBIN(sec2, *s ++);
-		do255s_make_public(&pk_self, &sk);
-		if (!do255s_key_exchange(tmp, 32, &sk, &pk_self, &pk1)) {
-			fprintf(stderr, "ECDH failed\n");
-			exit(EXIT_FAILURE);
+	P = do255e_generator;
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		if (u == 1000) {
+			perf_start();
 		}
-		check_equals(tmp, sec1, 32, "KAT ECDH 1");
-		if (do255s_key_exchange(tmp, 32, &sk, &pk_self, &pk2)) {
-			fprintf(stderr, "ECDH should have failed\n");
-			exit(EXIT_FAILURE);
+		begin = core_cycles();
+		do255e_encode(buf, &P);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
 		}
-		check_equals(tmp, sec2, 32, "KAT ECDH 2");
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e encode:         %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
+}
 
-		printf(".");
-		fflush(stdout);
+static void
+speed_do255e_decode_batch(void)
+{
+	size_t u;
+	uint64_t tt[100];
+	do255e_point P[64];
+	uint8_t buf[64 * 32];
+
+	for (u = 0; u < 64; u ++) {
+		memset(buf, (int)u, 32);
+		do255e_mulgen(&P[u], buf);
 	}
-	printf(" done.\n");
+	do255e_encode_batch(buf, P, 64);
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_decode_batch(P, NULL, buf, 64);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = (end - begin) / 64;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e decode_batch:   %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-test_do255s_sign(void)
+speed_do255s_decode_batch(void)
 {
-	const char *const *s;
+	size_t u;
+	uint64_t tt[100];
+	do255s_point P[64];
+	uint8_t buf[64 * 32];
 
-	printf("Test do255s sign: ");
+	for (u = 0; u < 64; u ++) {
+		memset(buf, (int)u, 32);
+		do255s_mulgen(&P[u], buf);
+	}
+	do255s_encode_batch(buf, P, 64);
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_decode_batch(P, NULL, buf, 64);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = (end - begin) / 64;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s decode_batch:   %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
 	fflush(stdout);
+}
 
-	s = KAT_DO255S_SIGN;
-	while (*s != NULL) {
-		do255s_private_key sk;
-		do255s_public_key pk, pk_ref;
-		do255s_signature sig, sig_ref;
-		uint8_t seed[32], data[32];
-		size_t seed_len;
+static void
+speed_do255e_encode_batch(void)
+{
+	size_t u;
+	uint64_t tt[100];
+	do255e_point P[64];
+	uint8_t buf[64 * 32];
 
-		HEXTOBIN(sk.b, *s ++);
-		HEXTOBIN(pk_ref.b, *s ++);
-		seed_len = hextobin(seed, sizeof seed, *s ++);
-		HEXTOBIN(data, *s ++);
-		HEXTOBIN(sig_ref.b, *s ++);
-		do255s_make_public(&pk, &sk);
-		check_equals(pk.b, pk_ref.b, 32, "KAT sign pk");
-		do255s_sign(&sig, &sk, &pk, DO255_OID_SHA3_256,
-			data, 32, seed, seed_len);
-		check_equals(sig.b, sig_ref.b, 64, "KAT sign sig");
-		if (!do255s_verify_vartime(&sig, &pk,
-			DO255_OID_SHA3_256, data, 32))
-		{
-			fprintf(stderr, "KAT sign verify 1");
-			exit(EXIT_FAILURE);
+	for (u = 0; u < 64; u ++) {
+		memset(buf, (int)u, 32);
+		do255e_mulgen(&P[u], buf);
+	}
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+
+		if (u == 100) {
+			perf_start();
 		}
-		data[0] ^= 0x01;
-		if (do255s_verify_vartime(&sig, &pk,
-			DO255_OID_SHA3_256, data, 32))
-		{
-			fprintf(stderr, "KAT sign verify 2");
-			exit(EXIT_FAILURE);
+		begin = core_cycles();
+		do255e_encode_batch(buf, P, 64);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = (end - begin) / 64;
 		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e encode_batch:   %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255s_encode_batch(void)
+{
+	size_t u;
+	uint64_t tt[100];
+	do255s_point P[64];
+	uint8_t buf[64 * 32];
+
+	for (u = 0; u < 64; u ++) {
+		memset(buf, (int)u, 32);
+		do255s_mulgen(&P[u], buf);
+	}
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
 
-		printf(".");
-		fflush(stdout);
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_encode_batch(buf, P, 64);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = (end - begin) / 64;
+		}
 	}
-	printf(" done.\n");
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s encode_batch:   %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
 	fflush(stdout);
 }
 
-#if DO_BENCH86
-
-static inline uint64_t
-core_cycles(void)
+static void
+speed_do255s_mul(void)
 {
-#if defined __GNUC__ && !defined __clang__
-	uint32_t hi, lo;
-
-	_mm_lfence();
-	__asm__ __volatile__ ("rdtsc" : "=d" (hi), "=a" (lo) : : );
-	return ((uint64_t)hi << 32) | (uint64_t)lo;
-#else
-	_mm_lfence();
-	return __rdtsc();
-#endif
-}
+	size_t u;
+	uint64_t tt[1000];
+	do255s_point P;
+	uint8_t scalar[32];
 
-static int
-cmp_u64(const void *p1, const void *p2)
-{
-	uint64_t v1, v2;
+	P = do255s_generator;
+	memset(scalar, 'T', sizeof scalar);
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
 
-	v1 = *(const uint64_t *)p1;
-	v2 = *(const uint64_t *)p2;
-	if (v1 < v2) {
-		return -1;
-	} else if (v1 == v2) {
-		return 0;
-	} else {
-		return 1;
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_mul(&P, &P, scalar);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
 	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s mul:            %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
 }
 
 static void
-speed_do255s_decode(void)
+speed_do255s_mulgen(void)
 {
 	size_t u;
 	uint64_t tt[1000];
 	do255s_point P;
-	uint8_t buf[32];
+	uint8_t scalar[32];
 
-	do255s_encode(buf, &do255s_generator);
+	memset(scalar, 'T', sizeof scalar);
 	for (u = 0; u < 2000; u ++) {
 		uint64_t begin, end;
 
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255s_decode(&P, buf);
+		do255s_mulgen(&P, scalar);
 		end = core_cycles();
 		if (u >= 1000) {
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s decode:         %9lu (%lu .. %lu)\n",
+	printf("do255s mulgen:         %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255e_decode(void)
+speed_do255e_mul(void)
 {
 	size_t u;
 	uint64_t tt[1000];
 	do255e_point P;
-	uint8_t buf[32];
+	uint8_t scalar[32];
 
-	do255e_encode(buf, &do255e_generator);
+	P = do255e_generator;
+	memset(scalar, 'T', sizeof scalar);
 	for (u = 0; u < 2000; u ++) {
 		uint64_t begin, end;
 
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255e_decode(&P, buf);
+		do255e_mul(&P, &P, scalar);
 		end = core_cycles();
 		if (u >= 1000) {
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e decode:         %9lu (%lu .. %lu)\n",
+	printf("do255e mul:            %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255s_encode(void)
+speed_do255e_mulgen(void)
 {
 	size_t u;
 	uint64_t tt[1000];
-	do255s_point P;
-	uint8_t buf[32];
+	do255e_point P;
+	uint8_t scalar[32];
 
-	P = do255s_generator;
+	memset(scalar, 'T', sizeof scalar);
 	for (u = 0; u < 2000; u ++) {
 		uint64_t begin, end;
 
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255s_encode(buf, &P);
+		do255e_mulgen(&P, scalar);
 		end = core_cycles();
 		if (u >= 1000) {
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s encode:         %9lu (%lu .. %lu)\n",
+	printf("do255e mulgen:         %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255e_encode(void)
+speed_do255e_mul_precomp(void)
 {
 	size_t u;
 	uint64_t tt[1000];
+	do255e_precomp tab;
 	do255e_point P;
-	uint8_t buf[32];
+	uint8_t scalar[32];
 
-	P = do255e_generator;
+	memset(scalar, 'T', sizeof scalar);
+	do255e_mulgen(&P, scalar);
 	for (u = 0; u < 2000; u ++) {
 		uint64_t begin, end;
 
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255e_encode(buf, &P);
+		do255e_precomp_init(&tab, &P);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e precomp_init:   %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
+
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_mul_precomp(&P, &tab, scalar);
 		end = core_cycles();
 		if (u >= 1000) {
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e encode:         %9lu (%lu .. %lu)\n",
+	printf("do255e mul_precomp:    %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255s_mul(void)
+speed_do255s_mul_precomp(void)
 {
 	size_t u;
 	uint64_t tt[1000];
+	do255s_precomp tab;
 	do255s_point P;
 	uint8_t scalar[32];
 
-	P = do255s_generator;
 	memset(scalar, 'T', sizeof scalar);
+	do255s_mulgen(&P, scalar);
 	for (u = 0; u < 2000; u ++) {
 		uint64_t begin, end;
 
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255s_mul(&P, &P, scalar);
+		do255s_precomp_init(&tab, &P);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s precomp_init:   %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
+
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_mul_precomp(&P, &tab, scalar);
 		end = core_cycles();
 		if (u >= 1000) {
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s mul:            %9lu (%lu .. %lu)\n",
+	printf("do255s mul_precomp:    %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255s_mulgen(void)
+speed_do255s_verify_helper(void)
 {
 	size_t u;
 	uint64_t tt[1000];
+	uint8_t k0[32], k1[32], P_enc[32];
+	shake_context rng;
 	do255s_point P;
-	uint8_t scalar[32];
 
-	memset(scalar, 'T', sizeof scalar);
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255s verify_helper", 26);
+	shake_flip(&rng);
+	shake_extract(&rng, k0, 32);
+	do255s_mulgen(&P, k0);
+	do255s_encode(P_enc, &P);
 	for (u = 0; u < 2000; u ++) {
 		uint64_t begin, end;
 
+		shake_extract(&rng, k0, 32);
+		shake_extract(&rng, k1, 32);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255s_mulgen(&P, scalar);
+		do255s_verify_helper_vartime(k0, &P, k1, P_enc);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s verify_helper:  %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255e_verify_helper(void)
+{
+	size_t u;
+	uint64_t tt[1000];
+	uint8_t k0[32], k1[32], P_enc[32];
+	shake_context rng;
+	do255e_point P;
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255e verify_helper", 26);
+	shake_flip(&rng);
+	shake_extract(&rng, k0, 32);
+	do255e_mulgen(&P, k0);
+	do255e_encode(P_enc, &P);
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		shake_extract(&rng, k0, 32);
+		shake_extract(&rng, k1, 32);
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_verify_helper_vartime(k0, &P, k1, P_enc);
 		end = core_cycles();
 		if (u >= 1000) {
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e verify_helper:  %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255e_mul_multi(void)
+{
+	size_t u;
+	uint64_t tt[100];
+	shake_context rng;
+	do255e_point P[2];
+	uint8_t k[2][32];
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255e mul_multi", 22);
+	shake_flip(&rng);
+	for (u = 0; u < 2; u ++) {
+		shake_extract(&rng, k[u], 32);
+		do255e_mulgen(&P[u], k[u]);
+		shake_extract(&rng, k[u], 32);
+	}
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_mul_multi(&P[0], P, k, 2);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e mul_multi x2:   %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255s_mul_multi(void)
+{
+	size_t u;
+	uint64_t tt[100];
+	shake_context rng;
+	do255s_point P[2];
+	uint8_t k[2][32];
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255s mul_multi", 22);
+	shake_flip(&rng);
+	for (u = 0; u < 2; u ++) {
+		shake_extract(&rng, k[u], 32);
+		do255s_mulgen(&P[u], k[u]);
+		shake_extract(&rng, k[u], 32);
+	}
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_mul_multi(&P[0], P, k, 2);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s mul_multi x2:   %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255e_mul_x4(void)
+{
+	size_t u;
+	uint64_t tt[100];
+	shake_context rng;
+	do255e_point P[4];
+	uint8_t k[4][32];
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255e mul_x4", 19);
+	shake_flip(&rng);
+	for (u = 0; u < 4; u ++) {
+		shake_extract(&rng, k[u], 32);
+		do255e_mulgen(&P[u], k[u]);
+		shake_extract(&rng, k[u], 32);
+	}
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_mul_x4(P, P, k);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e mul_x4:         %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255e_mulgen_x4(void)
+{
+	size_t u;
+	uint64_t tt[100];
+	shake_context rng;
+	do255e_point P[4];
+	uint8_t k[4][32];
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255e mulgen_x4", 22);
+	shake_flip(&rng);
+	for (u = 0; u < 4; u ++) {
+		shake_extract(&rng, k[u], 32);
+	}
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_mulgen_x4(P, k);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = end - begin;
+		}
+		do255e_encode(k[u & 3], &P[u & 3]);
+	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s mulgen:         %9lu (%lu .. %lu)\n",
-		(unsigned long)tt[500],
-		(unsigned long)tt[100],
-		(unsigned long)tt[900]);
+	printf("do255e mulgen_x4:      %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255e_mul(void)
+speed_do255s_mul_x4(void)
 {
 	size_t u;
-	uint64_t tt[1000];
-	do255e_point P;
-	uint8_t scalar[32];
+	uint64_t tt[100];
+	shake_context rng;
+	do255s_point P[4];
+	uint8_t k[4][32];
 
-	P = do255e_generator;
-	memset(scalar, 'T', sizeof scalar);
-	for (u = 0; u < 2000; u ++) {
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255s mul_x4", 19);
+	shake_flip(&rng);
+	for (u = 0; u < 4; u ++) {
+		shake_extract(&rng, k[u], 32);
+		do255s_mulgen(&P[u], k[u]);
+		shake_extract(&rng, k[u], 32);
+	}
+	for (u = 0; u < 200; u ++) {
 		uint64_t begin, end;
-
+		if (u == 100) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255e_mul(&P, &P, scalar);
+		do255s_mul_x4(P, P, k);
 		end = core_cycles();
-		if (u >= 1000) {
-			tt[u - 1000] = end - begin;
+		if (u >= 100) {
+			tt[u - 100] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e mul:            %9lu (%lu .. %lu)\n",
-		(unsigned long)tt[500],
-		(unsigned long)tt[100],
-		(unsigned long)tt[900]);
+	printf("do255s mul_x4:         %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255e_mulgen(void)
+speed_do255s_mulgen_x4(void)
 {
 	size_t u;
-	uint64_t tt[1000];
-	do255e_point P;
-	uint8_t scalar[32];
+	uint64_t tt[100];
+	shake_context rng;
+	do255s_point P[4];
+	uint8_t k[4][32];
 
-	memset(scalar, 'T', sizeof scalar);
-	for (u = 0; u < 2000; u ++) {
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255s mulgen_x4", 22);
+	shake_flip(&rng);
+	for (u = 0; u < 4; u ++) {
+		shake_extract(&rng, k[u], 32);
+	}
+	for (u = 0; u < 200; u ++) {
 		uint64_t begin, end;
-
+		if (u == 100) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255e_mulgen(&P, scalar);
+		do255s_mulgen_x4(P, k);
 		end = core_cycles();
-		if (u >= 1000) {
-			tt[u - 1000] = end - begin;
+		if (u >= 100) {
+			tt[u - 100] = end - begin;
 		}
+		do255s_encode(k[u & 3], &P[u & 3]);
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e mulgen:         %9lu (%lu .. %lu)\n",
-		(unsigned long)tt[500],
-		(unsigned long)tt[100],
-		(unsigned long)tt[900]);
+	printf("do255s mulgen_x4:      %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255s_verify_helper(void)
+speed_do255e_msm(void)
 {
-	size_t u;
-	uint64_t tt[1000];
-	uint8_t k0[32], k1[32], P_enc[32];
+	size_t u, len;
+	uint64_t tt[100];
 	shake_context rng;
-	do255s_point P;
+	do255e_point P[256];
+	uint8_t k[256][32];
+	void *scratch;
 
 	shake_init(&rng, 128);
-	shake_inject(&rng, "speed do255s verify_helper", 26);
+	shake_inject(&rng, "speed do255e msm", 16);
 	shake_flip(&rng);
-	shake_extract(&rng, k0, 32);
-	do255s_mulgen(&P, k0);
-	do255s_encode(P_enc, &P);
-	for (u = 0; u < 2000; u ++) {
+	for (u = 0; u < 256; u ++) {
+		shake_extract(&rng, k[u], 32);
+		do255e_mulgen(&P[u], k[u]);
+		shake_extract(&rng, k[u], 32);
+	}
+	len = do255e_msm_scratch_size(256);
+	scratch = malloc(len);
+	if (scratch == NULL) {
+		return;
+	}
+	for (u = 0; u < 200; u ++) {
 		uint64_t begin, end;
+		do255e_point Q;
 
-		shake_extract(&rng, k0, 32);
-		shake_extract(&rng, k1, 32);
+		if (u == 100) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255s_verify_helper_vartime(k0, &P, k1, P_enc);
+		do255e_msm_vartime(&Q, P, k, 256, scratch);
 		end = core_cycles();
-		if (u >= 1000) {
-			tt[u - 1000] = end - begin;
+		if (u >= 100) {
+			tt[u - 100] = (end - begin) / 256;
 		}
 	}
+	perf_stop();
+	free(scratch);
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s verify_helper:  %9lu (%lu .. %lu)\n",
-		(unsigned long)tt[500],
-		(unsigned long)tt[100],
-		(unsigned long)tt[900]);
+	printf("do255e msm (per point):%9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
 	fflush(stdout);
 }
 
 static void
-speed_do255e_verify_helper(void)
+speed_do255s_msm(void)
 {
-	size_t u;
-	uint64_t tt[1000];
-	uint8_t k0[32], k1[32], P_enc[32];
+	size_t u, len;
+	uint64_t tt[100];
 	shake_context rng;
-	do255e_point P;
+	do255s_point P[256];
+	uint8_t k[256][32];
+	void *scratch;
 
 	shake_init(&rng, 128);
-	shake_inject(&rng, "speed do255e verify_helper", 26);
+	shake_inject(&rng, "speed do255s msm", 16);
 	shake_flip(&rng);
-	shake_extract(&rng, k0, 32);
-	do255e_mulgen(&P, k0);
-	do255e_encode(P_enc, &P);
-	for (u = 0; u < 2000; u ++) {
+	for (u = 0; u < 256; u ++) {
+		shake_extract(&rng, k[u], 32);
+		do255s_mulgen(&P[u], k[u]);
+		shake_extract(&rng, k[u], 32);
+	}
+	len = do255s_msm_scratch_size(256);
+	scratch = malloc(len);
+	if (scratch == NULL) {
+		return;
+	}
+	for (u = 0; u < 200; u ++) {
 		uint64_t begin, end;
+		do255s_point Q;
 
-		shake_extract(&rng, k0, 32);
-		shake_extract(&rng, k1, 32);
+		if (u == 100) {
+			perf_start();
+		}
 		begin = core_cycles();
-		do255e_verify_helper_vartime(k0, &P, k1, P_enc);
+		do255s_msm_vartime(&Q, P, k, 256, scratch);
 		end = core_cycles();
-		if (u >= 1000) {
-			tt[u - 1000] = end - begin;
+		if (u >= 100) {
+			tt[u - 100] = (end - begin) / 256;
 		}
 	}
+	perf_stop();
+	free(scratch);
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e verify_helper:  %9lu (%lu .. %lu)\n",
-		(unsigned long)tt[500],
-		(unsigned long)tt[100],
-		(unsigned long)tt[900]);
+	printf("do255s msm (per point):%9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
 	fflush(stdout);
 }
 
@@ -3500,6 +6454,9 @@ speed_do255e_keygen(void)
 		shake_inject(&sc, seed, sizeof seed);
 		shake_flip(&sc);
 		shake_extract(&sc, seed, 8);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
 		do255e_keygen(&sc, &sk, &pk);
 		end = core_cycles();
@@ -3507,11 +6464,13 @@ speed_do255e_keygen(void)
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e keygen:         %9lu (%lu .. %lu)\n",
+	printf("do255e keygen:         %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
@@ -3533,6 +6492,9 @@ speed_do255e_ecdh(void)
 
 		do255e_keygen(&rng, &sk1, &pk1);
 		do255e_keygen(&rng, &sk2, &pk2);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
 		do255e_key_exchange(sec, sizeof sec, &sk1, &pk1, &pk2);
 		end = core_cycles();
@@ -3540,11 +6502,13 @@ speed_do255e_ecdh(void)
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e key exchange:   %9lu (%lu .. %lu)\n",
+	printf("do255e key exchange:   %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
@@ -3567,6 +6531,9 @@ speed_do255e_sign(void)
 
 		do255e_keygen(&rng, &sk, &pk);
 		shake_extract(&rng, hv, sizeof hv);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
 		do255e_sign(&sig, &sk, &pk, DO255_OID_SHA3_256, hv, sizeof hv,
 			NULL, 0);
@@ -3575,11 +6542,13 @@ speed_do255e_sign(void)
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e sign:           %9lu (%lu .. %lu)\n",
+	printf("do255e sign:           %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
@@ -3604,6 +6573,9 @@ speed_do255e_verify(void)
 		shake_extract(&rng, hv, sizeof hv);
 		do255e_sign(&sig, &sk, &pk, DO255_OID_SHA3_256, hv, sizeof hv,
 			NULL, 0);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
 		do255e_verify_vartime(&sig, &pk,
 			DO255_OID_SHA3_256, hv, sizeof hv);
@@ -3612,11 +6584,61 @@ speed_do255e_verify(void)
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e verify:         %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255e_verify_expanded(void)
+{
+	size_t u;
+	uint64_t tt[1000];
+	shake_context rng;
+	do255e_private_key sk;
+	do255e_public_key pk;
+	do255e_expanded_public_key epk;
+
+	/*
+	 * All signatures are from the same signer, whose public key is
+	 * expanded once.
+	 */
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255e verify_expanded", 28);
+	shake_flip(&rng);
+	do255e_keygen(&rng, &sk, &pk);
+	do255e_expand_public_key(&epk, &pk);
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+		unsigned char hv[32];
+		do255e_signature sig;
+
+		shake_extract(&rng, hv, sizeof hv);
+		do255e_sign(&sig, &sk, &pk, DO255_OID_SHA3_256, hv, sizeof hv,
+			NULL, 0);
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_verify_vartime_expanded(&sig, &epk,
+			DO255_OID_SHA3_256, hv, sizeof hv);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255e verify:         %9lu (%lu .. %lu)\n",
+	printf("do255e verify_expanded:%9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
@@ -3642,6 +6664,9 @@ speed_do255s_keygen(void)
 		shake_inject(&sc, seed, sizeof seed);
 		shake_flip(&sc);
 		shake_extract(&sc, seed, 8);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
 		do255s_keygen(&sc, &sk, &pk);
 		end = core_cycles();
@@ -3649,11 +6674,13 @@ speed_do255s_keygen(void)
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s keygen:         %9lu (%lu .. %lu)\n",
+	printf("do255s keygen:         %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
@@ -3675,6 +6702,9 @@ speed_do255s_ecdh(void)
 
 		do255s_keygen(&rng, &sk1, &pk1);
 		do255s_keygen(&rng, &sk2, &pk2);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
 		do255s_key_exchange(sec, sizeof sec, &sk1, &pk1, &pk2);
 		end = core_cycles();
@@ -3682,11 +6712,13 @@ speed_do255s_ecdh(void)
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s key exchange:   %9lu (%lu .. %lu)\n",
+	printf("do255s key exchange:   %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
@@ -3709,6 +6741,9 @@ speed_do255s_sign(void)
 
 		do255s_keygen(&rng, &sk, &pk);
 		shake_extract(&rng, hv, sizeof hv);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
 		do255s_sign(&sig, &sk, &pk, DO255_OID_SHA3_256, hv, sizeof hv,
 			NULL, 0);
@@ -3717,11 +6752,13 @@ speed_do255s_sign(void)
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s sign:           %9lu (%lu .. %lu)\n",
+	printf("do255s sign:           %9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
 	fflush(stdout);
 }
 
@@ -3746,6 +6783,9 @@ speed_do255s_verify(void)
 		shake_extract(&rng, hv, sizeof hv);
 		do255s_sign(&sig, &sk, &pk, DO255_OID_SHA3_256, hv, sizeof hv,
 			NULL, 0);
+		if (u == 1000) {
+			perf_start();
+		}
 		begin = core_cycles();
 		do255s_verify_vartime(&sig, &pk,
 			DO255_OID_SHA3_256, hv, sizeof hv);
@@ -3754,23 +6794,264 @@ speed_do255s_verify(void)
 			tt[u - 1000] = end - begin;
 		}
 	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s verify:         %9lu (%lu .. %lu)",
+		(unsigned long)tt[500],
+		(unsigned long)tt[100],
+		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255s_verify_expanded(void)
+{
+	size_t u;
+	uint64_t tt[1000];
+	shake_context rng;
+	do255s_private_key sk;
+	do255s_public_key pk;
+	do255s_expanded_public_key epk;
+
+	/*
+	 * All signatures are from the same signer, whose public key is
+	 * expanded once.
+	 */
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255s verify_expanded", 28);
+	shake_flip(&rng);
+	do255s_keygen(&rng, &sk, &pk);
+	do255s_expand_public_key(&epk, &pk);
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+		unsigned char hv[32];
+		do255s_signature sig;
+
+		shake_extract(&rng, hv, sizeof hv);
+		do255s_sign(&sig, &sk, &pk, DO255_OID_SHA3_256, hv, sizeof hv,
+			NULL, 0);
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_verify_vartime_expanded(&sig, &epk,
+			DO255_OID_SHA3_256, hv, sizeof hv);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
 	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
-	printf("do255s verify:         %9lu (%lu .. %lu)\n",
+	printf("do255s verify_expanded:%9lu (%lu .. %lu)",
 		(unsigned long)tt[500],
 		(unsigned long)tt[100],
 		(unsigned long)tt[900]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255e_verify_batch(void)
+{
+	size_t u, v;
+	uint64_t tt[100];
+	shake_context rng;
+	do255e_private_key sk;
+	do255e_public_key pk[64];
+	do255e_signature sig[64];
+	unsigned char hv[64][32];
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255e verify batch", 25);
+	shake_flip(&rng);
+	for (v = 0; v < 64; v ++) {
+		do255e_keygen(&rng, &sk, &pk[v]);
+		shake_extract(&rng, hv[v], 32);
+		do255e_sign(&sig[v], &sk, &pk[v], DO255_OID_SHA3_256, hv[v], 32,
+			NULL, 0);
+	}
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255e_verify_batch_vartime(NULL, sig, sizeof sig[0],
+			pk, sizeof pk[0], DO255_OID_SHA3_256, hv, 32, 32,
+			64, &rng);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = (end - begin) / 64;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255e verify (batch): %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
+	fflush(stdout);
+}
+
+static void
+speed_do255s_verify_batch(void)
+{
+	size_t u, v;
+	uint64_t tt[100];
+	shake_context rng;
+	do255s_private_key sk;
+	do255s_public_key pk[64];
+	do255s_signature sig[64];
+	unsigned char hv[64][32];
+
+	shake_init(&rng, 128);
+	shake_inject(&rng, "speed do255s verify batch", 25);
+	shake_flip(&rng);
+	for (v = 0; v < 64; v ++) {
+		do255s_keygen(&rng, &sk, &pk[v]);
+		shake_extract(&rng, hv[v], 32);
+		do255s_sign(&sig[v], &sk, &pk[v], DO255_OID_SHA3_256, hv[v], 32,
+			NULL, 0);
+	}
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		do255s_verify_batch_vartime(NULL, sig, sizeof sig[0],
+			pk, sizeof pk[0], DO255_OID_SHA3_256, hv, 32, 32,
+			64, &rng);
+		end = core_cycles();
+		if (u >= 100) {
+			tt[u - 100] = (end - begin) / 64;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("do255s verify (batch): %9lu (%lu .. %lu)",
+		(unsigned long)tt[50],
+		(unsigned long)tt[10],
+		(unsigned long)tt[90]);
+	perf_report();
+	fflush(stdout);
+}
+/*
+ * SHAKE256 speed, in cycles per byte, for injection and extraction of
+ * 4096-byte chunks (with the median over all measures).
+ */
+static void
+speed_shake256(void)
+{
+	size_t u;
+	uint64_t tt1[1000], tt2[1000];
+	shake_context sc;
+	static uint8_t buf[4096];
+
+	memset(buf, 0xA7, sizeof buf);
+	shake_init(&sc, 256);
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		shake_inject(&sc, buf, sizeof buf);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt1[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt1, (sizeof tt1) / sizeof tt1[0], sizeof tt1[0], &cmp_u64);
+	printf("shake256 inject:       %9.2f c/B",
+		(double)tt1[500] / (double)sizeof buf);
+	perf_report();
+
+	shake_flip(&sc);
+	for (u = 0; u < 2000; u ++) {
+		uint64_t begin, end;
+
+		if (u == 1000) {
+			perf_start();
+		}
+		begin = core_cycles();
+		shake_extract(&sc, buf, sizeof buf);
+		end = core_cycles();
+		if (u >= 1000) {
+			tt2[u - 1000] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt2, (sizeof tt2) / sizeof tt2[0], sizeof tt2[0], &cmp_u64);
+	printf("shake256 extract:      %9.2f c/B",
+		(double)tt2[500] / (double)sizeof buf);
+	perf_report();
 	fflush(stdout);
 }
 
+/*
+ * KT128 speed, in cycles per byte, for hashing 64 kB messages (median
+ * over all measures).
+ */
+static void
+speed_kt128(void)
+{
+	size_t u;
+	uint64_t tt[100];
+	kt128_context kc;
+	static uint8_t buf[65536];
+	uint8_t out[32];
+
+	memset(buf, 0xA7, sizeof buf);
+	for (u = 0; u < 200; u ++) {
+		uint64_t begin, end;
+
+		if (u == 100) {
+			perf_start();
+		}
+		begin = core_cycles();
+		kt128_init(&kc);
+		kt128_inject(&kc, buf, sizeof buf);
+		kt128_flip(&kc, NULL, 0);
+		kt128_extract(&kc, out, sizeof out);
+		end = core_cycles();
+		buf[0] ^= out[0];
+		if (u >= 100) {
+			tt[u - 100] = end - begin;
+		}
+	}
+	perf_stop();
+	qsort(tt, (sizeof tt) / sizeof tt[0], sizeof tt[0], &cmp_u64);
+	printf("kt128 (64 kB):         %9.2f c/B",
+		(double)tt[50] / (double)sizeof buf);
+	perf_report();
+	fflush(stdout);
+}
 #endif
 
-int
-main(void)
+static void
+run_all(void)
 {
+	test_shake_x4();
+	test_kt128();
+	test_stats();
 	test_do255e_scalar();
 	test_do255s_scalar();
 	test_do255e_decode();
 	test_do255s_decode();
+	test_do255e_decode_batch();
+	test_do255s_decode_batch();
+	test_do255e_decode_vartime();
+	test_do255s_decode_vartime();
+	test_do255e_encode_batch();
+	test_do255s_encode_batch();
 	test_do255e_add();
 	test_do255s_add();
 	test_do255e_mul();
@@ -3779,23 +7060,52 @@ main(void)
 	test_do255s_map_to_curve();
 	test_do255e_verify_helper();
 	test_do255s_verify_helper();
+	test_do255e_msm();
+	test_do255s_msm();
+	test_do255e_mul_multi();
+	test_do255s_mul_multi();
+	test_do255e_mul_precomp();
+	test_do255s_mul_precomp();
+	test_do255e_mul_x4();
+	test_do255s_mul_x4();
 	test_do255e_keygen();
 	test_do255s_keygen();
 	test_do255e_ecdh();
 	test_do255s_ecdh();
 	test_do255e_sign();
 	test_do255s_sign();
+	test_do255e_sign_ctx();
+	test_do255s_sign_ctx();
+	test_do255e_sign_pool();
+	test_do255s_sign_pool();
+	test_do255e_verify_batch();
+	test_do255s_verify_batch();
 #if DO_BENCH86
+	perf_init();
 	speed_do255e_decode();
 	speed_do255s_decode();
 	speed_do255e_encode();
 	speed_do255s_encode();
+	speed_do255e_decode_batch();
+	speed_do255s_decode_batch();
+	speed_do255e_encode_batch();
+	speed_do255s_encode_batch();
 	speed_do255e_mul();
 	speed_do255s_mul();
 	speed_do255e_mulgen();
 	speed_do255s_mulgen();
+	speed_do255e_mul_precomp();
+	speed_do255s_mul_precomp();
 	speed_do255e_verify_helper();
 	speed_do255s_verify_helper();
+	speed_do255e_msm();
+	speed_do255s_msm();
+	speed_do255e_mul_multi();
+	speed_do255s_mul_multi();
+	speed_do255e_mul_x4();
+	speed_do255s_mul_x4();
+	speed_do255e_mulgen_x4();
+	speed_do255s_mulgen_x4();
 	printf("\n");
 	speed_do255e_keygen();
 	speed_do255s_keygen();
@@ -3804,7 +7114,51 @@ main(void)
 	speed_do255e_sign();
 	speed_do255s_sign();
 	speed_do255e_verify();
+	speed_do255e_verify_expanded();
 	speed_do255s_verify();
+	speed_do255s_verify_expanded();
+	speed_do255e_verify_batch();
+	speed_do255s_verify_batch();
+	printf("\n");
+	speed_shake256();
+	speed_kt128();
+#endif
+}
+
+#ifndef DO255_DISPATCH
+#define DO255_DISPATCH   0
+#endif
+
+int
+main(void)
+{
+#if DO255_DISPATCH
+	/*
+	 * With libdo255, run all tests and benchmarks for each backend
+	 * supported by the current CPU.
+	 */
+	static const char *const names[] = { "w64", "bmi2", "avx2" };
+	size_t u;
+
+	printf("Default backend: %s\n", do255_backend_name());
+	for (u = 0; u < (sizeof names) / sizeof names[0]; u ++) {
+		if (!do255_set_backend(names[u])) {
+			printf("\nBackend %s: not supported\n", names[u]);
+			continue;
+		}
+		if (strcmp(do255_backend_name(), names[u]) != 0) {
+			fprintf(stderr, "backend selection failed\n");
+			exit(EXIT_FAILURE);
+		}
+		printf("\nBackend %s:\n", names[u]);
+		run_all();
+	}
+	if (do255_set_backend("none")) {
+		fprintf(stderr, "unknown backend accepted\n");
+		exit(EXIT_FAILURE);
+	}
+#else
+	run_all();
 #endif
 	return 0;
 }